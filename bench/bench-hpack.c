@@ -0,0 +1,831 @@
+/*
+ * Benchmark HPACK encoder and decoder.
+ *
+ * Run one configuration -- operation, corpus, and encoder and decoder
+ * options -- and print results as a single line of JSON, so that runs can
+ * be collected and compared across releases.  The `bench' make target runs
+ * the whole matrix.
+ *
+ * The corpus is either a QIF file or one of the synthetic corpora generated
+ * from a seed.  Each header set is one header block; the time it takes to
+ * encode, decode or do both to a block is divided by the number of its
+ * headers to get a latency sample.  At the end of the first iteration, the
+ * heap freed by cleaning up the encoder and the decoder is divided by the
+ * number of their dynamic table entries to get memory per entry.
+ *
+ * QIF Format:
+ * https://github.com/quicwg/base-drafts/wiki/QPACK-Offline-Interop
+ */
+
+#define _GNU_SOURCE /* for memmem */
+#include <assert.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <fcntl.h>
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || __GLIBC_MINOR__ >= 33)
+#include <malloc.h>
+#define HAVE_MALLINFO2 1
+#endif
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#include "lshpack.h"
+#include XXH_HEADER_NAME
+
+#ifndef LS_HPACK_USE_LARGE_TABLES
+#define LS_HPACK_USE_LARGE_TABLES 1
+#endif
+
+#define TABLE_SIZE 4096
+#define N_SETS 1000
+
+/* Same as in lshpack.c: hashes given to the encoder must match its own */
+#define LSHPACK_XXH_SEED 39378473
+
+static void
+usage (const char *name)
+{
+    fprintf(stderr,
+"Usage: %s [options]\n"
+"\n"
+"Options:\n"
+"   -i FILE     Input QIF file.\n"
+"   -S NAME     Synthetic corpus instead of QIF: `requests' or `responses'.\n"
+"                 This is the default, with `requests'.\n"
+"   -s NUMBER   Seed for the synthetic corpus.  Defaults to 1.\n"
+"   -N NUMBER   Number of header sets in the synthetic corpus.  Defaults\n"
+"                 to %u.\n"
+"   -m MODE     `encode', `decode' or `roundtrip'.  Defaults to `decode'.\n"
+"   -n NUMBER   Number of times to iterate over the corpus.  Defaults to 100.\n"
+"   -t NUMBER   Dynamic table size.  Defaults to %u.\n"
+"   -H 0|1      Hashes: give them to the encoder, calculate them in the\n"
+"                 decoder.  Defaults to 1.\n"
+"   -1 0|1      HTTP/1.x decoder output.  Defaults to 0.\n"
+"   -y 0|1      Encoder history.  Defaults to 1.\n"
+"   -o FILE     Append results to FILE instead of printing them to stdout.\n"
+"\n"
+"   -h          Print this help screen and exit\n"
+    , name, N_SETS, TABLE_SIZE);
+}
+
+
+struct header
+{
+    size_t      off;            /* Name followed by value in the arena */
+    unsigned    name_len;
+    unsigned    val_len;
+    uint32_t    name_hash;
+    uint32_t    nameval_hash;
+};
+
+
+struct corpus
+{
+    char           *arena;
+    size_t          arena_sz, arena_used;
+    struct header  *headers;
+    unsigned        n_headers, n_alloc;
+    /* Header set i is headers [ sets[i], sets[i + 1] ) */
+    unsigned       *sets;
+    unsigned        n_sets, n_sets_alloc;
+    size_t          n_bytes;    /* Sum of name and value lengths */
+};
+
+
+static void *
+xrealloc (void *ptr, size_t size)
+{
+    ptr = realloc(ptr, size);
+    if (!ptr)
+    {
+        perror("realloc");
+        exit(EXIT_FAILURE);
+    }
+    return ptr;
+}
+
+
+static void
+corpus_start_set (struct corpus *corpus)
+{
+    if (corpus->n_sets + 2 > corpus->n_sets_alloc)
+    {
+        corpus->n_sets_alloc = corpus->n_sets_alloc
+                                        ? corpus->n_sets_alloc * 2 : 256;
+        corpus->sets = xrealloc(corpus->sets,
+                            sizeof(corpus->sets[0]) * corpus->n_sets_alloc);
+    }
+    corpus->sets[ corpus->n_sets++ ] = corpus->n_headers;
+    corpus->sets[ corpus->n_sets ] = corpus->n_headers;
+}
+
+
+static void
+corpus_add (struct corpus *corpus, const char *name, size_t name_len,
+                                            const char *val, size_t val_len)
+{
+    struct header *header;
+
+    if (corpus->arena_used + name_len + val_len > corpus->arena_sz)
+    {
+        corpus->arena_sz = corpus->arena_sz ? corpus->arena_sz : 0x10000;
+        while (corpus->arena_used + name_len + val_len > corpus->arena_sz)
+            corpus->arena_sz *= 2;
+        corpus->arena = xrealloc(corpus->arena, corpus->arena_sz);
+    }
+    if (corpus->n_headers >= corpus->n_alloc)
+    {
+        corpus->n_alloc = corpus->n_alloc ? corpus->n_alloc * 2 : 1024;
+        corpus->headers = xrealloc(corpus->headers,
+                                sizeof(corpus->headers[0]) * corpus->n_alloc);
+    }
+
+    header = &corpus->headers[ corpus->n_headers++ ];
+    header->off = corpus->arena_used;
+    header->name_len = name_len;
+    header->val_len = val_len;
+    memcpy(corpus->arena + corpus->arena_used, name, name_len);
+    memcpy(corpus->arena + corpus->arena_used + name_len, val, val_len);
+    corpus->arena_used += name_len + val_len;
+    header->name_hash = XXH32(name, name_len, LSHPACK_XXH_SEED);
+    header->nameval_hash = XXH32(val, val_len, header->name_hash);
+    corpus->n_bytes += name_len + val_len;
+    corpus->sets[ corpus->n_sets ] = corpus->n_headers;
+}
+
+
+static void
+corpus_load_qif (struct corpus *corpus, const char *path)
+{
+    const unsigned char *qif, *end, *p, *tab, *nl, *nlnl;
+    struct stat st;
+    int fd;
+
+    fd = open(path, O_RDONLY);
+    if (fd < 0)
+    {
+        perror("open");
+        exit(EXIT_FAILURE);
+    }
+    if (0 != fstat(fd, &st))
+    {
+        perror("fstat");
+        exit(EXIT_FAILURE);
+    }
+    qif = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (qif == MAP_FAILED)
+    {
+        perror("mmap");
+        exit(EXIT_FAILURE);
+    }
+
+    end = qif + st.st_size;
+    p = qif;
+    while (p + 2 < end)
+    {
+        nlnl = memmem(p, end - p, "\n\n", 2);
+        if (!nlnl)
+            nlnl = end;
+        corpus_start_set(corpus);
+        while (p < nlnl)
+        {
+            tab = memmem(p, nlnl - p, "\t", 1);
+            if (!tab)
+            {
+                fprintf(stderr, "tab not found, off: %u\n",
+                                            (unsigned) (p - qif));
+                exit(EXIT_FAILURE);
+            }
+            nl = memmem(tab + 1, nlnl - tab - 1, "\n", 1);
+            if (!nl)
+                nl = nlnl;
+            corpus_add(corpus, (const char *) p, tab - p,
+                                (const char *) tab + 1, nl - tab - 1);
+            p = nl + 1;
+        }
+        p = nlnl + 2;
+    }
+
+    munmap((void *) qif, st.st_size);
+    close(fd);
+}
+
+
+/* xorshift64*: the same seed always generates the same corpus */
+static uint64_t s_rand;
+
+static unsigned
+rand_below (unsigned n)
+{
+    s_rand ^= s_rand >> 12;
+    s_rand ^= s_rand << 25;
+    s_rand ^= s_rand >> 27;
+    return (unsigned) ((s_rand * 0x2545F4914F6CDD1DULL) >> 32) % n;
+}
+
+
+#define PICK(arr_) (arr_)[ rand_below(sizeof(arr_) / sizeof((arr_)[0])) ]
+
+static void
+add_str (struct corpus *corpus, const char *name, const char *val)
+{
+    corpus_add(corpus, name, strlen(name), val, strlen(val));
+}
+
+
+/* Fill `buf' with `len' random characters from `alphabet' */
+static const char *
+rand_token (char *buf, unsigned len, const char *alphabet)
+{
+    unsigned i, n = strlen(alphabet);
+
+    for (i = 0; i < len; ++i)
+        buf[i] = alphabet[ rand_below(n) ];
+    buf[len] = '\0';
+    return buf;
+}
+
+
+static const char HEX[] = "0123456789abcdef";
+static const char B64[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+/* Browser-like requests to a handful of sites: mostly repeated headers
+ * with some unique paths and cookies.
+ */
+static void
+corpus_gen_requests (struct corpus *corpus, unsigned n_sets)
+{
+    static const char *const hosts[] = {
+        "www.example.com", "static.example.com", "api.example.com",
+        "cdn.example.net", "images.example.org", "ads.example.biz",
+        "login.example.com", "video.example.tv",
+    };
+    static const char *const agents[] = {
+        "Mozilla/5.0 (Windows NT 10.0; Win64; x64) AppleWebKit/537.36 "
+            "(KHTML, like Gecko) Chrome/120.0.0.0 Safari/537.36",
+        "Mozilla/5.0 (Macintosh; Intel Mac OS X 10_15_7) AppleWebKit/605.1.15"
+            " (KHTML, like Gecko) Version/17.1 Safari/605.1.15",
+        "Mozilla/5.0 (X11; Linux x86_64; rv:121.0) Gecko/20100101 "
+            "Firefox/121.0",
+    };
+    static const char *const accepts[] = {
+        "text/html,application/xhtml+xml,application/xml;q=0.9,*/*;q=0.8",
+        "image/avif,image/webp,*/*", "application/json", "*/*",
+        "text/css,*/*;q=0.1",
+    };
+    static const char *const exts[] = {
+        ".html", ".js", ".css", ".png", ".jpg", "", ".json",
+    };
+    const char *host, *agent;
+    char path[0x200], buf[0x100];
+    unsigned n;
+
+    host = PICK(hosts);
+    agent = PICK(agents);
+    for (n = 0; n < n_sets; ++n)
+    {
+        corpus_start_set(corpus);
+        /* Sometimes move on to another site or another client */
+        if (rand_below(8) == 0)
+            host = PICK(hosts);
+        if (rand_below(64) == 0)
+            agent = PICK(agents);
+        add_str(corpus, ":method", rand_below(10) ? "GET" : "POST");
+        add_str(corpus, ":scheme", "https");
+        add_str(corpus, ":authority", host);
+        snprintf(path, sizeof(path), "/%s/%s%s",
+                    rand_token(buf, 1 + rand_below(8), B64 + 26),
+                    rand_token(buf + 0x10, 4 + rand_below(24), B64),
+                    PICK(exts));
+        add_str(corpus, ":path", path);
+        add_str(corpus, "user-agent", agent);
+        add_str(corpus, "accept", PICK(accepts));
+        add_str(corpus, "accept-encoding", "gzip, deflate, br");
+        add_str(corpus, "accept-language", "en-US,en;q=0.5");
+        if (rand_below(2))
+        {
+            snprintf(path, sizeof(path), "https://%s/", host);
+            add_str(corpus, "referer", path);
+        }
+        if (rand_below(4))
+        {
+            snprintf(path, sizeof(path), "sid=%s; theme=dark; uid=%s",
+                    rand_token(buf, 32, HEX), rand_token(buf + 0x40, 12, B64));
+            add_str(corpus, "cookie", path);
+        }
+        if (rand_below(16) == 0)
+            add_str(corpus, "x-request-id", rand_token(buf, 36, HEX));
+    }
+}
+
+
+static void
+corpus_gen_responses (struct corpus *corpus, unsigned n_sets)
+{
+    static const char *const statuses[] = {
+        "200", "200", "200", "200", "200", "200", "304", "304", "404", "204",
+        "301", "500",
+    };
+    static const char *const types[] = {
+        "text/html; charset=utf-8", "application/javascript", "text/css",
+        "image/png", "image/jpeg", "application/json",
+    };
+    static const char *const cache[] = {
+        "max-age=31536000, immutable", "no-cache", "private, max-age=0",
+        "public, max-age=3600",
+    };
+    char buf[0x40], val[0x100];
+    unsigned n;
+
+    for (n = 0; n < n_sets; ++n)
+    {
+        corpus_start_set(corpus);
+        add_str(corpus, ":status", PICK(statuses));
+        add_str(corpus, "server", "LiteSpeed");
+        snprintf(val, sizeof(val), "Mon, 18 Oct 2021 %02u:%02u:%02u GMT",
+                    n / 3600 % 24, n / 60 % 60, n % 60);
+        add_str(corpus, "date", val);
+        add_str(corpus, "content-type", PICK(types));
+        snprintf(val, sizeof(val), "%u", rand_below(200000));
+        add_str(corpus, "content-length", val);
+        add_str(corpus, "cache-control", PICK(cache));
+        if (rand_below(2))
+        {
+            snprintf(val, sizeof(val), "\"%s\"", rand_token(buf, 16, HEX));
+            add_str(corpus, "etag", val);
+        }
+        if (rand_below(8) == 0)
+        {
+            snprintf(val, sizeof(val), "sid=%s; Path=/; Secure; HttpOnly",
+                                                    rand_token(buf, 32, HEX));
+            add_str(corpus, "set-cookie", val);
+        }
+        add_str(corpus, "vary", "Accept-Encoding");
+    }
+}
+
+
+static uint64_t
+now_ns (void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+
+static int
+compare_doubles (const void *ap, const void *bp)
+{
+    const double a = *(const double *) ap, b = *(const double *) bp;
+    return (a > b) - (a < b);
+}
+
+
+enum mode { MODE_ENCODE, MODE_DECODE, MODE_ROUNDTRIP, };
+
+struct bench
+{
+    const struct corpus *corpus;
+    enum mode       mode;
+    unsigned        table_size;
+    int             hash, http1x, history;
+    /* Encoded corpus for decoding: block i is [ blocks[i], blocks[i+1] ) */
+    unsigned char  *enc_buf;
+    size_t         *blocks;
+    size_t          n_enc_bytes;
+    /* Latency samples, one per header set per iteration */
+    double         *samples;
+    unsigned        n_samples;
+    uint64_t        total_ns;
+    char           *out_buf;
+    size_t          out_buf_sz;
+    /* Heap used by the encoder and the decoder at the end of the first
+     * iteration, divided by the number of dynamic table entries.
+     */
+    double          enc_bytes_per_entry;
+    double          dec_bytes_per_entry;
+};
+
+
+static void
+init_encoder (const struct bench *bench, struct lshpack_enc *enc)
+{
+    if (0 != lshpack_enc_init(enc))
+    {
+        perror("lshpack_enc_init");
+        exit(EXIT_FAILURE);
+    }
+    lshpack_enc_set_max_capacity(enc, bench->table_size);
+    (void) lshpack_enc_use_hist(enc, bench->history);
+}
+
+
+static void
+init_decoder (const struct bench *bench, struct lshpack_dec *dec)
+{
+    lshpack_dec_init(dec);
+    lshpack_dec_set_max_capacity(dec, bench->table_size);
+    lshpack_dec_use_hash(dec, bench->hash);
+    lshpack_dec_use_http1x(dec, bench->http1x);
+}
+
+
+/* Encode header set `set' to [dst, dst_end).  Returns end of output. */
+static unsigned char *
+encode_set (const struct bench *bench, struct lshpack_enc *enc, unsigned set,
+                            unsigned char *dst, unsigned char *dst_end)
+{
+    const struct corpus *const corpus = bench->corpus;
+    const struct header *header;
+    struct lsxpack_header xhdr;
+    unsigned char *p;
+    unsigned i;
+
+    for (i = corpus->sets[set]; i < corpus->sets[set + 1]; ++i)
+    {
+        header = &corpus->headers[i];
+        lsxpack_header_set_offset2(&xhdr, corpus->arena + header->off, 0,
+                header->name_len, header->name_len, header->val_len);
+        if (bench->hash)
+        {
+            xhdr.flags |= LSXPACK_NAME_HASH | LSXPACK_NAMEVAL_HASH;
+            xhdr.name_hash = header->name_hash;
+            xhdr.nameval_hash = header->nameval_hash;
+        }
+        p = lshpack_enc_encode(enc, dst, dst_end, &xhdr);
+        if (p <= dst)
+        {
+            fprintf(stderr, "cannot encode header %u\n", i);
+            exit(EXIT_FAILURE);
+        }
+        dst = p;
+    }
+    return dst;
+}
+
+
+/* Decode block [src, src_end).  If `set' is not negative, check that
+ * the output matches it.
+ */
+static void
+decode_block (struct bench *bench, struct lshpack_dec *dec,
+            const unsigned char *src, const unsigned char *src_end, int set)
+{
+    const struct corpus *const corpus = bench->corpus;
+    const struct header *header;
+    struct lsxpack_header xhdr;
+    unsigned i;
+    int rc;
+
+    i = set >= 0 ? corpus->sets[set] : 0;
+    while (src < src_end)
+    {
+        lsxpack_header_prepare_decode(&xhdr, bench->out_buf, 0,
+                                                        bench->out_buf_sz);
+        rc = lshpack_dec_decode(dec, &src, src_end, &xhdr);
+        if (rc != 0)
+        {
+            fprintf(stderr, "cannot decode: error %d\n", rc);
+            exit(EXIT_FAILURE);
+        }
+        if (set >= 0)
+        {
+            header = &corpus->headers[i++];
+            if (!(xhdr.name_len == header->name_len
+                    && xhdr.val_len == header->val_len
+                    && 0 == memcmp(lsxpack_header_get_name(&xhdr),
+                                corpus->arena + header->off, xhdr.name_len)
+                    && 0 == memcmp(lsxpack_header_get_value(&xhdr),
+                                corpus->arena + header->off + xhdr.name_len,
+                                xhdr.val_len)))
+            {
+                fprintf(stderr, "decoded header %u does not match\n", i - 1);
+                exit(EXIT_FAILURE);
+            }
+        }
+    }
+}
+
+
+static void
+prepare_decode (struct bench *bench)
+{
+    const struct corpus *const corpus = bench->corpus;
+    struct lshpack_enc enc;
+    size_t size;
+    unsigned set;
+    unsigned char *p;
+
+    /* Twice the input and then some is always enough */
+    size = corpus->n_bytes * 2 + corpus->n_headers * 8 + 0x100;
+    bench->enc_buf = xrealloc(NULL, size);
+    bench->blocks = xrealloc(NULL,
+                            sizeof(bench->blocks[0]) * (corpus->n_sets + 1));
+    init_encoder(bench, &enc);
+    p = bench->enc_buf;
+    for (set = 0; set < corpus->n_sets; ++set)
+    {
+        bench->blocks[set] = p - bench->enc_buf;
+        p = encode_set(bench, &enc, set, p, bench->enc_buf + size);
+    }
+    bench->blocks[set] = p - bench->enc_buf;
+    bench->n_enc_bytes = p - bench->enc_buf;
+    lshpack_enc_cleanup(&enc);
+}
+
+
+/* The first iteration warms up caches and checks the output; it is not
+ * timed.
+ */
+static size_t
+heap_used (void)
+{
+#if HAVE_MALLINFO2
+    return mallinfo2().uordblks;
+#else
+    return 0;
+#endif
+}
+
+
+/* The heap used by each table is what freeing it gives back */
+static void
+measure_tables (struct bench *bench, struct lshpack_enc *enc,
+                                                    struct lshpack_dec *dec)
+{
+    size_t before, after;
+    unsigned n;
+
+    if (bench->mode != MODE_DECODE)
+    {
+        n = enc->hpe_nelem;
+        before = heap_used();
+        lshpack_enc_cleanup(enc);
+        after = heap_used();
+        if (n)
+            bench->enc_bytes_per_entry = (double) (before - after) / n;
+    }
+    if (bench->mode != MODE_ENCODE)
+    {
+        n = dec->hpd_dyn_table.nelem;
+        before = heap_used();
+        lshpack_dec_cleanup(dec);
+        after = heap_used();
+        if (n)
+            bench->dec_bytes_per_entry = (double) (before - after) / n;
+    }
+}
+
+
+static void
+run (struct bench *bench, unsigned n_iters)
+{
+    const struct corpus *const corpus = bench->corpus;
+    struct lshpack_enc enc;
+    struct lshpack_dec dec;
+    unsigned char buf[0x10000], *end;
+    uint64_t start, stop;
+    unsigned n, set, n_headers;
+    int check;
+
+    for (n = 0; n <= n_iters; ++n)
+    {
+        if (bench->mode != MODE_DECODE)
+            init_encoder(bench, &enc);
+        if (bench->mode != MODE_ENCODE)
+            init_decoder(bench, &dec);
+        for (set = 0; set < corpus->n_sets; ++set)
+        {
+            n_headers = corpus->sets[set + 1] - corpus->sets[set];
+            if (n_headers == 0)
+                continue;
+            check = n == 0 ? (int) set : -1;
+            start = now_ns();
+            switch (bench->mode)
+            {
+            case MODE_ENCODE:
+                (void) encode_set(bench, &enc, set, buf, buf + sizeof(buf));
+                break;
+            case MODE_DECODE:
+                decode_block(bench, &dec,
+                            bench->enc_buf + bench->blocks[set],
+                            bench->enc_buf + bench->blocks[set + 1], check);
+                break;
+            default:
+                end = encode_set(bench, &enc, set, buf, buf + sizeof(buf));
+                decode_block(bench, &dec, buf, end, check);
+                break;
+            }
+            stop = now_ns();
+            if (n > 0)
+            {
+                bench->samples[ bench->n_samples++ ]
+                                    = (double) (stop - start) / n_headers;
+                bench->total_ns += stop - start;
+            }
+        }
+        if (n == 0)
+            measure_tables(bench, &enc, &dec);
+        else
+        {
+            if (bench->mode != MODE_DECODE)
+                lshpack_enc_cleanup(&enc);
+            if (bench->mode != MODE_ENCODE)
+                lshpack_dec_cleanup(&dec);
+        }
+    }
+}
+
+
+int
+main (int argc, char **argv)
+{
+    static const char *const mode_names[] = {
+        [MODE_ENCODE]    = "encode",
+        [MODE_DECODE]    = "decode",
+        [MODE_ROUNDTRIP] = "roundtrip",
+    };
+    FILE *out = stdout;
+    int opt;
+    unsigned n_iters = 100, n_sets = N_SETS, seed = 1, i;
+    const char *qif_path = NULL, *synthetic = "requests", *corpus_name;
+    struct corpus corpus;
+    struct bench bench;
+    struct rusage ru;
+    double seconds, percentile[3];
+    uint64_t n_headers, n_bytes;
+
+    memset(&bench, 0, sizeof(bench));
+    bench.mode = MODE_DECODE;
+    bench.table_size = TABLE_SIZE;
+    bench.hash = 1;
+    bench.history = 1;
+
+    while (-1 != (opt = getopt(argc, argv, "i:S:s:N:m:n:t:H:1:y:o:h")))
+    {
+        switch (opt)
+        {
+        case 'i':
+            qif_path = optarg;
+            break;
+        case 'S':
+            synthetic = optarg;
+            break;
+        case 's':
+            seed = atoi(optarg);
+            break;
+        case 'N':
+            n_sets = atoi(optarg);
+            break;
+        case 'm':
+            for (i = 0; i < sizeof(mode_names) / sizeof(mode_names[0]); ++i)
+                if (0 == strcmp(optarg, mode_names[i]))
+                    break;
+            if (i >= sizeof(mode_names) / sizeof(mode_names[0]))
+            {
+                fprintf(stderr, "unknown mode `%s'\n", optarg);
+                exit(EXIT_FAILURE);
+            }
+            bench.mode = i;
+            break;
+        case 'n':
+            n_iters = atoi(optarg);
+            break;
+        case 't':
+            bench.table_size = atoi(optarg);
+            break;
+        case 'H':
+            bench.hash = !!atoi(optarg);
+            break;
+        case '1':
+            bench.http1x = !!atoi(optarg);
+            break;
+        case 'y':
+            bench.history = !!atoi(optarg);
+            break;
+        case 'o':
+            out = fopen(optarg, "a");
+            if (!out)
+            {
+                fprintf(stderr, "cannot open `%s' for writing: %s\n",
+                                                optarg, strerror(errno));
+                exit(EXIT_FAILURE);
+            }
+            break;
+        case 'h':
+            usage(argv[0]);
+            exit(EXIT_SUCCESS);
+        default:
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    memset(&corpus, 0, sizeof(corpus));
+    s_rand = 0x9E3779B97F4A7C15ULL * (seed + 1);
+    if (qif_path)
+    {
+        corpus_load_qif(&corpus, qif_path);
+        corpus_name = strrchr(qif_path, '/');
+        corpus_name = corpus_name ? corpus_name + 1 : qif_path;
+    }
+    else if (0 == strcmp(synthetic, "requests"))
+    {
+        corpus_gen_requests(&corpus, n_sets);
+        corpus_name = "synthetic-requests";
+    }
+    else if (0 == strcmp(synthetic, "responses"))
+    {
+        corpus_gen_responses(&corpus, n_sets);
+        corpus_name = "synthetic-responses";
+    }
+    else
+    {
+        fprintf(stderr, "unknown synthetic corpus `%s'\n", synthetic);
+        exit(EXIT_FAILURE);
+    }
+    if (corpus.n_headers == 0 || n_iters == 0)
+    {
+        fprintf(stderr, "nothing to do\n");
+        exit(EXIT_FAILURE);
+    }
+
+    bench.corpus = &corpus;
+    bench.out_buf_sz = 0x10000;
+    bench.out_buf = xrealloc(NULL, bench.out_buf_sz);
+    bench.samples = xrealloc(NULL,
+                        sizeof(bench.samples[0]) * corpus.n_sets * n_iters);
+    prepare_decode(&bench);
+
+#if LSHPACK_PROFILE
+    lshpack_prof_reset();
+#endif
+    run(&bench, n_iters);
+
+    qsort(bench.samples, bench.n_samples, sizeof(bench.samples[0]),
+                                                            compare_doubles);
+    percentile[0] = bench.samples[ (size_t) (bench.n_samples * 0.5) ];
+    percentile[1] = bench.samples[ (size_t) (bench.n_samples * 0.99) ];
+    percentile[2] = bench.samples[ (size_t) (bench.n_samples * 0.999) ];
+    seconds = bench.total_ns / 1e9;
+    n_headers = (uint64_t) corpus.n_headers * n_iters;
+    n_bytes = (uint64_t) corpus.n_bytes * n_iters;
+    (void) getrusage(RUSAGE_SELF, &ru);
+
+    fprintf(out, "{\"version\":\"%d.%d.%d\",\"mode\":\"%s\",\"corpus\":\"%s\","
+        "\"large_tables\":%d,\"hash\":%d,\"http1x\":%d,\"history\":%d,"
+        "\"table_size\":%u,\"iterations\":%u,\"header_sets\":%u,"
+        "\"headers\":%" PRIu64 ",\"bytes\":%" PRIu64 ","
+        "\"encoded_bytes\":%zu,\"seconds\":%.6f,"
+        "\"headers_per_sec\":%.0f,\"bytes_per_sec\":%.0f,"
+        "\"ns_per_header\":%.2f,\"p50_ns\":%.2f,\"p99_ns\":%.2f,"
+        "\"p999_ns\":%.2f,\"peak_rss_kb\":%ld,"
+        "\"enc_bytes_per_entry\":%.1f,\"dec_bytes_per_entry\":%.1f}\n",
+        LSHPACK_MAJOR_VERSION, LSHPACK_MINOR_VERSION, LSHPACK_PATCH_VERSION,
+        mode_names[bench.mode], corpus_name, LS_HPACK_USE_LARGE_TABLES,
+        bench.hash, bench.http1x, bench.history, bench.table_size, n_iters,
+        corpus.n_sets, n_headers, n_bytes, bench.n_enc_bytes,
+        seconds, n_headers / seconds, n_bytes / seconds,
+        bench.total_ns / (double) n_headers,
+        percentile[0], percentile[1], percentile[2],
+        ru.ru_maxrss, bench.enc_bytes_per_entry, bench.dec_bytes_per_entry);
+
+#if LSHPACK_PROFILE
+    {
+        /* Library built with LSHPACK_PROFILE: add a line with cycles spent
+         * in each phase.
+         */
+        struct lshpack_prof prof;
+        enum lshpack_prof_phase phase;
+
+        lshpack_prof_get(&prof);
+        fprintf(out, "{\"mode\":\"%s\",\"corpus\":\"%s\",\"profile\":{",
+                                            mode_names[bench.mode], corpus_name);
+        for (phase = 0; phase < LSHPACK_PROF_N_PHASES; ++phase)
+            fprintf(out, "%s\"%s\":{\"cycles\":%" PRIu64 ",\"calls\":%"
+                PRIu64 "}", phase ? "," : "", lshpack_prof_phase_name(phase),
+                prof.cycles[phase], prof.calls[phase]);
+        fprintf(out, "}}\n");
+    }
+#endif
+
+    if (out != stdout)
+        fclose(out);
+    free(bench.samples);
+    free(bench.out_buf);
+    free(bench.enc_buf);
+    free(bench.blocks);
+    free(corpus.arena);
+    free(corpus.headers);
+    free(corpus.sets);
+    exit(EXIT_SUCCESS);
+}
@@ -0,0 +1,285 @@
+/*
+ * Microbenchmark HPACK integer encoder and decoder.
+ *
+ * For each prefix width and encoded size, time decoding and encoding an
+ * array of integers.  The decoder is run twice: with trailing bytes, so
+ * that the 64-bit load is used, and with each integer ending its buffer,
+ * which forces the byte-by-byte loop.  The byte-by-byte decoder that was
+ * used before is timed as reference.  Each case is printed as a line of
+ * JSON.
+ *
+ * lshpack.c must be compiled with LS_HPACK_EMIT_TEST_CODE for the integer
+ * functions to be visible.
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "lshpack.h"
+#include "lshpack-test.h"
+
+#define N_INTS 4096
+
+struct int_case
+{
+    unsigned        ic_prefix_bits;
+    unsigned        ic_enc_sz;      /* Zero means mixed sizes */
+};
+
+static const struct int_case cases[] =
+{
+    { 4, 1, }, { 4, 2, }, { 4, 3, },
+    { 5, 1, }, { 5, 2, }, { 5, 3, },
+    { 6, 1, }, { 6, 2, }, { 6, 3, },
+    { 7, 1, }, { 7, 2, }, { 7, 3, }, { 7, 4, }, { 7, 5, }, { 7, 6, },
+    { 7, 0, },
+};
+
+
+static void
+usage (const char *name)
+{
+    fprintf(stderr,
+"Usage: %s [options]\n"
+"\n"
+"Options:\n"
+"   -n NUMBER   Number of passes over each array.  Defaults to 1000.\n"
+"   -o FILE     Append results to FILE instead of writing to stdout.\n"
+"\n"
+"   -h          Print this help screen and exit\n"
+    , name);
+}
+
+
+/* The decoder as it was before the 64-bit fast path.  Not inlined, so
+ * that it is called the same way as the library functions are.
+ */
+#if __GNUC__
+__attribute__((noinline))
+#endif
+static int
+ref_dec_int (const unsigned char **src_p, const unsigned char *src_end,
+                                        unsigned prefix_bits, uint32_t *value_p)
+{
+    const unsigned char *const orig_src = *src_p;
+    const unsigned char *src;
+    unsigned prefix_max, M;
+    uint32_t val, B;
+
+    src = *src_p;
+    prefix_max = (1 << prefix_bits) - 1;
+    val = *src++;
+    val &= prefix_max;
+    if (val < prefix_max)
+    {
+        *src_p = src;
+        *value_p = val;
+        return 0;
+    }
+
+    M = 0;
+    do
+    {
+        if (src < src_end)
+        {
+            B = *src++;
+            val = val + ((B & 0x7f) << M);
+            M += 7;
+        }
+        else if (src - orig_src < 6)
+            return -1;
+        else
+            return -2;
+    }
+    while (B & 0x80);
+
+    if (M <= 28 || (M == 35 && src[-1] <= 0xF && val - (src[-1] << 28) < val))
+    {
+        *src_p = src;
+        *value_p = val;
+        return 0;
+    }
+    else
+        return -2;
+}
+
+
+static uint64_t
+now_ns (void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+
+static uint64_t s_rand = 0x2545F4914F6CDD1DULL;
+
+static uint32_t
+rand32 (void)
+{
+    s_rand ^= s_rand >> 12;
+    s_rand ^= s_rand << 25;
+    s_rand ^= s_rand >> 27;
+    return (s_rand * 0x2545F4914F6CDD1DULL) >> 32;
+}
+
+
+/* Random value that takes exactly `enc_sz' bytes to encode */
+static uint32_t
+rand_value (unsigned prefix_bits, unsigned enc_sz)
+{
+    uint32_t prefix_max = (1u << prefix_bits) - 1, lo, hi;
+
+    if (enc_sz == 1)
+        return rand32() % prefix_max;
+    lo = enc_sz == 2 ? 0 : 1u << (7 * (enc_sz - 2));
+    hi = enc_sz == 6 ? UINT32_MAX - prefix_max : (1u << (7 * (enc_sz - 1))) - 1;
+    return prefix_max + lo + rand32() % (hi - lo + 1);
+}
+
+
+enum op { OP_DEC, OP_DEC_BYTEWISE, OP_DEC_REF, OP_ENC, N_OPS, };
+
+static const char *const op_names[N_OPS] =
+{
+    [OP_DEC]            = "dec",
+    [OP_DEC_BYTEWISE]   = "dec-bytewise",
+    [OP_DEC_REF]        = "dec-ref",
+    [OP_ENC]            = "enc",
+};
+
+
+int
+main (int argc, char **argv)
+{
+    const struct int_case *icase;
+    const unsigned char *src;
+    unsigned char *buf, *dst;
+    uint32_t values[N_INTS], val, sum;
+    unsigned char sizes[N_INTS];
+    unsigned n_passes = 1000, pass, i;
+    enum op op;
+    uint64_t start, stop;
+    FILE *out = stdout;
+    int opt, rv;
+
+    while (-1 != (opt = getopt(argc, argv, "n:o:h")))
+    {
+        switch (opt)
+        {
+        case 'n':
+            n_passes = atoi(optarg);
+            break;
+        case 'o':
+            out = fopen(optarg, "a");
+            if (!out)
+            {
+                perror("fopen");
+                exit(EXIT_FAILURE);
+            }
+            break;
+        case 'h':
+            usage(argv[0]);
+            exit(EXIT_SUCCESS);
+        default:
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    /* Each integer gets eight bytes, so that the fast path is taken when
+     * the buffer end is not set right behind the integer.
+     */
+    buf = malloc(N_INTS * 8 + 8);
+    if (!buf)
+    {
+        perror("malloc");
+        exit(EXIT_FAILURE);
+    }
+
+    for (icase = cases; icase < cases + sizeof(cases) / sizeof(cases[0]);
+                                                                    ++icase)
+    {
+        memset(buf, 0, N_INTS * 8 + 8);
+        for (i = 0; i < N_INTS; ++i)
+        {
+            sizes[i] = icase->ic_enc_sz ? icase->ic_enc_sz
+                                                    : 2 + rand32() % 5;
+            values[i] = rand_value(icase->ic_prefix_bits, sizes[i]);
+            dst = lshpack_enc_enc_int(buf + i * 8, buf + i * 8 + 8, values[i],
+                                                    icase->ic_prefix_bits);
+            if (dst != buf + i * 8 + sizes[i])
+            {
+                fprintf(stderr, "cannot encode %" PRIu32 "\n", values[i]);
+                exit(EXIT_FAILURE);
+            }
+        }
+
+        for (op = 0; op < N_OPS; ++op)
+        {
+            /* The first pass is a warm-up and is not timed */
+            sum = 0;
+            start = 0;
+            for (pass = 0; pass <= n_passes; ++pass)
+            {
+                if (pass == 1)
+                {
+                    sum = 0;
+                    start = now_ns();
+                }
+                for (i = 0; i < N_INTS; ++i)
+                {
+                    src = buf + i * 8;
+                    switch (op)
+                    {
+                    case OP_DEC:
+                        rv = lshpack_dec_dec_int(&src, src + 8,
+                                            icase->ic_prefix_bits, &val);
+                        break;
+                    case OP_DEC_BYTEWISE:
+                        rv = lshpack_dec_dec_int(&src, src + sizes[i],
+                                            icase->ic_prefix_bits, &val);
+                        break;
+                    case OP_DEC_REF:
+                        rv = ref_dec_int(&src, src + 8,
+                                            icase->ic_prefix_bits, &val);
+                        break;
+                    default:
+                        dst = buf + i * 8;
+                        *dst &= ~((1u << icase->ic_prefix_bits) - 1);
+                        rv = lshpack_enc_enc_int(dst, dst + 8, values[i],
+                                    icase->ic_prefix_bits) == dst;
+                        val = dst[sizes[i] - 1];
+                        break;
+                    }
+                    if (rv != 0)
+                    {
+                        fprintf(stderr, "%s failed on integer %u\n",
+                                                        op_names[op], i);
+                        exit(EXIT_FAILURE);
+                    }
+                    sum += val;
+                }
+            }
+            stop = now_ns();
+            /* Print the sum so that the loop is not optimized away */
+            fprintf(out, "{\"version\":\"%d.%d.%d\",\"op\":\"%s\","
+                "\"prefix_bits\":%u,\"enc_sz\":%u,\"ints\":%" PRIu64 ","
+                "\"ns_per_int\":%.3f,\"sum\":%" PRIu32 "}\n",
+                LSHPACK_MAJOR_VERSION, LSHPACK_MINOR_VERSION,
+                LSHPACK_PATCH_VERSION, op_names[op], icase->ic_prefix_bits,
+                icase->ic_enc_sz, (uint64_t) N_INTS * n_passes,
+                (double) (stop - start) / ((double) N_INTS * n_passes), sum);
+        }
+    }
+
+    free(buf);
+    if (out != stdout)
+        fclose(out);
+    exit(EXIT_SUCCESS);
+}
@@ -0,0 +1,390 @@
+/*
+ * Decode HPACK stream produced by encode-qif and verify it against the QIF
+ * it was produced from.  Use for benchmarking.
+ *
+ * How it works: read in QIF into a list of headers, decode the stream
+ * once and compare the output with the list, then decode the stream a
+ * number of times and report how long it took.  Both files are mmapped.
+ *
+ * The stream must be a single pass of encode-qif over the QIF (its `-n'
+ * set to 1) and the dynamic table size must be at least as large as the
+ * one encode-qif used.
+ *
+ * QIF Format:
+ * https://github.com/quicwg/base-drafts/wiki/QPACK-Offline-Interop
+ */
+
+#define _GNU_SOURCE /* for memmem */
+#include <assert.h>
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <sys/mman.h>
+
+#include "lshpack.h"
+
+static int s_verbose;
+
+#define TABLE_SIZE 4096
+#define BUF_SIZE 0x1000
+
+static void
+usage (const char *name)
+{
+    fprintf(stderr,
+"Usage: %s [options] -i QIF -s STREAM\n"
+"\n"
+"Options:\n"
+"   -i FILE     QIF file the stream was encoded from.\n"
+"   -s FILE     HPACK stream produced by encode-qif.\n"
+"   -n NUMBER   Number of times to decode the stream.  Defaults to 1.\n"
+"   -t NUMBER   Dynamic table size.  Defaults to %u.\n"
+"   -b MODE     Output buffer strategy:\n"
+"                 reuse   Decode each header into the same buffer, growing\n"
+"                           it when it is too small.  This is the default.\n"
+"                 views   Like `reuse', but point at the input and at the\n"
+"                           tables where possible.\n"
+"                 arena   Decode all headers into one arena using\n"
+"                           lshpack_dec_decode_block().\n"
+"   -B NUMBER   Initial output buffer size.  Defaults to %u.\n"
+"   -v          Verbose: print various messages to stderr.\n"
+"\n"
+"   -h          Print this help screen and exit\n"
+    , name, TABLE_SIZE, BUF_SIZE);
+}
+
+
+struct header
+{
+    const char    *name;
+    const char    *val;
+    size_t         name_len;
+    size_t         val_len;
+};
+
+
+enum buf_mode { BUF_REUSE, BUF_VIEWS, BUF_ARENA, };
+
+
+struct file
+{
+    const unsigned char *begin;
+    const unsigned char *end;
+};
+
+
+static void
+map_file (struct file *file, const char *path)
+{
+    struct stat st;
+    int fd;
+
+    fd = open(path, O_RDONLY);
+    if (fd < 0)
+    {
+        fprintf(stderr, "cannot open `%s': %s\n", path, strerror(errno));
+        exit(EXIT_FAILURE);
+    }
+    if (0 != fstat(fd, &st))
+    {
+        perror("fstat");
+        exit(EXIT_FAILURE);
+    }
+    file->begin = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (file->begin == MAP_FAILED)
+    {
+        perror("mmap");
+        exit(EXIT_FAILURE);
+    }
+    file->end = file->begin + st.st_size;
+    close(fd);
+}
+
+
+/* Parse QIF the same way encode-qif does */
+static struct header *
+parse_qif (const struct file *file, unsigned *n_headers_p)
+{
+    const unsigned char *qif, *p, *tab, *nl, *nlnl;
+    struct header *headers = NULL;
+    unsigned n_headers = 0, n_alloc = 0;
+
+    qif = file->begin;
+    while (qif + 2 < file->end)
+    {
+        nlnl = memmem(qif, file->end - qif, "\n\n", 2);
+        if (!nlnl)
+            nlnl = file->end;
+        p = qif;
+        while (p < nlnl)
+        {
+            tab = memmem(p, nlnl - p, "\t", 1);
+            if (!tab)
+            {
+                fprintf(stderr, "tab not found, off: %u\n",
+                                            (unsigned) (p - file->begin));
+                exit(EXIT_FAILURE);
+            }
+            nl = memmem(tab + 1, nlnl - tab - 1, "\n", 1);
+            if (!nl)
+                nl = nlnl;
+            if (n_headers >= n_alloc)
+            {
+                n_alloc = n_alloc ? n_alloc * 2 : 1024;
+                headers = realloc(headers, sizeof(headers[0]) * n_alloc);
+                if (!headers)
+                {
+                    perror("realloc");
+                    exit(EXIT_FAILURE);
+                }
+            }
+            headers[ n_headers++ ] = (struct header) {
+                .name = (const char *) p,
+                .val = (const char *) tab + 1,
+                .name_len =  tab - p,
+                .val_len = nl - tab - 1,
+            };
+            p = nl + 1;
+        }
+        qif = nlnl + 2;
+    }
+
+    *n_headers_p = n_headers;
+    return headers;
+}
+
+
+struct decode_ctx
+{
+    struct lshpack_dec          dec;
+    struct lshpack_dec_block    block;
+    char                       *buf;
+    size_t                      buf_sz;
+    enum buf_mode               mode;
+    unsigned                    table_size;
+    /* If set, check output against these */
+    const struct header        *headers;
+    unsigned                    n_headers;
+};
+
+
+static void
+check_header (const struct decode_ctx *ctx, unsigned n,
+                                        const struct lsxpack_header *xhdr)
+{
+    const struct header *header;
+
+    if (n >= ctx->n_headers)
+    {
+        fprintf(stderr, "stream has more headers than QIF (%u)\n",
+                                                            ctx->n_headers);
+        exit(EXIT_FAILURE);
+    }
+    header = &ctx->headers[n];
+    if (!(xhdr->name_len == header->name_len
+            && xhdr->val_len == header->val_len
+            && 0 == memcmp(lsxpack_header_get_name(xhdr), header->name,
+                                                            header->name_len)
+            && 0 == memcmp(lsxpack_header_get_value(xhdr), header->val,
+                                                            header->val_len)))
+    {
+        fprintf(stderr, "header %u mismatch: expected `%.*s: %.*s', "
+            "got `%.*s: %.*s'\n", n,
+            (int) header->name_len, header->name,
+            (int) header->val_len, header->val,
+            (int) xhdr->name_len, lsxpack_header_get_name(xhdr),
+            (int) xhdr->val_len, lsxpack_header_get_value(xhdr));
+        exit(EXIT_FAILURE);
+    }
+}
+
+
+/* Decode the whole stream once.  Returns number of headers decoded. */
+static unsigned
+decode_stream (struct decode_ctx *ctx, const struct file *stream)
+{
+    const unsigned char *src;
+    struct lsxpack_header xhdr;
+    char *new_buf;
+    unsigned n;
+    int rc;
+
+    lshpack_dec_init(&ctx->dec);
+    lshpack_dec_set_max_capacity(&ctx->dec, ctx->table_size);
+    lshpack_dec_use_views(&ctx->dec, ctx->mode == BUF_VIEWS);
+
+    if (ctx->mode == BUF_ARENA)
+    {
+        rc = lshpack_dec_decode_block(&ctx->dec, stream->begin, stream->end,
+                                                            &ctx->block, 0);
+        if (rc != 0)
+        {
+            fprintf(stderr, "cannot decode stream: error %d\n", rc);
+            exit(EXIT_FAILURE);
+        }
+        if (ctx->headers)
+            for (n = 0; n < ctx->block.n_headers; ++n)
+                check_header(ctx, n, &ctx->block.headers[n]);
+        n = ctx->block.n_headers;
+        goto end;
+    }
+
+    src = stream->begin;
+    n = 0;
+    while (src < stream->end)
+    {
+        lsxpack_header_prepare_decode(&xhdr, ctx->buf, 0, ctx->buf_sz);
+        rc = lshpack_dec_decode(&ctx->dec, &src, stream->end, &xhdr);
+        if (rc == LSHPACK_ERR_MORE_BUF)
+        {
+            /* val_len is set to the exact size needed */
+            new_buf = realloc(ctx->buf, xhdr.val_len);
+            if (!new_buf)
+            {
+                perror("realloc");
+                exit(EXIT_FAILURE);
+            }
+            if (s_verbose)
+                fprintf(stderr, "grow output buffer from %zu to %u "
+                            "bytes\n", ctx->buf_sz, (unsigned) xhdr.val_len);
+            ctx->buf = new_buf;
+            ctx->buf_sz = xhdr.val_len;
+            continue;
+        }
+        if (rc != 0)
+        {
+            fprintf(stderr, "cannot decode header %u at offset %u: "
+                "error %d\n", n, (unsigned) (src - stream->begin), rc);
+            exit(EXIT_FAILURE);
+        }
+        if (ctx->headers)
+            check_header(ctx, n, &xhdr);
+        ++n;
+    }
+
+  end:
+    lshpack_dec_cleanup(&ctx->dec);
+    return n;
+}
+
+
+int
+main (int argc, char **argv)
+{
+    int opt;
+    unsigned n_iters = 1, n, n_qif_headers, n_decoded;
+    const char *qif_path = NULL, *stream_path = NULL;
+    struct file qif, stream;
+    struct header *headers;
+    struct decode_ctx ctx;
+    struct timespec start, stop;
+    double seconds;
+
+    memset(&ctx, 0, sizeof(ctx));
+    ctx.mode = BUF_REUSE;
+    ctx.table_size = TABLE_SIZE;
+    ctx.buf_sz = BUF_SIZE;
+
+    while (-1 != (opt = getopt(argc, argv, "i:s:n:t:b:B:vh")))
+    {
+        switch (opt)
+        {
+        case 'i':
+            qif_path = optarg;
+            break;
+        case 's':
+            stream_path = optarg;
+            break;
+        case 'n':
+            n_iters = atoi(optarg);
+            break;
+        case 't':
+            ctx.table_size = atoi(optarg);
+            break;
+        case 'b':
+            if (0 == strcmp(optarg, "reuse"))
+                ctx.mode = BUF_REUSE;
+            else if (0 == strcmp(optarg, "views"))
+                ctx.mode = BUF_VIEWS;
+            else if (0 == strcmp(optarg, "arena"))
+                ctx.mode = BUF_ARENA;
+            else
+            {
+                fprintf(stderr, "unknown buffer mode `%s'\n", optarg);
+                exit(EXIT_FAILURE);
+            }
+            break;
+        case 'B':
+            ctx.buf_sz = atoi(optarg);
+            break;
+        case 'h':
+            usage(argv[0]);
+            exit(EXIT_SUCCESS);
+        case 'v':
+            ++s_verbose;
+            break;
+        default:
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    if (!qif_path || !stream_path)
+    {
+        fprintf(stderr, "Please specify QIF file using -i flag and HPACK "
+                                            "stream using -s flag\n");
+        exit(EXIT_FAILURE);
+    }
+
+    map_file(&qif, qif_path);
+    map_file(&stream, stream_path);
+    headers = parse_qif(&qif, &n_qif_headers);
+
+    ctx.buf = malloc(ctx.buf_sz ? ctx.buf_sz : 1);
+    if (!ctx.buf)
+    {
+        perror("malloc");
+        exit(EXIT_FAILURE);
+    }
+    lshpack_dec_block_init(&ctx.block);
+
+    /* Verify once, then time without checking */
+    ctx.headers = headers;
+    ctx.n_headers = n_qif_headers;
+    n_decoded = decode_stream(&ctx, &stream);
+    if (n_decoded != n_qif_headers)
+    {
+        fprintf(stderr, "stream has %u headers, QIF has %u\n", n_decoded,
+                                                            n_qif_headers);
+        exit(EXIT_FAILURE);
+    }
+    if (s_verbose)
+        fprintf(stderr, "verified %u headers\n", n_decoded);
+    ctx.headers = NULL;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (n = 0; n < n_iters; ++n)
+        (void) decode_stream(&ctx, &stream);
+    clock_gettime(CLOCK_MONOTONIC, &stop);
+
+    seconds = (stop.tv_sec - start.tv_sec)
+                            + (stop.tv_nsec - start.tv_nsec) / 1000000000.0;
+    printf("decoded %u headers (%zu bytes) %u times in %.6f seconds: "
+        "%.0f headers/s, %.2f ns/header\n",
+        n_decoded, (size_t) (stream.end - stream.begin), n_iters, seconds,
+        n_iters ? (double) n_decoded * n_iters / seconds : 0.0,
+        n_iters ? seconds * 1e9 / ((double) n_decoded * n_iters) : 0.0);
+
+    lshpack_dec_block_cleanup(&ctx.block);
+    free(ctx.buf);
+    free(headers);
+    munmap((void *) qif.begin, qif.end - qif.begin);
+    munmap((void *) stream.begin, stream.end - stream.begin);
+    exit(EXIT_SUCCESS);
+}
@@ -233,6 +233,7 @@ main (int argc, char **argv)
             exit(EXIT_FAILURE);
         }
         (void) lshpack_enc_use_hist(&encoder, use_history);
+        lshpack_enc_set_max_capacity(&encoder, dyn_table_size);
 
         STAILQ_FOREACH(hset, &header_sets, next)
         {
@@ -252,7 +253,6 @@ main (int argc, char **argv)
             }
         }
 
-        lshpack_enc_set_max_capacity(&encoder, dyn_table_size);
         lshpack_enc_cleanup(&encoder);
     }
 
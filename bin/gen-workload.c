@@ -0,0 +1,480 @@
+/*
+ * Generate synthetic, but realistic, HTTP header workload.
+ *
+ * Output is QIF, HPACK stream or both.  The HPACK stream is produced by a
+ * single encoder, like encode-qif does, so it can be fed to decode-qif
+ * along with the QIF.  The same seed always produces the same output.
+ *
+ * The workload is a mix of requests and responses sent over a number of
+ * connections, one connection after another.  Each connection has its own
+ * client and session cookie.  Names of extra headers and their values
+ * follow Zipf distribution; dates and etags change as time goes by; some
+ * values are high-entropy tokens that never repeat.
+ *
+ * QIF Format:
+ * https://github.com/quicwg/base-drafts/wiki/QPACK-Offline-Interop
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "lshpack.h"
+
+#define TABLE_SIZE 4096
+
+static void
+usage (const char *name)
+{
+    fprintf(stderr,
+"Usage: %s [options]\n"
+"\n"
+"Options:\n"
+"   -q FILE     Write QIF to FILE.  `-' means stdout.\n"
+"   -o FILE     Write HPACK stream to FILE.  `-' means stdout.\n"
+"                 If neither is given, QIF is written to stdout.\n"
+"   -s NUMBER   Seed.  Defaults to 1.\n"
+"   -n NUMBER   Number of header sets.  Defaults to 1000.\n"
+"   -c NUMBER   Number of connections.  Defaults to 10.\n"
+"   -r PERCENT  Share of requests; the rest are responses.  Defaults to 50.\n"
+"   -z NUMBER   Zipf exponent.  Defaults to 1.0.\n"
+"   -N NUMBER   Number of distinct extra header names.  Defaults to 50.\n"
+"   -V NUMBER   Number of distinct values per extra header.  Defaults\n"
+"                 to 100.\n"
+"   -x NUMBER   Maximum number of extra headers per set.  Defaults to 6.\n"
+"   -t NUMBER   Dynamic table size used for HPACK output.  Defaults to %u.\n"
+"\n"
+"   -h          Print this help screen and exit\n"
+    , name, TABLE_SIZE);
+}
+
+
+/* xorshift64* */
+static uint64_t s_rand;
+
+static uint64_t
+rand64 (void)
+{
+    s_rand ^= s_rand >> 12;
+    s_rand ^= s_rand << 25;
+    s_rand ^= s_rand >> 27;
+    return s_rand * 0x2545F4914F6CDD1DULL;
+}
+
+
+static unsigned
+rand_below (unsigned n)
+{
+    return (unsigned) ((rand64() >> 32) % n);
+}
+
+
+/* Mix bits of `x' to derive stable strings from numbers */
+static uint64_t
+mix64 (uint64_t x)
+{
+    x ^= x >> 33;
+    x *= 0xFF51AFD7ED558CCDULL;
+    x ^= x >> 33;
+    x *= 0xC4CEB9FE1A85EC53ULL;
+    x ^= x >> 33;
+    return x;
+}
+
+
+struct zipf
+{
+    double     *cdf;
+    unsigned    n;
+};
+
+
+static void
+zipf_init (struct zipf *zipf, unsigned n, double s)
+{
+    double sum;
+    unsigned k;
+
+    zipf->n = n;
+    zipf->cdf = malloc(sizeof(zipf->cdf[0]) * n);
+    if (!zipf->cdf)
+    {
+        perror("malloc");
+        exit(EXIT_FAILURE);
+    }
+    sum = 0;
+    for (k = 0; k < n; ++k)
+    {
+        sum += 1.0 / pow(k + 1, s);
+        zipf->cdf[k] = sum;
+    }
+    for (k = 0; k < n; ++k)
+        zipf->cdf[k] /= sum;
+}
+
+
+/* Return rank from 0 to n - 1; 0 is the most popular */
+static unsigned
+zipf_next (const struct zipf *zipf)
+{
+    double u;
+    unsigned lo, hi, mid;
+
+    u = (double) (rand64() >> 11) / (double) (1ULL << 53);
+    lo = 0;
+    hi = zipf->n - 1;
+    while (lo < hi)
+    {
+        mid = lo + (hi - lo) / 2;
+        if (zipf->cdf[mid] < u)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+
+static const char ALNUM[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789";
+static const char HEX[] = "0123456789abcdef";
+
+/* Random token: a new one each time */
+static char *
+token (char *buf, unsigned len, const char *alphabet)
+{
+    unsigned i, n = strlen(alphabet);
+
+    for (i = 0; i < len; ++i)
+        buf[i] = alphabet[ rand_below(n) ];
+    buf[len] = '\0';
+    return buf;
+}
+
+
+/* Word-like string derived from `key': the same key, the same word */
+static char *
+word (char *buf, uint64_t key, unsigned min_len, unsigned max_len)
+{
+    static const char letters[] = "etaoinshrdlucmfwypvbgkqjxz";
+    unsigned i, len;
+    uint64_t x;
+
+    x = mix64(key);
+    len = min_len + x % (max_len - min_len + 1);
+    for (i = 0; i < len; ++i)
+    {
+        x = mix64(x + i);
+        /* Favor frequent letters, like text does */
+        buf[i] = letters[ (x % 26) * (x / 26 % 26) / 26 ];
+    }
+    buf[len] = '\0';
+    return buf;
+}
+
+
+struct gen
+{
+    FILE                *qif;
+    FILE                *hpack;
+    struct lshpack_enc   enc;
+    unsigned             n_headers;
+    struct zipf          names, values, hosts, paths, statuses, types;
+    unsigned             max_extra;
+    /* Current connection */
+    char                 user_agent[0x80];
+    char                 session[0x40];
+    int                  session_sent;
+};
+
+
+static void
+emit (struct gen *gen, const char *name, const char *val)
+{
+    struct lsxpack_header xhdr;
+    unsigned char enc_buf[0x4000], *end;
+    char buf[0x4000];
+    size_t name_len, val_len;
+
+    name_len = strlen(name);
+    val_len = strlen(val);
+    if (gen->qif)
+        fprintf(gen->qif, "%s\t%s\n", name, val);
+    if (gen->hpack)
+    {
+        if (name_len + val_len > sizeof(buf))
+        {
+            fprintf(stderr, "header too long\n");
+            exit(EXIT_FAILURE);
+        }
+        memcpy(buf, name, name_len);
+        memcpy(buf + name_len, val, val_len);
+        lsxpack_header_set_offset2(&xhdr, buf, 0, name_len, name_len,
+                                                                    val_len);
+        end = lshpack_enc_encode(&gen->enc, enc_buf,
+                                            enc_buf + sizeof(enc_buf), &xhdr);
+        if (end <= enc_buf)
+        {
+            fprintf(stderr, "cannot encode header %u\n", gen->n_headers);
+            exit(EXIT_FAILURE);
+        }
+        (void) fwrite(enc_buf, 1, end - enc_buf, gen->hpack);
+    }
+    ++gen->n_headers;
+}
+
+
+/* Extra headers with Zipf-distributed names and values */
+static void
+emit_extra (struct gen *gen, unsigned is_request)
+{
+    char name[0xA0], val[0x80];
+    unsigned n, n_extra, name_rank, val_rank;
+
+    n_extra = rand_below(gen->max_extra + 1);
+    for (n = 0; n < n_extra; ++n)
+    {
+        name_rank = zipf_next(&gen->names);
+        val_rank = zipf_next(&gen->values);
+        snprintf(name, sizeof(name), "x-%s-%u",
+                    word(val, name_rank * 2 + is_request, 3, 10), name_rank);
+        word(val, ((uint64_t) name_rank << 32) | val_rank, 2, 40);
+        emit(gen, name, val);
+    }
+}
+
+
+static void
+gen_request (struct gen *gen, unsigned set)
+{
+    static const char *const accepts[] = {
+        "*/*", "text/html,application/xhtml+xml,application/xml;q=0.9,"
+        "*/*;q=0.8", "application/json", "image/avif,image/webp,*/*",
+    };
+    char buf[0x100], word_buf[0x40], tok[0x40];
+    unsigned path;
+
+    emit(gen, ":method", rand_below(10) ? "GET" : "POST");
+    emit(gen, ":scheme", "https");
+    snprintf(buf, sizeof(buf), "%s.example.com",
+                        word(word_buf, zipf_next(&gen->hosts), 3, 12));
+    emit(gen, ":authority", buf);
+    path = zipf_next(&gen->paths);
+    snprintf(buf, sizeof(buf), "/%s/%u", word(word_buf, path, 4, 30), path);
+    emit(gen, ":path", buf);
+    emit(gen, "user-agent", gen->user_agent);
+    emit(gen, "accept", accepts[ rand_below(sizeof(accepts)
+                                                / sizeof(accepts[0])) ]);
+    emit(gen, "accept-encoding", "gzip, deflate, br");
+    if (gen->session_sent)
+    {
+        snprintf(buf, sizeof(buf), "session=%s; lang=en", gen->session);
+        emit(gen, "cookie", buf);
+    }
+    if (rand_below(8) == 0)
+    {
+        snprintf(buf, sizeof(buf), "Bearer %s", token(tok, 40, ALNUM));
+        emit(gen, "authorization", buf);
+    }
+    emit_extra(gen, 1);
+    if (rand_below(4) == 0)
+        emit(gen, "x-request-id", token(tok, 32, HEX));
+}
+
+
+static void
+gen_response (struct gen *gen, unsigned set)
+{
+    static const char *const statuses[] = {
+        "200", "304", "404", "204", "302", "301", "500", "403", "206", "503",
+    };
+    static const char *const types[] = {
+        "text/html; charset=utf-8", "application/json", "image/png",
+        "application/javascript", "text/css", "image/jpeg", "font/woff2",
+        "application/octet-stream",
+    };
+    static const char *const days[] = {
+        "Mon", "Tue", "Wed", "Thu", "Fri", "Sat", "Sun",
+    };
+    char buf[0x100];
+    unsigned secs, path;
+
+    emit(gen, ":status", statuses[ zipf_next(&gen->statuses) ]);
+    emit(gen, "server", "LiteSpeed");
+    /* Four responses a second */
+    secs = set / 4;
+    snprintf(buf, sizeof(buf), "%s, %02u Oct 2021 %02u:%02u:%02u GMT",
+        days[ (secs / 86400) % 7 ], 1 + (secs / 86400) % 28,
+        (secs / 3600) % 24, (secs / 60) % 60, secs % 60);
+    emit(gen, "date", buf);
+    emit(gen, "content-type", types[ zipf_next(&gen->types) ]);
+    snprintf(buf, sizeof(buf), "%u", rand_below(1 << (4 + rand_below(16))));
+    emit(gen, "content-length", buf);
+    /* Resources change every now and then, and so do their etags */
+    path = zipf_next(&gen->paths);
+    snprintf(buf, sizeof(buf), "\"%016" PRIx64 "\"",
+                    mix64(((uint64_t) path << 32) | (set / 500 + path % 7)));
+    emit(gen, "etag", buf);
+    emit(gen, "cache-control", path < 20 ? "public, max-age=31536000"
+                                                    : "private, no-cache");
+    if (!gen->session_sent)
+    {
+        snprintf(buf, sizeof(buf), "session=%s; Path=/; Secure; HttpOnly",
+                                                                gen->session);
+        emit(gen, "set-cookie", buf);
+        gen->session_sent = 1;
+    }
+    emit_extra(gen, 0);
+}
+
+
+static void
+new_connection (struct gen *gen)
+{
+    static const char *const browsers[] = { "Chrome", "Firefox", "Safari",
+                                                                    "Edge", };
+    static const char *const systems[] = { "Windows NT 10.0; Win64; x64",
+        "Macintosh; Intel Mac OS X 10_15_7", "X11; Linux x86_64",
+        "iPhone; CPU iPhone OS 17_1 like Mac OS X", "Linux; Android 14", };
+
+    snprintf(gen->user_agent, sizeof(gen->user_agent),
+        "Mozilla/5.0 (%s) %s/%u.0",
+        systems[ rand_below(sizeof(systems) / sizeof(systems[0])) ],
+        browsers[ rand_below(sizeof(browsers) / sizeof(browsers[0])) ],
+        90 + rand_below(30));
+    token(gen->session, 32, HEX);
+    gen->session_sent = 0;
+}
+
+
+static FILE *
+open_output (const char *path)
+{
+    FILE *file;
+
+    if (0 == strcmp(path, "-"))
+        return stdout;
+    file = fopen(path, "wb");
+    if (!file)
+    {
+        fprintf(stderr, "cannot open `%s' for writing: %s\n", path,
+                                                            strerror(errno));
+        exit(EXIT_FAILURE);
+    }
+    return file;
+}
+
+
+int
+main (int argc, char **argv)
+{
+    int opt;
+    unsigned seed = 1, n_sets = 1000, n_conns = 10, req_pct = 50;
+    unsigned n_names = 50, n_values = 100, table_size = TABLE_SIZE, set;
+    double zipf_s = 1.0;
+    struct gen gen;
+
+    memset(&gen, 0, sizeof(gen));
+    gen.max_extra = 6;
+
+    while (-1 != (opt = getopt(argc, argv, "q:o:s:n:c:r:z:N:V:x:t:h")))
+    {
+        switch (opt)
+        {
+        case 'q':
+            gen.qif = open_output(optarg);
+            break;
+        case 'o':
+            gen.hpack = open_output(optarg);
+            break;
+        case 's':
+            seed = atoi(optarg);
+            break;
+        case 'n':
+            n_sets = atoi(optarg);
+            break;
+        case 'c':
+            n_conns = atoi(optarg);
+            break;
+        case 'r':
+            req_pct = atoi(optarg);
+            break;
+        case 'z':
+            zipf_s = atof(optarg);
+            break;
+        case 'N':
+            n_names = atoi(optarg);
+            break;
+        case 'V':
+            n_values = atoi(optarg);
+            break;
+        case 'x':
+            gen.max_extra = atoi(optarg);
+            break;
+        case 't':
+            table_size = atoi(optarg);
+            break;
+        case 'h':
+            usage(argv[0]);
+            exit(EXIT_SUCCESS);
+        default:
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    if (!gen.qif && !gen.hpack)
+        gen.qif = stdout;
+    if (n_conns == 0 || n_names == 0 || n_values == 0 || req_pct > 100)
+    {
+        fprintf(stderr, "invalid arguments\n");
+        exit(EXIT_FAILURE);
+    }
+    if (gen.hpack)
+    {
+        if (0 != lshpack_enc_init(&gen.enc))
+        {
+            perror("lshpack_enc_init");
+            exit(EXIT_FAILURE);
+        }
+        (void) lshpack_enc_use_hist(&gen.enc, 1);
+        lshpack_enc_set_max_capacity(&gen.enc, table_size);
+    }
+
+    s_rand = 0x9E3779B97F4A7C15ULL * (seed + 1);
+    zipf_init(&gen.names, n_names, zipf_s);
+    zipf_init(&gen.values, n_values, zipf_s);
+    zipf_init(&gen.hosts, 20, zipf_s);
+    zipf_init(&gen.paths, 5000, zipf_s);
+    zipf_init(&gen.statuses, 10, 2.0);
+    zipf_init(&gen.types, 8, zipf_s);
+
+    for (set = 0; set < n_sets; ++set)
+    {
+        if (set % ((n_sets + n_conns - 1) / n_conns) == 0)
+            new_connection(&gen);
+        if (set > 0 && gen.qif)
+            fputc('\n', gen.qif);
+        if (rand_below(100) < req_pct)
+            gen_request(&gen, set);
+        else
+            gen_response(&gen, set);
+    }
+
+    if (gen.hpack)
+        lshpack_enc_cleanup(&gen.enc);
+    if (gen.qif && gen.qif != stdout)
+        fclose(gen.qif);
+    if (gen.hpack && gen.hpack != stdout)
+        fclose(gen.hpack);
+    free(gen.names.cdf);
+    free(gen.values.cdf);
+    free(gen.hosts.cdf);
+    free(gen.paths.cdf);
+    free(gen.statuses.cdf);
+    free(gen.types.cdf);
+    exit(EXIT_SUCCESS);
+}
@@ -0,0 +1,621 @@
+/*
+ * Encode QIF using HPACK and report where the bytes go.  Use for tuning
+ * dynamic table size and indexing policies.
+ *
+ * How it works: each header is encoded separately and the representation
+ * the encoder chose is parsed back: indexed or literal, static or dynamic
+ * table, Huffman or not.  A copy of the dynamic table is kept alongside
+ * the encoder's, so that we know which entries are used before they are
+ * evicted and which are evicted without ever being used.  The encoder
+ * indexes every header unless the history heuristic decides otherwise,
+ * so a literal that is not indexed is a history decision.
+ *
+ * Statistics are gathered per header name and printed as a table, along
+ * with the totals.
+ *
+ * QIF Format:
+ * https://github.com/quicwg/base-drafts/wiki/QPACK-Offline-Interop
+ */
+
+#define _GNU_SOURCE /* for memmem */
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+
+#include "lshpack.h"
+#include XXH_HEADER_NAME
+
+#define TABLE_SIZE 4096
+#define STATIC_TABLE_SIZE 61
+#define DYNAMIC_ENTRY_OVERHEAD 32
+
+static void
+usage (const char *name)
+{
+    fprintf(stderr,
+"Usage: %s [options] -i QIF\n"
+"\n"
+"Options:\n"
+"   -i FILE     QIF file to analyze.\n"
+"   -t NUMBER   Dynamic table size.  Defaults to %u.\n"
+"   -H          Do not use the history heuristic.\n"
+"   -s KEY      Sort names by KEY: `bytes' (encoded bytes, the default),\n"
+"                 `count', `saved' (bytes saved by compression) or\n"
+"                 `wasted' (entries evicted before use).\n"
+"   -N NUMBER   Print at most this many names.  Zero means all.  Defaults\n"
+"                 to 50.\n"
+"\n"
+"   -h          Print this help screen and exit\n"
+    , name, TABLE_SIZE);
+}
+
+
+struct name_stats
+{
+    const char     *name;           /* Points into the QIF */
+    unsigned        name_len;
+    uint32_t        hash;
+    /* Number of headers */
+    unsigned        count;
+    /* Bytes in and out */
+    uint64_t        raw_bytes;      /* Name and value lengths */
+    uint64_t        enc_bytes;      /* HPACK representation */
+    uint64_t        huff_saved;     /* Bytes saved by Huffman coding */
+    /* Representations */
+    unsigned        static_full;    /* Indexed, static table */
+    unsigned        dyn_full;       /* Indexed, dynamic table */
+    unsigned        static_name;    /* Literal, name from static table */
+    unsigned        dyn_name;       /* Literal, name from dynamic table */
+    unsigned        lit_name;       /* Literal, literal name */
+    /* Dynamic table entries of headers with this name */
+    unsigned        added;          /* Literal with incremental indexing */
+    unsigned        hist_declined;  /* Not indexed because of history */
+    unsigned        reused;         /* Referred to before eviction */
+    unsigned        wasted;         /* Evicted without being referred to */
+};
+
+
+/* Copy of the encoder's dynamic table.  Only the sizes and the use of
+ * the entries are tracked.
+ */
+struct dyn_entry
+{
+    struct name_stats  *stats;
+    unsigned            size;
+    unsigned            refs;
+};
+
+
+struct dyn_table
+{
+    struct dyn_entry   *entries;    /* Ring buffer */
+    unsigned            n_alloc;    /* Power of two */
+    unsigned            head;       /* Oldest entry */
+    unsigned            count;
+    unsigned            size;
+    unsigned            capacity;
+};
+
+
+struct analyzer
+{
+    struct name_stats **names;      /* Open addressing */
+    unsigned            n_names;
+    unsigned            n_buckets;  /* Power of two */
+    struct dyn_table    table;
+    unsigned            n_sets;
+};
+
+
+struct file
+{
+    const unsigned char *begin;
+    const unsigned char *end;
+};
+
+
+static void
+map_file (struct file *file, const char *path)
+{
+    struct stat st;
+    int fd;
+
+    fd = open(path, O_RDONLY);
+    if (fd < 0)
+    {
+        fprintf(stderr, "cannot open `%s': %s\n", path, strerror(errno));
+        exit(EXIT_FAILURE);
+    }
+    if (0 != fstat(fd, &st))
+    {
+        perror("fstat");
+        exit(EXIT_FAILURE);
+    }
+    file->begin = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (file->begin == MAP_FAILED)
+    {
+        perror("mmap");
+        exit(EXIT_FAILURE);
+    }
+    file->end = file->begin + st.st_size;
+    close(fd);
+}
+
+
+static void *
+xmalloc (size_t size)
+{
+    void *p;
+
+    p = calloc(1, size);
+    if (!p)
+    {
+        perror("calloc");
+        exit(EXIT_FAILURE);
+    }
+    return p;
+}
+
+
+static struct name_stats *
+get_name_stats (struct analyzer *an, const char *name, unsigned name_len)
+{
+    struct name_stats **old_names, *stats;
+    unsigned n, old_n_buckets;
+    uint32_t hash;
+
+    hash = XXH32(name, name_len, 0);
+    for (n = hash & (an->n_buckets - 1); an->names[n];
+                                            n = (n + 1) & (an->n_buckets - 1))
+        if (an->names[n]->hash == hash && an->names[n]->name_len == name_len
+                && 0 == memcmp(an->names[n]->name, name, name_len))
+            return an->names[n];
+
+    stats = xmalloc(sizeof(*stats));
+    stats->name = name;
+    stats->name_len = name_len;
+    stats->hash = hash;
+    an->names[n] = stats;
+
+    if (++an->n_names * 2 > an->n_buckets)
+    {
+        old_names = an->names;
+        old_n_buckets = an->n_buckets;
+        an->n_buckets *= 2;
+        an->names = xmalloc(sizeof(an->names[0]) * an->n_buckets);
+        for (n = 0; n < old_n_buckets; ++n)
+            if (old_names[n])
+            {
+                hash = old_names[n]->hash & (an->n_buckets - 1);
+                while (an->names[hash])
+                    hash = (hash + 1) & (an->n_buckets - 1);
+                an->names[hash] = old_names[n];
+            }
+        free(old_names);
+    }
+
+    return stats;
+}
+
+
+static void
+dyn_evict_oldest (struct dyn_table *table)
+{
+    struct dyn_entry *entry;
+
+    entry = &table->entries[ table->head ];
+    if (entry->refs == 0)
+        ++entry->stats->wasted;
+    table->size -= entry->size;
+    table->head = (table->head + 1) & (table->n_alloc - 1);
+    --table->count;
+}
+
+
+/* Same as the encoder: evict until the new entry fits; an entry larger
+ * than the table empties it and is not added.
+ */
+static void
+dyn_add (struct dyn_table *table, struct name_stats *stats, unsigned size)
+{
+    struct dyn_entry *entries;
+    unsigned n;
+
+    ++stats->added;
+    while (table->count > 0 && table->size + size > table->capacity)
+        dyn_evict_oldest(table);
+    if (size > table->capacity)
+    {
+        ++stats->wasted;
+        return;
+    }
+
+    if (table->count == table->n_alloc)
+    {
+        entries = xmalloc(sizeof(entries[0]) * table->n_alloc * 2);
+        for (n = 0; n < table->count; ++n)
+            entries[n] = table->entries[ (table->head + n)
+                                                    & (table->n_alloc - 1) ];
+        free(table->entries);
+        table->entries = entries;
+        table->head = 0;
+        table->n_alloc *= 2;
+    }
+    table->entries[ (table->head + table->count) & (table->n_alloc - 1) ]
+        = (struct dyn_entry) { .stats = stats, .size = size, .refs = 0, };
+    ++table->count;
+    table->size += size;
+}
+
+
+/* HPACK index 62 is the newest entry */
+static struct dyn_entry *
+dyn_get (struct dyn_table *table, uint32_t id)
+{
+    id -= STATIC_TABLE_SIZE + 1;
+    if (id >= table->count)
+    {
+        fprintf(stderr, "dynamic table copy is out of sync\n");
+        exit(EXIT_FAILURE);
+    }
+    return &table->entries[ (table->head + table->count - 1 - id)
+                                                    & (table->n_alloc - 1) ];
+}
+
+
+static const unsigned char *
+dec_int (const unsigned char *p, unsigned prefix_bits, uint32_t *value)
+{
+    uint32_t prefix_max = (1u << prefix_bits) - 1;
+    unsigned shift;
+
+    *value = *p++ & prefix_max;
+    if (*value < prefix_max)
+        return p;
+    shift = 0;
+    do
+    {
+        *value += (uint32_t) (*p & 0x7F) << shift;
+        shift += 7;
+    }
+    while (*p++ & 0x80);
+    return p;
+}
+
+
+/* Parse string literal; return pointer past it */
+static const unsigned char *
+account_str (struct name_stats *stats, const unsigned char *p,
+                                                            unsigned raw_len)
+{
+    uint32_t len;
+    int is_huffman;
+
+    is_huffman = *p & 0x80;
+    p = dec_int(p, 7, &len);
+    if (is_huffman)
+        stats->huff_saved += raw_len - len;
+    return p + len;
+}
+
+
+static void
+account (struct analyzer *an, struct name_stats *stats,
+        const struct lsxpack_header *xhdr, const unsigned char *out,
+        const unsigned char *out_end)
+{
+    struct dyn_entry *entry;
+    const unsigned char *p;
+    uint32_t id;
+
+    ++stats->count;
+    stats->raw_bytes += xhdr->name_len + xhdr->val_len;
+    stats->enc_bytes += out_end - out;
+
+    if (out[0] & 0x80)
+    {
+        (void) dec_int(out, 7, &id);
+        if (id <= STATIC_TABLE_SIZE)
+            ++stats->static_full;
+        else
+        {
+            ++stats->dyn_full;
+            entry = dyn_get(&an->table, id);
+            if (entry->refs++ == 0)
+                ++entry->stats->reused;
+        }
+        return;
+    }
+
+    p = dec_int(out, out[0] & 0x40 ? 6 : 4, &id);
+    if (id == 0)
+    {
+        ++stats->lit_name;
+        p = account_str(stats, p, xhdr->name_len);
+    }
+    else if (id <= STATIC_TABLE_SIZE)
+        ++stats->static_name;
+    else
+    {
+        ++stats->dyn_name;
+        entry = dyn_get(&an->table, id);
+        if (entry->refs++ == 0)
+            ++entry->stats->reused;
+    }
+    p = account_str(stats, p, xhdr->val_len);
+    if (p != out_end)
+    {
+        fprintf(stderr, "cannot parse encoder output\n");
+        exit(EXIT_FAILURE);
+    }
+
+    if (out[0] & 0x40)
+        dyn_add(&an->table, stats, xhdr->name_len + xhdr->val_len
+                                                    + DYNAMIC_ENTRY_OVERHEAD);
+    else if (!(xhdr->flags & LSXPACK_NEVER_INDEX))
+        ++stats->hist_declined;
+}
+
+
+static void
+analyze (struct analyzer *an, struct lshpack_enc *enc,
+                                                    const struct file *qif)
+{
+    const unsigned char *p, *tab, *nl, *nlnl;
+    struct lsxpack_header xhdr;
+    unsigned char out[0x10000], *out_end;
+    char buf[0x10000];
+    size_t name_len, val_len;
+
+    p = qif->begin;
+    while (p + 2 < qif->end)
+    {
+        nlnl = memmem(p, qif->end - p, "\n\n", 2);
+        if (!nlnl)
+            nlnl = qif->end;
+        ++an->n_sets;
+        while (p < nlnl)
+        {
+            tab = memmem(p, nlnl - p, "\t", 1);
+            if (!tab)
+            {
+                fprintf(stderr, "tab not found, off: %u\n",
+                                                (unsigned) (p - qif->begin));
+                exit(EXIT_FAILURE);
+            }
+            nl = memmem(tab + 1, nlnl - tab - 1, "\n", 1);
+            if (!nl)
+                nl = nlnl;
+            name_len = tab - p;
+            val_len = nl - tab - 1;
+            if (name_len + val_len > sizeof(buf))
+            {
+                fprintf(stderr, "header too long, off: %u\n",
+                                                (unsigned) (p - qif->begin));
+                exit(EXIT_FAILURE);
+            }
+            memcpy(buf, p, name_len);
+            memcpy(buf + name_len, tab + 1, val_len);
+            lsxpack_header_set_offset2(&xhdr, buf, 0, name_len, name_len,
+                                                                    val_len);
+            out[0] = 0;
+            out_end = lshpack_enc_encode(enc, out, out + sizeof(out), &xhdr);
+            if (out_end <= out)
+            {
+                fprintf(stderr, "cannot encode header, off: %u\n",
+                                                (unsigned) (p - qif->begin));
+                exit(EXIT_FAILURE);
+            }
+            account(an, get_name_stats(an, (const char *) p, name_len),
+                                                        &xhdr, out, out_end);
+            p = nl + 1;
+        }
+        p = nlnl + 2;
+    }
+}
+
+
+enum sort_key { SORT_BYTES, SORT_COUNT, SORT_SAVED, SORT_WASTED, };
+static enum sort_key s_sort_key;
+
+
+static uint64_t
+sort_value (const struct name_stats *stats)
+{
+    switch (s_sort_key)
+    {
+    case SORT_COUNT:
+        return stats->count;
+    case SORT_SAVED:
+        return stats->raw_bytes - stats->enc_bytes;
+    case SORT_WASTED:
+        return stats->wasted;
+    default:
+        return stats->enc_bytes;
+    }
+}
+
+
+static int
+compare_stats (const void *ap, const void *bp)
+{
+    const struct name_stats *a = *(const struct name_stats **) ap;
+    const struct name_stats *b = *(const struct name_stats **) bp;
+    uint64_t av = sort_value(a), bv = sort_value(b);
+
+    if (av != bv)
+        return av < bv ? 1 : -1;
+    if (a->name_len != b->name_len)
+        return a->name_len < b->name_len ? -1 : 1;
+    return memcmp(a->name, b->name, a->name_len);
+}
+
+
+static double
+pct (uint64_t part, uint64_t whole)
+{
+    return whole ? 100.0 * part / whole : 0.0;
+}
+
+
+static void
+print_row (const struct name_stats *s, uint64_t total_enc)
+{
+    fprintf(stdout, "%-28.*s %8u %10" PRIu64 " %10" PRIu64 " %6.1f %6.1f "
+        "%6.1f %6.1f %6.1f %6.1f %9" PRIu64 " %7u %7u %7u %7u\n",
+        s->name_len > 28 ? 28 : (int) s->name_len, s->name, s->count,
+        s->raw_bytes, s->enc_bytes, pct(s->enc_bytes, total_enc),
+        pct(s->static_full, s->count), pct(s->dyn_full, s->count),
+        pct(s->static_name, s->count), pct(s->dyn_name, s->count),
+        pct(s->lit_name, s->count), s->huff_saved, s->added,
+        s->hist_declined, s->reused, s->wasted);
+}
+
+
+static void
+report (struct analyzer *an, unsigned max_rows)
+{
+    struct name_stats **sorted, total;
+    unsigned n, i;
+
+    sorted = xmalloc(sizeof(sorted[0]) * (an->n_names + 1));
+    memset(&total, 0, sizeof(total));
+    total.name = "TOTAL";
+    total.name_len = 5;
+    for (n = 0, i = 0; n < an->n_buckets; ++n)
+        if (an->names[n])
+        {
+            sorted[i++] = an->names[n];
+            total.count += an->names[n]->count;
+            total.raw_bytes += an->names[n]->raw_bytes;
+            total.enc_bytes += an->names[n]->enc_bytes;
+            total.huff_saved += an->names[n]->huff_saved;
+            total.static_full += an->names[n]->static_full;
+            total.dyn_full += an->names[n]->dyn_full;
+            total.static_name += an->names[n]->static_name;
+            total.dyn_name += an->names[n]->dyn_name;
+            total.lit_name += an->names[n]->lit_name;
+            total.added += an->names[n]->added;
+            total.hist_declined += an->names[n]->hist_declined;
+            total.reused += an->names[n]->reused;
+            total.wasted += an->names[n]->wasted;
+        }
+    qsort(sorted, an->n_names, sizeof(sorted[0]), compare_stats);
+
+    fprintf(stdout,
+        "%u header sets, %u headers, %u names; %" PRIu64 " bytes in, "
+        "%" PRIu64 " bytes out (%.1f%%); Huffman saved %" PRIu64 " bytes\n"
+        "dynamic table: %u of %u bytes used by %u entries at the end; "
+        "%.1f%% of added entries used before eviction\n\n",
+        an->n_sets, total.count, an->n_names, total.raw_bytes,
+        total.enc_bytes, pct(total.enc_bytes, total.raw_bytes),
+        total.huff_saved, an->table.size, an->table.capacity,
+        an->table.count, pct(total.reused, total.added));
+    fprintf(stdout,
+        "%-28s %8s %10s %10s %6s %6s %6s %6s %6s %6s %9s %7s %7s %7s %7s\n",
+        "name", "count", "raw", "encoded", "enc%", "stat%", "dyn%",
+        "sname%", "dname%", "lname%", "huff-sav", "added", "h-decl",
+        "reused", "wasted");
+    for (n = 0; n < an->n_names && (max_rows == 0 || n < max_rows); ++n)
+        print_row(sorted[n], total.enc_bytes);
+    print_row(&total, total.enc_bytes);
+
+    free(sorted);
+}
+
+
+int
+main (int argc, char **argv)
+{
+    int opt, use_hist = 1;
+    unsigned n, max_rows = 50;
+    const char *qif_path = NULL;
+    struct analyzer an;
+    struct lshpack_enc enc;
+    struct file qif;
+
+    memset(&an, 0, sizeof(an));
+    an.table.capacity = TABLE_SIZE;
+
+    while (-1 != (opt = getopt(argc, argv, "i:t:Hs:N:h")))
+    {
+        switch (opt)
+        {
+        case 'i':
+            qif_path = optarg;
+            break;
+        case 't':
+            an.table.capacity = atoi(optarg);
+            break;
+        case 'H':
+            use_hist = 0;
+            break;
+        case 's':
+            if (0 == strcmp(optarg, "bytes"))
+                s_sort_key = SORT_BYTES;
+            else if (0 == strcmp(optarg, "count"))
+                s_sort_key = SORT_COUNT;
+            else if (0 == strcmp(optarg, "saved"))
+                s_sort_key = SORT_SAVED;
+            else if (0 == strcmp(optarg, "wasted"))
+                s_sort_key = SORT_WASTED;
+            else
+            {
+                fprintf(stderr, "unknown sort key `%s'\n", optarg);
+                exit(EXIT_FAILURE);
+            }
+            break;
+        case 'N':
+            max_rows = atoi(optarg);
+            break;
+        case 'h':
+            usage(argv[0]);
+            exit(EXIT_SUCCESS);
+        default:
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    if (!qif_path)
+    {
+        fprintf(stderr, "Please specify QIF file using -i flag\n");
+        exit(EXIT_FAILURE);
+    }
+
+    map_file(&qif, qif_path);
+    if (0 != lshpack_enc_init(&enc))
+    {
+        perror("lshpack_enc_init");
+        exit(EXIT_FAILURE);
+    }
+    if (use_hist && 0 != lshpack_enc_use_hist(&enc, 1))
+    {
+        perror("lshpack_enc_use_hist");
+        exit(EXIT_FAILURE);
+    }
+    lshpack_enc_set_max_capacity(&enc, an.table.capacity);
+
+    an.n_buckets = 64;
+    an.names = xmalloc(sizeof(an.names[0]) * an.n_buckets);
+    an.table.n_alloc = 64;
+    an.table.entries = xmalloc(sizeof(an.table.entries[0])
+                                                        * an.table.n_alloc);
+
+    analyze(&an, &enc, &qif);
+    report(&an, max_rows);
+
+    lshpack_enc_cleanup(&enc);
+    for (n = 0; n < an.n_buckets; ++n)
+        free(an.names[n]);
+    free(an.names);
+    free(an.table.entries);
+    munmap((void *) qif.begin, qif.end - qif.begin);
+    exit(EXIT_SUCCESS);
+}
@@ -0,0 +1,469 @@
+/*
+ * Replay QIF through HPACK encoder and decoder at many dynamic table sizes
+ * and with history on and off, and print compressed size against memory
+ * used.  Use to pick SETTINGS_HEADER_TABLE_SIZE for a kind of traffic.
+ *
+ * How it works: QIF is read in once and shared by a number of threads.
+ * Each configuration -- table size and history setting -- gets its own
+ * encoder and decoder; threads take configurations off a common list
+ * until it is empty.  Each header set is encoded as a header block, which
+ * is then decoded and checked against the input.  Peak memory of encoder
+ * and decoder, as reported by lshpack_enc_mem_used() and
+ * lshpack_dec_mem_used(), is sampled after each header block.
+ *
+ * QIF Format:
+ * https://github.com/quicwg/base-drafts/wiki/QPACK-Offline-Interop
+ */
+
+#define _GNU_SOURCE /* for memmem */
+#include <errno.h>
+#include <inttypes.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+
+#include "lshpack.h"
+
+static const unsigned s_default_sizes[] = {
+    0, 256, 512, 1024, 2048, 4096, 8192, 16384, 32768, 65536,
+};
+
+static void
+usage (const char *name)
+{
+    fprintf(stderr,
+"Usage: %s [options] -i QIF\n"
+"\n"
+"Options:\n"
+"   -i FILE     QIF file to replay.\n"
+"   -t LIST     Comma-separated list of dynamic table sizes.  Defaults to\n"
+"                 0,256,512,1024,...,65536.\n"
+"   -p POLICY   History heuristic: `on', `off' or `both' (the default).\n"
+"   -j NUMBER   Number of threads.  Defaults to the number of CPUs.\n"
+"   -C          Print CSV instead of a table.\n"
+"\n"
+"   -h          Print this help screen and exit\n"
+    , name);
+}
+
+
+struct header
+{
+    const char    *buf;         /* Name followed by value */
+    unsigned       name_len;
+    unsigned       val_len;
+};
+
+
+struct header_set
+{
+    unsigned       first;       /* Index into the header array */
+    unsigned       count;
+};
+
+
+struct trace
+{
+    struct header      *headers;
+    unsigned            n_headers;
+    struct header_set  *sets;
+    unsigned            n_sets;
+    uint64_t            n_bytes;    /* Sum of name and value lengths */
+    char               *arena;
+};
+
+
+struct config
+{
+    unsigned        table_size;
+    int             history;
+    /* Results: */
+    uint64_t        enc_bytes;
+    size_t          enc_mem;    /* Peak */
+    size_t          dec_mem;    /* Peak */
+};
+
+
+struct sim
+{
+    const struct trace *trace;
+    struct config      *configs;
+    unsigned            n_configs;
+    unsigned            next_config;
+    pthread_mutex_t     lock;
+};
+
+
+static int
+compare_unsigned (const void *ap, const void *bp)
+{
+    unsigned a = *(const unsigned *) ap, b = *(const unsigned *) bp;
+    return (a > b) - (a < b);
+}
+
+
+static void
+die (const char *msg)
+{
+    fprintf(stderr, "%s\n", msg);
+    exit(EXIT_FAILURE);
+}
+
+
+static void *
+xrealloc (void *p, size_t size)
+{
+    p = realloc(p, size);
+    if (!p)
+    {
+        perror("realloc");
+        exit(EXIT_FAILURE);
+    }
+    return p;
+}
+
+
+/* Read in QIF and copy each header, name followed by value, into one
+ * arena, as the encoder wants them.
+ */
+static void
+read_trace (struct trace *trace, const char *path)
+{
+    const unsigned char *qif, *qif_end, *p, *tab, *nl, *nlnl;
+    struct stat st;
+    size_t off;
+    unsigned n_alloc = 0, n_sets_alloc = 0, n;
+    int fd;
+
+    fd = open(path, O_RDONLY);
+    if (fd < 0)
+    {
+        fprintf(stderr, "cannot open `%s': %s\n", path, strerror(errno));
+        exit(EXIT_FAILURE);
+    }
+    if (0 != fstat(fd, &st))
+    {
+        perror("fstat");
+        exit(EXIT_FAILURE);
+    }
+    qif = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (qif == MAP_FAILED)
+    {
+        perror("mmap");
+        exit(EXIT_FAILURE);
+    }
+    close(fd);
+    qif_end = qif + st.st_size;
+
+    /* Headers take no more room than the file */
+    memset(trace, 0, sizeof(*trace));
+    trace->arena = xrealloc(NULL, st.st_size + 1);
+    off = 0;
+
+    p = qif;
+    while (p + 2 < qif_end)
+    {
+        nlnl = memmem(p, qif_end - p, "\n\n", 2);
+        if (!nlnl)
+            nlnl = qif_end;
+        if (trace->n_sets >= n_sets_alloc)
+        {
+            n_sets_alloc = n_sets_alloc ? n_sets_alloc * 2 : 256;
+            trace->sets = xrealloc(trace->sets,
+                                    sizeof(trace->sets[0]) * n_sets_alloc);
+        }
+        trace->sets[ trace->n_sets ].first = trace->n_headers;
+        while (p < nlnl)
+        {
+            tab = memmem(p, nlnl - p, "\t", 1);
+            if (!tab)
+            {
+                fprintf(stderr, "tab not found, off: %u\n",
+                                                    (unsigned) (p - qif));
+                exit(EXIT_FAILURE);
+            }
+            nl = memmem(tab + 1, nlnl - tab - 1, "\n", 1);
+            if (!nl)
+                nl = nlnl;
+            if (trace->n_headers >= n_alloc)
+            {
+                n_alloc = n_alloc ? n_alloc * 2 : 1024;
+                trace->headers = xrealloc(trace->headers,
+                                        sizeof(trace->headers[0]) * n_alloc);
+            }
+            trace->headers[ trace->n_headers++ ] = (struct header) {
+                .buf        = (const char *) (uintptr_t) off,
+                .name_len   = tab - p,
+                .val_len    = nl - tab - 1,
+            };
+            memcpy(trace->arena + off, p, tab - p);
+            off += tab - p;
+            memcpy(trace->arena + off, tab + 1, nl - tab - 1);
+            off += nl - tab - 1;
+            p = nl + 1;
+        }
+        trace->sets[ trace->n_sets ].count = trace->n_headers
+                                    - trace->sets[ trace->n_sets ].first;
+        ++trace->n_sets;
+        p = nlnl + 2;
+    }
+
+    /* Now that the arena no longer moves, turn offsets into pointers */
+    for (n = 0; n < trace->n_headers; ++n)
+    {
+        trace->headers[n].buf = trace->arena
+                                    + (uintptr_t) trace->headers[n].buf;
+        trace->n_bytes += trace->headers[n].name_len
+                                                + trace->headers[n].val_len;
+    }
+    munmap((void *) qif, st.st_size);
+}
+
+
+static void
+run_config (const struct trace *trace, struct config *config)
+{
+    const struct header *header;
+    const unsigned char *src;
+    struct lshpack_enc enc;
+    struct lshpack_dec dec;
+    struct lsxpack_header xhdr;
+    unsigned char *block, *end, *p;
+    size_t block_sz, off, mem;
+    char out[0x10000];
+    unsigned set, n;
+    int rc;
+
+    if (0 != lshpack_enc_init(&enc))
+        die("cannot initialize encoder");
+    if (config->history && 0 != lshpack_enc_use_hist(&enc, 1))
+        die("cannot turn on history");
+    lshpack_enc_set_max_capacity(&enc, config->table_size);
+    lshpack_dec_init(&dec);
+    lshpack_dec_set_max_capacity(&dec, config->table_size);
+
+    block_sz = 0x10000;
+    block = xrealloc(NULL, block_sz);
+
+    for (set = 0; set < trace->n_sets; ++set)
+    {
+        /* Encode */
+        p = block;
+        for (n = 0; n < trace->sets[set].count; ++n)
+        {
+            header = &trace->headers[ trace->sets[set].first + n ];
+            lsxpack_header_set_offset2(&xhdr, header->buf, 0,
+                        header->name_len, header->name_len, header->val_len);
+            if ((size_t) (block + block_sz - p) < 0x10000
+                                    + header->name_len + header->val_len)
+            {
+                off = p - block;
+                block_sz = block_sz * 2 + header->name_len + header->val_len;
+                block = xrealloc(block, block_sz);
+                p = block + off;
+            }
+            end = lshpack_enc_encode(&enc, p, block + block_sz, &xhdr);
+            if (end <= p)
+                die("cannot encode header");
+            p = end;
+        }
+        config->enc_bytes += p - block;
+
+        /* Decode and check */
+        src = block;
+        for (n = 0; n < trace->sets[set].count; ++n)
+        {
+            header = &trace->headers[ trace->sets[set].first + n ];
+            lsxpack_header_prepare_decode(&xhdr, out, 0, sizeof(out));
+            rc = lshpack_dec_decode(&dec, &src, p, &xhdr);
+            if (rc != 0)
+                die("cannot decode header");
+            if (!(xhdr.name_len == header->name_len
+                    && xhdr.val_len == header->val_len
+                    && 0 == memcmp(lsxpack_header_get_name(&xhdr),
+                                            header->buf, header->name_len)
+                    && 0 == memcmp(lsxpack_header_get_value(&xhdr),
+                            header->buf + header->name_len, header->val_len)))
+                die("decoded header does not match");
+        }
+        if (src != p)
+            die("decoder did not consume the whole block");
+
+        mem = sizeof(enc) + lshpack_enc_mem_used(&enc);
+        if (mem > config->enc_mem)
+            config->enc_mem = mem;
+        mem = sizeof(dec) + lshpack_dec_mem_used(&dec);
+        if (mem > config->dec_mem)
+            config->dec_mem = mem;
+    }
+
+    free(block);
+    lshpack_dec_cleanup(&dec);
+    lshpack_enc_cleanup(&enc);
+}
+
+
+static void *
+worker (void *ctx)
+{
+    struct sim *sim = ctx;
+    unsigned n;
+
+    for (;;)
+    {
+        pthread_mutex_lock(&sim->lock);
+        n = sim->next_config++;
+        pthread_mutex_unlock(&sim->lock);
+        if (n >= sim->n_configs)
+            return NULL;
+        run_config(sim->trace, &sim->configs[n]);
+    }
+}
+
+
+static void
+print_results (const struct sim *sim, int csv)
+{
+    const struct config *config, *prev;
+    double saved_per_kb;
+    unsigned n;
+
+    if (csv)
+        printf("table_size,history,enc_bytes,ratio,enc_mem,dec_mem,"
+                                                "saved_per_kb\n");
+    else
+        printf("%10s %4s %12s %7s %10s %10s %12s\n", "table_size", "hist",
+            "enc_bytes", "ratio", "enc_mem", "dec_mem", "saved/KB");
+
+    /* Configurations are ordered by history setting, then table size.
+     * The last column is the number of bytes saved by each kilobyte of
+     * additional memory compared to the previous table size.
+     */
+    for (n = 0; n < sim->n_configs; ++n)
+    {
+        config = &sim->configs[n];
+        prev = n > 0 && sim->configs[n - 1].history == config->history
+                                            ? &sim->configs[n - 1] : NULL;
+        if (prev && config->enc_mem + config->dec_mem
+                                            > prev->enc_mem + prev->dec_mem)
+            saved_per_kb = ((double) prev->enc_bytes - config->enc_bytes)
+                    * 1024.0 / ((double) (config->enc_mem + config->dec_mem)
+                                        - (prev->enc_mem + prev->dec_mem));
+        else
+            saved_per_kb = 0;
+        printf(csv ? "%u,%s,%" PRIu64 ",%.4f,%zu,%zu,%.1f\n"
+                   : "%10u %4s %12" PRIu64 " %7.4f %10zu %10zu %12.1f\n",
+            config->table_size, config->history ? "on" : "off",
+            config->enc_bytes,
+            sim->trace->n_bytes
+                ? (double) config->enc_bytes / sim->trace->n_bytes : 0.0,
+            config->enc_mem, config->dec_mem, saved_per_kb);
+    }
+}
+
+
+int
+main (int argc, char **argv)
+{
+    int opt, csv = 0, hist_on = 1, hist_off = 1;
+    unsigned sizes[64], n_sizes = 0, n_threads, n, hist;
+    long n_cpus;
+    const char *qif_path = NULL;
+    char *tok, *saveptr;
+    pthread_t *threads;
+    struct trace trace;
+    struct sim sim;
+
+    n_cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    n_threads = n_cpus > 0 ? n_cpus : 1;
+
+    while (-1 != (opt = getopt(argc, argv, "i:t:p:j:Ch")))
+    {
+        switch (opt)
+        {
+        case 'i':
+            qif_path = optarg;
+            break;
+        case 't':
+            for (tok = strtok_r(optarg, ",", &saveptr); tok;
+                                        tok = strtok_r(NULL, ",", &saveptr))
+            {
+                if (n_sizes >= sizeof(sizes) / sizeof(sizes[0]))
+                    die("too many table sizes");
+                sizes[ n_sizes++ ] = atoi(tok);
+            }
+            break;
+        case 'p':
+            hist_on = 0 == strcmp(optarg, "on") || 0 == strcmp(optarg, "both");
+            hist_off = 0 == strcmp(optarg, "off")
+                                            || 0 == strcmp(optarg, "both");
+            if (!hist_on && !hist_off)
+            {
+                fprintf(stderr, "unknown policy `%s'\n", optarg);
+                exit(EXIT_FAILURE);
+            }
+            break;
+        case 'j':
+            n_threads = atoi(optarg);
+            break;
+        case 'C':
+            csv = 1;
+            break;
+        case 'h':
+            usage(argv[0]);
+            exit(EXIT_SUCCESS);
+        default:
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    if (!qif_path)
+        die("Please specify QIF file using -i flag");
+    if (n_sizes == 0)
+    {
+        n_sizes = sizeof(s_default_sizes) / sizeof(s_default_sizes[0]);
+        memcpy(sizes, s_default_sizes, sizeof(s_default_sizes));
+    }
+    qsort(sizes, n_sizes, sizeof(sizes[0]), compare_unsigned);
+    if (n_threads == 0)
+        n_threads = 1;
+
+    read_trace(&trace, qif_path);
+
+    memset(&sim, 0, sizeof(sim));
+    sim.trace = &trace;
+    sim.configs = xrealloc(NULL, sizeof(sim.configs[0]) * n_sizes * 2);
+    for (hist = 0; hist < 2; ++hist)
+        if (hist ? hist_on : hist_off)
+            for (n = 0; n < n_sizes; ++n)
+                sim.configs[ sim.n_configs++ ] = (struct config) {
+                    .table_size = sizes[n],
+                    .history    = hist,
+                };
+    pthread_mutex_init(&sim.lock, NULL);
+
+    if (n_threads > sim.n_configs)
+        n_threads = sim.n_configs;
+    threads = xrealloc(NULL, sizeof(threads[0]) * n_threads);
+    for (n = 0; n < n_threads; ++n)
+        if (0 != pthread_create(&threads[n], NULL, worker, &sim))
+            die("cannot create thread");
+    for (n = 0; n < n_threads; ++n)
+        pthread_join(threads[n], NULL);
+
+    print_results(&sim, csv);
+
+    pthread_mutex_destroy(&sim.lock);
+    free(threads);
+    free(sim.configs);
+    free(trace.arena);
+    free(trace.headers);
+    free(trace.sets);
+    exit(EXIT_SUCCESS);
+}
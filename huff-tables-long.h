@@ -0,0 +1,32772 @@
+/* Generated by bin/gen-long-dec-table.c -- do not edit */
+static const struct hdec_long { uint8_t lens; uint8_t out; } hdecs_long[] =
+{
+/* 0 */ {19,92},
+/* 1 */ {19,92},
+/* 2 */ {19,92},
+/* 3 */ {19,92},
+/* 4 */ {19,92},
+/* 5 */ {19,92},
+/* 6 */ {19,92},
+/* 7 */ {19,92},
+/* 8 */ {19,92},
+/* 9 */ {19,92},
+/* 10 */ {19,92},
+/* 11 */ {19,92},
+/* 12 */ {19,92},
+/* 13 */ {19,92},
+/* 14 */ {19,92},
+/* 15 */ {19,92},
+/* 16 */ {19,92},
+/* 17 */ {19,92},
+/* 18 */ {19,92},
+/* 19 */ {19,92},
+/* 20 */ {19,92},
+/* 21 */ {19,92},
+/* 22 */ {19,92},
+/* 23 */ {19,92},
+/* 24 */ {19,92},
+/* 25 */ {19,92},
+/* 26 */ {19,92},
+/* 27 */ {19,92},
+/* 28 */ {19,92},
+/* 29 */ {19,92},
+/* 30 */ {19,92},
+/* 31 */ {19,92},
+/* 32 */ {19,92},
+/* 33 */ {19,92},
+/* 34 */ {19,92},
+/* 35 */ {19,92},
+/* 36 */ {19,92},
+/* 37 */ {19,92},
+/* 38 */ {19,92},
+/* 39 */ {19,92},
+/* 40 */ {19,92},
+/* 41 */ {19,92},
+/* 42 */ {19,92},
+/* 43 */ {19,92},
+/* 44 */ {19,92},
+/* 45 */ {19,92},
+/* 46 */ {19,92},
+/* 47 */ {19,92},
+/* 48 */ {19,92},
+/* 49 */ {19,92},
+/* 50 */ {19,92},
+/* 51 */ {19,92},
+/* 52 */ {19,92},
+/* 53 */ {19,92},
+/* 54 */ {19,92},
+/* 55 */ {19,92},
+/* 56 */ {19,92},
+/* 57 */ {19,92},
+/* 58 */ {19,92},
+/* 59 */ {19,92},
+/* 60 */ {19,92},
+/* 61 */ {19,92},
+/* 62 */ {19,92},
+/* 63 */ {19,92},
+/* 64 */ {19,92},
+/* 65 */ {19,92},
+/* 66 */ {19,92},
+/* 67 */ {19,92},
+/* 68 */ {19,92},
+/* 69 */ {19,92},
+/* 70 */ {19,92},
+/* 71 */ {19,92},
+/* 72 */ {19,92},
+/* 73 */ {19,92},
+/* 74 */ {19,92},
+/* 75 */ {19,92},
+/* 76 */ {19,92},
+/* 77 */ {19,92},
+/* 78 */ {19,92},
+/* 79 */ {19,92},
+/* 80 */ {19,92},
+/* 81 */ {19,92},
+/* 82 */ {19,92},
+/* 83 */ {19,92},
+/* 84 */ {19,92},
+/* 85 */ {19,92},
+/* 86 */ {19,92},
+/* 87 */ {19,92},
+/* 88 */ {19,92},
+/* 89 */ {19,92},
+/* 90 */ {19,92},
+/* 91 */ {19,92},
+/* 92 */ {19,92},
+/* 93 */ {19,92},
+/* 94 */ {19,92},
+/* 95 */ {19,92},
+/* 96 */ {19,92},
+/* 97 */ {19,92},
+/* 98 */ {19,92},
+/* 99 */ {19,92},
+/* 100 */ {19,92},
+/* 101 */ {19,92},
+/* 102 */ {19,92},
+/* 103 */ {19,92},
+/* 104 */ {19,92},
+/* 105 */ {19,92},
+/* 106 */ {19,92},
+/* 107 */ {19,92},
+/* 108 */ {19,92},
+/* 109 */ {19,92},
+/* 110 */ {19,92},
+/* 111 */ {19,92},
+/* 112 */ {19,92},
+/* 113 */ {19,92},
+/* 114 */ {19,92},
+/* 115 */ {19,92},
+/* 116 */ {19,92},
+/* 117 */ {19,92},
+/* 118 */ {19,92},
+/* 119 */ {19,92},
+/* 120 */ {19,92},
+/* 121 */ {19,92},
+/* 122 */ {19,92},
+/* 123 */ {19,92},
+/* 124 */ {19,92},
+/* 125 */ {19,92},
+/* 126 */ {19,92},
+/* 127 */ {19,92},
+/* 128 */ {19,92},
+/* 129 */ {19,92},
+/* 130 */ {19,92},
+/* 131 */ {19,92},
+/* 132 */ {19,92},
+/* 133 */ {19,92},
+/* 134 */ {19,92},
+/* 135 */ {19,92},
+/* 136 */ {19,92},
+/* 137 */ {19,92},
+/* 138 */ {19,92},
+/* 139 */ {19,92},
+/* 140 */ {19,92},
+/* 141 */ {19,92},
+/* 142 */ {19,92},
+/* 143 */ {19,92},
+/* 144 */ {19,92},
+/* 145 */ {19,92},
+/* 146 */ {19,92},
+/* 147 */ {19,92},
+/* 148 */ {19,92},
+/* 149 */ {19,92},
+/* 150 */ {19,92},
+/* 151 */ {19,92},
+/* 152 */ {19,92},
+/* 153 */ {19,92},
+/* 154 */ {19,92},
+/* 155 */ {19,92},
+/* 156 */ {19,92},
+/* 157 */ {19,92},
+/* 158 */ {19,92},
+/* 159 */ {19,92},
+/* 160 */ {19,92},
+/* 161 */ {19,92},
+/* 162 */ {19,92},
+/* 163 */ {19,92},
+/* 164 */ {19,92},
+/* 165 */ {19,92},
+/* 166 */ {19,92},
+/* 167 */ {19,92},
+/* 168 */ {19,92},
+/* 169 */ {19,92},
+/* 170 */ {19,92},
+/* 171 */ {19,92},
+/* 172 */ {19,92},
+/* 173 */ {19,92},
+/* 174 */ {19,92},
+/* 175 */ {19,92},
+/* 176 */ {19,92},
+/* 177 */ {19,92},
+/* 178 */ {19,92},
+/* 179 */ {19,92},
+/* 180 */ {19,92},
+/* 181 */ {19,92},
+/* 182 */ {19,92},
+/* 183 */ {19,92},
+/* 184 */ {19,92},
+/* 185 */ {19,92},
+/* 186 */ {19,92},
+/* 187 */ {19,92},
+/* 188 */ {19,92},
+/* 189 */ {19,92},
+/* 190 */ {19,92},
+/* 191 */ {19,92},
+/* 192 */ {19,92},
+/* 193 */ {19,92},
+/* 194 */ {19,92},
+/* 195 */ {19,92},
+/* 196 */ {19,92},
+/* 197 */ {19,92},
+/* 198 */ {19,92},
+/* 199 */ {19,92},
+/* 200 */ {19,92},
+/* 201 */ {19,92},
+/* 202 */ {19,92},
+/* 203 */ {19,92},
+/* 204 */ {19,92},
+/* 205 */ {19,92},
+/* 206 */ {19,92},
+/* 207 */ {19,92},
+/* 208 */ {19,92},
+/* 209 */ {19,92},
+/* 210 */ {19,92},
+/* 211 */ {19,92},
+/* 212 */ {19,92},
+/* 213 */ {19,92},
+/* 214 */ {19,92},
+/* 215 */ {19,92},
+/* 216 */ {19,92},
+/* 217 */ {19,92},
+/* 218 */ {19,92},
+/* 219 */ {19,92},
+/* 220 */ {19,92},
+/* 221 */ {19,92},
+/* 222 */ {19,92},
+/* 223 */ {19,92},
+/* 224 */ {19,92},
+/* 225 */ {19,92},
+/* 226 */ {19,92},
+/* 227 */ {19,92},
+/* 228 */ {19,92},
+/* 229 */ {19,92},
+/* 230 */ {19,92},
+/* 231 */ {19,92},
+/* 232 */ {19,92},
+/* 233 */ {19,92},
+/* 234 */ {19,92},
+/* 235 */ {19,92},
+/* 236 */ {19,92},
+/* 237 */ {19,92},
+/* 238 */ {19,92},
+/* 239 */ {19,92},
+/* 240 */ {19,92},
+/* 241 */ {19,92},
+/* 242 */ {19,92},
+/* 243 */ {19,92},
+/* 244 */ {19,92},
+/* 245 */ {19,92},
+/* 246 */ {19,92},
+/* 247 */ {19,92},
+/* 248 */ {19,92},
+/* 249 */ {19,92},
+/* 250 */ {19,92},
+/* 251 */ {19,92},
+/* 252 */ {19,92},
+/* 253 */ {19,92},
+/* 254 */ {19,92},
+/* 255 */ {19,92},
+/* 256 */ {19,92},
+/* 257 */ {19,92},
+/* 258 */ {19,92},
+/* 259 */ {19,92},
+/* 260 */ {19,92},
+/* 261 */ {19,92},
+/* 262 */ {19,92},
+/* 263 */ {19,92},
+/* 264 */ {19,92},
+/* 265 */ {19,92},
+/* 266 */ {19,92},
+/* 267 */ {19,92},
+/* 268 */ {19,92},
+/* 269 */ {19,92},
+/* 270 */ {19,92},
+/* 271 */ {19,92},
+/* 272 */ {19,92},
+/* 273 */ {19,92},
+/* 274 */ {19,92},
+/* 275 */ {19,92},
+/* 276 */ {19,92},
+/* 277 */ {19,92},
+/* 278 */ {19,92},
+/* 279 */ {19,92},
+/* 280 */ {19,92},
+/* 281 */ {19,92},
+/* 282 */ {19,92},
+/* 283 */ {19,92},
+/* 284 */ {19,92},
+/* 285 */ {19,92},
+/* 286 */ {19,92},
+/* 287 */ {19,92},
+/* 288 */ {19,92},
+/* 289 */ {19,92},
+/* 290 */ {19,92},
+/* 291 */ {19,92},
+/* 292 */ {19,92},
+/* 293 */ {19,92},
+/* 294 */ {19,92},
+/* 295 */ {19,92},
+/* 296 */ {19,92},
+/* 297 */ {19,92},
+/* 298 */ {19,92},
+/* 299 */ {19,92},
+/* 300 */ {19,92},
+/* 301 */ {19,92},
+/* 302 */ {19,92},
+/* 303 */ {19,92},
+/* 304 */ {19,92},
+/* 305 */ {19,92},
+/* 306 */ {19,92},
+/* 307 */ {19,92},
+/* 308 */ {19,92},
+/* 309 */ {19,92},
+/* 310 */ {19,92},
+/* 311 */ {19,92},
+/* 312 */ {19,92},
+/* 313 */ {19,92},
+/* 314 */ {19,92},
+/* 315 */ {19,92},
+/* 316 */ {19,92},
+/* 317 */ {19,92},
+/* 318 */ {19,92},
+/* 319 */ {19,92},
+/* 320 */ {19,92},
+/* 321 */ {19,92},
+/* 322 */ {19,92},
+/* 323 */ {19,92},
+/* 324 */ {19,92},
+/* 325 */ {19,92},
+/* 326 */ {19,92},
+/* 327 */ {19,92},
+/* 328 */ {19,92},
+/* 329 */ {19,92},
+/* 330 */ {19,92},
+/* 331 */ {19,92},
+/* 332 */ {19,92},
+/* 333 */ {19,92},
+/* 334 */ {19,92},
+/* 335 */ {19,92},
+/* 336 */ {19,92},
+/* 337 */ {19,92},
+/* 338 */ {19,92},
+/* 339 */ {19,92},
+/* 340 */ {19,92},
+/* 341 */ {19,92},
+/* 342 */ {19,92},
+/* 343 */ {19,92},
+/* 344 */ {19,92},
+/* 345 */ {19,92},
+/* 346 */ {19,92},
+/* 347 */ {19,92},
+/* 348 */ {19,92},
+/* 349 */ {19,92},
+/* 350 */ {19,92},
+/* 351 */ {19,92},
+/* 352 */ {19,92},
+/* 353 */ {19,92},
+/* 354 */ {19,92},
+/* 355 */ {19,92},
+/* 356 */ {19,92},
+/* 357 */ {19,92},
+/* 358 */ {19,92},
+/* 359 */ {19,92},
+/* 360 */ {19,92},
+/* 361 */ {19,92},
+/* 362 */ {19,92},
+/* 363 */ {19,92},
+/* 364 */ {19,92},
+/* 365 */ {19,92},
+/* 366 */ {19,92},
+/* 367 */ {19,92},
+/* 368 */ {19,92},
+/* 369 */ {19,92},
+/* 370 */ {19,92},
+/* 371 */ {19,92},
+/* 372 */ {19,92},
+/* 373 */ {19,92},
+/* 374 */ {19,92},
+/* 375 */ {19,92},
+/* 376 */ {19,92},
+/* 377 */ {19,92},
+/* 378 */ {19,92},
+/* 379 */ {19,92},
+/* 380 */ {19,92},
+/* 381 */ {19,92},
+/* 382 */ {19,92},
+/* 383 */ {19,92},
+/* 384 */ {19,92},
+/* 385 */ {19,92},
+/* 386 */ {19,92},
+/* 387 */ {19,92},
+/* 388 */ {19,92},
+/* 389 */ {19,92},
+/* 390 */ {19,92},
+/* 391 */ {19,92},
+/* 392 */ {19,92},
+/* 393 */ {19,92},
+/* 394 */ {19,92},
+/* 395 */ {19,92},
+/* 396 */ {19,92},
+/* 397 */ {19,92},
+/* 398 */ {19,92},
+/* 399 */ {19,92},
+/* 400 */ {19,92},
+/* 401 */ {19,92},
+/* 402 */ {19,92},
+/* 403 */ {19,92},
+/* 404 */ {19,92},
+/* 405 */ {19,92},
+/* 406 */ {19,92},
+/* 407 */ {19,92},
+/* 408 */ {19,92},
+/* 409 */ {19,92},
+/* 410 */ {19,92},
+/* 411 */ {19,92},
+/* 412 */ {19,92},
+/* 413 */ {19,92},
+/* 414 */ {19,92},
+/* 415 */ {19,92},
+/* 416 */ {19,92},
+/* 417 */ {19,92},
+/* 418 */ {19,92},
+/* 419 */ {19,92},
+/* 420 */ {19,92},
+/* 421 */ {19,92},
+/* 422 */ {19,92},
+/* 423 */ {19,92},
+/* 424 */ {19,92},
+/* 425 */ {19,92},
+/* 426 */ {19,92},
+/* 427 */ {19,92},
+/* 428 */ {19,92},
+/* 429 */ {19,92},
+/* 430 */ {19,92},
+/* 431 */ {19,92},
+/* 432 */ {19,92},
+/* 433 */ {19,92},
+/* 434 */ {19,92},
+/* 435 */ {19,92},
+/* 436 */ {19,92},
+/* 437 */ {19,92},
+/* 438 */ {19,92},
+/* 439 */ {19,92},
+/* 440 */ {19,92},
+/* 441 */ {19,92},
+/* 442 */ {19,92},
+/* 443 */ {19,92},
+/* 444 */ {19,92},
+/* 445 */ {19,92},
+/* 446 */ {19,92},
+/* 447 */ {19,92},
+/* 448 */ {19,92},
+/* 449 */ {19,92},
+/* 450 */ {19,92},
+/* 451 */ {19,92},
+/* 452 */ {19,92},
+/* 453 */ {19,92},
+/* 454 */ {19,92},
+/* 455 */ {19,92},
+/* 456 */ {19,92},
+/* 457 */ {19,92},
+/* 458 */ {19,92},
+/* 459 */ {19,92},
+/* 460 */ {19,92},
+/* 461 */ {19,92},
+/* 462 */ {19,92},
+/* 463 */ {19,92},
+/* 464 */ {19,92},
+/* 465 */ {19,92},
+/* 466 */ {19,92},
+/* 467 */ {19,92},
+/* 468 */ {19,92},
+/* 469 */ {19,92},
+/* 470 */ {19,92},
+/* 471 */ {19,92},
+/* 472 */ {19,92},
+/* 473 */ {19,92},
+/* 474 */ {19,92},
+/* 475 */ {19,92},
+/* 476 */ {19,92},
+/* 477 */ {19,92},
+/* 478 */ {19,92},
+/* 479 */ {19,92},
+/* 480 */ {19,92},
+/* 481 */ {19,92},
+/* 482 */ {19,92},
+/* 483 */ {19,92},
+/* 484 */ {19,92},
+/* 485 */ {19,92},
+/* 486 */ {19,92},
+/* 487 */ {19,92},
+/* 488 */ {19,92},
+/* 489 */ {19,92},
+/* 490 */ {19,92},
+/* 491 */ {19,92},
+/* 492 */ {19,92},
+/* 493 */ {19,92},
+/* 494 */ {19,92},
+/* 495 */ {19,92},
+/* 496 */ {19,92},
+/* 497 */ {19,92},
+/* 498 */ {19,92},
+/* 499 */ {19,92},
+/* 500 */ {19,92},
+/* 501 */ {19,92},
+/* 502 */ {19,92},
+/* 503 */ {19,92},
+/* 504 */ {19,92},
+/* 505 */ {19,92},
+/* 506 */ {19,92},
+/* 507 */ {19,92},
+/* 508 */ {19,92},
+/* 509 */ {19,92},
+/* 510 */ {19,92},
+/* 511 */ {19,92},
+/* 512 */ {19,92},
+/* 513 */ {19,92},
+/* 514 */ {19,92},
+/* 515 */ {19,92},
+/* 516 */ {19,92},
+/* 517 */ {19,92},
+/* 518 */ {19,92},
+/* 519 */ {19,92},
+/* 520 */ {19,92},
+/* 521 */ {19,92},
+/* 522 */ {19,92},
+/* 523 */ {19,92},
+/* 524 */ {19,92},
+/* 525 */ {19,92},
+/* 526 */ {19,92},
+/* 527 */ {19,92},
+/* 528 */ {19,92},
+/* 529 */ {19,92},
+/* 530 */ {19,92},
+/* 531 */ {19,92},
+/* 532 */ {19,92},
+/* 533 */ {19,92},
+/* 534 */ {19,92},
+/* 535 */ {19,92},
+/* 536 */ {19,92},
+/* 537 */ {19,92},
+/* 538 */ {19,92},
+/* 539 */ {19,92},
+/* 540 */ {19,92},
+/* 541 */ {19,92},
+/* 542 */ {19,92},
+/* 543 */ {19,92},
+/* 544 */ {19,92},
+/* 545 */ {19,92},
+/* 546 */ {19,92},
+/* 547 */ {19,92},
+/* 548 */ {19,92},
+/* 549 */ {19,92},
+/* 550 */ {19,92},
+/* 551 */ {19,92},
+/* 552 */ {19,92},
+/* 553 */ {19,92},
+/* 554 */ {19,92},
+/* 555 */ {19,92},
+/* 556 */ {19,92},
+/* 557 */ {19,92},
+/* 558 */ {19,92},
+/* 559 */ {19,92},
+/* 560 */ {19,92},
+/* 561 */ {19,92},
+/* 562 */ {19,92},
+/* 563 */ {19,92},
+/* 564 */ {19,92},
+/* 565 */ {19,92},
+/* 566 */ {19,92},
+/* 567 */ {19,92},
+/* 568 */ {19,92},
+/* 569 */ {19,92},
+/* 570 */ {19,92},
+/* 571 */ {19,92},
+/* 572 */ {19,92},
+/* 573 */ {19,92},
+/* 574 */ {19,92},
+/* 575 */ {19,92},
+/* 576 */ {19,92},
+/* 577 */ {19,92},
+/* 578 */ {19,92},
+/* 579 */ {19,92},
+/* 580 */ {19,92},
+/* 581 */ {19,92},
+/* 582 */ {19,92},
+/* 583 */ {19,92},
+/* 584 */ {19,92},
+/* 585 */ {19,92},
+/* 586 */ {19,92},
+/* 587 */ {19,92},
+/* 588 */ {19,92},
+/* 589 */ {19,92},
+/* 590 */ {19,92},
+/* 591 */ {19,92},
+/* 592 */ {19,92},
+/* 593 */ {19,92},
+/* 594 */ {19,92},
+/* 595 */ {19,92},
+/* 596 */ {19,92},
+/* 597 */ {19,92},
+/* 598 */ {19,92},
+/* 599 */ {19,92},
+/* 600 */ {19,92},
+/* 601 */ {19,92},
+/* 602 */ {19,92},
+/* 603 */ {19,92},
+/* 604 */ {19,92},
+/* 605 */ {19,92},
+/* 606 */ {19,92},
+/* 607 */ {19,92},
+/* 608 */ {19,92},
+/* 609 */ {19,92},
+/* 610 */ {19,92},
+/* 611 */ {19,92},
+/* 612 */ {19,92},
+/* 613 */ {19,92},
+/* 614 */ {19,92},
+/* 615 */ {19,92},
+/* 616 */ {19,92},
+/* 617 */ {19,92},
+/* 618 */ {19,92},
+/* 619 */ {19,92},
+/* 620 */ {19,92},
+/* 621 */ {19,92},
+/* 622 */ {19,92},
+/* 623 */ {19,92},
+/* 624 */ {19,92},
+/* 625 */ {19,92},
+/* 626 */ {19,92},
+/* 627 */ {19,92},
+/* 628 */ {19,92},
+/* 629 */ {19,92},
+/* 630 */ {19,92},
+/* 631 */ {19,92},
+/* 632 */ {19,92},
+/* 633 */ {19,92},
+/* 634 */ {19,92},
+/* 635 */ {19,92},
+/* 636 */ {19,92},
+/* 637 */ {19,92},
+/* 638 */ {19,92},
+/* 639 */ {19,92},
+/* 640 */ {19,92},
+/* 641 */ {19,92},
+/* 642 */ {19,92},
+/* 643 */ {19,92},
+/* 644 */ {19,92},
+/* 645 */ {19,92},
+/* 646 */ {19,92},
+/* 647 */ {19,92},
+/* 648 */ {19,92},
+/* 649 */ {19,92},
+/* 650 */ {19,92},
+/* 651 */ {19,92},
+/* 652 */ {19,92},
+/* 653 */ {19,92},
+/* 654 */ {19,92},
+/* 655 */ {19,92},
+/* 656 */ {19,92},
+/* 657 */ {19,92},
+/* 658 */ {19,92},
+/* 659 */ {19,92},
+/* 660 */ {19,92},
+/* 661 */ {19,92},
+/* 662 */ {19,92},
+/* 663 */ {19,92},
+/* 664 */ {19,92},
+/* 665 */ {19,92},
+/* 666 */ {19,92},
+/* 667 */ {19,92},
+/* 668 */ {19,92},
+/* 669 */ {19,92},
+/* 670 */ {19,92},
+/* 671 */ {19,92},
+/* 672 */ {19,92},
+/* 673 */ {19,92},
+/* 674 */ {19,92},
+/* 675 */ {19,92},
+/* 676 */ {19,92},
+/* 677 */ {19,92},
+/* 678 */ {19,92},
+/* 679 */ {19,92},
+/* 680 */ {19,92},
+/* 681 */ {19,92},
+/* 682 */ {19,92},
+/* 683 */ {19,92},
+/* 684 */ {19,92},
+/* 685 */ {19,92},
+/* 686 */ {19,92},
+/* 687 */ {19,92},
+/* 688 */ {19,92},
+/* 689 */ {19,92},
+/* 690 */ {19,92},
+/* 691 */ {19,92},
+/* 692 */ {19,92},
+/* 693 */ {19,92},
+/* 694 */ {19,92},
+/* 695 */ {19,92},
+/* 696 */ {19,92},
+/* 697 */ {19,92},
+/* 698 */ {19,92},
+/* 699 */ {19,92},
+/* 700 */ {19,92},
+/* 701 */ {19,92},
+/* 702 */ {19,92},
+/* 703 */ {19,92},
+/* 704 */ {19,92},
+/* 705 */ {19,92},
+/* 706 */ {19,92},
+/* 707 */ {19,92},
+/* 708 */ {19,92},
+/* 709 */ {19,92},
+/* 710 */ {19,92},
+/* 711 */ {19,92},
+/* 712 */ {19,92},
+/* 713 */ {19,92},
+/* 714 */ {19,92},
+/* 715 */ {19,92},
+/* 716 */ {19,92},
+/* 717 */ {19,92},
+/* 718 */ {19,92},
+/* 719 */ {19,92},
+/* 720 */ {19,92},
+/* 721 */ {19,92},
+/* 722 */ {19,92},
+/* 723 */ {19,92},
+/* 724 */ {19,92},
+/* 725 */ {19,92},
+/* 726 */ {19,92},
+/* 727 */ {19,92},
+/* 728 */ {19,92},
+/* 729 */ {19,92},
+/* 730 */ {19,92},
+/* 731 */ {19,92},
+/* 732 */ {19,92},
+/* 733 */ {19,92},
+/* 734 */ {19,92},
+/* 735 */ {19,92},
+/* 736 */ {19,92},
+/* 737 */ {19,92},
+/* 738 */ {19,92},
+/* 739 */ {19,92},
+/* 740 */ {19,92},
+/* 741 */ {19,92},
+/* 742 */ {19,92},
+/* 743 */ {19,92},
+/* 744 */ {19,92},
+/* 745 */ {19,92},
+/* 746 */ {19,92},
+/* 747 */ {19,92},
+/* 748 */ {19,92},
+/* 749 */ {19,92},
+/* 750 */ {19,92},
+/* 751 */ {19,92},
+/* 752 */ {19,92},
+/* 753 */ {19,92},
+/* 754 */ {19,92},
+/* 755 */ {19,92},
+/* 756 */ {19,92},
+/* 757 */ {19,92},
+/* 758 */ {19,92},
+/* 759 */ {19,92},
+/* 760 */ {19,92},
+/* 761 */ {19,92},
+/* 762 */ {19,92},
+/* 763 */ {19,92},
+/* 764 */ {19,92},
+/* 765 */ {19,92},
+/* 766 */ {19,92},
+/* 767 */ {19,92},
+/* 768 */ {19,92},
+/* 769 */ {19,92},
+/* 770 */ {19,92},
+/* 771 */ {19,92},
+/* 772 */ {19,92},
+/* 773 */ {19,92},
+/* 774 */ {19,92},
+/* 775 */ {19,92},
+/* 776 */ {19,92},
+/* 777 */ {19,92},
+/* 778 */ {19,92},
+/* 779 */ {19,92},
+/* 780 */ {19,92},
+/* 781 */ {19,92},
+/* 782 */ {19,92},
+/* 783 */ {19,92},
+/* 784 */ {19,92},
+/* 785 */ {19,92},
+/* 786 */ {19,92},
+/* 787 */ {19,92},
+/* 788 */ {19,92},
+/* 789 */ {19,92},
+/* 790 */ {19,92},
+/* 791 */ {19,92},
+/* 792 */ {19,92},
+/* 793 */ {19,92},
+/* 794 */ {19,92},
+/* 795 */ {19,92},
+/* 796 */ {19,92},
+/* 797 */ {19,92},
+/* 798 */ {19,92},
+/* 799 */ {19,92},
+/* 800 */ {19,92},
+/* 801 */ {19,92},
+/* 802 */ {19,92},
+/* 803 */ {19,92},
+/* 804 */ {19,92},
+/* 805 */ {19,92},
+/* 806 */ {19,92},
+/* 807 */ {19,92},
+/* 808 */ {19,92},
+/* 809 */ {19,92},
+/* 810 */ {19,92},
+/* 811 */ {19,92},
+/* 812 */ {19,92},
+/* 813 */ {19,92},
+/* 814 */ {19,92},
+/* 815 */ {19,92},
+/* 816 */ {19,92},
+/* 817 */ {19,92},
+/* 818 */ {19,92},
+/* 819 */ {19,92},
+/* 820 */ {19,92},
+/* 821 */ {19,92},
+/* 822 */ {19,92},
+/* 823 */ {19,92},
+/* 824 */ {19,92},
+/* 825 */ {19,92},
+/* 826 */ {19,92},
+/* 827 */ {19,92},
+/* 828 */ {19,92},
+/* 829 */ {19,92},
+/* 830 */ {19,92},
+/* 831 */ {19,92},
+/* 832 */ {19,92},
+/* 833 */ {19,92},
+/* 834 */ {19,92},
+/* 835 */ {19,92},
+/* 836 */ {19,92},
+/* 837 */ {19,92},
+/* 838 */ {19,92},
+/* 839 */ {19,92},
+/* 840 */ {19,92},
+/* 841 */ {19,92},
+/* 842 */ {19,92},
+/* 843 */ {19,92},
+/* 844 */ {19,92},
+/* 845 */ {19,92},
+/* 846 */ {19,92},
+/* 847 */ {19,92},
+/* 848 */ {19,92},
+/* 849 */ {19,92},
+/* 850 */ {19,92},
+/* 851 */ {19,92},
+/* 852 */ {19,92},
+/* 853 */ {19,92},
+/* 854 */ {19,92},
+/* 855 */ {19,92},
+/* 856 */ {19,92},
+/* 857 */ {19,92},
+/* 858 */ {19,92},
+/* 859 */ {19,92},
+/* 860 */ {19,92},
+/* 861 */ {19,92},
+/* 862 */ {19,92},
+/* 863 */ {19,92},
+/* 864 */ {19,92},
+/* 865 */ {19,92},
+/* 866 */ {19,92},
+/* 867 */ {19,92},
+/* 868 */ {19,92},
+/* 869 */ {19,92},
+/* 870 */ {19,92},
+/* 871 */ {19,92},
+/* 872 */ {19,92},
+/* 873 */ {19,92},
+/* 874 */ {19,92},
+/* 875 */ {19,92},
+/* 876 */ {19,92},
+/* 877 */ {19,92},
+/* 878 */ {19,92},
+/* 879 */ {19,92},
+/* 880 */ {19,92},
+/* 881 */ {19,92},
+/* 882 */ {19,92},
+/* 883 */ {19,92},
+/* 884 */ {19,92},
+/* 885 */ {19,92},
+/* 886 */ {19,92},
+/* 887 */ {19,92},
+/* 888 */ {19,92},
+/* 889 */ {19,92},
+/* 890 */ {19,92},
+/* 891 */ {19,92},
+/* 892 */ {19,92},
+/* 893 */ {19,92},
+/* 894 */ {19,92},
+/* 895 */ {19,92},
+/* 896 */ {19,92},
+/* 897 */ {19,92},
+/* 898 */ {19,92},
+/* 899 */ {19,92},
+/* 900 */ {19,92},
+/* 901 */ {19,92},
+/* 902 */ {19,92},
+/* 903 */ {19,92},
+/* 904 */ {19,92},
+/* 905 */ {19,92},
+/* 906 */ {19,92},
+/* 907 */ {19,92},
+/* 908 */ {19,92},
+/* 909 */ {19,92},
+/* 910 */ {19,92},
+/* 911 */ {19,92},
+/* 912 */ {19,92},
+/* 913 */ {19,92},
+/* 914 */ {19,92},
+/* 915 */ {19,92},
+/* 916 */ {19,92},
+/* 917 */ {19,92},
+/* 918 */ {19,92},
+/* 919 */ {19,92},
+/* 920 */ {19,92},
+/* 921 */ {19,92},
+/* 922 */ {19,92},
+/* 923 */ {19,92},
+/* 924 */ {19,92},
+/* 925 */ {19,92},
+/* 926 */ {19,92},
+/* 927 */ {19,92},
+/* 928 */ {19,92},
+/* 929 */ {19,92},
+/* 930 */ {19,92},
+/* 931 */ {19,92},
+/* 932 */ {19,92},
+/* 933 */ {19,92},
+/* 934 */ {19,92},
+/* 935 */ {19,92},
+/* 936 */ {19,92},
+/* 937 */ {19,92},
+/* 938 */ {19,92},
+/* 939 */ {19,92},
+/* 940 */ {19,92},
+/* 941 */ {19,92},
+/* 942 */ {19,92},
+/* 943 */ {19,92},
+/* 944 */ {19,92},
+/* 945 */ {19,92},
+/* 946 */ {19,92},
+/* 947 */ {19,92},
+/* 948 */ {19,92},
+/* 949 */ {19,92},
+/* 950 */ {19,92},
+/* 951 */ {19,92},
+/* 952 */ {19,92},
+/* 953 */ {19,92},
+/* 954 */ {19,92},
+/* 955 */ {19,92},
+/* 956 */ {19,92},
+/* 957 */ {19,92},
+/* 958 */ {19,92},
+/* 959 */ {19,92},
+/* 960 */ {19,92},
+/* 961 */ {19,92},
+/* 962 */ {19,92},
+/* 963 */ {19,92},
+/* 964 */ {19,92},
+/* 965 */ {19,92},
+/* 966 */ {19,92},
+/* 967 */ {19,92},
+/* 968 */ {19,92},
+/* 969 */ {19,92},
+/* 970 */ {19,92},
+/* 971 */ {19,92},
+/* 972 */ {19,92},
+/* 973 */ {19,92},
+/* 974 */ {19,92},
+/* 975 */ {19,92},
+/* 976 */ {19,92},
+/* 977 */ {19,92},
+/* 978 */ {19,92},
+/* 979 */ {19,92},
+/* 980 */ {19,92},
+/* 981 */ {19,92},
+/* 982 */ {19,92},
+/* 983 */ {19,92},
+/* 984 */ {19,92},
+/* 985 */ {19,92},
+/* 986 */ {19,92},
+/* 987 */ {19,92},
+/* 988 */ {19,92},
+/* 989 */ {19,92},
+/* 990 */ {19,92},
+/* 991 */ {19,92},
+/* 992 */ {19,92},
+/* 993 */ {19,92},
+/* 994 */ {19,92},
+/* 995 */ {19,92},
+/* 996 */ {19,92},
+/* 997 */ {19,92},
+/* 998 */ {19,92},
+/* 999 */ {19,92},
+/* 1000 */ {19,92},
+/* 1001 */ {19,92},
+/* 1002 */ {19,92},
+/* 1003 */ {19,92},
+/* 1004 */ {19,92},
+/* 1005 */ {19,92},
+/* 1006 */ {19,92},
+/* 1007 */ {19,92},
+/* 1008 */ {19,92},
+/* 1009 */ {19,92},
+/* 1010 */ {19,92},
+/* 1011 */ {19,92},
+/* 1012 */ {19,92},
+/* 1013 */ {19,92},
+/* 1014 */ {19,92},
+/* 1015 */ {19,92},
+/* 1016 */ {19,92},
+/* 1017 */ {19,92},
+/* 1018 */ {19,92},
+/* 1019 */ {19,92},
+/* 1020 */ {19,92},
+/* 1021 */ {19,92},
+/* 1022 */ {19,92},
+/* 1023 */ {19,92},
+/* 1024 */ {19,92},
+/* 1025 */ {19,92},
+/* 1026 */ {19,92},
+/* 1027 */ {19,92},
+/* 1028 */ {19,92},
+/* 1029 */ {19,92},
+/* 1030 */ {19,92},
+/* 1031 */ {19,92},
+/* 1032 */ {19,92},
+/* 1033 */ {19,92},
+/* 1034 */ {19,92},
+/* 1035 */ {19,92},
+/* 1036 */ {19,92},
+/* 1037 */ {19,92},
+/* 1038 */ {19,92},
+/* 1039 */ {19,92},
+/* 1040 */ {19,92},
+/* 1041 */ {19,92},
+/* 1042 */ {19,92},
+/* 1043 */ {19,92},
+/* 1044 */ {19,92},
+/* 1045 */ {19,92},
+/* 1046 */ {19,92},
+/* 1047 */ {19,92},
+/* 1048 */ {19,92},
+/* 1049 */ {19,92},
+/* 1050 */ {19,92},
+/* 1051 */ {19,92},
+/* 1052 */ {19,92},
+/* 1053 */ {19,92},
+/* 1054 */ {19,92},
+/* 1055 */ {19,92},
+/* 1056 */ {19,92},
+/* 1057 */ {19,92},
+/* 1058 */ {19,92},
+/* 1059 */ {19,92},
+/* 1060 */ {19,92},
+/* 1061 */ {19,92},
+/* 1062 */ {19,92},
+/* 1063 */ {19,92},
+/* 1064 */ {19,92},
+/* 1065 */ {19,92},
+/* 1066 */ {19,92},
+/* 1067 */ {19,92},
+/* 1068 */ {19,92},
+/* 1069 */ {19,92},
+/* 1070 */ {19,92},
+/* 1071 */ {19,92},
+/* 1072 */ {19,92},
+/* 1073 */ {19,92},
+/* 1074 */ {19,92},
+/* 1075 */ {19,92},
+/* 1076 */ {19,92},
+/* 1077 */ {19,92},
+/* 1078 */ {19,92},
+/* 1079 */ {19,92},
+/* 1080 */ {19,92},
+/* 1081 */ {19,92},
+/* 1082 */ {19,92},
+/* 1083 */ {19,92},
+/* 1084 */ {19,92},
+/* 1085 */ {19,92},
+/* 1086 */ {19,92},
+/* 1087 */ {19,92},
+/* 1088 */ {19,92},
+/* 1089 */ {19,92},
+/* 1090 */ {19,92},
+/* 1091 */ {19,92},
+/* 1092 */ {19,92},
+/* 1093 */ {19,92},
+/* 1094 */ {19,92},
+/* 1095 */ {19,92},
+/* 1096 */ {19,92},
+/* 1097 */ {19,92},
+/* 1098 */ {19,92},
+/* 1099 */ {19,92},
+/* 1100 */ {19,92},
+/* 1101 */ {19,92},
+/* 1102 */ {19,92},
+/* 1103 */ {19,92},
+/* 1104 */ {19,92},
+/* 1105 */ {19,92},
+/* 1106 */ {19,92},
+/* 1107 */ {19,92},
+/* 1108 */ {19,92},
+/* 1109 */ {19,92},
+/* 1110 */ {19,92},
+/* 1111 */ {19,92},
+/* 1112 */ {19,92},
+/* 1113 */ {19,92},
+/* 1114 */ {19,92},
+/* 1115 */ {19,92},
+/* 1116 */ {19,92},
+/* 1117 */ {19,92},
+/* 1118 */ {19,92},
+/* 1119 */ {19,92},
+/* 1120 */ {19,92},
+/* 1121 */ {19,92},
+/* 1122 */ {19,92},
+/* 1123 */ {19,92},
+/* 1124 */ {19,92},
+/* 1125 */ {19,92},
+/* 1126 */ {19,92},
+/* 1127 */ {19,92},
+/* 1128 */ {19,92},
+/* 1129 */ {19,92},
+/* 1130 */ {19,92},
+/* 1131 */ {19,92},
+/* 1132 */ {19,92},
+/* 1133 */ {19,92},
+/* 1134 */ {19,92},
+/* 1135 */ {19,92},
+/* 1136 */ {19,92},
+/* 1137 */ {19,92},
+/* 1138 */ {19,92},
+/* 1139 */ {19,92},
+/* 1140 */ {19,92},
+/* 1141 */ {19,92},
+/* 1142 */ {19,92},
+/* 1143 */ {19,92},
+/* 1144 */ {19,92},
+/* 1145 */ {19,92},
+/* 1146 */ {19,92},
+/* 1147 */ {19,92},
+/* 1148 */ {19,92},
+/* 1149 */ {19,92},
+/* 1150 */ {19,92},
+/* 1151 */ {19,92},
+/* 1152 */ {19,92},
+/* 1153 */ {19,92},
+/* 1154 */ {19,92},
+/* 1155 */ {19,92},
+/* 1156 */ {19,92},
+/* 1157 */ {19,92},
+/* 1158 */ {19,92},
+/* 1159 */ {19,92},
+/* 1160 */ {19,92},
+/* 1161 */ {19,92},
+/* 1162 */ {19,92},
+/* 1163 */ {19,92},
+/* 1164 */ {19,92},
+/* 1165 */ {19,92},
+/* 1166 */ {19,92},
+/* 1167 */ {19,92},
+/* 1168 */ {19,92},
+/* 1169 */ {19,92},
+/* 1170 */ {19,92},
+/* 1171 */ {19,92},
+/* 1172 */ {19,92},
+/* 1173 */ {19,92},
+/* 1174 */ {19,92},
+/* 1175 */ {19,92},
+/* 1176 */ {19,92},
+/* 1177 */ {19,92},
+/* 1178 */ {19,92},
+/* 1179 */ {19,92},
+/* 1180 */ {19,92},
+/* 1181 */ {19,92},
+/* 1182 */ {19,92},
+/* 1183 */ {19,92},
+/* 1184 */ {19,92},
+/* 1185 */ {19,92},
+/* 1186 */ {19,92},
+/* 1187 */ {19,92},
+/* 1188 */ {19,92},
+/* 1189 */ {19,92},
+/* 1190 */ {19,92},
+/* 1191 */ {19,92},
+/* 1192 */ {19,92},
+/* 1193 */ {19,92},
+/* 1194 */ {19,92},
+/* 1195 */ {19,92},
+/* 1196 */ {19,92},
+/* 1197 */ {19,92},
+/* 1198 */ {19,92},
+/* 1199 */ {19,92},
+/* 1200 */ {19,92},
+/* 1201 */ {19,92},
+/* 1202 */ {19,92},
+/* 1203 */ {19,92},
+/* 1204 */ {19,92},
+/* 1205 */ {19,92},
+/* 1206 */ {19,92},
+/* 1207 */ {19,92},
+/* 1208 */ {19,92},
+/* 1209 */ {19,92},
+/* 1210 */ {19,92},
+/* 1211 */ {19,92},
+/* 1212 */ {19,92},
+/* 1213 */ {19,92},
+/* 1214 */ {19,92},
+/* 1215 */ {19,92},
+/* 1216 */ {19,92},
+/* 1217 */ {19,92},
+/* 1218 */ {19,92},
+/* 1219 */ {19,92},
+/* 1220 */ {19,92},
+/* 1221 */ {19,92},
+/* 1222 */ {19,92},
+/* 1223 */ {19,92},
+/* 1224 */ {19,92},
+/* 1225 */ {19,92},
+/* 1226 */ {19,92},
+/* 1227 */ {19,92},
+/* 1228 */ {19,92},
+/* 1229 */ {19,92},
+/* 1230 */ {19,92},
+/* 1231 */ {19,92},
+/* 1232 */ {19,92},
+/* 1233 */ {19,92},
+/* 1234 */ {19,92},
+/* 1235 */ {19,92},
+/* 1236 */ {19,92},
+/* 1237 */ {19,92},
+/* 1238 */ {19,92},
+/* 1239 */ {19,92},
+/* 1240 */ {19,92},
+/* 1241 */ {19,92},
+/* 1242 */ {19,92},
+/* 1243 */ {19,92},
+/* 1244 */ {19,92},
+/* 1245 */ {19,92},
+/* 1246 */ {19,92},
+/* 1247 */ {19,92},
+/* 1248 */ {19,92},
+/* 1249 */ {19,92},
+/* 1250 */ {19,92},
+/* 1251 */ {19,92},
+/* 1252 */ {19,92},
+/* 1253 */ {19,92},
+/* 1254 */ {19,92},
+/* 1255 */ {19,92},
+/* 1256 */ {19,92},
+/* 1257 */ {19,92},
+/* 1258 */ {19,92},
+/* 1259 */ {19,92},
+/* 1260 */ {19,92},
+/* 1261 */ {19,92},
+/* 1262 */ {19,92},
+/* 1263 */ {19,92},
+/* 1264 */ {19,92},
+/* 1265 */ {19,92},
+/* 1266 */ {19,92},
+/* 1267 */ {19,92},
+/* 1268 */ {19,92},
+/* 1269 */ {19,92},
+/* 1270 */ {19,92},
+/* 1271 */ {19,92},
+/* 1272 */ {19,92},
+/* 1273 */ {19,92},
+/* 1274 */ {19,92},
+/* 1275 */ {19,92},
+/* 1276 */ {19,92},
+/* 1277 */ {19,92},
+/* 1278 */ {19,92},
+/* 1279 */ {19,92},
+/* 1280 */ {19,92},
+/* 1281 */ {19,92},
+/* 1282 */ {19,92},
+/* 1283 */ {19,92},
+/* 1284 */ {19,92},
+/* 1285 */ {19,92},
+/* 1286 */ {19,92},
+/* 1287 */ {19,92},
+/* 1288 */ {19,92},
+/* 1289 */ {19,92},
+/* 1290 */ {19,92},
+/* 1291 */ {19,92},
+/* 1292 */ {19,92},
+/* 1293 */ {19,92},
+/* 1294 */ {19,92},
+/* 1295 */ {19,92},
+/* 1296 */ {19,92},
+/* 1297 */ {19,92},
+/* 1298 */ {19,92},
+/* 1299 */ {19,92},
+/* 1300 */ {19,92},
+/* 1301 */ {19,92},
+/* 1302 */ {19,92},
+/* 1303 */ {19,92},
+/* 1304 */ {19,92},
+/* 1305 */ {19,92},
+/* 1306 */ {19,92},
+/* 1307 */ {19,92},
+/* 1308 */ {19,92},
+/* 1309 */ {19,92},
+/* 1310 */ {19,92},
+/* 1311 */ {19,92},
+/* 1312 */ {19,92},
+/* 1313 */ {19,92},
+/* 1314 */ {19,92},
+/* 1315 */ {19,92},
+/* 1316 */ {19,92},
+/* 1317 */ {19,92},
+/* 1318 */ {19,92},
+/* 1319 */ {19,92},
+/* 1320 */ {19,92},
+/* 1321 */ {19,92},
+/* 1322 */ {19,92},
+/* 1323 */ {19,92},
+/* 1324 */ {19,92},
+/* 1325 */ {19,92},
+/* 1326 */ {19,92},
+/* 1327 */ {19,92},
+/* 1328 */ {19,92},
+/* 1329 */ {19,92},
+/* 1330 */ {19,92},
+/* 1331 */ {19,92},
+/* 1332 */ {19,92},
+/* 1333 */ {19,92},
+/* 1334 */ {19,92},
+/* 1335 */ {19,92},
+/* 1336 */ {19,92},
+/* 1337 */ {19,92},
+/* 1338 */ {19,92},
+/* 1339 */ {19,92},
+/* 1340 */ {19,92},
+/* 1341 */ {19,92},
+/* 1342 */ {19,92},
+/* 1343 */ {19,92},
+/* 1344 */ {19,92},
+/* 1345 */ {19,92},
+/* 1346 */ {19,92},
+/* 1347 */ {19,92},
+/* 1348 */ {19,92},
+/* 1349 */ {19,92},
+/* 1350 */ {19,92},
+/* 1351 */ {19,92},
+/* 1352 */ {19,92},
+/* 1353 */ {19,92},
+/* 1354 */ {19,92},
+/* 1355 */ {19,92},
+/* 1356 */ {19,92},
+/* 1357 */ {19,92},
+/* 1358 */ {19,92},
+/* 1359 */ {19,92},
+/* 1360 */ {19,92},
+/* 1361 */ {19,92},
+/* 1362 */ {19,92},
+/* 1363 */ {19,92},
+/* 1364 */ {19,92},
+/* 1365 */ {19,92},
+/* 1366 */ {19,92},
+/* 1367 */ {19,92},
+/* 1368 */ {19,92},
+/* 1369 */ {19,92},
+/* 1370 */ {19,92},
+/* 1371 */ {19,92},
+/* 1372 */ {19,92},
+/* 1373 */ {19,92},
+/* 1374 */ {19,92},
+/* 1375 */ {19,92},
+/* 1376 */ {19,92},
+/* 1377 */ {19,92},
+/* 1378 */ {19,92},
+/* 1379 */ {19,92},
+/* 1380 */ {19,92},
+/* 1381 */ {19,92},
+/* 1382 */ {19,92},
+/* 1383 */ {19,92},
+/* 1384 */ {19,92},
+/* 1385 */ {19,92},
+/* 1386 */ {19,92},
+/* 1387 */ {19,92},
+/* 1388 */ {19,92},
+/* 1389 */ {19,92},
+/* 1390 */ {19,92},
+/* 1391 */ {19,92},
+/* 1392 */ {19,92},
+/* 1393 */ {19,92},
+/* 1394 */ {19,92},
+/* 1395 */ {19,92},
+/* 1396 */ {19,92},
+/* 1397 */ {19,92},
+/* 1398 */ {19,92},
+/* 1399 */ {19,92},
+/* 1400 */ {19,92},
+/* 1401 */ {19,92},
+/* 1402 */ {19,92},
+/* 1403 */ {19,92},
+/* 1404 */ {19,92},
+/* 1405 */ {19,92},
+/* 1406 */ {19,92},
+/* 1407 */ {19,92},
+/* 1408 */ {19,92},
+/* 1409 */ {19,92},
+/* 1410 */ {19,92},
+/* 1411 */ {19,92},
+/* 1412 */ {19,92},
+/* 1413 */ {19,92},
+/* 1414 */ {19,92},
+/* 1415 */ {19,92},
+/* 1416 */ {19,92},
+/* 1417 */ {19,92},
+/* 1418 */ {19,92},
+/* 1419 */ {19,92},
+/* 1420 */ {19,92},
+/* 1421 */ {19,92},
+/* 1422 */ {19,92},
+/* 1423 */ {19,92},
+/* 1424 */ {19,92},
+/* 1425 */ {19,92},
+/* 1426 */ {19,92},
+/* 1427 */ {19,92},
+/* 1428 */ {19,92},
+/* 1429 */ {19,92},
+/* 1430 */ {19,92},
+/* 1431 */ {19,92},
+/* 1432 */ {19,92},
+/* 1433 */ {19,92},
+/* 1434 */ {19,92},
+/* 1435 */ {19,92},
+/* 1436 */ {19,92},
+/* 1437 */ {19,92},
+/* 1438 */ {19,92},
+/* 1439 */ {19,92},
+/* 1440 */ {19,92},
+/* 1441 */ {19,92},
+/* 1442 */ {19,92},
+/* 1443 */ {19,92},
+/* 1444 */ {19,92},
+/* 1445 */ {19,92},
+/* 1446 */ {19,92},
+/* 1447 */ {19,92},
+/* 1448 */ {19,92},
+/* 1449 */ {19,92},
+/* 1450 */ {19,92},
+/* 1451 */ {19,92},
+/* 1452 */ {19,92},
+/* 1453 */ {19,92},
+/* 1454 */ {19,92},
+/* 1455 */ {19,92},
+/* 1456 */ {19,92},
+/* 1457 */ {19,92},
+/* 1458 */ {19,92},
+/* 1459 */ {19,92},
+/* 1460 */ {19,92},
+/* 1461 */ {19,92},
+/* 1462 */ {19,92},
+/* 1463 */ {19,92},
+/* 1464 */ {19,92},
+/* 1465 */ {19,92},
+/* 1466 */ {19,92},
+/* 1467 */ {19,92},
+/* 1468 */ {19,92},
+/* 1469 */ {19,92},
+/* 1470 */ {19,92},
+/* 1471 */ {19,92},
+/* 1472 */ {19,92},
+/* 1473 */ {19,92},
+/* 1474 */ {19,92},
+/* 1475 */ {19,92},
+/* 1476 */ {19,92},
+/* 1477 */ {19,92},
+/* 1478 */ {19,92},
+/* 1479 */ {19,92},
+/* 1480 */ {19,92},
+/* 1481 */ {19,92},
+/* 1482 */ {19,92},
+/* 1483 */ {19,92},
+/* 1484 */ {19,92},
+/* 1485 */ {19,92},
+/* 1486 */ {19,92},
+/* 1487 */ {19,92},
+/* 1488 */ {19,92},
+/* 1489 */ {19,92},
+/* 1490 */ {19,92},
+/* 1491 */ {19,92},
+/* 1492 */ {19,92},
+/* 1493 */ {19,92},
+/* 1494 */ {19,92},
+/* 1495 */ {19,92},
+/* 1496 */ {19,92},
+/* 1497 */ {19,92},
+/* 1498 */ {19,92},
+/* 1499 */ {19,92},
+/* 1500 */ {19,92},
+/* 1501 */ {19,92},
+/* 1502 */ {19,92},
+/* 1503 */ {19,92},
+/* 1504 */ {19,92},
+/* 1505 */ {19,92},
+/* 1506 */ {19,92},
+/* 1507 */ {19,92},
+/* 1508 */ {19,92},
+/* 1509 */ {19,92},
+/* 1510 */ {19,92},
+/* 1511 */ {19,92},
+/* 1512 */ {19,92},
+/* 1513 */ {19,92},
+/* 1514 */ {19,92},
+/* 1515 */ {19,92},
+/* 1516 */ {19,92},
+/* 1517 */ {19,92},
+/* 1518 */ {19,92},
+/* 1519 */ {19,92},
+/* 1520 */ {19,92},
+/* 1521 */ {19,92},
+/* 1522 */ {19,92},
+/* 1523 */ {19,92},
+/* 1524 */ {19,92},
+/* 1525 */ {19,92},
+/* 1526 */ {19,92},
+/* 1527 */ {19,92},
+/* 1528 */ {19,92},
+/* 1529 */ {19,92},
+/* 1530 */ {19,92},
+/* 1531 */ {19,92},
+/* 1532 */ {19,92},
+/* 1533 */ {19,92},
+/* 1534 */ {19,92},
+/* 1535 */ {19,92},
+/* 1536 */ {19,92},
+/* 1537 */ {19,92},
+/* 1538 */ {19,92},
+/* 1539 */ {19,92},
+/* 1540 */ {19,92},
+/* 1541 */ {19,92},
+/* 1542 */ {19,92},
+/* 1543 */ {19,92},
+/* 1544 */ {19,92},
+/* 1545 */ {19,92},
+/* 1546 */ {19,92},
+/* 1547 */ {19,92},
+/* 1548 */ {19,92},
+/* 1549 */ {19,92},
+/* 1550 */ {19,92},
+/* 1551 */ {19,92},
+/* 1552 */ {19,92},
+/* 1553 */ {19,92},
+/* 1554 */ {19,92},
+/* 1555 */ {19,92},
+/* 1556 */ {19,92},
+/* 1557 */ {19,92},
+/* 1558 */ {19,92},
+/* 1559 */ {19,92},
+/* 1560 */ {19,92},
+/* 1561 */ {19,92},
+/* 1562 */ {19,92},
+/* 1563 */ {19,92},
+/* 1564 */ {19,92},
+/* 1565 */ {19,92},
+/* 1566 */ {19,92},
+/* 1567 */ {19,92},
+/* 1568 */ {19,92},
+/* 1569 */ {19,92},
+/* 1570 */ {19,92},
+/* 1571 */ {19,92},
+/* 1572 */ {19,92},
+/* 1573 */ {19,92},
+/* 1574 */ {19,92},
+/* 1575 */ {19,92},
+/* 1576 */ {19,92},
+/* 1577 */ {19,92},
+/* 1578 */ {19,92},
+/* 1579 */ {19,92},
+/* 1580 */ {19,92},
+/* 1581 */ {19,92},
+/* 1582 */ {19,92},
+/* 1583 */ {19,92},
+/* 1584 */ {19,92},
+/* 1585 */ {19,92},
+/* 1586 */ {19,92},
+/* 1587 */ {19,92},
+/* 1588 */ {19,92},
+/* 1589 */ {19,92},
+/* 1590 */ {19,92},
+/* 1591 */ {19,92},
+/* 1592 */ {19,92},
+/* 1593 */ {19,92},
+/* 1594 */ {19,92},
+/* 1595 */ {19,92},
+/* 1596 */ {19,92},
+/* 1597 */ {19,92},
+/* 1598 */ {19,92},
+/* 1599 */ {19,92},
+/* 1600 */ {19,92},
+/* 1601 */ {19,92},
+/* 1602 */ {19,92},
+/* 1603 */ {19,92},
+/* 1604 */ {19,92},
+/* 1605 */ {19,92},
+/* 1606 */ {19,92},
+/* 1607 */ {19,92},
+/* 1608 */ {19,92},
+/* 1609 */ {19,92},
+/* 1610 */ {19,92},
+/* 1611 */ {19,92},
+/* 1612 */ {19,92},
+/* 1613 */ {19,92},
+/* 1614 */ {19,92},
+/* 1615 */ {19,92},
+/* 1616 */ {19,92},
+/* 1617 */ {19,92},
+/* 1618 */ {19,92},
+/* 1619 */ {19,92},
+/* 1620 */ {19,92},
+/* 1621 */ {19,92},
+/* 1622 */ {19,92},
+/* 1623 */ {19,92},
+/* 1624 */ {19,92},
+/* 1625 */ {19,92},
+/* 1626 */ {19,92},
+/* 1627 */ {19,92},
+/* 1628 */ {19,92},
+/* 1629 */ {19,92},
+/* 1630 */ {19,92},
+/* 1631 */ {19,92},
+/* 1632 */ {19,92},
+/* 1633 */ {19,92},
+/* 1634 */ {19,92},
+/* 1635 */ {19,92},
+/* 1636 */ {19,92},
+/* 1637 */ {19,92},
+/* 1638 */ {19,92},
+/* 1639 */ {19,92},
+/* 1640 */ {19,92},
+/* 1641 */ {19,92},
+/* 1642 */ {19,92},
+/* 1643 */ {19,92},
+/* 1644 */ {19,92},
+/* 1645 */ {19,92},
+/* 1646 */ {19,92},
+/* 1647 */ {19,92},
+/* 1648 */ {19,92},
+/* 1649 */ {19,92},
+/* 1650 */ {19,92},
+/* 1651 */ {19,92},
+/* 1652 */ {19,92},
+/* 1653 */ {19,92},
+/* 1654 */ {19,92},
+/* 1655 */ {19,92},
+/* 1656 */ {19,92},
+/* 1657 */ {19,92},
+/* 1658 */ {19,92},
+/* 1659 */ {19,92},
+/* 1660 */ {19,92},
+/* 1661 */ {19,92},
+/* 1662 */ {19,92},
+/* 1663 */ {19,92},
+/* 1664 */ {19,92},
+/* 1665 */ {19,92},
+/* 1666 */ {19,92},
+/* 1667 */ {19,92},
+/* 1668 */ {19,92},
+/* 1669 */ {19,92},
+/* 1670 */ {19,92},
+/* 1671 */ {19,92},
+/* 1672 */ {19,92},
+/* 1673 */ {19,92},
+/* 1674 */ {19,92},
+/* 1675 */ {19,92},
+/* 1676 */ {19,92},
+/* 1677 */ {19,92},
+/* 1678 */ {19,92},
+/* 1679 */ {19,92},
+/* 1680 */ {19,92},
+/* 1681 */ {19,92},
+/* 1682 */ {19,92},
+/* 1683 */ {19,92},
+/* 1684 */ {19,92},
+/* 1685 */ {19,92},
+/* 1686 */ {19,92},
+/* 1687 */ {19,92},
+/* 1688 */ {19,92},
+/* 1689 */ {19,92},
+/* 1690 */ {19,92},
+/* 1691 */ {19,92},
+/* 1692 */ {19,92},
+/* 1693 */ {19,92},
+/* 1694 */ {19,92},
+/* 1695 */ {19,92},
+/* 1696 */ {19,92},
+/* 1697 */ {19,92},
+/* 1698 */ {19,92},
+/* 1699 */ {19,92},
+/* 1700 */ {19,92},
+/* 1701 */ {19,92},
+/* 1702 */ {19,92},
+/* 1703 */ {19,92},
+/* 1704 */ {19,92},
+/* 1705 */ {19,92},
+/* 1706 */ {19,92},
+/* 1707 */ {19,92},
+/* 1708 */ {19,92},
+/* 1709 */ {19,92},
+/* 1710 */ {19,92},
+/* 1711 */ {19,92},
+/* 1712 */ {19,92},
+/* 1713 */ {19,92},
+/* 1714 */ {19,92},
+/* 1715 */ {19,92},
+/* 1716 */ {19,92},
+/* 1717 */ {19,92},
+/* 1718 */ {19,92},
+/* 1719 */ {19,92},
+/* 1720 */ {19,92},
+/* 1721 */ {19,92},
+/* 1722 */ {19,92},
+/* 1723 */ {19,92},
+/* 1724 */ {19,92},
+/* 1725 */ {19,92},
+/* 1726 */ {19,92},
+/* 1727 */ {19,92},
+/* 1728 */ {19,92},
+/* 1729 */ {19,92},
+/* 1730 */ {19,92},
+/* 1731 */ {19,92},
+/* 1732 */ {19,92},
+/* 1733 */ {19,92},
+/* 1734 */ {19,92},
+/* 1735 */ {19,92},
+/* 1736 */ {19,92},
+/* 1737 */ {19,92},
+/* 1738 */ {19,92},
+/* 1739 */ {19,92},
+/* 1740 */ {19,92},
+/* 1741 */ {19,92},
+/* 1742 */ {19,92},
+/* 1743 */ {19,92},
+/* 1744 */ {19,92},
+/* 1745 */ {19,92},
+/* 1746 */ {19,92},
+/* 1747 */ {19,92},
+/* 1748 */ {19,92},
+/* 1749 */ {19,92},
+/* 1750 */ {19,92},
+/* 1751 */ {19,92},
+/* 1752 */ {19,92},
+/* 1753 */ {19,92},
+/* 1754 */ {19,92},
+/* 1755 */ {19,92},
+/* 1756 */ {19,92},
+/* 1757 */ {19,92},
+/* 1758 */ {19,92},
+/* 1759 */ {19,92},
+/* 1760 */ {19,92},
+/* 1761 */ {19,92},
+/* 1762 */ {19,92},
+/* 1763 */ {19,92},
+/* 1764 */ {19,92},
+/* 1765 */ {19,92},
+/* 1766 */ {19,92},
+/* 1767 */ {19,92},
+/* 1768 */ {19,92},
+/* 1769 */ {19,92},
+/* 1770 */ {19,92},
+/* 1771 */ {19,92},
+/* 1772 */ {19,92},
+/* 1773 */ {19,92},
+/* 1774 */ {19,92},
+/* 1775 */ {19,92},
+/* 1776 */ {19,92},
+/* 1777 */ {19,92},
+/* 1778 */ {19,92},
+/* 1779 */ {19,92},
+/* 1780 */ {19,92},
+/* 1781 */ {19,92},
+/* 1782 */ {19,92},
+/* 1783 */ {19,92},
+/* 1784 */ {19,92},
+/* 1785 */ {19,92},
+/* 1786 */ {19,92},
+/* 1787 */ {19,92},
+/* 1788 */ {19,92},
+/* 1789 */ {19,92},
+/* 1790 */ {19,92},
+/* 1791 */ {19,92},
+/* 1792 */ {19,92},
+/* 1793 */ {19,92},
+/* 1794 */ {19,92},
+/* 1795 */ {19,92},
+/* 1796 */ {19,92},
+/* 1797 */ {19,92},
+/* 1798 */ {19,92},
+/* 1799 */ {19,92},
+/* 1800 */ {19,92},
+/* 1801 */ {19,92},
+/* 1802 */ {19,92},
+/* 1803 */ {19,92},
+/* 1804 */ {19,92},
+/* 1805 */ {19,92},
+/* 1806 */ {19,92},
+/* 1807 */ {19,92},
+/* 1808 */ {19,92},
+/* 1809 */ {19,92},
+/* 1810 */ {19,92},
+/* 1811 */ {19,92},
+/* 1812 */ {19,92},
+/* 1813 */ {19,92},
+/* 1814 */ {19,92},
+/* 1815 */ {19,92},
+/* 1816 */ {19,92},
+/* 1817 */ {19,92},
+/* 1818 */ {19,92},
+/* 1819 */ {19,92},
+/* 1820 */ {19,92},
+/* 1821 */ {19,92},
+/* 1822 */ {19,92},
+/* 1823 */ {19,92},
+/* 1824 */ {19,92},
+/* 1825 */ {19,92},
+/* 1826 */ {19,92},
+/* 1827 */ {19,92},
+/* 1828 */ {19,92},
+/* 1829 */ {19,92},
+/* 1830 */ {19,92},
+/* 1831 */ {19,92},
+/* 1832 */ {19,92},
+/* 1833 */ {19,92},
+/* 1834 */ {19,92},
+/* 1835 */ {19,92},
+/* 1836 */ {19,92},
+/* 1837 */ {19,92},
+/* 1838 */ {19,92},
+/* 1839 */ {19,92},
+/* 1840 */ {19,92},
+/* 1841 */ {19,92},
+/* 1842 */ {19,92},
+/* 1843 */ {19,92},
+/* 1844 */ {19,92},
+/* 1845 */ {19,92},
+/* 1846 */ {19,92},
+/* 1847 */ {19,92},
+/* 1848 */ {19,92},
+/* 1849 */ {19,92},
+/* 1850 */ {19,92},
+/* 1851 */ {19,92},
+/* 1852 */ {19,92},
+/* 1853 */ {19,92},
+/* 1854 */ {19,92},
+/* 1855 */ {19,92},
+/* 1856 */ {19,92},
+/* 1857 */ {19,92},
+/* 1858 */ {19,92},
+/* 1859 */ {19,92},
+/* 1860 */ {19,92},
+/* 1861 */ {19,92},
+/* 1862 */ {19,92},
+/* 1863 */ {19,92},
+/* 1864 */ {19,92},
+/* 1865 */ {19,92},
+/* 1866 */ {19,92},
+/* 1867 */ {19,92},
+/* 1868 */ {19,92},
+/* 1869 */ {19,92},
+/* 1870 */ {19,92},
+/* 1871 */ {19,92},
+/* 1872 */ {19,92},
+/* 1873 */ {19,92},
+/* 1874 */ {19,92},
+/* 1875 */ {19,92},
+/* 1876 */ {19,92},
+/* 1877 */ {19,92},
+/* 1878 */ {19,92},
+/* 1879 */ {19,92},
+/* 1880 */ {19,92},
+/* 1881 */ {19,92},
+/* 1882 */ {19,92},
+/* 1883 */ {19,92},
+/* 1884 */ {19,92},
+/* 1885 */ {19,92},
+/* 1886 */ {19,92},
+/* 1887 */ {19,92},
+/* 1888 */ {19,92},
+/* 1889 */ {19,92},
+/* 1890 */ {19,92},
+/* 1891 */ {19,92},
+/* 1892 */ {19,92},
+/* 1893 */ {19,92},
+/* 1894 */ {19,92},
+/* 1895 */ {19,92},
+/* 1896 */ {19,92},
+/* 1897 */ {19,92},
+/* 1898 */ {19,92},
+/* 1899 */ {19,92},
+/* 1900 */ {19,92},
+/* 1901 */ {19,92},
+/* 1902 */ {19,92},
+/* 1903 */ {19,92},
+/* 1904 */ {19,92},
+/* 1905 */ {19,92},
+/* 1906 */ {19,92},
+/* 1907 */ {19,92},
+/* 1908 */ {19,92},
+/* 1909 */ {19,92},
+/* 1910 */ {19,92},
+/* 1911 */ {19,92},
+/* 1912 */ {19,92},
+/* 1913 */ {19,92},
+/* 1914 */ {19,92},
+/* 1915 */ {19,92},
+/* 1916 */ {19,92},
+/* 1917 */ {19,92},
+/* 1918 */ {19,92},
+/* 1919 */ {19,92},
+/* 1920 */ {19,92},
+/* 1921 */ {19,92},
+/* 1922 */ {19,92},
+/* 1923 */ {19,92},
+/* 1924 */ {19,92},
+/* 1925 */ {19,92},
+/* 1926 */ {19,92},
+/* 1927 */ {19,92},
+/* 1928 */ {19,92},
+/* 1929 */ {19,92},
+/* 1930 */ {19,92},
+/* 1931 */ {19,92},
+/* 1932 */ {19,92},
+/* 1933 */ {19,92},
+/* 1934 */ {19,92},
+/* 1935 */ {19,92},
+/* 1936 */ {19,92},
+/* 1937 */ {19,92},
+/* 1938 */ {19,92},
+/* 1939 */ {19,92},
+/* 1940 */ {19,92},
+/* 1941 */ {19,92},
+/* 1942 */ {19,92},
+/* 1943 */ {19,92},
+/* 1944 */ {19,92},
+/* 1945 */ {19,92},
+/* 1946 */ {19,92},
+/* 1947 */ {19,92},
+/* 1948 */ {19,92},
+/* 1949 */ {19,92},
+/* 1950 */ {19,92},
+/* 1951 */ {19,92},
+/* 1952 */ {19,92},
+/* 1953 */ {19,92},
+/* 1954 */ {19,92},
+/* 1955 */ {19,92},
+/* 1956 */ {19,92},
+/* 1957 */ {19,92},
+/* 1958 */ {19,92},
+/* 1959 */ {19,92},
+/* 1960 */ {19,92},
+/* 1961 */ {19,92},
+/* 1962 */ {19,92},
+/* 1963 */ {19,92},
+/* 1964 */ {19,92},
+/* 1965 */ {19,92},
+/* 1966 */ {19,92},
+/* 1967 */ {19,92},
+/* 1968 */ {19,92},
+/* 1969 */ {19,92},
+/* 1970 */ {19,92},
+/* 1971 */ {19,92},
+/* 1972 */ {19,92},
+/* 1973 */ {19,92},
+/* 1974 */ {19,92},
+/* 1975 */ {19,92},
+/* 1976 */ {19,92},
+/* 1977 */ {19,92},
+/* 1978 */ {19,92},
+/* 1979 */ {19,92},
+/* 1980 */ {19,92},
+/* 1981 */ {19,92},
+/* 1982 */ {19,92},
+/* 1983 */ {19,92},
+/* 1984 */ {19,92},
+/* 1985 */ {19,92},
+/* 1986 */ {19,92},
+/* 1987 */ {19,92},
+/* 1988 */ {19,92},
+/* 1989 */ {19,92},
+/* 1990 */ {19,92},
+/* 1991 */ {19,92},
+/* 1992 */ {19,92},
+/* 1993 */ {19,92},
+/* 1994 */ {19,92},
+/* 1995 */ {19,92},
+/* 1996 */ {19,92},
+/* 1997 */ {19,92},
+/* 1998 */ {19,92},
+/* 1999 */ {19,92},
+/* 2000 */ {19,92},
+/* 2001 */ {19,92},
+/* 2002 */ {19,92},
+/* 2003 */ {19,92},
+/* 2004 */ {19,92},
+/* 2005 */ {19,92},
+/* 2006 */ {19,92},
+/* 2007 */ {19,92},
+/* 2008 */ {19,92},
+/* 2009 */ {19,92},
+/* 2010 */ {19,92},
+/* 2011 */ {19,92},
+/* 2012 */ {19,92},
+/* 2013 */ {19,92},
+/* 2014 */ {19,92},
+/* 2015 */ {19,92},
+/* 2016 */ {19,92},
+/* 2017 */ {19,92},
+/* 2018 */ {19,92},
+/* 2019 */ {19,92},
+/* 2020 */ {19,92},
+/* 2021 */ {19,92},
+/* 2022 */ {19,92},
+/* 2023 */ {19,92},
+/* 2024 */ {19,92},
+/* 2025 */ {19,92},
+/* 2026 */ {19,92},
+/* 2027 */ {19,92},
+/* 2028 */ {19,92},
+/* 2029 */ {19,92},
+/* 2030 */ {19,92},
+/* 2031 */ {19,92},
+/* 2032 */ {19,92},
+/* 2033 */ {19,92},
+/* 2034 */ {19,92},
+/* 2035 */ {19,92},
+/* 2036 */ {19,92},
+/* 2037 */ {19,92},
+/* 2038 */ {19,92},
+/* 2039 */ {19,92},
+/* 2040 */ {19,92},
+/* 2041 */ {19,92},
+/* 2042 */ {19,92},
+/* 2043 */ {19,92},
+/* 2044 */ {19,92},
+/* 2045 */ {19,92},
+/* 2046 */ {19,92},
+/* 2047 */ {19,92},
+/* 2048 */ {19,195},
+/* 2049 */ {19,195},
+/* 2050 */ {19,195},
+/* 2051 */ {19,195},
+/* 2052 */ {19,195},
+/* 2053 */ {19,195},
+/* 2054 */ {19,195},
+/* 2055 */ {19,195},
+/* 2056 */ {19,195},
+/* 2057 */ {19,195},
+/* 2058 */ {19,195},
+/* 2059 */ {19,195},
+/* 2060 */ {19,195},
+/* 2061 */ {19,195},
+/* 2062 */ {19,195},
+/* 2063 */ {19,195},
+/* 2064 */ {19,195},
+/* 2065 */ {19,195},
+/* 2066 */ {19,195},
+/* 2067 */ {19,195},
+/* 2068 */ {19,195},
+/* 2069 */ {19,195},
+/* 2070 */ {19,195},
+/* 2071 */ {19,195},
+/* 2072 */ {19,195},
+/* 2073 */ {19,195},
+/* 2074 */ {19,195},
+/* 2075 */ {19,195},
+/* 2076 */ {19,195},
+/* 2077 */ {19,195},
+/* 2078 */ {19,195},
+/* 2079 */ {19,195},
+/* 2080 */ {19,195},
+/* 2081 */ {19,195},
+/* 2082 */ {19,195},
+/* 2083 */ {19,195},
+/* 2084 */ {19,195},
+/* 2085 */ {19,195},
+/* 2086 */ {19,195},
+/* 2087 */ {19,195},
+/* 2088 */ {19,195},
+/* 2089 */ {19,195},
+/* 2090 */ {19,195},
+/* 2091 */ {19,195},
+/* 2092 */ {19,195},
+/* 2093 */ {19,195},
+/* 2094 */ {19,195},
+/* 2095 */ {19,195},
+/* 2096 */ {19,195},
+/* 2097 */ {19,195},
+/* 2098 */ {19,195},
+/* 2099 */ {19,195},
+/* 2100 */ {19,195},
+/* 2101 */ {19,195},
+/* 2102 */ {19,195},
+/* 2103 */ {19,195},
+/* 2104 */ {19,195},
+/* 2105 */ {19,195},
+/* 2106 */ {19,195},
+/* 2107 */ {19,195},
+/* 2108 */ {19,195},
+/* 2109 */ {19,195},
+/* 2110 */ {19,195},
+/* 2111 */ {19,195},
+/* 2112 */ {19,195},
+/* 2113 */ {19,195},
+/* 2114 */ {19,195},
+/* 2115 */ {19,195},
+/* 2116 */ {19,195},
+/* 2117 */ {19,195},
+/* 2118 */ {19,195},
+/* 2119 */ {19,195},
+/* 2120 */ {19,195},
+/* 2121 */ {19,195},
+/* 2122 */ {19,195},
+/* 2123 */ {19,195},
+/* 2124 */ {19,195},
+/* 2125 */ {19,195},
+/* 2126 */ {19,195},
+/* 2127 */ {19,195},
+/* 2128 */ {19,195},
+/* 2129 */ {19,195},
+/* 2130 */ {19,195},
+/* 2131 */ {19,195},
+/* 2132 */ {19,195},
+/* 2133 */ {19,195},
+/* 2134 */ {19,195},
+/* 2135 */ {19,195},
+/* 2136 */ {19,195},
+/* 2137 */ {19,195},
+/* 2138 */ {19,195},
+/* 2139 */ {19,195},
+/* 2140 */ {19,195},
+/* 2141 */ {19,195},
+/* 2142 */ {19,195},
+/* 2143 */ {19,195},
+/* 2144 */ {19,195},
+/* 2145 */ {19,195},
+/* 2146 */ {19,195},
+/* 2147 */ {19,195},
+/* 2148 */ {19,195},
+/* 2149 */ {19,195},
+/* 2150 */ {19,195},
+/* 2151 */ {19,195},
+/* 2152 */ {19,195},
+/* 2153 */ {19,195},
+/* 2154 */ {19,195},
+/* 2155 */ {19,195},
+/* 2156 */ {19,195},
+/* 2157 */ {19,195},
+/* 2158 */ {19,195},
+/* 2159 */ {19,195},
+/* 2160 */ {19,195},
+/* 2161 */ {19,195},
+/* 2162 */ {19,195},
+/* 2163 */ {19,195},
+/* 2164 */ {19,195},
+/* 2165 */ {19,195},
+/* 2166 */ {19,195},
+/* 2167 */ {19,195},
+/* 2168 */ {19,195},
+/* 2169 */ {19,195},
+/* 2170 */ {19,195},
+/* 2171 */ {19,195},
+/* 2172 */ {19,195},
+/* 2173 */ {19,195},
+/* 2174 */ {19,195},
+/* 2175 */ {19,195},
+/* 2176 */ {19,195},
+/* 2177 */ {19,195},
+/* 2178 */ {19,195},
+/* 2179 */ {19,195},
+/* 2180 */ {19,195},
+/* 2181 */ {19,195},
+/* 2182 */ {19,195},
+/* 2183 */ {19,195},
+/* 2184 */ {19,195},
+/* 2185 */ {19,195},
+/* 2186 */ {19,195},
+/* 2187 */ {19,195},
+/* 2188 */ {19,195},
+/* 2189 */ {19,195},
+/* 2190 */ {19,195},
+/* 2191 */ {19,195},
+/* 2192 */ {19,195},
+/* 2193 */ {19,195},
+/* 2194 */ {19,195},
+/* 2195 */ {19,195},
+/* 2196 */ {19,195},
+/* 2197 */ {19,195},
+/* 2198 */ {19,195},
+/* 2199 */ {19,195},
+/* 2200 */ {19,195},
+/* 2201 */ {19,195},
+/* 2202 */ {19,195},
+/* 2203 */ {19,195},
+/* 2204 */ {19,195},
+/* 2205 */ {19,195},
+/* 2206 */ {19,195},
+/* 2207 */ {19,195},
+/* 2208 */ {19,195},
+/* 2209 */ {19,195},
+/* 2210 */ {19,195},
+/* 2211 */ {19,195},
+/* 2212 */ {19,195},
+/* 2213 */ {19,195},
+/* 2214 */ {19,195},
+/* 2215 */ {19,195},
+/* 2216 */ {19,195},
+/* 2217 */ {19,195},
+/* 2218 */ {19,195},
+/* 2219 */ {19,195},
+/* 2220 */ {19,195},
+/* 2221 */ {19,195},
+/* 2222 */ {19,195},
+/* 2223 */ {19,195},
+/* 2224 */ {19,195},
+/* 2225 */ {19,195},
+/* 2226 */ {19,195},
+/* 2227 */ {19,195},
+/* 2228 */ {19,195},
+/* 2229 */ {19,195},
+/* 2230 */ {19,195},
+/* 2231 */ {19,195},
+/* 2232 */ {19,195},
+/* 2233 */ {19,195},
+/* 2234 */ {19,195},
+/* 2235 */ {19,195},
+/* 2236 */ {19,195},
+/* 2237 */ {19,195},
+/* 2238 */ {19,195},
+/* 2239 */ {19,195},
+/* 2240 */ {19,195},
+/* 2241 */ {19,195},
+/* 2242 */ {19,195},
+/* 2243 */ {19,195},
+/* 2244 */ {19,195},
+/* 2245 */ {19,195},
+/* 2246 */ {19,195},
+/* 2247 */ {19,195},
+/* 2248 */ {19,195},
+/* 2249 */ {19,195},
+/* 2250 */ {19,195},
+/* 2251 */ {19,195},
+/* 2252 */ {19,195},
+/* 2253 */ {19,195},
+/* 2254 */ {19,195},
+/* 2255 */ {19,195},
+/* 2256 */ {19,195},
+/* 2257 */ {19,195},
+/* 2258 */ {19,195},
+/* 2259 */ {19,195},
+/* 2260 */ {19,195},
+/* 2261 */ {19,195},
+/* 2262 */ {19,195},
+/* 2263 */ {19,195},
+/* 2264 */ {19,195},
+/* 2265 */ {19,195},
+/* 2266 */ {19,195},
+/* 2267 */ {19,195},
+/* 2268 */ {19,195},
+/* 2269 */ {19,195},
+/* 2270 */ {19,195},
+/* 2271 */ {19,195},
+/* 2272 */ {19,195},
+/* 2273 */ {19,195},
+/* 2274 */ {19,195},
+/* 2275 */ {19,195},
+/* 2276 */ {19,195},
+/* 2277 */ {19,195},
+/* 2278 */ {19,195},
+/* 2279 */ {19,195},
+/* 2280 */ {19,195},
+/* 2281 */ {19,195},
+/* 2282 */ {19,195},
+/* 2283 */ {19,195},
+/* 2284 */ {19,195},
+/* 2285 */ {19,195},
+/* 2286 */ {19,195},
+/* 2287 */ {19,195},
+/* 2288 */ {19,195},
+/* 2289 */ {19,195},
+/* 2290 */ {19,195},
+/* 2291 */ {19,195},
+/* 2292 */ {19,195},
+/* 2293 */ {19,195},
+/* 2294 */ {19,195},
+/* 2295 */ {19,195},
+/* 2296 */ {19,195},
+/* 2297 */ {19,195},
+/* 2298 */ {19,195},
+/* 2299 */ {19,195},
+/* 2300 */ {19,195},
+/* 2301 */ {19,195},
+/* 2302 */ {19,195},
+/* 2303 */ {19,195},
+/* 2304 */ {19,195},
+/* 2305 */ {19,195},
+/* 2306 */ {19,195},
+/* 2307 */ {19,195},
+/* 2308 */ {19,195},
+/* 2309 */ {19,195},
+/* 2310 */ {19,195},
+/* 2311 */ {19,195},
+/* 2312 */ {19,195},
+/* 2313 */ {19,195},
+/* 2314 */ {19,195},
+/* 2315 */ {19,195},
+/* 2316 */ {19,195},
+/* 2317 */ {19,195},
+/* 2318 */ {19,195},
+/* 2319 */ {19,195},
+/* 2320 */ {19,195},
+/* 2321 */ {19,195},
+/* 2322 */ {19,195},
+/* 2323 */ {19,195},
+/* 2324 */ {19,195},
+/* 2325 */ {19,195},
+/* 2326 */ {19,195},
+/* 2327 */ {19,195},
+/* 2328 */ {19,195},
+/* 2329 */ {19,195},
+/* 2330 */ {19,195},
+/* 2331 */ {19,195},
+/* 2332 */ {19,195},
+/* 2333 */ {19,195},
+/* 2334 */ {19,195},
+/* 2335 */ {19,195},
+/* 2336 */ {19,195},
+/* 2337 */ {19,195},
+/* 2338 */ {19,195},
+/* 2339 */ {19,195},
+/* 2340 */ {19,195},
+/* 2341 */ {19,195},
+/* 2342 */ {19,195},
+/* 2343 */ {19,195},
+/* 2344 */ {19,195},
+/* 2345 */ {19,195},
+/* 2346 */ {19,195},
+/* 2347 */ {19,195},
+/* 2348 */ {19,195},
+/* 2349 */ {19,195},
+/* 2350 */ {19,195},
+/* 2351 */ {19,195},
+/* 2352 */ {19,195},
+/* 2353 */ {19,195},
+/* 2354 */ {19,195},
+/* 2355 */ {19,195},
+/* 2356 */ {19,195},
+/* 2357 */ {19,195},
+/* 2358 */ {19,195},
+/* 2359 */ {19,195},
+/* 2360 */ {19,195},
+/* 2361 */ {19,195},
+/* 2362 */ {19,195},
+/* 2363 */ {19,195},
+/* 2364 */ {19,195},
+/* 2365 */ {19,195},
+/* 2366 */ {19,195},
+/* 2367 */ {19,195},
+/* 2368 */ {19,195},
+/* 2369 */ {19,195},
+/* 2370 */ {19,195},
+/* 2371 */ {19,195},
+/* 2372 */ {19,195},
+/* 2373 */ {19,195},
+/* 2374 */ {19,195},
+/* 2375 */ {19,195},
+/* 2376 */ {19,195},
+/* 2377 */ {19,195},
+/* 2378 */ {19,195},
+/* 2379 */ {19,195},
+/* 2380 */ {19,195},
+/* 2381 */ {19,195},
+/* 2382 */ {19,195},
+/* 2383 */ {19,195},
+/* 2384 */ {19,195},
+/* 2385 */ {19,195},
+/* 2386 */ {19,195},
+/* 2387 */ {19,195},
+/* 2388 */ {19,195},
+/* 2389 */ {19,195},
+/* 2390 */ {19,195},
+/* 2391 */ {19,195},
+/* 2392 */ {19,195},
+/* 2393 */ {19,195},
+/* 2394 */ {19,195},
+/* 2395 */ {19,195},
+/* 2396 */ {19,195},
+/* 2397 */ {19,195},
+/* 2398 */ {19,195},
+/* 2399 */ {19,195},
+/* 2400 */ {19,195},
+/* 2401 */ {19,195},
+/* 2402 */ {19,195},
+/* 2403 */ {19,195},
+/* 2404 */ {19,195},
+/* 2405 */ {19,195},
+/* 2406 */ {19,195},
+/* 2407 */ {19,195},
+/* 2408 */ {19,195},
+/* 2409 */ {19,195},
+/* 2410 */ {19,195},
+/* 2411 */ {19,195},
+/* 2412 */ {19,195},
+/* 2413 */ {19,195},
+/* 2414 */ {19,195},
+/* 2415 */ {19,195},
+/* 2416 */ {19,195},
+/* 2417 */ {19,195},
+/* 2418 */ {19,195},
+/* 2419 */ {19,195},
+/* 2420 */ {19,195},
+/* 2421 */ {19,195},
+/* 2422 */ {19,195},
+/* 2423 */ {19,195},
+/* 2424 */ {19,195},
+/* 2425 */ {19,195},
+/* 2426 */ {19,195},
+/* 2427 */ {19,195},
+/* 2428 */ {19,195},
+/* 2429 */ {19,195},
+/* 2430 */ {19,195},
+/* 2431 */ {19,195},
+/* 2432 */ {19,195},
+/* 2433 */ {19,195},
+/* 2434 */ {19,195},
+/* 2435 */ {19,195},
+/* 2436 */ {19,195},
+/* 2437 */ {19,195},
+/* 2438 */ {19,195},
+/* 2439 */ {19,195},
+/* 2440 */ {19,195},
+/* 2441 */ {19,195},
+/* 2442 */ {19,195},
+/* 2443 */ {19,195},
+/* 2444 */ {19,195},
+/* 2445 */ {19,195},
+/* 2446 */ {19,195},
+/* 2447 */ {19,195},
+/* 2448 */ {19,195},
+/* 2449 */ {19,195},
+/* 2450 */ {19,195},
+/* 2451 */ {19,195},
+/* 2452 */ {19,195},
+/* 2453 */ {19,195},
+/* 2454 */ {19,195},
+/* 2455 */ {19,195},
+/* 2456 */ {19,195},
+/* 2457 */ {19,195},
+/* 2458 */ {19,195},
+/* 2459 */ {19,195},
+/* 2460 */ {19,195},
+/* 2461 */ {19,195},
+/* 2462 */ {19,195},
+/* 2463 */ {19,195},
+/* 2464 */ {19,195},
+/* 2465 */ {19,195},
+/* 2466 */ {19,195},
+/* 2467 */ {19,195},
+/* 2468 */ {19,195},
+/* 2469 */ {19,195},
+/* 2470 */ {19,195},
+/* 2471 */ {19,195},
+/* 2472 */ {19,195},
+/* 2473 */ {19,195},
+/* 2474 */ {19,195},
+/* 2475 */ {19,195},
+/* 2476 */ {19,195},
+/* 2477 */ {19,195},
+/* 2478 */ {19,195},
+/* 2479 */ {19,195},
+/* 2480 */ {19,195},
+/* 2481 */ {19,195},
+/* 2482 */ {19,195},
+/* 2483 */ {19,195},
+/* 2484 */ {19,195},
+/* 2485 */ {19,195},
+/* 2486 */ {19,195},
+/* 2487 */ {19,195},
+/* 2488 */ {19,195},
+/* 2489 */ {19,195},
+/* 2490 */ {19,195},
+/* 2491 */ {19,195},
+/* 2492 */ {19,195},
+/* 2493 */ {19,195},
+/* 2494 */ {19,195},
+/* 2495 */ {19,195},
+/* 2496 */ {19,195},
+/* 2497 */ {19,195},
+/* 2498 */ {19,195},
+/* 2499 */ {19,195},
+/* 2500 */ {19,195},
+/* 2501 */ {19,195},
+/* 2502 */ {19,195},
+/* 2503 */ {19,195},
+/* 2504 */ {19,195},
+/* 2505 */ {19,195},
+/* 2506 */ {19,195},
+/* 2507 */ {19,195},
+/* 2508 */ {19,195},
+/* 2509 */ {19,195},
+/* 2510 */ {19,195},
+/* 2511 */ {19,195},
+/* 2512 */ {19,195},
+/* 2513 */ {19,195},
+/* 2514 */ {19,195},
+/* 2515 */ {19,195},
+/* 2516 */ {19,195},
+/* 2517 */ {19,195},
+/* 2518 */ {19,195},
+/* 2519 */ {19,195},
+/* 2520 */ {19,195},
+/* 2521 */ {19,195},
+/* 2522 */ {19,195},
+/* 2523 */ {19,195},
+/* 2524 */ {19,195},
+/* 2525 */ {19,195},
+/* 2526 */ {19,195},
+/* 2527 */ {19,195},
+/* 2528 */ {19,195},
+/* 2529 */ {19,195},
+/* 2530 */ {19,195},
+/* 2531 */ {19,195},
+/* 2532 */ {19,195},
+/* 2533 */ {19,195},
+/* 2534 */ {19,195},
+/* 2535 */ {19,195},
+/* 2536 */ {19,195},
+/* 2537 */ {19,195},
+/* 2538 */ {19,195},
+/* 2539 */ {19,195},
+/* 2540 */ {19,195},
+/* 2541 */ {19,195},
+/* 2542 */ {19,195},
+/* 2543 */ {19,195},
+/* 2544 */ {19,195},
+/* 2545 */ {19,195},
+/* 2546 */ {19,195},
+/* 2547 */ {19,195},
+/* 2548 */ {19,195},
+/* 2549 */ {19,195},
+/* 2550 */ {19,195},
+/* 2551 */ {19,195},
+/* 2552 */ {19,195},
+/* 2553 */ {19,195},
+/* 2554 */ {19,195},
+/* 2555 */ {19,195},
+/* 2556 */ {19,195},
+/* 2557 */ {19,195},
+/* 2558 */ {19,195},
+/* 2559 */ {19,195},
+/* 2560 */ {19,195},
+/* 2561 */ {19,195},
+/* 2562 */ {19,195},
+/* 2563 */ {19,195},
+/* 2564 */ {19,195},
+/* 2565 */ {19,195},
+/* 2566 */ {19,195},
+/* 2567 */ {19,195},
+/* 2568 */ {19,195},
+/* 2569 */ {19,195},
+/* 2570 */ {19,195},
+/* 2571 */ {19,195},
+/* 2572 */ {19,195},
+/* 2573 */ {19,195},
+/* 2574 */ {19,195},
+/* 2575 */ {19,195},
+/* 2576 */ {19,195},
+/* 2577 */ {19,195},
+/* 2578 */ {19,195},
+/* 2579 */ {19,195},
+/* 2580 */ {19,195},
+/* 2581 */ {19,195},
+/* 2582 */ {19,195},
+/* 2583 */ {19,195},
+/* 2584 */ {19,195},
+/* 2585 */ {19,195},
+/* 2586 */ {19,195},
+/* 2587 */ {19,195},
+/* 2588 */ {19,195},
+/* 2589 */ {19,195},
+/* 2590 */ {19,195},
+/* 2591 */ {19,195},
+/* 2592 */ {19,195},
+/* 2593 */ {19,195},
+/* 2594 */ {19,195},
+/* 2595 */ {19,195},
+/* 2596 */ {19,195},
+/* 2597 */ {19,195},
+/* 2598 */ {19,195},
+/* 2599 */ {19,195},
+/* 2600 */ {19,195},
+/* 2601 */ {19,195},
+/* 2602 */ {19,195},
+/* 2603 */ {19,195},
+/* 2604 */ {19,195},
+/* 2605 */ {19,195},
+/* 2606 */ {19,195},
+/* 2607 */ {19,195},
+/* 2608 */ {19,195},
+/* 2609 */ {19,195},
+/* 2610 */ {19,195},
+/* 2611 */ {19,195},
+/* 2612 */ {19,195},
+/* 2613 */ {19,195},
+/* 2614 */ {19,195},
+/* 2615 */ {19,195},
+/* 2616 */ {19,195},
+/* 2617 */ {19,195},
+/* 2618 */ {19,195},
+/* 2619 */ {19,195},
+/* 2620 */ {19,195},
+/* 2621 */ {19,195},
+/* 2622 */ {19,195},
+/* 2623 */ {19,195},
+/* 2624 */ {19,195},
+/* 2625 */ {19,195},
+/* 2626 */ {19,195},
+/* 2627 */ {19,195},
+/* 2628 */ {19,195},
+/* 2629 */ {19,195},
+/* 2630 */ {19,195},
+/* 2631 */ {19,195},
+/* 2632 */ {19,195},
+/* 2633 */ {19,195},
+/* 2634 */ {19,195},
+/* 2635 */ {19,195},
+/* 2636 */ {19,195},
+/* 2637 */ {19,195},
+/* 2638 */ {19,195},
+/* 2639 */ {19,195},
+/* 2640 */ {19,195},
+/* 2641 */ {19,195},
+/* 2642 */ {19,195},
+/* 2643 */ {19,195},
+/* 2644 */ {19,195},
+/* 2645 */ {19,195},
+/* 2646 */ {19,195},
+/* 2647 */ {19,195},
+/* 2648 */ {19,195},
+/* 2649 */ {19,195},
+/* 2650 */ {19,195},
+/* 2651 */ {19,195},
+/* 2652 */ {19,195},
+/* 2653 */ {19,195},
+/* 2654 */ {19,195},
+/* 2655 */ {19,195},
+/* 2656 */ {19,195},
+/* 2657 */ {19,195},
+/* 2658 */ {19,195},
+/* 2659 */ {19,195},
+/* 2660 */ {19,195},
+/* 2661 */ {19,195},
+/* 2662 */ {19,195},
+/* 2663 */ {19,195},
+/* 2664 */ {19,195},
+/* 2665 */ {19,195},
+/* 2666 */ {19,195},
+/* 2667 */ {19,195},
+/* 2668 */ {19,195},
+/* 2669 */ {19,195},
+/* 2670 */ {19,195},
+/* 2671 */ {19,195},
+/* 2672 */ {19,195},
+/* 2673 */ {19,195},
+/* 2674 */ {19,195},
+/* 2675 */ {19,195},
+/* 2676 */ {19,195},
+/* 2677 */ {19,195},
+/* 2678 */ {19,195},
+/* 2679 */ {19,195},
+/* 2680 */ {19,195},
+/* 2681 */ {19,195},
+/* 2682 */ {19,195},
+/* 2683 */ {19,195},
+/* 2684 */ {19,195},
+/* 2685 */ {19,195},
+/* 2686 */ {19,195},
+/* 2687 */ {19,195},
+/* 2688 */ {19,195},
+/* 2689 */ {19,195},
+/* 2690 */ {19,195},
+/* 2691 */ {19,195},
+/* 2692 */ {19,195},
+/* 2693 */ {19,195},
+/* 2694 */ {19,195},
+/* 2695 */ {19,195},
+/* 2696 */ {19,195},
+/* 2697 */ {19,195},
+/* 2698 */ {19,195},
+/* 2699 */ {19,195},
+/* 2700 */ {19,195},
+/* 2701 */ {19,195},
+/* 2702 */ {19,195},
+/* 2703 */ {19,195},
+/* 2704 */ {19,195},
+/* 2705 */ {19,195},
+/* 2706 */ {19,195},
+/* 2707 */ {19,195},
+/* 2708 */ {19,195},
+/* 2709 */ {19,195},
+/* 2710 */ {19,195},
+/* 2711 */ {19,195},
+/* 2712 */ {19,195},
+/* 2713 */ {19,195},
+/* 2714 */ {19,195},
+/* 2715 */ {19,195},
+/* 2716 */ {19,195},
+/* 2717 */ {19,195},
+/* 2718 */ {19,195},
+/* 2719 */ {19,195},
+/* 2720 */ {19,195},
+/* 2721 */ {19,195},
+/* 2722 */ {19,195},
+/* 2723 */ {19,195},
+/* 2724 */ {19,195},
+/* 2725 */ {19,195},
+/* 2726 */ {19,195},
+/* 2727 */ {19,195},
+/* 2728 */ {19,195},
+/* 2729 */ {19,195},
+/* 2730 */ {19,195},
+/* 2731 */ {19,195},
+/* 2732 */ {19,195},
+/* 2733 */ {19,195},
+/* 2734 */ {19,195},
+/* 2735 */ {19,195},
+/* 2736 */ {19,195},
+/* 2737 */ {19,195},
+/* 2738 */ {19,195},
+/* 2739 */ {19,195},
+/* 2740 */ {19,195},
+/* 2741 */ {19,195},
+/* 2742 */ {19,195},
+/* 2743 */ {19,195},
+/* 2744 */ {19,195},
+/* 2745 */ {19,195},
+/* 2746 */ {19,195},
+/* 2747 */ {19,195},
+/* 2748 */ {19,195},
+/* 2749 */ {19,195},
+/* 2750 */ {19,195},
+/* 2751 */ {19,195},
+/* 2752 */ {19,195},
+/* 2753 */ {19,195},
+/* 2754 */ {19,195},
+/* 2755 */ {19,195},
+/* 2756 */ {19,195},
+/* 2757 */ {19,195},
+/* 2758 */ {19,195},
+/* 2759 */ {19,195},
+/* 2760 */ {19,195},
+/* 2761 */ {19,195},
+/* 2762 */ {19,195},
+/* 2763 */ {19,195},
+/* 2764 */ {19,195},
+/* 2765 */ {19,195},
+/* 2766 */ {19,195},
+/* 2767 */ {19,195},
+/* 2768 */ {19,195},
+/* 2769 */ {19,195},
+/* 2770 */ {19,195},
+/* 2771 */ {19,195},
+/* 2772 */ {19,195},
+/* 2773 */ {19,195},
+/* 2774 */ {19,195},
+/* 2775 */ {19,195},
+/* 2776 */ {19,195},
+/* 2777 */ {19,195},
+/* 2778 */ {19,195},
+/* 2779 */ {19,195},
+/* 2780 */ {19,195},
+/* 2781 */ {19,195},
+/* 2782 */ {19,195},
+/* 2783 */ {19,195},
+/* 2784 */ {19,195},
+/* 2785 */ {19,195},
+/* 2786 */ {19,195},
+/* 2787 */ {19,195},
+/* 2788 */ {19,195},
+/* 2789 */ {19,195},
+/* 2790 */ {19,195},
+/* 2791 */ {19,195},
+/* 2792 */ {19,195},
+/* 2793 */ {19,195},
+/* 2794 */ {19,195},
+/* 2795 */ {19,195},
+/* 2796 */ {19,195},
+/* 2797 */ {19,195},
+/* 2798 */ {19,195},
+/* 2799 */ {19,195},
+/* 2800 */ {19,195},
+/* 2801 */ {19,195},
+/* 2802 */ {19,195},
+/* 2803 */ {19,195},
+/* 2804 */ {19,195},
+/* 2805 */ {19,195},
+/* 2806 */ {19,195},
+/* 2807 */ {19,195},
+/* 2808 */ {19,195},
+/* 2809 */ {19,195},
+/* 2810 */ {19,195},
+/* 2811 */ {19,195},
+/* 2812 */ {19,195},
+/* 2813 */ {19,195},
+/* 2814 */ {19,195},
+/* 2815 */ {19,195},
+/* 2816 */ {19,195},
+/* 2817 */ {19,195},
+/* 2818 */ {19,195},
+/* 2819 */ {19,195},
+/* 2820 */ {19,195},
+/* 2821 */ {19,195},
+/* 2822 */ {19,195},
+/* 2823 */ {19,195},
+/* 2824 */ {19,195},
+/* 2825 */ {19,195},
+/* 2826 */ {19,195},
+/* 2827 */ {19,195},
+/* 2828 */ {19,195},
+/* 2829 */ {19,195},
+/* 2830 */ {19,195},
+/* 2831 */ {19,195},
+/* 2832 */ {19,195},
+/* 2833 */ {19,195},
+/* 2834 */ {19,195},
+/* 2835 */ {19,195},
+/* 2836 */ {19,195},
+/* 2837 */ {19,195},
+/* 2838 */ {19,195},
+/* 2839 */ {19,195},
+/* 2840 */ {19,195},
+/* 2841 */ {19,195},
+/* 2842 */ {19,195},
+/* 2843 */ {19,195},
+/* 2844 */ {19,195},
+/* 2845 */ {19,195},
+/* 2846 */ {19,195},
+/* 2847 */ {19,195},
+/* 2848 */ {19,195},
+/* 2849 */ {19,195},
+/* 2850 */ {19,195},
+/* 2851 */ {19,195},
+/* 2852 */ {19,195},
+/* 2853 */ {19,195},
+/* 2854 */ {19,195},
+/* 2855 */ {19,195},
+/* 2856 */ {19,195},
+/* 2857 */ {19,195},
+/* 2858 */ {19,195},
+/* 2859 */ {19,195},
+/* 2860 */ {19,195},
+/* 2861 */ {19,195},
+/* 2862 */ {19,195},
+/* 2863 */ {19,195},
+/* 2864 */ {19,195},
+/* 2865 */ {19,195},
+/* 2866 */ {19,195},
+/* 2867 */ {19,195},
+/* 2868 */ {19,195},
+/* 2869 */ {19,195},
+/* 2870 */ {19,195},
+/* 2871 */ {19,195},
+/* 2872 */ {19,195},
+/* 2873 */ {19,195},
+/* 2874 */ {19,195},
+/* 2875 */ {19,195},
+/* 2876 */ {19,195},
+/* 2877 */ {19,195},
+/* 2878 */ {19,195},
+/* 2879 */ {19,195},
+/* 2880 */ {19,195},
+/* 2881 */ {19,195},
+/* 2882 */ {19,195},
+/* 2883 */ {19,195},
+/* 2884 */ {19,195},
+/* 2885 */ {19,195},
+/* 2886 */ {19,195},
+/* 2887 */ {19,195},
+/* 2888 */ {19,195},
+/* 2889 */ {19,195},
+/* 2890 */ {19,195},
+/* 2891 */ {19,195},
+/* 2892 */ {19,195},
+/* 2893 */ {19,195},
+/* 2894 */ {19,195},
+/* 2895 */ {19,195},
+/* 2896 */ {19,195},
+/* 2897 */ {19,195},
+/* 2898 */ {19,195},
+/* 2899 */ {19,195},
+/* 2900 */ {19,195},
+/* 2901 */ {19,195},
+/* 2902 */ {19,195},
+/* 2903 */ {19,195},
+/* 2904 */ {19,195},
+/* 2905 */ {19,195},
+/* 2906 */ {19,195},
+/* 2907 */ {19,195},
+/* 2908 */ {19,195},
+/* 2909 */ {19,195},
+/* 2910 */ {19,195},
+/* 2911 */ {19,195},
+/* 2912 */ {19,195},
+/* 2913 */ {19,195},
+/* 2914 */ {19,195},
+/* 2915 */ {19,195},
+/* 2916 */ {19,195},
+/* 2917 */ {19,195},
+/* 2918 */ {19,195},
+/* 2919 */ {19,195},
+/* 2920 */ {19,195},
+/* 2921 */ {19,195},
+/* 2922 */ {19,195},
+/* 2923 */ {19,195},
+/* 2924 */ {19,195},
+/* 2925 */ {19,195},
+/* 2926 */ {19,195},
+/* 2927 */ {19,195},
+/* 2928 */ {19,195},
+/* 2929 */ {19,195},
+/* 2930 */ {19,195},
+/* 2931 */ {19,195},
+/* 2932 */ {19,195},
+/* 2933 */ {19,195},
+/* 2934 */ {19,195},
+/* 2935 */ {19,195},
+/* 2936 */ {19,195},
+/* 2937 */ {19,195},
+/* 2938 */ {19,195},
+/* 2939 */ {19,195},
+/* 2940 */ {19,195},
+/* 2941 */ {19,195},
+/* 2942 */ {19,195},
+/* 2943 */ {19,195},
+/* 2944 */ {19,195},
+/* 2945 */ {19,195},
+/* 2946 */ {19,195},
+/* 2947 */ {19,195},
+/* 2948 */ {19,195},
+/* 2949 */ {19,195},
+/* 2950 */ {19,195},
+/* 2951 */ {19,195},
+/* 2952 */ {19,195},
+/* 2953 */ {19,195},
+/* 2954 */ {19,195},
+/* 2955 */ {19,195},
+/* 2956 */ {19,195},
+/* 2957 */ {19,195},
+/* 2958 */ {19,195},
+/* 2959 */ {19,195},
+/* 2960 */ {19,195},
+/* 2961 */ {19,195},
+/* 2962 */ {19,195},
+/* 2963 */ {19,195},
+/* 2964 */ {19,195},
+/* 2965 */ {19,195},
+/* 2966 */ {19,195},
+/* 2967 */ {19,195},
+/* 2968 */ {19,195},
+/* 2969 */ {19,195},
+/* 2970 */ {19,195},
+/* 2971 */ {19,195},
+/* 2972 */ {19,195},
+/* 2973 */ {19,195},
+/* 2974 */ {19,195},
+/* 2975 */ {19,195},
+/* 2976 */ {19,195},
+/* 2977 */ {19,195},
+/* 2978 */ {19,195},
+/* 2979 */ {19,195},
+/* 2980 */ {19,195},
+/* 2981 */ {19,195},
+/* 2982 */ {19,195},
+/* 2983 */ {19,195},
+/* 2984 */ {19,195},
+/* 2985 */ {19,195},
+/* 2986 */ {19,195},
+/* 2987 */ {19,195},
+/* 2988 */ {19,195},
+/* 2989 */ {19,195},
+/* 2990 */ {19,195},
+/* 2991 */ {19,195},
+/* 2992 */ {19,195},
+/* 2993 */ {19,195},
+/* 2994 */ {19,195},
+/* 2995 */ {19,195},
+/* 2996 */ {19,195},
+/* 2997 */ {19,195},
+/* 2998 */ {19,195},
+/* 2999 */ {19,195},
+/* 3000 */ {19,195},
+/* 3001 */ {19,195},
+/* 3002 */ {19,195},
+/* 3003 */ {19,195},
+/* 3004 */ {19,195},
+/* 3005 */ {19,195},
+/* 3006 */ {19,195},
+/* 3007 */ {19,195},
+/* 3008 */ {19,195},
+/* 3009 */ {19,195},
+/* 3010 */ {19,195},
+/* 3011 */ {19,195},
+/* 3012 */ {19,195},
+/* 3013 */ {19,195},
+/* 3014 */ {19,195},
+/* 3015 */ {19,195},
+/* 3016 */ {19,195},
+/* 3017 */ {19,195},
+/* 3018 */ {19,195},
+/* 3019 */ {19,195},
+/* 3020 */ {19,195},
+/* 3021 */ {19,195},
+/* 3022 */ {19,195},
+/* 3023 */ {19,195},
+/* 3024 */ {19,195},
+/* 3025 */ {19,195},
+/* 3026 */ {19,195},
+/* 3027 */ {19,195},
+/* 3028 */ {19,195},
+/* 3029 */ {19,195},
+/* 3030 */ {19,195},
+/* 3031 */ {19,195},
+/* 3032 */ {19,195},
+/* 3033 */ {19,195},
+/* 3034 */ {19,195},
+/* 3035 */ {19,195},
+/* 3036 */ {19,195},
+/* 3037 */ {19,195},
+/* 3038 */ {19,195},
+/* 3039 */ {19,195},
+/* 3040 */ {19,195},
+/* 3041 */ {19,195},
+/* 3042 */ {19,195},
+/* 3043 */ {19,195},
+/* 3044 */ {19,195},
+/* 3045 */ {19,195},
+/* 3046 */ {19,195},
+/* 3047 */ {19,195},
+/* 3048 */ {19,195},
+/* 3049 */ {19,195},
+/* 3050 */ {19,195},
+/* 3051 */ {19,195},
+/* 3052 */ {19,195},
+/* 3053 */ {19,195},
+/* 3054 */ {19,195},
+/* 3055 */ {19,195},
+/* 3056 */ {19,195},
+/* 3057 */ {19,195},
+/* 3058 */ {19,195},
+/* 3059 */ {19,195},
+/* 3060 */ {19,195},
+/* 3061 */ {19,195},
+/* 3062 */ {19,195},
+/* 3063 */ {19,195},
+/* 3064 */ {19,195},
+/* 3065 */ {19,195},
+/* 3066 */ {19,195},
+/* 3067 */ {19,195},
+/* 3068 */ {19,195},
+/* 3069 */ {19,195},
+/* 3070 */ {19,195},
+/* 3071 */ {19,195},
+/* 3072 */ {19,195},
+/* 3073 */ {19,195},
+/* 3074 */ {19,195},
+/* 3075 */ {19,195},
+/* 3076 */ {19,195},
+/* 3077 */ {19,195},
+/* 3078 */ {19,195},
+/* 3079 */ {19,195},
+/* 3080 */ {19,195},
+/* 3081 */ {19,195},
+/* 3082 */ {19,195},
+/* 3083 */ {19,195},
+/* 3084 */ {19,195},
+/* 3085 */ {19,195},
+/* 3086 */ {19,195},
+/* 3087 */ {19,195},
+/* 3088 */ {19,195},
+/* 3089 */ {19,195},
+/* 3090 */ {19,195},
+/* 3091 */ {19,195},
+/* 3092 */ {19,195},
+/* 3093 */ {19,195},
+/* 3094 */ {19,195},
+/* 3095 */ {19,195},
+/* 3096 */ {19,195},
+/* 3097 */ {19,195},
+/* 3098 */ {19,195},
+/* 3099 */ {19,195},
+/* 3100 */ {19,195},
+/* 3101 */ {19,195},
+/* 3102 */ {19,195},
+/* 3103 */ {19,195},
+/* 3104 */ {19,195},
+/* 3105 */ {19,195},
+/* 3106 */ {19,195},
+/* 3107 */ {19,195},
+/* 3108 */ {19,195},
+/* 3109 */ {19,195},
+/* 3110 */ {19,195},
+/* 3111 */ {19,195},
+/* 3112 */ {19,195},
+/* 3113 */ {19,195},
+/* 3114 */ {19,195},
+/* 3115 */ {19,195},
+/* 3116 */ {19,195},
+/* 3117 */ {19,195},
+/* 3118 */ {19,195},
+/* 3119 */ {19,195},
+/* 3120 */ {19,195},
+/* 3121 */ {19,195},
+/* 3122 */ {19,195},
+/* 3123 */ {19,195},
+/* 3124 */ {19,195},
+/* 3125 */ {19,195},
+/* 3126 */ {19,195},
+/* 3127 */ {19,195},
+/* 3128 */ {19,195},
+/* 3129 */ {19,195},
+/* 3130 */ {19,195},
+/* 3131 */ {19,195},
+/* 3132 */ {19,195},
+/* 3133 */ {19,195},
+/* 3134 */ {19,195},
+/* 3135 */ {19,195},
+/* 3136 */ {19,195},
+/* 3137 */ {19,195},
+/* 3138 */ {19,195},
+/* 3139 */ {19,195},
+/* 3140 */ {19,195},
+/* 3141 */ {19,195},
+/* 3142 */ {19,195},
+/* 3143 */ {19,195},
+/* 3144 */ {19,195},
+/* 3145 */ {19,195},
+/* 3146 */ {19,195},
+/* 3147 */ {19,195},
+/* 3148 */ {19,195},
+/* 3149 */ {19,195},
+/* 3150 */ {19,195},
+/* 3151 */ {19,195},
+/* 3152 */ {19,195},
+/* 3153 */ {19,195},
+/* 3154 */ {19,195},
+/* 3155 */ {19,195},
+/* 3156 */ {19,195},
+/* 3157 */ {19,195},
+/* 3158 */ {19,195},
+/* 3159 */ {19,195},
+/* 3160 */ {19,195},
+/* 3161 */ {19,195},
+/* 3162 */ {19,195},
+/* 3163 */ {19,195},
+/* 3164 */ {19,195},
+/* 3165 */ {19,195},
+/* 3166 */ {19,195},
+/* 3167 */ {19,195},
+/* 3168 */ {19,195},
+/* 3169 */ {19,195},
+/* 3170 */ {19,195},
+/* 3171 */ {19,195},
+/* 3172 */ {19,195},
+/* 3173 */ {19,195},
+/* 3174 */ {19,195},
+/* 3175 */ {19,195},
+/* 3176 */ {19,195},
+/* 3177 */ {19,195},
+/* 3178 */ {19,195},
+/* 3179 */ {19,195},
+/* 3180 */ {19,195},
+/* 3181 */ {19,195},
+/* 3182 */ {19,195},
+/* 3183 */ {19,195},
+/* 3184 */ {19,195},
+/* 3185 */ {19,195},
+/* 3186 */ {19,195},
+/* 3187 */ {19,195},
+/* 3188 */ {19,195},
+/* 3189 */ {19,195},
+/* 3190 */ {19,195},
+/* 3191 */ {19,195},
+/* 3192 */ {19,195},
+/* 3193 */ {19,195},
+/* 3194 */ {19,195},
+/* 3195 */ {19,195},
+/* 3196 */ {19,195},
+/* 3197 */ {19,195},
+/* 3198 */ {19,195},
+/* 3199 */ {19,195},
+/* 3200 */ {19,195},
+/* 3201 */ {19,195},
+/* 3202 */ {19,195},
+/* 3203 */ {19,195},
+/* 3204 */ {19,195},
+/* 3205 */ {19,195},
+/* 3206 */ {19,195},
+/* 3207 */ {19,195},
+/* 3208 */ {19,195},
+/* 3209 */ {19,195},
+/* 3210 */ {19,195},
+/* 3211 */ {19,195},
+/* 3212 */ {19,195},
+/* 3213 */ {19,195},
+/* 3214 */ {19,195},
+/* 3215 */ {19,195},
+/* 3216 */ {19,195},
+/* 3217 */ {19,195},
+/* 3218 */ {19,195},
+/* 3219 */ {19,195},
+/* 3220 */ {19,195},
+/* 3221 */ {19,195},
+/* 3222 */ {19,195},
+/* 3223 */ {19,195},
+/* 3224 */ {19,195},
+/* 3225 */ {19,195},
+/* 3226 */ {19,195},
+/* 3227 */ {19,195},
+/* 3228 */ {19,195},
+/* 3229 */ {19,195},
+/* 3230 */ {19,195},
+/* 3231 */ {19,195},
+/* 3232 */ {19,195},
+/* 3233 */ {19,195},
+/* 3234 */ {19,195},
+/* 3235 */ {19,195},
+/* 3236 */ {19,195},
+/* 3237 */ {19,195},
+/* 3238 */ {19,195},
+/* 3239 */ {19,195},
+/* 3240 */ {19,195},
+/* 3241 */ {19,195},
+/* 3242 */ {19,195},
+/* 3243 */ {19,195},
+/* 3244 */ {19,195},
+/* 3245 */ {19,195},
+/* 3246 */ {19,195},
+/* 3247 */ {19,195},
+/* 3248 */ {19,195},
+/* 3249 */ {19,195},
+/* 3250 */ {19,195},
+/* 3251 */ {19,195},
+/* 3252 */ {19,195},
+/* 3253 */ {19,195},
+/* 3254 */ {19,195},
+/* 3255 */ {19,195},
+/* 3256 */ {19,195},
+/* 3257 */ {19,195},
+/* 3258 */ {19,195},
+/* 3259 */ {19,195},
+/* 3260 */ {19,195},
+/* 3261 */ {19,195},
+/* 3262 */ {19,195},
+/* 3263 */ {19,195},
+/* 3264 */ {19,195},
+/* 3265 */ {19,195},
+/* 3266 */ {19,195},
+/* 3267 */ {19,195},
+/* 3268 */ {19,195},
+/* 3269 */ {19,195},
+/* 3270 */ {19,195},
+/* 3271 */ {19,195},
+/* 3272 */ {19,195},
+/* 3273 */ {19,195},
+/* 3274 */ {19,195},
+/* 3275 */ {19,195},
+/* 3276 */ {19,195},
+/* 3277 */ {19,195},
+/* 3278 */ {19,195},
+/* 3279 */ {19,195},
+/* 3280 */ {19,195},
+/* 3281 */ {19,195},
+/* 3282 */ {19,195},
+/* 3283 */ {19,195},
+/* 3284 */ {19,195},
+/* 3285 */ {19,195},
+/* 3286 */ {19,195},
+/* 3287 */ {19,195},
+/* 3288 */ {19,195},
+/* 3289 */ {19,195},
+/* 3290 */ {19,195},
+/* 3291 */ {19,195},
+/* 3292 */ {19,195},
+/* 3293 */ {19,195},
+/* 3294 */ {19,195},
+/* 3295 */ {19,195},
+/* 3296 */ {19,195},
+/* 3297 */ {19,195},
+/* 3298 */ {19,195},
+/* 3299 */ {19,195},
+/* 3300 */ {19,195},
+/* 3301 */ {19,195},
+/* 3302 */ {19,195},
+/* 3303 */ {19,195},
+/* 3304 */ {19,195},
+/* 3305 */ {19,195},
+/* 3306 */ {19,195},
+/* 3307 */ {19,195},
+/* 3308 */ {19,195},
+/* 3309 */ {19,195},
+/* 3310 */ {19,195},
+/* 3311 */ {19,195},
+/* 3312 */ {19,195},
+/* 3313 */ {19,195},
+/* 3314 */ {19,195},
+/* 3315 */ {19,195},
+/* 3316 */ {19,195},
+/* 3317 */ {19,195},
+/* 3318 */ {19,195},
+/* 3319 */ {19,195},
+/* 3320 */ {19,195},
+/* 3321 */ {19,195},
+/* 3322 */ {19,195},
+/* 3323 */ {19,195},
+/* 3324 */ {19,195},
+/* 3325 */ {19,195},
+/* 3326 */ {19,195},
+/* 3327 */ {19,195},
+/* 3328 */ {19,195},
+/* 3329 */ {19,195},
+/* 3330 */ {19,195},
+/* 3331 */ {19,195},
+/* 3332 */ {19,195},
+/* 3333 */ {19,195},
+/* 3334 */ {19,195},
+/* 3335 */ {19,195},
+/* 3336 */ {19,195},
+/* 3337 */ {19,195},
+/* 3338 */ {19,195},
+/* 3339 */ {19,195},
+/* 3340 */ {19,195},
+/* 3341 */ {19,195},
+/* 3342 */ {19,195},
+/* 3343 */ {19,195},
+/* 3344 */ {19,195},
+/* 3345 */ {19,195},
+/* 3346 */ {19,195},
+/* 3347 */ {19,195},
+/* 3348 */ {19,195},
+/* 3349 */ {19,195},
+/* 3350 */ {19,195},
+/* 3351 */ {19,195},
+/* 3352 */ {19,195},
+/* 3353 */ {19,195},
+/* 3354 */ {19,195},
+/* 3355 */ {19,195},
+/* 3356 */ {19,195},
+/* 3357 */ {19,195},
+/* 3358 */ {19,195},
+/* 3359 */ {19,195},
+/* 3360 */ {19,195},
+/* 3361 */ {19,195},
+/* 3362 */ {19,195},
+/* 3363 */ {19,195},
+/* 3364 */ {19,195},
+/* 3365 */ {19,195},
+/* 3366 */ {19,195},
+/* 3367 */ {19,195},
+/* 3368 */ {19,195},
+/* 3369 */ {19,195},
+/* 3370 */ {19,195},
+/* 3371 */ {19,195},
+/* 3372 */ {19,195},
+/* 3373 */ {19,195},
+/* 3374 */ {19,195},
+/* 3375 */ {19,195},
+/* 3376 */ {19,195},
+/* 3377 */ {19,195},
+/* 3378 */ {19,195},
+/* 3379 */ {19,195},
+/* 3380 */ {19,195},
+/* 3381 */ {19,195},
+/* 3382 */ {19,195},
+/* 3383 */ {19,195},
+/* 3384 */ {19,195},
+/* 3385 */ {19,195},
+/* 3386 */ {19,195},
+/* 3387 */ {19,195},
+/* 3388 */ {19,195},
+/* 3389 */ {19,195},
+/* 3390 */ {19,195},
+/* 3391 */ {19,195},
+/* 3392 */ {19,195},
+/* 3393 */ {19,195},
+/* 3394 */ {19,195},
+/* 3395 */ {19,195},
+/* 3396 */ {19,195},
+/* 3397 */ {19,195},
+/* 3398 */ {19,195},
+/* 3399 */ {19,195},
+/* 3400 */ {19,195},
+/* 3401 */ {19,195},
+/* 3402 */ {19,195},
+/* 3403 */ {19,195},
+/* 3404 */ {19,195},
+/* 3405 */ {19,195},
+/* 3406 */ {19,195},
+/* 3407 */ {19,195},
+/* 3408 */ {19,195},
+/* 3409 */ {19,195},
+/* 3410 */ {19,195},
+/* 3411 */ {19,195},
+/* 3412 */ {19,195},
+/* 3413 */ {19,195},
+/* 3414 */ {19,195},
+/* 3415 */ {19,195},
+/* 3416 */ {19,195},
+/* 3417 */ {19,195},
+/* 3418 */ {19,195},
+/* 3419 */ {19,195},
+/* 3420 */ {19,195},
+/* 3421 */ {19,195},
+/* 3422 */ {19,195},
+/* 3423 */ {19,195},
+/* 3424 */ {19,195},
+/* 3425 */ {19,195},
+/* 3426 */ {19,195},
+/* 3427 */ {19,195},
+/* 3428 */ {19,195},
+/* 3429 */ {19,195},
+/* 3430 */ {19,195},
+/* 3431 */ {19,195},
+/* 3432 */ {19,195},
+/* 3433 */ {19,195},
+/* 3434 */ {19,195},
+/* 3435 */ {19,195},
+/* 3436 */ {19,195},
+/* 3437 */ {19,195},
+/* 3438 */ {19,195},
+/* 3439 */ {19,195},
+/* 3440 */ {19,195},
+/* 3441 */ {19,195},
+/* 3442 */ {19,195},
+/* 3443 */ {19,195},
+/* 3444 */ {19,195},
+/* 3445 */ {19,195},
+/* 3446 */ {19,195},
+/* 3447 */ {19,195},
+/* 3448 */ {19,195},
+/* 3449 */ {19,195},
+/* 3450 */ {19,195},
+/* 3451 */ {19,195},
+/* 3452 */ {19,195},
+/* 3453 */ {19,195},
+/* 3454 */ {19,195},
+/* 3455 */ {19,195},
+/* 3456 */ {19,195},
+/* 3457 */ {19,195},
+/* 3458 */ {19,195},
+/* 3459 */ {19,195},
+/* 3460 */ {19,195},
+/* 3461 */ {19,195},
+/* 3462 */ {19,195},
+/* 3463 */ {19,195},
+/* 3464 */ {19,195},
+/* 3465 */ {19,195},
+/* 3466 */ {19,195},
+/* 3467 */ {19,195},
+/* 3468 */ {19,195},
+/* 3469 */ {19,195},
+/* 3470 */ {19,195},
+/* 3471 */ {19,195},
+/* 3472 */ {19,195},
+/* 3473 */ {19,195},
+/* 3474 */ {19,195},
+/* 3475 */ {19,195},
+/* 3476 */ {19,195},
+/* 3477 */ {19,195},
+/* 3478 */ {19,195},
+/* 3479 */ {19,195},
+/* 3480 */ {19,195},
+/* 3481 */ {19,195},
+/* 3482 */ {19,195},
+/* 3483 */ {19,195},
+/* 3484 */ {19,195},
+/* 3485 */ {19,195},
+/* 3486 */ {19,195},
+/* 3487 */ {19,195},
+/* 3488 */ {19,195},
+/* 3489 */ {19,195},
+/* 3490 */ {19,195},
+/* 3491 */ {19,195},
+/* 3492 */ {19,195},
+/* 3493 */ {19,195},
+/* 3494 */ {19,195},
+/* 3495 */ {19,195},
+/* 3496 */ {19,195},
+/* 3497 */ {19,195},
+/* 3498 */ {19,195},
+/* 3499 */ {19,195},
+/* 3500 */ {19,195},
+/* 3501 */ {19,195},
+/* 3502 */ {19,195},
+/* 3503 */ {19,195},
+/* 3504 */ {19,195},
+/* 3505 */ {19,195},
+/* 3506 */ {19,195},
+/* 3507 */ {19,195},
+/* 3508 */ {19,195},
+/* 3509 */ {19,195},
+/* 3510 */ {19,195},
+/* 3511 */ {19,195},
+/* 3512 */ {19,195},
+/* 3513 */ {19,195},
+/* 3514 */ {19,195},
+/* 3515 */ {19,195},
+/* 3516 */ {19,195},
+/* 3517 */ {19,195},
+/* 3518 */ {19,195},
+/* 3519 */ {19,195},
+/* 3520 */ {19,195},
+/* 3521 */ {19,195},
+/* 3522 */ {19,195},
+/* 3523 */ {19,195},
+/* 3524 */ {19,195},
+/* 3525 */ {19,195},
+/* 3526 */ {19,195},
+/* 3527 */ {19,195},
+/* 3528 */ {19,195},
+/* 3529 */ {19,195},
+/* 3530 */ {19,195},
+/* 3531 */ {19,195},
+/* 3532 */ {19,195},
+/* 3533 */ {19,195},
+/* 3534 */ {19,195},
+/* 3535 */ {19,195},
+/* 3536 */ {19,195},
+/* 3537 */ {19,195},
+/* 3538 */ {19,195},
+/* 3539 */ {19,195},
+/* 3540 */ {19,195},
+/* 3541 */ {19,195},
+/* 3542 */ {19,195},
+/* 3543 */ {19,195},
+/* 3544 */ {19,195},
+/* 3545 */ {19,195},
+/* 3546 */ {19,195},
+/* 3547 */ {19,195},
+/* 3548 */ {19,195},
+/* 3549 */ {19,195},
+/* 3550 */ {19,195},
+/* 3551 */ {19,195},
+/* 3552 */ {19,195},
+/* 3553 */ {19,195},
+/* 3554 */ {19,195},
+/* 3555 */ {19,195},
+/* 3556 */ {19,195},
+/* 3557 */ {19,195},
+/* 3558 */ {19,195},
+/* 3559 */ {19,195},
+/* 3560 */ {19,195},
+/* 3561 */ {19,195},
+/* 3562 */ {19,195},
+/* 3563 */ {19,195},
+/* 3564 */ {19,195},
+/* 3565 */ {19,195},
+/* 3566 */ {19,195},
+/* 3567 */ {19,195},
+/* 3568 */ {19,195},
+/* 3569 */ {19,195},
+/* 3570 */ {19,195},
+/* 3571 */ {19,195},
+/* 3572 */ {19,195},
+/* 3573 */ {19,195},
+/* 3574 */ {19,195},
+/* 3575 */ {19,195},
+/* 3576 */ {19,195},
+/* 3577 */ {19,195},
+/* 3578 */ {19,195},
+/* 3579 */ {19,195},
+/* 3580 */ {19,195},
+/* 3581 */ {19,195},
+/* 3582 */ {19,195},
+/* 3583 */ {19,195},
+/* 3584 */ {19,195},
+/* 3585 */ {19,195},
+/* 3586 */ {19,195},
+/* 3587 */ {19,195},
+/* 3588 */ {19,195},
+/* 3589 */ {19,195},
+/* 3590 */ {19,195},
+/* 3591 */ {19,195},
+/* 3592 */ {19,195},
+/* 3593 */ {19,195},
+/* 3594 */ {19,195},
+/* 3595 */ {19,195},
+/* 3596 */ {19,195},
+/* 3597 */ {19,195},
+/* 3598 */ {19,195},
+/* 3599 */ {19,195},
+/* 3600 */ {19,195},
+/* 3601 */ {19,195},
+/* 3602 */ {19,195},
+/* 3603 */ {19,195},
+/* 3604 */ {19,195},
+/* 3605 */ {19,195},
+/* 3606 */ {19,195},
+/* 3607 */ {19,195},
+/* 3608 */ {19,195},
+/* 3609 */ {19,195},
+/* 3610 */ {19,195},
+/* 3611 */ {19,195},
+/* 3612 */ {19,195},
+/* 3613 */ {19,195},
+/* 3614 */ {19,195},
+/* 3615 */ {19,195},
+/* 3616 */ {19,195},
+/* 3617 */ {19,195},
+/* 3618 */ {19,195},
+/* 3619 */ {19,195},
+/* 3620 */ {19,195},
+/* 3621 */ {19,195},
+/* 3622 */ {19,195},
+/* 3623 */ {19,195},
+/* 3624 */ {19,195},
+/* 3625 */ {19,195},
+/* 3626 */ {19,195},
+/* 3627 */ {19,195},
+/* 3628 */ {19,195},
+/* 3629 */ {19,195},
+/* 3630 */ {19,195},
+/* 3631 */ {19,195},
+/* 3632 */ {19,195},
+/* 3633 */ {19,195},
+/* 3634 */ {19,195},
+/* 3635 */ {19,195},
+/* 3636 */ {19,195},
+/* 3637 */ {19,195},
+/* 3638 */ {19,195},
+/* 3639 */ {19,195},
+/* 3640 */ {19,195},
+/* 3641 */ {19,195},
+/* 3642 */ {19,195},
+/* 3643 */ {19,195},
+/* 3644 */ {19,195},
+/* 3645 */ {19,195},
+/* 3646 */ {19,195},
+/* 3647 */ {19,195},
+/* 3648 */ {19,195},
+/* 3649 */ {19,195},
+/* 3650 */ {19,195},
+/* 3651 */ {19,195},
+/* 3652 */ {19,195},
+/* 3653 */ {19,195},
+/* 3654 */ {19,195},
+/* 3655 */ {19,195},
+/* 3656 */ {19,195},
+/* 3657 */ {19,195},
+/* 3658 */ {19,195},
+/* 3659 */ {19,195},
+/* 3660 */ {19,195},
+/* 3661 */ {19,195},
+/* 3662 */ {19,195},
+/* 3663 */ {19,195},
+/* 3664 */ {19,195},
+/* 3665 */ {19,195},
+/* 3666 */ {19,195},
+/* 3667 */ {19,195},
+/* 3668 */ {19,195},
+/* 3669 */ {19,195},
+/* 3670 */ {19,195},
+/* 3671 */ {19,195},
+/* 3672 */ {19,195},
+/* 3673 */ {19,195},
+/* 3674 */ {19,195},
+/* 3675 */ {19,195},
+/* 3676 */ {19,195},
+/* 3677 */ {19,195},
+/* 3678 */ {19,195},
+/* 3679 */ {19,195},
+/* 3680 */ {19,195},
+/* 3681 */ {19,195},
+/* 3682 */ {19,195},
+/* 3683 */ {19,195},
+/* 3684 */ {19,195},
+/* 3685 */ {19,195},
+/* 3686 */ {19,195},
+/* 3687 */ {19,195},
+/* 3688 */ {19,195},
+/* 3689 */ {19,195},
+/* 3690 */ {19,195},
+/* 3691 */ {19,195},
+/* 3692 */ {19,195},
+/* 3693 */ {19,195},
+/* 3694 */ {19,195},
+/* 3695 */ {19,195},
+/* 3696 */ {19,195},
+/* 3697 */ {19,195},
+/* 3698 */ {19,195},
+/* 3699 */ {19,195},
+/* 3700 */ {19,195},
+/* 3701 */ {19,195},
+/* 3702 */ {19,195},
+/* 3703 */ {19,195},
+/* 3704 */ {19,195},
+/* 3705 */ {19,195},
+/* 3706 */ {19,195},
+/* 3707 */ {19,195},
+/* 3708 */ {19,195},
+/* 3709 */ {19,195},
+/* 3710 */ {19,195},
+/* 3711 */ {19,195},
+/* 3712 */ {19,195},
+/* 3713 */ {19,195},
+/* 3714 */ {19,195},
+/* 3715 */ {19,195},
+/* 3716 */ {19,195},
+/* 3717 */ {19,195},
+/* 3718 */ {19,195},
+/* 3719 */ {19,195},
+/* 3720 */ {19,195},
+/* 3721 */ {19,195},
+/* 3722 */ {19,195},
+/* 3723 */ {19,195},
+/* 3724 */ {19,195},
+/* 3725 */ {19,195},
+/* 3726 */ {19,195},
+/* 3727 */ {19,195},
+/* 3728 */ {19,195},
+/* 3729 */ {19,195},
+/* 3730 */ {19,195},
+/* 3731 */ {19,195},
+/* 3732 */ {19,195},
+/* 3733 */ {19,195},
+/* 3734 */ {19,195},
+/* 3735 */ {19,195},
+/* 3736 */ {19,195},
+/* 3737 */ {19,195},
+/* 3738 */ {19,195},
+/* 3739 */ {19,195},
+/* 3740 */ {19,195},
+/* 3741 */ {19,195},
+/* 3742 */ {19,195},
+/* 3743 */ {19,195},
+/* 3744 */ {19,195},
+/* 3745 */ {19,195},
+/* 3746 */ {19,195},
+/* 3747 */ {19,195},
+/* 3748 */ {19,195},
+/* 3749 */ {19,195},
+/* 3750 */ {19,195},
+/* 3751 */ {19,195},
+/* 3752 */ {19,195},
+/* 3753 */ {19,195},
+/* 3754 */ {19,195},
+/* 3755 */ {19,195},
+/* 3756 */ {19,195},
+/* 3757 */ {19,195},
+/* 3758 */ {19,195},
+/* 3759 */ {19,195},
+/* 3760 */ {19,195},
+/* 3761 */ {19,195},
+/* 3762 */ {19,195},
+/* 3763 */ {19,195},
+/* 3764 */ {19,195},
+/* 3765 */ {19,195},
+/* 3766 */ {19,195},
+/* 3767 */ {19,195},
+/* 3768 */ {19,195},
+/* 3769 */ {19,195},
+/* 3770 */ {19,195},
+/* 3771 */ {19,195},
+/* 3772 */ {19,195},
+/* 3773 */ {19,195},
+/* 3774 */ {19,195},
+/* 3775 */ {19,195},
+/* 3776 */ {19,195},
+/* 3777 */ {19,195},
+/* 3778 */ {19,195},
+/* 3779 */ {19,195},
+/* 3780 */ {19,195},
+/* 3781 */ {19,195},
+/* 3782 */ {19,195},
+/* 3783 */ {19,195},
+/* 3784 */ {19,195},
+/* 3785 */ {19,195},
+/* 3786 */ {19,195},
+/* 3787 */ {19,195},
+/* 3788 */ {19,195},
+/* 3789 */ {19,195},
+/* 3790 */ {19,195},
+/* 3791 */ {19,195},
+/* 3792 */ {19,195},
+/* 3793 */ {19,195},
+/* 3794 */ {19,195},
+/* 3795 */ {19,195},
+/* 3796 */ {19,195},
+/* 3797 */ {19,195},
+/* 3798 */ {19,195},
+/* 3799 */ {19,195},
+/* 3800 */ {19,195},
+/* 3801 */ {19,195},
+/* 3802 */ {19,195},
+/* 3803 */ {19,195},
+/* 3804 */ {19,195},
+/* 3805 */ {19,195},
+/* 3806 */ {19,195},
+/* 3807 */ {19,195},
+/* 3808 */ {19,195},
+/* 3809 */ {19,195},
+/* 3810 */ {19,195},
+/* 3811 */ {19,195},
+/* 3812 */ {19,195},
+/* 3813 */ {19,195},
+/* 3814 */ {19,195},
+/* 3815 */ {19,195},
+/* 3816 */ {19,195},
+/* 3817 */ {19,195},
+/* 3818 */ {19,195},
+/* 3819 */ {19,195},
+/* 3820 */ {19,195},
+/* 3821 */ {19,195},
+/* 3822 */ {19,195},
+/* 3823 */ {19,195},
+/* 3824 */ {19,195},
+/* 3825 */ {19,195},
+/* 3826 */ {19,195},
+/* 3827 */ {19,195},
+/* 3828 */ {19,195},
+/* 3829 */ {19,195},
+/* 3830 */ {19,195},
+/* 3831 */ {19,195},
+/* 3832 */ {19,195},
+/* 3833 */ {19,195},
+/* 3834 */ {19,195},
+/* 3835 */ {19,195},
+/* 3836 */ {19,195},
+/* 3837 */ {19,195},
+/* 3838 */ {19,195},
+/* 3839 */ {19,195},
+/* 3840 */ {19,195},
+/* 3841 */ {19,195},
+/* 3842 */ {19,195},
+/* 3843 */ {19,195},
+/* 3844 */ {19,195},
+/* 3845 */ {19,195},
+/* 3846 */ {19,195},
+/* 3847 */ {19,195},
+/* 3848 */ {19,195},
+/* 3849 */ {19,195},
+/* 3850 */ {19,195},
+/* 3851 */ {19,195},
+/* 3852 */ {19,195},
+/* 3853 */ {19,195},
+/* 3854 */ {19,195},
+/* 3855 */ {19,195},
+/* 3856 */ {19,195},
+/* 3857 */ {19,195},
+/* 3858 */ {19,195},
+/* 3859 */ {19,195},
+/* 3860 */ {19,195},
+/* 3861 */ {19,195},
+/* 3862 */ {19,195},
+/* 3863 */ {19,195},
+/* 3864 */ {19,195},
+/* 3865 */ {19,195},
+/* 3866 */ {19,195},
+/* 3867 */ {19,195},
+/* 3868 */ {19,195},
+/* 3869 */ {19,195},
+/* 3870 */ {19,195},
+/* 3871 */ {19,195},
+/* 3872 */ {19,195},
+/* 3873 */ {19,195},
+/* 3874 */ {19,195},
+/* 3875 */ {19,195},
+/* 3876 */ {19,195},
+/* 3877 */ {19,195},
+/* 3878 */ {19,195},
+/* 3879 */ {19,195},
+/* 3880 */ {19,195},
+/* 3881 */ {19,195},
+/* 3882 */ {19,195},
+/* 3883 */ {19,195},
+/* 3884 */ {19,195},
+/* 3885 */ {19,195},
+/* 3886 */ {19,195},
+/* 3887 */ {19,195},
+/* 3888 */ {19,195},
+/* 3889 */ {19,195},
+/* 3890 */ {19,195},
+/* 3891 */ {19,195},
+/* 3892 */ {19,195},
+/* 3893 */ {19,195},
+/* 3894 */ {19,195},
+/* 3895 */ {19,195},
+/* 3896 */ {19,195},
+/* 3897 */ {19,195},
+/* 3898 */ {19,195},
+/* 3899 */ {19,195},
+/* 3900 */ {19,195},
+/* 3901 */ {19,195},
+/* 3902 */ {19,195},
+/* 3903 */ {19,195},
+/* 3904 */ {19,195},
+/* 3905 */ {19,195},
+/* 3906 */ {19,195},
+/* 3907 */ {19,195},
+/* 3908 */ {19,195},
+/* 3909 */ {19,195},
+/* 3910 */ {19,195},
+/* 3911 */ {19,195},
+/* 3912 */ {19,195},
+/* 3913 */ {19,195},
+/* 3914 */ {19,195},
+/* 3915 */ {19,195},
+/* 3916 */ {19,195},
+/* 3917 */ {19,195},
+/* 3918 */ {19,195},
+/* 3919 */ {19,195},
+/* 3920 */ {19,195},
+/* 3921 */ {19,195},
+/* 3922 */ {19,195},
+/* 3923 */ {19,195},
+/* 3924 */ {19,195},
+/* 3925 */ {19,195},
+/* 3926 */ {19,195},
+/* 3927 */ {19,195},
+/* 3928 */ {19,195},
+/* 3929 */ {19,195},
+/* 3930 */ {19,195},
+/* 3931 */ {19,195},
+/* 3932 */ {19,195},
+/* 3933 */ {19,195},
+/* 3934 */ {19,195},
+/* 3935 */ {19,195},
+/* 3936 */ {19,195},
+/* 3937 */ {19,195},
+/* 3938 */ {19,195},
+/* 3939 */ {19,195},
+/* 3940 */ {19,195},
+/* 3941 */ {19,195},
+/* 3942 */ {19,195},
+/* 3943 */ {19,195},
+/* 3944 */ {19,195},
+/* 3945 */ {19,195},
+/* 3946 */ {19,195},
+/* 3947 */ {19,195},
+/* 3948 */ {19,195},
+/* 3949 */ {19,195},
+/* 3950 */ {19,195},
+/* 3951 */ {19,195},
+/* 3952 */ {19,195},
+/* 3953 */ {19,195},
+/* 3954 */ {19,195},
+/* 3955 */ {19,195},
+/* 3956 */ {19,195},
+/* 3957 */ {19,195},
+/* 3958 */ {19,195},
+/* 3959 */ {19,195},
+/* 3960 */ {19,195},
+/* 3961 */ {19,195},
+/* 3962 */ {19,195},
+/* 3963 */ {19,195},
+/* 3964 */ {19,195},
+/* 3965 */ {19,195},
+/* 3966 */ {19,195},
+/* 3967 */ {19,195},
+/* 3968 */ {19,195},
+/* 3969 */ {19,195},
+/* 3970 */ {19,195},
+/* 3971 */ {19,195},
+/* 3972 */ {19,195},
+/* 3973 */ {19,195},
+/* 3974 */ {19,195},
+/* 3975 */ {19,195},
+/* 3976 */ {19,195},
+/* 3977 */ {19,195},
+/* 3978 */ {19,195},
+/* 3979 */ {19,195},
+/* 3980 */ {19,195},
+/* 3981 */ {19,195},
+/* 3982 */ {19,195},
+/* 3983 */ {19,195},
+/* 3984 */ {19,195},
+/* 3985 */ {19,195},
+/* 3986 */ {19,195},
+/* 3987 */ {19,195},
+/* 3988 */ {19,195},
+/* 3989 */ {19,195},
+/* 3990 */ {19,195},
+/* 3991 */ {19,195},
+/* 3992 */ {19,195},
+/* 3993 */ {19,195},
+/* 3994 */ {19,195},
+/* 3995 */ {19,195},
+/* 3996 */ {19,195},
+/* 3997 */ {19,195},
+/* 3998 */ {19,195},
+/* 3999 */ {19,195},
+/* 4000 */ {19,195},
+/* 4001 */ {19,195},
+/* 4002 */ {19,195},
+/* 4003 */ {19,195},
+/* 4004 */ {19,195},
+/* 4005 */ {19,195},
+/* 4006 */ {19,195},
+/* 4007 */ {19,195},
+/* 4008 */ {19,195},
+/* 4009 */ {19,195},
+/* 4010 */ {19,195},
+/* 4011 */ {19,195},
+/* 4012 */ {19,195},
+/* 4013 */ {19,195},
+/* 4014 */ {19,195},
+/* 4015 */ {19,195},
+/* 4016 */ {19,195},
+/* 4017 */ {19,195},
+/* 4018 */ {19,195},
+/* 4019 */ {19,195},
+/* 4020 */ {19,195},
+/* 4021 */ {19,195},
+/* 4022 */ {19,195},
+/* 4023 */ {19,195},
+/* 4024 */ {19,195},
+/* 4025 */ {19,195},
+/* 4026 */ {19,195},
+/* 4027 */ {19,195},
+/* 4028 */ {19,195},
+/* 4029 */ {19,195},
+/* 4030 */ {19,195},
+/* 4031 */ {19,195},
+/* 4032 */ {19,195},
+/* 4033 */ {19,195},
+/* 4034 */ {19,195},
+/* 4035 */ {19,195},
+/* 4036 */ {19,195},
+/* 4037 */ {19,195},
+/* 4038 */ {19,195},
+/* 4039 */ {19,195},
+/* 4040 */ {19,195},
+/* 4041 */ {19,195},
+/* 4042 */ {19,195},
+/* 4043 */ {19,195},
+/* 4044 */ {19,195},
+/* 4045 */ {19,195},
+/* 4046 */ {19,195},
+/* 4047 */ {19,195},
+/* 4048 */ {19,195},
+/* 4049 */ {19,195},
+/* 4050 */ {19,195},
+/* 4051 */ {19,195},
+/* 4052 */ {19,195},
+/* 4053 */ {19,195},
+/* 4054 */ {19,195},
+/* 4055 */ {19,195},
+/* 4056 */ {19,195},
+/* 4057 */ {19,195},
+/* 4058 */ {19,195},
+/* 4059 */ {19,195},
+/* 4060 */ {19,195},
+/* 4061 */ {19,195},
+/* 4062 */ {19,195},
+/* 4063 */ {19,195},
+/* 4064 */ {19,195},
+/* 4065 */ {19,195},
+/* 4066 */ {19,195},
+/* 4067 */ {19,195},
+/* 4068 */ {19,195},
+/* 4069 */ {19,195},
+/* 4070 */ {19,195},
+/* 4071 */ {19,195},
+/* 4072 */ {19,195},
+/* 4073 */ {19,195},
+/* 4074 */ {19,195},
+/* 4075 */ {19,195},
+/* 4076 */ {19,195},
+/* 4077 */ {19,195},
+/* 4078 */ {19,195},
+/* 4079 */ {19,195},
+/* 4080 */ {19,195},
+/* 4081 */ {19,195},
+/* 4082 */ {19,195},
+/* 4083 */ {19,195},
+/* 4084 */ {19,195},
+/* 4085 */ {19,195},
+/* 4086 */ {19,195},
+/* 4087 */ {19,195},
+/* 4088 */ {19,195},
+/* 4089 */ {19,195},
+/* 4090 */ {19,195},
+/* 4091 */ {19,195},
+/* 4092 */ {19,195},
+/* 4093 */ {19,195},
+/* 4094 */ {19,195},
+/* 4095 */ {19,195},
+/* 4096 */ {19,208},
+/* 4097 */ {19,208},
+/* 4098 */ {19,208},
+/* 4099 */ {19,208},
+/* 4100 */ {19,208},
+/* 4101 */ {19,208},
+/* 4102 */ {19,208},
+/* 4103 */ {19,208},
+/* 4104 */ {19,208},
+/* 4105 */ {19,208},
+/* 4106 */ {19,208},
+/* 4107 */ {19,208},
+/* 4108 */ {19,208},
+/* 4109 */ {19,208},
+/* 4110 */ {19,208},
+/* 4111 */ {19,208},
+/* 4112 */ {19,208},
+/* 4113 */ {19,208},
+/* 4114 */ {19,208},
+/* 4115 */ {19,208},
+/* 4116 */ {19,208},
+/* 4117 */ {19,208},
+/* 4118 */ {19,208},
+/* 4119 */ {19,208},
+/* 4120 */ {19,208},
+/* 4121 */ {19,208},
+/* 4122 */ {19,208},
+/* 4123 */ {19,208},
+/* 4124 */ {19,208},
+/* 4125 */ {19,208},
+/* 4126 */ {19,208},
+/* 4127 */ {19,208},
+/* 4128 */ {19,208},
+/* 4129 */ {19,208},
+/* 4130 */ {19,208},
+/* 4131 */ {19,208},
+/* 4132 */ {19,208},
+/* 4133 */ {19,208},
+/* 4134 */ {19,208},
+/* 4135 */ {19,208},
+/* 4136 */ {19,208},
+/* 4137 */ {19,208},
+/* 4138 */ {19,208},
+/* 4139 */ {19,208},
+/* 4140 */ {19,208},
+/* 4141 */ {19,208},
+/* 4142 */ {19,208},
+/* 4143 */ {19,208},
+/* 4144 */ {19,208},
+/* 4145 */ {19,208},
+/* 4146 */ {19,208},
+/* 4147 */ {19,208},
+/* 4148 */ {19,208},
+/* 4149 */ {19,208},
+/* 4150 */ {19,208},
+/* 4151 */ {19,208},
+/* 4152 */ {19,208},
+/* 4153 */ {19,208},
+/* 4154 */ {19,208},
+/* 4155 */ {19,208},
+/* 4156 */ {19,208},
+/* 4157 */ {19,208},
+/* 4158 */ {19,208},
+/* 4159 */ {19,208},
+/* 4160 */ {19,208},
+/* 4161 */ {19,208},
+/* 4162 */ {19,208},
+/* 4163 */ {19,208},
+/* 4164 */ {19,208},
+/* 4165 */ {19,208},
+/* 4166 */ {19,208},
+/* 4167 */ {19,208},
+/* 4168 */ {19,208},
+/* 4169 */ {19,208},
+/* 4170 */ {19,208},
+/* 4171 */ {19,208},
+/* 4172 */ {19,208},
+/* 4173 */ {19,208},
+/* 4174 */ {19,208},
+/* 4175 */ {19,208},
+/* 4176 */ {19,208},
+/* 4177 */ {19,208},
+/* 4178 */ {19,208},
+/* 4179 */ {19,208},
+/* 4180 */ {19,208},
+/* 4181 */ {19,208},
+/* 4182 */ {19,208},
+/* 4183 */ {19,208},
+/* 4184 */ {19,208},
+/* 4185 */ {19,208},
+/* 4186 */ {19,208},
+/* 4187 */ {19,208},
+/* 4188 */ {19,208},
+/* 4189 */ {19,208},
+/* 4190 */ {19,208},
+/* 4191 */ {19,208},
+/* 4192 */ {19,208},
+/* 4193 */ {19,208},
+/* 4194 */ {19,208},
+/* 4195 */ {19,208},
+/* 4196 */ {19,208},
+/* 4197 */ {19,208},
+/* 4198 */ {19,208},
+/* 4199 */ {19,208},
+/* 4200 */ {19,208},
+/* 4201 */ {19,208},
+/* 4202 */ {19,208},
+/* 4203 */ {19,208},
+/* 4204 */ {19,208},
+/* 4205 */ {19,208},
+/* 4206 */ {19,208},
+/* 4207 */ {19,208},
+/* 4208 */ {19,208},
+/* 4209 */ {19,208},
+/* 4210 */ {19,208},
+/* 4211 */ {19,208},
+/* 4212 */ {19,208},
+/* 4213 */ {19,208},
+/* 4214 */ {19,208},
+/* 4215 */ {19,208},
+/* 4216 */ {19,208},
+/* 4217 */ {19,208},
+/* 4218 */ {19,208},
+/* 4219 */ {19,208},
+/* 4220 */ {19,208},
+/* 4221 */ {19,208},
+/* 4222 */ {19,208},
+/* 4223 */ {19,208},
+/* 4224 */ {19,208},
+/* 4225 */ {19,208},
+/* 4226 */ {19,208},
+/* 4227 */ {19,208},
+/* 4228 */ {19,208},
+/* 4229 */ {19,208},
+/* 4230 */ {19,208},
+/* 4231 */ {19,208},
+/* 4232 */ {19,208},
+/* 4233 */ {19,208},
+/* 4234 */ {19,208},
+/* 4235 */ {19,208},
+/* 4236 */ {19,208},
+/* 4237 */ {19,208},
+/* 4238 */ {19,208},
+/* 4239 */ {19,208},
+/* 4240 */ {19,208},
+/* 4241 */ {19,208},
+/* 4242 */ {19,208},
+/* 4243 */ {19,208},
+/* 4244 */ {19,208},
+/* 4245 */ {19,208},
+/* 4246 */ {19,208},
+/* 4247 */ {19,208},
+/* 4248 */ {19,208},
+/* 4249 */ {19,208},
+/* 4250 */ {19,208},
+/* 4251 */ {19,208},
+/* 4252 */ {19,208},
+/* 4253 */ {19,208},
+/* 4254 */ {19,208},
+/* 4255 */ {19,208},
+/* 4256 */ {19,208},
+/* 4257 */ {19,208},
+/* 4258 */ {19,208},
+/* 4259 */ {19,208},
+/* 4260 */ {19,208},
+/* 4261 */ {19,208},
+/* 4262 */ {19,208},
+/* 4263 */ {19,208},
+/* 4264 */ {19,208},
+/* 4265 */ {19,208},
+/* 4266 */ {19,208},
+/* 4267 */ {19,208},
+/* 4268 */ {19,208},
+/* 4269 */ {19,208},
+/* 4270 */ {19,208},
+/* 4271 */ {19,208},
+/* 4272 */ {19,208},
+/* 4273 */ {19,208},
+/* 4274 */ {19,208},
+/* 4275 */ {19,208},
+/* 4276 */ {19,208},
+/* 4277 */ {19,208},
+/* 4278 */ {19,208},
+/* 4279 */ {19,208},
+/* 4280 */ {19,208},
+/* 4281 */ {19,208},
+/* 4282 */ {19,208},
+/* 4283 */ {19,208},
+/* 4284 */ {19,208},
+/* 4285 */ {19,208},
+/* 4286 */ {19,208},
+/* 4287 */ {19,208},
+/* 4288 */ {19,208},
+/* 4289 */ {19,208},
+/* 4290 */ {19,208},
+/* 4291 */ {19,208},
+/* 4292 */ {19,208},
+/* 4293 */ {19,208},
+/* 4294 */ {19,208},
+/* 4295 */ {19,208},
+/* 4296 */ {19,208},
+/* 4297 */ {19,208},
+/* 4298 */ {19,208},
+/* 4299 */ {19,208},
+/* 4300 */ {19,208},
+/* 4301 */ {19,208},
+/* 4302 */ {19,208},
+/* 4303 */ {19,208},
+/* 4304 */ {19,208},
+/* 4305 */ {19,208},
+/* 4306 */ {19,208},
+/* 4307 */ {19,208},
+/* 4308 */ {19,208},
+/* 4309 */ {19,208},
+/* 4310 */ {19,208},
+/* 4311 */ {19,208},
+/* 4312 */ {19,208},
+/* 4313 */ {19,208},
+/* 4314 */ {19,208},
+/* 4315 */ {19,208},
+/* 4316 */ {19,208},
+/* 4317 */ {19,208},
+/* 4318 */ {19,208},
+/* 4319 */ {19,208},
+/* 4320 */ {19,208},
+/* 4321 */ {19,208},
+/* 4322 */ {19,208},
+/* 4323 */ {19,208},
+/* 4324 */ {19,208},
+/* 4325 */ {19,208},
+/* 4326 */ {19,208},
+/* 4327 */ {19,208},
+/* 4328 */ {19,208},
+/* 4329 */ {19,208},
+/* 4330 */ {19,208},
+/* 4331 */ {19,208},
+/* 4332 */ {19,208},
+/* 4333 */ {19,208},
+/* 4334 */ {19,208},
+/* 4335 */ {19,208},
+/* 4336 */ {19,208},
+/* 4337 */ {19,208},
+/* 4338 */ {19,208},
+/* 4339 */ {19,208},
+/* 4340 */ {19,208},
+/* 4341 */ {19,208},
+/* 4342 */ {19,208},
+/* 4343 */ {19,208},
+/* 4344 */ {19,208},
+/* 4345 */ {19,208},
+/* 4346 */ {19,208},
+/* 4347 */ {19,208},
+/* 4348 */ {19,208},
+/* 4349 */ {19,208},
+/* 4350 */ {19,208},
+/* 4351 */ {19,208},
+/* 4352 */ {19,208},
+/* 4353 */ {19,208},
+/* 4354 */ {19,208},
+/* 4355 */ {19,208},
+/* 4356 */ {19,208},
+/* 4357 */ {19,208},
+/* 4358 */ {19,208},
+/* 4359 */ {19,208},
+/* 4360 */ {19,208},
+/* 4361 */ {19,208},
+/* 4362 */ {19,208},
+/* 4363 */ {19,208},
+/* 4364 */ {19,208},
+/* 4365 */ {19,208},
+/* 4366 */ {19,208},
+/* 4367 */ {19,208},
+/* 4368 */ {19,208},
+/* 4369 */ {19,208},
+/* 4370 */ {19,208},
+/* 4371 */ {19,208},
+/* 4372 */ {19,208},
+/* 4373 */ {19,208},
+/* 4374 */ {19,208},
+/* 4375 */ {19,208},
+/* 4376 */ {19,208},
+/* 4377 */ {19,208},
+/* 4378 */ {19,208},
+/* 4379 */ {19,208},
+/* 4380 */ {19,208},
+/* 4381 */ {19,208},
+/* 4382 */ {19,208},
+/* 4383 */ {19,208},
+/* 4384 */ {19,208},
+/* 4385 */ {19,208},
+/* 4386 */ {19,208},
+/* 4387 */ {19,208},
+/* 4388 */ {19,208},
+/* 4389 */ {19,208},
+/* 4390 */ {19,208},
+/* 4391 */ {19,208},
+/* 4392 */ {19,208},
+/* 4393 */ {19,208},
+/* 4394 */ {19,208},
+/* 4395 */ {19,208},
+/* 4396 */ {19,208},
+/* 4397 */ {19,208},
+/* 4398 */ {19,208},
+/* 4399 */ {19,208},
+/* 4400 */ {19,208},
+/* 4401 */ {19,208},
+/* 4402 */ {19,208},
+/* 4403 */ {19,208},
+/* 4404 */ {19,208},
+/* 4405 */ {19,208},
+/* 4406 */ {19,208},
+/* 4407 */ {19,208},
+/* 4408 */ {19,208},
+/* 4409 */ {19,208},
+/* 4410 */ {19,208},
+/* 4411 */ {19,208},
+/* 4412 */ {19,208},
+/* 4413 */ {19,208},
+/* 4414 */ {19,208},
+/* 4415 */ {19,208},
+/* 4416 */ {19,208},
+/* 4417 */ {19,208},
+/* 4418 */ {19,208},
+/* 4419 */ {19,208},
+/* 4420 */ {19,208},
+/* 4421 */ {19,208},
+/* 4422 */ {19,208},
+/* 4423 */ {19,208},
+/* 4424 */ {19,208},
+/* 4425 */ {19,208},
+/* 4426 */ {19,208},
+/* 4427 */ {19,208},
+/* 4428 */ {19,208},
+/* 4429 */ {19,208},
+/* 4430 */ {19,208},
+/* 4431 */ {19,208},
+/* 4432 */ {19,208},
+/* 4433 */ {19,208},
+/* 4434 */ {19,208},
+/* 4435 */ {19,208},
+/* 4436 */ {19,208},
+/* 4437 */ {19,208},
+/* 4438 */ {19,208},
+/* 4439 */ {19,208},
+/* 4440 */ {19,208},
+/* 4441 */ {19,208},
+/* 4442 */ {19,208},
+/* 4443 */ {19,208},
+/* 4444 */ {19,208},
+/* 4445 */ {19,208},
+/* 4446 */ {19,208},
+/* 4447 */ {19,208},
+/* 4448 */ {19,208},
+/* 4449 */ {19,208},
+/* 4450 */ {19,208},
+/* 4451 */ {19,208},
+/* 4452 */ {19,208},
+/* 4453 */ {19,208},
+/* 4454 */ {19,208},
+/* 4455 */ {19,208},
+/* 4456 */ {19,208},
+/* 4457 */ {19,208},
+/* 4458 */ {19,208},
+/* 4459 */ {19,208},
+/* 4460 */ {19,208},
+/* 4461 */ {19,208},
+/* 4462 */ {19,208},
+/* 4463 */ {19,208},
+/* 4464 */ {19,208},
+/* 4465 */ {19,208},
+/* 4466 */ {19,208},
+/* 4467 */ {19,208},
+/* 4468 */ {19,208},
+/* 4469 */ {19,208},
+/* 4470 */ {19,208},
+/* 4471 */ {19,208},
+/* 4472 */ {19,208},
+/* 4473 */ {19,208},
+/* 4474 */ {19,208},
+/* 4475 */ {19,208},
+/* 4476 */ {19,208},
+/* 4477 */ {19,208},
+/* 4478 */ {19,208},
+/* 4479 */ {19,208},
+/* 4480 */ {19,208},
+/* 4481 */ {19,208},
+/* 4482 */ {19,208},
+/* 4483 */ {19,208},
+/* 4484 */ {19,208},
+/* 4485 */ {19,208},
+/* 4486 */ {19,208},
+/* 4487 */ {19,208},
+/* 4488 */ {19,208},
+/* 4489 */ {19,208},
+/* 4490 */ {19,208},
+/* 4491 */ {19,208},
+/* 4492 */ {19,208},
+/* 4493 */ {19,208},
+/* 4494 */ {19,208},
+/* 4495 */ {19,208},
+/* 4496 */ {19,208},
+/* 4497 */ {19,208},
+/* 4498 */ {19,208},
+/* 4499 */ {19,208},
+/* 4500 */ {19,208},
+/* 4501 */ {19,208},
+/* 4502 */ {19,208},
+/* 4503 */ {19,208},
+/* 4504 */ {19,208},
+/* 4505 */ {19,208},
+/* 4506 */ {19,208},
+/* 4507 */ {19,208},
+/* 4508 */ {19,208},
+/* 4509 */ {19,208},
+/* 4510 */ {19,208},
+/* 4511 */ {19,208},
+/* 4512 */ {19,208},
+/* 4513 */ {19,208},
+/* 4514 */ {19,208},
+/* 4515 */ {19,208},
+/* 4516 */ {19,208},
+/* 4517 */ {19,208},
+/* 4518 */ {19,208},
+/* 4519 */ {19,208},
+/* 4520 */ {19,208},
+/* 4521 */ {19,208},
+/* 4522 */ {19,208},
+/* 4523 */ {19,208},
+/* 4524 */ {19,208},
+/* 4525 */ {19,208},
+/* 4526 */ {19,208},
+/* 4527 */ {19,208},
+/* 4528 */ {19,208},
+/* 4529 */ {19,208},
+/* 4530 */ {19,208},
+/* 4531 */ {19,208},
+/* 4532 */ {19,208},
+/* 4533 */ {19,208},
+/* 4534 */ {19,208},
+/* 4535 */ {19,208},
+/* 4536 */ {19,208},
+/* 4537 */ {19,208},
+/* 4538 */ {19,208},
+/* 4539 */ {19,208},
+/* 4540 */ {19,208},
+/* 4541 */ {19,208},
+/* 4542 */ {19,208},
+/* 4543 */ {19,208},
+/* 4544 */ {19,208},
+/* 4545 */ {19,208},
+/* 4546 */ {19,208},
+/* 4547 */ {19,208},
+/* 4548 */ {19,208},
+/* 4549 */ {19,208},
+/* 4550 */ {19,208},
+/* 4551 */ {19,208},
+/* 4552 */ {19,208},
+/* 4553 */ {19,208},
+/* 4554 */ {19,208},
+/* 4555 */ {19,208},
+/* 4556 */ {19,208},
+/* 4557 */ {19,208},
+/* 4558 */ {19,208},
+/* 4559 */ {19,208},
+/* 4560 */ {19,208},
+/* 4561 */ {19,208},
+/* 4562 */ {19,208},
+/* 4563 */ {19,208},
+/* 4564 */ {19,208},
+/* 4565 */ {19,208},
+/* 4566 */ {19,208},
+/* 4567 */ {19,208},
+/* 4568 */ {19,208},
+/* 4569 */ {19,208},
+/* 4570 */ {19,208},
+/* 4571 */ {19,208},
+/* 4572 */ {19,208},
+/* 4573 */ {19,208},
+/* 4574 */ {19,208},
+/* 4575 */ {19,208},
+/* 4576 */ {19,208},
+/* 4577 */ {19,208},
+/* 4578 */ {19,208},
+/* 4579 */ {19,208},
+/* 4580 */ {19,208},
+/* 4581 */ {19,208},
+/* 4582 */ {19,208},
+/* 4583 */ {19,208},
+/* 4584 */ {19,208},
+/* 4585 */ {19,208},
+/* 4586 */ {19,208},
+/* 4587 */ {19,208},
+/* 4588 */ {19,208},
+/* 4589 */ {19,208},
+/* 4590 */ {19,208},
+/* 4591 */ {19,208},
+/* 4592 */ {19,208},
+/* 4593 */ {19,208},
+/* 4594 */ {19,208},
+/* 4595 */ {19,208},
+/* 4596 */ {19,208},
+/* 4597 */ {19,208},
+/* 4598 */ {19,208},
+/* 4599 */ {19,208},
+/* 4600 */ {19,208},
+/* 4601 */ {19,208},
+/* 4602 */ {19,208},
+/* 4603 */ {19,208},
+/* 4604 */ {19,208},
+/* 4605 */ {19,208},
+/* 4606 */ {19,208},
+/* 4607 */ {19,208},
+/* 4608 */ {19,208},
+/* 4609 */ {19,208},
+/* 4610 */ {19,208},
+/* 4611 */ {19,208},
+/* 4612 */ {19,208},
+/* 4613 */ {19,208},
+/* 4614 */ {19,208},
+/* 4615 */ {19,208},
+/* 4616 */ {19,208},
+/* 4617 */ {19,208},
+/* 4618 */ {19,208},
+/* 4619 */ {19,208},
+/* 4620 */ {19,208},
+/* 4621 */ {19,208},
+/* 4622 */ {19,208},
+/* 4623 */ {19,208},
+/* 4624 */ {19,208},
+/* 4625 */ {19,208},
+/* 4626 */ {19,208},
+/* 4627 */ {19,208},
+/* 4628 */ {19,208},
+/* 4629 */ {19,208},
+/* 4630 */ {19,208},
+/* 4631 */ {19,208},
+/* 4632 */ {19,208},
+/* 4633 */ {19,208},
+/* 4634 */ {19,208},
+/* 4635 */ {19,208},
+/* 4636 */ {19,208},
+/* 4637 */ {19,208},
+/* 4638 */ {19,208},
+/* 4639 */ {19,208},
+/* 4640 */ {19,208},
+/* 4641 */ {19,208},
+/* 4642 */ {19,208},
+/* 4643 */ {19,208},
+/* 4644 */ {19,208},
+/* 4645 */ {19,208},
+/* 4646 */ {19,208},
+/* 4647 */ {19,208},
+/* 4648 */ {19,208},
+/* 4649 */ {19,208},
+/* 4650 */ {19,208},
+/* 4651 */ {19,208},
+/* 4652 */ {19,208},
+/* 4653 */ {19,208},
+/* 4654 */ {19,208},
+/* 4655 */ {19,208},
+/* 4656 */ {19,208},
+/* 4657 */ {19,208},
+/* 4658 */ {19,208},
+/* 4659 */ {19,208},
+/* 4660 */ {19,208},
+/* 4661 */ {19,208},
+/* 4662 */ {19,208},
+/* 4663 */ {19,208},
+/* 4664 */ {19,208},
+/* 4665 */ {19,208},
+/* 4666 */ {19,208},
+/* 4667 */ {19,208},
+/* 4668 */ {19,208},
+/* 4669 */ {19,208},
+/* 4670 */ {19,208},
+/* 4671 */ {19,208},
+/* 4672 */ {19,208},
+/* 4673 */ {19,208},
+/* 4674 */ {19,208},
+/* 4675 */ {19,208},
+/* 4676 */ {19,208},
+/* 4677 */ {19,208},
+/* 4678 */ {19,208},
+/* 4679 */ {19,208},
+/* 4680 */ {19,208},
+/* 4681 */ {19,208},
+/* 4682 */ {19,208},
+/* 4683 */ {19,208},
+/* 4684 */ {19,208},
+/* 4685 */ {19,208},
+/* 4686 */ {19,208},
+/* 4687 */ {19,208},
+/* 4688 */ {19,208},
+/* 4689 */ {19,208},
+/* 4690 */ {19,208},
+/* 4691 */ {19,208},
+/* 4692 */ {19,208},
+/* 4693 */ {19,208},
+/* 4694 */ {19,208},
+/* 4695 */ {19,208},
+/* 4696 */ {19,208},
+/* 4697 */ {19,208},
+/* 4698 */ {19,208},
+/* 4699 */ {19,208},
+/* 4700 */ {19,208},
+/* 4701 */ {19,208},
+/* 4702 */ {19,208},
+/* 4703 */ {19,208},
+/* 4704 */ {19,208},
+/* 4705 */ {19,208},
+/* 4706 */ {19,208},
+/* 4707 */ {19,208},
+/* 4708 */ {19,208},
+/* 4709 */ {19,208},
+/* 4710 */ {19,208},
+/* 4711 */ {19,208},
+/* 4712 */ {19,208},
+/* 4713 */ {19,208},
+/* 4714 */ {19,208},
+/* 4715 */ {19,208},
+/* 4716 */ {19,208},
+/* 4717 */ {19,208},
+/* 4718 */ {19,208},
+/* 4719 */ {19,208},
+/* 4720 */ {19,208},
+/* 4721 */ {19,208},
+/* 4722 */ {19,208},
+/* 4723 */ {19,208},
+/* 4724 */ {19,208},
+/* 4725 */ {19,208},
+/* 4726 */ {19,208},
+/* 4727 */ {19,208},
+/* 4728 */ {19,208},
+/* 4729 */ {19,208},
+/* 4730 */ {19,208},
+/* 4731 */ {19,208},
+/* 4732 */ {19,208},
+/* 4733 */ {19,208},
+/* 4734 */ {19,208},
+/* 4735 */ {19,208},
+/* 4736 */ {19,208},
+/* 4737 */ {19,208},
+/* 4738 */ {19,208},
+/* 4739 */ {19,208},
+/* 4740 */ {19,208},
+/* 4741 */ {19,208},
+/* 4742 */ {19,208},
+/* 4743 */ {19,208},
+/* 4744 */ {19,208},
+/* 4745 */ {19,208},
+/* 4746 */ {19,208},
+/* 4747 */ {19,208},
+/* 4748 */ {19,208},
+/* 4749 */ {19,208},
+/* 4750 */ {19,208},
+/* 4751 */ {19,208},
+/* 4752 */ {19,208},
+/* 4753 */ {19,208},
+/* 4754 */ {19,208},
+/* 4755 */ {19,208},
+/* 4756 */ {19,208},
+/* 4757 */ {19,208},
+/* 4758 */ {19,208},
+/* 4759 */ {19,208},
+/* 4760 */ {19,208},
+/* 4761 */ {19,208},
+/* 4762 */ {19,208},
+/* 4763 */ {19,208},
+/* 4764 */ {19,208},
+/* 4765 */ {19,208},
+/* 4766 */ {19,208},
+/* 4767 */ {19,208},
+/* 4768 */ {19,208},
+/* 4769 */ {19,208},
+/* 4770 */ {19,208},
+/* 4771 */ {19,208},
+/* 4772 */ {19,208},
+/* 4773 */ {19,208},
+/* 4774 */ {19,208},
+/* 4775 */ {19,208},
+/* 4776 */ {19,208},
+/* 4777 */ {19,208},
+/* 4778 */ {19,208},
+/* 4779 */ {19,208},
+/* 4780 */ {19,208},
+/* 4781 */ {19,208},
+/* 4782 */ {19,208},
+/* 4783 */ {19,208},
+/* 4784 */ {19,208},
+/* 4785 */ {19,208},
+/* 4786 */ {19,208},
+/* 4787 */ {19,208},
+/* 4788 */ {19,208},
+/* 4789 */ {19,208},
+/* 4790 */ {19,208},
+/* 4791 */ {19,208},
+/* 4792 */ {19,208},
+/* 4793 */ {19,208},
+/* 4794 */ {19,208},
+/* 4795 */ {19,208},
+/* 4796 */ {19,208},
+/* 4797 */ {19,208},
+/* 4798 */ {19,208},
+/* 4799 */ {19,208},
+/* 4800 */ {19,208},
+/* 4801 */ {19,208},
+/* 4802 */ {19,208},
+/* 4803 */ {19,208},
+/* 4804 */ {19,208},
+/* 4805 */ {19,208},
+/* 4806 */ {19,208},
+/* 4807 */ {19,208},
+/* 4808 */ {19,208},
+/* 4809 */ {19,208},
+/* 4810 */ {19,208},
+/* 4811 */ {19,208},
+/* 4812 */ {19,208},
+/* 4813 */ {19,208},
+/* 4814 */ {19,208},
+/* 4815 */ {19,208},
+/* 4816 */ {19,208},
+/* 4817 */ {19,208},
+/* 4818 */ {19,208},
+/* 4819 */ {19,208},
+/* 4820 */ {19,208},
+/* 4821 */ {19,208},
+/* 4822 */ {19,208},
+/* 4823 */ {19,208},
+/* 4824 */ {19,208},
+/* 4825 */ {19,208},
+/* 4826 */ {19,208},
+/* 4827 */ {19,208},
+/* 4828 */ {19,208},
+/* 4829 */ {19,208},
+/* 4830 */ {19,208},
+/* 4831 */ {19,208},
+/* 4832 */ {19,208},
+/* 4833 */ {19,208},
+/* 4834 */ {19,208},
+/* 4835 */ {19,208},
+/* 4836 */ {19,208},
+/* 4837 */ {19,208},
+/* 4838 */ {19,208},
+/* 4839 */ {19,208},
+/* 4840 */ {19,208},
+/* 4841 */ {19,208},
+/* 4842 */ {19,208},
+/* 4843 */ {19,208},
+/* 4844 */ {19,208},
+/* 4845 */ {19,208},
+/* 4846 */ {19,208},
+/* 4847 */ {19,208},
+/* 4848 */ {19,208},
+/* 4849 */ {19,208},
+/* 4850 */ {19,208},
+/* 4851 */ {19,208},
+/* 4852 */ {19,208},
+/* 4853 */ {19,208},
+/* 4854 */ {19,208},
+/* 4855 */ {19,208},
+/* 4856 */ {19,208},
+/* 4857 */ {19,208},
+/* 4858 */ {19,208},
+/* 4859 */ {19,208},
+/* 4860 */ {19,208},
+/* 4861 */ {19,208},
+/* 4862 */ {19,208},
+/* 4863 */ {19,208},
+/* 4864 */ {19,208},
+/* 4865 */ {19,208},
+/* 4866 */ {19,208},
+/* 4867 */ {19,208},
+/* 4868 */ {19,208},
+/* 4869 */ {19,208},
+/* 4870 */ {19,208},
+/* 4871 */ {19,208},
+/* 4872 */ {19,208},
+/* 4873 */ {19,208},
+/* 4874 */ {19,208},
+/* 4875 */ {19,208},
+/* 4876 */ {19,208},
+/* 4877 */ {19,208},
+/* 4878 */ {19,208},
+/* 4879 */ {19,208},
+/* 4880 */ {19,208},
+/* 4881 */ {19,208},
+/* 4882 */ {19,208},
+/* 4883 */ {19,208},
+/* 4884 */ {19,208},
+/* 4885 */ {19,208},
+/* 4886 */ {19,208},
+/* 4887 */ {19,208},
+/* 4888 */ {19,208},
+/* 4889 */ {19,208},
+/* 4890 */ {19,208},
+/* 4891 */ {19,208},
+/* 4892 */ {19,208},
+/* 4893 */ {19,208},
+/* 4894 */ {19,208},
+/* 4895 */ {19,208},
+/* 4896 */ {19,208},
+/* 4897 */ {19,208},
+/* 4898 */ {19,208},
+/* 4899 */ {19,208},
+/* 4900 */ {19,208},
+/* 4901 */ {19,208},
+/* 4902 */ {19,208},
+/* 4903 */ {19,208},
+/* 4904 */ {19,208},
+/* 4905 */ {19,208},
+/* 4906 */ {19,208},
+/* 4907 */ {19,208},
+/* 4908 */ {19,208},
+/* 4909 */ {19,208},
+/* 4910 */ {19,208},
+/* 4911 */ {19,208},
+/* 4912 */ {19,208},
+/* 4913 */ {19,208},
+/* 4914 */ {19,208},
+/* 4915 */ {19,208},
+/* 4916 */ {19,208},
+/* 4917 */ {19,208},
+/* 4918 */ {19,208},
+/* 4919 */ {19,208},
+/* 4920 */ {19,208},
+/* 4921 */ {19,208},
+/* 4922 */ {19,208},
+/* 4923 */ {19,208},
+/* 4924 */ {19,208},
+/* 4925 */ {19,208},
+/* 4926 */ {19,208},
+/* 4927 */ {19,208},
+/* 4928 */ {19,208},
+/* 4929 */ {19,208},
+/* 4930 */ {19,208},
+/* 4931 */ {19,208},
+/* 4932 */ {19,208},
+/* 4933 */ {19,208},
+/* 4934 */ {19,208},
+/* 4935 */ {19,208},
+/* 4936 */ {19,208},
+/* 4937 */ {19,208},
+/* 4938 */ {19,208},
+/* 4939 */ {19,208},
+/* 4940 */ {19,208},
+/* 4941 */ {19,208},
+/* 4942 */ {19,208},
+/* 4943 */ {19,208},
+/* 4944 */ {19,208},
+/* 4945 */ {19,208},
+/* 4946 */ {19,208},
+/* 4947 */ {19,208},
+/* 4948 */ {19,208},
+/* 4949 */ {19,208},
+/* 4950 */ {19,208},
+/* 4951 */ {19,208},
+/* 4952 */ {19,208},
+/* 4953 */ {19,208},
+/* 4954 */ {19,208},
+/* 4955 */ {19,208},
+/* 4956 */ {19,208},
+/* 4957 */ {19,208},
+/* 4958 */ {19,208},
+/* 4959 */ {19,208},
+/* 4960 */ {19,208},
+/* 4961 */ {19,208},
+/* 4962 */ {19,208},
+/* 4963 */ {19,208},
+/* 4964 */ {19,208},
+/* 4965 */ {19,208},
+/* 4966 */ {19,208},
+/* 4967 */ {19,208},
+/* 4968 */ {19,208},
+/* 4969 */ {19,208},
+/* 4970 */ {19,208},
+/* 4971 */ {19,208},
+/* 4972 */ {19,208},
+/* 4973 */ {19,208},
+/* 4974 */ {19,208},
+/* 4975 */ {19,208},
+/* 4976 */ {19,208},
+/* 4977 */ {19,208},
+/* 4978 */ {19,208},
+/* 4979 */ {19,208},
+/* 4980 */ {19,208},
+/* 4981 */ {19,208},
+/* 4982 */ {19,208},
+/* 4983 */ {19,208},
+/* 4984 */ {19,208},
+/* 4985 */ {19,208},
+/* 4986 */ {19,208},
+/* 4987 */ {19,208},
+/* 4988 */ {19,208},
+/* 4989 */ {19,208},
+/* 4990 */ {19,208},
+/* 4991 */ {19,208},
+/* 4992 */ {19,208},
+/* 4993 */ {19,208},
+/* 4994 */ {19,208},
+/* 4995 */ {19,208},
+/* 4996 */ {19,208},
+/* 4997 */ {19,208},
+/* 4998 */ {19,208},
+/* 4999 */ {19,208},
+/* 5000 */ {19,208},
+/* 5001 */ {19,208},
+/* 5002 */ {19,208},
+/* 5003 */ {19,208},
+/* 5004 */ {19,208},
+/* 5005 */ {19,208},
+/* 5006 */ {19,208},
+/* 5007 */ {19,208},
+/* 5008 */ {19,208},
+/* 5009 */ {19,208},
+/* 5010 */ {19,208},
+/* 5011 */ {19,208},
+/* 5012 */ {19,208},
+/* 5013 */ {19,208},
+/* 5014 */ {19,208},
+/* 5015 */ {19,208},
+/* 5016 */ {19,208},
+/* 5017 */ {19,208},
+/* 5018 */ {19,208},
+/* 5019 */ {19,208},
+/* 5020 */ {19,208},
+/* 5021 */ {19,208},
+/* 5022 */ {19,208},
+/* 5023 */ {19,208},
+/* 5024 */ {19,208},
+/* 5025 */ {19,208},
+/* 5026 */ {19,208},
+/* 5027 */ {19,208},
+/* 5028 */ {19,208},
+/* 5029 */ {19,208},
+/* 5030 */ {19,208},
+/* 5031 */ {19,208},
+/* 5032 */ {19,208},
+/* 5033 */ {19,208},
+/* 5034 */ {19,208},
+/* 5035 */ {19,208},
+/* 5036 */ {19,208},
+/* 5037 */ {19,208},
+/* 5038 */ {19,208},
+/* 5039 */ {19,208},
+/* 5040 */ {19,208},
+/* 5041 */ {19,208},
+/* 5042 */ {19,208},
+/* 5043 */ {19,208},
+/* 5044 */ {19,208},
+/* 5045 */ {19,208},
+/* 5046 */ {19,208},
+/* 5047 */ {19,208},
+/* 5048 */ {19,208},
+/* 5049 */ {19,208},
+/* 5050 */ {19,208},
+/* 5051 */ {19,208},
+/* 5052 */ {19,208},
+/* 5053 */ {19,208},
+/* 5054 */ {19,208},
+/* 5055 */ {19,208},
+/* 5056 */ {19,208},
+/* 5057 */ {19,208},
+/* 5058 */ {19,208},
+/* 5059 */ {19,208},
+/* 5060 */ {19,208},
+/* 5061 */ {19,208},
+/* 5062 */ {19,208},
+/* 5063 */ {19,208},
+/* 5064 */ {19,208},
+/* 5065 */ {19,208},
+/* 5066 */ {19,208},
+/* 5067 */ {19,208},
+/* 5068 */ {19,208},
+/* 5069 */ {19,208},
+/* 5070 */ {19,208},
+/* 5071 */ {19,208},
+/* 5072 */ {19,208},
+/* 5073 */ {19,208},
+/* 5074 */ {19,208},
+/* 5075 */ {19,208},
+/* 5076 */ {19,208},
+/* 5077 */ {19,208},
+/* 5078 */ {19,208},
+/* 5079 */ {19,208},
+/* 5080 */ {19,208},
+/* 5081 */ {19,208},
+/* 5082 */ {19,208},
+/* 5083 */ {19,208},
+/* 5084 */ {19,208},
+/* 5085 */ {19,208},
+/* 5086 */ {19,208},
+/* 5087 */ {19,208},
+/* 5088 */ {19,208},
+/* 5089 */ {19,208},
+/* 5090 */ {19,208},
+/* 5091 */ {19,208},
+/* 5092 */ {19,208},
+/* 5093 */ {19,208},
+/* 5094 */ {19,208},
+/* 5095 */ {19,208},
+/* 5096 */ {19,208},
+/* 5097 */ {19,208},
+/* 5098 */ {19,208},
+/* 5099 */ {19,208},
+/* 5100 */ {19,208},
+/* 5101 */ {19,208},
+/* 5102 */ {19,208},
+/* 5103 */ {19,208},
+/* 5104 */ {19,208},
+/* 5105 */ {19,208},
+/* 5106 */ {19,208},
+/* 5107 */ {19,208},
+/* 5108 */ {19,208},
+/* 5109 */ {19,208},
+/* 5110 */ {19,208},
+/* 5111 */ {19,208},
+/* 5112 */ {19,208},
+/* 5113 */ {19,208},
+/* 5114 */ {19,208},
+/* 5115 */ {19,208},
+/* 5116 */ {19,208},
+/* 5117 */ {19,208},
+/* 5118 */ {19,208},
+/* 5119 */ {19,208},
+/* 5120 */ {19,208},
+/* 5121 */ {19,208},
+/* 5122 */ {19,208},
+/* 5123 */ {19,208},
+/* 5124 */ {19,208},
+/* 5125 */ {19,208},
+/* 5126 */ {19,208},
+/* 5127 */ {19,208},
+/* 5128 */ {19,208},
+/* 5129 */ {19,208},
+/* 5130 */ {19,208},
+/* 5131 */ {19,208},
+/* 5132 */ {19,208},
+/* 5133 */ {19,208},
+/* 5134 */ {19,208},
+/* 5135 */ {19,208},
+/* 5136 */ {19,208},
+/* 5137 */ {19,208},
+/* 5138 */ {19,208},
+/* 5139 */ {19,208},
+/* 5140 */ {19,208},
+/* 5141 */ {19,208},
+/* 5142 */ {19,208},
+/* 5143 */ {19,208},
+/* 5144 */ {19,208},
+/* 5145 */ {19,208},
+/* 5146 */ {19,208},
+/* 5147 */ {19,208},
+/* 5148 */ {19,208},
+/* 5149 */ {19,208},
+/* 5150 */ {19,208},
+/* 5151 */ {19,208},
+/* 5152 */ {19,208},
+/* 5153 */ {19,208},
+/* 5154 */ {19,208},
+/* 5155 */ {19,208},
+/* 5156 */ {19,208},
+/* 5157 */ {19,208},
+/* 5158 */ {19,208},
+/* 5159 */ {19,208},
+/* 5160 */ {19,208},
+/* 5161 */ {19,208},
+/* 5162 */ {19,208},
+/* 5163 */ {19,208},
+/* 5164 */ {19,208},
+/* 5165 */ {19,208},
+/* 5166 */ {19,208},
+/* 5167 */ {19,208},
+/* 5168 */ {19,208},
+/* 5169 */ {19,208},
+/* 5170 */ {19,208},
+/* 5171 */ {19,208},
+/* 5172 */ {19,208},
+/* 5173 */ {19,208},
+/* 5174 */ {19,208},
+/* 5175 */ {19,208},
+/* 5176 */ {19,208},
+/* 5177 */ {19,208},
+/* 5178 */ {19,208},
+/* 5179 */ {19,208},
+/* 5180 */ {19,208},
+/* 5181 */ {19,208},
+/* 5182 */ {19,208},
+/* 5183 */ {19,208},
+/* 5184 */ {19,208},
+/* 5185 */ {19,208},
+/* 5186 */ {19,208},
+/* 5187 */ {19,208},
+/* 5188 */ {19,208},
+/* 5189 */ {19,208},
+/* 5190 */ {19,208},
+/* 5191 */ {19,208},
+/* 5192 */ {19,208},
+/* 5193 */ {19,208},
+/* 5194 */ {19,208},
+/* 5195 */ {19,208},
+/* 5196 */ {19,208},
+/* 5197 */ {19,208},
+/* 5198 */ {19,208},
+/* 5199 */ {19,208},
+/* 5200 */ {19,208},
+/* 5201 */ {19,208},
+/* 5202 */ {19,208},
+/* 5203 */ {19,208},
+/* 5204 */ {19,208},
+/* 5205 */ {19,208},
+/* 5206 */ {19,208},
+/* 5207 */ {19,208},
+/* 5208 */ {19,208},
+/* 5209 */ {19,208},
+/* 5210 */ {19,208},
+/* 5211 */ {19,208},
+/* 5212 */ {19,208},
+/* 5213 */ {19,208},
+/* 5214 */ {19,208},
+/* 5215 */ {19,208},
+/* 5216 */ {19,208},
+/* 5217 */ {19,208},
+/* 5218 */ {19,208},
+/* 5219 */ {19,208},
+/* 5220 */ {19,208},
+/* 5221 */ {19,208},
+/* 5222 */ {19,208},
+/* 5223 */ {19,208},
+/* 5224 */ {19,208},
+/* 5225 */ {19,208},
+/* 5226 */ {19,208},
+/* 5227 */ {19,208},
+/* 5228 */ {19,208},
+/* 5229 */ {19,208},
+/* 5230 */ {19,208},
+/* 5231 */ {19,208},
+/* 5232 */ {19,208},
+/* 5233 */ {19,208},
+/* 5234 */ {19,208},
+/* 5235 */ {19,208},
+/* 5236 */ {19,208},
+/* 5237 */ {19,208},
+/* 5238 */ {19,208},
+/* 5239 */ {19,208},
+/* 5240 */ {19,208},
+/* 5241 */ {19,208},
+/* 5242 */ {19,208},
+/* 5243 */ {19,208},
+/* 5244 */ {19,208},
+/* 5245 */ {19,208},
+/* 5246 */ {19,208},
+/* 5247 */ {19,208},
+/* 5248 */ {19,208},
+/* 5249 */ {19,208},
+/* 5250 */ {19,208},
+/* 5251 */ {19,208},
+/* 5252 */ {19,208},
+/* 5253 */ {19,208},
+/* 5254 */ {19,208},
+/* 5255 */ {19,208},
+/* 5256 */ {19,208},
+/* 5257 */ {19,208},
+/* 5258 */ {19,208},
+/* 5259 */ {19,208},
+/* 5260 */ {19,208},
+/* 5261 */ {19,208},
+/* 5262 */ {19,208},
+/* 5263 */ {19,208},
+/* 5264 */ {19,208},
+/* 5265 */ {19,208},
+/* 5266 */ {19,208},
+/* 5267 */ {19,208},
+/* 5268 */ {19,208},
+/* 5269 */ {19,208},
+/* 5270 */ {19,208},
+/* 5271 */ {19,208},
+/* 5272 */ {19,208},
+/* 5273 */ {19,208},
+/* 5274 */ {19,208},
+/* 5275 */ {19,208},
+/* 5276 */ {19,208},
+/* 5277 */ {19,208},
+/* 5278 */ {19,208},
+/* 5279 */ {19,208},
+/* 5280 */ {19,208},
+/* 5281 */ {19,208},
+/* 5282 */ {19,208},
+/* 5283 */ {19,208},
+/* 5284 */ {19,208},
+/* 5285 */ {19,208},
+/* 5286 */ {19,208},
+/* 5287 */ {19,208},
+/* 5288 */ {19,208},
+/* 5289 */ {19,208},
+/* 5290 */ {19,208},
+/* 5291 */ {19,208},
+/* 5292 */ {19,208},
+/* 5293 */ {19,208},
+/* 5294 */ {19,208},
+/* 5295 */ {19,208},
+/* 5296 */ {19,208},
+/* 5297 */ {19,208},
+/* 5298 */ {19,208},
+/* 5299 */ {19,208},
+/* 5300 */ {19,208},
+/* 5301 */ {19,208},
+/* 5302 */ {19,208},
+/* 5303 */ {19,208},
+/* 5304 */ {19,208},
+/* 5305 */ {19,208},
+/* 5306 */ {19,208},
+/* 5307 */ {19,208},
+/* 5308 */ {19,208},
+/* 5309 */ {19,208},
+/* 5310 */ {19,208},
+/* 5311 */ {19,208},
+/* 5312 */ {19,208},
+/* 5313 */ {19,208},
+/* 5314 */ {19,208},
+/* 5315 */ {19,208},
+/* 5316 */ {19,208},
+/* 5317 */ {19,208},
+/* 5318 */ {19,208},
+/* 5319 */ {19,208},
+/* 5320 */ {19,208},
+/* 5321 */ {19,208},
+/* 5322 */ {19,208},
+/* 5323 */ {19,208},
+/* 5324 */ {19,208},
+/* 5325 */ {19,208},
+/* 5326 */ {19,208},
+/* 5327 */ {19,208},
+/* 5328 */ {19,208},
+/* 5329 */ {19,208},
+/* 5330 */ {19,208},
+/* 5331 */ {19,208},
+/* 5332 */ {19,208},
+/* 5333 */ {19,208},
+/* 5334 */ {19,208},
+/* 5335 */ {19,208},
+/* 5336 */ {19,208},
+/* 5337 */ {19,208},
+/* 5338 */ {19,208},
+/* 5339 */ {19,208},
+/* 5340 */ {19,208},
+/* 5341 */ {19,208},
+/* 5342 */ {19,208},
+/* 5343 */ {19,208},
+/* 5344 */ {19,208},
+/* 5345 */ {19,208},
+/* 5346 */ {19,208},
+/* 5347 */ {19,208},
+/* 5348 */ {19,208},
+/* 5349 */ {19,208},
+/* 5350 */ {19,208},
+/* 5351 */ {19,208},
+/* 5352 */ {19,208},
+/* 5353 */ {19,208},
+/* 5354 */ {19,208},
+/* 5355 */ {19,208},
+/* 5356 */ {19,208},
+/* 5357 */ {19,208},
+/* 5358 */ {19,208},
+/* 5359 */ {19,208},
+/* 5360 */ {19,208},
+/* 5361 */ {19,208},
+/* 5362 */ {19,208},
+/* 5363 */ {19,208},
+/* 5364 */ {19,208},
+/* 5365 */ {19,208},
+/* 5366 */ {19,208},
+/* 5367 */ {19,208},
+/* 5368 */ {19,208},
+/* 5369 */ {19,208},
+/* 5370 */ {19,208},
+/* 5371 */ {19,208},
+/* 5372 */ {19,208},
+/* 5373 */ {19,208},
+/* 5374 */ {19,208},
+/* 5375 */ {19,208},
+/* 5376 */ {19,208},
+/* 5377 */ {19,208},
+/* 5378 */ {19,208},
+/* 5379 */ {19,208},
+/* 5380 */ {19,208},
+/* 5381 */ {19,208},
+/* 5382 */ {19,208},
+/* 5383 */ {19,208},
+/* 5384 */ {19,208},
+/* 5385 */ {19,208},
+/* 5386 */ {19,208},
+/* 5387 */ {19,208},
+/* 5388 */ {19,208},
+/* 5389 */ {19,208},
+/* 5390 */ {19,208},
+/* 5391 */ {19,208},
+/* 5392 */ {19,208},
+/* 5393 */ {19,208},
+/* 5394 */ {19,208},
+/* 5395 */ {19,208},
+/* 5396 */ {19,208},
+/* 5397 */ {19,208},
+/* 5398 */ {19,208},
+/* 5399 */ {19,208},
+/* 5400 */ {19,208},
+/* 5401 */ {19,208},
+/* 5402 */ {19,208},
+/* 5403 */ {19,208},
+/* 5404 */ {19,208},
+/* 5405 */ {19,208},
+/* 5406 */ {19,208},
+/* 5407 */ {19,208},
+/* 5408 */ {19,208},
+/* 5409 */ {19,208},
+/* 5410 */ {19,208},
+/* 5411 */ {19,208},
+/* 5412 */ {19,208},
+/* 5413 */ {19,208},
+/* 5414 */ {19,208},
+/* 5415 */ {19,208},
+/* 5416 */ {19,208},
+/* 5417 */ {19,208},
+/* 5418 */ {19,208},
+/* 5419 */ {19,208},
+/* 5420 */ {19,208},
+/* 5421 */ {19,208},
+/* 5422 */ {19,208},
+/* 5423 */ {19,208},
+/* 5424 */ {19,208},
+/* 5425 */ {19,208},
+/* 5426 */ {19,208},
+/* 5427 */ {19,208},
+/* 5428 */ {19,208},
+/* 5429 */ {19,208},
+/* 5430 */ {19,208},
+/* 5431 */ {19,208},
+/* 5432 */ {19,208},
+/* 5433 */ {19,208},
+/* 5434 */ {19,208},
+/* 5435 */ {19,208},
+/* 5436 */ {19,208},
+/* 5437 */ {19,208},
+/* 5438 */ {19,208},
+/* 5439 */ {19,208},
+/* 5440 */ {19,208},
+/* 5441 */ {19,208},
+/* 5442 */ {19,208},
+/* 5443 */ {19,208},
+/* 5444 */ {19,208},
+/* 5445 */ {19,208},
+/* 5446 */ {19,208},
+/* 5447 */ {19,208},
+/* 5448 */ {19,208},
+/* 5449 */ {19,208},
+/* 5450 */ {19,208},
+/* 5451 */ {19,208},
+/* 5452 */ {19,208},
+/* 5453 */ {19,208},
+/* 5454 */ {19,208},
+/* 5455 */ {19,208},
+/* 5456 */ {19,208},
+/* 5457 */ {19,208},
+/* 5458 */ {19,208},
+/* 5459 */ {19,208},
+/* 5460 */ {19,208},
+/* 5461 */ {19,208},
+/* 5462 */ {19,208},
+/* 5463 */ {19,208},
+/* 5464 */ {19,208},
+/* 5465 */ {19,208},
+/* 5466 */ {19,208},
+/* 5467 */ {19,208},
+/* 5468 */ {19,208},
+/* 5469 */ {19,208},
+/* 5470 */ {19,208},
+/* 5471 */ {19,208},
+/* 5472 */ {19,208},
+/* 5473 */ {19,208},
+/* 5474 */ {19,208},
+/* 5475 */ {19,208},
+/* 5476 */ {19,208},
+/* 5477 */ {19,208},
+/* 5478 */ {19,208},
+/* 5479 */ {19,208},
+/* 5480 */ {19,208},
+/* 5481 */ {19,208},
+/* 5482 */ {19,208},
+/* 5483 */ {19,208},
+/* 5484 */ {19,208},
+/* 5485 */ {19,208},
+/* 5486 */ {19,208},
+/* 5487 */ {19,208},
+/* 5488 */ {19,208},
+/* 5489 */ {19,208},
+/* 5490 */ {19,208},
+/* 5491 */ {19,208},
+/* 5492 */ {19,208},
+/* 5493 */ {19,208},
+/* 5494 */ {19,208},
+/* 5495 */ {19,208},
+/* 5496 */ {19,208},
+/* 5497 */ {19,208},
+/* 5498 */ {19,208},
+/* 5499 */ {19,208},
+/* 5500 */ {19,208},
+/* 5501 */ {19,208},
+/* 5502 */ {19,208},
+/* 5503 */ {19,208},
+/* 5504 */ {19,208},
+/* 5505 */ {19,208},
+/* 5506 */ {19,208},
+/* 5507 */ {19,208},
+/* 5508 */ {19,208},
+/* 5509 */ {19,208},
+/* 5510 */ {19,208},
+/* 5511 */ {19,208},
+/* 5512 */ {19,208},
+/* 5513 */ {19,208},
+/* 5514 */ {19,208},
+/* 5515 */ {19,208},
+/* 5516 */ {19,208},
+/* 5517 */ {19,208},
+/* 5518 */ {19,208},
+/* 5519 */ {19,208},
+/* 5520 */ {19,208},
+/* 5521 */ {19,208},
+/* 5522 */ {19,208},
+/* 5523 */ {19,208},
+/* 5524 */ {19,208},
+/* 5525 */ {19,208},
+/* 5526 */ {19,208},
+/* 5527 */ {19,208},
+/* 5528 */ {19,208},
+/* 5529 */ {19,208},
+/* 5530 */ {19,208},
+/* 5531 */ {19,208},
+/* 5532 */ {19,208},
+/* 5533 */ {19,208},
+/* 5534 */ {19,208},
+/* 5535 */ {19,208},
+/* 5536 */ {19,208},
+/* 5537 */ {19,208},
+/* 5538 */ {19,208},
+/* 5539 */ {19,208},
+/* 5540 */ {19,208},
+/* 5541 */ {19,208},
+/* 5542 */ {19,208},
+/* 5543 */ {19,208},
+/* 5544 */ {19,208},
+/* 5545 */ {19,208},
+/* 5546 */ {19,208},
+/* 5547 */ {19,208},
+/* 5548 */ {19,208},
+/* 5549 */ {19,208},
+/* 5550 */ {19,208},
+/* 5551 */ {19,208},
+/* 5552 */ {19,208},
+/* 5553 */ {19,208},
+/* 5554 */ {19,208},
+/* 5555 */ {19,208},
+/* 5556 */ {19,208},
+/* 5557 */ {19,208},
+/* 5558 */ {19,208},
+/* 5559 */ {19,208},
+/* 5560 */ {19,208},
+/* 5561 */ {19,208},
+/* 5562 */ {19,208},
+/* 5563 */ {19,208},
+/* 5564 */ {19,208},
+/* 5565 */ {19,208},
+/* 5566 */ {19,208},
+/* 5567 */ {19,208},
+/* 5568 */ {19,208},
+/* 5569 */ {19,208},
+/* 5570 */ {19,208},
+/* 5571 */ {19,208},
+/* 5572 */ {19,208},
+/* 5573 */ {19,208},
+/* 5574 */ {19,208},
+/* 5575 */ {19,208},
+/* 5576 */ {19,208},
+/* 5577 */ {19,208},
+/* 5578 */ {19,208},
+/* 5579 */ {19,208},
+/* 5580 */ {19,208},
+/* 5581 */ {19,208},
+/* 5582 */ {19,208},
+/* 5583 */ {19,208},
+/* 5584 */ {19,208},
+/* 5585 */ {19,208},
+/* 5586 */ {19,208},
+/* 5587 */ {19,208},
+/* 5588 */ {19,208},
+/* 5589 */ {19,208},
+/* 5590 */ {19,208},
+/* 5591 */ {19,208},
+/* 5592 */ {19,208},
+/* 5593 */ {19,208},
+/* 5594 */ {19,208},
+/* 5595 */ {19,208},
+/* 5596 */ {19,208},
+/* 5597 */ {19,208},
+/* 5598 */ {19,208},
+/* 5599 */ {19,208},
+/* 5600 */ {19,208},
+/* 5601 */ {19,208},
+/* 5602 */ {19,208},
+/* 5603 */ {19,208},
+/* 5604 */ {19,208},
+/* 5605 */ {19,208},
+/* 5606 */ {19,208},
+/* 5607 */ {19,208},
+/* 5608 */ {19,208},
+/* 5609 */ {19,208},
+/* 5610 */ {19,208},
+/* 5611 */ {19,208},
+/* 5612 */ {19,208},
+/* 5613 */ {19,208},
+/* 5614 */ {19,208},
+/* 5615 */ {19,208},
+/* 5616 */ {19,208},
+/* 5617 */ {19,208},
+/* 5618 */ {19,208},
+/* 5619 */ {19,208},
+/* 5620 */ {19,208},
+/* 5621 */ {19,208},
+/* 5622 */ {19,208},
+/* 5623 */ {19,208},
+/* 5624 */ {19,208},
+/* 5625 */ {19,208},
+/* 5626 */ {19,208},
+/* 5627 */ {19,208},
+/* 5628 */ {19,208},
+/* 5629 */ {19,208},
+/* 5630 */ {19,208},
+/* 5631 */ {19,208},
+/* 5632 */ {19,208},
+/* 5633 */ {19,208},
+/* 5634 */ {19,208},
+/* 5635 */ {19,208},
+/* 5636 */ {19,208},
+/* 5637 */ {19,208},
+/* 5638 */ {19,208},
+/* 5639 */ {19,208},
+/* 5640 */ {19,208},
+/* 5641 */ {19,208},
+/* 5642 */ {19,208},
+/* 5643 */ {19,208},
+/* 5644 */ {19,208},
+/* 5645 */ {19,208},
+/* 5646 */ {19,208},
+/* 5647 */ {19,208},
+/* 5648 */ {19,208},
+/* 5649 */ {19,208},
+/* 5650 */ {19,208},
+/* 5651 */ {19,208},
+/* 5652 */ {19,208},
+/* 5653 */ {19,208},
+/* 5654 */ {19,208},
+/* 5655 */ {19,208},
+/* 5656 */ {19,208},
+/* 5657 */ {19,208},
+/* 5658 */ {19,208},
+/* 5659 */ {19,208},
+/* 5660 */ {19,208},
+/* 5661 */ {19,208},
+/* 5662 */ {19,208},
+/* 5663 */ {19,208},
+/* 5664 */ {19,208},
+/* 5665 */ {19,208},
+/* 5666 */ {19,208},
+/* 5667 */ {19,208},
+/* 5668 */ {19,208},
+/* 5669 */ {19,208},
+/* 5670 */ {19,208},
+/* 5671 */ {19,208},
+/* 5672 */ {19,208},
+/* 5673 */ {19,208},
+/* 5674 */ {19,208},
+/* 5675 */ {19,208},
+/* 5676 */ {19,208},
+/* 5677 */ {19,208},
+/* 5678 */ {19,208},
+/* 5679 */ {19,208},
+/* 5680 */ {19,208},
+/* 5681 */ {19,208},
+/* 5682 */ {19,208},
+/* 5683 */ {19,208},
+/* 5684 */ {19,208},
+/* 5685 */ {19,208},
+/* 5686 */ {19,208},
+/* 5687 */ {19,208},
+/* 5688 */ {19,208},
+/* 5689 */ {19,208},
+/* 5690 */ {19,208},
+/* 5691 */ {19,208},
+/* 5692 */ {19,208},
+/* 5693 */ {19,208},
+/* 5694 */ {19,208},
+/* 5695 */ {19,208},
+/* 5696 */ {19,208},
+/* 5697 */ {19,208},
+/* 5698 */ {19,208},
+/* 5699 */ {19,208},
+/* 5700 */ {19,208},
+/* 5701 */ {19,208},
+/* 5702 */ {19,208},
+/* 5703 */ {19,208},
+/* 5704 */ {19,208},
+/* 5705 */ {19,208},
+/* 5706 */ {19,208},
+/* 5707 */ {19,208},
+/* 5708 */ {19,208},
+/* 5709 */ {19,208},
+/* 5710 */ {19,208},
+/* 5711 */ {19,208},
+/* 5712 */ {19,208},
+/* 5713 */ {19,208},
+/* 5714 */ {19,208},
+/* 5715 */ {19,208},
+/* 5716 */ {19,208},
+/* 5717 */ {19,208},
+/* 5718 */ {19,208},
+/* 5719 */ {19,208},
+/* 5720 */ {19,208},
+/* 5721 */ {19,208},
+/* 5722 */ {19,208},
+/* 5723 */ {19,208},
+/* 5724 */ {19,208},
+/* 5725 */ {19,208},
+/* 5726 */ {19,208},
+/* 5727 */ {19,208},
+/* 5728 */ {19,208},
+/* 5729 */ {19,208},
+/* 5730 */ {19,208},
+/* 5731 */ {19,208},
+/* 5732 */ {19,208},
+/* 5733 */ {19,208},
+/* 5734 */ {19,208},
+/* 5735 */ {19,208},
+/* 5736 */ {19,208},
+/* 5737 */ {19,208},
+/* 5738 */ {19,208},
+/* 5739 */ {19,208},
+/* 5740 */ {19,208},
+/* 5741 */ {19,208},
+/* 5742 */ {19,208},
+/* 5743 */ {19,208},
+/* 5744 */ {19,208},
+/* 5745 */ {19,208},
+/* 5746 */ {19,208},
+/* 5747 */ {19,208},
+/* 5748 */ {19,208},
+/* 5749 */ {19,208},
+/* 5750 */ {19,208},
+/* 5751 */ {19,208},
+/* 5752 */ {19,208},
+/* 5753 */ {19,208},
+/* 5754 */ {19,208},
+/* 5755 */ {19,208},
+/* 5756 */ {19,208},
+/* 5757 */ {19,208},
+/* 5758 */ {19,208},
+/* 5759 */ {19,208},
+/* 5760 */ {19,208},
+/* 5761 */ {19,208},
+/* 5762 */ {19,208},
+/* 5763 */ {19,208},
+/* 5764 */ {19,208},
+/* 5765 */ {19,208},
+/* 5766 */ {19,208},
+/* 5767 */ {19,208},
+/* 5768 */ {19,208},
+/* 5769 */ {19,208},
+/* 5770 */ {19,208},
+/* 5771 */ {19,208},
+/* 5772 */ {19,208},
+/* 5773 */ {19,208},
+/* 5774 */ {19,208},
+/* 5775 */ {19,208},
+/* 5776 */ {19,208},
+/* 5777 */ {19,208},
+/* 5778 */ {19,208},
+/* 5779 */ {19,208},
+/* 5780 */ {19,208},
+/* 5781 */ {19,208},
+/* 5782 */ {19,208},
+/* 5783 */ {19,208},
+/* 5784 */ {19,208},
+/* 5785 */ {19,208},
+/* 5786 */ {19,208},
+/* 5787 */ {19,208},
+/* 5788 */ {19,208},
+/* 5789 */ {19,208},
+/* 5790 */ {19,208},
+/* 5791 */ {19,208},
+/* 5792 */ {19,208},
+/* 5793 */ {19,208},
+/* 5794 */ {19,208},
+/* 5795 */ {19,208},
+/* 5796 */ {19,208},
+/* 5797 */ {19,208},
+/* 5798 */ {19,208},
+/* 5799 */ {19,208},
+/* 5800 */ {19,208},
+/* 5801 */ {19,208},
+/* 5802 */ {19,208},
+/* 5803 */ {19,208},
+/* 5804 */ {19,208},
+/* 5805 */ {19,208},
+/* 5806 */ {19,208},
+/* 5807 */ {19,208},
+/* 5808 */ {19,208},
+/* 5809 */ {19,208},
+/* 5810 */ {19,208},
+/* 5811 */ {19,208},
+/* 5812 */ {19,208},
+/* 5813 */ {19,208},
+/* 5814 */ {19,208},
+/* 5815 */ {19,208},
+/* 5816 */ {19,208},
+/* 5817 */ {19,208},
+/* 5818 */ {19,208},
+/* 5819 */ {19,208},
+/* 5820 */ {19,208},
+/* 5821 */ {19,208},
+/* 5822 */ {19,208},
+/* 5823 */ {19,208},
+/* 5824 */ {19,208},
+/* 5825 */ {19,208},
+/* 5826 */ {19,208},
+/* 5827 */ {19,208},
+/* 5828 */ {19,208},
+/* 5829 */ {19,208},
+/* 5830 */ {19,208},
+/* 5831 */ {19,208},
+/* 5832 */ {19,208},
+/* 5833 */ {19,208},
+/* 5834 */ {19,208},
+/* 5835 */ {19,208},
+/* 5836 */ {19,208},
+/* 5837 */ {19,208},
+/* 5838 */ {19,208},
+/* 5839 */ {19,208},
+/* 5840 */ {19,208},
+/* 5841 */ {19,208},
+/* 5842 */ {19,208},
+/* 5843 */ {19,208},
+/* 5844 */ {19,208},
+/* 5845 */ {19,208},
+/* 5846 */ {19,208},
+/* 5847 */ {19,208},
+/* 5848 */ {19,208},
+/* 5849 */ {19,208},
+/* 5850 */ {19,208},
+/* 5851 */ {19,208},
+/* 5852 */ {19,208},
+/* 5853 */ {19,208},
+/* 5854 */ {19,208},
+/* 5855 */ {19,208},
+/* 5856 */ {19,208},
+/* 5857 */ {19,208},
+/* 5858 */ {19,208},
+/* 5859 */ {19,208},
+/* 5860 */ {19,208},
+/* 5861 */ {19,208},
+/* 5862 */ {19,208},
+/* 5863 */ {19,208},
+/* 5864 */ {19,208},
+/* 5865 */ {19,208},
+/* 5866 */ {19,208},
+/* 5867 */ {19,208},
+/* 5868 */ {19,208},
+/* 5869 */ {19,208},
+/* 5870 */ {19,208},
+/* 5871 */ {19,208},
+/* 5872 */ {19,208},
+/* 5873 */ {19,208},
+/* 5874 */ {19,208},
+/* 5875 */ {19,208},
+/* 5876 */ {19,208},
+/* 5877 */ {19,208},
+/* 5878 */ {19,208},
+/* 5879 */ {19,208},
+/* 5880 */ {19,208},
+/* 5881 */ {19,208},
+/* 5882 */ {19,208},
+/* 5883 */ {19,208},
+/* 5884 */ {19,208},
+/* 5885 */ {19,208},
+/* 5886 */ {19,208},
+/* 5887 */ {19,208},
+/* 5888 */ {19,208},
+/* 5889 */ {19,208},
+/* 5890 */ {19,208},
+/* 5891 */ {19,208},
+/* 5892 */ {19,208},
+/* 5893 */ {19,208},
+/* 5894 */ {19,208},
+/* 5895 */ {19,208},
+/* 5896 */ {19,208},
+/* 5897 */ {19,208},
+/* 5898 */ {19,208},
+/* 5899 */ {19,208},
+/* 5900 */ {19,208},
+/* 5901 */ {19,208},
+/* 5902 */ {19,208},
+/* 5903 */ {19,208},
+/* 5904 */ {19,208},
+/* 5905 */ {19,208},
+/* 5906 */ {19,208},
+/* 5907 */ {19,208},
+/* 5908 */ {19,208},
+/* 5909 */ {19,208},
+/* 5910 */ {19,208},
+/* 5911 */ {19,208},
+/* 5912 */ {19,208},
+/* 5913 */ {19,208},
+/* 5914 */ {19,208},
+/* 5915 */ {19,208},
+/* 5916 */ {19,208},
+/* 5917 */ {19,208},
+/* 5918 */ {19,208},
+/* 5919 */ {19,208},
+/* 5920 */ {19,208},
+/* 5921 */ {19,208},
+/* 5922 */ {19,208},
+/* 5923 */ {19,208},
+/* 5924 */ {19,208},
+/* 5925 */ {19,208},
+/* 5926 */ {19,208},
+/* 5927 */ {19,208},
+/* 5928 */ {19,208},
+/* 5929 */ {19,208},
+/* 5930 */ {19,208},
+/* 5931 */ {19,208},
+/* 5932 */ {19,208},
+/* 5933 */ {19,208},
+/* 5934 */ {19,208},
+/* 5935 */ {19,208},
+/* 5936 */ {19,208},
+/* 5937 */ {19,208},
+/* 5938 */ {19,208},
+/* 5939 */ {19,208},
+/* 5940 */ {19,208},
+/* 5941 */ {19,208},
+/* 5942 */ {19,208},
+/* 5943 */ {19,208},
+/* 5944 */ {19,208},
+/* 5945 */ {19,208},
+/* 5946 */ {19,208},
+/* 5947 */ {19,208},
+/* 5948 */ {19,208},
+/* 5949 */ {19,208},
+/* 5950 */ {19,208},
+/* 5951 */ {19,208},
+/* 5952 */ {19,208},
+/* 5953 */ {19,208},
+/* 5954 */ {19,208},
+/* 5955 */ {19,208},
+/* 5956 */ {19,208},
+/* 5957 */ {19,208},
+/* 5958 */ {19,208},
+/* 5959 */ {19,208},
+/* 5960 */ {19,208},
+/* 5961 */ {19,208},
+/* 5962 */ {19,208},
+/* 5963 */ {19,208},
+/* 5964 */ {19,208},
+/* 5965 */ {19,208},
+/* 5966 */ {19,208},
+/* 5967 */ {19,208},
+/* 5968 */ {19,208},
+/* 5969 */ {19,208},
+/* 5970 */ {19,208},
+/* 5971 */ {19,208},
+/* 5972 */ {19,208},
+/* 5973 */ {19,208},
+/* 5974 */ {19,208},
+/* 5975 */ {19,208},
+/* 5976 */ {19,208},
+/* 5977 */ {19,208},
+/* 5978 */ {19,208},
+/* 5979 */ {19,208},
+/* 5980 */ {19,208},
+/* 5981 */ {19,208},
+/* 5982 */ {19,208},
+/* 5983 */ {19,208},
+/* 5984 */ {19,208},
+/* 5985 */ {19,208},
+/* 5986 */ {19,208},
+/* 5987 */ {19,208},
+/* 5988 */ {19,208},
+/* 5989 */ {19,208},
+/* 5990 */ {19,208},
+/* 5991 */ {19,208},
+/* 5992 */ {19,208},
+/* 5993 */ {19,208},
+/* 5994 */ {19,208},
+/* 5995 */ {19,208},
+/* 5996 */ {19,208},
+/* 5997 */ {19,208},
+/* 5998 */ {19,208},
+/* 5999 */ {19,208},
+/* 6000 */ {19,208},
+/* 6001 */ {19,208},
+/* 6002 */ {19,208},
+/* 6003 */ {19,208},
+/* 6004 */ {19,208},
+/* 6005 */ {19,208},
+/* 6006 */ {19,208},
+/* 6007 */ {19,208},
+/* 6008 */ {19,208},
+/* 6009 */ {19,208},
+/* 6010 */ {19,208},
+/* 6011 */ {19,208},
+/* 6012 */ {19,208},
+/* 6013 */ {19,208},
+/* 6014 */ {19,208},
+/* 6015 */ {19,208},
+/* 6016 */ {19,208},
+/* 6017 */ {19,208},
+/* 6018 */ {19,208},
+/* 6019 */ {19,208},
+/* 6020 */ {19,208},
+/* 6021 */ {19,208},
+/* 6022 */ {19,208},
+/* 6023 */ {19,208},
+/* 6024 */ {19,208},
+/* 6025 */ {19,208},
+/* 6026 */ {19,208},
+/* 6027 */ {19,208},
+/* 6028 */ {19,208},
+/* 6029 */ {19,208},
+/* 6030 */ {19,208},
+/* 6031 */ {19,208},
+/* 6032 */ {19,208},
+/* 6033 */ {19,208},
+/* 6034 */ {19,208},
+/* 6035 */ {19,208},
+/* 6036 */ {19,208},
+/* 6037 */ {19,208},
+/* 6038 */ {19,208},
+/* 6039 */ {19,208},
+/* 6040 */ {19,208},
+/* 6041 */ {19,208},
+/* 6042 */ {19,208},
+/* 6043 */ {19,208},
+/* 6044 */ {19,208},
+/* 6045 */ {19,208},
+/* 6046 */ {19,208},
+/* 6047 */ {19,208},
+/* 6048 */ {19,208},
+/* 6049 */ {19,208},
+/* 6050 */ {19,208},
+/* 6051 */ {19,208},
+/* 6052 */ {19,208},
+/* 6053 */ {19,208},
+/* 6054 */ {19,208},
+/* 6055 */ {19,208},
+/* 6056 */ {19,208},
+/* 6057 */ {19,208},
+/* 6058 */ {19,208},
+/* 6059 */ {19,208},
+/* 6060 */ {19,208},
+/* 6061 */ {19,208},
+/* 6062 */ {19,208},
+/* 6063 */ {19,208},
+/* 6064 */ {19,208},
+/* 6065 */ {19,208},
+/* 6066 */ {19,208},
+/* 6067 */ {19,208},
+/* 6068 */ {19,208},
+/* 6069 */ {19,208},
+/* 6070 */ {19,208},
+/* 6071 */ {19,208},
+/* 6072 */ {19,208},
+/* 6073 */ {19,208},
+/* 6074 */ {19,208},
+/* 6075 */ {19,208},
+/* 6076 */ {19,208},
+/* 6077 */ {19,208},
+/* 6078 */ {19,208},
+/* 6079 */ {19,208},
+/* 6080 */ {19,208},
+/* 6081 */ {19,208},
+/* 6082 */ {19,208},
+/* 6083 */ {19,208},
+/* 6084 */ {19,208},
+/* 6085 */ {19,208},
+/* 6086 */ {19,208},
+/* 6087 */ {19,208},
+/* 6088 */ {19,208},
+/* 6089 */ {19,208},
+/* 6090 */ {19,208},
+/* 6091 */ {19,208},
+/* 6092 */ {19,208},
+/* 6093 */ {19,208},
+/* 6094 */ {19,208},
+/* 6095 */ {19,208},
+/* 6096 */ {19,208},
+/* 6097 */ {19,208},
+/* 6098 */ {19,208},
+/* 6099 */ {19,208},
+/* 6100 */ {19,208},
+/* 6101 */ {19,208},
+/* 6102 */ {19,208},
+/* 6103 */ {19,208},
+/* 6104 */ {19,208},
+/* 6105 */ {19,208},
+/* 6106 */ {19,208},
+/* 6107 */ {19,208},
+/* 6108 */ {19,208},
+/* 6109 */ {19,208},
+/* 6110 */ {19,208},
+/* 6111 */ {19,208},
+/* 6112 */ {19,208},
+/* 6113 */ {19,208},
+/* 6114 */ {19,208},
+/* 6115 */ {19,208},
+/* 6116 */ {19,208},
+/* 6117 */ {19,208},
+/* 6118 */ {19,208},
+/* 6119 */ {19,208},
+/* 6120 */ {19,208},
+/* 6121 */ {19,208},
+/* 6122 */ {19,208},
+/* 6123 */ {19,208},
+/* 6124 */ {19,208},
+/* 6125 */ {19,208},
+/* 6126 */ {19,208},
+/* 6127 */ {19,208},
+/* 6128 */ {19,208},
+/* 6129 */ {19,208},
+/* 6130 */ {19,208},
+/* 6131 */ {19,208},
+/* 6132 */ {19,208},
+/* 6133 */ {19,208},
+/* 6134 */ {19,208},
+/* 6135 */ {19,208},
+/* 6136 */ {19,208},
+/* 6137 */ {19,208},
+/* 6138 */ {19,208},
+/* 6139 */ {19,208},
+/* 6140 */ {19,208},
+/* 6141 */ {19,208},
+/* 6142 */ {19,208},
+/* 6143 */ {19,208},
+/* 6144 */ {20,128},
+/* 6145 */ {20,128},
+/* 6146 */ {20,128},
+/* 6147 */ {20,128},
+/* 6148 */ {20,128},
+/* 6149 */ {20,128},
+/* 6150 */ {20,128},
+/* 6151 */ {20,128},
+/* 6152 */ {20,128},
+/* 6153 */ {20,128},
+/* 6154 */ {20,128},
+/* 6155 */ {20,128},
+/* 6156 */ {20,128},
+/* 6157 */ {20,128},
+/* 6158 */ {20,128},
+/* 6159 */ {20,128},
+/* 6160 */ {20,128},
+/* 6161 */ {20,128},
+/* 6162 */ {20,128},
+/* 6163 */ {20,128},
+/* 6164 */ {20,128},
+/* 6165 */ {20,128},
+/* 6166 */ {20,128},
+/* 6167 */ {20,128},
+/* 6168 */ {20,128},
+/* 6169 */ {20,128},
+/* 6170 */ {20,128},
+/* 6171 */ {20,128},
+/* 6172 */ {20,128},
+/* 6173 */ {20,128},
+/* 6174 */ {20,128},
+/* 6175 */ {20,128},
+/* 6176 */ {20,128},
+/* 6177 */ {20,128},
+/* 6178 */ {20,128},
+/* 6179 */ {20,128},
+/* 6180 */ {20,128},
+/* 6181 */ {20,128},
+/* 6182 */ {20,128},
+/* 6183 */ {20,128},
+/* 6184 */ {20,128},
+/* 6185 */ {20,128},
+/* 6186 */ {20,128},
+/* 6187 */ {20,128},
+/* 6188 */ {20,128},
+/* 6189 */ {20,128},
+/* 6190 */ {20,128},
+/* 6191 */ {20,128},
+/* 6192 */ {20,128},
+/* 6193 */ {20,128},
+/* 6194 */ {20,128},
+/* 6195 */ {20,128},
+/* 6196 */ {20,128},
+/* 6197 */ {20,128},
+/* 6198 */ {20,128},
+/* 6199 */ {20,128},
+/* 6200 */ {20,128},
+/* 6201 */ {20,128},
+/* 6202 */ {20,128},
+/* 6203 */ {20,128},
+/* 6204 */ {20,128},
+/* 6205 */ {20,128},
+/* 6206 */ {20,128},
+/* 6207 */ {20,128},
+/* 6208 */ {20,128},
+/* 6209 */ {20,128},
+/* 6210 */ {20,128},
+/* 6211 */ {20,128},
+/* 6212 */ {20,128},
+/* 6213 */ {20,128},
+/* 6214 */ {20,128},
+/* 6215 */ {20,128},
+/* 6216 */ {20,128},
+/* 6217 */ {20,128},
+/* 6218 */ {20,128},
+/* 6219 */ {20,128},
+/* 6220 */ {20,128},
+/* 6221 */ {20,128},
+/* 6222 */ {20,128},
+/* 6223 */ {20,128},
+/* 6224 */ {20,128},
+/* 6225 */ {20,128},
+/* 6226 */ {20,128},
+/* 6227 */ {20,128},
+/* 6228 */ {20,128},
+/* 6229 */ {20,128},
+/* 6230 */ {20,128},
+/* 6231 */ {20,128},
+/* 6232 */ {20,128},
+/* 6233 */ {20,128},
+/* 6234 */ {20,128},
+/* 6235 */ {20,128},
+/* 6236 */ {20,128},
+/* 6237 */ {20,128},
+/* 6238 */ {20,128},
+/* 6239 */ {20,128},
+/* 6240 */ {20,128},
+/* 6241 */ {20,128},
+/* 6242 */ {20,128},
+/* 6243 */ {20,128},
+/* 6244 */ {20,128},
+/* 6245 */ {20,128},
+/* 6246 */ {20,128},
+/* 6247 */ {20,128},
+/* 6248 */ {20,128},
+/* 6249 */ {20,128},
+/* 6250 */ {20,128},
+/* 6251 */ {20,128},
+/* 6252 */ {20,128},
+/* 6253 */ {20,128},
+/* 6254 */ {20,128},
+/* 6255 */ {20,128},
+/* 6256 */ {20,128},
+/* 6257 */ {20,128},
+/* 6258 */ {20,128},
+/* 6259 */ {20,128},
+/* 6260 */ {20,128},
+/* 6261 */ {20,128},
+/* 6262 */ {20,128},
+/* 6263 */ {20,128},
+/* 6264 */ {20,128},
+/* 6265 */ {20,128},
+/* 6266 */ {20,128},
+/* 6267 */ {20,128},
+/* 6268 */ {20,128},
+/* 6269 */ {20,128},
+/* 6270 */ {20,128},
+/* 6271 */ {20,128},
+/* 6272 */ {20,128},
+/* 6273 */ {20,128},
+/* 6274 */ {20,128},
+/* 6275 */ {20,128},
+/* 6276 */ {20,128},
+/* 6277 */ {20,128},
+/* 6278 */ {20,128},
+/* 6279 */ {20,128},
+/* 6280 */ {20,128},
+/* 6281 */ {20,128},
+/* 6282 */ {20,128},
+/* 6283 */ {20,128},
+/* 6284 */ {20,128},
+/* 6285 */ {20,128},
+/* 6286 */ {20,128},
+/* 6287 */ {20,128},
+/* 6288 */ {20,128},
+/* 6289 */ {20,128},
+/* 6290 */ {20,128},
+/* 6291 */ {20,128},
+/* 6292 */ {20,128},
+/* 6293 */ {20,128},
+/* 6294 */ {20,128},
+/* 6295 */ {20,128},
+/* 6296 */ {20,128},
+/* 6297 */ {20,128},
+/* 6298 */ {20,128},
+/* 6299 */ {20,128},
+/* 6300 */ {20,128},
+/* 6301 */ {20,128},
+/* 6302 */ {20,128},
+/* 6303 */ {20,128},
+/* 6304 */ {20,128},
+/* 6305 */ {20,128},
+/* 6306 */ {20,128},
+/* 6307 */ {20,128},
+/* 6308 */ {20,128},
+/* 6309 */ {20,128},
+/* 6310 */ {20,128},
+/* 6311 */ {20,128},
+/* 6312 */ {20,128},
+/* 6313 */ {20,128},
+/* 6314 */ {20,128},
+/* 6315 */ {20,128},
+/* 6316 */ {20,128},
+/* 6317 */ {20,128},
+/* 6318 */ {20,128},
+/* 6319 */ {20,128},
+/* 6320 */ {20,128},
+/* 6321 */ {20,128},
+/* 6322 */ {20,128},
+/* 6323 */ {20,128},
+/* 6324 */ {20,128},
+/* 6325 */ {20,128},
+/* 6326 */ {20,128},
+/* 6327 */ {20,128},
+/* 6328 */ {20,128},
+/* 6329 */ {20,128},
+/* 6330 */ {20,128},
+/* 6331 */ {20,128},
+/* 6332 */ {20,128},
+/* 6333 */ {20,128},
+/* 6334 */ {20,128},
+/* 6335 */ {20,128},
+/* 6336 */ {20,128},
+/* 6337 */ {20,128},
+/* 6338 */ {20,128},
+/* 6339 */ {20,128},
+/* 6340 */ {20,128},
+/* 6341 */ {20,128},
+/* 6342 */ {20,128},
+/* 6343 */ {20,128},
+/* 6344 */ {20,128},
+/* 6345 */ {20,128},
+/* 6346 */ {20,128},
+/* 6347 */ {20,128},
+/* 6348 */ {20,128},
+/* 6349 */ {20,128},
+/* 6350 */ {20,128},
+/* 6351 */ {20,128},
+/* 6352 */ {20,128},
+/* 6353 */ {20,128},
+/* 6354 */ {20,128},
+/* 6355 */ {20,128},
+/* 6356 */ {20,128},
+/* 6357 */ {20,128},
+/* 6358 */ {20,128},
+/* 6359 */ {20,128},
+/* 6360 */ {20,128},
+/* 6361 */ {20,128},
+/* 6362 */ {20,128},
+/* 6363 */ {20,128},
+/* 6364 */ {20,128},
+/* 6365 */ {20,128},
+/* 6366 */ {20,128},
+/* 6367 */ {20,128},
+/* 6368 */ {20,128},
+/* 6369 */ {20,128},
+/* 6370 */ {20,128},
+/* 6371 */ {20,128},
+/* 6372 */ {20,128},
+/* 6373 */ {20,128},
+/* 6374 */ {20,128},
+/* 6375 */ {20,128},
+/* 6376 */ {20,128},
+/* 6377 */ {20,128},
+/* 6378 */ {20,128},
+/* 6379 */ {20,128},
+/* 6380 */ {20,128},
+/* 6381 */ {20,128},
+/* 6382 */ {20,128},
+/* 6383 */ {20,128},
+/* 6384 */ {20,128},
+/* 6385 */ {20,128},
+/* 6386 */ {20,128},
+/* 6387 */ {20,128},
+/* 6388 */ {20,128},
+/* 6389 */ {20,128},
+/* 6390 */ {20,128},
+/* 6391 */ {20,128},
+/* 6392 */ {20,128},
+/* 6393 */ {20,128},
+/* 6394 */ {20,128},
+/* 6395 */ {20,128},
+/* 6396 */ {20,128},
+/* 6397 */ {20,128},
+/* 6398 */ {20,128},
+/* 6399 */ {20,128},
+/* 6400 */ {20,128},
+/* 6401 */ {20,128},
+/* 6402 */ {20,128},
+/* 6403 */ {20,128},
+/* 6404 */ {20,128},
+/* 6405 */ {20,128},
+/* 6406 */ {20,128},
+/* 6407 */ {20,128},
+/* 6408 */ {20,128},
+/* 6409 */ {20,128},
+/* 6410 */ {20,128},
+/* 6411 */ {20,128},
+/* 6412 */ {20,128},
+/* 6413 */ {20,128},
+/* 6414 */ {20,128},
+/* 6415 */ {20,128},
+/* 6416 */ {20,128},
+/* 6417 */ {20,128},
+/* 6418 */ {20,128},
+/* 6419 */ {20,128},
+/* 6420 */ {20,128},
+/* 6421 */ {20,128},
+/* 6422 */ {20,128},
+/* 6423 */ {20,128},
+/* 6424 */ {20,128},
+/* 6425 */ {20,128},
+/* 6426 */ {20,128},
+/* 6427 */ {20,128},
+/* 6428 */ {20,128},
+/* 6429 */ {20,128},
+/* 6430 */ {20,128},
+/* 6431 */ {20,128},
+/* 6432 */ {20,128},
+/* 6433 */ {20,128},
+/* 6434 */ {20,128},
+/* 6435 */ {20,128},
+/* 6436 */ {20,128},
+/* 6437 */ {20,128},
+/* 6438 */ {20,128},
+/* 6439 */ {20,128},
+/* 6440 */ {20,128},
+/* 6441 */ {20,128},
+/* 6442 */ {20,128},
+/* 6443 */ {20,128},
+/* 6444 */ {20,128},
+/* 6445 */ {20,128},
+/* 6446 */ {20,128},
+/* 6447 */ {20,128},
+/* 6448 */ {20,128},
+/* 6449 */ {20,128},
+/* 6450 */ {20,128},
+/* 6451 */ {20,128},
+/* 6452 */ {20,128},
+/* 6453 */ {20,128},
+/* 6454 */ {20,128},
+/* 6455 */ {20,128},
+/* 6456 */ {20,128},
+/* 6457 */ {20,128},
+/* 6458 */ {20,128},
+/* 6459 */ {20,128},
+/* 6460 */ {20,128},
+/* 6461 */ {20,128},
+/* 6462 */ {20,128},
+/* 6463 */ {20,128},
+/* 6464 */ {20,128},
+/* 6465 */ {20,128},
+/* 6466 */ {20,128},
+/* 6467 */ {20,128},
+/* 6468 */ {20,128},
+/* 6469 */ {20,128},
+/* 6470 */ {20,128},
+/* 6471 */ {20,128},
+/* 6472 */ {20,128},
+/* 6473 */ {20,128},
+/* 6474 */ {20,128},
+/* 6475 */ {20,128},
+/* 6476 */ {20,128},
+/* 6477 */ {20,128},
+/* 6478 */ {20,128},
+/* 6479 */ {20,128},
+/* 6480 */ {20,128},
+/* 6481 */ {20,128},
+/* 6482 */ {20,128},
+/* 6483 */ {20,128},
+/* 6484 */ {20,128},
+/* 6485 */ {20,128},
+/* 6486 */ {20,128},
+/* 6487 */ {20,128},
+/* 6488 */ {20,128},
+/* 6489 */ {20,128},
+/* 6490 */ {20,128},
+/* 6491 */ {20,128},
+/* 6492 */ {20,128},
+/* 6493 */ {20,128},
+/* 6494 */ {20,128},
+/* 6495 */ {20,128},
+/* 6496 */ {20,128},
+/* 6497 */ {20,128},
+/* 6498 */ {20,128},
+/* 6499 */ {20,128},
+/* 6500 */ {20,128},
+/* 6501 */ {20,128},
+/* 6502 */ {20,128},
+/* 6503 */ {20,128},
+/* 6504 */ {20,128},
+/* 6505 */ {20,128},
+/* 6506 */ {20,128},
+/* 6507 */ {20,128},
+/* 6508 */ {20,128},
+/* 6509 */ {20,128},
+/* 6510 */ {20,128},
+/* 6511 */ {20,128},
+/* 6512 */ {20,128},
+/* 6513 */ {20,128},
+/* 6514 */ {20,128},
+/* 6515 */ {20,128},
+/* 6516 */ {20,128},
+/* 6517 */ {20,128},
+/* 6518 */ {20,128},
+/* 6519 */ {20,128},
+/* 6520 */ {20,128},
+/* 6521 */ {20,128},
+/* 6522 */ {20,128},
+/* 6523 */ {20,128},
+/* 6524 */ {20,128},
+/* 6525 */ {20,128},
+/* 6526 */ {20,128},
+/* 6527 */ {20,128},
+/* 6528 */ {20,128},
+/* 6529 */ {20,128},
+/* 6530 */ {20,128},
+/* 6531 */ {20,128},
+/* 6532 */ {20,128},
+/* 6533 */ {20,128},
+/* 6534 */ {20,128},
+/* 6535 */ {20,128},
+/* 6536 */ {20,128},
+/* 6537 */ {20,128},
+/* 6538 */ {20,128},
+/* 6539 */ {20,128},
+/* 6540 */ {20,128},
+/* 6541 */ {20,128},
+/* 6542 */ {20,128},
+/* 6543 */ {20,128},
+/* 6544 */ {20,128},
+/* 6545 */ {20,128},
+/* 6546 */ {20,128},
+/* 6547 */ {20,128},
+/* 6548 */ {20,128},
+/* 6549 */ {20,128},
+/* 6550 */ {20,128},
+/* 6551 */ {20,128},
+/* 6552 */ {20,128},
+/* 6553 */ {20,128},
+/* 6554 */ {20,128},
+/* 6555 */ {20,128},
+/* 6556 */ {20,128},
+/* 6557 */ {20,128},
+/* 6558 */ {20,128},
+/* 6559 */ {20,128},
+/* 6560 */ {20,128},
+/* 6561 */ {20,128},
+/* 6562 */ {20,128},
+/* 6563 */ {20,128},
+/* 6564 */ {20,128},
+/* 6565 */ {20,128},
+/* 6566 */ {20,128},
+/* 6567 */ {20,128},
+/* 6568 */ {20,128},
+/* 6569 */ {20,128},
+/* 6570 */ {20,128},
+/* 6571 */ {20,128},
+/* 6572 */ {20,128},
+/* 6573 */ {20,128},
+/* 6574 */ {20,128},
+/* 6575 */ {20,128},
+/* 6576 */ {20,128},
+/* 6577 */ {20,128},
+/* 6578 */ {20,128},
+/* 6579 */ {20,128},
+/* 6580 */ {20,128},
+/* 6581 */ {20,128},
+/* 6582 */ {20,128},
+/* 6583 */ {20,128},
+/* 6584 */ {20,128},
+/* 6585 */ {20,128},
+/* 6586 */ {20,128},
+/* 6587 */ {20,128},
+/* 6588 */ {20,128},
+/* 6589 */ {20,128},
+/* 6590 */ {20,128},
+/* 6591 */ {20,128},
+/* 6592 */ {20,128},
+/* 6593 */ {20,128},
+/* 6594 */ {20,128},
+/* 6595 */ {20,128},
+/* 6596 */ {20,128},
+/* 6597 */ {20,128},
+/* 6598 */ {20,128},
+/* 6599 */ {20,128},
+/* 6600 */ {20,128},
+/* 6601 */ {20,128},
+/* 6602 */ {20,128},
+/* 6603 */ {20,128},
+/* 6604 */ {20,128},
+/* 6605 */ {20,128},
+/* 6606 */ {20,128},
+/* 6607 */ {20,128},
+/* 6608 */ {20,128},
+/* 6609 */ {20,128},
+/* 6610 */ {20,128},
+/* 6611 */ {20,128},
+/* 6612 */ {20,128},
+/* 6613 */ {20,128},
+/* 6614 */ {20,128},
+/* 6615 */ {20,128},
+/* 6616 */ {20,128},
+/* 6617 */ {20,128},
+/* 6618 */ {20,128},
+/* 6619 */ {20,128},
+/* 6620 */ {20,128},
+/* 6621 */ {20,128},
+/* 6622 */ {20,128},
+/* 6623 */ {20,128},
+/* 6624 */ {20,128},
+/* 6625 */ {20,128},
+/* 6626 */ {20,128},
+/* 6627 */ {20,128},
+/* 6628 */ {20,128},
+/* 6629 */ {20,128},
+/* 6630 */ {20,128},
+/* 6631 */ {20,128},
+/* 6632 */ {20,128},
+/* 6633 */ {20,128},
+/* 6634 */ {20,128},
+/* 6635 */ {20,128},
+/* 6636 */ {20,128},
+/* 6637 */ {20,128},
+/* 6638 */ {20,128},
+/* 6639 */ {20,128},
+/* 6640 */ {20,128},
+/* 6641 */ {20,128},
+/* 6642 */ {20,128},
+/* 6643 */ {20,128},
+/* 6644 */ {20,128},
+/* 6645 */ {20,128},
+/* 6646 */ {20,128},
+/* 6647 */ {20,128},
+/* 6648 */ {20,128},
+/* 6649 */ {20,128},
+/* 6650 */ {20,128},
+/* 6651 */ {20,128},
+/* 6652 */ {20,128},
+/* 6653 */ {20,128},
+/* 6654 */ {20,128},
+/* 6655 */ {20,128},
+/* 6656 */ {20,128},
+/* 6657 */ {20,128},
+/* 6658 */ {20,128},
+/* 6659 */ {20,128},
+/* 6660 */ {20,128},
+/* 6661 */ {20,128},
+/* 6662 */ {20,128},
+/* 6663 */ {20,128},
+/* 6664 */ {20,128},
+/* 6665 */ {20,128},
+/* 6666 */ {20,128},
+/* 6667 */ {20,128},
+/* 6668 */ {20,128},
+/* 6669 */ {20,128},
+/* 6670 */ {20,128},
+/* 6671 */ {20,128},
+/* 6672 */ {20,128},
+/* 6673 */ {20,128},
+/* 6674 */ {20,128},
+/* 6675 */ {20,128},
+/* 6676 */ {20,128},
+/* 6677 */ {20,128},
+/* 6678 */ {20,128},
+/* 6679 */ {20,128},
+/* 6680 */ {20,128},
+/* 6681 */ {20,128},
+/* 6682 */ {20,128},
+/* 6683 */ {20,128},
+/* 6684 */ {20,128},
+/* 6685 */ {20,128},
+/* 6686 */ {20,128},
+/* 6687 */ {20,128},
+/* 6688 */ {20,128},
+/* 6689 */ {20,128},
+/* 6690 */ {20,128},
+/* 6691 */ {20,128},
+/* 6692 */ {20,128},
+/* 6693 */ {20,128},
+/* 6694 */ {20,128},
+/* 6695 */ {20,128},
+/* 6696 */ {20,128},
+/* 6697 */ {20,128},
+/* 6698 */ {20,128},
+/* 6699 */ {20,128},
+/* 6700 */ {20,128},
+/* 6701 */ {20,128},
+/* 6702 */ {20,128},
+/* 6703 */ {20,128},
+/* 6704 */ {20,128},
+/* 6705 */ {20,128},
+/* 6706 */ {20,128},
+/* 6707 */ {20,128},
+/* 6708 */ {20,128},
+/* 6709 */ {20,128},
+/* 6710 */ {20,128},
+/* 6711 */ {20,128},
+/* 6712 */ {20,128},
+/* 6713 */ {20,128},
+/* 6714 */ {20,128},
+/* 6715 */ {20,128},
+/* 6716 */ {20,128},
+/* 6717 */ {20,128},
+/* 6718 */ {20,128},
+/* 6719 */ {20,128},
+/* 6720 */ {20,128},
+/* 6721 */ {20,128},
+/* 6722 */ {20,128},
+/* 6723 */ {20,128},
+/* 6724 */ {20,128},
+/* 6725 */ {20,128},
+/* 6726 */ {20,128},
+/* 6727 */ {20,128},
+/* 6728 */ {20,128},
+/* 6729 */ {20,128},
+/* 6730 */ {20,128},
+/* 6731 */ {20,128},
+/* 6732 */ {20,128},
+/* 6733 */ {20,128},
+/* 6734 */ {20,128},
+/* 6735 */ {20,128},
+/* 6736 */ {20,128},
+/* 6737 */ {20,128},
+/* 6738 */ {20,128},
+/* 6739 */ {20,128},
+/* 6740 */ {20,128},
+/* 6741 */ {20,128},
+/* 6742 */ {20,128},
+/* 6743 */ {20,128},
+/* 6744 */ {20,128},
+/* 6745 */ {20,128},
+/* 6746 */ {20,128},
+/* 6747 */ {20,128},
+/* 6748 */ {20,128},
+/* 6749 */ {20,128},
+/* 6750 */ {20,128},
+/* 6751 */ {20,128},
+/* 6752 */ {20,128},
+/* 6753 */ {20,128},
+/* 6754 */ {20,128},
+/* 6755 */ {20,128},
+/* 6756 */ {20,128},
+/* 6757 */ {20,128},
+/* 6758 */ {20,128},
+/* 6759 */ {20,128},
+/* 6760 */ {20,128},
+/* 6761 */ {20,128},
+/* 6762 */ {20,128},
+/* 6763 */ {20,128},
+/* 6764 */ {20,128},
+/* 6765 */ {20,128},
+/* 6766 */ {20,128},
+/* 6767 */ {20,128},
+/* 6768 */ {20,128},
+/* 6769 */ {20,128},
+/* 6770 */ {20,128},
+/* 6771 */ {20,128},
+/* 6772 */ {20,128},
+/* 6773 */ {20,128},
+/* 6774 */ {20,128},
+/* 6775 */ {20,128},
+/* 6776 */ {20,128},
+/* 6777 */ {20,128},
+/* 6778 */ {20,128},
+/* 6779 */ {20,128},
+/* 6780 */ {20,128},
+/* 6781 */ {20,128},
+/* 6782 */ {20,128},
+/* 6783 */ {20,128},
+/* 6784 */ {20,128},
+/* 6785 */ {20,128},
+/* 6786 */ {20,128},
+/* 6787 */ {20,128},
+/* 6788 */ {20,128},
+/* 6789 */ {20,128},
+/* 6790 */ {20,128},
+/* 6791 */ {20,128},
+/* 6792 */ {20,128},
+/* 6793 */ {20,128},
+/* 6794 */ {20,128},
+/* 6795 */ {20,128},
+/* 6796 */ {20,128},
+/* 6797 */ {20,128},
+/* 6798 */ {20,128},
+/* 6799 */ {20,128},
+/* 6800 */ {20,128},
+/* 6801 */ {20,128},
+/* 6802 */ {20,128},
+/* 6803 */ {20,128},
+/* 6804 */ {20,128},
+/* 6805 */ {20,128},
+/* 6806 */ {20,128},
+/* 6807 */ {20,128},
+/* 6808 */ {20,128},
+/* 6809 */ {20,128},
+/* 6810 */ {20,128},
+/* 6811 */ {20,128},
+/* 6812 */ {20,128},
+/* 6813 */ {20,128},
+/* 6814 */ {20,128},
+/* 6815 */ {20,128},
+/* 6816 */ {20,128},
+/* 6817 */ {20,128},
+/* 6818 */ {20,128},
+/* 6819 */ {20,128},
+/* 6820 */ {20,128},
+/* 6821 */ {20,128},
+/* 6822 */ {20,128},
+/* 6823 */ {20,128},
+/* 6824 */ {20,128},
+/* 6825 */ {20,128},
+/* 6826 */ {20,128},
+/* 6827 */ {20,128},
+/* 6828 */ {20,128},
+/* 6829 */ {20,128},
+/* 6830 */ {20,128},
+/* 6831 */ {20,128},
+/* 6832 */ {20,128},
+/* 6833 */ {20,128},
+/* 6834 */ {20,128},
+/* 6835 */ {20,128},
+/* 6836 */ {20,128},
+/* 6837 */ {20,128},
+/* 6838 */ {20,128},
+/* 6839 */ {20,128},
+/* 6840 */ {20,128},
+/* 6841 */ {20,128},
+/* 6842 */ {20,128},
+/* 6843 */ {20,128},
+/* 6844 */ {20,128},
+/* 6845 */ {20,128},
+/* 6846 */ {20,128},
+/* 6847 */ {20,128},
+/* 6848 */ {20,128},
+/* 6849 */ {20,128},
+/* 6850 */ {20,128},
+/* 6851 */ {20,128},
+/* 6852 */ {20,128},
+/* 6853 */ {20,128},
+/* 6854 */ {20,128},
+/* 6855 */ {20,128},
+/* 6856 */ {20,128},
+/* 6857 */ {20,128},
+/* 6858 */ {20,128},
+/* 6859 */ {20,128},
+/* 6860 */ {20,128},
+/* 6861 */ {20,128},
+/* 6862 */ {20,128},
+/* 6863 */ {20,128},
+/* 6864 */ {20,128},
+/* 6865 */ {20,128},
+/* 6866 */ {20,128},
+/* 6867 */ {20,128},
+/* 6868 */ {20,128},
+/* 6869 */ {20,128},
+/* 6870 */ {20,128},
+/* 6871 */ {20,128},
+/* 6872 */ {20,128},
+/* 6873 */ {20,128},
+/* 6874 */ {20,128},
+/* 6875 */ {20,128},
+/* 6876 */ {20,128},
+/* 6877 */ {20,128},
+/* 6878 */ {20,128},
+/* 6879 */ {20,128},
+/* 6880 */ {20,128},
+/* 6881 */ {20,128},
+/* 6882 */ {20,128},
+/* 6883 */ {20,128},
+/* 6884 */ {20,128},
+/* 6885 */ {20,128},
+/* 6886 */ {20,128},
+/* 6887 */ {20,128},
+/* 6888 */ {20,128},
+/* 6889 */ {20,128},
+/* 6890 */ {20,128},
+/* 6891 */ {20,128},
+/* 6892 */ {20,128},
+/* 6893 */ {20,128},
+/* 6894 */ {20,128},
+/* 6895 */ {20,128},
+/* 6896 */ {20,128},
+/* 6897 */ {20,128},
+/* 6898 */ {20,128},
+/* 6899 */ {20,128},
+/* 6900 */ {20,128},
+/* 6901 */ {20,128},
+/* 6902 */ {20,128},
+/* 6903 */ {20,128},
+/* 6904 */ {20,128},
+/* 6905 */ {20,128},
+/* 6906 */ {20,128},
+/* 6907 */ {20,128},
+/* 6908 */ {20,128},
+/* 6909 */ {20,128},
+/* 6910 */ {20,128},
+/* 6911 */ {20,128},
+/* 6912 */ {20,128},
+/* 6913 */ {20,128},
+/* 6914 */ {20,128},
+/* 6915 */ {20,128},
+/* 6916 */ {20,128},
+/* 6917 */ {20,128},
+/* 6918 */ {20,128},
+/* 6919 */ {20,128},
+/* 6920 */ {20,128},
+/* 6921 */ {20,128},
+/* 6922 */ {20,128},
+/* 6923 */ {20,128},
+/* 6924 */ {20,128},
+/* 6925 */ {20,128},
+/* 6926 */ {20,128},
+/* 6927 */ {20,128},
+/* 6928 */ {20,128},
+/* 6929 */ {20,128},
+/* 6930 */ {20,128},
+/* 6931 */ {20,128},
+/* 6932 */ {20,128},
+/* 6933 */ {20,128},
+/* 6934 */ {20,128},
+/* 6935 */ {20,128},
+/* 6936 */ {20,128},
+/* 6937 */ {20,128},
+/* 6938 */ {20,128},
+/* 6939 */ {20,128},
+/* 6940 */ {20,128},
+/* 6941 */ {20,128},
+/* 6942 */ {20,128},
+/* 6943 */ {20,128},
+/* 6944 */ {20,128},
+/* 6945 */ {20,128},
+/* 6946 */ {20,128},
+/* 6947 */ {20,128},
+/* 6948 */ {20,128},
+/* 6949 */ {20,128},
+/* 6950 */ {20,128},
+/* 6951 */ {20,128},
+/* 6952 */ {20,128},
+/* 6953 */ {20,128},
+/* 6954 */ {20,128},
+/* 6955 */ {20,128},
+/* 6956 */ {20,128},
+/* 6957 */ {20,128},
+/* 6958 */ {20,128},
+/* 6959 */ {20,128},
+/* 6960 */ {20,128},
+/* 6961 */ {20,128},
+/* 6962 */ {20,128},
+/* 6963 */ {20,128},
+/* 6964 */ {20,128},
+/* 6965 */ {20,128},
+/* 6966 */ {20,128},
+/* 6967 */ {20,128},
+/* 6968 */ {20,128},
+/* 6969 */ {20,128},
+/* 6970 */ {20,128},
+/* 6971 */ {20,128},
+/* 6972 */ {20,128},
+/* 6973 */ {20,128},
+/* 6974 */ {20,128},
+/* 6975 */ {20,128},
+/* 6976 */ {20,128},
+/* 6977 */ {20,128},
+/* 6978 */ {20,128},
+/* 6979 */ {20,128},
+/* 6980 */ {20,128},
+/* 6981 */ {20,128},
+/* 6982 */ {20,128},
+/* 6983 */ {20,128},
+/* 6984 */ {20,128},
+/* 6985 */ {20,128},
+/* 6986 */ {20,128},
+/* 6987 */ {20,128},
+/* 6988 */ {20,128},
+/* 6989 */ {20,128},
+/* 6990 */ {20,128},
+/* 6991 */ {20,128},
+/* 6992 */ {20,128},
+/* 6993 */ {20,128},
+/* 6994 */ {20,128},
+/* 6995 */ {20,128},
+/* 6996 */ {20,128},
+/* 6997 */ {20,128},
+/* 6998 */ {20,128},
+/* 6999 */ {20,128},
+/* 7000 */ {20,128},
+/* 7001 */ {20,128},
+/* 7002 */ {20,128},
+/* 7003 */ {20,128},
+/* 7004 */ {20,128},
+/* 7005 */ {20,128},
+/* 7006 */ {20,128},
+/* 7007 */ {20,128},
+/* 7008 */ {20,128},
+/* 7009 */ {20,128},
+/* 7010 */ {20,128},
+/* 7011 */ {20,128},
+/* 7012 */ {20,128},
+/* 7013 */ {20,128},
+/* 7014 */ {20,128},
+/* 7015 */ {20,128},
+/* 7016 */ {20,128},
+/* 7017 */ {20,128},
+/* 7018 */ {20,128},
+/* 7019 */ {20,128},
+/* 7020 */ {20,128},
+/* 7021 */ {20,128},
+/* 7022 */ {20,128},
+/* 7023 */ {20,128},
+/* 7024 */ {20,128},
+/* 7025 */ {20,128},
+/* 7026 */ {20,128},
+/* 7027 */ {20,128},
+/* 7028 */ {20,128},
+/* 7029 */ {20,128},
+/* 7030 */ {20,128},
+/* 7031 */ {20,128},
+/* 7032 */ {20,128},
+/* 7033 */ {20,128},
+/* 7034 */ {20,128},
+/* 7035 */ {20,128},
+/* 7036 */ {20,128},
+/* 7037 */ {20,128},
+/* 7038 */ {20,128},
+/* 7039 */ {20,128},
+/* 7040 */ {20,128},
+/* 7041 */ {20,128},
+/* 7042 */ {20,128},
+/* 7043 */ {20,128},
+/* 7044 */ {20,128},
+/* 7045 */ {20,128},
+/* 7046 */ {20,128},
+/* 7047 */ {20,128},
+/* 7048 */ {20,128},
+/* 7049 */ {20,128},
+/* 7050 */ {20,128},
+/* 7051 */ {20,128},
+/* 7052 */ {20,128},
+/* 7053 */ {20,128},
+/* 7054 */ {20,128},
+/* 7055 */ {20,128},
+/* 7056 */ {20,128},
+/* 7057 */ {20,128},
+/* 7058 */ {20,128},
+/* 7059 */ {20,128},
+/* 7060 */ {20,128},
+/* 7061 */ {20,128},
+/* 7062 */ {20,128},
+/* 7063 */ {20,128},
+/* 7064 */ {20,128},
+/* 7065 */ {20,128},
+/* 7066 */ {20,128},
+/* 7067 */ {20,128},
+/* 7068 */ {20,128},
+/* 7069 */ {20,128},
+/* 7070 */ {20,128},
+/* 7071 */ {20,128},
+/* 7072 */ {20,128},
+/* 7073 */ {20,128},
+/* 7074 */ {20,128},
+/* 7075 */ {20,128},
+/* 7076 */ {20,128},
+/* 7077 */ {20,128},
+/* 7078 */ {20,128},
+/* 7079 */ {20,128},
+/* 7080 */ {20,128},
+/* 7081 */ {20,128},
+/* 7082 */ {20,128},
+/* 7083 */ {20,128},
+/* 7084 */ {20,128},
+/* 7085 */ {20,128},
+/* 7086 */ {20,128},
+/* 7087 */ {20,128},
+/* 7088 */ {20,128},
+/* 7089 */ {20,128},
+/* 7090 */ {20,128},
+/* 7091 */ {20,128},
+/* 7092 */ {20,128},
+/* 7093 */ {20,128},
+/* 7094 */ {20,128},
+/* 7095 */ {20,128},
+/* 7096 */ {20,128},
+/* 7097 */ {20,128},
+/* 7098 */ {20,128},
+/* 7099 */ {20,128},
+/* 7100 */ {20,128},
+/* 7101 */ {20,128},
+/* 7102 */ {20,128},
+/* 7103 */ {20,128},
+/* 7104 */ {20,128},
+/* 7105 */ {20,128},
+/* 7106 */ {20,128},
+/* 7107 */ {20,128},
+/* 7108 */ {20,128},
+/* 7109 */ {20,128},
+/* 7110 */ {20,128},
+/* 7111 */ {20,128},
+/* 7112 */ {20,128},
+/* 7113 */ {20,128},
+/* 7114 */ {20,128},
+/* 7115 */ {20,128},
+/* 7116 */ {20,128},
+/* 7117 */ {20,128},
+/* 7118 */ {20,128},
+/* 7119 */ {20,128},
+/* 7120 */ {20,128},
+/* 7121 */ {20,128},
+/* 7122 */ {20,128},
+/* 7123 */ {20,128},
+/* 7124 */ {20,128},
+/* 7125 */ {20,128},
+/* 7126 */ {20,128},
+/* 7127 */ {20,128},
+/* 7128 */ {20,128},
+/* 7129 */ {20,128},
+/* 7130 */ {20,128},
+/* 7131 */ {20,128},
+/* 7132 */ {20,128},
+/* 7133 */ {20,128},
+/* 7134 */ {20,128},
+/* 7135 */ {20,128},
+/* 7136 */ {20,128},
+/* 7137 */ {20,128},
+/* 7138 */ {20,128},
+/* 7139 */ {20,128},
+/* 7140 */ {20,128},
+/* 7141 */ {20,128},
+/* 7142 */ {20,128},
+/* 7143 */ {20,128},
+/* 7144 */ {20,128},
+/* 7145 */ {20,128},
+/* 7146 */ {20,128},
+/* 7147 */ {20,128},
+/* 7148 */ {20,128},
+/* 7149 */ {20,128},
+/* 7150 */ {20,128},
+/* 7151 */ {20,128},
+/* 7152 */ {20,128},
+/* 7153 */ {20,128},
+/* 7154 */ {20,128},
+/* 7155 */ {20,128},
+/* 7156 */ {20,128},
+/* 7157 */ {20,128},
+/* 7158 */ {20,128},
+/* 7159 */ {20,128},
+/* 7160 */ {20,128},
+/* 7161 */ {20,128},
+/* 7162 */ {20,128},
+/* 7163 */ {20,128},
+/* 7164 */ {20,128},
+/* 7165 */ {20,128},
+/* 7166 */ {20,128},
+/* 7167 */ {20,128},
+/* 7168 */ {20,130},
+/* 7169 */ {20,130},
+/* 7170 */ {20,130},
+/* 7171 */ {20,130},
+/* 7172 */ {20,130},
+/* 7173 */ {20,130},
+/* 7174 */ {20,130},
+/* 7175 */ {20,130},
+/* 7176 */ {20,130},
+/* 7177 */ {20,130},
+/* 7178 */ {20,130},
+/* 7179 */ {20,130},
+/* 7180 */ {20,130},
+/* 7181 */ {20,130},
+/* 7182 */ {20,130},
+/* 7183 */ {20,130},
+/* 7184 */ {20,130},
+/* 7185 */ {20,130},
+/* 7186 */ {20,130},
+/* 7187 */ {20,130},
+/* 7188 */ {20,130},
+/* 7189 */ {20,130},
+/* 7190 */ {20,130},
+/* 7191 */ {20,130},
+/* 7192 */ {20,130},
+/* 7193 */ {20,130},
+/* 7194 */ {20,130},
+/* 7195 */ {20,130},
+/* 7196 */ {20,130},
+/* 7197 */ {20,130},
+/* 7198 */ {20,130},
+/* 7199 */ {20,130},
+/* 7200 */ {20,130},
+/* 7201 */ {20,130},
+/* 7202 */ {20,130},
+/* 7203 */ {20,130},
+/* 7204 */ {20,130},
+/* 7205 */ {20,130},
+/* 7206 */ {20,130},
+/* 7207 */ {20,130},
+/* 7208 */ {20,130},
+/* 7209 */ {20,130},
+/* 7210 */ {20,130},
+/* 7211 */ {20,130},
+/* 7212 */ {20,130},
+/* 7213 */ {20,130},
+/* 7214 */ {20,130},
+/* 7215 */ {20,130},
+/* 7216 */ {20,130},
+/* 7217 */ {20,130},
+/* 7218 */ {20,130},
+/* 7219 */ {20,130},
+/* 7220 */ {20,130},
+/* 7221 */ {20,130},
+/* 7222 */ {20,130},
+/* 7223 */ {20,130},
+/* 7224 */ {20,130},
+/* 7225 */ {20,130},
+/* 7226 */ {20,130},
+/* 7227 */ {20,130},
+/* 7228 */ {20,130},
+/* 7229 */ {20,130},
+/* 7230 */ {20,130},
+/* 7231 */ {20,130},
+/* 7232 */ {20,130},
+/* 7233 */ {20,130},
+/* 7234 */ {20,130},
+/* 7235 */ {20,130},
+/* 7236 */ {20,130},
+/* 7237 */ {20,130},
+/* 7238 */ {20,130},
+/* 7239 */ {20,130},
+/* 7240 */ {20,130},
+/* 7241 */ {20,130},
+/* 7242 */ {20,130},
+/* 7243 */ {20,130},
+/* 7244 */ {20,130},
+/* 7245 */ {20,130},
+/* 7246 */ {20,130},
+/* 7247 */ {20,130},
+/* 7248 */ {20,130},
+/* 7249 */ {20,130},
+/* 7250 */ {20,130},
+/* 7251 */ {20,130},
+/* 7252 */ {20,130},
+/* 7253 */ {20,130},
+/* 7254 */ {20,130},
+/* 7255 */ {20,130},
+/* 7256 */ {20,130},
+/* 7257 */ {20,130},
+/* 7258 */ {20,130},
+/* 7259 */ {20,130},
+/* 7260 */ {20,130},
+/* 7261 */ {20,130},
+/* 7262 */ {20,130},
+/* 7263 */ {20,130},
+/* 7264 */ {20,130},
+/* 7265 */ {20,130},
+/* 7266 */ {20,130},
+/* 7267 */ {20,130},
+/* 7268 */ {20,130},
+/* 7269 */ {20,130},
+/* 7270 */ {20,130},
+/* 7271 */ {20,130},
+/* 7272 */ {20,130},
+/* 7273 */ {20,130},
+/* 7274 */ {20,130},
+/* 7275 */ {20,130},
+/* 7276 */ {20,130},
+/* 7277 */ {20,130},
+/* 7278 */ {20,130},
+/* 7279 */ {20,130},
+/* 7280 */ {20,130},
+/* 7281 */ {20,130},
+/* 7282 */ {20,130},
+/* 7283 */ {20,130},
+/* 7284 */ {20,130},
+/* 7285 */ {20,130},
+/* 7286 */ {20,130},
+/* 7287 */ {20,130},
+/* 7288 */ {20,130},
+/* 7289 */ {20,130},
+/* 7290 */ {20,130},
+/* 7291 */ {20,130},
+/* 7292 */ {20,130},
+/* 7293 */ {20,130},
+/* 7294 */ {20,130},
+/* 7295 */ {20,130},
+/* 7296 */ {20,130},
+/* 7297 */ {20,130},
+/* 7298 */ {20,130},
+/* 7299 */ {20,130},
+/* 7300 */ {20,130},
+/* 7301 */ {20,130},
+/* 7302 */ {20,130},
+/* 7303 */ {20,130},
+/* 7304 */ {20,130},
+/* 7305 */ {20,130},
+/* 7306 */ {20,130},
+/* 7307 */ {20,130},
+/* 7308 */ {20,130},
+/* 7309 */ {20,130},
+/* 7310 */ {20,130},
+/* 7311 */ {20,130},
+/* 7312 */ {20,130},
+/* 7313 */ {20,130},
+/* 7314 */ {20,130},
+/* 7315 */ {20,130},
+/* 7316 */ {20,130},
+/* 7317 */ {20,130},
+/* 7318 */ {20,130},
+/* 7319 */ {20,130},
+/* 7320 */ {20,130},
+/* 7321 */ {20,130},
+/* 7322 */ {20,130},
+/* 7323 */ {20,130},
+/* 7324 */ {20,130},
+/* 7325 */ {20,130},
+/* 7326 */ {20,130},
+/* 7327 */ {20,130},
+/* 7328 */ {20,130},
+/* 7329 */ {20,130},
+/* 7330 */ {20,130},
+/* 7331 */ {20,130},
+/* 7332 */ {20,130},
+/* 7333 */ {20,130},
+/* 7334 */ {20,130},
+/* 7335 */ {20,130},
+/* 7336 */ {20,130},
+/* 7337 */ {20,130},
+/* 7338 */ {20,130},
+/* 7339 */ {20,130},
+/* 7340 */ {20,130},
+/* 7341 */ {20,130},
+/* 7342 */ {20,130},
+/* 7343 */ {20,130},
+/* 7344 */ {20,130},
+/* 7345 */ {20,130},
+/* 7346 */ {20,130},
+/* 7347 */ {20,130},
+/* 7348 */ {20,130},
+/* 7349 */ {20,130},
+/* 7350 */ {20,130},
+/* 7351 */ {20,130},
+/* 7352 */ {20,130},
+/* 7353 */ {20,130},
+/* 7354 */ {20,130},
+/* 7355 */ {20,130},
+/* 7356 */ {20,130},
+/* 7357 */ {20,130},
+/* 7358 */ {20,130},
+/* 7359 */ {20,130},
+/* 7360 */ {20,130},
+/* 7361 */ {20,130},
+/* 7362 */ {20,130},
+/* 7363 */ {20,130},
+/* 7364 */ {20,130},
+/* 7365 */ {20,130},
+/* 7366 */ {20,130},
+/* 7367 */ {20,130},
+/* 7368 */ {20,130},
+/* 7369 */ {20,130},
+/* 7370 */ {20,130},
+/* 7371 */ {20,130},
+/* 7372 */ {20,130},
+/* 7373 */ {20,130},
+/* 7374 */ {20,130},
+/* 7375 */ {20,130},
+/* 7376 */ {20,130},
+/* 7377 */ {20,130},
+/* 7378 */ {20,130},
+/* 7379 */ {20,130},
+/* 7380 */ {20,130},
+/* 7381 */ {20,130},
+/* 7382 */ {20,130},
+/* 7383 */ {20,130},
+/* 7384 */ {20,130},
+/* 7385 */ {20,130},
+/* 7386 */ {20,130},
+/* 7387 */ {20,130},
+/* 7388 */ {20,130},
+/* 7389 */ {20,130},
+/* 7390 */ {20,130},
+/* 7391 */ {20,130},
+/* 7392 */ {20,130},
+/* 7393 */ {20,130},
+/* 7394 */ {20,130},
+/* 7395 */ {20,130},
+/* 7396 */ {20,130},
+/* 7397 */ {20,130},
+/* 7398 */ {20,130},
+/* 7399 */ {20,130},
+/* 7400 */ {20,130},
+/* 7401 */ {20,130},
+/* 7402 */ {20,130},
+/* 7403 */ {20,130},
+/* 7404 */ {20,130},
+/* 7405 */ {20,130},
+/* 7406 */ {20,130},
+/* 7407 */ {20,130},
+/* 7408 */ {20,130},
+/* 7409 */ {20,130},
+/* 7410 */ {20,130},
+/* 7411 */ {20,130},
+/* 7412 */ {20,130},
+/* 7413 */ {20,130},
+/* 7414 */ {20,130},
+/* 7415 */ {20,130},
+/* 7416 */ {20,130},
+/* 7417 */ {20,130},
+/* 7418 */ {20,130},
+/* 7419 */ {20,130},
+/* 7420 */ {20,130},
+/* 7421 */ {20,130},
+/* 7422 */ {20,130},
+/* 7423 */ {20,130},
+/* 7424 */ {20,130},
+/* 7425 */ {20,130},
+/* 7426 */ {20,130},
+/* 7427 */ {20,130},
+/* 7428 */ {20,130},
+/* 7429 */ {20,130},
+/* 7430 */ {20,130},
+/* 7431 */ {20,130},
+/* 7432 */ {20,130},
+/* 7433 */ {20,130},
+/* 7434 */ {20,130},
+/* 7435 */ {20,130},
+/* 7436 */ {20,130},
+/* 7437 */ {20,130},
+/* 7438 */ {20,130},
+/* 7439 */ {20,130},
+/* 7440 */ {20,130},
+/* 7441 */ {20,130},
+/* 7442 */ {20,130},
+/* 7443 */ {20,130},
+/* 7444 */ {20,130},
+/* 7445 */ {20,130},
+/* 7446 */ {20,130},
+/* 7447 */ {20,130},
+/* 7448 */ {20,130},
+/* 7449 */ {20,130},
+/* 7450 */ {20,130},
+/* 7451 */ {20,130},
+/* 7452 */ {20,130},
+/* 7453 */ {20,130},
+/* 7454 */ {20,130},
+/* 7455 */ {20,130},
+/* 7456 */ {20,130},
+/* 7457 */ {20,130},
+/* 7458 */ {20,130},
+/* 7459 */ {20,130},
+/* 7460 */ {20,130},
+/* 7461 */ {20,130},
+/* 7462 */ {20,130},
+/* 7463 */ {20,130},
+/* 7464 */ {20,130},
+/* 7465 */ {20,130},
+/* 7466 */ {20,130},
+/* 7467 */ {20,130},
+/* 7468 */ {20,130},
+/* 7469 */ {20,130},
+/* 7470 */ {20,130},
+/* 7471 */ {20,130},
+/* 7472 */ {20,130},
+/* 7473 */ {20,130},
+/* 7474 */ {20,130},
+/* 7475 */ {20,130},
+/* 7476 */ {20,130},
+/* 7477 */ {20,130},
+/* 7478 */ {20,130},
+/* 7479 */ {20,130},
+/* 7480 */ {20,130},
+/* 7481 */ {20,130},
+/* 7482 */ {20,130},
+/* 7483 */ {20,130},
+/* 7484 */ {20,130},
+/* 7485 */ {20,130},
+/* 7486 */ {20,130},
+/* 7487 */ {20,130},
+/* 7488 */ {20,130},
+/* 7489 */ {20,130},
+/* 7490 */ {20,130},
+/* 7491 */ {20,130},
+/* 7492 */ {20,130},
+/* 7493 */ {20,130},
+/* 7494 */ {20,130},
+/* 7495 */ {20,130},
+/* 7496 */ {20,130},
+/* 7497 */ {20,130},
+/* 7498 */ {20,130},
+/* 7499 */ {20,130},
+/* 7500 */ {20,130},
+/* 7501 */ {20,130},
+/* 7502 */ {20,130},
+/* 7503 */ {20,130},
+/* 7504 */ {20,130},
+/* 7505 */ {20,130},
+/* 7506 */ {20,130},
+/* 7507 */ {20,130},
+/* 7508 */ {20,130},
+/* 7509 */ {20,130},
+/* 7510 */ {20,130},
+/* 7511 */ {20,130},
+/* 7512 */ {20,130},
+/* 7513 */ {20,130},
+/* 7514 */ {20,130},
+/* 7515 */ {20,130},
+/* 7516 */ {20,130},
+/* 7517 */ {20,130},
+/* 7518 */ {20,130},
+/* 7519 */ {20,130},
+/* 7520 */ {20,130},
+/* 7521 */ {20,130},
+/* 7522 */ {20,130},
+/* 7523 */ {20,130},
+/* 7524 */ {20,130},
+/* 7525 */ {20,130},
+/* 7526 */ {20,130},
+/* 7527 */ {20,130},
+/* 7528 */ {20,130},
+/* 7529 */ {20,130},
+/* 7530 */ {20,130},
+/* 7531 */ {20,130},
+/* 7532 */ {20,130},
+/* 7533 */ {20,130},
+/* 7534 */ {20,130},
+/* 7535 */ {20,130},
+/* 7536 */ {20,130},
+/* 7537 */ {20,130},
+/* 7538 */ {20,130},
+/* 7539 */ {20,130},
+/* 7540 */ {20,130},
+/* 7541 */ {20,130},
+/* 7542 */ {20,130},
+/* 7543 */ {20,130},
+/* 7544 */ {20,130},
+/* 7545 */ {20,130},
+/* 7546 */ {20,130},
+/* 7547 */ {20,130},
+/* 7548 */ {20,130},
+/* 7549 */ {20,130},
+/* 7550 */ {20,130},
+/* 7551 */ {20,130},
+/* 7552 */ {20,130},
+/* 7553 */ {20,130},
+/* 7554 */ {20,130},
+/* 7555 */ {20,130},
+/* 7556 */ {20,130},
+/* 7557 */ {20,130},
+/* 7558 */ {20,130},
+/* 7559 */ {20,130},
+/* 7560 */ {20,130},
+/* 7561 */ {20,130},
+/* 7562 */ {20,130},
+/* 7563 */ {20,130},
+/* 7564 */ {20,130},
+/* 7565 */ {20,130},
+/* 7566 */ {20,130},
+/* 7567 */ {20,130},
+/* 7568 */ {20,130},
+/* 7569 */ {20,130},
+/* 7570 */ {20,130},
+/* 7571 */ {20,130},
+/* 7572 */ {20,130},
+/* 7573 */ {20,130},
+/* 7574 */ {20,130},
+/* 7575 */ {20,130},
+/* 7576 */ {20,130},
+/* 7577 */ {20,130},
+/* 7578 */ {20,130},
+/* 7579 */ {20,130},
+/* 7580 */ {20,130},
+/* 7581 */ {20,130},
+/* 7582 */ {20,130},
+/* 7583 */ {20,130},
+/* 7584 */ {20,130},
+/* 7585 */ {20,130},
+/* 7586 */ {20,130},
+/* 7587 */ {20,130},
+/* 7588 */ {20,130},
+/* 7589 */ {20,130},
+/* 7590 */ {20,130},
+/* 7591 */ {20,130},
+/* 7592 */ {20,130},
+/* 7593 */ {20,130},
+/* 7594 */ {20,130},
+/* 7595 */ {20,130},
+/* 7596 */ {20,130},
+/* 7597 */ {20,130},
+/* 7598 */ {20,130},
+/* 7599 */ {20,130},
+/* 7600 */ {20,130},
+/* 7601 */ {20,130},
+/* 7602 */ {20,130},
+/* 7603 */ {20,130},
+/* 7604 */ {20,130},
+/* 7605 */ {20,130},
+/* 7606 */ {20,130},
+/* 7607 */ {20,130},
+/* 7608 */ {20,130},
+/* 7609 */ {20,130},
+/* 7610 */ {20,130},
+/* 7611 */ {20,130},
+/* 7612 */ {20,130},
+/* 7613 */ {20,130},
+/* 7614 */ {20,130},
+/* 7615 */ {20,130},
+/* 7616 */ {20,130},
+/* 7617 */ {20,130},
+/* 7618 */ {20,130},
+/* 7619 */ {20,130},
+/* 7620 */ {20,130},
+/* 7621 */ {20,130},
+/* 7622 */ {20,130},
+/* 7623 */ {20,130},
+/* 7624 */ {20,130},
+/* 7625 */ {20,130},
+/* 7626 */ {20,130},
+/* 7627 */ {20,130},
+/* 7628 */ {20,130},
+/* 7629 */ {20,130},
+/* 7630 */ {20,130},
+/* 7631 */ {20,130},
+/* 7632 */ {20,130},
+/* 7633 */ {20,130},
+/* 7634 */ {20,130},
+/* 7635 */ {20,130},
+/* 7636 */ {20,130},
+/* 7637 */ {20,130},
+/* 7638 */ {20,130},
+/* 7639 */ {20,130},
+/* 7640 */ {20,130},
+/* 7641 */ {20,130},
+/* 7642 */ {20,130},
+/* 7643 */ {20,130},
+/* 7644 */ {20,130},
+/* 7645 */ {20,130},
+/* 7646 */ {20,130},
+/* 7647 */ {20,130},
+/* 7648 */ {20,130},
+/* 7649 */ {20,130},
+/* 7650 */ {20,130},
+/* 7651 */ {20,130},
+/* 7652 */ {20,130},
+/* 7653 */ {20,130},
+/* 7654 */ {20,130},
+/* 7655 */ {20,130},
+/* 7656 */ {20,130},
+/* 7657 */ {20,130},
+/* 7658 */ {20,130},
+/* 7659 */ {20,130},
+/* 7660 */ {20,130},
+/* 7661 */ {20,130},
+/* 7662 */ {20,130},
+/* 7663 */ {20,130},
+/* 7664 */ {20,130},
+/* 7665 */ {20,130},
+/* 7666 */ {20,130},
+/* 7667 */ {20,130},
+/* 7668 */ {20,130},
+/* 7669 */ {20,130},
+/* 7670 */ {20,130},
+/* 7671 */ {20,130},
+/* 7672 */ {20,130},
+/* 7673 */ {20,130},
+/* 7674 */ {20,130},
+/* 7675 */ {20,130},
+/* 7676 */ {20,130},
+/* 7677 */ {20,130},
+/* 7678 */ {20,130},
+/* 7679 */ {20,130},
+/* 7680 */ {20,130},
+/* 7681 */ {20,130},
+/* 7682 */ {20,130},
+/* 7683 */ {20,130},
+/* 7684 */ {20,130},
+/* 7685 */ {20,130},
+/* 7686 */ {20,130},
+/* 7687 */ {20,130},
+/* 7688 */ {20,130},
+/* 7689 */ {20,130},
+/* 7690 */ {20,130},
+/* 7691 */ {20,130},
+/* 7692 */ {20,130},
+/* 7693 */ {20,130},
+/* 7694 */ {20,130},
+/* 7695 */ {20,130},
+/* 7696 */ {20,130},
+/* 7697 */ {20,130},
+/* 7698 */ {20,130},
+/* 7699 */ {20,130},
+/* 7700 */ {20,130},
+/* 7701 */ {20,130},
+/* 7702 */ {20,130},
+/* 7703 */ {20,130},
+/* 7704 */ {20,130},
+/* 7705 */ {20,130},
+/* 7706 */ {20,130},
+/* 7707 */ {20,130},
+/* 7708 */ {20,130},
+/* 7709 */ {20,130},
+/* 7710 */ {20,130},
+/* 7711 */ {20,130},
+/* 7712 */ {20,130},
+/* 7713 */ {20,130},
+/* 7714 */ {20,130},
+/* 7715 */ {20,130},
+/* 7716 */ {20,130},
+/* 7717 */ {20,130},
+/* 7718 */ {20,130},
+/* 7719 */ {20,130},
+/* 7720 */ {20,130},
+/* 7721 */ {20,130},
+/* 7722 */ {20,130},
+/* 7723 */ {20,130},
+/* 7724 */ {20,130},
+/* 7725 */ {20,130},
+/* 7726 */ {20,130},
+/* 7727 */ {20,130},
+/* 7728 */ {20,130},
+/* 7729 */ {20,130},
+/* 7730 */ {20,130},
+/* 7731 */ {20,130},
+/* 7732 */ {20,130},
+/* 7733 */ {20,130},
+/* 7734 */ {20,130},
+/* 7735 */ {20,130},
+/* 7736 */ {20,130},
+/* 7737 */ {20,130},
+/* 7738 */ {20,130},
+/* 7739 */ {20,130},
+/* 7740 */ {20,130},
+/* 7741 */ {20,130},
+/* 7742 */ {20,130},
+/* 7743 */ {20,130},
+/* 7744 */ {20,130},
+/* 7745 */ {20,130},
+/* 7746 */ {20,130},
+/* 7747 */ {20,130},
+/* 7748 */ {20,130},
+/* 7749 */ {20,130},
+/* 7750 */ {20,130},
+/* 7751 */ {20,130},
+/* 7752 */ {20,130},
+/* 7753 */ {20,130},
+/* 7754 */ {20,130},
+/* 7755 */ {20,130},
+/* 7756 */ {20,130},
+/* 7757 */ {20,130},
+/* 7758 */ {20,130},
+/* 7759 */ {20,130},
+/* 7760 */ {20,130},
+/* 7761 */ {20,130},
+/* 7762 */ {20,130},
+/* 7763 */ {20,130},
+/* 7764 */ {20,130},
+/* 7765 */ {20,130},
+/* 7766 */ {20,130},
+/* 7767 */ {20,130},
+/* 7768 */ {20,130},
+/* 7769 */ {20,130},
+/* 7770 */ {20,130},
+/* 7771 */ {20,130},
+/* 7772 */ {20,130},
+/* 7773 */ {20,130},
+/* 7774 */ {20,130},
+/* 7775 */ {20,130},
+/* 7776 */ {20,130},
+/* 7777 */ {20,130},
+/* 7778 */ {20,130},
+/* 7779 */ {20,130},
+/* 7780 */ {20,130},
+/* 7781 */ {20,130},
+/* 7782 */ {20,130},
+/* 7783 */ {20,130},
+/* 7784 */ {20,130},
+/* 7785 */ {20,130},
+/* 7786 */ {20,130},
+/* 7787 */ {20,130},
+/* 7788 */ {20,130},
+/* 7789 */ {20,130},
+/* 7790 */ {20,130},
+/* 7791 */ {20,130},
+/* 7792 */ {20,130},
+/* 7793 */ {20,130},
+/* 7794 */ {20,130},
+/* 7795 */ {20,130},
+/* 7796 */ {20,130},
+/* 7797 */ {20,130},
+/* 7798 */ {20,130},
+/* 7799 */ {20,130},
+/* 7800 */ {20,130},
+/* 7801 */ {20,130},
+/* 7802 */ {20,130},
+/* 7803 */ {20,130},
+/* 7804 */ {20,130},
+/* 7805 */ {20,130},
+/* 7806 */ {20,130},
+/* 7807 */ {20,130},
+/* 7808 */ {20,130},
+/* 7809 */ {20,130},
+/* 7810 */ {20,130},
+/* 7811 */ {20,130},
+/* 7812 */ {20,130},
+/* 7813 */ {20,130},
+/* 7814 */ {20,130},
+/* 7815 */ {20,130},
+/* 7816 */ {20,130},
+/* 7817 */ {20,130},
+/* 7818 */ {20,130},
+/* 7819 */ {20,130},
+/* 7820 */ {20,130},
+/* 7821 */ {20,130},
+/* 7822 */ {20,130},
+/* 7823 */ {20,130},
+/* 7824 */ {20,130},
+/* 7825 */ {20,130},
+/* 7826 */ {20,130},
+/* 7827 */ {20,130},
+/* 7828 */ {20,130},
+/* 7829 */ {20,130},
+/* 7830 */ {20,130},
+/* 7831 */ {20,130},
+/* 7832 */ {20,130},
+/* 7833 */ {20,130},
+/* 7834 */ {20,130},
+/* 7835 */ {20,130},
+/* 7836 */ {20,130},
+/* 7837 */ {20,130},
+/* 7838 */ {20,130},
+/* 7839 */ {20,130},
+/* 7840 */ {20,130},
+/* 7841 */ {20,130},
+/* 7842 */ {20,130},
+/* 7843 */ {20,130},
+/* 7844 */ {20,130},
+/* 7845 */ {20,130},
+/* 7846 */ {20,130},
+/* 7847 */ {20,130},
+/* 7848 */ {20,130},
+/* 7849 */ {20,130},
+/* 7850 */ {20,130},
+/* 7851 */ {20,130},
+/* 7852 */ {20,130},
+/* 7853 */ {20,130},
+/* 7854 */ {20,130},
+/* 7855 */ {20,130},
+/* 7856 */ {20,130},
+/* 7857 */ {20,130},
+/* 7858 */ {20,130},
+/* 7859 */ {20,130},
+/* 7860 */ {20,130},
+/* 7861 */ {20,130},
+/* 7862 */ {20,130},
+/* 7863 */ {20,130},
+/* 7864 */ {20,130},
+/* 7865 */ {20,130},
+/* 7866 */ {20,130},
+/* 7867 */ {20,130},
+/* 7868 */ {20,130},
+/* 7869 */ {20,130},
+/* 7870 */ {20,130},
+/* 7871 */ {20,130},
+/* 7872 */ {20,130},
+/* 7873 */ {20,130},
+/* 7874 */ {20,130},
+/* 7875 */ {20,130},
+/* 7876 */ {20,130},
+/* 7877 */ {20,130},
+/* 7878 */ {20,130},
+/* 7879 */ {20,130},
+/* 7880 */ {20,130},
+/* 7881 */ {20,130},
+/* 7882 */ {20,130},
+/* 7883 */ {20,130},
+/* 7884 */ {20,130},
+/* 7885 */ {20,130},
+/* 7886 */ {20,130},
+/* 7887 */ {20,130},
+/* 7888 */ {20,130},
+/* 7889 */ {20,130},
+/* 7890 */ {20,130},
+/* 7891 */ {20,130},
+/* 7892 */ {20,130},
+/* 7893 */ {20,130},
+/* 7894 */ {20,130},
+/* 7895 */ {20,130},
+/* 7896 */ {20,130},
+/* 7897 */ {20,130},
+/* 7898 */ {20,130},
+/* 7899 */ {20,130},
+/* 7900 */ {20,130},
+/* 7901 */ {20,130},
+/* 7902 */ {20,130},
+/* 7903 */ {20,130},
+/* 7904 */ {20,130},
+/* 7905 */ {20,130},
+/* 7906 */ {20,130},
+/* 7907 */ {20,130},
+/* 7908 */ {20,130},
+/* 7909 */ {20,130},
+/* 7910 */ {20,130},
+/* 7911 */ {20,130},
+/* 7912 */ {20,130},
+/* 7913 */ {20,130},
+/* 7914 */ {20,130},
+/* 7915 */ {20,130},
+/* 7916 */ {20,130},
+/* 7917 */ {20,130},
+/* 7918 */ {20,130},
+/* 7919 */ {20,130},
+/* 7920 */ {20,130},
+/* 7921 */ {20,130},
+/* 7922 */ {20,130},
+/* 7923 */ {20,130},
+/* 7924 */ {20,130},
+/* 7925 */ {20,130},
+/* 7926 */ {20,130},
+/* 7927 */ {20,130},
+/* 7928 */ {20,130},
+/* 7929 */ {20,130},
+/* 7930 */ {20,130},
+/* 7931 */ {20,130},
+/* 7932 */ {20,130},
+/* 7933 */ {20,130},
+/* 7934 */ {20,130},
+/* 7935 */ {20,130},
+/* 7936 */ {20,130},
+/* 7937 */ {20,130},
+/* 7938 */ {20,130},
+/* 7939 */ {20,130},
+/* 7940 */ {20,130},
+/* 7941 */ {20,130},
+/* 7942 */ {20,130},
+/* 7943 */ {20,130},
+/* 7944 */ {20,130},
+/* 7945 */ {20,130},
+/* 7946 */ {20,130},
+/* 7947 */ {20,130},
+/* 7948 */ {20,130},
+/* 7949 */ {20,130},
+/* 7950 */ {20,130},
+/* 7951 */ {20,130},
+/* 7952 */ {20,130},
+/* 7953 */ {20,130},
+/* 7954 */ {20,130},
+/* 7955 */ {20,130},
+/* 7956 */ {20,130},
+/* 7957 */ {20,130},
+/* 7958 */ {20,130},
+/* 7959 */ {20,130},
+/* 7960 */ {20,130},
+/* 7961 */ {20,130},
+/* 7962 */ {20,130},
+/* 7963 */ {20,130},
+/* 7964 */ {20,130},
+/* 7965 */ {20,130},
+/* 7966 */ {20,130},
+/* 7967 */ {20,130},
+/* 7968 */ {20,130},
+/* 7969 */ {20,130},
+/* 7970 */ {20,130},
+/* 7971 */ {20,130},
+/* 7972 */ {20,130},
+/* 7973 */ {20,130},
+/* 7974 */ {20,130},
+/* 7975 */ {20,130},
+/* 7976 */ {20,130},
+/* 7977 */ {20,130},
+/* 7978 */ {20,130},
+/* 7979 */ {20,130},
+/* 7980 */ {20,130},
+/* 7981 */ {20,130},
+/* 7982 */ {20,130},
+/* 7983 */ {20,130},
+/* 7984 */ {20,130},
+/* 7985 */ {20,130},
+/* 7986 */ {20,130},
+/* 7987 */ {20,130},
+/* 7988 */ {20,130},
+/* 7989 */ {20,130},
+/* 7990 */ {20,130},
+/* 7991 */ {20,130},
+/* 7992 */ {20,130},
+/* 7993 */ {20,130},
+/* 7994 */ {20,130},
+/* 7995 */ {20,130},
+/* 7996 */ {20,130},
+/* 7997 */ {20,130},
+/* 7998 */ {20,130},
+/* 7999 */ {20,130},
+/* 8000 */ {20,130},
+/* 8001 */ {20,130},
+/* 8002 */ {20,130},
+/* 8003 */ {20,130},
+/* 8004 */ {20,130},
+/* 8005 */ {20,130},
+/* 8006 */ {20,130},
+/* 8007 */ {20,130},
+/* 8008 */ {20,130},
+/* 8009 */ {20,130},
+/* 8010 */ {20,130},
+/* 8011 */ {20,130},
+/* 8012 */ {20,130},
+/* 8013 */ {20,130},
+/* 8014 */ {20,130},
+/* 8015 */ {20,130},
+/* 8016 */ {20,130},
+/* 8017 */ {20,130},
+/* 8018 */ {20,130},
+/* 8019 */ {20,130},
+/* 8020 */ {20,130},
+/* 8021 */ {20,130},
+/* 8022 */ {20,130},
+/* 8023 */ {20,130},
+/* 8024 */ {20,130},
+/* 8025 */ {20,130},
+/* 8026 */ {20,130},
+/* 8027 */ {20,130},
+/* 8028 */ {20,130},
+/* 8029 */ {20,130},
+/* 8030 */ {20,130},
+/* 8031 */ {20,130},
+/* 8032 */ {20,130},
+/* 8033 */ {20,130},
+/* 8034 */ {20,130},
+/* 8035 */ {20,130},
+/* 8036 */ {20,130},
+/* 8037 */ {20,130},
+/* 8038 */ {20,130},
+/* 8039 */ {20,130},
+/* 8040 */ {20,130},
+/* 8041 */ {20,130},
+/* 8042 */ {20,130},
+/* 8043 */ {20,130},
+/* 8044 */ {20,130},
+/* 8045 */ {20,130},
+/* 8046 */ {20,130},
+/* 8047 */ {20,130},
+/* 8048 */ {20,130},
+/* 8049 */ {20,130},
+/* 8050 */ {20,130},
+/* 8051 */ {20,130},
+/* 8052 */ {20,130},
+/* 8053 */ {20,130},
+/* 8054 */ {20,130},
+/* 8055 */ {20,130},
+/* 8056 */ {20,130},
+/* 8057 */ {20,130},
+/* 8058 */ {20,130},
+/* 8059 */ {20,130},
+/* 8060 */ {20,130},
+/* 8061 */ {20,130},
+/* 8062 */ {20,130},
+/* 8063 */ {20,130},
+/* 8064 */ {20,130},
+/* 8065 */ {20,130},
+/* 8066 */ {20,130},
+/* 8067 */ {20,130},
+/* 8068 */ {20,130},
+/* 8069 */ {20,130},
+/* 8070 */ {20,130},
+/* 8071 */ {20,130},
+/* 8072 */ {20,130},
+/* 8073 */ {20,130},
+/* 8074 */ {20,130},
+/* 8075 */ {20,130},
+/* 8076 */ {20,130},
+/* 8077 */ {20,130},
+/* 8078 */ {20,130},
+/* 8079 */ {20,130},
+/* 8080 */ {20,130},
+/* 8081 */ {20,130},
+/* 8082 */ {20,130},
+/* 8083 */ {20,130},
+/* 8084 */ {20,130},
+/* 8085 */ {20,130},
+/* 8086 */ {20,130},
+/* 8087 */ {20,130},
+/* 8088 */ {20,130},
+/* 8089 */ {20,130},
+/* 8090 */ {20,130},
+/* 8091 */ {20,130},
+/* 8092 */ {20,130},
+/* 8093 */ {20,130},
+/* 8094 */ {20,130},
+/* 8095 */ {20,130},
+/* 8096 */ {20,130},
+/* 8097 */ {20,130},
+/* 8098 */ {20,130},
+/* 8099 */ {20,130},
+/* 8100 */ {20,130},
+/* 8101 */ {20,130},
+/* 8102 */ {20,130},
+/* 8103 */ {20,130},
+/* 8104 */ {20,130},
+/* 8105 */ {20,130},
+/* 8106 */ {20,130},
+/* 8107 */ {20,130},
+/* 8108 */ {20,130},
+/* 8109 */ {20,130},
+/* 8110 */ {20,130},
+/* 8111 */ {20,130},
+/* 8112 */ {20,130},
+/* 8113 */ {20,130},
+/* 8114 */ {20,130},
+/* 8115 */ {20,130},
+/* 8116 */ {20,130},
+/* 8117 */ {20,130},
+/* 8118 */ {20,130},
+/* 8119 */ {20,130},
+/* 8120 */ {20,130},
+/* 8121 */ {20,130},
+/* 8122 */ {20,130},
+/* 8123 */ {20,130},
+/* 8124 */ {20,130},
+/* 8125 */ {20,130},
+/* 8126 */ {20,130},
+/* 8127 */ {20,130},
+/* 8128 */ {20,130},
+/* 8129 */ {20,130},
+/* 8130 */ {20,130},
+/* 8131 */ {20,130},
+/* 8132 */ {20,130},
+/* 8133 */ {20,130},
+/* 8134 */ {20,130},
+/* 8135 */ {20,130},
+/* 8136 */ {20,130},
+/* 8137 */ {20,130},
+/* 8138 */ {20,130},
+/* 8139 */ {20,130},
+/* 8140 */ {20,130},
+/* 8141 */ {20,130},
+/* 8142 */ {20,130},
+/* 8143 */ {20,130},
+/* 8144 */ {20,130},
+/* 8145 */ {20,130},
+/* 8146 */ {20,130},
+/* 8147 */ {20,130},
+/* 8148 */ {20,130},
+/* 8149 */ {20,130},
+/* 8150 */ {20,130},
+/* 8151 */ {20,130},
+/* 8152 */ {20,130},
+/* 8153 */ {20,130},
+/* 8154 */ {20,130},
+/* 8155 */ {20,130},
+/* 8156 */ {20,130},
+/* 8157 */ {20,130},
+/* 8158 */ {20,130},
+/* 8159 */ {20,130},
+/* 8160 */ {20,130},
+/* 8161 */ {20,130},
+/* 8162 */ {20,130},
+/* 8163 */ {20,130},
+/* 8164 */ {20,130},
+/* 8165 */ {20,130},
+/* 8166 */ {20,130},
+/* 8167 */ {20,130},
+/* 8168 */ {20,130},
+/* 8169 */ {20,130},
+/* 8170 */ {20,130},
+/* 8171 */ {20,130},
+/* 8172 */ {20,130},
+/* 8173 */ {20,130},
+/* 8174 */ {20,130},
+/* 8175 */ {20,130},
+/* 8176 */ {20,130},
+/* 8177 */ {20,130},
+/* 8178 */ {20,130},
+/* 8179 */ {20,130},
+/* 8180 */ {20,130},
+/* 8181 */ {20,130},
+/* 8182 */ {20,130},
+/* 8183 */ {20,130},
+/* 8184 */ {20,130},
+/* 8185 */ {20,130},
+/* 8186 */ {20,130},
+/* 8187 */ {20,130},
+/* 8188 */ {20,130},
+/* 8189 */ {20,130},
+/* 8190 */ {20,130},
+/* 8191 */ {20,130},
+/* 8192 */ {20,131},
+/* 8193 */ {20,131},
+/* 8194 */ {20,131},
+/* 8195 */ {20,131},
+/* 8196 */ {20,131},
+/* 8197 */ {20,131},
+/* 8198 */ {20,131},
+/* 8199 */ {20,131},
+/* 8200 */ {20,131},
+/* 8201 */ {20,131},
+/* 8202 */ {20,131},
+/* 8203 */ {20,131},
+/* 8204 */ {20,131},
+/* 8205 */ {20,131},
+/* 8206 */ {20,131},
+/* 8207 */ {20,131},
+/* 8208 */ {20,131},
+/* 8209 */ {20,131},
+/* 8210 */ {20,131},
+/* 8211 */ {20,131},
+/* 8212 */ {20,131},
+/* 8213 */ {20,131},
+/* 8214 */ {20,131},
+/* 8215 */ {20,131},
+/* 8216 */ {20,131},
+/* 8217 */ {20,131},
+/* 8218 */ {20,131},
+/* 8219 */ {20,131},
+/* 8220 */ {20,131},
+/* 8221 */ {20,131},
+/* 8222 */ {20,131},
+/* 8223 */ {20,131},
+/* 8224 */ {20,131},
+/* 8225 */ {20,131},
+/* 8226 */ {20,131},
+/* 8227 */ {20,131},
+/* 8228 */ {20,131},
+/* 8229 */ {20,131},
+/* 8230 */ {20,131},
+/* 8231 */ {20,131},
+/* 8232 */ {20,131},
+/* 8233 */ {20,131},
+/* 8234 */ {20,131},
+/* 8235 */ {20,131},
+/* 8236 */ {20,131},
+/* 8237 */ {20,131},
+/* 8238 */ {20,131},
+/* 8239 */ {20,131},
+/* 8240 */ {20,131},
+/* 8241 */ {20,131},
+/* 8242 */ {20,131},
+/* 8243 */ {20,131},
+/* 8244 */ {20,131},
+/* 8245 */ {20,131},
+/* 8246 */ {20,131},
+/* 8247 */ {20,131},
+/* 8248 */ {20,131},
+/* 8249 */ {20,131},
+/* 8250 */ {20,131},
+/* 8251 */ {20,131},
+/* 8252 */ {20,131},
+/* 8253 */ {20,131},
+/* 8254 */ {20,131},
+/* 8255 */ {20,131},
+/* 8256 */ {20,131},
+/* 8257 */ {20,131},
+/* 8258 */ {20,131},
+/* 8259 */ {20,131},
+/* 8260 */ {20,131},
+/* 8261 */ {20,131},
+/* 8262 */ {20,131},
+/* 8263 */ {20,131},
+/* 8264 */ {20,131},
+/* 8265 */ {20,131},
+/* 8266 */ {20,131},
+/* 8267 */ {20,131},
+/* 8268 */ {20,131},
+/* 8269 */ {20,131},
+/* 8270 */ {20,131},
+/* 8271 */ {20,131},
+/* 8272 */ {20,131},
+/* 8273 */ {20,131},
+/* 8274 */ {20,131},
+/* 8275 */ {20,131},
+/* 8276 */ {20,131},
+/* 8277 */ {20,131},
+/* 8278 */ {20,131},
+/* 8279 */ {20,131},
+/* 8280 */ {20,131},
+/* 8281 */ {20,131},
+/* 8282 */ {20,131},
+/* 8283 */ {20,131},
+/* 8284 */ {20,131},
+/* 8285 */ {20,131},
+/* 8286 */ {20,131},
+/* 8287 */ {20,131},
+/* 8288 */ {20,131},
+/* 8289 */ {20,131},
+/* 8290 */ {20,131},
+/* 8291 */ {20,131},
+/* 8292 */ {20,131},
+/* 8293 */ {20,131},
+/* 8294 */ {20,131},
+/* 8295 */ {20,131},
+/* 8296 */ {20,131},
+/* 8297 */ {20,131},
+/* 8298 */ {20,131},
+/* 8299 */ {20,131},
+/* 8300 */ {20,131},
+/* 8301 */ {20,131},
+/* 8302 */ {20,131},
+/* 8303 */ {20,131},
+/* 8304 */ {20,131},
+/* 8305 */ {20,131},
+/* 8306 */ {20,131},
+/* 8307 */ {20,131},
+/* 8308 */ {20,131},
+/* 8309 */ {20,131},
+/* 8310 */ {20,131},
+/* 8311 */ {20,131},
+/* 8312 */ {20,131},
+/* 8313 */ {20,131},
+/* 8314 */ {20,131},
+/* 8315 */ {20,131},
+/* 8316 */ {20,131},
+/* 8317 */ {20,131},
+/* 8318 */ {20,131},
+/* 8319 */ {20,131},
+/* 8320 */ {20,131},
+/* 8321 */ {20,131},
+/* 8322 */ {20,131},
+/* 8323 */ {20,131},
+/* 8324 */ {20,131},
+/* 8325 */ {20,131},
+/* 8326 */ {20,131},
+/* 8327 */ {20,131},
+/* 8328 */ {20,131},
+/* 8329 */ {20,131},
+/* 8330 */ {20,131},
+/* 8331 */ {20,131},
+/* 8332 */ {20,131},
+/* 8333 */ {20,131},
+/* 8334 */ {20,131},
+/* 8335 */ {20,131},
+/* 8336 */ {20,131},
+/* 8337 */ {20,131},
+/* 8338 */ {20,131},
+/* 8339 */ {20,131},
+/* 8340 */ {20,131},
+/* 8341 */ {20,131},
+/* 8342 */ {20,131},
+/* 8343 */ {20,131},
+/* 8344 */ {20,131},
+/* 8345 */ {20,131},
+/* 8346 */ {20,131},
+/* 8347 */ {20,131},
+/* 8348 */ {20,131},
+/* 8349 */ {20,131},
+/* 8350 */ {20,131},
+/* 8351 */ {20,131},
+/* 8352 */ {20,131},
+/* 8353 */ {20,131},
+/* 8354 */ {20,131},
+/* 8355 */ {20,131},
+/* 8356 */ {20,131},
+/* 8357 */ {20,131},
+/* 8358 */ {20,131},
+/* 8359 */ {20,131},
+/* 8360 */ {20,131},
+/* 8361 */ {20,131},
+/* 8362 */ {20,131},
+/* 8363 */ {20,131},
+/* 8364 */ {20,131},
+/* 8365 */ {20,131},
+/* 8366 */ {20,131},
+/* 8367 */ {20,131},
+/* 8368 */ {20,131},
+/* 8369 */ {20,131},
+/* 8370 */ {20,131},
+/* 8371 */ {20,131},
+/* 8372 */ {20,131},
+/* 8373 */ {20,131},
+/* 8374 */ {20,131},
+/* 8375 */ {20,131},
+/* 8376 */ {20,131},
+/* 8377 */ {20,131},
+/* 8378 */ {20,131},
+/* 8379 */ {20,131},
+/* 8380 */ {20,131},
+/* 8381 */ {20,131},
+/* 8382 */ {20,131},
+/* 8383 */ {20,131},
+/* 8384 */ {20,131},
+/* 8385 */ {20,131},
+/* 8386 */ {20,131},
+/* 8387 */ {20,131},
+/* 8388 */ {20,131},
+/* 8389 */ {20,131},
+/* 8390 */ {20,131},
+/* 8391 */ {20,131},
+/* 8392 */ {20,131},
+/* 8393 */ {20,131},
+/* 8394 */ {20,131},
+/* 8395 */ {20,131},
+/* 8396 */ {20,131},
+/* 8397 */ {20,131},
+/* 8398 */ {20,131},
+/* 8399 */ {20,131},
+/* 8400 */ {20,131},
+/* 8401 */ {20,131},
+/* 8402 */ {20,131},
+/* 8403 */ {20,131},
+/* 8404 */ {20,131},
+/* 8405 */ {20,131},
+/* 8406 */ {20,131},
+/* 8407 */ {20,131},
+/* 8408 */ {20,131},
+/* 8409 */ {20,131},
+/* 8410 */ {20,131},
+/* 8411 */ {20,131},
+/* 8412 */ {20,131},
+/* 8413 */ {20,131},
+/* 8414 */ {20,131},
+/* 8415 */ {20,131},
+/* 8416 */ {20,131},
+/* 8417 */ {20,131},
+/* 8418 */ {20,131},
+/* 8419 */ {20,131},
+/* 8420 */ {20,131},
+/* 8421 */ {20,131},
+/* 8422 */ {20,131},
+/* 8423 */ {20,131},
+/* 8424 */ {20,131},
+/* 8425 */ {20,131},
+/* 8426 */ {20,131},
+/* 8427 */ {20,131},
+/* 8428 */ {20,131},
+/* 8429 */ {20,131},
+/* 8430 */ {20,131},
+/* 8431 */ {20,131},
+/* 8432 */ {20,131},
+/* 8433 */ {20,131},
+/* 8434 */ {20,131},
+/* 8435 */ {20,131},
+/* 8436 */ {20,131},
+/* 8437 */ {20,131},
+/* 8438 */ {20,131},
+/* 8439 */ {20,131},
+/* 8440 */ {20,131},
+/* 8441 */ {20,131},
+/* 8442 */ {20,131},
+/* 8443 */ {20,131},
+/* 8444 */ {20,131},
+/* 8445 */ {20,131},
+/* 8446 */ {20,131},
+/* 8447 */ {20,131},
+/* 8448 */ {20,131},
+/* 8449 */ {20,131},
+/* 8450 */ {20,131},
+/* 8451 */ {20,131},
+/* 8452 */ {20,131},
+/* 8453 */ {20,131},
+/* 8454 */ {20,131},
+/* 8455 */ {20,131},
+/* 8456 */ {20,131},
+/* 8457 */ {20,131},
+/* 8458 */ {20,131},
+/* 8459 */ {20,131},
+/* 8460 */ {20,131},
+/* 8461 */ {20,131},
+/* 8462 */ {20,131},
+/* 8463 */ {20,131},
+/* 8464 */ {20,131},
+/* 8465 */ {20,131},
+/* 8466 */ {20,131},
+/* 8467 */ {20,131},
+/* 8468 */ {20,131},
+/* 8469 */ {20,131},
+/* 8470 */ {20,131},
+/* 8471 */ {20,131},
+/* 8472 */ {20,131},
+/* 8473 */ {20,131},
+/* 8474 */ {20,131},
+/* 8475 */ {20,131},
+/* 8476 */ {20,131},
+/* 8477 */ {20,131},
+/* 8478 */ {20,131},
+/* 8479 */ {20,131},
+/* 8480 */ {20,131},
+/* 8481 */ {20,131},
+/* 8482 */ {20,131},
+/* 8483 */ {20,131},
+/* 8484 */ {20,131},
+/* 8485 */ {20,131},
+/* 8486 */ {20,131},
+/* 8487 */ {20,131},
+/* 8488 */ {20,131},
+/* 8489 */ {20,131},
+/* 8490 */ {20,131},
+/* 8491 */ {20,131},
+/* 8492 */ {20,131},
+/* 8493 */ {20,131},
+/* 8494 */ {20,131},
+/* 8495 */ {20,131},
+/* 8496 */ {20,131},
+/* 8497 */ {20,131},
+/* 8498 */ {20,131},
+/* 8499 */ {20,131},
+/* 8500 */ {20,131},
+/* 8501 */ {20,131},
+/* 8502 */ {20,131},
+/* 8503 */ {20,131},
+/* 8504 */ {20,131},
+/* 8505 */ {20,131},
+/* 8506 */ {20,131},
+/* 8507 */ {20,131},
+/* 8508 */ {20,131},
+/* 8509 */ {20,131},
+/* 8510 */ {20,131},
+/* 8511 */ {20,131},
+/* 8512 */ {20,131},
+/* 8513 */ {20,131},
+/* 8514 */ {20,131},
+/* 8515 */ {20,131},
+/* 8516 */ {20,131},
+/* 8517 */ {20,131},
+/* 8518 */ {20,131},
+/* 8519 */ {20,131},
+/* 8520 */ {20,131},
+/* 8521 */ {20,131},
+/* 8522 */ {20,131},
+/* 8523 */ {20,131},
+/* 8524 */ {20,131},
+/* 8525 */ {20,131},
+/* 8526 */ {20,131},
+/* 8527 */ {20,131},
+/* 8528 */ {20,131},
+/* 8529 */ {20,131},
+/* 8530 */ {20,131},
+/* 8531 */ {20,131},
+/* 8532 */ {20,131},
+/* 8533 */ {20,131},
+/* 8534 */ {20,131},
+/* 8535 */ {20,131},
+/* 8536 */ {20,131},
+/* 8537 */ {20,131},
+/* 8538 */ {20,131},
+/* 8539 */ {20,131},
+/* 8540 */ {20,131},
+/* 8541 */ {20,131},
+/* 8542 */ {20,131},
+/* 8543 */ {20,131},
+/* 8544 */ {20,131},
+/* 8545 */ {20,131},
+/* 8546 */ {20,131},
+/* 8547 */ {20,131},
+/* 8548 */ {20,131},
+/* 8549 */ {20,131},
+/* 8550 */ {20,131},
+/* 8551 */ {20,131},
+/* 8552 */ {20,131},
+/* 8553 */ {20,131},
+/* 8554 */ {20,131},
+/* 8555 */ {20,131},
+/* 8556 */ {20,131},
+/* 8557 */ {20,131},
+/* 8558 */ {20,131},
+/* 8559 */ {20,131},
+/* 8560 */ {20,131},
+/* 8561 */ {20,131},
+/* 8562 */ {20,131},
+/* 8563 */ {20,131},
+/* 8564 */ {20,131},
+/* 8565 */ {20,131},
+/* 8566 */ {20,131},
+/* 8567 */ {20,131},
+/* 8568 */ {20,131},
+/* 8569 */ {20,131},
+/* 8570 */ {20,131},
+/* 8571 */ {20,131},
+/* 8572 */ {20,131},
+/* 8573 */ {20,131},
+/* 8574 */ {20,131},
+/* 8575 */ {20,131},
+/* 8576 */ {20,131},
+/* 8577 */ {20,131},
+/* 8578 */ {20,131},
+/* 8579 */ {20,131},
+/* 8580 */ {20,131},
+/* 8581 */ {20,131},
+/* 8582 */ {20,131},
+/* 8583 */ {20,131},
+/* 8584 */ {20,131},
+/* 8585 */ {20,131},
+/* 8586 */ {20,131},
+/* 8587 */ {20,131},
+/* 8588 */ {20,131},
+/* 8589 */ {20,131},
+/* 8590 */ {20,131},
+/* 8591 */ {20,131},
+/* 8592 */ {20,131},
+/* 8593 */ {20,131},
+/* 8594 */ {20,131},
+/* 8595 */ {20,131},
+/* 8596 */ {20,131},
+/* 8597 */ {20,131},
+/* 8598 */ {20,131},
+/* 8599 */ {20,131},
+/* 8600 */ {20,131},
+/* 8601 */ {20,131},
+/* 8602 */ {20,131},
+/* 8603 */ {20,131},
+/* 8604 */ {20,131},
+/* 8605 */ {20,131},
+/* 8606 */ {20,131},
+/* 8607 */ {20,131},
+/* 8608 */ {20,131},
+/* 8609 */ {20,131},
+/* 8610 */ {20,131},
+/* 8611 */ {20,131},
+/* 8612 */ {20,131},
+/* 8613 */ {20,131},
+/* 8614 */ {20,131},
+/* 8615 */ {20,131},
+/* 8616 */ {20,131},
+/* 8617 */ {20,131},
+/* 8618 */ {20,131},
+/* 8619 */ {20,131},
+/* 8620 */ {20,131},
+/* 8621 */ {20,131},
+/* 8622 */ {20,131},
+/* 8623 */ {20,131},
+/* 8624 */ {20,131},
+/* 8625 */ {20,131},
+/* 8626 */ {20,131},
+/* 8627 */ {20,131},
+/* 8628 */ {20,131},
+/* 8629 */ {20,131},
+/* 8630 */ {20,131},
+/* 8631 */ {20,131},
+/* 8632 */ {20,131},
+/* 8633 */ {20,131},
+/* 8634 */ {20,131},
+/* 8635 */ {20,131},
+/* 8636 */ {20,131},
+/* 8637 */ {20,131},
+/* 8638 */ {20,131},
+/* 8639 */ {20,131},
+/* 8640 */ {20,131},
+/* 8641 */ {20,131},
+/* 8642 */ {20,131},
+/* 8643 */ {20,131},
+/* 8644 */ {20,131},
+/* 8645 */ {20,131},
+/* 8646 */ {20,131},
+/* 8647 */ {20,131},
+/* 8648 */ {20,131},
+/* 8649 */ {20,131},
+/* 8650 */ {20,131},
+/* 8651 */ {20,131},
+/* 8652 */ {20,131},
+/* 8653 */ {20,131},
+/* 8654 */ {20,131},
+/* 8655 */ {20,131},
+/* 8656 */ {20,131},
+/* 8657 */ {20,131},
+/* 8658 */ {20,131},
+/* 8659 */ {20,131},
+/* 8660 */ {20,131},
+/* 8661 */ {20,131},
+/* 8662 */ {20,131},
+/* 8663 */ {20,131},
+/* 8664 */ {20,131},
+/* 8665 */ {20,131},
+/* 8666 */ {20,131},
+/* 8667 */ {20,131},
+/* 8668 */ {20,131},
+/* 8669 */ {20,131},
+/* 8670 */ {20,131},
+/* 8671 */ {20,131},
+/* 8672 */ {20,131},
+/* 8673 */ {20,131},
+/* 8674 */ {20,131},
+/* 8675 */ {20,131},
+/* 8676 */ {20,131},
+/* 8677 */ {20,131},
+/* 8678 */ {20,131},
+/* 8679 */ {20,131},
+/* 8680 */ {20,131},
+/* 8681 */ {20,131},
+/* 8682 */ {20,131},
+/* 8683 */ {20,131},
+/* 8684 */ {20,131},
+/* 8685 */ {20,131},
+/* 8686 */ {20,131},
+/* 8687 */ {20,131},
+/* 8688 */ {20,131},
+/* 8689 */ {20,131},
+/* 8690 */ {20,131},
+/* 8691 */ {20,131},
+/* 8692 */ {20,131},
+/* 8693 */ {20,131},
+/* 8694 */ {20,131},
+/* 8695 */ {20,131},
+/* 8696 */ {20,131},
+/* 8697 */ {20,131},
+/* 8698 */ {20,131},
+/* 8699 */ {20,131},
+/* 8700 */ {20,131},
+/* 8701 */ {20,131},
+/* 8702 */ {20,131},
+/* 8703 */ {20,131},
+/* 8704 */ {20,131},
+/* 8705 */ {20,131},
+/* 8706 */ {20,131},
+/* 8707 */ {20,131},
+/* 8708 */ {20,131},
+/* 8709 */ {20,131},
+/* 8710 */ {20,131},
+/* 8711 */ {20,131},
+/* 8712 */ {20,131},
+/* 8713 */ {20,131},
+/* 8714 */ {20,131},
+/* 8715 */ {20,131},
+/* 8716 */ {20,131},
+/* 8717 */ {20,131},
+/* 8718 */ {20,131},
+/* 8719 */ {20,131},
+/* 8720 */ {20,131},
+/* 8721 */ {20,131},
+/* 8722 */ {20,131},
+/* 8723 */ {20,131},
+/* 8724 */ {20,131},
+/* 8725 */ {20,131},
+/* 8726 */ {20,131},
+/* 8727 */ {20,131},
+/* 8728 */ {20,131},
+/* 8729 */ {20,131},
+/* 8730 */ {20,131},
+/* 8731 */ {20,131},
+/* 8732 */ {20,131},
+/* 8733 */ {20,131},
+/* 8734 */ {20,131},
+/* 8735 */ {20,131},
+/* 8736 */ {20,131},
+/* 8737 */ {20,131},
+/* 8738 */ {20,131},
+/* 8739 */ {20,131},
+/* 8740 */ {20,131},
+/* 8741 */ {20,131},
+/* 8742 */ {20,131},
+/* 8743 */ {20,131},
+/* 8744 */ {20,131},
+/* 8745 */ {20,131},
+/* 8746 */ {20,131},
+/* 8747 */ {20,131},
+/* 8748 */ {20,131},
+/* 8749 */ {20,131},
+/* 8750 */ {20,131},
+/* 8751 */ {20,131},
+/* 8752 */ {20,131},
+/* 8753 */ {20,131},
+/* 8754 */ {20,131},
+/* 8755 */ {20,131},
+/* 8756 */ {20,131},
+/* 8757 */ {20,131},
+/* 8758 */ {20,131},
+/* 8759 */ {20,131},
+/* 8760 */ {20,131},
+/* 8761 */ {20,131},
+/* 8762 */ {20,131},
+/* 8763 */ {20,131},
+/* 8764 */ {20,131},
+/* 8765 */ {20,131},
+/* 8766 */ {20,131},
+/* 8767 */ {20,131},
+/* 8768 */ {20,131},
+/* 8769 */ {20,131},
+/* 8770 */ {20,131},
+/* 8771 */ {20,131},
+/* 8772 */ {20,131},
+/* 8773 */ {20,131},
+/* 8774 */ {20,131},
+/* 8775 */ {20,131},
+/* 8776 */ {20,131},
+/* 8777 */ {20,131},
+/* 8778 */ {20,131},
+/* 8779 */ {20,131},
+/* 8780 */ {20,131},
+/* 8781 */ {20,131},
+/* 8782 */ {20,131},
+/* 8783 */ {20,131},
+/* 8784 */ {20,131},
+/* 8785 */ {20,131},
+/* 8786 */ {20,131},
+/* 8787 */ {20,131},
+/* 8788 */ {20,131},
+/* 8789 */ {20,131},
+/* 8790 */ {20,131},
+/* 8791 */ {20,131},
+/* 8792 */ {20,131},
+/* 8793 */ {20,131},
+/* 8794 */ {20,131},
+/* 8795 */ {20,131},
+/* 8796 */ {20,131},
+/* 8797 */ {20,131},
+/* 8798 */ {20,131},
+/* 8799 */ {20,131},
+/* 8800 */ {20,131},
+/* 8801 */ {20,131},
+/* 8802 */ {20,131},
+/* 8803 */ {20,131},
+/* 8804 */ {20,131},
+/* 8805 */ {20,131},
+/* 8806 */ {20,131},
+/* 8807 */ {20,131},
+/* 8808 */ {20,131},
+/* 8809 */ {20,131},
+/* 8810 */ {20,131},
+/* 8811 */ {20,131},
+/* 8812 */ {20,131},
+/* 8813 */ {20,131},
+/* 8814 */ {20,131},
+/* 8815 */ {20,131},
+/* 8816 */ {20,131},
+/* 8817 */ {20,131},
+/* 8818 */ {20,131},
+/* 8819 */ {20,131},
+/* 8820 */ {20,131},
+/* 8821 */ {20,131},
+/* 8822 */ {20,131},
+/* 8823 */ {20,131},
+/* 8824 */ {20,131},
+/* 8825 */ {20,131},
+/* 8826 */ {20,131},
+/* 8827 */ {20,131},
+/* 8828 */ {20,131},
+/* 8829 */ {20,131},
+/* 8830 */ {20,131},
+/* 8831 */ {20,131},
+/* 8832 */ {20,131},
+/* 8833 */ {20,131},
+/* 8834 */ {20,131},
+/* 8835 */ {20,131},
+/* 8836 */ {20,131},
+/* 8837 */ {20,131},
+/* 8838 */ {20,131},
+/* 8839 */ {20,131},
+/* 8840 */ {20,131},
+/* 8841 */ {20,131},
+/* 8842 */ {20,131},
+/* 8843 */ {20,131},
+/* 8844 */ {20,131},
+/* 8845 */ {20,131},
+/* 8846 */ {20,131},
+/* 8847 */ {20,131},
+/* 8848 */ {20,131},
+/* 8849 */ {20,131},
+/* 8850 */ {20,131},
+/* 8851 */ {20,131},
+/* 8852 */ {20,131},
+/* 8853 */ {20,131},
+/* 8854 */ {20,131},
+/* 8855 */ {20,131},
+/* 8856 */ {20,131},
+/* 8857 */ {20,131},
+/* 8858 */ {20,131},
+/* 8859 */ {20,131},
+/* 8860 */ {20,131},
+/* 8861 */ {20,131},
+/* 8862 */ {20,131},
+/* 8863 */ {20,131},
+/* 8864 */ {20,131},
+/* 8865 */ {20,131},
+/* 8866 */ {20,131},
+/* 8867 */ {20,131},
+/* 8868 */ {20,131},
+/* 8869 */ {20,131},
+/* 8870 */ {20,131},
+/* 8871 */ {20,131},
+/* 8872 */ {20,131},
+/* 8873 */ {20,131},
+/* 8874 */ {20,131},
+/* 8875 */ {20,131},
+/* 8876 */ {20,131},
+/* 8877 */ {20,131},
+/* 8878 */ {20,131},
+/* 8879 */ {20,131},
+/* 8880 */ {20,131},
+/* 8881 */ {20,131},
+/* 8882 */ {20,131},
+/* 8883 */ {20,131},
+/* 8884 */ {20,131},
+/* 8885 */ {20,131},
+/* 8886 */ {20,131},
+/* 8887 */ {20,131},
+/* 8888 */ {20,131},
+/* 8889 */ {20,131},
+/* 8890 */ {20,131},
+/* 8891 */ {20,131},
+/* 8892 */ {20,131},
+/* 8893 */ {20,131},
+/* 8894 */ {20,131},
+/* 8895 */ {20,131},
+/* 8896 */ {20,131},
+/* 8897 */ {20,131},
+/* 8898 */ {20,131},
+/* 8899 */ {20,131},
+/* 8900 */ {20,131},
+/* 8901 */ {20,131},
+/* 8902 */ {20,131},
+/* 8903 */ {20,131},
+/* 8904 */ {20,131},
+/* 8905 */ {20,131},
+/* 8906 */ {20,131},
+/* 8907 */ {20,131},
+/* 8908 */ {20,131},
+/* 8909 */ {20,131},
+/* 8910 */ {20,131},
+/* 8911 */ {20,131},
+/* 8912 */ {20,131},
+/* 8913 */ {20,131},
+/* 8914 */ {20,131},
+/* 8915 */ {20,131},
+/* 8916 */ {20,131},
+/* 8917 */ {20,131},
+/* 8918 */ {20,131},
+/* 8919 */ {20,131},
+/* 8920 */ {20,131},
+/* 8921 */ {20,131},
+/* 8922 */ {20,131},
+/* 8923 */ {20,131},
+/* 8924 */ {20,131},
+/* 8925 */ {20,131},
+/* 8926 */ {20,131},
+/* 8927 */ {20,131},
+/* 8928 */ {20,131},
+/* 8929 */ {20,131},
+/* 8930 */ {20,131},
+/* 8931 */ {20,131},
+/* 8932 */ {20,131},
+/* 8933 */ {20,131},
+/* 8934 */ {20,131},
+/* 8935 */ {20,131},
+/* 8936 */ {20,131},
+/* 8937 */ {20,131},
+/* 8938 */ {20,131},
+/* 8939 */ {20,131},
+/* 8940 */ {20,131},
+/* 8941 */ {20,131},
+/* 8942 */ {20,131},
+/* 8943 */ {20,131},
+/* 8944 */ {20,131},
+/* 8945 */ {20,131},
+/* 8946 */ {20,131},
+/* 8947 */ {20,131},
+/* 8948 */ {20,131},
+/* 8949 */ {20,131},
+/* 8950 */ {20,131},
+/* 8951 */ {20,131},
+/* 8952 */ {20,131},
+/* 8953 */ {20,131},
+/* 8954 */ {20,131},
+/* 8955 */ {20,131},
+/* 8956 */ {20,131},
+/* 8957 */ {20,131},
+/* 8958 */ {20,131},
+/* 8959 */ {20,131},
+/* 8960 */ {20,131},
+/* 8961 */ {20,131},
+/* 8962 */ {20,131},
+/* 8963 */ {20,131},
+/* 8964 */ {20,131},
+/* 8965 */ {20,131},
+/* 8966 */ {20,131},
+/* 8967 */ {20,131},
+/* 8968 */ {20,131},
+/* 8969 */ {20,131},
+/* 8970 */ {20,131},
+/* 8971 */ {20,131},
+/* 8972 */ {20,131},
+/* 8973 */ {20,131},
+/* 8974 */ {20,131},
+/* 8975 */ {20,131},
+/* 8976 */ {20,131},
+/* 8977 */ {20,131},
+/* 8978 */ {20,131},
+/* 8979 */ {20,131},
+/* 8980 */ {20,131},
+/* 8981 */ {20,131},
+/* 8982 */ {20,131},
+/* 8983 */ {20,131},
+/* 8984 */ {20,131},
+/* 8985 */ {20,131},
+/* 8986 */ {20,131},
+/* 8987 */ {20,131},
+/* 8988 */ {20,131},
+/* 8989 */ {20,131},
+/* 8990 */ {20,131},
+/* 8991 */ {20,131},
+/* 8992 */ {20,131},
+/* 8993 */ {20,131},
+/* 8994 */ {20,131},
+/* 8995 */ {20,131},
+/* 8996 */ {20,131},
+/* 8997 */ {20,131},
+/* 8998 */ {20,131},
+/* 8999 */ {20,131},
+/* 9000 */ {20,131},
+/* 9001 */ {20,131},
+/* 9002 */ {20,131},
+/* 9003 */ {20,131},
+/* 9004 */ {20,131},
+/* 9005 */ {20,131},
+/* 9006 */ {20,131},
+/* 9007 */ {20,131},
+/* 9008 */ {20,131},
+/* 9009 */ {20,131},
+/* 9010 */ {20,131},
+/* 9011 */ {20,131},
+/* 9012 */ {20,131},
+/* 9013 */ {20,131},
+/* 9014 */ {20,131},
+/* 9015 */ {20,131},
+/* 9016 */ {20,131},
+/* 9017 */ {20,131},
+/* 9018 */ {20,131},
+/* 9019 */ {20,131},
+/* 9020 */ {20,131},
+/* 9021 */ {20,131},
+/* 9022 */ {20,131},
+/* 9023 */ {20,131},
+/* 9024 */ {20,131},
+/* 9025 */ {20,131},
+/* 9026 */ {20,131},
+/* 9027 */ {20,131},
+/* 9028 */ {20,131},
+/* 9029 */ {20,131},
+/* 9030 */ {20,131},
+/* 9031 */ {20,131},
+/* 9032 */ {20,131},
+/* 9033 */ {20,131},
+/* 9034 */ {20,131},
+/* 9035 */ {20,131},
+/* 9036 */ {20,131},
+/* 9037 */ {20,131},
+/* 9038 */ {20,131},
+/* 9039 */ {20,131},
+/* 9040 */ {20,131},
+/* 9041 */ {20,131},
+/* 9042 */ {20,131},
+/* 9043 */ {20,131},
+/* 9044 */ {20,131},
+/* 9045 */ {20,131},
+/* 9046 */ {20,131},
+/* 9047 */ {20,131},
+/* 9048 */ {20,131},
+/* 9049 */ {20,131},
+/* 9050 */ {20,131},
+/* 9051 */ {20,131},
+/* 9052 */ {20,131},
+/* 9053 */ {20,131},
+/* 9054 */ {20,131},
+/* 9055 */ {20,131},
+/* 9056 */ {20,131},
+/* 9057 */ {20,131},
+/* 9058 */ {20,131},
+/* 9059 */ {20,131},
+/* 9060 */ {20,131},
+/* 9061 */ {20,131},
+/* 9062 */ {20,131},
+/* 9063 */ {20,131},
+/* 9064 */ {20,131},
+/* 9065 */ {20,131},
+/* 9066 */ {20,131},
+/* 9067 */ {20,131},
+/* 9068 */ {20,131},
+/* 9069 */ {20,131},
+/* 9070 */ {20,131},
+/* 9071 */ {20,131},
+/* 9072 */ {20,131},
+/* 9073 */ {20,131},
+/* 9074 */ {20,131},
+/* 9075 */ {20,131},
+/* 9076 */ {20,131},
+/* 9077 */ {20,131},
+/* 9078 */ {20,131},
+/* 9079 */ {20,131},
+/* 9080 */ {20,131},
+/* 9081 */ {20,131},
+/* 9082 */ {20,131},
+/* 9083 */ {20,131},
+/* 9084 */ {20,131},
+/* 9085 */ {20,131},
+/* 9086 */ {20,131},
+/* 9087 */ {20,131},
+/* 9088 */ {20,131},
+/* 9089 */ {20,131},
+/* 9090 */ {20,131},
+/* 9091 */ {20,131},
+/* 9092 */ {20,131},
+/* 9093 */ {20,131},
+/* 9094 */ {20,131},
+/* 9095 */ {20,131},
+/* 9096 */ {20,131},
+/* 9097 */ {20,131},
+/* 9098 */ {20,131},
+/* 9099 */ {20,131},
+/* 9100 */ {20,131},
+/* 9101 */ {20,131},
+/* 9102 */ {20,131},
+/* 9103 */ {20,131},
+/* 9104 */ {20,131},
+/* 9105 */ {20,131},
+/* 9106 */ {20,131},
+/* 9107 */ {20,131},
+/* 9108 */ {20,131},
+/* 9109 */ {20,131},
+/* 9110 */ {20,131},
+/* 9111 */ {20,131},
+/* 9112 */ {20,131},
+/* 9113 */ {20,131},
+/* 9114 */ {20,131},
+/* 9115 */ {20,131},
+/* 9116 */ {20,131},
+/* 9117 */ {20,131},
+/* 9118 */ {20,131},
+/* 9119 */ {20,131},
+/* 9120 */ {20,131},
+/* 9121 */ {20,131},
+/* 9122 */ {20,131},
+/* 9123 */ {20,131},
+/* 9124 */ {20,131},
+/* 9125 */ {20,131},
+/* 9126 */ {20,131},
+/* 9127 */ {20,131},
+/* 9128 */ {20,131},
+/* 9129 */ {20,131},
+/* 9130 */ {20,131},
+/* 9131 */ {20,131},
+/* 9132 */ {20,131},
+/* 9133 */ {20,131},
+/* 9134 */ {20,131},
+/* 9135 */ {20,131},
+/* 9136 */ {20,131},
+/* 9137 */ {20,131},
+/* 9138 */ {20,131},
+/* 9139 */ {20,131},
+/* 9140 */ {20,131},
+/* 9141 */ {20,131},
+/* 9142 */ {20,131},
+/* 9143 */ {20,131},
+/* 9144 */ {20,131},
+/* 9145 */ {20,131},
+/* 9146 */ {20,131},
+/* 9147 */ {20,131},
+/* 9148 */ {20,131},
+/* 9149 */ {20,131},
+/* 9150 */ {20,131},
+/* 9151 */ {20,131},
+/* 9152 */ {20,131},
+/* 9153 */ {20,131},
+/* 9154 */ {20,131},
+/* 9155 */ {20,131},
+/* 9156 */ {20,131},
+/* 9157 */ {20,131},
+/* 9158 */ {20,131},
+/* 9159 */ {20,131},
+/* 9160 */ {20,131},
+/* 9161 */ {20,131},
+/* 9162 */ {20,131},
+/* 9163 */ {20,131},
+/* 9164 */ {20,131},
+/* 9165 */ {20,131},
+/* 9166 */ {20,131},
+/* 9167 */ {20,131},
+/* 9168 */ {20,131},
+/* 9169 */ {20,131},
+/* 9170 */ {20,131},
+/* 9171 */ {20,131},
+/* 9172 */ {20,131},
+/* 9173 */ {20,131},
+/* 9174 */ {20,131},
+/* 9175 */ {20,131},
+/* 9176 */ {20,131},
+/* 9177 */ {20,131},
+/* 9178 */ {20,131},
+/* 9179 */ {20,131},
+/* 9180 */ {20,131},
+/* 9181 */ {20,131},
+/* 9182 */ {20,131},
+/* 9183 */ {20,131},
+/* 9184 */ {20,131},
+/* 9185 */ {20,131},
+/* 9186 */ {20,131},
+/* 9187 */ {20,131},
+/* 9188 */ {20,131},
+/* 9189 */ {20,131},
+/* 9190 */ {20,131},
+/* 9191 */ {20,131},
+/* 9192 */ {20,131},
+/* 9193 */ {20,131},
+/* 9194 */ {20,131},
+/* 9195 */ {20,131},
+/* 9196 */ {20,131},
+/* 9197 */ {20,131},
+/* 9198 */ {20,131},
+/* 9199 */ {20,131},
+/* 9200 */ {20,131},
+/* 9201 */ {20,131},
+/* 9202 */ {20,131},
+/* 9203 */ {20,131},
+/* 9204 */ {20,131},
+/* 9205 */ {20,131},
+/* 9206 */ {20,131},
+/* 9207 */ {20,131},
+/* 9208 */ {20,131},
+/* 9209 */ {20,131},
+/* 9210 */ {20,131},
+/* 9211 */ {20,131},
+/* 9212 */ {20,131},
+/* 9213 */ {20,131},
+/* 9214 */ {20,131},
+/* 9215 */ {20,131},
+/* 9216 */ {20,162},
+/* 9217 */ {20,162},
+/* 9218 */ {20,162},
+/* 9219 */ {20,162},
+/* 9220 */ {20,162},
+/* 9221 */ {20,162},
+/* 9222 */ {20,162},
+/* 9223 */ {20,162},
+/* 9224 */ {20,162},
+/* 9225 */ {20,162},
+/* 9226 */ {20,162},
+/* 9227 */ {20,162},
+/* 9228 */ {20,162},
+/* 9229 */ {20,162},
+/* 9230 */ {20,162},
+/* 9231 */ {20,162},
+/* 9232 */ {20,162},
+/* 9233 */ {20,162},
+/* 9234 */ {20,162},
+/* 9235 */ {20,162},
+/* 9236 */ {20,162},
+/* 9237 */ {20,162},
+/* 9238 */ {20,162},
+/* 9239 */ {20,162},
+/* 9240 */ {20,162},
+/* 9241 */ {20,162},
+/* 9242 */ {20,162},
+/* 9243 */ {20,162},
+/* 9244 */ {20,162},
+/* 9245 */ {20,162},
+/* 9246 */ {20,162},
+/* 9247 */ {20,162},
+/* 9248 */ {20,162},
+/* 9249 */ {20,162},
+/* 9250 */ {20,162},
+/* 9251 */ {20,162},
+/* 9252 */ {20,162},
+/* 9253 */ {20,162},
+/* 9254 */ {20,162},
+/* 9255 */ {20,162},
+/* 9256 */ {20,162},
+/* 9257 */ {20,162},
+/* 9258 */ {20,162},
+/* 9259 */ {20,162},
+/* 9260 */ {20,162},
+/* 9261 */ {20,162},
+/* 9262 */ {20,162},
+/* 9263 */ {20,162},
+/* 9264 */ {20,162},
+/* 9265 */ {20,162},
+/* 9266 */ {20,162},
+/* 9267 */ {20,162},
+/* 9268 */ {20,162},
+/* 9269 */ {20,162},
+/* 9270 */ {20,162},
+/* 9271 */ {20,162},
+/* 9272 */ {20,162},
+/* 9273 */ {20,162},
+/* 9274 */ {20,162},
+/* 9275 */ {20,162},
+/* 9276 */ {20,162},
+/* 9277 */ {20,162},
+/* 9278 */ {20,162},
+/* 9279 */ {20,162},
+/* 9280 */ {20,162},
+/* 9281 */ {20,162},
+/* 9282 */ {20,162},
+/* 9283 */ {20,162},
+/* 9284 */ {20,162},
+/* 9285 */ {20,162},
+/* 9286 */ {20,162},
+/* 9287 */ {20,162},
+/* 9288 */ {20,162},
+/* 9289 */ {20,162},
+/* 9290 */ {20,162},
+/* 9291 */ {20,162},
+/* 9292 */ {20,162},
+/* 9293 */ {20,162},
+/* 9294 */ {20,162},
+/* 9295 */ {20,162},
+/* 9296 */ {20,162},
+/* 9297 */ {20,162},
+/* 9298 */ {20,162},
+/* 9299 */ {20,162},
+/* 9300 */ {20,162},
+/* 9301 */ {20,162},
+/* 9302 */ {20,162},
+/* 9303 */ {20,162},
+/* 9304 */ {20,162},
+/* 9305 */ {20,162},
+/* 9306 */ {20,162},
+/* 9307 */ {20,162},
+/* 9308 */ {20,162},
+/* 9309 */ {20,162},
+/* 9310 */ {20,162},
+/* 9311 */ {20,162},
+/* 9312 */ {20,162},
+/* 9313 */ {20,162},
+/* 9314 */ {20,162},
+/* 9315 */ {20,162},
+/* 9316 */ {20,162},
+/* 9317 */ {20,162},
+/* 9318 */ {20,162},
+/* 9319 */ {20,162},
+/* 9320 */ {20,162},
+/* 9321 */ {20,162},
+/* 9322 */ {20,162},
+/* 9323 */ {20,162},
+/* 9324 */ {20,162},
+/* 9325 */ {20,162},
+/* 9326 */ {20,162},
+/* 9327 */ {20,162},
+/* 9328 */ {20,162},
+/* 9329 */ {20,162},
+/* 9330 */ {20,162},
+/* 9331 */ {20,162},
+/* 9332 */ {20,162},
+/* 9333 */ {20,162},
+/* 9334 */ {20,162},
+/* 9335 */ {20,162},
+/* 9336 */ {20,162},
+/* 9337 */ {20,162},
+/* 9338 */ {20,162},
+/* 9339 */ {20,162},
+/* 9340 */ {20,162},
+/* 9341 */ {20,162},
+/* 9342 */ {20,162},
+/* 9343 */ {20,162},
+/* 9344 */ {20,162},
+/* 9345 */ {20,162},
+/* 9346 */ {20,162},
+/* 9347 */ {20,162},
+/* 9348 */ {20,162},
+/* 9349 */ {20,162},
+/* 9350 */ {20,162},
+/* 9351 */ {20,162},
+/* 9352 */ {20,162},
+/* 9353 */ {20,162},
+/* 9354 */ {20,162},
+/* 9355 */ {20,162},
+/* 9356 */ {20,162},
+/* 9357 */ {20,162},
+/* 9358 */ {20,162},
+/* 9359 */ {20,162},
+/* 9360 */ {20,162},
+/* 9361 */ {20,162},
+/* 9362 */ {20,162},
+/* 9363 */ {20,162},
+/* 9364 */ {20,162},
+/* 9365 */ {20,162},
+/* 9366 */ {20,162},
+/* 9367 */ {20,162},
+/* 9368 */ {20,162},
+/* 9369 */ {20,162},
+/* 9370 */ {20,162},
+/* 9371 */ {20,162},
+/* 9372 */ {20,162},
+/* 9373 */ {20,162},
+/* 9374 */ {20,162},
+/* 9375 */ {20,162},
+/* 9376 */ {20,162},
+/* 9377 */ {20,162},
+/* 9378 */ {20,162},
+/* 9379 */ {20,162},
+/* 9380 */ {20,162},
+/* 9381 */ {20,162},
+/* 9382 */ {20,162},
+/* 9383 */ {20,162},
+/* 9384 */ {20,162},
+/* 9385 */ {20,162},
+/* 9386 */ {20,162},
+/* 9387 */ {20,162},
+/* 9388 */ {20,162},
+/* 9389 */ {20,162},
+/* 9390 */ {20,162},
+/* 9391 */ {20,162},
+/* 9392 */ {20,162},
+/* 9393 */ {20,162},
+/* 9394 */ {20,162},
+/* 9395 */ {20,162},
+/* 9396 */ {20,162},
+/* 9397 */ {20,162},
+/* 9398 */ {20,162},
+/* 9399 */ {20,162},
+/* 9400 */ {20,162},
+/* 9401 */ {20,162},
+/* 9402 */ {20,162},
+/* 9403 */ {20,162},
+/* 9404 */ {20,162},
+/* 9405 */ {20,162},
+/* 9406 */ {20,162},
+/* 9407 */ {20,162},
+/* 9408 */ {20,162},
+/* 9409 */ {20,162},
+/* 9410 */ {20,162},
+/* 9411 */ {20,162},
+/* 9412 */ {20,162},
+/* 9413 */ {20,162},
+/* 9414 */ {20,162},
+/* 9415 */ {20,162},
+/* 9416 */ {20,162},
+/* 9417 */ {20,162},
+/* 9418 */ {20,162},
+/* 9419 */ {20,162},
+/* 9420 */ {20,162},
+/* 9421 */ {20,162},
+/* 9422 */ {20,162},
+/* 9423 */ {20,162},
+/* 9424 */ {20,162},
+/* 9425 */ {20,162},
+/* 9426 */ {20,162},
+/* 9427 */ {20,162},
+/* 9428 */ {20,162},
+/* 9429 */ {20,162},
+/* 9430 */ {20,162},
+/* 9431 */ {20,162},
+/* 9432 */ {20,162},
+/* 9433 */ {20,162},
+/* 9434 */ {20,162},
+/* 9435 */ {20,162},
+/* 9436 */ {20,162},
+/* 9437 */ {20,162},
+/* 9438 */ {20,162},
+/* 9439 */ {20,162},
+/* 9440 */ {20,162},
+/* 9441 */ {20,162},
+/* 9442 */ {20,162},
+/* 9443 */ {20,162},
+/* 9444 */ {20,162},
+/* 9445 */ {20,162},
+/* 9446 */ {20,162},
+/* 9447 */ {20,162},
+/* 9448 */ {20,162},
+/* 9449 */ {20,162},
+/* 9450 */ {20,162},
+/* 9451 */ {20,162},
+/* 9452 */ {20,162},
+/* 9453 */ {20,162},
+/* 9454 */ {20,162},
+/* 9455 */ {20,162},
+/* 9456 */ {20,162},
+/* 9457 */ {20,162},
+/* 9458 */ {20,162},
+/* 9459 */ {20,162},
+/* 9460 */ {20,162},
+/* 9461 */ {20,162},
+/* 9462 */ {20,162},
+/* 9463 */ {20,162},
+/* 9464 */ {20,162},
+/* 9465 */ {20,162},
+/* 9466 */ {20,162},
+/* 9467 */ {20,162},
+/* 9468 */ {20,162},
+/* 9469 */ {20,162},
+/* 9470 */ {20,162},
+/* 9471 */ {20,162},
+/* 9472 */ {20,162},
+/* 9473 */ {20,162},
+/* 9474 */ {20,162},
+/* 9475 */ {20,162},
+/* 9476 */ {20,162},
+/* 9477 */ {20,162},
+/* 9478 */ {20,162},
+/* 9479 */ {20,162},
+/* 9480 */ {20,162},
+/* 9481 */ {20,162},
+/* 9482 */ {20,162},
+/* 9483 */ {20,162},
+/* 9484 */ {20,162},
+/* 9485 */ {20,162},
+/* 9486 */ {20,162},
+/* 9487 */ {20,162},
+/* 9488 */ {20,162},
+/* 9489 */ {20,162},
+/* 9490 */ {20,162},
+/* 9491 */ {20,162},
+/* 9492 */ {20,162},
+/* 9493 */ {20,162},
+/* 9494 */ {20,162},
+/* 9495 */ {20,162},
+/* 9496 */ {20,162},
+/* 9497 */ {20,162},
+/* 9498 */ {20,162},
+/* 9499 */ {20,162},
+/* 9500 */ {20,162},
+/* 9501 */ {20,162},
+/* 9502 */ {20,162},
+/* 9503 */ {20,162},
+/* 9504 */ {20,162},
+/* 9505 */ {20,162},
+/* 9506 */ {20,162},
+/* 9507 */ {20,162},
+/* 9508 */ {20,162},
+/* 9509 */ {20,162},
+/* 9510 */ {20,162},
+/* 9511 */ {20,162},
+/* 9512 */ {20,162},
+/* 9513 */ {20,162},
+/* 9514 */ {20,162},
+/* 9515 */ {20,162},
+/* 9516 */ {20,162},
+/* 9517 */ {20,162},
+/* 9518 */ {20,162},
+/* 9519 */ {20,162},
+/* 9520 */ {20,162},
+/* 9521 */ {20,162},
+/* 9522 */ {20,162},
+/* 9523 */ {20,162},
+/* 9524 */ {20,162},
+/* 9525 */ {20,162},
+/* 9526 */ {20,162},
+/* 9527 */ {20,162},
+/* 9528 */ {20,162},
+/* 9529 */ {20,162},
+/* 9530 */ {20,162},
+/* 9531 */ {20,162},
+/* 9532 */ {20,162},
+/* 9533 */ {20,162},
+/* 9534 */ {20,162},
+/* 9535 */ {20,162},
+/* 9536 */ {20,162},
+/* 9537 */ {20,162},
+/* 9538 */ {20,162},
+/* 9539 */ {20,162},
+/* 9540 */ {20,162},
+/* 9541 */ {20,162},
+/* 9542 */ {20,162},
+/* 9543 */ {20,162},
+/* 9544 */ {20,162},
+/* 9545 */ {20,162},
+/* 9546 */ {20,162},
+/* 9547 */ {20,162},
+/* 9548 */ {20,162},
+/* 9549 */ {20,162},
+/* 9550 */ {20,162},
+/* 9551 */ {20,162},
+/* 9552 */ {20,162},
+/* 9553 */ {20,162},
+/* 9554 */ {20,162},
+/* 9555 */ {20,162},
+/* 9556 */ {20,162},
+/* 9557 */ {20,162},
+/* 9558 */ {20,162},
+/* 9559 */ {20,162},
+/* 9560 */ {20,162},
+/* 9561 */ {20,162},
+/* 9562 */ {20,162},
+/* 9563 */ {20,162},
+/* 9564 */ {20,162},
+/* 9565 */ {20,162},
+/* 9566 */ {20,162},
+/* 9567 */ {20,162},
+/* 9568 */ {20,162},
+/* 9569 */ {20,162},
+/* 9570 */ {20,162},
+/* 9571 */ {20,162},
+/* 9572 */ {20,162},
+/* 9573 */ {20,162},
+/* 9574 */ {20,162},
+/* 9575 */ {20,162},
+/* 9576 */ {20,162},
+/* 9577 */ {20,162},
+/* 9578 */ {20,162},
+/* 9579 */ {20,162},
+/* 9580 */ {20,162},
+/* 9581 */ {20,162},
+/* 9582 */ {20,162},
+/* 9583 */ {20,162},
+/* 9584 */ {20,162},
+/* 9585 */ {20,162},
+/* 9586 */ {20,162},
+/* 9587 */ {20,162},
+/* 9588 */ {20,162},
+/* 9589 */ {20,162},
+/* 9590 */ {20,162},
+/* 9591 */ {20,162},
+/* 9592 */ {20,162},
+/* 9593 */ {20,162},
+/* 9594 */ {20,162},
+/* 9595 */ {20,162},
+/* 9596 */ {20,162},
+/* 9597 */ {20,162},
+/* 9598 */ {20,162},
+/* 9599 */ {20,162},
+/* 9600 */ {20,162},
+/* 9601 */ {20,162},
+/* 9602 */ {20,162},
+/* 9603 */ {20,162},
+/* 9604 */ {20,162},
+/* 9605 */ {20,162},
+/* 9606 */ {20,162},
+/* 9607 */ {20,162},
+/* 9608 */ {20,162},
+/* 9609 */ {20,162},
+/* 9610 */ {20,162},
+/* 9611 */ {20,162},
+/* 9612 */ {20,162},
+/* 9613 */ {20,162},
+/* 9614 */ {20,162},
+/* 9615 */ {20,162},
+/* 9616 */ {20,162},
+/* 9617 */ {20,162},
+/* 9618 */ {20,162},
+/* 9619 */ {20,162},
+/* 9620 */ {20,162},
+/* 9621 */ {20,162},
+/* 9622 */ {20,162},
+/* 9623 */ {20,162},
+/* 9624 */ {20,162},
+/* 9625 */ {20,162},
+/* 9626 */ {20,162},
+/* 9627 */ {20,162},
+/* 9628 */ {20,162},
+/* 9629 */ {20,162},
+/* 9630 */ {20,162},
+/* 9631 */ {20,162},
+/* 9632 */ {20,162},
+/* 9633 */ {20,162},
+/* 9634 */ {20,162},
+/* 9635 */ {20,162},
+/* 9636 */ {20,162},
+/* 9637 */ {20,162},
+/* 9638 */ {20,162},
+/* 9639 */ {20,162},
+/* 9640 */ {20,162},
+/* 9641 */ {20,162},
+/* 9642 */ {20,162},
+/* 9643 */ {20,162},
+/* 9644 */ {20,162},
+/* 9645 */ {20,162},
+/* 9646 */ {20,162},
+/* 9647 */ {20,162},
+/* 9648 */ {20,162},
+/* 9649 */ {20,162},
+/* 9650 */ {20,162},
+/* 9651 */ {20,162},
+/* 9652 */ {20,162},
+/* 9653 */ {20,162},
+/* 9654 */ {20,162},
+/* 9655 */ {20,162},
+/* 9656 */ {20,162},
+/* 9657 */ {20,162},
+/* 9658 */ {20,162},
+/* 9659 */ {20,162},
+/* 9660 */ {20,162},
+/* 9661 */ {20,162},
+/* 9662 */ {20,162},
+/* 9663 */ {20,162},
+/* 9664 */ {20,162},
+/* 9665 */ {20,162},
+/* 9666 */ {20,162},
+/* 9667 */ {20,162},
+/* 9668 */ {20,162},
+/* 9669 */ {20,162},
+/* 9670 */ {20,162},
+/* 9671 */ {20,162},
+/* 9672 */ {20,162},
+/* 9673 */ {20,162},
+/* 9674 */ {20,162},
+/* 9675 */ {20,162},
+/* 9676 */ {20,162},
+/* 9677 */ {20,162},
+/* 9678 */ {20,162},
+/* 9679 */ {20,162},
+/* 9680 */ {20,162},
+/* 9681 */ {20,162},
+/* 9682 */ {20,162},
+/* 9683 */ {20,162},
+/* 9684 */ {20,162},
+/* 9685 */ {20,162},
+/* 9686 */ {20,162},
+/* 9687 */ {20,162},
+/* 9688 */ {20,162},
+/* 9689 */ {20,162},
+/* 9690 */ {20,162},
+/* 9691 */ {20,162},
+/* 9692 */ {20,162},
+/* 9693 */ {20,162},
+/* 9694 */ {20,162},
+/* 9695 */ {20,162},
+/* 9696 */ {20,162},
+/* 9697 */ {20,162},
+/* 9698 */ {20,162},
+/* 9699 */ {20,162},
+/* 9700 */ {20,162},
+/* 9701 */ {20,162},
+/* 9702 */ {20,162},
+/* 9703 */ {20,162},
+/* 9704 */ {20,162},
+/* 9705 */ {20,162},
+/* 9706 */ {20,162},
+/* 9707 */ {20,162},
+/* 9708 */ {20,162},
+/* 9709 */ {20,162},
+/* 9710 */ {20,162},
+/* 9711 */ {20,162},
+/* 9712 */ {20,162},
+/* 9713 */ {20,162},
+/* 9714 */ {20,162},
+/* 9715 */ {20,162},
+/* 9716 */ {20,162},
+/* 9717 */ {20,162},
+/* 9718 */ {20,162},
+/* 9719 */ {20,162},
+/* 9720 */ {20,162},
+/* 9721 */ {20,162},
+/* 9722 */ {20,162},
+/* 9723 */ {20,162},
+/* 9724 */ {20,162},
+/* 9725 */ {20,162},
+/* 9726 */ {20,162},
+/* 9727 */ {20,162},
+/* 9728 */ {20,162},
+/* 9729 */ {20,162},
+/* 9730 */ {20,162},
+/* 9731 */ {20,162},
+/* 9732 */ {20,162},
+/* 9733 */ {20,162},
+/* 9734 */ {20,162},
+/* 9735 */ {20,162},
+/* 9736 */ {20,162},
+/* 9737 */ {20,162},
+/* 9738 */ {20,162},
+/* 9739 */ {20,162},
+/* 9740 */ {20,162},
+/* 9741 */ {20,162},
+/* 9742 */ {20,162},
+/* 9743 */ {20,162},
+/* 9744 */ {20,162},
+/* 9745 */ {20,162},
+/* 9746 */ {20,162},
+/* 9747 */ {20,162},
+/* 9748 */ {20,162},
+/* 9749 */ {20,162},
+/* 9750 */ {20,162},
+/* 9751 */ {20,162},
+/* 9752 */ {20,162},
+/* 9753 */ {20,162},
+/* 9754 */ {20,162},
+/* 9755 */ {20,162},
+/* 9756 */ {20,162},
+/* 9757 */ {20,162},
+/* 9758 */ {20,162},
+/* 9759 */ {20,162},
+/* 9760 */ {20,162},
+/* 9761 */ {20,162},
+/* 9762 */ {20,162},
+/* 9763 */ {20,162},
+/* 9764 */ {20,162},
+/* 9765 */ {20,162},
+/* 9766 */ {20,162},
+/* 9767 */ {20,162},
+/* 9768 */ {20,162},
+/* 9769 */ {20,162},
+/* 9770 */ {20,162},
+/* 9771 */ {20,162},
+/* 9772 */ {20,162},
+/* 9773 */ {20,162},
+/* 9774 */ {20,162},
+/* 9775 */ {20,162},
+/* 9776 */ {20,162},
+/* 9777 */ {20,162},
+/* 9778 */ {20,162},
+/* 9779 */ {20,162},
+/* 9780 */ {20,162},
+/* 9781 */ {20,162},
+/* 9782 */ {20,162},
+/* 9783 */ {20,162},
+/* 9784 */ {20,162},
+/* 9785 */ {20,162},
+/* 9786 */ {20,162},
+/* 9787 */ {20,162},
+/* 9788 */ {20,162},
+/* 9789 */ {20,162},
+/* 9790 */ {20,162},
+/* 9791 */ {20,162},
+/* 9792 */ {20,162},
+/* 9793 */ {20,162},
+/* 9794 */ {20,162},
+/* 9795 */ {20,162},
+/* 9796 */ {20,162},
+/* 9797 */ {20,162},
+/* 9798 */ {20,162},
+/* 9799 */ {20,162},
+/* 9800 */ {20,162},
+/* 9801 */ {20,162},
+/* 9802 */ {20,162},
+/* 9803 */ {20,162},
+/* 9804 */ {20,162},
+/* 9805 */ {20,162},
+/* 9806 */ {20,162},
+/* 9807 */ {20,162},
+/* 9808 */ {20,162},
+/* 9809 */ {20,162},
+/* 9810 */ {20,162},
+/* 9811 */ {20,162},
+/* 9812 */ {20,162},
+/* 9813 */ {20,162},
+/* 9814 */ {20,162},
+/* 9815 */ {20,162},
+/* 9816 */ {20,162},
+/* 9817 */ {20,162},
+/* 9818 */ {20,162},
+/* 9819 */ {20,162},
+/* 9820 */ {20,162},
+/* 9821 */ {20,162},
+/* 9822 */ {20,162},
+/* 9823 */ {20,162},
+/* 9824 */ {20,162},
+/* 9825 */ {20,162},
+/* 9826 */ {20,162},
+/* 9827 */ {20,162},
+/* 9828 */ {20,162},
+/* 9829 */ {20,162},
+/* 9830 */ {20,162},
+/* 9831 */ {20,162},
+/* 9832 */ {20,162},
+/* 9833 */ {20,162},
+/* 9834 */ {20,162},
+/* 9835 */ {20,162},
+/* 9836 */ {20,162},
+/* 9837 */ {20,162},
+/* 9838 */ {20,162},
+/* 9839 */ {20,162},
+/* 9840 */ {20,162},
+/* 9841 */ {20,162},
+/* 9842 */ {20,162},
+/* 9843 */ {20,162},
+/* 9844 */ {20,162},
+/* 9845 */ {20,162},
+/* 9846 */ {20,162},
+/* 9847 */ {20,162},
+/* 9848 */ {20,162},
+/* 9849 */ {20,162},
+/* 9850 */ {20,162},
+/* 9851 */ {20,162},
+/* 9852 */ {20,162},
+/* 9853 */ {20,162},
+/* 9854 */ {20,162},
+/* 9855 */ {20,162},
+/* 9856 */ {20,162},
+/* 9857 */ {20,162},
+/* 9858 */ {20,162},
+/* 9859 */ {20,162},
+/* 9860 */ {20,162},
+/* 9861 */ {20,162},
+/* 9862 */ {20,162},
+/* 9863 */ {20,162},
+/* 9864 */ {20,162},
+/* 9865 */ {20,162},
+/* 9866 */ {20,162},
+/* 9867 */ {20,162},
+/* 9868 */ {20,162},
+/* 9869 */ {20,162},
+/* 9870 */ {20,162},
+/* 9871 */ {20,162},
+/* 9872 */ {20,162},
+/* 9873 */ {20,162},
+/* 9874 */ {20,162},
+/* 9875 */ {20,162},
+/* 9876 */ {20,162},
+/* 9877 */ {20,162},
+/* 9878 */ {20,162},
+/* 9879 */ {20,162},
+/* 9880 */ {20,162},
+/* 9881 */ {20,162},
+/* 9882 */ {20,162},
+/* 9883 */ {20,162},
+/* 9884 */ {20,162},
+/* 9885 */ {20,162},
+/* 9886 */ {20,162},
+/* 9887 */ {20,162},
+/* 9888 */ {20,162},
+/* 9889 */ {20,162},
+/* 9890 */ {20,162},
+/* 9891 */ {20,162},
+/* 9892 */ {20,162},
+/* 9893 */ {20,162},
+/* 9894 */ {20,162},
+/* 9895 */ {20,162},
+/* 9896 */ {20,162},
+/* 9897 */ {20,162},
+/* 9898 */ {20,162},
+/* 9899 */ {20,162},
+/* 9900 */ {20,162},
+/* 9901 */ {20,162},
+/* 9902 */ {20,162},
+/* 9903 */ {20,162},
+/* 9904 */ {20,162},
+/* 9905 */ {20,162},
+/* 9906 */ {20,162},
+/* 9907 */ {20,162},
+/* 9908 */ {20,162},
+/* 9909 */ {20,162},
+/* 9910 */ {20,162},
+/* 9911 */ {20,162},
+/* 9912 */ {20,162},
+/* 9913 */ {20,162},
+/* 9914 */ {20,162},
+/* 9915 */ {20,162},
+/* 9916 */ {20,162},
+/* 9917 */ {20,162},
+/* 9918 */ {20,162},
+/* 9919 */ {20,162},
+/* 9920 */ {20,162},
+/* 9921 */ {20,162},
+/* 9922 */ {20,162},
+/* 9923 */ {20,162},
+/* 9924 */ {20,162},
+/* 9925 */ {20,162},
+/* 9926 */ {20,162},
+/* 9927 */ {20,162},
+/* 9928 */ {20,162},
+/* 9929 */ {20,162},
+/* 9930 */ {20,162},
+/* 9931 */ {20,162},
+/* 9932 */ {20,162},
+/* 9933 */ {20,162},
+/* 9934 */ {20,162},
+/* 9935 */ {20,162},
+/* 9936 */ {20,162},
+/* 9937 */ {20,162},
+/* 9938 */ {20,162},
+/* 9939 */ {20,162},
+/* 9940 */ {20,162},
+/* 9941 */ {20,162},
+/* 9942 */ {20,162},
+/* 9943 */ {20,162},
+/* 9944 */ {20,162},
+/* 9945 */ {20,162},
+/* 9946 */ {20,162},
+/* 9947 */ {20,162},
+/* 9948 */ {20,162},
+/* 9949 */ {20,162},
+/* 9950 */ {20,162},
+/* 9951 */ {20,162},
+/* 9952 */ {20,162},
+/* 9953 */ {20,162},
+/* 9954 */ {20,162},
+/* 9955 */ {20,162},
+/* 9956 */ {20,162},
+/* 9957 */ {20,162},
+/* 9958 */ {20,162},
+/* 9959 */ {20,162},
+/* 9960 */ {20,162},
+/* 9961 */ {20,162},
+/* 9962 */ {20,162},
+/* 9963 */ {20,162},
+/* 9964 */ {20,162},
+/* 9965 */ {20,162},
+/* 9966 */ {20,162},
+/* 9967 */ {20,162},
+/* 9968 */ {20,162},
+/* 9969 */ {20,162},
+/* 9970 */ {20,162},
+/* 9971 */ {20,162},
+/* 9972 */ {20,162},
+/* 9973 */ {20,162},
+/* 9974 */ {20,162},
+/* 9975 */ {20,162},
+/* 9976 */ {20,162},
+/* 9977 */ {20,162},
+/* 9978 */ {20,162},
+/* 9979 */ {20,162},
+/* 9980 */ {20,162},
+/* 9981 */ {20,162},
+/* 9982 */ {20,162},
+/* 9983 */ {20,162},
+/* 9984 */ {20,162},
+/* 9985 */ {20,162},
+/* 9986 */ {20,162},
+/* 9987 */ {20,162},
+/* 9988 */ {20,162},
+/* 9989 */ {20,162},
+/* 9990 */ {20,162},
+/* 9991 */ {20,162},
+/* 9992 */ {20,162},
+/* 9993 */ {20,162},
+/* 9994 */ {20,162},
+/* 9995 */ {20,162},
+/* 9996 */ {20,162},
+/* 9997 */ {20,162},
+/* 9998 */ {20,162},
+/* 9999 */ {20,162},
+/* 10000 */ {20,162},
+/* 10001 */ {20,162},
+/* 10002 */ {20,162},
+/* 10003 */ {20,162},
+/* 10004 */ {20,162},
+/* 10005 */ {20,162},
+/* 10006 */ {20,162},
+/* 10007 */ {20,162},
+/* 10008 */ {20,162},
+/* 10009 */ {20,162},
+/* 10010 */ {20,162},
+/* 10011 */ {20,162},
+/* 10012 */ {20,162},
+/* 10013 */ {20,162},
+/* 10014 */ {20,162},
+/* 10015 */ {20,162},
+/* 10016 */ {20,162},
+/* 10017 */ {20,162},
+/* 10018 */ {20,162},
+/* 10019 */ {20,162},
+/* 10020 */ {20,162},
+/* 10021 */ {20,162},
+/* 10022 */ {20,162},
+/* 10023 */ {20,162},
+/* 10024 */ {20,162},
+/* 10025 */ {20,162},
+/* 10026 */ {20,162},
+/* 10027 */ {20,162},
+/* 10028 */ {20,162},
+/* 10029 */ {20,162},
+/* 10030 */ {20,162},
+/* 10031 */ {20,162},
+/* 10032 */ {20,162},
+/* 10033 */ {20,162},
+/* 10034 */ {20,162},
+/* 10035 */ {20,162},
+/* 10036 */ {20,162},
+/* 10037 */ {20,162},
+/* 10038 */ {20,162},
+/* 10039 */ {20,162},
+/* 10040 */ {20,162},
+/* 10041 */ {20,162},
+/* 10042 */ {20,162},
+/* 10043 */ {20,162},
+/* 10044 */ {20,162},
+/* 10045 */ {20,162},
+/* 10046 */ {20,162},
+/* 10047 */ {20,162},
+/* 10048 */ {20,162},
+/* 10049 */ {20,162},
+/* 10050 */ {20,162},
+/* 10051 */ {20,162},
+/* 10052 */ {20,162},
+/* 10053 */ {20,162},
+/* 10054 */ {20,162},
+/* 10055 */ {20,162},
+/* 10056 */ {20,162},
+/* 10057 */ {20,162},
+/* 10058 */ {20,162},
+/* 10059 */ {20,162},
+/* 10060 */ {20,162},
+/* 10061 */ {20,162},
+/* 10062 */ {20,162},
+/* 10063 */ {20,162},
+/* 10064 */ {20,162},
+/* 10065 */ {20,162},
+/* 10066 */ {20,162},
+/* 10067 */ {20,162},
+/* 10068 */ {20,162},
+/* 10069 */ {20,162},
+/* 10070 */ {20,162},
+/* 10071 */ {20,162},
+/* 10072 */ {20,162},
+/* 10073 */ {20,162},
+/* 10074 */ {20,162},
+/* 10075 */ {20,162},
+/* 10076 */ {20,162},
+/* 10077 */ {20,162},
+/* 10078 */ {20,162},
+/* 10079 */ {20,162},
+/* 10080 */ {20,162},
+/* 10081 */ {20,162},
+/* 10082 */ {20,162},
+/* 10083 */ {20,162},
+/* 10084 */ {20,162},
+/* 10085 */ {20,162},
+/* 10086 */ {20,162},
+/* 10087 */ {20,162},
+/* 10088 */ {20,162},
+/* 10089 */ {20,162},
+/* 10090 */ {20,162},
+/* 10091 */ {20,162},
+/* 10092 */ {20,162},
+/* 10093 */ {20,162},
+/* 10094 */ {20,162},
+/* 10095 */ {20,162},
+/* 10096 */ {20,162},
+/* 10097 */ {20,162},
+/* 10098 */ {20,162},
+/* 10099 */ {20,162},
+/* 10100 */ {20,162},
+/* 10101 */ {20,162},
+/* 10102 */ {20,162},
+/* 10103 */ {20,162},
+/* 10104 */ {20,162},
+/* 10105 */ {20,162},
+/* 10106 */ {20,162},
+/* 10107 */ {20,162},
+/* 10108 */ {20,162},
+/* 10109 */ {20,162},
+/* 10110 */ {20,162},
+/* 10111 */ {20,162},
+/* 10112 */ {20,162},
+/* 10113 */ {20,162},
+/* 10114 */ {20,162},
+/* 10115 */ {20,162},
+/* 10116 */ {20,162},
+/* 10117 */ {20,162},
+/* 10118 */ {20,162},
+/* 10119 */ {20,162},
+/* 10120 */ {20,162},
+/* 10121 */ {20,162},
+/* 10122 */ {20,162},
+/* 10123 */ {20,162},
+/* 10124 */ {20,162},
+/* 10125 */ {20,162},
+/* 10126 */ {20,162},
+/* 10127 */ {20,162},
+/* 10128 */ {20,162},
+/* 10129 */ {20,162},
+/* 10130 */ {20,162},
+/* 10131 */ {20,162},
+/* 10132 */ {20,162},
+/* 10133 */ {20,162},
+/* 10134 */ {20,162},
+/* 10135 */ {20,162},
+/* 10136 */ {20,162},
+/* 10137 */ {20,162},
+/* 10138 */ {20,162},
+/* 10139 */ {20,162},
+/* 10140 */ {20,162},
+/* 10141 */ {20,162},
+/* 10142 */ {20,162},
+/* 10143 */ {20,162},
+/* 10144 */ {20,162},
+/* 10145 */ {20,162},
+/* 10146 */ {20,162},
+/* 10147 */ {20,162},
+/* 10148 */ {20,162},
+/* 10149 */ {20,162},
+/* 10150 */ {20,162},
+/* 10151 */ {20,162},
+/* 10152 */ {20,162},
+/* 10153 */ {20,162},
+/* 10154 */ {20,162},
+/* 10155 */ {20,162},
+/* 10156 */ {20,162},
+/* 10157 */ {20,162},
+/* 10158 */ {20,162},
+/* 10159 */ {20,162},
+/* 10160 */ {20,162},
+/* 10161 */ {20,162},
+/* 10162 */ {20,162},
+/* 10163 */ {20,162},
+/* 10164 */ {20,162},
+/* 10165 */ {20,162},
+/* 10166 */ {20,162},
+/* 10167 */ {20,162},
+/* 10168 */ {20,162},
+/* 10169 */ {20,162},
+/* 10170 */ {20,162},
+/* 10171 */ {20,162},
+/* 10172 */ {20,162},
+/* 10173 */ {20,162},
+/* 10174 */ {20,162},
+/* 10175 */ {20,162},
+/* 10176 */ {20,162},
+/* 10177 */ {20,162},
+/* 10178 */ {20,162},
+/* 10179 */ {20,162},
+/* 10180 */ {20,162},
+/* 10181 */ {20,162},
+/* 10182 */ {20,162},
+/* 10183 */ {20,162},
+/* 10184 */ {20,162},
+/* 10185 */ {20,162},
+/* 10186 */ {20,162},
+/* 10187 */ {20,162},
+/* 10188 */ {20,162},
+/* 10189 */ {20,162},
+/* 10190 */ {20,162},
+/* 10191 */ {20,162},
+/* 10192 */ {20,162},
+/* 10193 */ {20,162},
+/* 10194 */ {20,162},
+/* 10195 */ {20,162},
+/* 10196 */ {20,162},
+/* 10197 */ {20,162},
+/* 10198 */ {20,162},
+/* 10199 */ {20,162},
+/* 10200 */ {20,162},
+/* 10201 */ {20,162},
+/* 10202 */ {20,162},
+/* 10203 */ {20,162},
+/* 10204 */ {20,162},
+/* 10205 */ {20,162},
+/* 10206 */ {20,162},
+/* 10207 */ {20,162},
+/* 10208 */ {20,162},
+/* 10209 */ {20,162},
+/* 10210 */ {20,162},
+/* 10211 */ {20,162},
+/* 10212 */ {20,162},
+/* 10213 */ {20,162},
+/* 10214 */ {20,162},
+/* 10215 */ {20,162},
+/* 10216 */ {20,162},
+/* 10217 */ {20,162},
+/* 10218 */ {20,162},
+/* 10219 */ {20,162},
+/* 10220 */ {20,162},
+/* 10221 */ {20,162},
+/* 10222 */ {20,162},
+/* 10223 */ {20,162},
+/* 10224 */ {20,162},
+/* 10225 */ {20,162},
+/* 10226 */ {20,162},
+/* 10227 */ {20,162},
+/* 10228 */ {20,162},
+/* 10229 */ {20,162},
+/* 10230 */ {20,162},
+/* 10231 */ {20,162},
+/* 10232 */ {20,162},
+/* 10233 */ {20,162},
+/* 10234 */ {20,162},
+/* 10235 */ {20,162},
+/* 10236 */ {20,162},
+/* 10237 */ {20,162},
+/* 10238 */ {20,162},
+/* 10239 */ {20,162},
+/* 10240 */ {20,184},
+/* 10241 */ {20,184},
+/* 10242 */ {20,184},
+/* 10243 */ {20,184},
+/* 10244 */ {20,184},
+/* 10245 */ {20,184},
+/* 10246 */ {20,184},
+/* 10247 */ {20,184},
+/* 10248 */ {20,184},
+/* 10249 */ {20,184},
+/* 10250 */ {20,184},
+/* 10251 */ {20,184},
+/* 10252 */ {20,184},
+/* 10253 */ {20,184},
+/* 10254 */ {20,184},
+/* 10255 */ {20,184},
+/* 10256 */ {20,184},
+/* 10257 */ {20,184},
+/* 10258 */ {20,184},
+/* 10259 */ {20,184},
+/* 10260 */ {20,184},
+/* 10261 */ {20,184},
+/* 10262 */ {20,184},
+/* 10263 */ {20,184},
+/* 10264 */ {20,184},
+/* 10265 */ {20,184},
+/* 10266 */ {20,184},
+/* 10267 */ {20,184},
+/* 10268 */ {20,184},
+/* 10269 */ {20,184},
+/* 10270 */ {20,184},
+/* 10271 */ {20,184},
+/* 10272 */ {20,184},
+/* 10273 */ {20,184},
+/* 10274 */ {20,184},
+/* 10275 */ {20,184},
+/* 10276 */ {20,184},
+/* 10277 */ {20,184},
+/* 10278 */ {20,184},
+/* 10279 */ {20,184},
+/* 10280 */ {20,184},
+/* 10281 */ {20,184},
+/* 10282 */ {20,184},
+/* 10283 */ {20,184},
+/* 10284 */ {20,184},
+/* 10285 */ {20,184},
+/* 10286 */ {20,184},
+/* 10287 */ {20,184},
+/* 10288 */ {20,184},
+/* 10289 */ {20,184},
+/* 10290 */ {20,184},
+/* 10291 */ {20,184},
+/* 10292 */ {20,184},
+/* 10293 */ {20,184},
+/* 10294 */ {20,184},
+/* 10295 */ {20,184},
+/* 10296 */ {20,184},
+/* 10297 */ {20,184},
+/* 10298 */ {20,184},
+/* 10299 */ {20,184},
+/* 10300 */ {20,184},
+/* 10301 */ {20,184},
+/* 10302 */ {20,184},
+/* 10303 */ {20,184},
+/* 10304 */ {20,184},
+/* 10305 */ {20,184},
+/* 10306 */ {20,184},
+/* 10307 */ {20,184},
+/* 10308 */ {20,184},
+/* 10309 */ {20,184},
+/* 10310 */ {20,184},
+/* 10311 */ {20,184},
+/* 10312 */ {20,184},
+/* 10313 */ {20,184},
+/* 10314 */ {20,184},
+/* 10315 */ {20,184},
+/* 10316 */ {20,184},
+/* 10317 */ {20,184},
+/* 10318 */ {20,184},
+/* 10319 */ {20,184},
+/* 10320 */ {20,184},
+/* 10321 */ {20,184},
+/* 10322 */ {20,184},
+/* 10323 */ {20,184},
+/* 10324 */ {20,184},
+/* 10325 */ {20,184},
+/* 10326 */ {20,184},
+/* 10327 */ {20,184},
+/* 10328 */ {20,184},
+/* 10329 */ {20,184},
+/* 10330 */ {20,184},
+/* 10331 */ {20,184},
+/* 10332 */ {20,184},
+/* 10333 */ {20,184},
+/* 10334 */ {20,184},
+/* 10335 */ {20,184},
+/* 10336 */ {20,184},
+/* 10337 */ {20,184},
+/* 10338 */ {20,184},
+/* 10339 */ {20,184},
+/* 10340 */ {20,184},
+/* 10341 */ {20,184},
+/* 10342 */ {20,184},
+/* 10343 */ {20,184},
+/* 10344 */ {20,184},
+/* 10345 */ {20,184},
+/* 10346 */ {20,184},
+/* 10347 */ {20,184},
+/* 10348 */ {20,184},
+/* 10349 */ {20,184},
+/* 10350 */ {20,184},
+/* 10351 */ {20,184},
+/* 10352 */ {20,184},
+/* 10353 */ {20,184},
+/* 10354 */ {20,184},
+/* 10355 */ {20,184},
+/* 10356 */ {20,184},
+/* 10357 */ {20,184},
+/* 10358 */ {20,184},
+/* 10359 */ {20,184},
+/* 10360 */ {20,184},
+/* 10361 */ {20,184},
+/* 10362 */ {20,184},
+/* 10363 */ {20,184},
+/* 10364 */ {20,184},
+/* 10365 */ {20,184},
+/* 10366 */ {20,184},
+/* 10367 */ {20,184},
+/* 10368 */ {20,184},
+/* 10369 */ {20,184},
+/* 10370 */ {20,184},
+/* 10371 */ {20,184},
+/* 10372 */ {20,184},
+/* 10373 */ {20,184},
+/* 10374 */ {20,184},
+/* 10375 */ {20,184},
+/* 10376 */ {20,184},
+/* 10377 */ {20,184},
+/* 10378 */ {20,184},
+/* 10379 */ {20,184},
+/* 10380 */ {20,184},
+/* 10381 */ {20,184},
+/* 10382 */ {20,184},
+/* 10383 */ {20,184},
+/* 10384 */ {20,184},
+/* 10385 */ {20,184},
+/* 10386 */ {20,184},
+/* 10387 */ {20,184},
+/* 10388 */ {20,184},
+/* 10389 */ {20,184},
+/* 10390 */ {20,184},
+/* 10391 */ {20,184},
+/* 10392 */ {20,184},
+/* 10393 */ {20,184},
+/* 10394 */ {20,184},
+/* 10395 */ {20,184},
+/* 10396 */ {20,184},
+/* 10397 */ {20,184},
+/* 10398 */ {20,184},
+/* 10399 */ {20,184},
+/* 10400 */ {20,184},
+/* 10401 */ {20,184},
+/* 10402 */ {20,184},
+/* 10403 */ {20,184},
+/* 10404 */ {20,184},
+/* 10405 */ {20,184},
+/* 10406 */ {20,184},
+/* 10407 */ {20,184},
+/* 10408 */ {20,184},
+/* 10409 */ {20,184},
+/* 10410 */ {20,184},
+/* 10411 */ {20,184},
+/* 10412 */ {20,184},
+/* 10413 */ {20,184},
+/* 10414 */ {20,184},
+/* 10415 */ {20,184},
+/* 10416 */ {20,184},
+/* 10417 */ {20,184},
+/* 10418 */ {20,184},
+/* 10419 */ {20,184},
+/* 10420 */ {20,184},
+/* 10421 */ {20,184},
+/* 10422 */ {20,184},
+/* 10423 */ {20,184},
+/* 10424 */ {20,184},
+/* 10425 */ {20,184},
+/* 10426 */ {20,184},
+/* 10427 */ {20,184},
+/* 10428 */ {20,184},
+/* 10429 */ {20,184},
+/* 10430 */ {20,184},
+/* 10431 */ {20,184},
+/* 10432 */ {20,184},
+/* 10433 */ {20,184},
+/* 10434 */ {20,184},
+/* 10435 */ {20,184},
+/* 10436 */ {20,184},
+/* 10437 */ {20,184},
+/* 10438 */ {20,184},
+/* 10439 */ {20,184},
+/* 10440 */ {20,184},
+/* 10441 */ {20,184},
+/* 10442 */ {20,184},
+/* 10443 */ {20,184},
+/* 10444 */ {20,184},
+/* 10445 */ {20,184},
+/* 10446 */ {20,184},
+/* 10447 */ {20,184},
+/* 10448 */ {20,184},
+/* 10449 */ {20,184},
+/* 10450 */ {20,184},
+/* 10451 */ {20,184},
+/* 10452 */ {20,184},
+/* 10453 */ {20,184},
+/* 10454 */ {20,184},
+/* 10455 */ {20,184},
+/* 10456 */ {20,184},
+/* 10457 */ {20,184},
+/* 10458 */ {20,184},
+/* 10459 */ {20,184},
+/* 10460 */ {20,184},
+/* 10461 */ {20,184},
+/* 10462 */ {20,184},
+/* 10463 */ {20,184},
+/* 10464 */ {20,184},
+/* 10465 */ {20,184},
+/* 10466 */ {20,184},
+/* 10467 */ {20,184},
+/* 10468 */ {20,184},
+/* 10469 */ {20,184},
+/* 10470 */ {20,184},
+/* 10471 */ {20,184},
+/* 10472 */ {20,184},
+/* 10473 */ {20,184},
+/* 10474 */ {20,184},
+/* 10475 */ {20,184},
+/* 10476 */ {20,184},
+/* 10477 */ {20,184},
+/* 10478 */ {20,184},
+/* 10479 */ {20,184},
+/* 10480 */ {20,184},
+/* 10481 */ {20,184},
+/* 10482 */ {20,184},
+/* 10483 */ {20,184},
+/* 10484 */ {20,184},
+/* 10485 */ {20,184},
+/* 10486 */ {20,184},
+/* 10487 */ {20,184},
+/* 10488 */ {20,184},
+/* 10489 */ {20,184},
+/* 10490 */ {20,184},
+/* 10491 */ {20,184},
+/* 10492 */ {20,184},
+/* 10493 */ {20,184},
+/* 10494 */ {20,184},
+/* 10495 */ {20,184},
+/* 10496 */ {20,184},
+/* 10497 */ {20,184},
+/* 10498 */ {20,184},
+/* 10499 */ {20,184},
+/* 10500 */ {20,184},
+/* 10501 */ {20,184},
+/* 10502 */ {20,184},
+/* 10503 */ {20,184},
+/* 10504 */ {20,184},
+/* 10505 */ {20,184},
+/* 10506 */ {20,184},
+/* 10507 */ {20,184},
+/* 10508 */ {20,184},
+/* 10509 */ {20,184},
+/* 10510 */ {20,184},
+/* 10511 */ {20,184},
+/* 10512 */ {20,184},
+/* 10513 */ {20,184},
+/* 10514 */ {20,184},
+/* 10515 */ {20,184},
+/* 10516 */ {20,184},
+/* 10517 */ {20,184},
+/* 10518 */ {20,184},
+/* 10519 */ {20,184},
+/* 10520 */ {20,184},
+/* 10521 */ {20,184},
+/* 10522 */ {20,184},
+/* 10523 */ {20,184},
+/* 10524 */ {20,184},
+/* 10525 */ {20,184},
+/* 10526 */ {20,184},
+/* 10527 */ {20,184},
+/* 10528 */ {20,184},
+/* 10529 */ {20,184},
+/* 10530 */ {20,184},
+/* 10531 */ {20,184},
+/* 10532 */ {20,184},
+/* 10533 */ {20,184},
+/* 10534 */ {20,184},
+/* 10535 */ {20,184},
+/* 10536 */ {20,184},
+/* 10537 */ {20,184},
+/* 10538 */ {20,184},
+/* 10539 */ {20,184},
+/* 10540 */ {20,184},
+/* 10541 */ {20,184},
+/* 10542 */ {20,184},
+/* 10543 */ {20,184},
+/* 10544 */ {20,184},
+/* 10545 */ {20,184},
+/* 10546 */ {20,184},
+/* 10547 */ {20,184},
+/* 10548 */ {20,184},
+/* 10549 */ {20,184},
+/* 10550 */ {20,184},
+/* 10551 */ {20,184},
+/* 10552 */ {20,184},
+/* 10553 */ {20,184},
+/* 10554 */ {20,184},
+/* 10555 */ {20,184},
+/* 10556 */ {20,184},
+/* 10557 */ {20,184},
+/* 10558 */ {20,184},
+/* 10559 */ {20,184},
+/* 10560 */ {20,184},
+/* 10561 */ {20,184},
+/* 10562 */ {20,184},
+/* 10563 */ {20,184},
+/* 10564 */ {20,184},
+/* 10565 */ {20,184},
+/* 10566 */ {20,184},
+/* 10567 */ {20,184},
+/* 10568 */ {20,184},
+/* 10569 */ {20,184},
+/* 10570 */ {20,184},
+/* 10571 */ {20,184},
+/* 10572 */ {20,184},
+/* 10573 */ {20,184},
+/* 10574 */ {20,184},
+/* 10575 */ {20,184},
+/* 10576 */ {20,184},
+/* 10577 */ {20,184},
+/* 10578 */ {20,184},
+/* 10579 */ {20,184},
+/* 10580 */ {20,184},
+/* 10581 */ {20,184},
+/* 10582 */ {20,184},
+/* 10583 */ {20,184},
+/* 10584 */ {20,184},
+/* 10585 */ {20,184},
+/* 10586 */ {20,184},
+/* 10587 */ {20,184},
+/* 10588 */ {20,184},
+/* 10589 */ {20,184},
+/* 10590 */ {20,184},
+/* 10591 */ {20,184},
+/* 10592 */ {20,184},
+/* 10593 */ {20,184},
+/* 10594 */ {20,184},
+/* 10595 */ {20,184},
+/* 10596 */ {20,184},
+/* 10597 */ {20,184},
+/* 10598 */ {20,184},
+/* 10599 */ {20,184},
+/* 10600 */ {20,184},
+/* 10601 */ {20,184},
+/* 10602 */ {20,184},
+/* 10603 */ {20,184},
+/* 10604 */ {20,184},
+/* 10605 */ {20,184},
+/* 10606 */ {20,184},
+/* 10607 */ {20,184},
+/* 10608 */ {20,184},
+/* 10609 */ {20,184},
+/* 10610 */ {20,184},
+/* 10611 */ {20,184},
+/* 10612 */ {20,184},
+/* 10613 */ {20,184},
+/* 10614 */ {20,184},
+/* 10615 */ {20,184},
+/* 10616 */ {20,184},
+/* 10617 */ {20,184},
+/* 10618 */ {20,184},
+/* 10619 */ {20,184},
+/* 10620 */ {20,184},
+/* 10621 */ {20,184},
+/* 10622 */ {20,184},
+/* 10623 */ {20,184},
+/* 10624 */ {20,184},
+/* 10625 */ {20,184},
+/* 10626 */ {20,184},
+/* 10627 */ {20,184},
+/* 10628 */ {20,184},
+/* 10629 */ {20,184},
+/* 10630 */ {20,184},
+/* 10631 */ {20,184},
+/* 10632 */ {20,184},
+/* 10633 */ {20,184},
+/* 10634 */ {20,184},
+/* 10635 */ {20,184},
+/* 10636 */ {20,184},
+/* 10637 */ {20,184},
+/* 10638 */ {20,184},
+/* 10639 */ {20,184},
+/* 10640 */ {20,184},
+/* 10641 */ {20,184},
+/* 10642 */ {20,184},
+/* 10643 */ {20,184},
+/* 10644 */ {20,184},
+/* 10645 */ {20,184},
+/* 10646 */ {20,184},
+/* 10647 */ {20,184},
+/* 10648 */ {20,184},
+/* 10649 */ {20,184},
+/* 10650 */ {20,184},
+/* 10651 */ {20,184},
+/* 10652 */ {20,184},
+/* 10653 */ {20,184},
+/* 10654 */ {20,184},
+/* 10655 */ {20,184},
+/* 10656 */ {20,184},
+/* 10657 */ {20,184},
+/* 10658 */ {20,184},
+/* 10659 */ {20,184},
+/* 10660 */ {20,184},
+/* 10661 */ {20,184},
+/* 10662 */ {20,184},
+/* 10663 */ {20,184},
+/* 10664 */ {20,184},
+/* 10665 */ {20,184},
+/* 10666 */ {20,184},
+/* 10667 */ {20,184},
+/* 10668 */ {20,184},
+/* 10669 */ {20,184},
+/* 10670 */ {20,184},
+/* 10671 */ {20,184},
+/* 10672 */ {20,184},
+/* 10673 */ {20,184},
+/* 10674 */ {20,184},
+/* 10675 */ {20,184},
+/* 10676 */ {20,184},
+/* 10677 */ {20,184},
+/* 10678 */ {20,184},
+/* 10679 */ {20,184},
+/* 10680 */ {20,184},
+/* 10681 */ {20,184},
+/* 10682 */ {20,184},
+/* 10683 */ {20,184},
+/* 10684 */ {20,184},
+/* 10685 */ {20,184},
+/* 10686 */ {20,184},
+/* 10687 */ {20,184},
+/* 10688 */ {20,184},
+/* 10689 */ {20,184},
+/* 10690 */ {20,184},
+/* 10691 */ {20,184},
+/* 10692 */ {20,184},
+/* 10693 */ {20,184},
+/* 10694 */ {20,184},
+/* 10695 */ {20,184},
+/* 10696 */ {20,184},
+/* 10697 */ {20,184},
+/* 10698 */ {20,184},
+/* 10699 */ {20,184},
+/* 10700 */ {20,184},
+/* 10701 */ {20,184},
+/* 10702 */ {20,184},
+/* 10703 */ {20,184},
+/* 10704 */ {20,184},
+/* 10705 */ {20,184},
+/* 10706 */ {20,184},
+/* 10707 */ {20,184},
+/* 10708 */ {20,184},
+/* 10709 */ {20,184},
+/* 10710 */ {20,184},
+/* 10711 */ {20,184},
+/* 10712 */ {20,184},
+/* 10713 */ {20,184},
+/* 10714 */ {20,184},
+/* 10715 */ {20,184},
+/* 10716 */ {20,184},
+/* 10717 */ {20,184},
+/* 10718 */ {20,184},
+/* 10719 */ {20,184},
+/* 10720 */ {20,184},
+/* 10721 */ {20,184},
+/* 10722 */ {20,184},
+/* 10723 */ {20,184},
+/* 10724 */ {20,184},
+/* 10725 */ {20,184},
+/* 10726 */ {20,184},
+/* 10727 */ {20,184},
+/* 10728 */ {20,184},
+/* 10729 */ {20,184},
+/* 10730 */ {20,184},
+/* 10731 */ {20,184},
+/* 10732 */ {20,184},
+/* 10733 */ {20,184},
+/* 10734 */ {20,184},
+/* 10735 */ {20,184},
+/* 10736 */ {20,184},
+/* 10737 */ {20,184},
+/* 10738 */ {20,184},
+/* 10739 */ {20,184},
+/* 10740 */ {20,184},
+/* 10741 */ {20,184},
+/* 10742 */ {20,184},
+/* 10743 */ {20,184},
+/* 10744 */ {20,184},
+/* 10745 */ {20,184},
+/* 10746 */ {20,184},
+/* 10747 */ {20,184},
+/* 10748 */ {20,184},
+/* 10749 */ {20,184},
+/* 10750 */ {20,184},
+/* 10751 */ {20,184},
+/* 10752 */ {20,184},
+/* 10753 */ {20,184},
+/* 10754 */ {20,184},
+/* 10755 */ {20,184},
+/* 10756 */ {20,184},
+/* 10757 */ {20,184},
+/* 10758 */ {20,184},
+/* 10759 */ {20,184},
+/* 10760 */ {20,184},
+/* 10761 */ {20,184},
+/* 10762 */ {20,184},
+/* 10763 */ {20,184},
+/* 10764 */ {20,184},
+/* 10765 */ {20,184},
+/* 10766 */ {20,184},
+/* 10767 */ {20,184},
+/* 10768 */ {20,184},
+/* 10769 */ {20,184},
+/* 10770 */ {20,184},
+/* 10771 */ {20,184},
+/* 10772 */ {20,184},
+/* 10773 */ {20,184},
+/* 10774 */ {20,184},
+/* 10775 */ {20,184},
+/* 10776 */ {20,184},
+/* 10777 */ {20,184},
+/* 10778 */ {20,184},
+/* 10779 */ {20,184},
+/* 10780 */ {20,184},
+/* 10781 */ {20,184},
+/* 10782 */ {20,184},
+/* 10783 */ {20,184},
+/* 10784 */ {20,184},
+/* 10785 */ {20,184},
+/* 10786 */ {20,184},
+/* 10787 */ {20,184},
+/* 10788 */ {20,184},
+/* 10789 */ {20,184},
+/* 10790 */ {20,184},
+/* 10791 */ {20,184},
+/* 10792 */ {20,184},
+/* 10793 */ {20,184},
+/* 10794 */ {20,184},
+/* 10795 */ {20,184},
+/* 10796 */ {20,184},
+/* 10797 */ {20,184},
+/* 10798 */ {20,184},
+/* 10799 */ {20,184},
+/* 10800 */ {20,184},
+/* 10801 */ {20,184},
+/* 10802 */ {20,184},
+/* 10803 */ {20,184},
+/* 10804 */ {20,184},
+/* 10805 */ {20,184},
+/* 10806 */ {20,184},
+/* 10807 */ {20,184},
+/* 10808 */ {20,184},
+/* 10809 */ {20,184},
+/* 10810 */ {20,184},
+/* 10811 */ {20,184},
+/* 10812 */ {20,184},
+/* 10813 */ {20,184},
+/* 10814 */ {20,184},
+/* 10815 */ {20,184},
+/* 10816 */ {20,184},
+/* 10817 */ {20,184},
+/* 10818 */ {20,184},
+/* 10819 */ {20,184},
+/* 10820 */ {20,184},
+/* 10821 */ {20,184},
+/* 10822 */ {20,184},
+/* 10823 */ {20,184},
+/* 10824 */ {20,184},
+/* 10825 */ {20,184},
+/* 10826 */ {20,184},
+/* 10827 */ {20,184},
+/* 10828 */ {20,184},
+/* 10829 */ {20,184},
+/* 10830 */ {20,184},
+/* 10831 */ {20,184},
+/* 10832 */ {20,184},
+/* 10833 */ {20,184},
+/* 10834 */ {20,184},
+/* 10835 */ {20,184},
+/* 10836 */ {20,184},
+/* 10837 */ {20,184},
+/* 10838 */ {20,184},
+/* 10839 */ {20,184},
+/* 10840 */ {20,184},
+/* 10841 */ {20,184},
+/* 10842 */ {20,184},
+/* 10843 */ {20,184},
+/* 10844 */ {20,184},
+/* 10845 */ {20,184},
+/* 10846 */ {20,184},
+/* 10847 */ {20,184},
+/* 10848 */ {20,184},
+/* 10849 */ {20,184},
+/* 10850 */ {20,184},
+/* 10851 */ {20,184},
+/* 10852 */ {20,184},
+/* 10853 */ {20,184},
+/* 10854 */ {20,184},
+/* 10855 */ {20,184},
+/* 10856 */ {20,184},
+/* 10857 */ {20,184},
+/* 10858 */ {20,184},
+/* 10859 */ {20,184},
+/* 10860 */ {20,184},
+/* 10861 */ {20,184},
+/* 10862 */ {20,184},
+/* 10863 */ {20,184},
+/* 10864 */ {20,184},
+/* 10865 */ {20,184},
+/* 10866 */ {20,184},
+/* 10867 */ {20,184},
+/* 10868 */ {20,184},
+/* 10869 */ {20,184},
+/* 10870 */ {20,184},
+/* 10871 */ {20,184},
+/* 10872 */ {20,184},
+/* 10873 */ {20,184},
+/* 10874 */ {20,184},
+/* 10875 */ {20,184},
+/* 10876 */ {20,184},
+/* 10877 */ {20,184},
+/* 10878 */ {20,184},
+/* 10879 */ {20,184},
+/* 10880 */ {20,184},
+/* 10881 */ {20,184},
+/* 10882 */ {20,184},
+/* 10883 */ {20,184},
+/* 10884 */ {20,184},
+/* 10885 */ {20,184},
+/* 10886 */ {20,184},
+/* 10887 */ {20,184},
+/* 10888 */ {20,184},
+/* 10889 */ {20,184},
+/* 10890 */ {20,184},
+/* 10891 */ {20,184},
+/* 10892 */ {20,184},
+/* 10893 */ {20,184},
+/* 10894 */ {20,184},
+/* 10895 */ {20,184},
+/* 10896 */ {20,184},
+/* 10897 */ {20,184},
+/* 10898 */ {20,184},
+/* 10899 */ {20,184},
+/* 10900 */ {20,184},
+/* 10901 */ {20,184},
+/* 10902 */ {20,184},
+/* 10903 */ {20,184},
+/* 10904 */ {20,184},
+/* 10905 */ {20,184},
+/* 10906 */ {20,184},
+/* 10907 */ {20,184},
+/* 10908 */ {20,184},
+/* 10909 */ {20,184},
+/* 10910 */ {20,184},
+/* 10911 */ {20,184},
+/* 10912 */ {20,184},
+/* 10913 */ {20,184},
+/* 10914 */ {20,184},
+/* 10915 */ {20,184},
+/* 10916 */ {20,184},
+/* 10917 */ {20,184},
+/* 10918 */ {20,184},
+/* 10919 */ {20,184},
+/* 10920 */ {20,184},
+/* 10921 */ {20,184},
+/* 10922 */ {20,184},
+/* 10923 */ {20,184},
+/* 10924 */ {20,184},
+/* 10925 */ {20,184},
+/* 10926 */ {20,184},
+/* 10927 */ {20,184},
+/* 10928 */ {20,184},
+/* 10929 */ {20,184},
+/* 10930 */ {20,184},
+/* 10931 */ {20,184},
+/* 10932 */ {20,184},
+/* 10933 */ {20,184},
+/* 10934 */ {20,184},
+/* 10935 */ {20,184},
+/* 10936 */ {20,184},
+/* 10937 */ {20,184},
+/* 10938 */ {20,184},
+/* 10939 */ {20,184},
+/* 10940 */ {20,184},
+/* 10941 */ {20,184},
+/* 10942 */ {20,184},
+/* 10943 */ {20,184},
+/* 10944 */ {20,184},
+/* 10945 */ {20,184},
+/* 10946 */ {20,184},
+/* 10947 */ {20,184},
+/* 10948 */ {20,184},
+/* 10949 */ {20,184},
+/* 10950 */ {20,184},
+/* 10951 */ {20,184},
+/* 10952 */ {20,184},
+/* 10953 */ {20,184},
+/* 10954 */ {20,184},
+/* 10955 */ {20,184},
+/* 10956 */ {20,184},
+/* 10957 */ {20,184},
+/* 10958 */ {20,184},
+/* 10959 */ {20,184},
+/* 10960 */ {20,184},
+/* 10961 */ {20,184},
+/* 10962 */ {20,184},
+/* 10963 */ {20,184},
+/* 10964 */ {20,184},
+/* 10965 */ {20,184},
+/* 10966 */ {20,184},
+/* 10967 */ {20,184},
+/* 10968 */ {20,184},
+/* 10969 */ {20,184},
+/* 10970 */ {20,184},
+/* 10971 */ {20,184},
+/* 10972 */ {20,184},
+/* 10973 */ {20,184},
+/* 10974 */ {20,184},
+/* 10975 */ {20,184},
+/* 10976 */ {20,184},
+/* 10977 */ {20,184},
+/* 10978 */ {20,184},
+/* 10979 */ {20,184},
+/* 10980 */ {20,184},
+/* 10981 */ {20,184},
+/* 10982 */ {20,184},
+/* 10983 */ {20,184},
+/* 10984 */ {20,184},
+/* 10985 */ {20,184},
+/* 10986 */ {20,184},
+/* 10987 */ {20,184},
+/* 10988 */ {20,184},
+/* 10989 */ {20,184},
+/* 10990 */ {20,184},
+/* 10991 */ {20,184},
+/* 10992 */ {20,184},
+/* 10993 */ {20,184},
+/* 10994 */ {20,184},
+/* 10995 */ {20,184},
+/* 10996 */ {20,184},
+/* 10997 */ {20,184},
+/* 10998 */ {20,184},
+/* 10999 */ {20,184},
+/* 11000 */ {20,184},
+/* 11001 */ {20,184},
+/* 11002 */ {20,184},
+/* 11003 */ {20,184},
+/* 11004 */ {20,184},
+/* 11005 */ {20,184},
+/* 11006 */ {20,184},
+/* 11007 */ {20,184},
+/* 11008 */ {20,184},
+/* 11009 */ {20,184},
+/* 11010 */ {20,184},
+/* 11011 */ {20,184},
+/* 11012 */ {20,184},
+/* 11013 */ {20,184},
+/* 11014 */ {20,184},
+/* 11015 */ {20,184},
+/* 11016 */ {20,184},
+/* 11017 */ {20,184},
+/* 11018 */ {20,184},
+/* 11019 */ {20,184},
+/* 11020 */ {20,184},
+/* 11021 */ {20,184},
+/* 11022 */ {20,184},
+/* 11023 */ {20,184},
+/* 11024 */ {20,184},
+/* 11025 */ {20,184},
+/* 11026 */ {20,184},
+/* 11027 */ {20,184},
+/* 11028 */ {20,184},
+/* 11029 */ {20,184},
+/* 11030 */ {20,184},
+/* 11031 */ {20,184},
+/* 11032 */ {20,184},
+/* 11033 */ {20,184},
+/* 11034 */ {20,184},
+/* 11035 */ {20,184},
+/* 11036 */ {20,184},
+/* 11037 */ {20,184},
+/* 11038 */ {20,184},
+/* 11039 */ {20,184},
+/* 11040 */ {20,184},
+/* 11041 */ {20,184},
+/* 11042 */ {20,184},
+/* 11043 */ {20,184},
+/* 11044 */ {20,184},
+/* 11045 */ {20,184},
+/* 11046 */ {20,184},
+/* 11047 */ {20,184},
+/* 11048 */ {20,184},
+/* 11049 */ {20,184},
+/* 11050 */ {20,184},
+/* 11051 */ {20,184},
+/* 11052 */ {20,184},
+/* 11053 */ {20,184},
+/* 11054 */ {20,184},
+/* 11055 */ {20,184},
+/* 11056 */ {20,184},
+/* 11057 */ {20,184},
+/* 11058 */ {20,184},
+/* 11059 */ {20,184},
+/* 11060 */ {20,184},
+/* 11061 */ {20,184},
+/* 11062 */ {20,184},
+/* 11063 */ {20,184},
+/* 11064 */ {20,184},
+/* 11065 */ {20,184},
+/* 11066 */ {20,184},
+/* 11067 */ {20,184},
+/* 11068 */ {20,184},
+/* 11069 */ {20,184},
+/* 11070 */ {20,184},
+/* 11071 */ {20,184},
+/* 11072 */ {20,184},
+/* 11073 */ {20,184},
+/* 11074 */ {20,184},
+/* 11075 */ {20,184},
+/* 11076 */ {20,184},
+/* 11077 */ {20,184},
+/* 11078 */ {20,184},
+/* 11079 */ {20,184},
+/* 11080 */ {20,184},
+/* 11081 */ {20,184},
+/* 11082 */ {20,184},
+/* 11083 */ {20,184},
+/* 11084 */ {20,184},
+/* 11085 */ {20,184},
+/* 11086 */ {20,184},
+/* 11087 */ {20,184},
+/* 11088 */ {20,184},
+/* 11089 */ {20,184},
+/* 11090 */ {20,184},
+/* 11091 */ {20,184},
+/* 11092 */ {20,184},
+/* 11093 */ {20,184},
+/* 11094 */ {20,184},
+/* 11095 */ {20,184},
+/* 11096 */ {20,184},
+/* 11097 */ {20,184},
+/* 11098 */ {20,184},
+/* 11099 */ {20,184},
+/* 11100 */ {20,184},
+/* 11101 */ {20,184},
+/* 11102 */ {20,184},
+/* 11103 */ {20,184},
+/* 11104 */ {20,184},
+/* 11105 */ {20,184},
+/* 11106 */ {20,184},
+/* 11107 */ {20,184},
+/* 11108 */ {20,184},
+/* 11109 */ {20,184},
+/* 11110 */ {20,184},
+/* 11111 */ {20,184},
+/* 11112 */ {20,184},
+/* 11113 */ {20,184},
+/* 11114 */ {20,184},
+/* 11115 */ {20,184},
+/* 11116 */ {20,184},
+/* 11117 */ {20,184},
+/* 11118 */ {20,184},
+/* 11119 */ {20,184},
+/* 11120 */ {20,184},
+/* 11121 */ {20,184},
+/* 11122 */ {20,184},
+/* 11123 */ {20,184},
+/* 11124 */ {20,184},
+/* 11125 */ {20,184},
+/* 11126 */ {20,184},
+/* 11127 */ {20,184},
+/* 11128 */ {20,184},
+/* 11129 */ {20,184},
+/* 11130 */ {20,184},
+/* 11131 */ {20,184},
+/* 11132 */ {20,184},
+/* 11133 */ {20,184},
+/* 11134 */ {20,184},
+/* 11135 */ {20,184},
+/* 11136 */ {20,184},
+/* 11137 */ {20,184},
+/* 11138 */ {20,184},
+/* 11139 */ {20,184},
+/* 11140 */ {20,184},
+/* 11141 */ {20,184},
+/* 11142 */ {20,184},
+/* 11143 */ {20,184},
+/* 11144 */ {20,184},
+/* 11145 */ {20,184},
+/* 11146 */ {20,184},
+/* 11147 */ {20,184},
+/* 11148 */ {20,184},
+/* 11149 */ {20,184},
+/* 11150 */ {20,184},
+/* 11151 */ {20,184},
+/* 11152 */ {20,184},
+/* 11153 */ {20,184},
+/* 11154 */ {20,184},
+/* 11155 */ {20,184},
+/* 11156 */ {20,184},
+/* 11157 */ {20,184},
+/* 11158 */ {20,184},
+/* 11159 */ {20,184},
+/* 11160 */ {20,184},
+/* 11161 */ {20,184},
+/* 11162 */ {20,184},
+/* 11163 */ {20,184},
+/* 11164 */ {20,184},
+/* 11165 */ {20,184},
+/* 11166 */ {20,184},
+/* 11167 */ {20,184},
+/* 11168 */ {20,184},
+/* 11169 */ {20,184},
+/* 11170 */ {20,184},
+/* 11171 */ {20,184},
+/* 11172 */ {20,184},
+/* 11173 */ {20,184},
+/* 11174 */ {20,184},
+/* 11175 */ {20,184},
+/* 11176 */ {20,184},
+/* 11177 */ {20,184},
+/* 11178 */ {20,184},
+/* 11179 */ {20,184},
+/* 11180 */ {20,184},
+/* 11181 */ {20,184},
+/* 11182 */ {20,184},
+/* 11183 */ {20,184},
+/* 11184 */ {20,184},
+/* 11185 */ {20,184},
+/* 11186 */ {20,184},
+/* 11187 */ {20,184},
+/* 11188 */ {20,184},
+/* 11189 */ {20,184},
+/* 11190 */ {20,184},
+/* 11191 */ {20,184},
+/* 11192 */ {20,184},
+/* 11193 */ {20,184},
+/* 11194 */ {20,184},
+/* 11195 */ {20,184},
+/* 11196 */ {20,184},
+/* 11197 */ {20,184},
+/* 11198 */ {20,184},
+/* 11199 */ {20,184},
+/* 11200 */ {20,184},
+/* 11201 */ {20,184},
+/* 11202 */ {20,184},
+/* 11203 */ {20,184},
+/* 11204 */ {20,184},
+/* 11205 */ {20,184},
+/* 11206 */ {20,184},
+/* 11207 */ {20,184},
+/* 11208 */ {20,184},
+/* 11209 */ {20,184},
+/* 11210 */ {20,184},
+/* 11211 */ {20,184},
+/* 11212 */ {20,184},
+/* 11213 */ {20,184},
+/* 11214 */ {20,184},
+/* 11215 */ {20,184},
+/* 11216 */ {20,184},
+/* 11217 */ {20,184},
+/* 11218 */ {20,184},
+/* 11219 */ {20,184},
+/* 11220 */ {20,184},
+/* 11221 */ {20,184},
+/* 11222 */ {20,184},
+/* 11223 */ {20,184},
+/* 11224 */ {20,184},
+/* 11225 */ {20,184},
+/* 11226 */ {20,184},
+/* 11227 */ {20,184},
+/* 11228 */ {20,184},
+/* 11229 */ {20,184},
+/* 11230 */ {20,184},
+/* 11231 */ {20,184},
+/* 11232 */ {20,184},
+/* 11233 */ {20,184},
+/* 11234 */ {20,184},
+/* 11235 */ {20,184},
+/* 11236 */ {20,184},
+/* 11237 */ {20,184},
+/* 11238 */ {20,184},
+/* 11239 */ {20,184},
+/* 11240 */ {20,184},
+/* 11241 */ {20,184},
+/* 11242 */ {20,184},
+/* 11243 */ {20,184},
+/* 11244 */ {20,184},
+/* 11245 */ {20,184},
+/* 11246 */ {20,184},
+/* 11247 */ {20,184},
+/* 11248 */ {20,184},
+/* 11249 */ {20,184},
+/* 11250 */ {20,184},
+/* 11251 */ {20,184},
+/* 11252 */ {20,184},
+/* 11253 */ {20,184},
+/* 11254 */ {20,184},
+/* 11255 */ {20,184},
+/* 11256 */ {20,184},
+/* 11257 */ {20,184},
+/* 11258 */ {20,184},
+/* 11259 */ {20,184},
+/* 11260 */ {20,184},
+/* 11261 */ {20,184},
+/* 11262 */ {20,184},
+/* 11263 */ {20,184},
+/* 11264 */ {20,194},
+/* 11265 */ {20,194},
+/* 11266 */ {20,194},
+/* 11267 */ {20,194},
+/* 11268 */ {20,194},
+/* 11269 */ {20,194},
+/* 11270 */ {20,194},
+/* 11271 */ {20,194},
+/* 11272 */ {20,194},
+/* 11273 */ {20,194},
+/* 11274 */ {20,194},
+/* 11275 */ {20,194},
+/* 11276 */ {20,194},
+/* 11277 */ {20,194},
+/* 11278 */ {20,194},
+/* 11279 */ {20,194},
+/* 11280 */ {20,194},
+/* 11281 */ {20,194},
+/* 11282 */ {20,194},
+/* 11283 */ {20,194},
+/* 11284 */ {20,194},
+/* 11285 */ {20,194},
+/* 11286 */ {20,194},
+/* 11287 */ {20,194},
+/* 11288 */ {20,194},
+/* 11289 */ {20,194},
+/* 11290 */ {20,194},
+/* 11291 */ {20,194},
+/* 11292 */ {20,194},
+/* 11293 */ {20,194},
+/* 11294 */ {20,194},
+/* 11295 */ {20,194},
+/* 11296 */ {20,194},
+/* 11297 */ {20,194},
+/* 11298 */ {20,194},
+/* 11299 */ {20,194},
+/* 11300 */ {20,194},
+/* 11301 */ {20,194},
+/* 11302 */ {20,194},
+/* 11303 */ {20,194},
+/* 11304 */ {20,194},
+/* 11305 */ {20,194},
+/* 11306 */ {20,194},
+/* 11307 */ {20,194},
+/* 11308 */ {20,194},
+/* 11309 */ {20,194},
+/* 11310 */ {20,194},
+/* 11311 */ {20,194},
+/* 11312 */ {20,194},
+/* 11313 */ {20,194},
+/* 11314 */ {20,194},
+/* 11315 */ {20,194},
+/* 11316 */ {20,194},
+/* 11317 */ {20,194},
+/* 11318 */ {20,194},
+/* 11319 */ {20,194},
+/* 11320 */ {20,194},
+/* 11321 */ {20,194},
+/* 11322 */ {20,194},
+/* 11323 */ {20,194},
+/* 11324 */ {20,194},
+/* 11325 */ {20,194},
+/* 11326 */ {20,194},
+/* 11327 */ {20,194},
+/* 11328 */ {20,194},
+/* 11329 */ {20,194},
+/* 11330 */ {20,194},
+/* 11331 */ {20,194},
+/* 11332 */ {20,194},
+/* 11333 */ {20,194},
+/* 11334 */ {20,194},
+/* 11335 */ {20,194},
+/* 11336 */ {20,194},
+/* 11337 */ {20,194},
+/* 11338 */ {20,194},
+/* 11339 */ {20,194},
+/* 11340 */ {20,194},
+/* 11341 */ {20,194},
+/* 11342 */ {20,194},
+/* 11343 */ {20,194},
+/* 11344 */ {20,194},
+/* 11345 */ {20,194},
+/* 11346 */ {20,194},
+/* 11347 */ {20,194},
+/* 11348 */ {20,194},
+/* 11349 */ {20,194},
+/* 11350 */ {20,194},
+/* 11351 */ {20,194},
+/* 11352 */ {20,194},
+/* 11353 */ {20,194},
+/* 11354 */ {20,194},
+/* 11355 */ {20,194},
+/* 11356 */ {20,194},
+/* 11357 */ {20,194},
+/* 11358 */ {20,194},
+/* 11359 */ {20,194},
+/* 11360 */ {20,194},
+/* 11361 */ {20,194},
+/* 11362 */ {20,194},
+/* 11363 */ {20,194},
+/* 11364 */ {20,194},
+/* 11365 */ {20,194},
+/* 11366 */ {20,194},
+/* 11367 */ {20,194},
+/* 11368 */ {20,194},
+/* 11369 */ {20,194},
+/* 11370 */ {20,194},
+/* 11371 */ {20,194},
+/* 11372 */ {20,194},
+/* 11373 */ {20,194},
+/* 11374 */ {20,194},
+/* 11375 */ {20,194},
+/* 11376 */ {20,194},
+/* 11377 */ {20,194},
+/* 11378 */ {20,194},
+/* 11379 */ {20,194},
+/* 11380 */ {20,194},
+/* 11381 */ {20,194},
+/* 11382 */ {20,194},
+/* 11383 */ {20,194},
+/* 11384 */ {20,194},
+/* 11385 */ {20,194},
+/* 11386 */ {20,194},
+/* 11387 */ {20,194},
+/* 11388 */ {20,194},
+/* 11389 */ {20,194},
+/* 11390 */ {20,194},
+/* 11391 */ {20,194},
+/* 11392 */ {20,194},
+/* 11393 */ {20,194},
+/* 11394 */ {20,194},
+/* 11395 */ {20,194},
+/* 11396 */ {20,194},
+/* 11397 */ {20,194},
+/* 11398 */ {20,194},
+/* 11399 */ {20,194},
+/* 11400 */ {20,194},
+/* 11401 */ {20,194},
+/* 11402 */ {20,194},
+/* 11403 */ {20,194},
+/* 11404 */ {20,194},
+/* 11405 */ {20,194},
+/* 11406 */ {20,194},
+/* 11407 */ {20,194},
+/* 11408 */ {20,194},
+/* 11409 */ {20,194},
+/* 11410 */ {20,194},
+/* 11411 */ {20,194},
+/* 11412 */ {20,194},
+/* 11413 */ {20,194},
+/* 11414 */ {20,194},
+/* 11415 */ {20,194},
+/* 11416 */ {20,194},
+/* 11417 */ {20,194},
+/* 11418 */ {20,194},
+/* 11419 */ {20,194},
+/* 11420 */ {20,194},
+/* 11421 */ {20,194},
+/* 11422 */ {20,194},
+/* 11423 */ {20,194},
+/* 11424 */ {20,194},
+/* 11425 */ {20,194},
+/* 11426 */ {20,194},
+/* 11427 */ {20,194},
+/* 11428 */ {20,194},
+/* 11429 */ {20,194},
+/* 11430 */ {20,194},
+/* 11431 */ {20,194},
+/* 11432 */ {20,194},
+/* 11433 */ {20,194},
+/* 11434 */ {20,194},
+/* 11435 */ {20,194},
+/* 11436 */ {20,194},
+/* 11437 */ {20,194},
+/* 11438 */ {20,194},
+/* 11439 */ {20,194},
+/* 11440 */ {20,194},
+/* 11441 */ {20,194},
+/* 11442 */ {20,194},
+/* 11443 */ {20,194},
+/* 11444 */ {20,194},
+/* 11445 */ {20,194},
+/* 11446 */ {20,194},
+/* 11447 */ {20,194},
+/* 11448 */ {20,194},
+/* 11449 */ {20,194},
+/* 11450 */ {20,194},
+/* 11451 */ {20,194},
+/* 11452 */ {20,194},
+/* 11453 */ {20,194},
+/* 11454 */ {20,194},
+/* 11455 */ {20,194},
+/* 11456 */ {20,194},
+/* 11457 */ {20,194},
+/* 11458 */ {20,194},
+/* 11459 */ {20,194},
+/* 11460 */ {20,194},
+/* 11461 */ {20,194},
+/* 11462 */ {20,194},
+/* 11463 */ {20,194},
+/* 11464 */ {20,194},
+/* 11465 */ {20,194},
+/* 11466 */ {20,194},
+/* 11467 */ {20,194},
+/* 11468 */ {20,194},
+/* 11469 */ {20,194},
+/* 11470 */ {20,194},
+/* 11471 */ {20,194},
+/* 11472 */ {20,194},
+/* 11473 */ {20,194},
+/* 11474 */ {20,194},
+/* 11475 */ {20,194},
+/* 11476 */ {20,194},
+/* 11477 */ {20,194},
+/* 11478 */ {20,194},
+/* 11479 */ {20,194},
+/* 11480 */ {20,194},
+/* 11481 */ {20,194},
+/* 11482 */ {20,194},
+/* 11483 */ {20,194},
+/* 11484 */ {20,194},
+/* 11485 */ {20,194},
+/* 11486 */ {20,194},
+/* 11487 */ {20,194},
+/* 11488 */ {20,194},
+/* 11489 */ {20,194},
+/* 11490 */ {20,194},
+/* 11491 */ {20,194},
+/* 11492 */ {20,194},
+/* 11493 */ {20,194},
+/* 11494 */ {20,194},
+/* 11495 */ {20,194},
+/* 11496 */ {20,194},
+/* 11497 */ {20,194},
+/* 11498 */ {20,194},
+/* 11499 */ {20,194},
+/* 11500 */ {20,194},
+/* 11501 */ {20,194},
+/* 11502 */ {20,194},
+/* 11503 */ {20,194},
+/* 11504 */ {20,194},
+/* 11505 */ {20,194},
+/* 11506 */ {20,194},
+/* 11507 */ {20,194},
+/* 11508 */ {20,194},
+/* 11509 */ {20,194},
+/* 11510 */ {20,194},
+/* 11511 */ {20,194},
+/* 11512 */ {20,194},
+/* 11513 */ {20,194},
+/* 11514 */ {20,194},
+/* 11515 */ {20,194},
+/* 11516 */ {20,194},
+/* 11517 */ {20,194},
+/* 11518 */ {20,194},
+/* 11519 */ {20,194},
+/* 11520 */ {20,194},
+/* 11521 */ {20,194},
+/* 11522 */ {20,194},
+/* 11523 */ {20,194},
+/* 11524 */ {20,194},
+/* 11525 */ {20,194},
+/* 11526 */ {20,194},
+/* 11527 */ {20,194},
+/* 11528 */ {20,194},
+/* 11529 */ {20,194},
+/* 11530 */ {20,194},
+/* 11531 */ {20,194},
+/* 11532 */ {20,194},
+/* 11533 */ {20,194},
+/* 11534 */ {20,194},
+/* 11535 */ {20,194},
+/* 11536 */ {20,194},
+/* 11537 */ {20,194},
+/* 11538 */ {20,194},
+/* 11539 */ {20,194},
+/* 11540 */ {20,194},
+/* 11541 */ {20,194},
+/* 11542 */ {20,194},
+/* 11543 */ {20,194},
+/* 11544 */ {20,194},
+/* 11545 */ {20,194},
+/* 11546 */ {20,194},
+/* 11547 */ {20,194},
+/* 11548 */ {20,194},
+/* 11549 */ {20,194},
+/* 11550 */ {20,194},
+/* 11551 */ {20,194},
+/* 11552 */ {20,194},
+/* 11553 */ {20,194},
+/* 11554 */ {20,194},
+/* 11555 */ {20,194},
+/* 11556 */ {20,194},
+/* 11557 */ {20,194},
+/* 11558 */ {20,194},
+/* 11559 */ {20,194},
+/* 11560 */ {20,194},
+/* 11561 */ {20,194},
+/* 11562 */ {20,194},
+/* 11563 */ {20,194},
+/* 11564 */ {20,194},
+/* 11565 */ {20,194},
+/* 11566 */ {20,194},
+/* 11567 */ {20,194},
+/* 11568 */ {20,194},
+/* 11569 */ {20,194},
+/* 11570 */ {20,194},
+/* 11571 */ {20,194},
+/* 11572 */ {20,194},
+/* 11573 */ {20,194},
+/* 11574 */ {20,194},
+/* 11575 */ {20,194},
+/* 11576 */ {20,194},
+/* 11577 */ {20,194},
+/* 11578 */ {20,194},
+/* 11579 */ {20,194},
+/* 11580 */ {20,194},
+/* 11581 */ {20,194},
+/* 11582 */ {20,194},
+/* 11583 */ {20,194},
+/* 11584 */ {20,194},
+/* 11585 */ {20,194},
+/* 11586 */ {20,194},
+/* 11587 */ {20,194},
+/* 11588 */ {20,194},
+/* 11589 */ {20,194},
+/* 11590 */ {20,194},
+/* 11591 */ {20,194},
+/* 11592 */ {20,194},
+/* 11593 */ {20,194},
+/* 11594 */ {20,194},
+/* 11595 */ {20,194},
+/* 11596 */ {20,194},
+/* 11597 */ {20,194},
+/* 11598 */ {20,194},
+/* 11599 */ {20,194},
+/* 11600 */ {20,194},
+/* 11601 */ {20,194},
+/* 11602 */ {20,194},
+/* 11603 */ {20,194},
+/* 11604 */ {20,194},
+/* 11605 */ {20,194},
+/* 11606 */ {20,194},
+/* 11607 */ {20,194},
+/* 11608 */ {20,194},
+/* 11609 */ {20,194},
+/* 11610 */ {20,194},
+/* 11611 */ {20,194},
+/* 11612 */ {20,194},
+/* 11613 */ {20,194},
+/* 11614 */ {20,194},
+/* 11615 */ {20,194},
+/* 11616 */ {20,194},
+/* 11617 */ {20,194},
+/* 11618 */ {20,194},
+/* 11619 */ {20,194},
+/* 11620 */ {20,194},
+/* 11621 */ {20,194},
+/* 11622 */ {20,194},
+/* 11623 */ {20,194},
+/* 11624 */ {20,194},
+/* 11625 */ {20,194},
+/* 11626 */ {20,194},
+/* 11627 */ {20,194},
+/* 11628 */ {20,194},
+/* 11629 */ {20,194},
+/* 11630 */ {20,194},
+/* 11631 */ {20,194},
+/* 11632 */ {20,194},
+/* 11633 */ {20,194},
+/* 11634 */ {20,194},
+/* 11635 */ {20,194},
+/* 11636 */ {20,194},
+/* 11637 */ {20,194},
+/* 11638 */ {20,194},
+/* 11639 */ {20,194},
+/* 11640 */ {20,194},
+/* 11641 */ {20,194},
+/* 11642 */ {20,194},
+/* 11643 */ {20,194},
+/* 11644 */ {20,194},
+/* 11645 */ {20,194},
+/* 11646 */ {20,194},
+/* 11647 */ {20,194},
+/* 11648 */ {20,194},
+/* 11649 */ {20,194},
+/* 11650 */ {20,194},
+/* 11651 */ {20,194},
+/* 11652 */ {20,194},
+/* 11653 */ {20,194},
+/* 11654 */ {20,194},
+/* 11655 */ {20,194},
+/* 11656 */ {20,194},
+/* 11657 */ {20,194},
+/* 11658 */ {20,194},
+/* 11659 */ {20,194},
+/* 11660 */ {20,194},
+/* 11661 */ {20,194},
+/* 11662 */ {20,194},
+/* 11663 */ {20,194},
+/* 11664 */ {20,194},
+/* 11665 */ {20,194},
+/* 11666 */ {20,194},
+/* 11667 */ {20,194},
+/* 11668 */ {20,194},
+/* 11669 */ {20,194},
+/* 11670 */ {20,194},
+/* 11671 */ {20,194},
+/* 11672 */ {20,194},
+/* 11673 */ {20,194},
+/* 11674 */ {20,194},
+/* 11675 */ {20,194},
+/* 11676 */ {20,194},
+/* 11677 */ {20,194},
+/* 11678 */ {20,194},
+/* 11679 */ {20,194},
+/* 11680 */ {20,194},
+/* 11681 */ {20,194},
+/* 11682 */ {20,194},
+/* 11683 */ {20,194},
+/* 11684 */ {20,194},
+/* 11685 */ {20,194},
+/* 11686 */ {20,194},
+/* 11687 */ {20,194},
+/* 11688 */ {20,194},
+/* 11689 */ {20,194},
+/* 11690 */ {20,194},
+/* 11691 */ {20,194},
+/* 11692 */ {20,194},
+/* 11693 */ {20,194},
+/* 11694 */ {20,194},
+/* 11695 */ {20,194},
+/* 11696 */ {20,194},
+/* 11697 */ {20,194},
+/* 11698 */ {20,194},
+/* 11699 */ {20,194},
+/* 11700 */ {20,194},
+/* 11701 */ {20,194},
+/* 11702 */ {20,194},
+/* 11703 */ {20,194},
+/* 11704 */ {20,194},
+/* 11705 */ {20,194},
+/* 11706 */ {20,194},
+/* 11707 */ {20,194},
+/* 11708 */ {20,194},
+/* 11709 */ {20,194},
+/* 11710 */ {20,194},
+/* 11711 */ {20,194},
+/* 11712 */ {20,194},
+/* 11713 */ {20,194},
+/* 11714 */ {20,194},
+/* 11715 */ {20,194},
+/* 11716 */ {20,194},
+/* 11717 */ {20,194},
+/* 11718 */ {20,194},
+/* 11719 */ {20,194},
+/* 11720 */ {20,194},
+/* 11721 */ {20,194},
+/* 11722 */ {20,194},
+/* 11723 */ {20,194},
+/* 11724 */ {20,194},
+/* 11725 */ {20,194},
+/* 11726 */ {20,194},
+/* 11727 */ {20,194},
+/* 11728 */ {20,194},
+/* 11729 */ {20,194},
+/* 11730 */ {20,194},
+/* 11731 */ {20,194},
+/* 11732 */ {20,194},
+/* 11733 */ {20,194},
+/* 11734 */ {20,194},
+/* 11735 */ {20,194},
+/* 11736 */ {20,194},
+/* 11737 */ {20,194},
+/* 11738 */ {20,194},
+/* 11739 */ {20,194},
+/* 11740 */ {20,194},
+/* 11741 */ {20,194},
+/* 11742 */ {20,194},
+/* 11743 */ {20,194},
+/* 11744 */ {20,194},
+/* 11745 */ {20,194},
+/* 11746 */ {20,194},
+/* 11747 */ {20,194},
+/* 11748 */ {20,194},
+/* 11749 */ {20,194},
+/* 11750 */ {20,194},
+/* 11751 */ {20,194},
+/* 11752 */ {20,194},
+/* 11753 */ {20,194},
+/* 11754 */ {20,194},
+/* 11755 */ {20,194},
+/* 11756 */ {20,194},
+/* 11757 */ {20,194},
+/* 11758 */ {20,194},
+/* 11759 */ {20,194},
+/* 11760 */ {20,194},
+/* 11761 */ {20,194},
+/* 11762 */ {20,194},
+/* 11763 */ {20,194},
+/* 11764 */ {20,194},
+/* 11765 */ {20,194},
+/* 11766 */ {20,194},
+/* 11767 */ {20,194},
+/* 11768 */ {20,194},
+/* 11769 */ {20,194},
+/* 11770 */ {20,194},
+/* 11771 */ {20,194},
+/* 11772 */ {20,194},
+/* 11773 */ {20,194},
+/* 11774 */ {20,194},
+/* 11775 */ {20,194},
+/* 11776 */ {20,194},
+/* 11777 */ {20,194},
+/* 11778 */ {20,194},
+/* 11779 */ {20,194},
+/* 11780 */ {20,194},
+/* 11781 */ {20,194},
+/* 11782 */ {20,194},
+/* 11783 */ {20,194},
+/* 11784 */ {20,194},
+/* 11785 */ {20,194},
+/* 11786 */ {20,194},
+/* 11787 */ {20,194},
+/* 11788 */ {20,194},
+/* 11789 */ {20,194},
+/* 11790 */ {20,194},
+/* 11791 */ {20,194},
+/* 11792 */ {20,194},
+/* 11793 */ {20,194},
+/* 11794 */ {20,194},
+/* 11795 */ {20,194},
+/* 11796 */ {20,194},
+/* 11797 */ {20,194},
+/* 11798 */ {20,194},
+/* 11799 */ {20,194},
+/* 11800 */ {20,194},
+/* 11801 */ {20,194},
+/* 11802 */ {20,194},
+/* 11803 */ {20,194},
+/* 11804 */ {20,194},
+/* 11805 */ {20,194},
+/* 11806 */ {20,194},
+/* 11807 */ {20,194},
+/* 11808 */ {20,194},
+/* 11809 */ {20,194},
+/* 11810 */ {20,194},
+/* 11811 */ {20,194},
+/* 11812 */ {20,194},
+/* 11813 */ {20,194},
+/* 11814 */ {20,194},
+/* 11815 */ {20,194},
+/* 11816 */ {20,194},
+/* 11817 */ {20,194},
+/* 11818 */ {20,194},
+/* 11819 */ {20,194},
+/* 11820 */ {20,194},
+/* 11821 */ {20,194},
+/* 11822 */ {20,194},
+/* 11823 */ {20,194},
+/* 11824 */ {20,194},
+/* 11825 */ {20,194},
+/* 11826 */ {20,194},
+/* 11827 */ {20,194},
+/* 11828 */ {20,194},
+/* 11829 */ {20,194},
+/* 11830 */ {20,194},
+/* 11831 */ {20,194},
+/* 11832 */ {20,194},
+/* 11833 */ {20,194},
+/* 11834 */ {20,194},
+/* 11835 */ {20,194},
+/* 11836 */ {20,194},
+/* 11837 */ {20,194},
+/* 11838 */ {20,194},
+/* 11839 */ {20,194},
+/* 11840 */ {20,194},
+/* 11841 */ {20,194},
+/* 11842 */ {20,194},
+/* 11843 */ {20,194},
+/* 11844 */ {20,194},
+/* 11845 */ {20,194},
+/* 11846 */ {20,194},
+/* 11847 */ {20,194},
+/* 11848 */ {20,194},
+/* 11849 */ {20,194},
+/* 11850 */ {20,194},
+/* 11851 */ {20,194},
+/* 11852 */ {20,194},
+/* 11853 */ {20,194},
+/* 11854 */ {20,194},
+/* 11855 */ {20,194},
+/* 11856 */ {20,194},
+/* 11857 */ {20,194},
+/* 11858 */ {20,194},
+/* 11859 */ {20,194},
+/* 11860 */ {20,194},
+/* 11861 */ {20,194},
+/* 11862 */ {20,194},
+/* 11863 */ {20,194},
+/* 11864 */ {20,194},
+/* 11865 */ {20,194},
+/* 11866 */ {20,194},
+/* 11867 */ {20,194},
+/* 11868 */ {20,194},
+/* 11869 */ {20,194},
+/* 11870 */ {20,194},
+/* 11871 */ {20,194},
+/* 11872 */ {20,194},
+/* 11873 */ {20,194},
+/* 11874 */ {20,194},
+/* 11875 */ {20,194},
+/* 11876 */ {20,194},
+/* 11877 */ {20,194},
+/* 11878 */ {20,194},
+/* 11879 */ {20,194},
+/* 11880 */ {20,194},
+/* 11881 */ {20,194},
+/* 11882 */ {20,194},
+/* 11883 */ {20,194},
+/* 11884 */ {20,194},
+/* 11885 */ {20,194},
+/* 11886 */ {20,194},
+/* 11887 */ {20,194},
+/* 11888 */ {20,194},
+/* 11889 */ {20,194},
+/* 11890 */ {20,194},
+/* 11891 */ {20,194},
+/* 11892 */ {20,194},
+/* 11893 */ {20,194},
+/* 11894 */ {20,194},
+/* 11895 */ {20,194},
+/* 11896 */ {20,194},
+/* 11897 */ {20,194},
+/* 11898 */ {20,194},
+/* 11899 */ {20,194},
+/* 11900 */ {20,194},
+/* 11901 */ {20,194},
+/* 11902 */ {20,194},
+/* 11903 */ {20,194},
+/* 11904 */ {20,194},
+/* 11905 */ {20,194},
+/* 11906 */ {20,194},
+/* 11907 */ {20,194},
+/* 11908 */ {20,194},
+/* 11909 */ {20,194},
+/* 11910 */ {20,194},
+/* 11911 */ {20,194},
+/* 11912 */ {20,194},
+/* 11913 */ {20,194},
+/* 11914 */ {20,194},
+/* 11915 */ {20,194},
+/* 11916 */ {20,194},
+/* 11917 */ {20,194},
+/* 11918 */ {20,194},
+/* 11919 */ {20,194},
+/* 11920 */ {20,194},
+/* 11921 */ {20,194},
+/* 11922 */ {20,194},
+/* 11923 */ {20,194},
+/* 11924 */ {20,194},
+/* 11925 */ {20,194},
+/* 11926 */ {20,194},
+/* 11927 */ {20,194},
+/* 11928 */ {20,194},
+/* 11929 */ {20,194},
+/* 11930 */ {20,194},
+/* 11931 */ {20,194},
+/* 11932 */ {20,194},
+/* 11933 */ {20,194},
+/* 11934 */ {20,194},
+/* 11935 */ {20,194},
+/* 11936 */ {20,194},
+/* 11937 */ {20,194},
+/* 11938 */ {20,194},
+/* 11939 */ {20,194},
+/* 11940 */ {20,194},
+/* 11941 */ {20,194},
+/* 11942 */ {20,194},
+/* 11943 */ {20,194},
+/* 11944 */ {20,194},
+/* 11945 */ {20,194},
+/* 11946 */ {20,194},
+/* 11947 */ {20,194},
+/* 11948 */ {20,194},
+/* 11949 */ {20,194},
+/* 11950 */ {20,194},
+/* 11951 */ {20,194},
+/* 11952 */ {20,194},
+/* 11953 */ {20,194},
+/* 11954 */ {20,194},
+/* 11955 */ {20,194},
+/* 11956 */ {20,194},
+/* 11957 */ {20,194},
+/* 11958 */ {20,194},
+/* 11959 */ {20,194},
+/* 11960 */ {20,194},
+/* 11961 */ {20,194},
+/* 11962 */ {20,194},
+/* 11963 */ {20,194},
+/* 11964 */ {20,194},
+/* 11965 */ {20,194},
+/* 11966 */ {20,194},
+/* 11967 */ {20,194},
+/* 11968 */ {20,194},
+/* 11969 */ {20,194},
+/* 11970 */ {20,194},
+/* 11971 */ {20,194},
+/* 11972 */ {20,194},
+/* 11973 */ {20,194},
+/* 11974 */ {20,194},
+/* 11975 */ {20,194},
+/* 11976 */ {20,194},
+/* 11977 */ {20,194},
+/* 11978 */ {20,194},
+/* 11979 */ {20,194},
+/* 11980 */ {20,194},
+/* 11981 */ {20,194},
+/* 11982 */ {20,194},
+/* 11983 */ {20,194},
+/* 11984 */ {20,194},
+/* 11985 */ {20,194},
+/* 11986 */ {20,194},
+/* 11987 */ {20,194},
+/* 11988 */ {20,194},
+/* 11989 */ {20,194},
+/* 11990 */ {20,194},
+/* 11991 */ {20,194},
+/* 11992 */ {20,194},
+/* 11993 */ {20,194},
+/* 11994 */ {20,194},
+/* 11995 */ {20,194},
+/* 11996 */ {20,194},
+/* 11997 */ {20,194},
+/* 11998 */ {20,194},
+/* 11999 */ {20,194},
+/* 12000 */ {20,194},
+/* 12001 */ {20,194},
+/* 12002 */ {20,194},
+/* 12003 */ {20,194},
+/* 12004 */ {20,194},
+/* 12005 */ {20,194},
+/* 12006 */ {20,194},
+/* 12007 */ {20,194},
+/* 12008 */ {20,194},
+/* 12009 */ {20,194},
+/* 12010 */ {20,194},
+/* 12011 */ {20,194},
+/* 12012 */ {20,194},
+/* 12013 */ {20,194},
+/* 12014 */ {20,194},
+/* 12015 */ {20,194},
+/* 12016 */ {20,194},
+/* 12017 */ {20,194},
+/* 12018 */ {20,194},
+/* 12019 */ {20,194},
+/* 12020 */ {20,194},
+/* 12021 */ {20,194},
+/* 12022 */ {20,194},
+/* 12023 */ {20,194},
+/* 12024 */ {20,194},
+/* 12025 */ {20,194},
+/* 12026 */ {20,194},
+/* 12027 */ {20,194},
+/* 12028 */ {20,194},
+/* 12029 */ {20,194},
+/* 12030 */ {20,194},
+/* 12031 */ {20,194},
+/* 12032 */ {20,194},
+/* 12033 */ {20,194},
+/* 12034 */ {20,194},
+/* 12035 */ {20,194},
+/* 12036 */ {20,194},
+/* 12037 */ {20,194},
+/* 12038 */ {20,194},
+/* 12039 */ {20,194},
+/* 12040 */ {20,194},
+/* 12041 */ {20,194},
+/* 12042 */ {20,194},
+/* 12043 */ {20,194},
+/* 12044 */ {20,194},
+/* 12045 */ {20,194},
+/* 12046 */ {20,194},
+/* 12047 */ {20,194},
+/* 12048 */ {20,194},
+/* 12049 */ {20,194},
+/* 12050 */ {20,194},
+/* 12051 */ {20,194},
+/* 12052 */ {20,194},
+/* 12053 */ {20,194},
+/* 12054 */ {20,194},
+/* 12055 */ {20,194},
+/* 12056 */ {20,194},
+/* 12057 */ {20,194},
+/* 12058 */ {20,194},
+/* 12059 */ {20,194},
+/* 12060 */ {20,194},
+/* 12061 */ {20,194},
+/* 12062 */ {20,194},
+/* 12063 */ {20,194},
+/* 12064 */ {20,194},
+/* 12065 */ {20,194},
+/* 12066 */ {20,194},
+/* 12067 */ {20,194},
+/* 12068 */ {20,194},
+/* 12069 */ {20,194},
+/* 12070 */ {20,194},
+/* 12071 */ {20,194},
+/* 12072 */ {20,194},
+/* 12073 */ {20,194},
+/* 12074 */ {20,194},
+/* 12075 */ {20,194},
+/* 12076 */ {20,194},
+/* 12077 */ {20,194},
+/* 12078 */ {20,194},
+/* 12079 */ {20,194},
+/* 12080 */ {20,194},
+/* 12081 */ {20,194},
+/* 12082 */ {20,194},
+/* 12083 */ {20,194},
+/* 12084 */ {20,194},
+/* 12085 */ {20,194},
+/* 12086 */ {20,194},
+/* 12087 */ {20,194},
+/* 12088 */ {20,194},
+/* 12089 */ {20,194},
+/* 12090 */ {20,194},
+/* 12091 */ {20,194},
+/* 12092 */ {20,194},
+/* 12093 */ {20,194},
+/* 12094 */ {20,194},
+/* 12095 */ {20,194},
+/* 12096 */ {20,194},
+/* 12097 */ {20,194},
+/* 12098 */ {20,194},
+/* 12099 */ {20,194},
+/* 12100 */ {20,194},
+/* 12101 */ {20,194},
+/* 12102 */ {20,194},
+/* 12103 */ {20,194},
+/* 12104 */ {20,194},
+/* 12105 */ {20,194},
+/* 12106 */ {20,194},
+/* 12107 */ {20,194},
+/* 12108 */ {20,194},
+/* 12109 */ {20,194},
+/* 12110 */ {20,194},
+/* 12111 */ {20,194},
+/* 12112 */ {20,194},
+/* 12113 */ {20,194},
+/* 12114 */ {20,194},
+/* 12115 */ {20,194},
+/* 12116 */ {20,194},
+/* 12117 */ {20,194},
+/* 12118 */ {20,194},
+/* 12119 */ {20,194},
+/* 12120 */ {20,194},
+/* 12121 */ {20,194},
+/* 12122 */ {20,194},
+/* 12123 */ {20,194},
+/* 12124 */ {20,194},
+/* 12125 */ {20,194},
+/* 12126 */ {20,194},
+/* 12127 */ {20,194},
+/* 12128 */ {20,194},
+/* 12129 */ {20,194},
+/* 12130 */ {20,194},
+/* 12131 */ {20,194},
+/* 12132 */ {20,194},
+/* 12133 */ {20,194},
+/* 12134 */ {20,194},
+/* 12135 */ {20,194},
+/* 12136 */ {20,194},
+/* 12137 */ {20,194},
+/* 12138 */ {20,194},
+/* 12139 */ {20,194},
+/* 12140 */ {20,194},
+/* 12141 */ {20,194},
+/* 12142 */ {20,194},
+/* 12143 */ {20,194},
+/* 12144 */ {20,194},
+/* 12145 */ {20,194},
+/* 12146 */ {20,194},
+/* 12147 */ {20,194},
+/* 12148 */ {20,194},
+/* 12149 */ {20,194},
+/* 12150 */ {20,194},
+/* 12151 */ {20,194},
+/* 12152 */ {20,194},
+/* 12153 */ {20,194},
+/* 12154 */ {20,194},
+/* 12155 */ {20,194},
+/* 12156 */ {20,194},
+/* 12157 */ {20,194},
+/* 12158 */ {20,194},
+/* 12159 */ {20,194},
+/* 12160 */ {20,194},
+/* 12161 */ {20,194},
+/* 12162 */ {20,194},
+/* 12163 */ {20,194},
+/* 12164 */ {20,194},
+/* 12165 */ {20,194},
+/* 12166 */ {20,194},
+/* 12167 */ {20,194},
+/* 12168 */ {20,194},
+/* 12169 */ {20,194},
+/* 12170 */ {20,194},
+/* 12171 */ {20,194},
+/* 12172 */ {20,194},
+/* 12173 */ {20,194},
+/* 12174 */ {20,194},
+/* 12175 */ {20,194},
+/* 12176 */ {20,194},
+/* 12177 */ {20,194},
+/* 12178 */ {20,194},
+/* 12179 */ {20,194},
+/* 12180 */ {20,194},
+/* 12181 */ {20,194},
+/* 12182 */ {20,194},
+/* 12183 */ {20,194},
+/* 12184 */ {20,194},
+/* 12185 */ {20,194},
+/* 12186 */ {20,194},
+/* 12187 */ {20,194},
+/* 12188 */ {20,194},
+/* 12189 */ {20,194},
+/* 12190 */ {20,194},
+/* 12191 */ {20,194},
+/* 12192 */ {20,194},
+/* 12193 */ {20,194},
+/* 12194 */ {20,194},
+/* 12195 */ {20,194},
+/* 12196 */ {20,194},
+/* 12197 */ {20,194},
+/* 12198 */ {20,194},
+/* 12199 */ {20,194},
+/* 12200 */ {20,194},
+/* 12201 */ {20,194},
+/* 12202 */ {20,194},
+/* 12203 */ {20,194},
+/* 12204 */ {20,194},
+/* 12205 */ {20,194},
+/* 12206 */ {20,194},
+/* 12207 */ {20,194},
+/* 12208 */ {20,194},
+/* 12209 */ {20,194},
+/* 12210 */ {20,194},
+/* 12211 */ {20,194},
+/* 12212 */ {20,194},
+/* 12213 */ {20,194},
+/* 12214 */ {20,194},
+/* 12215 */ {20,194},
+/* 12216 */ {20,194},
+/* 12217 */ {20,194},
+/* 12218 */ {20,194},
+/* 12219 */ {20,194},
+/* 12220 */ {20,194},
+/* 12221 */ {20,194},
+/* 12222 */ {20,194},
+/* 12223 */ {20,194},
+/* 12224 */ {20,194},
+/* 12225 */ {20,194},
+/* 12226 */ {20,194},
+/* 12227 */ {20,194},
+/* 12228 */ {20,194},
+/* 12229 */ {20,194},
+/* 12230 */ {20,194},
+/* 12231 */ {20,194},
+/* 12232 */ {20,194},
+/* 12233 */ {20,194},
+/* 12234 */ {20,194},
+/* 12235 */ {20,194},
+/* 12236 */ {20,194},
+/* 12237 */ {20,194},
+/* 12238 */ {20,194},
+/* 12239 */ {20,194},
+/* 12240 */ {20,194},
+/* 12241 */ {20,194},
+/* 12242 */ {20,194},
+/* 12243 */ {20,194},
+/* 12244 */ {20,194},
+/* 12245 */ {20,194},
+/* 12246 */ {20,194},
+/* 12247 */ {20,194},
+/* 12248 */ {20,194},
+/* 12249 */ {20,194},
+/* 12250 */ {20,194},
+/* 12251 */ {20,194},
+/* 12252 */ {20,194},
+/* 12253 */ {20,194},
+/* 12254 */ {20,194},
+/* 12255 */ {20,194},
+/* 12256 */ {20,194},
+/* 12257 */ {20,194},
+/* 12258 */ {20,194},
+/* 12259 */ {20,194},
+/* 12260 */ {20,194},
+/* 12261 */ {20,194},
+/* 12262 */ {20,194},
+/* 12263 */ {20,194},
+/* 12264 */ {20,194},
+/* 12265 */ {20,194},
+/* 12266 */ {20,194},
+/* 12267 */ {20,194},
+/* 12268 */ {20,194},
+/* 12269 */ {20,194},
+/* 12270 */ {20,194},
+/* 12271 */ {20,194},
+/* 12272 */ {20,194},
+/* 12273 */ {20,194},
+/* 12274 */ {20,194},
+/* 12275 */ {20,194},
+/* 12276 */ {20,194},
+/* 12277 */ {20,194},
+/* 12278 */ {20,194},
+/* 12279 */ {20,194},
+/* 12280 */ {20,194},
+/* 12281 */ {20,194},
+/* 12282 */ {20,194},
+/* 12283 */ {20,194},
+/* 12284 */ {20,194},
+/* 12285 */ {20,194},
+/* 12286 */ {20,194},
+/* 12287 */ {20,194},
+/* 12288 */ {20,224},
+/* 12289 */ {20,224},
+/* 12290 */ {20,224},
+/* 12291 */ {20,224},
+/* 12292 */ {20,224},
+/* 12293 */ {20,224},
+/* 12294 */ {20,224},
+/* 12295 */ {20,224},
+/* 12296 */ {20,224},
+/* 12297 */ {20,224},
+/* 12298 */ {20,224},
+/* 12299 */ {20,224},
+/* 12300 */ {20,224},
+/* 12301 */ {20,224},
+/* 12302 */ {20,224},
+/* 12303 */ {20,224},
+/* 12304 */ {20,224},
+/* 12305 */ {20,224},
+/* 12306 */ {20,224},
+/* 12307 */ {20,224},
+/* 12308 */ {20,224},
+/* 12309 */ {20,224},
+/* 12310 */ {20,224},
+/* 12311 */ {20,224},
+/* 12312 */ {20,224},
+/* 12313 */ {20,224},
+/* 12314 */ {20,224},
+/* 12315 */ {20,224},
+/* 12316 */ {20,224},
+/* 12317 */ {20,224},
+/* 12318 */ {20,224},
+/* 12319 */ {20,224},
+/* 12320 */ {20,224},
+/* 12321 */ {20,224},
+/* 12322 */ {20,224},
+/* 12323 */ {20,224},
+/* 12324 */ {20,224},
+/* 12325 */ {20,224},
+/* 12326 */ {20,224},
+/* 12327 */ {20,224},
+/* 12328 */ {20,224},
+/* 12329 */ {20,224},
+/* 12330 */ {20,224},
+/* 12331 */ {20,224},
+/* 12332 */ {20,224},
+/* 12333 */ {20,224},
+/* 12334 */ {20,224},
+/* 12335 */ {20,224},
+/* 12336 */ {20,224},
+/* 12337 */ {20,224},
+/* 12338 */ {20,224},
+/* 12339 */ {20,224},
+/* 12340 */ {20,224},
+/* 12341 */ {20,224},
+/* 12342 */ {20,224},
+/* 12343 */ {20,224},
+/* 12344 */ {20,224},
+/* 12345 */ {20,224},
+/* 12346 */ {20,224},
+/* 12347 */ {20,224},
+/* 12348 */ {20,224},
+/* 12349 */ {20,224},
+/* 12350 */ {20,224},
+/* 12351 */ {20,224},
+/* 12352 */ {20,224},
+/* 12353 */ {20,224},
+/* 12354 */ {20,224},
+/* 12355 */ {20,224},
+/* 12356 */ {20,224},
+/* 12357 */ {20,224},
+/* 12358 */ {20,224},
+/* 12359 */ {20,224},
+/* 12360 */ {20,224},
+/* 12361 */ {20,224},
+/* 12362 */ {20,224},
+/* 12363 */ {20,224},
+/* 12364 */ {20,224},
+/* 12365 */ {20,224},
+/* 12366 */ {20,224},
+/* 12367 */ {20,224},
+/* 12368 */ {20,224},
+/* 12369 */ {20,224},
+/* 12370 */ {20,224},
+/* 12371 */ {20,224},
+/* 12372 */ {20,224},
+/* 12373 */ {20,224},
+/* 12374 */ {20,224},
+/* 12375 */ {20,224},
+/* 12376 */ {20,224},
+/* 12377 */ {20,224},
+/* 12378 */ {20,224},
+/* 12379 */ {20,224},
+/* 12380 */ {20,224},
+/* 12381 */ {20,224},
+/* 12382 */ {20,224},
+/* 12383 */ {20,224},
+/* 12384 */ {20,224},
+/* 12385 */ {20,224},
+/* 12386 */ {20,224},
+/* 12387 */ {20,224},
+/* 12388 */ {20,224},
+/* 12389 */ {20,224},
+/* 12390 */ {20,224},
+/* 12391 */ {20,224},
+/* 12392 */ {20,224},
+/* 12393 */ {20,224},
+/* 12394 */ {20,224},
+/* 12395 */ {20,224},
+/* 12396 */ {20,224},
+/* 12397 */ {20,224},
+/* 12398 */ {20,224},
+/* 12399 */ {20,224},
+/* 12400 */ {20,224},
+/* 12401 */ {20,224},
+/* 12402 */ {20,224},
+/* 12403 */ {20,224},
+/* 12404 */ {20,224},
+/* 12405 */ {20,224},
+/* 12406 */ {20,224},
+/* 12407 */ {20,224},
+/* 12408 */ {20,224},
+/* 12409 */ {20,224},
+/* 12410 */ {20,224},
+/* 12411 */ {20,224},
+/* 12412 */ {20,224},
+/* 12413 */ {20,224},
+/* 12414 */ {20,224},
+/* 12415 */ {20,224},
+/* 12416 */ {20,224},
+/* 12417 */ {20,224},
+/* 12418 */ {20,224},
+/* 12419 */ {20,224},
+/* 12420 */ {20,224},
+/* 12421 */ {20,224},
+/* 12422 */ {20,224},
+/* 12423 */ {20,224},
+/* 12424 */ {20,224},
+/* 12425 */ {20,224},
+/* 12426 */ {20,224},
+/* 12427 */ {20,224},
+/* 12428 */ {20,224},
+/* 12429 */ {20,224},
+/* 12430 */ {20,224},
+/* 12431 */ {20,224},
+/* 12432 */ {20,224},
+/* 12433 */ {20,224},
+/* 12434 */ {20,224},
+/* 12435 */ {20,224},
+/* 12436 */ {20,224},
+/* 12437 */ {20,224},
+/* 12438 */ {20,224},
+/* 12439 */ {20,224},
+/* 12440 */ {20,224},
+/* 12441 */ {20,224},
+/* 12442 */ {20,224},
+/* 12443 */ {20,224},
+/* 12444 */ {20,224},
+/* 12445 */ {20,224},
+/* 12446 */ {20,224},
+/* 12447 */ {20,224},
+/* 12448 */ {20,224},
+/* 12449 */ {20,224},
+/* 12450 */ {20,224},
+/* 12451 */ {20,224},
+/* 12452 */ {20,224},
+/* 12453 */ {20,224},
+/* 12454 */ {20,224},
+/* 12455 */ {20,224},
+/* 12456 */ {20,224},
+/* 12457 */ {20,224},
+/* 12458 */ {20,224},
+/* 12459 */ {20,224},
+/* 12460 */ {20,224},
+/* 12461 */ {20,224},
+/* 12462 */ {20,224},
+/* 12463 */ {20,224},
+/* 12464 */ {20,224},
+/* 12465 */ {20,224},
+/* 12466 */ {20,224},
+/* 12467 */ {20,224},
+/* 12468 */ {20,224},
+/* 12469 */ {20,224},
+/* 12470 */ {20,224},
+/* 12471 */ {20,224},
+/* 12472 */ {20,224},
+/* 12473 */ {20,224},
+/* 12474 */ {20,224},
+/* 12475 */ {20,224},
+/* 12476 */ {20,224},
+/* 12477 */ {20,224},
+/* 12478 */ {20,224},
+/* 12479 */ {20,224},
+/* 12480 */ {20,224},
+/* 12481 */ {20,224},
+/* 12482 */ {20,224},
+/* 12483 */ {20,224},
+/* 12484 */ {20,224},
+/* 12485 */ {20,224},
+/* 12486 */ {20,224},
+/* 12487 */ {20,224},
+/* 12488 */ {20,224},
+/* 12489 */ {20,224},
+/* 12490 */ {20,224},
+/* 12491 */ {20,224},
+/* 12492 */ {20,224},
+/* 12493 */ {20,224},
+/* 12494 */ {20,224},
+/* 12495 */ {20,224},
+/* 12496 */ {20,224},
+/* 12497 */ {20,224},
+/* 12498 */ {20,224},
+/* 12499 */ {20,224},
+/* 12500 */ {20,224},
+/* 12501 */ {20,224},
+/* 12502 */ {20,224},
+/* 12503 */ {20,224},
+/* 12504 */ {20,224},
+/* 12505 */ {20,224},
+/* 12506 */ {20,224},
+/* 12507 */ {20,224},
+/* 12508 */ {20,224},
+/* 12509 */ {20,224},
+/* 12510 */ {20,224},
+/* 12511 */ {20,224},
+/* 12512 */ {20,224},
+/* 12513 */ {20,224},
+/* 12514 */ {20,224},
+/* 12515 */ {20,224},
+/* 12516 */ {20,224},
+/* 12517 */ {20,224},
+/* 12518 */ {20,224},
+/* 12519 */ {20,224},
+/* 12520 */ {20,224},
+/* 12521 */ {20,224},
+/* 12522 */ {20,224},
+/* 12523 */ {20,224},
+/* 12524 */ {20,224},
+/* 12525 */ {20,224},
+/* 12526 */ {20,224},
+/* 12527 */ {20,224},
+/* 12528 */ {20,224},
+/* 12529 */ {20,224},
+/* 12530 */ {20,224},
+/* 12531 */ {20,224},
+/* 12532 */ {20,224},
+/* 12533 */ {20,224},
+/* 12534 */ {20,224},
+/* 12535 */ {20,224},
+/* 12536 */ {20,224},
+/* 12537 */ {20,224},
+/* 12538 */ {20,224},
+/* 12539 */ {20,224},
+/* 12540 */ {20,224},
+/* 12541 */ {20,224},
+/* 12542 */ {20,224},
+/* 12543 */ {20,224},
+/* 12544 */ {20,224},
+/* 12545 */ {20,224},
+/* 12546 */ {20,224},
+/* 12547 */ {20,224},
+/* 12548 */ {20,224},
+/* 12549 */ {20,224},
+/* 12550 */ {20,224},
+/* 12551 */ {20,224},
+/* 12552 */ {20,224},
+/* 12553 */ {20,224},
+/* 12554 */ {20,224},
+/* 12555 */ {20,224},
+/* 12556 */ {20,224},
+/* 12557 */ {20,224},
+/* 12558 */ {20,224},
+/* 12559 */ {20,224},
+/* 12560 */ {20,224},
+/* 12561 */ {20,224},
+/* 12562 */ {20,224},
+/* 12563 */ {20,224},
+/* 12564 */ {20,224},
+/* 12565 */ {20,224},
+/* 12566 */ {20,224},
+/* 12567 */ {20,224},
+/* 12568 */ {20,224},
+/* 12569 */ {20,224},
+/* 12570 */ {20,224},
+/* 12571 */ {20,224},
+/* 12572 */ {20,224},
+/* 12573 */ {20,224},
+/* 12574 */ {20,224},
+/* 12575 */ {20,224},
+/* 12576 */ {20,224},
+/* 12577 */ {20,224},
+/* 12578 */ {20,224},
+/* 12579 */ {20,224},
+/* 12580 */ {20,224},
+/* 12581 */ {20,224},
+/* 12582 */ {20,224},
+/* 12583 */ {20,224},
+/* 12584 */ {20,224},
+/* 12585 */ {20,224},
+/* 12586 */ {20,224},
+/* 12587 */ {20,224},
+/* 12588 */ {20,224},
+/* 12589 */ {20,224},
+/* 12590 */ {20,224},
+/* 12591 */ {20,224},
+/* 12592 */ {20,224},
+/* 12593 */ {20,224},
+/* 12594 */ {20,224},
+/* 12595 */ {20,224},
+/* 12596 */ {20,224},
+/* 12597 */ {20,224},
+/* 12598 */ {20,224},
+/* 12599 */ {20,224},
+/* 12600 */ {20,224},
+/* 12601 */ {20,224},
+/* 12602 */ {20,224},
+/* 12603 */ {20,224},
+/* 12604 */ {20,224},
+/* 12605 */ {20,224},
+/* 12606 */ {20,224},
+/* 12607 */ {20,224},
+/* 12608 */ {20,224},
+/* 12609 */ {20,224},
+/* 12610 */ {20,224},
+/* 12611 */ {20,224},
+/* 12612 */ {20,224},
+/* 12613 */ {20,224},
+/* 12614 */ {20,224},
+/* 12615 */ {20,224},
+/* 12616 */ {20,224},
+/* 12617 */ {20,224},
+/* 12618 */ {20,224},
+/* 12619 */ {20,224},
+/* 12620 */ {20,224},
+/* 12621 */ {20,224},
+/* 12622 */ {20,224},
+/* 12623 */ {20,224},
+/* 12624 */ {20,224},
+/* 12625 */ {20,224},
+/* 12626 */ {20,224},
+/* 12627 */ {20,224},
+/* 12628 */ {20,224},
+/* 12629 */ {20,224},
+/* 12630 */ {20,224},
+/* 12631 */ {20,224},
+/* 12632 */ {20,224},
+/* 12633 */ {20,224},
+/* 12634 */ {20,224},
+/* 12635 */ {20,224},
+/* 12636 */ {20,224},
+/* 12637 */ {20,224},
+/* 12638 */ {20,224},
+/* 12639 */ {20,224},
+/* 12640 */ {20,224},
+/* 12641 */ {20,224},
+/* 12642 */ {20,224},
+/* 12643 */ {20,224},
+/* 12644 */ {20,224},
+/* 12645 */ {20,224},
+/* 12646 */ {20,224},
+/* 12647 */ {20,224},
+/* 12648 */ {20,224},
+/* 12649 */ {20,224},
+/* 12650 */ {20,224},
+/* 12651 */ {20,224},
+/* 12652 */ {20,224},
+/* 12653 */ {20,224},
+/* 12654 */ {20,224},
+/* 12655 */ {20,224},
+/* 12656 */ {20,224},
+/* 12657 */ {20,224},
+/* 12658 */ {20,224},
+/* 12659 */ {20,224},
+/* 12660 */ {20,224},
+/* 12661 */ {20,224},
+/* 12662 */ {20,224},
+/* 12663 */ {20,224},
+/* 12664 */ {20,224},
+/* 12665 */ {20,224},
+/* 12666 */ {20,224},
+/* 12667 */ {20,224},
+/* 12668 */ {20,224},
+/* 12669 */ {20,224},
+/* 12670 */ {20,224},
+/* 12671 */ {20,224},
+/* 12672 */ {20,224},
+/* 12673 */ {20,224},
+/* 12674 */ {20,224},
+/* 12675 */ {20,224},
+/* 12676 */ {20,224},
+/* 12677 */ {20,224},
+/* 12678 */ {20,224},
+/* 12679 */ {20,224},
+/* 12680 */ {20,224},
+/* 12681 */ {20,224},
+/* 12682 */ {20,224},
+/* 12683 */ {20,224},
+/* 12684 */ {20,224},
+/* 12685 */ {20,224},
+/* 12686 */ {20,224},
+/* 12687 */ {20,224},
+/* 12688 */ {20,224},
+/* 12689 */ {20,224},
+/* 12690 */ {20,224},
+/* 12691 */ {20,224},
+/* 12692 */ {20,224},
+/* 12693 */ {20,224},
+/* 12694 */ {20,224},
+/* 12695 */ {20,224},
+/* 12696 */ {20,224},
+/* 12697 */ {20,224},
+/* 12698 */ {20,224},
+/* 12699 */ {20,224},
+/* 12700 */ {20,224},
+/* 12701 */ {20,224},
+/* 12702 */ {20,224},
+/* 12703 */ {20,224},
+/* 12704 */ {20,224},
+/* 12705 */ {20,224},
+/* 12706 */ {20,224},
+/* 12707 */ {20,224},
+/* 12708 */ {20,224},
+/* 12709 */ {20,224},
+/* 12710 */ {20,224},
+/* 12711 */ {20,224},
+/* 12712 */ {20,224},
+/* 12713 */ {20,224},
+/* 12714 */ {20,224},
+/* 12715 */ {20,224},
+/* 12716 */ {20,224},
+/* 12717 */ {20,224},
+/* 12718 */ {20,224},
+/* 12719 */ {20,224},
+/* 12720 */ {20,224},
+/* 12721 */ {20,224},
+/* 12722 */ {20,224},
+/* 12723 */ {20,224},
+/* 12724 */ {20,224},
+/* 12725 */ {20,224},
+/* 12726 */ {20,224},
+/* 12727 */ {20,224},
+/* 12728 */ {20,224},
+/* 12729 */ {20,224},
+/* 12730 */ {20,224},
+/* 12731 */ {20,224},
+/* 12732 */ {20,224},
+/* 12733 */ {20,224},
+/* 12734 */ {20,224},
+/* 12735 */ {20,224},
+/* 12736 */ {20,224},
+/* 12737 */ {20,224},
+/* 12738 */ {20,224},
+/* 12739 */ {20,224},
+/* 12740 */ {20,224},
+/* 12741 */ {20,224},
+/* 12742 */ {20,224},
+/* 12743 */ {20,224},
+/* 12744 */ {20,224},
+/* 12745 */ {20,224},
+/* 12746 */ {20,224},
+/* 12747 */ {20,224},
+/* 12748 */ {20,224},
+/* 12749 */ {20,224},
+/* 12750 */ {20,224},
+/* 12751 */ {20,224},
+/* 12752 */ {20,224},
+/* 12753 */ {20,224},
+/* 12754 */ {20,224},
+/* 12755 */ {20,224},
+/* 12756 */ {20,224},
+/* 12757 */ {20,224},
+/* 12758 */ {20,224},
+/* 12759 */ {20,224},
+/* 12760 */ {20,224},
+/* 12761 */ {20,224},
+/* 12762 */ {20,224},
+/* 12763 */ {20,224},
+/* 12764 */ {20,224},
+/* 12765 */ {20,224},
+/* 12766 */ {20,224},
+/* 12767 */ {20,224},
+/* 12768 */ {20,224},
+/* 12769 */ {20,224},
+/* 12770 */ {20,224},
+/* 12771 */ {20,224},
+/* 12772 */ {20,224},
+/* 12773 */ {20,224},
+/* 12774 */ {20,224},
+/* 12775 */ {20,224},
+/* 12776 */ {20,224},
+/* 12777 */ {20,224},
+/* 12778 */ {20,224},
+/* 12779 */ {20,224},
+/* 12780 */ {20,224},
+/* 12781 */ {20,224},
+/* 12782 */ {20,224},
+/* 12783 */ {20,224},
+/* 12784 */ {20,224},
+/* 12785 */ {20,224},
+/* 12786 */ {20,224},
+/* 12787 */ {20,224},
+/* 12788 */ {20,224},
+/* 12789 */ {20,224},
+/* 12790 */ {20,224},
+/* 12791 */ {20,224},
+/* 12792 */ {20,224},
+/* 12793 */ {20,224},
+/* 12794 */ {20,224},
+/* 12795 */ {20,224},
+/* 12796 */ {20,224},
+/* 12797 */ {20,224},
+/* 12798 */ {20,224},
+/* 12799 */ {20,224},
+/* 12800 */ {20,224},
+/* 12801 */ {20,224},
+/* 12802 */ {20,224},
+/* 12803 */ {20,224},
+/* 12804 */ {20,224},
+/* 12805 */ {20,224},
+/* 12806 */ {20,224},
+/* 12807 */ {20,224},
+/* 12808 */ {20,224},
+/* 12809 */ {20,224},
+/* 12810 */ {20,224},
+/* 12811 */ {20,224},
+/* 12812 */ {20,224},
+/* 12813 */ {20,224},
+/* 12814 */ {20,224},
+/* 12815 */ {20,224},
+/* 12816 */ {20,224},
+/* 12817 */ {20,224},
+/* 12818 */ {20,224},
+/* 12819 */ {20,224},
+/* 12820 */ {20,224},
+/* 12821 */ {20,224},
+/* 12822 */ {20,224},
+/* 12823 */ {20,224},
+/* 12824 */ {20,224},
+/* 12825 */ {20,224},
+/* 12826 */ {20,224},
+/* 12827 */ {20,224},
+/* 12828 */ {20,224},
+/* 12829 */ {20,224},
+/* 12830 */ {20,224},
+/* 12831 */ {20,224},
+/* 12832 */ {20,224},
+/* 12833 */ {20,224},
+/* 12834 */ {20,224},
+/* 12835 */ {20,224},
+/* 12836 */ {20,224},
+/* 12837 */ {20,224},
+/* 12838 */ {20,224},
+/* 12839 */ {20,224},
+/* 12840 */ {20,224},
+/* 12841 */ {20,224},
+/* 12842 */ {20,224},
+/* 12843 */ {20,224},
+/* 12844 */ {20,224},
+/* 12845 */ {20,224},
+/* 12846 */ {20,224},
+/* 12847 */ {20,224},
+/* 12848 */ {20,224},
+/* 12849 */ {20,224},
+/* 12850 */ {20,224},
+/* 12851 */ {20,224},
+/* 12852 */ {20,224},
+/* 12853 */ {20,224},
+/* 12854 */ {20,224},
+/* 12855 */ {20,224},
+/* 12856 */ {20,224},
+/* 12857 */ {20,224},
+/* 12858 */ {20,224},
+/* 12859 */ {20,224},
+/* 12860 */ {20,224},
+/* 12861 */ {20,224},
+/* 12862 */ {20,224},
+/* 12863 */ {20,224},
+/* 12864 */ {20,224},
+/* 12865 */ {20,224},
+/* 12866 */ {20,224},
+/* 12867 */ {20,224},
+/* 12868 */ {20,224},
+/* 12869 */ {20,224},
+/* 12870 */ {20,224},
+/* 12871 */ {20,224},
+/* 12872 */ {20,224},
+/* 12873 */ {20,224},
+/* 12874 */ {20,224},
+/* 12875 */ {20,224},
+/* 12876 */ {20,224},
+/* 12877 */ {20,224},
+/* 12878 */ {20,224},
+/* 12879 */ {20,224},
+/* 12880 */ {20,224},
+/* 12881 */ {20,224},
+/* 12882 */ {20,224},
+/* 12883 */ {20,224},
+/* 12884 */ {20,224},
+/* 12885 */ {20,224},
+/* 12886 */ {20,224},
+/* 12887 */ {20,224},
+/* 12888 */ {20,224},
+/* 12889 */ {20,224},
+/* 12890 */ {20,224},
+/* 12891 */ {20,224},
+/* 12892 */ {20,224},
+/* 12893 */ {20,224},
+/* 12894 */ {20,224},
+/* 12895 */ {20,224},
+/* 12896 */ {20,224},
+/* 12897 */ {20,224},
+/* 12898 */ {20,224},
+/* 12899 */ {20,224},
+/* 12900 */ {20,224},
+/* 12901 */ {20,224},
+/* 12902 */ {20,224},
+/* 12903 */ {20,224},
+/* 12904 */ {20,224},
+/* 12905 */ {20,224},
+/* 12906 */ {20,224},
+/* 12907 */ {20,224},
+/* 12908 */ {20,224},
+/* 12909 */ {20,224},
+/* 12910 */ {20,224},
+/* 12911 */ {20,224},
+/* 12912 */ {20,224},
+/* 12913 */ {20,224},
+/* 12914 */ {20,224},
+/* 12915 */ {20,224},
+/* 12916 */ {20,224},
+/* 12917 */ {20,224},
+/* 12918 */ {20,224},
+/* 12919 */ {20,224},
+/* 12920 */ {20,224},
+/* 12921 */ {20,224},
+/* 12922 */ {20,224},
+/* 12923 */ {20,224},
+/* 12924 */ {20,224},
+/* 12925 */ {20,224},
+/* 12926 */ {20,224},
+/* 12927 */ {20,224},
+/* 12928 */ {20,224},
+/* 12929 */ {20,224},
+/* 12930 */ {20,224},
+/* 12931 */ {20,224},
+/* 12932 */ {20,224},
+/* 12933 */ {20,224},
+/* 12934 */ {20,224},
+/* 12935 */ {20,224},
+/* 12936 */ {20,224},
+/* 12937 */ {20,224},
+/* 12938 */ {20,224},
+/* 12939 */ {20,224},
+/* 12940 */ {20,224},
+/* 12941 */ {20,224},
+/* 12942 */ {20,224},
+/* 12943 */ {20,224},
+/* 12944 */ {20,224},
+/* 12945 */ {20,224},
+/* 12946 */ {20,224},
+/* 12947 */ {20,224},
+/* 12948 */ {20,224},
+/* 12949 */ {20,224},
+/* 12950 */ {20,224},
+/* 12951 */ {20,224},
+/* 12952 */ {20,224},
+/* 12953 */ {20,224},
+/* 12954 */ {20,224},
+/* 12955 */ {20,224},
+/* 12956 */ {20,224},
+/* 12957 */ {20,224},
+/* 12958 */ {20,224},
+/* 12959 */ {20,224},
+/* 12960 */ {20,224},
+/* 12961 */ {20,224},
+/* 12962 */ {20,224},
+/* 12963 */ {20,224},
+/* 12964 */ {20,224},
+/* 12965 */ {20,224},
+/* 12966 */ {20,224},
+/* 12967 */ {20,224},
+/* 12968 */ {20,224},
+/* 12969 */ {20,224},
+/* 12970 */ {20,224},
+/* 12971 */ {20,224},
+/* 12972 */ {20,224},
+/* 12973 */ {20,224},
+/* 12974 */ {20,224},
+/* 12975 */ {20,224},
+/* 12976 */ {20,224},
+/* 12977 */ {20,224},
+/* 12978 */ {20,224},
+/* 12979 */ {20,224},
+/* 12980 */ {20,224},
+/* 12981 */ {20,224},
+/* 12982 */ {20,224},
+/* 12983 */ {20,224},
+/* 12984 */ {20,224},
+/* 12985 */ {20,224},
+/* 12986 */ {20,224},
+/* 12987 */ {20,224},
+/* 12988 */ {20,224},
+/* 12989 */ {20,224},
+/* 12990 */ {20,224},
+/* 12991 */ {20,224},
+/* 12992 */ {20,224},
+/* 12993 */ {20,224},
+/* 12994 */ {20,224},
+/* 12995 */ {20,224},
+/* 12996 */ {20,224},
+/* 12997 */ {20,224},
+/* 12998 */ {20,224},
+/* 12999 */ {20,224},
+/* 13000 */ {20,224},
+/* 13001 */ {20,224},
+/* 13002 */ {20,224},
+/* 13003 */ {20,224},
+/* 13004 */ {20,224},
+/* 13005 */ {20,224},
+/* 13006 */ {20,224},
+/* 13007 */ {20,224},
+/* 13008 */ {20,224},
+/* 13009 */ {20,224},
+/* 13010 */ {20,224},
+/* 13011 */ {20,224},
+/* 13012 */ {20,224},
+/* 13013 */ {20,224},
+/* 13014 */ {20,224},
+/* 13015 */ {20,224},
+/* 13016 */ {20,224},
+/* 13017 */ {20,224},
+/* 13018 */ {20,224},
+/* 13019 */ {20,224},
+/* 13020 */ {20,224},
+/* 13021 */ {20,224},
+/* 13022 */ {20,224},
+/* 13023 */ {20,224},
+/* 13024 */ {20,224},
+/* 13025 */ {20,224},
+/* 13026 */ {20,224},
+/* 13027 */ {20,224},
+/* 13028 */ {20,224},
+/* 13029 */ {20,224},
+/* 13030 */ {20,224},
+/* 13031 */ {20,224},
+/* 13032 */ {20,224},
+/* 13033 */ {20,224},
+/* 13034 */ {20,224},
+/* 13035 */ {20,224},
+/* 13036 */ {20,224},
+/* 13037 */ {20,224},
+/* 13038 */ {20,224},
+/* 13039 */ {20,224},
+/* 13040 */ {20,224},
+/* 13041 */ {20,224},
+/* 13042 */ {20,224},
+/* 13043 */ {20,224},
+/* 13044 */ {20,224},
+/* 13045 */ {20,224},
+/* 13046 */ {20,224},
+/* 13047 */ {20,224},
+/* 13048 */ {20,224},
+/* 13049 */ {20,224},
+/* 13050 */ {20,224},
+/* 13051 */ {20,224},
+/* 13052 */ {20,224},
+/* 13053 */ {20,224},
+/* 13054 */ {20,224},
+/* 13055 */ {20,224},
+/* 13056 */ {20,224},
+/* 13057 */ {20,224},
+/* 13058 */ {20,224},
+/* 13059 */ {20,224},
+/* 13060 */ {20,224},
+/* 13061 */ {20,224},
+/* 13062 */ {20,224},
+/* 13063 */ {20,224},
+/* 13064 */ {20,224},
+/* 13065 */ {20,224},
+/* 13066 */ {20,224},
+/* 13067 */ {20,224},
+/* 13068 */ {20,224},
+/* 13069 */ {20,224},
+/* 13070 */ {20,224},
+/* 13071 */ {20,224},
+/* 13072 */ {20,224},
+/* 13073 */ {20,224},
+/* 13074 */ {20,224},
+/* 13075 */ {20,224},
+/* 13076 */ {20,224},
+/* 13077 */ {20,224},
+/* 13078 */ {20,224},
+/* 13079 */ {20,224},
+/* 13080 */ {20,224},
+/* 13081 */ {20,224},
+/* 13082 */ {20,224},
+/* 13083 */ {20,224},
+/* 13084 */ {20,224},
+/* 13085 */ {20,224},
+/* 13086 */ {20,224},
+/* 13087 */ {20,224},
+/* 13088 */ {20,224},
+/* 13089 */ {20,224},
+/* 13090 */ {20,224},
+/* 13091 */ {20,224},
+/* 13092 */ {20,224},
+/* 13093 */ {20,224},
+/* 13094 */ {20,224},
+/* 13095 */ {20,224},
+/* 13096 */ {20,224},
+/* 13097 */ {20,224},
+/* 13098 */ {20,224},
+/* 13099 */ {20,224},
+/* 13100 */ {20,224},
+/* 13101 */ {20,224},
+/* 13102 */ {20,224},
+/* 13103 */ {20,224},
+/* 13104 */ {20,224},
+/* 13105 */ {20,224},
+/* 13106 */ {20,224},
+/* 13107 */ {20,224},
+/* 13108 */ {20,224},
+/* 13109 */ {20,224},
+/* 13110 */ {20,224},
+/* 13111 */ {20,224},
+/* 13112 */ {20,224},
+/* 13113 */ {20,224},
+/* 13114 */ {20,224},
+/* 13115 */ {20,224},
+/* 13116 */ {20,224},
+/* 13117 */ {20,224},
+/* 13118 */ {20,224},
+/* 13119 */ {20,224},
+/* 13120 */ {20,224},
+/* 13121 */ {20,224},
+/* 13122 */ {20,224},
+/* 13123 */ {20,224},
+/* 13124 */ {20,224},
+/* 13125 */ {20,224},
+/* 13126 */ {20,224},
+/* 13127 */ {20,224},
+/* 13128 */ {20,224},
+/* 13129 */ {20,224},
+/* 13130 */ {20,224},
+/* 13131 */ {20,224},
+/* 13132 */ {20,224},
+/* 13133 */ {20,224},
+/* 13134 */ {20,224},
+/* 13135 */ {20,224},
+/* 13136 */ {20,224},
+/* 13137 */ {20,224},
+/* 13138 */ {20,224},
+/* 13139 */ {20,224},
+/* 13140 */ {20,224},
+/* 13141 */ {20,224},
+/* 13142 */ {20,224},
+/* 13143 */ {20,224},
+/* 13144 */ {20,224},
+/* 13145 */ {20,224},
+/* 13146 */ {20,224},
+/* 13147 */ {20,224},
+/* 13148 */ {20,224},
+/* 13149 */ {20,224},
+/* 13150 */ {20,224},
+/* 13151 */ {20,224},
+/* 13152 */ {20,224},
+/* 13153 */ {20,224},
+/* 13154 */ {20,224},
+/* 13155 */ {20,224},
+/* 13156 */ {20,224},
+/* 13157 */ {20,224},
+/* 13158 */ {20,224},
+/* 13159 */ {20,224},
+/* 13160 */ {20,224},
+/* 13161 */ {20,224},
+/* 13162 */ {20,224},
+/* 13163 */ {20,224},
+/* 13164 */ {20,224},
+/* 13165 */ {20,224},
+/* 13166 */ {20,224},
+/* 13167 */ {20,224},
+/* 13168 */ {20,224},
+/* 13169 */ {20,224},
+/* 13170 */ {20,224},
+/* 13171 */ {20,224},
+/* 13172 */ {20,224},
+/* 13173 */ {20,224},
+/* 13174 */ {20,224},
+/* 13175 */ {20,224},
+/* 13176 */ {20,224},
+/* 13177 */ {20,224},
+/* 13178 */ {20,224},
+/* 13179 */ {20,224},
+/* 13180 */ {20,224},
+/* 13181 */ {20,224},
+/* 13182 */ {20,224},
+/* 13183 */ {20,224},
+/* 13184 */ {20,224},
+/* 13185 */ {20,224},
+/* 13186 */ {20,224},
+/* 13187 */ {20,224},
+/* 13188 */ {20,224},
+/* 13189 */ {20,224},
+/* 13190 */ {20,224},
+/* 13191 */ {20,224},
+/* 13192 */ {20,224},
+/* 13193 */ {20,224},
+/* 13194 */ {20,224},
+/* 13195 */ {20,224},
+/* 13196 */ {20,224},
+/* 13197 */ {20,224},
+/* 13198 */ {20,224},
+/* 13199 */ {20,224},
+/* 13200 */ {20,224},
+/* 13201 */ {20,224},
+/* 13202 */ {20,224},
+/* 13203 */ {20,224},
+/* 13204 */ {20,224},
+/* 13205 */ {20,224},
+/* 13206 */ {20,224},
+/* 13207 */ {20,224},
+/* 13208 */ {20,224},
+/* 13209 */ {20,224},
+/* 13210 */ {20,224},
+/* 13211 */ {20,224},
+/* 13212 */ {20,224},
+/* 13213 */ {20,224},
+/* 13214 */ {20,224},
+/* 13215 */ {20,224},
+/* 13216 */ {20,224},
+/* 13217 */ {20,224},
+/* 13218 */ {20,224},
+/* 13219 */ {20,224},
+/* 13220 */ {20,224},
+/* 13221 */ {20,224},
+/* 13222 */ {20,224},
+/* 13223 */ {20,224},
+/* 13224 */ {20,224},
+/* 13225 */ {20,224},
+/* 13226 */ {20,224},
+/* 13227 */ {20,224},
+/* 13228 */ {20,224},
+/* 13229 */ {20,224},
+/* 13230 */ {20,224},
+/* 13231 */ {20,224},
+/* 13232 */ {20,224},
+/* 13233 */ {20,224},
+/* 13234 */ {20,224},
+/* 13235 */ {20,224},
+/* 13236 */ {20,224},
+/* 13237 */ {20,224},
+/* 13238 */ {20,224},
+/* 13239 */ {20,224},
+/* 13240 */ {20,224},
+/* 13241 */ {20,224},
+/* 13242 */ {20,224},
+/* 13243 */ {20,224},
+/* 13244 */ {20,224},
+/* 13245 */ {20,224},
+/* 13246 */ {20,224},
+/* 13247 */ {20,224},
+/* 13248 */ {20,224},
+/* 13249 */ {20,224},
+/* 13250 */ {20,224},
+/* 13251 */ {20,224},
+/* 13252 */ {20,224},
+/* 13253 */ {20,224},
+/* 13254 */ {20,224},
+/* 13255 */ {20,224},
+/* 13256 */ {20,224},
+/* 13257 */ {20,224},
+/* 13258 */ {20,224},
+/* 13259 */ {20,224},
+/* 13260 */ {20,224},
+/* 13261 */ {20,224},
+/* 13262 */ {20,224},
+/* 13263 */ {20,224},
+/* 13264 */ {20,224},
+/* 13265 */ {20,224},
+/* 13266 */ {20,224},
+/* 13267 */ {20,224},
+/* 13268 */ {20,224},
+/* 13269 */ {20,224},
+/* 13270 */ {20,224},
+/* 13271 */ {20,224},
+/* 13272 */ {20,224},
+/* 13273 */ {20,224},
+/* 13274 */ {20,224},
+/* 13275 */ {20,224},
+/* 13276 */ {20,224},
+/* 13277 */ {20,224},
+/* 13278 */ {20,224},
+/* 13279 */ {20,224},
+/* 13280 */ {20,224},
+/* 13281 */ {20,224},
+/* 13282 */ {20,224},
+/* 13283 */ {20,224},
+/* 13284 */ {20,224},
+/* 13285 */ {20,224},
+/* 13286 */ {20,224},
+/* 13287 */ {20,224},
+/* 13288 */ {20,224},
+/* 13289 */ {20,224},
+/* 13290 */ {20,224},
+/* 13291 */ {20,224},
+/* 13292 */ {20,224},
+/* 13293 */ {20,224},
+/* 13294 */ {20,224},
+/* 13295 */ {20,224},
+/* 13296 */ {20,224},
+/* 13297 */ {20,224},
+/* 13298 */ {20,224},
+/* 13299 */ {20,224},
+/* 13300 */ {20,224},
+/* 13301 */ {20,224},
+/* 13302 */ {20,224},
+/* 13303 */ {20,224},
+/* 13304 */ {20,224},
+/* 13305 */ {20,224},
+/* 13306 */ {20,224},
+/* 13307 */ {20,224},
+/* 13308 */ {20,224},
+/* 13309 */ {20,224},
+/* 13310 */ {20,224},
+/* 13311 */ {20,224},
+/* 13312 */ {20,226},
+/* 13313 */ {20,226},
+/* 13314 */ {20,226},
+/* 13315 */ {20,226},
+/* 13316 */ {20,226},
+/* 13317 */ {20,226},
+/* 13318 */ {20,226},
+/* 13319 */ {20,226},
+/* 13320 */ {20,226},
+/* 13321 */ {20,226},
+/* 13322 */ {20,226},
+/* 13323 */ {20,226},
+/* 13324 */ {20,226},
+/* 13325 */ {20,226},
+/* 13326 */ {20,226},
+/* 13327 */ {20,226},
+/* 13328 */ {20,226},
+/* 13329 */ {20,226},
+/* 13330 */ {20,226},
+/* 13331 */ {20,226},
+/* 13332 */ {20,226},
+/* 13333 */ {20,226},
+/* 13334 */ {20,226},
+/* 13335 */ {20,226},
+/* 13336 */ {20,226},
+/* 13337 */ {20,226},
+/* 13338 */ {20,226},
+/* 13339 */ {20,226},
+/* 13340 */ {20,226},
+/* 13341 */ {20,226},
+/* 13342 */ {20,226},
+/* 13343 */ {20,226},
+/* 13344 */ {20,226},
+/* 13345 */ {20,226},
+/* 13346 */ {20,226},
+/* 13347 */ {20,226},
+/* 13348 */ {20,226},
+/* 13349 */ {20,226},
+/* 13350 */ {20,226},
+/* 13351 */ {20,226},
+/* 13352 */ {20,226},
+/* 13353 */ {20,226},
+/* 13354 */ {20,226},
+/* 13355 */ {20,226},
+/* 13356 */ {20,226},
+/* 13357 */ {20,226},
+/* 13358 */ {20,226},
+/* 13359 */ {20,226},
+/* 13360 */ {20,226},
+/* 13361 */ {20,226},
+/* 13362 */ {20,226},
+/* 13363 */ {20,226},
+/* 13364 */ {20,226},
+/* 13365 */ {20,226},
+/* 13366 */ {20,226},
+/* 13367 */ {20,226},
+/* 13368 */ {20,226},
+/* 13369 */ {20,226},
+/* 13370 */ {20,226},
+/* 13371 */ {20,226},
+/* 13372 */ {20,226},
+/* 13373 */ {20,226},
+/* 13374 */ {20,226},
+/* 13375 */ {20,226},
+/* 13376 */ {20,226},
+/* 13377 */ {20,226},
+/* 13378 */ {20,226},
+/* 13379 */ {20,226},
+/* 13380 */ {20,226},
+/* 13381 */ {20,226},
+/* 13382 */ {20,226},
+/* 13383 */ {20,226},
+/* 13384 */ {20,226},
+/* 13385 */ {20,226},
+/* 13386 */ {20,226},
+/* 13387 */ {20,226},
+/* 13388 */ {20,226},
+/* 13389 */ {20,226},
+/* 13390 */ {20,226},
+/* 13391 */ {20,226},
+/* 13392 */ {20,226},
+/* 13393 */ {20,226},
+/* 13394 */ {20,226},
+/* 13395 */ {20,226},
+/* 13396 */ {20,226},
+/* 13397 */ {20,226},
+/* 13398 */ {20,226},
+/* 13399 */ {20,226},
+/* 13400 */ {20,226},
+/* 13401 */ {20,226},
+/* 13402 */ {20,226},
+/* 13403 */ {20,226},
+/* 13404 */ {20,226},
+/* 13405 */ {20,226},
+/* 13406 */ {20,226},
+/* 13407 */ {20,226},
+/* 13408 */ {20,226},
+/* 13409 */ {20,226},
+/* 13410 */ {20,226},
+/* 13411 */ {20,226},
+/* 13412 */ {20,226},
+/* 13413 */ {20,226},
+/* 13414 */ {20,226},
+/* 13415 */ {20,226},
+/* 13416 */ {20,226},
+/* 13417 */ {20,226},
+/* 13418 */ {20,226},
+/* 13419 */ {20,226},
+/* 13420 */ {20,226},
+/* 13421 */ {20,226},
+/* 13422 */ {20,226},
+/* 13423 */ {20,226},
+/* 13424 */ {20,226},
+/* 13425 */ {20,226},
+/* 13426 */ {20,226},
+/* 13427 */ {20,226},
+/* 13428 */ {20,226},
+/* 13429 */ {20,226},
+/* 13430 */ {20,226},
+/* 13431 */ {20,226},
+/* 13432 */ {20,226},
+/* 13433 */ {20,226},
+/* 13434 */ {20,226},
+/* 13435 */ {20,226},
+/* 13436 */ {20,226},
+/* 13437 */ {20,226},
+/* 13438 */ {20,226},
+/* 13439 */ {20,226},
+/* 13440 */ {20,226},
+/* 13441 */ {20,226},
+/* 13442 */ {20,226},
+/* 13443 */ {20,226},
+/* 13444 */ {20,226},
+/* 13445 */ {20,226},
+/* 13446 */ {20,226},
+/* 13447 */ {20,226},
+/* 13448 */ {20,226},
+/* 13449 */ {20,226},
+/* 13450 */ {20,226},
+/* 13451 */ {20,226},
+/* 13452 */ {20,226},
+/* 13453 */ {20,226},
+/* 13454 */ {20,226},
+/* 13455 */ {20,226},
+/* 13456 */ {20,226},
+/* 13457 */ {20,226},
+/* 13458 */ {20,226},
+/* 13459 */ {20,226},
+/* 13460 */ {20,226},
+/* 13461 */ {20,226},
+/* 13462 */ {20,226},
+/* 13463 */ {20,226},
+/* 13464 */ {20,226},
+/* 13465 */ {20,226},
+/* 13466 */ {20,226},
+/* 13467 */ {20,226},
+/* 13468 */ {20,226},
+/* 13469 */ {20,226},
+/* 13470 */ {20,226},
+/* 13471 */ {20,226},
+/* 13472 */ {20,226},
+/* 13473 */ {20,226},
+/* 13474 */ {20,226},
+/* 13475 */ {20,226},
+/* 13476 */ {20,226},
+/* 13477 */ {20,226},
+/* 13478 */ {20,226},
+/* 13479 */ {20,226},
+/* 13480 */ {20,226},
+/* 13481 */ {20,226},
+/* 13482 */ {20,226},
+/* 13483 */ {20,226},
+/* 13484 */ {20,226},
+/* 13485 */ {20,226},
+/* 13486 */ {20,226},
+/* 13487 */ {20,226},
+/* 13488 */ {20,226},
+/* 13489 */ {20,226},
+/* 13490 */ {20,226},
+/* 13491 */ {20,226},
+/* 13492 */ {20,226},
+/* 13493 */ {20,226},
+/* 13494 */ {20,226},
+/* 13495 */ {20,226},
+/* 13496 */ {20,226},
+/* 13497 */ {20,226},
+/* 13498 */ {20,226},
+/* 13499 */ {20,226},
+/* 13500 */ {20,226},
+/* 13501 */ {20,226},
+/* 13502 */ {20,226},
+/* 13503 */ {20,226},
+/* 13504 */ {20,226},
+/* 13505 */ {20,226},
+/* 13506 */ {20,226},
+/* 13507 */ {20,226},
+/* 13508 */ {20,226},
+/* 13509 */ {20,226},
+/* 13510 */ {20,226},
+/* 13511 */ {20,226},
+/* 13512 */ {20,226},
+/* 13513 */ {20,226},
+/* 13514 */ {20,226},
+/* 13515 */ {20,226},
+/* 13516 */ {20,226},
+/* 13517 */ {20,226},
+/* 13518 */ {20,226},
+/* 13519 */ {20,226},
+/* 13520 */ {20,226},
+/* 13521 */ {20,226},
+/* 13522 */ {20,226},
+/* 13523 */ {20,226},
+/* 13524 */ {20,226},
+/* 13525 */ {20,226},
+/* 13526 */ {20,226},
+/* 13527 */ {20,226},
+/* 13528 */ {20,226},
+/* 13529 */ {20,226},
+/* 13530 */ {20,226},
+/* 13531 */ {20,226},
+/* 13532 */ {20,226},
+/* 13533 */ {20,226},
+/* 13534 */ {20,226},
+/* 13535 */ {20,226},
+/* 13536 */ {20,226},
+/* 13537 */ {20,226},
+/* 13538 */ {20,226},
+/* 13539 */ {20,226},
+/* 13540 */ {20,226},
+/* 13541 */ {20,226},
+/* 13542 */ {20,226},
+/* 13543 */ {20,226},
+/* 13544 */ {20,226},
+/* 13545 */ {20,226},
+/* 13546 */ {20,226},
+/* 13547 */ {20,226},
+/* 13548 */ {20,226},
+/* 13549 */ {20,226},
+/* 13550 */ {20,226},
+/* 13551 */ {20,226},
+/* 13552 */ {20,226},
+/* 13553 */ {20,226},
+/* 13554 */ {20,226},
+/* 13555 */ {20,226},
+/* 13556 */ {20,226},
+/* 13557 */ {20,226},
+/* 13558 */ {20,226},
+/* 13559 */ {20,226},
+/* 13560 */ {20,226},
+/* 13561 */ {20,226},
+/* 13562 */ {20,226},
+/* 13563 */ {20,226},
+/* 13564 */ {20,226},
+/* 13565 */ {20,226},
+/* 13566 */ {20,226},
+/* 13567 */ {20,226},
+/* 13568 */ {20,226},
+/* 13569 */ {20,226},
+/* 13570 */ {20,226},
+/* 13571 */ {20,226},
+/* 13572 */ {20,226},
+/* 13573 */ {20,226},
+/* 13574 */ {20,226},
+/* 13575 */ {20,226},
+/* 13576 */ {20,226},
+/* 13577 */ {20,226},
+/* 13578 */ {20,226},
+/* 13579 */ {20,226},
+/* 13580 */ {20,226},
+/* 13581 */ {20,226},
+/* 13582 */ {20,226},
+/* 13583 */ {20,226},
+/* 13584 */ {20,226},
+/* 13585 */ {20,226},
+/* 13586 */ {20,226},
+/* 13587 */ {20,226},
+/* 13588 */ {20,226},
+/* 13589 */ {20,226},
+/* 13590 */ {20,226},
+/* 13591 */ {20,226},
+/* 13592 */ {20,226},
+/* 13593 */ {20,226},
+/* 13594 */ {20,226},
+/* 13595 */ {20,226},
+/* 13596 */ {20,226},
+/* 13597 */ {20,226},
+/* 13598 */ {20,226},
+/* 13599 */ {20,226},
+/* 13600 */ {20,226},
+/* 13601 */ {20,226},
+/* 13602 */ {20,226},
+/* 13603 */ {20,226},
+/* 13604 */ {20,226},
+/* 13605 */ {20,226},
+/* 13606 */ {20,226},
+/* 13607 */ {20,226},
+/* 13608 */ {20,226},
+/* 13609 */ {20,226},
+/* 13610 */ {20,226},
+/* 13611 */ {20,226},
+/* 13612 */ {20,226},
+/* 13613 */ {20,226},
+/* 13614 */ {20,226},
+/* 13615 */ {20,226},
+/* 13616 */ {20,226},
+/* 13617 */ {20,226},
+/* 13618 */ {20,226},
+/* 13619 */ {20,226},
+/* 13620 */ {20,226},
+/* 13621 */ {20,226},
+/* 13622 */ {20,226},
+/* 13623 */ {20,226},
+/* 13624 */ {20,226},
+/* 13625 */ {20,226},
+/* 13626 */ {20,226},
+/* 13627 */ {20,226},
+/* 13628 */ {20,226},
+/* 13629 */ {20,226},
+/* 13630 */ {20,226},
+/* 13631 */ {20,226},
+/* 13632 */ {20,226},
+/* 13633 */ {20,226},
+/* 13634 */ {20,226},
+/* 13635 */ {20,226},
+/* 13636 */ {20,226},
+/* 13637 */ {20,226},
+/* 13638 */ {20,226},
+/* 13639 */ {20,226},
+/* 13640 */ {20,226},
+/* 13641 */ {20,226},
+/* 13642 */ {20,226},
+/* 13643 */ {20,226},
+/* 13644 */ {20,226},
+/* 13645 */ {20,226},
+/* 13646 */ {20,226},
+/* 13647 */ {20,226},
+/* 13648 */ {20,226},
+/* 13649 */ {20,226},
+/* 13650 */ {20,226},
+/* 13651 */ {20,226},
+/* 13652 */ {20,226},
+/* 13653 */ {20,226},
+/* 13654 */ {20,226},
+/* 13655 */ {20,226},
+/* 13656 */ {20,226},
+/* 13657 */ {20,226},
+/* 13658 */ {20,226},
+/* 13659 */ {20,226},
+/* 13660 */ {20,226},
+/* 13661 */ {20,226},
+/* 13662 */ {20,226},
+/* 13663 */ {20,226},
+/* 13664 */ {20,226},
+/* 13665 */ {20,226},
+/* 13666 */ {20,226},
+/* 13667 */ {20,226},
+/* 13668 */ {20,226},
+/* 13669 */ {20,226},
+/* 13670 */ {20,226},
+/* 13671 */ {20,226},
+/* 13672 */ {20,226},
+/* 13673 */ {20,226},
+/* 13674 */ {20,226},
+/* 13675 */ {20,226},
+/* 13676 */ {20,226},
+/* 13677 */ {20,226},
+/* 13678 */ {20,226},
+/* 13679 */ {20,226},
+/* 13680 */ {20,226},
+/* 13681 */ {20,226},
+/* 13682 */ {20,226},
+/* 13683 */ {20,226},
+/* 13684 */ {20,226},
+/* 13685 */ {20,226},
+/* 13686 */ {20,226},
+/* 13687 */ {20,226},
+/* 13688 */ {20,226},
+/* 13689 */ {20,226},
+/* 13690 */ {20,226},
+/* 13691 */ {20,226},
+/* 13692 */ {20,226},
+/* 13693 */ {20,226},
+/* 13694 */ {20,226},
+/* 13695 */ {20,226},
+/* 13696 */ {20,226},
+/* 13697 */ {20,226},
+/* 13698 */ {20,226},
+/* 13699 */ {20,226},
+/* 13700 */ {20,226},
+/* 13701 */ {20,226},
+/* 13702 */ {20,226},
+/* 13703 */ {20,226},
+/* 13704 */ {20,226},
+/* 13705 */ {20,226},
+/* 13706 */ {20,226},
+/* 13707 */ {20,226},
+/* 13708 */ {20,226},
+/* 13709 */ {20,226},
+/* 13710 */ {20,226},
+/* 13711 */ {20,226},
+/* 13712 */ {20,226},
+/* 13713 */ {20,226},
+/* 13714 */ {20,226},
+/* 13715 */ {20,226},
+/* 13716 */ {20,226},
+/* 13717 */ {20,226},
+/* 13718 */ {20,226},
+/* 13719 */ {20,226},
+/* 13720 */ {20,226},
+/* 13721 */ {20,226},
+/* 13722 */ {20,226},
+/* 13723 */ {20,226},
+/* 13724 */ {20,226},
+/* 13725 */ {20,226},
+/* 13726 */ {20,226},
+/* 13727 */ {20,226},
+/* 13728 */ {20,226},
+/* 13729 */ {20,226},
+/* 13730 */ {20,226},
+/* 13731 */ {20,226},
+/* 13732 */ {20,226},
+/* 13733 */ {20,226},
+/* 13734 */ {20,226},
+/* 13735 */ {20,226},
+/* 13736 */ {20,226},
+/* 13737 */ {20,226},
+/* 13738 */ {20,226},
+/* 13739 */ {20,226},
+/* 13740 */ {20,226},
+/* 13741 */ {20,226},
+/* 13742 */ {20,226},
+/* 13743 */ {20,226},
+/* 13744 */ {20,226},
+/* 13745 */ {20,226},
+/* 13746 */ {20,226},
+/* 13747 */ {20,226},
+/* 13748 */ {20,226},
+/* 13749 */ {20,226},
+/* 13750 */ {20,226},
+/* 13751 */ {20,226},
+/* 13752 */ {20,226},
+/* 13753 */ {20,226},
+/* 13754 */ {20,226},
+/* 13755 */ {20,226},
+/* 13756 */ {20,226},
+/* 13757 */ {20,226},
+/* 13758 */ {20,226},
+/* 13759 */ {20,226},
+/* 13760 */ {20,226},
+/* 13761 */ {20,226},
+/* 13762 */ {20,226},
+/* 13763 */ {20,226},
+/* 13764 */ {20,226},
+/* 13765 */ {20,226},
+/* 13766 */ {20,226},
+/* 13767 */ {20,226},
+/* 13768 */ {20,226},
+/* 13769 */ {20,226},
+/* 13770 */ {20,226},
+/* 13771 */ {20,226},
+/* 13772 */ {20,226},
+/* 13773 */ {20,226},
+/* 13774 */ {20,226},
+/* 13775 */ {20,226},
+/* 13776 */ {20,226},
+/* 13777 */ {20,226},
+/* 13778 */ {20,226},
+/* 13779 */ {20,226},
+/* 13780 */ {20,226},
+/* 13781 */ {20,226},
+/* 13782 */ {20,226},
+/* 13783 */ {20,226},
+/* 13784 */ {20,226},
+/* 13785 */ {20,226},
+/* 13786 */ {20,226},
+/* 13787 */ {20,226},
+/* 13788 */ {20,226},
+/* 13789 */ {20,226},
+/* 13790 */ {20,226},
+/* 13791 */ {20,226},
+/* 13792 */ {20,226},
+/* 13793 */ {20,226},
+/* 13794 */ {20,226},
+/* 13795 */ {20,226},
+/* 13796 */ {20,226},
+/* 13797 */ {20,226},
+/* 13798 */ {20,226},
+/* 13799 */ {20,226},
+/* 13800 */ {20,226},
+/* 13801 */ {20,226},
+/* 13802 */ {20,226},
+/* 13803 */ {20,226},
+/* 13804 */ {20,226},
+/* 13805 */ {20,226},
+/* 13806 */ {20,226},
+/* 13807 */ {20,226},
+/* 13808 */ {20,226},
+/* 13809 */ {20,226},
+/* 13810 */ {20,226},
+/* 13811 */ {20,226},
+/* 13812 */ {20,226},
+/* 13813 */ {20,226},
+/* 13814 */ {20,226},
+/* 13815 */ {20,226},
+/* 13816 */ {20,226},
+/* 13817 */ {20,226},
+/* 13818 */ {20,226},
+/* 13819 */ {20,226},
+/* 13820 */ {20,226},
+/* 13821 */ {20,226},
+/* 13822 */ {20,226},
+/* 13823 */ {20,226},
+/* 13824 */ {20,226},
+/* 13825 */ {20,226},
+/* 13826 */ {20,226},
+/* 13827 */ {20,226},
+/* 13828 */ {20,226},
+/* 13829 */ {20,226},
+/* 13830 */ {20,226},
+/* 13831 */ {20,226},
+/* 13832 */ {20,226},
+/* 13833 */ {20,226},
+/* 13834 */ {20,226},
+/* 13835 */ {20,226},
+/* 13836 */ {20,226},
+/* 13837 */ {20,226},
+/* 13838 */ {20,226},
+/* 13839 */ {20,226},
+/* 13840 */ {20,226},
+/* 13841 */ {20,226},
+/* 13842 */ {20,226},
+/* 13843 */ {20,226},
+/* 13844 */ {20,226},
+/* 13845 */ {20,226},
+/* 13846 */ {20,226},
+/* 13847 */ {20,226},
+/* 13848 */ {20,226},
+/* 13849 */ {20,226},
+/* 13850 */ {20,226},
+/* 13851 */ {20,226},
+/* 13852 */ {20,226},
+/* 13853 */ {20,226},
+/* 13854 */ {20,226},
+/* 13855 */ {20,226},
+/* 13856 */ {20,226},
+/* 13857 */ {20,226},
+/* 13858 */ {20,226},
+/* 13859 */ {20,226},
+/* 13860 */ {20,226},
+/* 13861 */ {20,226},
+/* 13862 */ {20,226},
+/* 13863 */ {20,226},
+/* 13864 */ {20,226},
+/* 13865 */ {20,226},
+/* 13866 */ {20,226},
+/* 13867 */ {20,226},
+/* 13868 */ {20,226},
+/* 13869 */ {20,226},
+/* 13870 */ {20,226},
+/* 13871 */ {20,226},
+/* 13872 */ {20,226},
+/* 13873 */ {20,226},
+/* 13874 */ {20,226},
+/* 13875 */ {20,226},
+/* 13876 */ {20,226},
+/* 13877 */ {20,226},
+/* 13878 */ {20,226},
+/* 13879 */ {20,226},
+/* 13880 */ {20,226},
+/* 13881 */ {20,226},
+/* 13882 */ {20,226},
+/* 13883 */ {20,226},
+/* 13884 */ {20,226},
+/* 13885 */ {20,226},
+/* 13886 */ {20,226},
+/* 13887 */ {20,226},
+/* 13888 */ {20,226},
+/* 13889 */ {20,226},
+/* 13890 */ {20,226},
+/* 13891 */ {20,226},
+/* 13892 */ {20,226},
+/* 13893 */ {20,226},
+/* 13894 */ {20,226},
+/* 13895 */ {20,226},
+/* 13896 */ {20,226},
+/* 13897 */ {20,226},
+/* 13898 */ {20,226},
+/* 13899 */ {20,226},
+/* 13900 */ {20,226},
+/* 13901 */ {20,226},
+/* 13902 */ {20,226},
+/* 13903 */ {20,226},
+/* 13904 */ {20,226},
+/* 13905 */ {20,226},
+/* 13906 */ {20,226},
+/* 13907 */ {20,226},
+/* 13908 */ {20,226},
+/* 13909 */ {20,226},
+/* 13910 */ {20,226},
+/* 13911 */ {20,226},
+/* 13912 */ {20,226},
+/* 13913 */ {20,226},
+/* 13914 */ {20,226},
+/* 13915 */ {20,226},
+/* 13916 */ {20,226},
+/* 13917 */ {20,226},
+/* 13918 */ {20,226},
+/* 13919 */ {20,226},
+/* 13920 */ {20,226},
+/* 13921 */ {20,226},
+/* 13922 */ {20,226},
+/* 13923 */ {20,226},
+/* 13924 */ {20,226},
+/* 13925 */ {20,226},
+/* 13926 */ {20,226},
+/* 13927 */ {20,226},
+/* 13928 */ {20,226},
+/* 13929 */ {20,226},
+/* 13930 */ {20,226},
+/* 13931 */ {20,226},
+/* 13932 */ {20,226},
+/* 13933 */ {20,226},
+/* 13934 */ {20,226},
+/* 13935 */ {20,226},
+/* 13936 */ {20,226},
+/* 13937 */ {20,226},
+/* 13938 */ {20,226},
+/* 13939 */ {20,226},
+/* 13940 */ {20,226},
+/* 13941 */ {20,226},
+/* 13942 */ {20,226},
+/* 13943 */ {20,226},
+/* 13944 */ {20,226},
+/* 13945 */ {20,226},
+/* 13946 */ {20,226},
+/* 13947 */ {20,226},
+/* 13948 */ {20,226},
+/* 13949 */ {20,226},
+/* 13950 */ {20,226},
+/* 13951 */ {20,226},
+/* 13952 */ {20,226},
+/* 13953 */ {20,226},
+/* 13954 */ {20,226},
+/* 13955 */ {20,226},
+/* 13956 */ {20,226},
+/* 13957 */ {20,226},
+/* 13958 */ {20,226},
+/* 13959 */ {20,226},
+/* 13960 */ {20,226},
+/* 13961 */ {20,226},
+/* 13962 */ {20,226},
+/* 13963 */ {20,226},
+/* 13964 */ {20,226},
+/* 13965 */ {20,226},
+/* 13966 */ {20,226},
+/* 13967 */ {20,226},
+/* 13968 */ {20,226},
+/* 13969 */ {20,226},
+/* 13970 */ {20,226},
+/* 13971 */ {20,226},
+/* 13972 */ {20,226},
+/* 13973 */ {20,226},
+/* 13974 */ {20,226},
+/* 13975 */ {20,226},
+/* 13976 */ {20,226},
+/* 13977 */ {20,226},
+/* 13978 */ {20,226},
+/* 13979 */ {20,226},
+/* 13980 */ {20,226},
+/* 13981 */ {20,226},
+/* 13982 */ {20,226},
+/* 13983 */ {20,226},
+/* 13984 */ {20,226},
+/* 13985 */ {20,226},
+/* 13986 */ {20,226},
+/* 13987 */ {20,226},
+/* 13988 */ {20,226},
+/* 13989 */ {20,226},
+/* 13990 */ {20,226},
+/* 13991 */ {20,226},
+/* 13992 */ {20,226},
+/* 13993 */ {20,226},
+/* 13994 */ {20,226},
+/* 13995 */ {20,226},
+/* 13996 */ {20,226},
+/* 13997 */ {20,226},
+/* 13998 */ {20,226},
+/* 13999 */ {20,226},
+/* 14000 */ {20,226},
+/* 14001 */ {20,226},
+/* 14002 */ {20,226},
+/* 14003 */ {20,226},
+/* 14004 */ {20,226},
+/* 14005 */ {20,226},
+/* 14006 */ {20,226},
+/* 14007 */ {20,226},
+/* 14008 */ {20,226},
+/* 14009 */ {20,226},
+/* 14010 */ {20,226},
+/* 14011 */ {20,226},
+/* 14012 */ {20,226},
+/* 14013 */ {20,226},
+/* 14014 */ {20,226},
+/* 14015 */ {20,226},
+/* 14016 */ {20,226},
+/* 14017 */ {20,226},
+/* 14018 */ {20,226},
+/* 14019 */ {20,226},
+/* 14020 */ {20,226},
+/* 14021 */ {20,226},
+/* 14022 */ {20,226},
+/* 14023 */ {20,226},
+/* 14024 */ {20,226},
+/* 14025 */ {20,226},
+/* 14026 */ {20,226},
+/* 14027 */ {20,226},
+/* 14028 */ {20,226},
+/* 14029 */ {20,226},
+/* 14030 */ {20,226},
+/* 14031 */ {20,226},
+/* 14032 */ {20,226},
+/* 14033 */ {20,226},
+/* 14034 */ {20,226},
+/* 14035 */ {20,226},
+/* 14036 */ {20,226},
+/* 14037 */ {20,226},
+/* 14038 */ {20,226},
+/* 14039 */ {20,226},
+/* 14040 */ {20,226},
+/* 14041 */ {20,226},
+/* 14042 */ {20,226},
+/* 14043 */ {20,226},
+/* 14044 */ {20,226},
+/* 14045 */ {20,226},
+/* 14046 */ {20,226},
+/* 14047 */ {20,226},
+/* 14048 */ {20,226},
+/* 14049 */ {20,226},
+/* 14050 */ {20,226},
+/* 14051 */ {20,226},
+/* 14052 */ {20,226},
+/* 14053 */ {20,226},
+/* 14054 */ {20,226},
+/* 14055 */ {20,226},
+/* 14056 */ {20,226},
+/* 14057 */ {20,226},
+/* 14058 */ {20,226},
+/* 14059 */ {20,226},
+/* 14060 */ {20,226},
+/* 14061 */ {20,226},
+/* 14062 */ {20,226},
+/* 14063 */ {20,226},
+/* 14064 */ {20,226},
+/* 14065 */ {20,226},
+/* 14066 */ {20,226},
+/* 14067 */ {20,226},
+/* 14068 */ {20,226},
+/* 14069 */ {20,226},
+/* 14070 */ {20,226},
+/* 14071 */ {20,226},
+/* 14072 */ {20,226},
+/* 14073 */ {20,226},
+/* 14074 */ {20,226},
+/* 14075 */ {20,226},
+/* 14076 */ {20,226},
+/* 14077 */ {20,226},
+/* 14078 */ {20,226},
+/* 14079 */ {20,226},
+/* 14080 */ {20,226},
+/* 14081 */ {20,226},
+/* 14082 */ {20,226},
+/* 14083 */ {20,226},
+/* 14084 */ {20,226},
+/* 14085 */ {20,226},
+/* 14086 */ {20,226},
+/* 14087 */ {20,226},
+/* 14088 */ {20,226},
+/* 14089 */ {20,226},
+/* 14090 */ {20,226},
+/* 14091 */ {20,226},
+/* 14092 */ {20,226},
+/* 14093 */ {20,226},
+/* 14094 */ {20,226},
+/* 14095 */ {20,226},
+/* 14096 */ {20,226},
+/* 14097 */ {20,226},
+/* 14098 */ {20,226},
+/* 14099 */ {20,226},
+/* 14100 */ {20,226},
+/* 14101 */ {20,226},
+/* 14102 */ {20,226},
+/* 14103 */ {20,226},
+/* 14104 */ {20,226},
+/* 14105 */ {20,226},
+/* 14106 */ {20,226},
+/* 14107 */ {20,226},
+/* 14108 */ {20,226},
+/* 14109 */ {20,226},
+/* 14110 */ {20,226},
+/* 14111 */ {20,226},
+/* 14112 */ {20,226},
+/* 14113 */ {20,226},
+/* 14114 */ {20,226},
+/* 14115 */ {20,226},
+/* 14116 */ {20,226},
+/* 14117 */ {20,226},
+/* 14118 */ {20,226},
+/* 14119 */ {20,226},
+/* 14120 */ {20,226},
+/* 14121 */ {20,226},
+/* 14122 */ {20,226},
+/* 14123 */ {20,226},
+/* 14124 */ {20,226},
+/* 14125 */ {20,226},
+/* 14126 */ {20,226},
+/* 14127 */ {20,226},
+/* 14128 */ {20,226},
+/* 14129 */ {20,226},
+/* 14130 */ {20,226},
+/* 14131 */ {20,226},
+/* 14132 */ {20,226},
+/* 14133 */ {20,226},
+/* 14134 */ {20,226},
+/* 14135 */ {20,226},
+/* 14136 */ {20,226},
+/* 14137 */ {20,226},
+/* 14138 */ {20,226},
+/* 14139 */ {20,226},
+/* 14140 */ {20,226},
+/* 14141 */ {20,226},
+/* 14142 */ {20,226},
+/* 14143 */ {20,226},
+/* 14144 */ {20,226},
+/* 14145 */ {20,226},
+/* 14146 */ {20,226},
+/* 14147 */ {20,226},
+/* 14148 */ {20,226},
+/* 14149 */ {20,226},
+/* 14150 */ {20,226},
+/* 14151 */ {20,226},
+/* 14152 */ {20,226},
+/* 14153 */ {20,226},
+/* 14154 */ {20,226},
+/* 14155 */ {20,226},
+/* 14156 */ {20,226},
+/* 14157 */ {20,226},
+/* 14158 */ {20,226},
+/* 14159 */ {20,226},
+/* 14160 */ {20,226},
+/* 14161 */ {20,226},
+/* 14162 */ {20,226},
+/* 14163 */ {20,226},
+/* 14164 */ {20,226},
+/* 14165 */ {20,226},
+/* 14166 */ {20,226},
+/* 14167 */ {20,226},
+/* 14168 */ {20,226},
+/* 14169 */ {20,226},
+/* 14170 */ {20,226},
+/* 14171 */ {20,226},
+/* 14172 */ {20,226},
+/* 14173 */ {20,226},
+/* 14174 */ {20,226},
+/* 14175 */ {20,226},
+/* 14176 */ {20,226},
+/* 14177 */ {20,226},
+/* 14178 */ {20,226},
+/* 14179 */ {20,226},
+/* 14180 */ {20,226},
+/* 14181 */ {20,226},
+/* 14182 */ {20,226},
+/* 14183 */ {20,226},
+/* 14184 */ {20,226},
+/* 14185 */ {20,226},
+/* 14186 */ {20,226},
+/* 14187 */ {20,226},
+/* 14188 */ {20,226},
+/* 14189 */ {20,226},
+/* 14190 */ {20,226},
+/* 14191 */ {20,226},
+/* 14192 */ {20,226},
+/* 14193 */ {20,226},
+/* 14194 */ {20,226},
+/* 14195 */ {20,226},
+/* 14196 */ {20,226},
+/* 14197 */ {20,226},
+/* 14198 */ {20,226},
+/* 14199 */ {20,226},
+/* 14200 */ {20,226},
+/* 14201 */ {20,226},
+/* 14202 */ {20,226},
+/* 14203 */ {20,226},
+/* 14204 */ {20,226},
+/* 14205 */ {20,226},
+/* 14206 */ {20,226},
+/* 14207 */ {20,226},
+/* 14208 */ {20,226},
+/* 14209 */ {20,226},
+/* 14210 */ {20,226},
+/* 14211 */ {20,226},
+/* 14212 */ {20,226},
+/* 14213 */ {20,226},
+/* 14214 */ {20,226},
+/* 14215 */ {20,226},
+/* 14216 */ {20,226},
+/* 14217 */ {20,226},
+/* 14218 */ {20,226},
+/* 14219 */ {20,226},
+/* 14220 */ {20,226},
+/* 14221 */ {20,226},
+/* 14222 */ {20,226},
+/* 14223 */ {20,226},
+/* 14224 */ {20,226},
+/* 14225 */ {20,226},
+/* 14226 */ {20,226},
+/* 14227 */ {20,226},
+/* 14228 */ {20,226},
+/* 14229 */ {20,226},
+/* 14230 */ {20,226},
+/* 14231 */ {20,226},
+/* 14232 */ {20,226},
+/* 14233 */ {20,226},
+/* 14234 */ {20,226},
+/* 14235 */ {20,226},
+/* 14236 */ {20,226},
+/* 14237 */ {20,226},
+/* 14238 */ {20,226},
+/* 14239 */ {20,226},
+/* 14240 */ {20,226},
+/* 14241 */ {20,226},
+/* 14242 */ {20,226},
+/* 14243 */ {20,226},
+/* 14244 */ {20,226},
+/* 14245 */ {20,226},
+/* 14246 */ {20,226},
+/* 14247 */ {20,226},
+/* 14248 */ {20,226},
+/* 14249 */ {20,226},
+/* 14250 */ {20,226},
+/* 14251 */ {20,226},
+/* 14252 */ {20,226},
+/* 14253 */ {20,226},
+/* 14254 */ {20,226},
+/* 14255 */ {20,226},
+/* 14256 */ {20,226},
+/* 14257 */ {20,226},
+/* 14258 */ {20,226},
+/* 14259 */ {20,226},
+/* 14260 */ {20,226},
+/* 14261 */ {20,226},
+/* 14262 */ {20,226},
+/* 14263 */ {20,226},
+/* 14264 */ {20,226},
+/* 14265 */ {20,226},
+/* 14266 */ {20,226},
+/* 14267 */ {20,226},
+/* 14268 */ {20,226},
+/* 14269 */ {20,226},
+/* 14270 */ {20,226},
+/* 14271 */ {20,226},
+/* 14272 */ {20,226},
+/* 14273 */ {20,226},
+/* 14274 */ {20,226},
+/* 14275 */ {20,226},
+/* 14276 */ {20,226},
+/* 14277 */ {20,226},
+/* 14278 */ {20,226},
+/* 14279 */ {20,226},
+/* 14280 */ {20,226},
+/* 14281 */ {20,226},
+/* 14282 */ {20,226},
+/* 14283 */ {20,226},
+/* 14284 */ {20,226},
+/* 14285 */ {20,226},
+/* 14286 */ {20,226},
+/* 14287 */ {20,226},
+/* 14288 */ {20,226},
+/* 14289 */ {20,226},
+/* 14290 */ {20,226},
+/* 14291 */ {20,226},
+/* 14292 */ {20,226},
+/* 14293 */ {20,226},
+/* 14294 */ {20,226},
+/* 14295 */ {20,226},
+/* 14296 */ {20,226},
+/* 14297 */ {20,226},
+/* 14298 */ {20,226},
+/* 14299 */ {20,226},
+/* 14300 */ {20,226},
+/* 14301 */ {20,226},
+/* 14302 */ {20,226},
+/* 14303 */ {20,226},
+/* 14304 */ {20,226},
+/* 14305 */ {20,226},
+/* 14306 */ {20,226},
+/* 14307 */ {20,226},
+/* 14308 */ {20,226},
+/* 14309 */ {20,226},
+/* 14310 */ {20,226},
+/* 14311 */ {20,226},
+/* 14312 */ {20,226},
+/* 14313 */ {20,226},
+/* 14314 */ {20,226},
+/* 14315 */ {20,226},
+/* 14316 */ {20,226},
+/* 14317 */ {20,226},
+/* 14318 */ {20,226},
+/* 14319 */ {20,226},
+/* 14320 */ {20,226},
+/* 14321 */ {20,226},
+/* 14322 */ {20,226},
+/* 14323 */ {20,226},
+/* 14324 */ {20,226},
+/* 14325 */ {20,226},
+/* 14326 */ {20,226},
+/* 14327 */ {20,226},
+/* 14328 */ {20,226},
+/* 14329 */ {20,226},
+/* 14330 */ {20,226},
+/* 14331 */ {20,226},
+/* 14332 */ {20,226},
+/* 14333 */ {20,226},
+/* 14334 */ {20,226},
+/* 14335 */ {20,226},
+/* 14336 */ {21,153},
+/* 14337 */ {21,153},
+/* 14338 */ {21,153},
+/* 14339 */ {21,153},
+/* 14340 */ {21,153},
+/* 14341 */ {21,153},
+/* 14342 */ {21,153},
+/* 14343 */ {21,153},
+/* 14344 */ {21,153},
+/* 14345 */ {21,153},
+/* 14346 */ {21,153},
+/* 14347 */ {21,153},
+/* 14348 */ {21,153},
+/* 14349 */ {21,153},
+/* 14350 */ {21,153},
+/* 14351 */ {21,153},
+/* 14352 */ {21,153},
+/* 14353 */ {21,153},
+/* 14354 */ {21,153},
+/* 14355 */ {21,153},
+/* 14356 */ {21,153},
+/* 14357 */ {21,153},
+/* 14358 */ {21,153},
+/* 14359 */ {21,153},
+/* 14360 */ {21,153},
+/* 14361 */ {21,153},
+/* 14362 */ {21,153},
+/* 14363 */ {21,153},
+/* 14364 */ {21,153},
+/* 14365 */ {21,153},
+/* 14366 */ {21,153},
+/* 14367 */ {21,153},
+/* 14368 */ {21,153},
+/* 14369 */ {21,153},
+/* 14370 */ {21,153},
+/* 14371 */ {21,153},
+/* 14372 */ {21,153},
+/* 14373 */ {21,153},
+/* 14374 */ {21,153},
+/* 14375 */ {21,153},
+/* 14376 */ {21,153},
+/* 14377 */ {21,153},
+/* 14378 */ {21,153},
+/* 14379 */ {21,153},
+/* 14380 */ {21,153},
+/* 14381 */ {21,153},
+/* 14382 */ {21,153},
+/* 14383 */ {21,153},
+/* 14384 */ {21,153},
+/* 14385 */ {21,153},
+/* 14386 */ {21,153},
+/* 14387 */ {21,153},
+/* 14388 */ {21,153},
+/* 14389 */ {21,153},
+/* 14390 */ {21,153},
+/* 14391 */ {21,153},
+/* 14392 */ {21,153},
+/* 14393 */ {21,153},
+/* 14394 */ {21,153},
+/* 14395 */ {21,153},
+/* 14396 */ {21,153},
+/* 14397 */ {21,153},
+/* 14398 */ {21,153},
+/* 14399 */ {21,153},
+/* 14400 */ {21,153},
+/* 14401 */ {21,153},
+/* 14402 */ {21,153},
+/* 14403 */ {21,153},
+/* 14404 */ {21,153},
+/* 14405 */ {21,153},
+/* 14406 */ {21,153},
+/* 14407 */ {21,153},
+/* 14408 */ {21,153},
+/* 14409 */ {21,153},
+/* 14410 */ {21,153},
+/* 14411 */ {21,153},
+/* 14412 */ {21,153},
+/* 14413 */ {21,153},
+/* 14414 */ {21,153},
+/* 14415 */ {21,153},
+/* 14416 */ {21,153},
+/* 14417 */ {21,153},
+/* 14418 */ {21,153},
+/* 14419 */ {21,153},
+/* 14420 */ {21,153},
+/* 14421 */ {21,153},
+/* 14422 */ {21,153},
+/* 14423 */ {21,153},
+/* 14424 */ {21,153},
+/* 14425 */ {21,153},
+/* 14426 */ {21,153},
+/* 14427 */ {21,153},
+/* 14428 */ {21,153},
+/* 14429 */ {21,153},
+/* 14430 */ {21,153},
+/* 14431 */ {21,153},
+/* 14432 */ {21,153},
+/* 14433 */ {21,153},
+/* 14434 */ {21,153},
+/* 14435 */ {21,153},
+/* 14436 */ {21,153},
+/* 14437 */ {21,153},
+/* 14438 */ {21,153},
+/* 14439 */ {21,153},
+/* 14440 */ {21,153},
+/* 14441 */ {21,153},
+/* 14442 */ {21,153},
+/* 14443 */ {21,153},
+/* 14444 */ {21,153},
+/* 14445 */ {21,153},
+/* 14446 */ {21,153},
+/* 14447 */ {21,153},
+/* 14448 */ {21,153},
+/* 14449 */ {21,153},
+/* 14450 */ {21,153},
+/* 14451 */ {21,153},
+/* 14452 */ {21,153},
+/* 14453 */ {21,153},
+/* 14454 */ {21,153},
+/* 14455 */ {21,153},
+/* 14456 */ {21,153},
+/* 14457 */ {21,153},
+/* 14458 */ {21,153},
+/* 14459 */ {21,153},
+/* 14460 */ {21,153},
+/* 14461 */ {21,153},
+/* 14462 */ {21,153},
+/* 14463 */ {21,153},
+/* 14464 */ {21,153},
+/* 14465 */ {21,153},
+/* 14466 */ {21,153},
+/* 14467 */ {21,153},
+/* 14468 */ {21,153},
+/* 14469 */ {21,153},
+/* 14470 */ {21,153},
+/* 14471 */ {21,153},
+/* 14472 */ {21,153},
+/* 14473 */ {21,153},
+/* 14474 */ {21,153},
+/* 14475 */ {21,153},
+/* 14476 */ {21,153},
+/* 14477 */ {21,153},
+/* 14478 */ {21,153},
+/* 14479 */ {21,153},
+/* 14480 */ {21,153},
+/* 14481 */ {21,153},
+/* 14482 */ {21,153},
+/* 14483 */ {21,153},
+/* 14484 */ {21,153},
+/* 14485 */ {21,153},
+/* 14486 */ {21,153},
+/* 14487 */ {21,153},
+/* 14488 */ {21,153},
+/* 14489 */ {21,153},
+/* 14490 */ {21,153},
+/* 14491 */ {21,153},
+/* 14492 */ {21,153},
+/* 14493 */ {21,153},
+/* 14494 */ {21,153},
+/* 14495 */ {21,153},
+/* 14496 */ {21,153},
+/* 14497 */ {21,153},
+/* 14498 */ {21,153},
+/* 14499 */ {21,153},
+/* 14500 */ {21,153},
+/* 14501 */ {21,153},
+/* 14502 */ {21,153},
+/* 14503 */ {21,153},
+/* 14504 */ {21,153},
+/* 14505 */ {21,153},
+/* 14506 */ {21,153},
+/* 14507 */ {21,153},
+/* 14508 */ {21,153},
+/* 14509 */ {21,153},
+/* 14510 */ {21,153},
+/* 14511 */ {21,153},
+/* 14512 */ {21,153},
+/* 14513 */ {21,153},
+/* 14514 */ {21,153},
+/* 14515 */ {21,153},
+/* 14516 */ {21,153},
+/* 14517 */ {21,153},
+/* 14518 */ {21,153},
+/* 14519 */ {21,153},
+/* 14520 */ {21,153},
+/* 14521 */ {21,153},
+/* 14522 */ {21,153},
+/* 14523 */ {21,153},
+/* 14524 */ {21,153},
+/* 14525 */ {21,153},
+/* 14526 */ {21,153},
+/* 14527 */ {21,153},
+/* 14528 */ {21,153},
+/* 14529 */ {21,153},
+/* 14530 */ {21,153},
+/* 14531 */ {21,153},
+/* 14532 */ {21,153},
+/* 14533 */ {21,153},
+/* 14534 */ {21,153},
+/* 14535 */ {21,153},
+/* 14536 */ {21,153},
+/* 14537 */ {21,153},
+/* 14538 */ {21,153},
+/* 14539 */ {21,153},
+/* 14540 */ {21,153},
+/* 14541 */ {21,153},
+/* 14542 */ {21,153},
+/* 14543 */ {21,153},
+/* 14544 */ {21,153},
+/* 14545 */ {21,153},
+/* 14546 */ {21,153},
+/* 14547 */ {21,153},
+/* 14548 */ {21,153},
+/* 14549 */ {21,153},
+/* 14550 */ {21,153},
+/* 14551 */ {21,153},
+/* 14552 */ {21,153},
+/* 14553 */ {21,153},
+/* 14554 */ {21,153},
+/* 14555 */ {21,153},
+/* 14556 */ {21,153},
+/* 14557 */ {21,153},
+/* 14558 */ {21,153},
+/* 14559 */ {21,153},
+/* 14560 */ {21,153},
+/* 14561 */ {21,153},
+/* 14562 */ {21,153},
+/* 14563 */ {21,153},
+/* 14564 */ {21,153},
+/* 14565 */ {21,153},
+/* 14566 */ {21,153},
+/* 14567 */ {21,153},
+/* 14568 */ {21,153},
+/* 14569 */ {21,153},
+/* 14570 */ {21,153},
+/* 14571 */ {21,153},
+/* 14572 */ {21,153},
+/* 14573 */ {21,153},
+/* 14574 */ {21,153},
+/* 14575 */ {21,153},
+/* 14576 */ {21,153},
+/* 14577 */ {21,153},
+/* 14578 */ {21,153},
+/* 14579 */ {21,153},
+/* 14580 */ {21,153},
+/* 14581 */ {21,153},
+/* 14582 */ {21,153},
+/* 14583 */ {21,153},
+/* 14584 */ {21,153},
+/* 14585 */ {21,153},
+/* 14586 */ {21,153},
+/* 14587 */ {21,153},
+/* 14588 */ {21,153},
+/* 14589 */ {21,153},
+/* 14590 */ {21,153},
+/* 14591 */ {21,153},
+/* 14592 */ {21,153},
+/* 14593 */ {21,153},
+/* 14594 */ {21,153},
+/* 14595 */ {21,153},
+/* 14596 */ {21,153},
+/* 14597 */ {21,153},
+/* 14598 */ {21,153},
+/* 14599 */ {21,153},
+/* 14600 */ {21,153},
+/* 14601 */ {21,153},
+/* 14602 */ {21,153},
+/* 14603 */ {21,153},
+/* 14604 */ {21,153},
+/* 14605 */ {21,153},
+/* 14606 */ {21,153},
+/* 14607 */ {21,153},
+/* 14608 */ {21,153},
+/* 14609 */ {21,153},
+/* 14610 */ {21,153},
+/* 14611 */ {21,153},
+/* 14612 */ {21,153},
+/* 14613 */ {21,153},
+/* 14614 */ {21,153},
+/* 14615 */ {21,153},
+/* 14616 */ {21,153},
+/* 14617 */ {21,153},
+/* 14618 */ {21,153},
+/* 14619 */ {21,153},
+/* 14620 */ {21,153},
+/* 14621 */ {21,153},
+/* 14622 */ {21,153},
+/* 14623 */ {21,153},
+/* 14624 */ {21,153},
+/* 14625 */ {21,153},
+/* 14626 */ {21,153},
+/* 14627 */ {21,153},
+/* 14628 */ {21,153},
+/* 14629 */ {21,153},
+/* 14630 */ {21,153},
+/* 14631 */ {21,153},
+/* 14632 */ {21,153},
+/* 14633 */ {21,153},
+/* 14634 */ {21,153},
+/* 14635 */ {21,153},
+/* 14636 */ {21,153},
+/* 14637 */ {21,153},
+/* 14638 */ {21,153},
+/* 14639 */ {21,153},
+/* 14640 */ {21,153},
+/* 14641 */ {21,153},
+/* 14642 */ {21,153},
+/* 14643 */ {21,153},
+/* 14644 */ {21,153},
+/* 14645 */ {21,153},
+/* 14646 */ {21,153},
+/* 14647 */ {21,153},
+/* 14648 */ {21,153},
+/* 14649 */ {21,153},
+/* 14650 */ {21,153},
+/* 14651 */ {21,153},
+/* 14652 */ {21,153},
+/* 14653 */ {21,153},
+/* 14654 */ {21,153},
+/* 14655 */ {21,153},
+/* 14656 */ {21,153},
+/* 14657 */ {21,153},
+/* 14658 */ {21,153},
+/* 14659 */ {21,153},
+/* 14660 */ {21,153},
+/* 14661 */ {21,153},
+/* 14662 */ {21,153},
+/* 14663 */ {21,153},
+/* 14664 */ {21,153},
+/* 14665 */ {21,153},
+/* 14666 */ {21,153},
+/* 14667 */ {21,153},
+/* 14668 */ {21,153},
+/* 14669 */ {21,153},
+/* 14670 */ {21,153},
+/* 14671 */ {21,153},
+/* 14672 */ {21,153},
+/* 14673 */ {21,153},
+/* 14674 */ {21,153},
+/* 14675 */ {21,153},
+/* 14676 */ {21,153},
+/* 14677 */ {21,153},
+/* 14678 */ {21,153},
+/* 14679 */ {21,153},
+/* 14680 */ {21,153},
+/* 14681 */ {21,153},
+/* 14682 */ {21,153},
+/* 14683 */ {21,153},
+/* 14684 */ {21,153},
+/* 14685 */ {21,153},
+/* 14686 */ {21,153},
+/* 14687 */ {21,153},
+/* 14688 */ {21,153},
+/* 14689 */ {21,153},
+/* 14690 */ {21,153},
+/* 14691 */ {21,153},
+/* 14692 */ {21,153},
+/* 14693 */ {21,153},
+/* 14694 */ {21,153},
+/* 14695 */ {21,153},
+/* 14696 */ {21,153},
+/* 14697 */ {21,153},
+/* 14698 */ {21,153},
+/* 14699 */ {21,153},
+/* 14700 */ {21,153},
+/* 14701 */ {21,153},
+/* 14702 */ {21,153},
+/* 14703 */ {21,153},
+/* 14704 */ {21,153},
+/* 14705 */ {21,153},
+/* 14706 */ {21,153},
+/* 14707 */ {21,153},
+/* 14708 */ {21,153},
+/* 14709 */ {21,153},
+/* 14710 */ {21,153},
+/* 14711 */ {21,153},
+/* 14712 */ {21,153},
+/* 14713 */ {21,153},
+/* 14714 */ {21,153},
+/* 14715 */ {21,153},
+/* 14716 */ {21,153},
+/* 14717 */ {21,153},
+/* 14718 */ {21,153},
+/* 14719 */ {21,153},
+/* 14720 */ {21,153},
+/* 14721 */ {21,153},
+/* 14722 */ {21,153},
+/* 14723 */ {21,153},
+/* 14724 */ {21,153},
+/* 14725 */ {21,153},
+/* 14726 */ {21,153},
+/* 14727 */ {21,153},
+/* 14728 */ {21,153},
+/* 14729 */ {21,153},
+/* 14730 */ {21,153},
+/* 14731 */ {21,153},
+/* 14732 */ {21,153},
+/* 14733 */ {21,153},
+/* 14734 */ {21,153},
+/* 14735 */ {21,153},
+/* 14736 */ {21,153},
+/* 14737 */ {21,153},
+/* 14738 */ {21,153},
+/* 14739 */ {21,153},
+/* 14740 */ {21,153},
+/* 14741 */ {21,153},
+/* 14742 */ {21,153},
+/* 14743 */ {21,153},
+/* 14744 */ {21,153},
+/* 14745 */ {21,153},
+/* 14746 */ {21,153},
+/* 14747 */ {21,153},
+/* 14748 */ {21,153},
+/* 14749 */ {21,153},
+/* 14750 */ {21,153},
+/* 14751 */ {21,153},
+/* 14752 */ {21,153},
+/* 14753 */ {21,153},
+/* 14754 */ {21,153},
+/* 14755 */ {21,153},
+/* 14756 */ {21,153},
+/* 14757 */ {21,153},
+/* 14758 */ {21,153},
+/* 14759 */ {21,153},
+/* 14760 */ {21,153},
+/* 14761 */ {21,153},
+/* 14762 */ {21,153},
+/* 14763 */ {21,153},
+/* 14764 */ {21,153},
+/* 14765 */ {21,153},
+/* 14766 */ {21,153},
+/* 14767 */ {21,153},
+/* 14768 */ {21,153},
+/* 14769 */ {21,153},
+/* 14770 */ {21,153},
+/* 14771 */ {21,153},
+/* 14772 */ {21,153},
+/* 14773 */ {21,153},
+/* 14774 */ {21,153},
+/* 14775 */ {21,153},
+/* 14776 */ {21,153},
+/* 14777 */ {21,153},
+/* 14778 */ {21,153},
+/* 14779 */ {21,153},
+/* 14780 */ {21,153},
+/* 14781 */ {21,153},
+/* 14782 */ {21,153},
+/* 14783 */ {21,153},
+/* 14784 */ {21,153},
+/* 14785 */ {21,153},
+/* 14786 */ {21,153},
+/* 14787 */ {21,153},
+/* 14788 */ {21,153},
+/* 14789 */ {21,153},
+/* 14790 */ {21,153},
+/* 14791 */ {21,153},
+/* 14792 */ {21,153},
+/* 14793 */ {21,153},
+/* 14794 */ {21,153},
+/* 14795 */ {21,153},
+/* 14796 */ {21,153},
+/* 14797 */ {21,153},
+/* 14798 */ {21,153},
+/* 14799 */ {21,153},
+/* 14800 */ {21,153},
+/* 14801 */ {21,153},
+/* 14802 */ {21,153},
+/* 14803 */ {21,153},
+/* 14804 */ {21,153},
+/* 14805 */ {21,153},
+/* 14806 */ {21,153},
+/* 14807 */ {21,153},
+/* 14808 */ {21,153},
+/* 14809 */ {21,153},
+/* 14810 */ {21,153},
+/* 14811 */ {21,153},
+/* 14812 */ {21,153},
+/* 14813 */ {21,153},
+/* 14814 */ {21,153},
+/* 14815 */ {21,153},
+/* 14816 */ {21,153},
+/* 14817 */ {21,153},
+/* 14818 */ {21,153},
+/* 14819 */ {21,153},
+/* 14820 */ {21,153},
+/* 14821 */ {21,153},
+/* 14822 */ {21,153},
+/* 14823 */ {21,153},
+/* 14824 */ {21,153},
+/* 14825 */ {21,153},
+/* 14826 */ {21,153},
+/* 14827 */ {21,153},
+/* 14828 */ {21,153},
+/* 14829 */ {21,153},
+/* 14830 */ {21,153},
+/* 14831 */ {21,153},
+/* 14832 */ {21,153},
+/* 14833 */ {21,153},
+/* 14834 */ {21,153},
+/* 14835 */ {21,153},
+/* 14836 */ {21,153},
+/* 14837 */ {21,153},
+/* 14838 */ {21,153},
+/* 14839 */ {21,153},
+/* 14840 */ {21,153},
+/* 14841 */ {21,153},
+/* 14842 */ {21,153},
+/* 14843 */ {21,153},
+/* 14844 */ {21,153},
+/* 14845 */ {21,153},
+/* 14846 */ {21,153},
+/* 14847 */ {21,153},
+/* 14848 */ {21,161},
+/* 14849 */ {21,161},
+/* 14850 */ {21,161},
+/* 14851 */ {21,161},
+/* 14852 */ {21,161},
+/* 14853 */ {21,161},
+/* 14854 */ {21,161},
+/* 14855 */ {21,161},
+/* 14856 */ {21,161},
+/* 14857 */ {21,161},
+/* 14858 */ {21,161},
+/* 14859 */ {21,161},
+/* 14860 */ {21,161},
+/* 14861 */ {21,161},
+/* 14862 */ {21,161},
+/* 14863 */ {21,161},
+/* 14864 */ {21,161},
+/* 14865 */ {21,161},
+/* 14866 */ {21,161},
+/* 14867 */ {21,161},
+/* 14868 */ {21,161},
+/* 14869 */ {21,161},
+/* 14870 */ {21,161},
+/* 14871 */ {21,161},
+/* 14872 */ {21,161},
+/* 14873 */ {21,161},
+/* 14874 */ {21,161},
+/* 14875 */ {21,161},
+/* 14876 */ {21,161},
+/* 14877 */ {21,161},
+/* 14878 */ {21,161},
+/* 14879 */ {21,161},
+/* 14880 */ {21,161},
+/* 14881 */ {21,161},
+/* 14882 */ {21,161},
+/* 14883 */ {21,161},
+/* 14884 */ {21,161},
+/* 14885 */ {21,161},
+/* 14886 */ {21,161},
+/* 14887 */ {21,161},
+/* 14888 */ {21,161},
+/* 14889 */ {21,161},
+/* 14890 */ {21,161},
+/* 14891 */ {21,161},
+/* 14892 */ {21,161},
+/* 14893 */ {21,161},
+/* 14894 */ {21,161},
+/* 14895 */ {21,161},
+/* 14896 */ {21,161},
+/* 14897 */ {21,161},
+/* 14898 */ {21,161},
+/* 14899 */ {21,161},
+/* 14900 */ {21,161},
+/* 14901 */ {21,161},
+/* 14902 */ {21,161},
+/* 14903 */ {21,161},
+/* 14904 */ {21,161},
+/* 14905 */ {21,161},
+/* 14906 */ {21,161},
+/* 14907 */ {21,161},
+/* 14908 */ {21,161},
+/* 14909 */ {21,161},
+/* 14910 */ {21,161},
+/* 14911 */ {21,161},
+/* 14912 */ {21,161},
+/* 14913 */ {21,161},
+/* 14914 */ {21,161},
+/* 14915 */ {21,161},
+/* 14916 */ {21,161},
+/* 14917 */ {21,161},
+/* 14918 */ {21,161},
+/* 14919 */ {21,161},
+/* 14920 */ {21,161},
+/* 14921 */ {21,161},
+/* 14922 */ {21,161},
+/* 14923 */ {21,161},
+/* 14924 */ {21,161},
+/* 14925 */ {21,161},
+/* 14926 */ {21,161},
+/* 14927 */ {21,161},
+/* 14928 */ {21,161},
+/* 14929 */ {21,161},
+/* 14930 */ {21,161},
+/* 14931 */ {21,161},
+/* 14932 */ {21,161},
+/* 14933 */ {21,161},
+/* 14934 */ {21,161},
+/* 14935 */ {21,161},
+/* 14936 */ {21,161},
+/* 14937 */ {21,161},
+/* 14938 */ {21,161},
+/* 14939 */ {21,161},
+/* 14940 */ {21,161},
+/* 14941 */ {21,161},
+/* 14942 */ {21,161},
+/* 14943 */ {21,161},
+/* 14944 */ {21,161},
+/* 14945 */ {21,161},
+/* 14946 */ {21,161},
+/* 14947 */ {21,161},
+/* 14948 */ {21,161},
+/* 14949 */ {21,161},
+/* 14950 */ {21,161},
+/* 14951 */ {21,161},
+/* 14952 */ {21,161},
+/* 14953 */ {21,161},
+/* 14954 */ {21,161},
+/* 14955 */ {21,161},
+/* 14956 */ {21,161},
+/* 14957 */ {21,161},
+/* 14958 */ {21,161},
+/* 14959 */ {21,161},
+/* 14960 */ {21,161},
+/* 14961 */ {21,161},
+/* 14962 */ {21,161},
+/* 14963 */ {21,161},
+/* 14964 */ {21,161},
+/* 14965 */ {21,161},
+/* 14966 */ {21,161},
+/* 14967 */ {21,161},
+/* 14968 */ {21,161},
+/* 14969 */ {21,161},
+/* 14970 */ {21,161},
+/* 14971 */ {21,161},
+/* 14972 */ {21,161},
+/* 14973 */ {21,161},
+/* 14974 */ {21,161},
+/* 14975 */ {21,161},
+/* 14976 */ {21,161},
+/* 14977 */ {21,161},
+/* 14978 */ {21,161},
+/* 14979 */ {21,161},
+/* 14980 */ {21,161},
+/* 14981 */ {21,161},
+/* 14982 */ {21,161},
+/* 14983 */ {21,161},
+/* 14984 */ {21,161},
+/* 14985 */ {21,161},
+/* 14986 */ {21,161},
+/* 14987 */ {21,161},
+/* 14988 */ {21,161},
+/* 14989 */ {21,161},
+/* 14990 */ {21,161},
+/* 14991 */ {21,161},
+/* 14992 */ {21,161},
+/* 14993 */ {21,161},
+/* 14994 */ {21,161},
+/* 14995 */ {21,161},
+/* 14996 */ {21,161},
+/* 14997 */ {21,161},
+/* 14998 */ {21,161},
+/* 14999 */ {21,161},
+/* 15000 */ {21,161},
+/* 15001 */ {21,161},
+/* 15002 */ {21,161},
+/* 15003 */ {21,161},
+/* 15004 */ {21,161},
+/* 15005 */ {21,161},
+/* 15006 */ {21,161},
+/* 15007 */ {21,161},
+/* 15008 */ {21,161},
+/* 15009 */ {21,161},
+/* 15010 */ {21,161},
+/* 15011 */ {21,161},
+/* 15012 */ {21,161},
+/* 15013 */ {21,161},
+/* 15014 */ {21,161},
+/* 15015 */ {21,161},
+/* 15016 */ {21,161},
+/* 15017 */ {21,161},
+/* 15018 */ {21,161},
+/* 15019 */ {21,161},
+/* 15020 */ {21,161},
+/* 15021 */ {21,161},
+/* 15022 */ {21,161},
+/* 15023 */ {21,161},
+/* 15024 */ {21,161},
+/* 15025 */ {21,161},
+/* 15026 */ {21,161},
+/* 15027 */ {21,161},
+/* 15028 */ {21,161},
+/* 15029 */ {21,161},
+/* 15030 */ {21,161},
+/* 15031 */ {21,161},
+/* 15032 */ {21,161},
+/* 15033 */ {21,161},
+/* 15034 */ {21,161},
+/* 15035 */ {21,161},
+/* 15036 */ {21,161},
+/* 15037 */ {21,161},
+/* 15038 */ {21,161},
+/* 15039 */ {21,161},
+/* 15040 */ {21,161},
+/* 15041 */ {21,161},
+/* 15042 */ {21,161},
+/* 15043 */ {21,161},
+/* 15044 */ {21,161},
+/* 15045 */ {21,161},
+/* 15046 */ {21,161},
+/* 15047 */ {21,161},
+/* 15048 */ {21,161},
+/* 15049 */ {21,161},
+/* 15050 */ {21,161},
+/* 15051 */ {21,161},
+/* 15052 */ {21,161},
+/* 15053 */ {21,161},
+/* 15054 */ {21,161},
+/* 15055 */ {21,161},
+/* 15056 */ {21,161},
+/* 15057 */ {21,161},
+/* 15058 */ {21,161},
+/* 15059 */ {21,161},
+/* 15060 */ {21,161},
+/* 15061 */ {21,161},
+/* 15062 */ {21,161},
+/* 15063 */ {21,161},
+/* 15064 */ {21,161},
+/* 15065 */ {21,161},
+/* 15066 */ {21,161},
+/* 15067 */ {21,161},
+/* 15068 */ {21,161},
+/* 15069 */ {21,161},
+/* 15070 */ {21,161},
+/* 15071 */ {21,161},
+/* 15072 */ {21,161},
+/* 15073 */ {21,161},
+/* 15074 */ {21,161},
+/* 15075 */ {21,161},
+/* 15076 */ {21,161},
+/* 15077 */ {21,161},
+/* 15078 */ {21,161},
+/* 15079 */ {21,161},
+/* 15080 */ {21,161},
+/* 15081 */ {21,161},
+/* 15082 */ {21,161},
+/* 15083 */ {21,161},
+/* 15084 */ {21,161},
+/* 15085 */ {21,161},
+/* 15086 */ {21,161},
+/* 15087 */ {21,161},
+/* 15088 */ {21,161},
+/* 15089 */ {21,161},
+/* 15090 */ {21,161},
+/* 15091 */ {21,161},
+/* 15092 */ {21,161},
+/* 15093 */ {21,161},
+/* 15094 */ {21,161},
+/* 15095 */ {21,161},
+/* 15096 */ {21,161},
+/* 15097 */ {21,161},
+/* 15098 */ {21,161},
+/* 15099 */ {21,161},
+/* 15100 */ {21,161},
+/* 15101 */ {21,161},
+/* 15102 */ {21,161},
+/* 15103 */ {21,161},
+/* 15104 */ {21,161},
+/* 15105 */ {21,161},
+/* 15106 */ {21,161},
+/* 15107 */ {21,161},
+/* 15108 */ {21,161},
+/* 15109 */ {21,161},
+/* 15110 */ {21,161},
+/* 15111 */ {21,161},
+/* 15112 */ {21,161},
+/* 15113 */ {21,161},
+/* 15114 */ {21,161},
+/* 15115 */ {21,161},
+/* 15116 */ {21,161},
+/* 15117 */ {21,161},
+/* 15118 */ {21,161},
+/* 15119 */ {21,161},
+/* 15120 */ {21,161},
+/* 15121 */ {21,161},
+/* 15122 */ {21,161},
+/* 15123 */ {21,161},
+/* 15124 */ {21,161},
+/* 15125 */ {21,161},
+/* 15126 */ {21,161},
+/* 15127 */ {21,161},
+/* 15128 */ {21,161},
+/* 15129 */ {21,161},
+/* 15130 */ {21,161},
+/* 15131 */ {21,161},
+/* 15132 */ {21,161},
+/* 15133 */ {21,161},
+/* 15134 */ {21,161},
+/* 15135 */ {21,161},
+/* 15136 */ {21,161},
+/* 15137 */ {21,161},
+/* 15138 */ {21,161},
+/* 15139 */ {21,161},
+/* 15140 */ {21,161},
+/* 15141 */ {21,161},
+/* 15142 */ {21,161},
+/* 15143 */ {21,161},
+/* 15144 */ {21,161},
+/* 15145 */ {21,161},
+/* 15146 */ {21,161},
+/* 15147 */ {21,161},
+/* 15148 */ {21,161},
+/* 15149 */ {21,161},
+/* 15150 */ {21,161},
+/* 15151 */ {21,161},
+/* 15152 */ {21,161},
+/* 15153 */ {21,161},
+/* 15154 */ {21,161},
+/* 15155 */ {21,161},
+/* 15156 */ {21,161},
+/* 15157 */ {21,161},
+/* 15158 */ {21,161},
+/* 15159 */ {21,161},
+/* 15160 */ {21,161},
+/* 15161 */ {21,161},
+/* 15162 */ {21,161},
+/* 15163 */ {21,161},
+/* 15164 */ {21,161},
+/* 15165 */ {21,161},
+/* 15166 */ {21,161},
+/* 15167 */ {21,161},
+/* 15168 */ {21,161},
+/* 15169 */ {21,161},
+/* 15170 */ {21,161},
+/* 15171 */ {21,161},
+/* 15172 */ {21,161},
+/* 15173 */ {21,161},
+/* 15174 */ {21,161},
+/* 15175 */ {21,161},
+/* 15176 */ {21,161},
+/* 15177 */ {21,161},
+/* 15178 */ {21,161},
+/* 15179 */ {21,161},
+/* 15180 */ {21,161},
+/* 15181 */ {21,161},
+/* 15182 */ {21,161},
+/* 15183 */ {21,161},
+/* 15184 */ {21,161},
+/* 15185 */ {21,161},
+/* 15186 */ {21,161},
+/* 15187 */ {21,161},
+/* 15188 */ {21,161},
+/* 15189 */ {21,161},
+/* 15190 */ {21,161},
+/* 15191 */ {21,161},
+/* 15192 */ {21,161},
+/* 15193 */ {21,161},
+/* 15194 */ {21,161},
+/* 15195 */ {21,161},
+/* 15196 */ {21,161},
+/* 15197 */ {21,161},
+/* 15198 */ {21,161},
+/* 15199 */ {21,161},
+/* 15200 */ {21,161},
+/* 15201 */ {21,161},
+/* 15202 */ {21,161},
+/* 15203 */ {21,161},
+/* 15204 */ {21,161},
+/* 15205 */ {21,161},
+/* 15206 */ {21,161},
+/* 15207 */ {21,161},
+/* 15208 */ {21,161},
+/* 15209 */ {21,161},
+/* 15210 */ {21,161},
+/* 15211 */ {21,161},
+/* 15212 */ {21,161},
+/* 15213 */ {21,161},
+/* 15214 */ {21,161},
+/* 15215 */ {21,161},
+/* 15216 */ {21,161},
+/* 15217 */ {21,161},
+/* 15218 */ {21,161},
+/* 15219 */ {21,161},
+/* 15220 */ {21,161},
+/* 15221 */ {21,161},
+/* 15222 */ {21,161},
+/* 15223 */ {21,161},
+/* 15224 */ {21,161},
+/* 15225 */ {21,161},
+/* 15226 */ {21,161},
+/* 15227 */ {21,161},
+/* 15228 */ {21,161},
+/* 15229 */ {21,161},
+/* 15230 */ {21,161},
+/* 15231 */ {21,161},
+/* 15232 */ {21,161},
+/* 15233 */ {21,161},
+/* 15234 */ {21,161},
+/* 15235 */ {21,161},
+/* 15236 */ {21,161},
+/* 15237 */ {21,161},
+/* 15238 */ {21,161},
+/* 15239 */ {21,161},
+/* 15240 */ {21,161},
+/* 15241 */ {21,161},
+/* 15242 */ {21,161},
+/* 15243 */ {21,161},
+/* 15244 */ {21,161},
+/* 15245 */ {21,161},
+/* 15246 */ {21,161},
+/* 15247 */ {21,161},
+/* 15248 */ {21,161},
+/* 15249 */ {21,161},
+/* 15250 */ {21,161},
+/* 15251 */ {21,161},
+/* 15252 */ {21,161},
+/* 15253 */ {21,161},
+/* 15254 */ {21,161},
+/* 15255 */ {21,161},
+/* 15256 */ {21,161},
+/* 15257 */ {21,161},
+/* 15258 */ {21,161},
+/* 15259 */ {21,161},
+/* 15260 */ {21,161},
+/* 15261 */ {21,161},
+/* 15262 */ {21,161},
+/* 15263 */ {21,161},
+/* 15264 */ {21,161},
+/* 15265 */ {21,161},
+/* 15266 */ {21,161},
+/* 15267 */ {21,161},
+/* 15268 */ {21,161},
+/* 15269 */ {21,161},
+/* 15270 */ {21,161},
+/* 15271 */ {21,161},
+/* 15272 */ {21,161},
+/* 15273 */ {21,161},
+/* 15274 */ {21,161},
+/* 15275 */ {21,161},
+/* 15276 */ {21,161},
+/* 15277 */ {21,161},
+/* 15278 */ {21,161},
+/* 15279 */ {21,161},
+/* 15280 */ {21,161},
+/* 15281 */ {21,161},
+/* 15282 */ {21,161},
+/* 15283 */ {21,161},
+/* 15284 */ {21,161},
+/* 15285 */ {21,161},
+/* 15286 */ {21,161},
+/* 15287 */ {21,161},
+/* 15288 */ {21,161},
+/* 15289 */ {21,161},
+/* 15290 */ {21,161},
+/* 15291 */ {21,161},
+/* 15292 */ {21,161},
+/* 15293 */ {21,161},
+/* 15294 */ {21,161},
+/* 15295 */ {21,161},
+/* 15296 */ {21,161},
+/* 15297 */ {21,161},
+/* 15298 */ {21,161},
+/* 15299 */ {21,161},
+/* 15300 */ {21,161},
+/* 15301 */ {21,161},
+/* 15302 */ {21,161},
+/* 15303 */ {21,161},
+/* 15304 */ {21,161},
+/* 15305 */ {21,161},
+/* 15306 */ {21,161},
+/* 15307 */ {21,161},
+/* 15308 */ {21,161},
+/* 15309 */ {21,161},
+/* 15310 */ {21,161},
+/* 15311 */ {21,161},
+/* 15312 */ {21,161},
+/* 15313 */ {21,161},
+/* 15314 */ {21,161},
+/* 15315 */ {21,161},
+/* 15316 */ {21,161},
+/* 15317 */ {21,161},
+/* 15318 */ {21,161},
+/* 15319 */ {21,161},
+/* 15320 */ {21,161},
+/* 15321 */ {21,161},
+/* 15322 */ {21,161},
+/* 15323 */ {21,161},
+/* 15324 */ {21,161},
+/* 15325 */ {21,161},
+/* 15326 */ {21,161},
+/* 15327 */ {21,161},
+/* 15328 */ {21,161},
+/* 15329 */ {21,161},
+/* 15330 */ {21,161},
+/* 15331 */ {21,161},
+/* 15332 */ {21,161},
+/* 15333 */ {21,161},
+/* 15334 */ {21,161},
+/* 15335 */ {21,161},
+/* 15336 */ {21,161},
+/* 15337 */ {21,161},
+/* 15338 */ {21,161},
+/* 15339 */ {21,161},
+/* 15340 */ {21,161},
+/* 15341 */ {21,161},
+/* 15342 */ {21,161},
+/* 15343 */ {21,161},
+/* 15344 */ {21,161},
+/* 15345 */ {21,161},
+/* 15346 */ {21,161},
+/* 15347 */ {21,161},
+/* 15348 */ {21,161},
+/* 15349 */ {21,161},
+/* 15350 */ {21,161},
+/* 15351 */ {21,161},
+/* 15352 */ {21,161},
+/* 15353 */ {21,161},
+/* 15354 */ {21,161},
+/* 15355 */ {21,161},
+/* 15356 */ {21,161},
+/* 15357 */ {21,161},
+/* 15358 */ {21,161},
+/* 15359 */ {21,161},
+/* 15360 */ {21,167},
+/* 15361 */ {21,167},
+/* 15362 */ {21,167},
+/* 15363 */ {21,167},
+/* 15364 */ {21,167},
+/* 15365 */ {21,167},
+/* 15366 */ {21,167},
+/* 15367 */ {21,167},
+/* 15368 */ {21,167},
+/* 15369 */ {21,167},
+/* 15370 */ {21,167},
+/* 15371 */ {21,167},
+/* 15372 */ {21,167},
+/* 15373 */ {21,167},
+/* 15374 */ {21,167},
+/* 15375 */ {21,167},
+/* 15376 */ {21,167},
+/* 15377 */ {21,167},
+/* 15378 */ {21,167},
+/* 15379 */ {21,167},
+/* 15380 */ {21,167},
+/* 15381 */ {21,167},
+/* 15382 */ {21,167},
+/* 15383 */ {21,167},
+/* 15384 */ {21,167},
+/* 15385 */ {21,167},
+/* 15386 */ {21,167},
+/* 15387 */ {21,167},
+/* 15388 */ {21,167},
+/* 15389 */ {21,167},
+/* 15390 */ {21,167},
+/* 15391 */ {21,167},
+/* 15392 */ {21,167},
+/* 15393 */ {21,167},
+/* 15394 */ {21,167},
+/* 15395 */ {21,167},
+/* 15396 */ {21,167},
+/* 15397 */ {21,167},
+/* 15398 */ {21,167},
+/* 15399 */ {21,167},
+/* 15400 */ {21,167},
+/* 15401 */ {21,167},
+/* 15402 */ {21,167},
+/* 15403 */ {21,167},
+/* 15404 */ {21,167},
+/* 15405 */ {21,167},
+/* 15406 */ {21,167},
+/* 15407 */ {21,167},
+/* 15408 */ {21,167},
+/* 15409 */ {21,167},
+/* 15410 */ {21,167},
+/* 15411 */ {21,167},
+/* 15412 */ {21,167},
+/* 15413 */ {21,167},
+/* 15414 */ {21,167},
+/* 15415 */ {21,167},
+/* 15416 */ {21,167},
+/* 15417 */ {21,167},
+/* 15418 */ {21,167},
+/* 15419 */ {21,167},
+/* 15420 */ {21,167},
+/* 15421 */ {21,167},
+/* 15422 */ {21,167},
+/* 15423 */ {21,167},
+/* 15424 */ {21,167},
+/* 15425 */ {21,167},
+/* 15426 */ {21,167},
+/* 15427 */ {21,167},
+/* 15428 */ {21,167},
+/* 15429 */ {21,167},
+/* 15430 */ {21,167},
+/* 15431 */ {21,167},
+/* 15432 */ {21,167},
+/* 15433 */ {21,167},
+/* 15434 */ {21,167},
+/* 15435 */ {21,167},
+/* 15436 */ {21,167},
+/* 15437 */ {21,167},
+/* 15438 */ {21,167},
+/* 15439 */ {21,167},
+/* 15440 */ {21,167},
+/* 15441 */ {21,167},
+/* 15442 */ {21,167},
+/* 15443 */ {21,167},
+/* 15444 */ {21,167},
+/* 15445 */ {21,167},
+/* 15446 */ {21,167},
+/* 15447 */ {21,167},
+/* 15448 */ {21,167},
+/* 15449 */ {21,167},
+/* 15450 */ {21,167},
+/* 15451 */ {21,167},
+/* 15452 */ {21,167},
+/* 15453 */ {21,167},
+/* 15454 */ {21,167},
+/* 15455 */ {21,167},
+/* 15456 */ {21,167},
+/* 15457 */ {21,167},
+/* 15458 */ {21,167},
+/* 15459 */ {21,167},
+/* 15460 */ {21,167},
+/* 15461 */ {21,167},
+/* 15462 */ {21,167},
+/* 15463 */ {21,167},
+/* 15464 */ {21,167},
+/* 15465 */ {21,167},
+/* 15466 */ {21,167},
+/* 15467 */ {21,167},
+/* 15468 */ {21,167},
+/* 15469 */ {21,167},
+/* 15470 */ {21,167},
+/* 15471 */ {21,167},
+/* 15472 */ {21,167},
+/* 15473 */ {21,167},
+/* 15474 */ {21,167},
+/* 15475 */ {21,167},
+/* 15476 */ {21,167},
+/* 15477 */ {21,167},
+/* 15478 */ {21,167},
+/* 15479 */ {21,167},
+/* 15480 */ {21,167},
+/* 15481 */ {21,167},
+/* 15482 */ {21,167},
+/* 15483 */ {21,167},
+/* 15484 */ {21,167},
+/* 15485 */ {21,167},
+/* 15486 */ {21,167},
+/* 15487 */ {21,167},
+/* 15488 */ {21,167},
+/* 15489 */ {21,167},
+/* 15490 */ {21,167},
+/* 15491 */ {21,167},
+/* 15492 */ {21,167},
+/* 15493 */ {21,167},
+/* 15494 */ {21,167},
+/* 15495 */ {21,167},
+/* 15496 */ {21,167},
+/* 15497 */ {21,167},
+/* 15498 */ {21,167},
+/* 15499 */ {21,167},
+/* 15500 */ {21,167},
+/* 15501 */ {21,167},
+/* 15502 */ {21,167},
+/* 15503 */ {21,167},
+/* 15504 */ {21,167},
+/* 15505 */ {21,167},
+/* 15506 */ {21,167},
+/* 15507 */ {21,167},
+/* 15508 */ {21,167},
+/* 15509 */ {21,167},
+/* 15510 */ {21,167},
+/* 15511 */ {21,167},
+/* 15512 */ {21,167},
+/* 15513 */ {21,167},
+/* 15514 */ {21,167},
+/* 15515 */ {21,167},
+/* 15516 */ {21,167},
+/* 15517 */ {21,167},
+/* 15518 */ {21,167},
+/* 15519 */ {21,167},
+/* 15520 */ {21,167},
+/* 15521 */ {21,167},
+/* 15522 */ {21,167},
+/* 15523 */ {21,167},
+/* 15524 */ {21,167},
+/* 15525 */ {21,167},
+/* 15526 */ {21,167},
+/* 15527 */ {21,167},
+/* 15528 */ {21,167},
+/* 15529 */ {21,167},
+/* 15530 */ {21,167},
+/* 15531 */ {21,167},
+/* 15532 */ {21,167},
+/* 15533 */ {21,167},
+/* 15534 */ {21,167},
+/* 15535 */ {21,167},
+/* 15536 */ {21,167},
+/* 15537 */ {21,167},
+/* 15538 */ {21,167},
+/* 15539 */ {21,167},
+/* 15540 */ {21,167},
+/* 15541 */ {21,167},
+/* 15542 */ {21,167},
+/* 15543 */ {21,167},
+/* 15544 */ {21,167},
+/* 15545 */ {21,167},
+/* 15546 */ {21,167},
+/* 15547 */ {21,167},
+/* 15548 */ {21,167},
+/* 15549 */ {21,167},
+/* 15550 */ {21,167},
+/* 15551 */ {21,167},
+/* 15552 */ {21,167},
+/* 15553 */ {21,167},
+/* 15554 */ {21,167},
+/* 15555 */ {21,167},
+/* 15556 */ {21,167},
+/* 15557 */ {21,167},
+/* 15558 */ {21,167},
+/* 15559 */ {21,167},
+/* 15560 */ {21,167},
+/* 15561 */ {21,167},
+/* 15562 */ {21,167},
+/* 15563 */ {21,167},
+/* 15564 */ {21,167},
+/* 15565 */ {21,167},
+/* 15566 */ {21,167},
+/* 15567 */ {21,167},
+/* 15568 */ {21,167},
+/* 15569 */ {21,167},
+/* 15570 */ {21,167},
+/* 15571 */ {21,167},
+/* 15572 */ {21,167},
+/* 15573 */ {21,167},
+/* 15574 */ {21,167},
+/* 15575 */ {21,167},
+/* 15576 */ {21,167},
+/* 15577 */ {21,167},
+/* 15578 */ {21,167},
+/* 15579 */ {21,167},
+/* 15580 */ {21,167},
+/* 15581 */ {21,167},
+/* 15582 */ {21,167},
+/* 15583 */ {21,167},
+/* 15584 */ {21,167},
+/* 15585 */ {21,167},
+/* 15586 */ {21,167},
+/* 15587 */ {21,167},
+/* 15588 */ {21,167},
+/* 15589 */ {21,167},
+/* 15590 */ {21,167},
+/* 15591 */ {21,167},
+/* 15592 */ {21,167},
+/* 15593 */ {21,167},
+/* 15594 */ {21,167},
+/* 15595 */ {21,167},
+/* 15596 */ {21,167},
+/* 15597 */ {21,167},
+/* 15598 */ {21,167},
+/* 15599 */ {21,167},
+/* 15600 */ {21,167},
+/* 15601 */ {21,167},
+/* 15602 */ {21,167},
+/* 15603 */ {21,167},
+/* 15604 */ {21,167},
+/* 15605 */ {21,167},
+/* 15606 */ {21,167},
+/* 15607 */ {21,167},
+/* 15608 */ {21,167},
+/* 15609 */ {21,167},
+/* 15610 */ {21,167},
+/* 15611 */ {21,167},
+/* 15612 */ {21,167},
+/* 15613 */ {21,167},
+/* 15614 */ {21,167},
+/* 15615 */ {21,167},
+/* 15616 */ {21,167},
+/* 15617 */ {21,167},
+/* 15618 */ {21,167},
+/* 15619 */ {21,167},
+/* 15620 */ {21,167},
+/* 15621 */ {21,167},
+/* 15622 */ {21,167},
+/* 15623 */ {21,167},
+/* 15624 */ {21,167},
+/* 15625 */ {21,167},
+/* 15626 */ {21,167},
+/* 15627 */ {21,167},
+/* 15628 */ {21,167},
+/* 15629 */ {21,167},
+/* 15630 */ {21,167},
+/* 15631 */ {21,167},
+/* 15632 */ {21,167},
+/* 15633 */ {21,167},
+/* 15634 */ {21,167},
+/* 15635 */ {21,167},
+/* 15636 */ {21,167},
+/* 15637 */ {21,167},
+/* 15638 */ {21,167},
+/* 15639 */ {21,167},
+/* 15640 */ {21,167},
+/* 15641 */ {21,167},
+/* 15642 */ {21,167},
+/* 15643 */ {21,167},
+/* 15644 */ {21,167},
+/* 15645 */ {21,167},
+/* 15646 */ {21,167},
+/* 15647 */ {21,167},
+/* 15648 */ {21,167},
+/* 15649 */ {21,167},
+/* 15650 */ {21,167},
+/* 15651 */ {21,167},
+/* 15652 */ {21,167},
+/* 15653 */ {21,167},
+/* 15654 */ {21,167},
+/* 15655 */ {21,167},
+/* 15656 */ {21,167},
+/* 15657 */ {21,167},
+/* 15658 */ {21,167},
+/* 15659 */ {21,167},
+/* 15660 */ {21,167},
+/* 15661 */ {21,167},
+/* 15662 */ {21,167},
+/* 15663 */ {21,167},
+/* 15664 */ {21,167},
+/* 15665 */ {21,167},
+/* 15666 */ {21,167},
+/* 15667 */ {21,167},
+/* 15668 */ {21,167},
+/* 15669 */ {21,167},
+/* 15670 */ {21,167},
+/* 15671 */ {21,167},
+/* 15672 */ {21,167},
+/* 15673 */ {21,167},
+/* 15674 */ {21,167},
+/* 15675 */ {21,167},
+/* 15676 */ {21,167},
+/* 15677 */ {21,167},
+/* 15678 */ {21,167},
+/* 15679 */ {21,167},
+/* 15680 */ {21,167},
+/* 15681 */ {21,167},
+/* 15682 */ {21,167},
+/* 15683 */ {21,167},
+/* 15684 */ {21,167},
+/* 15685 */ {21,167},
+/* 15686 */ {21,167},
+/* 15687 */ {21,167},
+/* 15688 */ {21,167},
+/* 15689 */ {21,167},
+/* 15690 */ {21,167},
+/* 15691 */ {21,167},
+/* 15692 */ {21,167},
+/* 15693 */ {21,167},
+/* 15694 */ {21,167},
+/* 15695 */ {21,167},
+/* 15696 */ {21,167},
+/* 15697 */ {21,167},
+/* 15698 */ {21,167},
+/* 15699 */ {21,167},
+/* 15700 */ {21,167},
+/* 15701 */ {21,167},
+/* 15702 */ {21,167},
+/* 15703 */ {21,167},
+/* 15704 */ {21,167},
+/* 15705 */ {21,167},
+/* 15706 */ {21,167},
+/* 15707 */ {21,167},
+/* 15708 */ {21,167},
+/* 15709 */ {21,167},
+/* 15710 */ {21,167},
+/* 15711 */ {21,167},
+/* 15712 */ {21,167},
+/* 15713 */ {21,167},
+/* 15714 */ {21,167},
+/* 15715 */ {21,167},
+/* 15716 */ {21,167},
+/* 15717 */ {21,167},
+/* 15718 */ {21,167},
+/* 15719 */ {21,167},
+/* 15720 */ {21,167},
+/* 15721 */ {21,167},
+/* 15722 */ {21,167},
+/* 15723 */ {21,167},
+/* 15724 */ {21,167},
+/* 15725 */ {21,167},
+/* 15726 */ {21,167},
+/* 15727 */ {21,167},
+/* 15728 */ {21,167},
+/* 15729 */ {21,167},
+/* 15730 */ {21,167},
+/* 15731 */ {21,167},
+/* 15732 */ {21,167},
+/* 15733 */ {21,167},
+/* 15734 */ {21,167},
+/* 15735 */ {21,167},
+/* 15736 */ {21,167},
+/* 15737 */ {21,167},
+/* 15738 */ {21,167},
+/* 15739 */ {21,167},
+/* 15740 */ {21,167},
+/* 15741 */ {21,167},
+/* 15742 */ {21,167},
+/* 15743 */ {21,167},
+/* 15744 */ {21,167},
+/* 15745 */ {21,167},
+/* 15746 */ {21,167},
+/* 15747 */ {21,167},
+/* 15748 */ {21,167},
+/* 15749 */ {21,167},
+/* 15750 */ {21,167},
+/* 15751 */ {21,167},
+/* 15752 */ {21,167},
+/* 15753 */ {21,167},
+/* 15754 */ {21,167},
+/* 15755 */ {21,167},
+/* 15756 */ {21,167},
+/* 15757 */ {21,167},
+/* 15758 */ {21,167},
+/* 15759 */ {21,167},
+/* 15760 */ {21,167},
+/* 15761 */ {21,167},
+/* 15762 */ {21,167},
+/* 15763 */ {21,167},
+/* 15764 */ {21,167},
+/* 15765 */ {21,167},
+/* 15766 */ {21,167},
+/* 15767 */ {21,167},
+/* 15768 */ {21,167},
+/* 15769 */ {21,167},
+/* 15770 */ {21,167},
+/* 15771 */ {21,167},
+/* 15772 */ {21,167},
+/* 15773 */ {21,167},
+/* 15774 */ {21,167},
+/* 15775 */ {21,167},
+/* 15776 */ {21,167},
+/* 15777 */ {21,167},
+/* 15778 */ {21,167},
+/* 15779 */ {21,167},
+/* 15780 */ {21,167},
+/* 15781 */ {21,167},
+/* 15782 */ {21,167},
+/* 15783 */ {21,167},
+/* 15784 */ {21,167},
+/* 15785 */ {21,167},
+/* 15786 */ {21,167},
+/* 15787 */ {21,167},
+/* 15788 */ {21,167},
+/* 15789 */ {21,167},
+/* 15790 */ {21,167},
+/* 15791 */ {21,167},
+/* 15792 */ {21,167},
+/* 15793 */ {21,167},
+/* 15794 */ {21,167},
+/* 15795 */ {21,167},
+/* 15796 */ {21,167},
+/* 15797 */ {21,167},
+/* 15798 */ {21,167},
+/* 15799 */ {21,167},
+/* 15800 */ {21,167},
+/* 15801 */ {21,167},
+/* 15802 */ {21,167},
+/* 15803 */ {21,167},
+/* 15804 */ {21,167},
+/* 15805 */ {21,167},
+/* 15806 */ {21,167},
+/* 15807 */ {21,167},
+/* 15808 */ {21,167},
+/* 15809 */ {21,167},
+/* 15810 */ {21,167},
+/* 15811 */ {21,167},
+/* 15812 */ {21,167},
+/* 15813 */ {21,167},
+/* 15814 */ {21,167},
+/* 15815 */ {21,167},
+/* 15816 */ {21,167},
+/* 15817 */ {21,167},
+/* 15818 */ {21,167},
+/* 15819 */ {21,167},
+/* 15820 */ {21,167},
+/* 15821 */ {21,167},
+/* 15822 */ {21,167},
+/* 15823 */ {21,167},
+/* 15824 */ {21,167},
+/* 15825 */ {21,167},
+/* 15826 */ {21,167},
+/* 15827 */ {21,167},
+/* 15828 */ {21,167},
+/* 15829 */ {21,167},
+/* 15830 */ {21,167},
+/* 15831 */ {21,167},
+/* 15832 */ {21,167},
+/* 15833 */ {21,167},
+/* 15834 */ {21,167},
+/* 15835 */ {21,167},
+/* 15836 */ {21,167},
+/* 15837 */ {21,167},
+/* 15838 */ {21,167},
+/* 15839 */ {21,167},
+/* 15840 */ {21,167},
+/* 15841 */ {21,167},
+/* 15842 */ {21,167},
+/* 15843 */ {21,167},
+/* 15844 */ {21,167},
+/* 15845 */ {21,167},
+/* 15846 */ {21,167},
+/* 15847 */ {21,167},
+/* 15848 */ {21,167},
+/* 15849 */ {21,167},
+/* 15850 */ {21,167},
+/* 15851 */ {21,167},
+/* 15852 */ {21,167},
+/* 15853 */ {21,167},
+/* 15854 */ {21,167},
+/* 15855 */ {21,167},
+/* 15856 */ {21,167},
+/* 15857 */ {21,167},
+/* 15858 */ {21,167},
+/* 15859 */ {21,167},
+/* 15860 */ {21,167},
+/* 15861 */ {21,167},
+/* 15862 */ {21,167},
+/* 15863 */ {21,167},
+/* 15864 */ {21,167},
+/* 15865 */ {21,167},
+/* 15866 */ {21,167},
+/* 15867 */ {21,167},
+/* 15868 */ {21,167},
+/* 15869 */ {21,167},
+/* 15870 */ {21,167},
+/* 15871 */ {21,167},
+/* 15872 */ {21,172},
+/* 15873 */ {21,172},
+/* 15874 */ {21,172},
+/* 15875 */ {21,172},
+/* 15876 */ {21,172},
+/* 15877 */ {21,172},
+/* 15878 */ {21,172},
+/* 15879 */ {21,172},
+/* 15880 */ {21,172},
+/* 15881 */ {21,172},
+/* 15882 */ {21,172},
+/* 15883 */ {21,172},
+/* 15884 */ {21,172},
+/* 15885 */ {21,172},
+/* 15886 */ {21,172},
+/* 15887 */ {21,172},
+/* 15888 */ {21,172},
+/* 15889 */ {21,172},
+/* 15890 */ {21,172},
+/* 15891 */ {21,172},
+/* 15892 */ {21,172},
+/* 15893 */ {21,172},
+/* 15894 */ {21,172},
+/* 15895 */ {21,172},
+/* 15896 */ {21,172},
+/* 15897 */ {21,172},
+/* 15898 */ {21,172},
+/* 15899 */ {21,172},
+/* 15900 */ {21,172},
+/* 15901 */ {21,172},
+/* 15902 */ {21,172},
+/* 15903 */ {21,172},
+/* 15904 */ {21,172},
+/* 15905 */ {21,172},
+/* 15906 */ {21,172},
+/* 15907 */ {21,172},
+/* 15908 */ {21,172},
+/* 15909 */ {21,172},
+/* 15910 */ {21,172},
+/* 15911 */ {21,172},
+/* 15912 */ {21,172},
+/* 15913 */ {21,172},
+/* 15914 */ {21,172},
+/* 15915 */ {21,172},
+/* 15916 */ {21,172},
+/* 15917 */ {21,172},
+/* 15918 */ {21,172},
+/* 15919 */ {21,172},
+/* 15920 */ {21,172},
+/* 15921 */ {21,172},
+/* 15922 */ {21,172},
+/* 15923 */ {21,172},
+/* 15924 */ {21,172},
+/* 15925 */ {21,172},
+/* 15926 */ {21,172},
+/* 15927 */ {21,172},
+/* 15928 */ {21,172},
+/* 15929 */ {21,172},
+/* 15930 */ {21,172},
+/* 15931 */ {21,172},
+/* 15932 */ {21,172},
+/* 15933 */ {21,172},
+/* 15934 */ {21,172},
+/* 15935 */ {21,172},
+/* 15936 */ {21,172},
+/* 15937 */ {21,172},
+/* 15938 */ {21,172},
+/* 15939 */ {21,172},
+/* 15940 */ {21,172},
+/* 15941 */ {21,172},
+/* 15942 */ {21,172},
+/* 15943 */ {21,172},
+/* 15944 */ {21,172},
+/* 15945 */ {21,172},
+/* 15946 */ {21,172},
+/* 15947 */ {21,172},
+/* 15948 */ {21,172},
+/* 15949 */ {21,172},
+/* 15950 */ {21,172},
+/* 15951 */ {21,172},
+/* 15952 */ {21,172},
+/* 15953 */ {21,172},
+/* 15954 */ {21,172},
+/* 15955 */ {21,172},
+/* 15956 */ {21,172},
+/* 15957 */ {21,172},
+/* 15958 */ {21,172},
+/* 15959 */ {21,172},
+/* 15960 */ {21,172},
+/* 15961 */ {21,172},
+/* 15962 */ {21,172},
+/* 15963 */ {21,172},
+/* 15964 */ {21,172},
+/* 15965 */ {21,172},
+/* 15966 */ {21,172},
+/* 15967 */ {21,172},
+/* 15968 */ {21,172},
+/* 15969 */ {21,172},
+/* 15970 */ {21,172},
+/* 15971 */ {21,172},
+/* 15972 */ {21,172},
+/* 15973 */ {21,172},
+/* 15974 */ {21,172},
+/* 15975 */ {21,172},
+/* 15976 */ {21,172},
+/* 15977 */ {21,172},
+/* 15978 */ {21,172},
+/* 15979 */ {21,172},
+/* 15980 */ {21,172},
+/* 15981 */ {21,172},
+/* 15982 */ {21,172},
+/* 15983 */ {21,172},
+/* 15984 */ {21,172},
+/* 15985 */ {21,172},
+/* 15986 */ {21,172},
+/* 15987 */ {21,172},
+/* 15988 */ {21,172},
+/* 15989 */ {21,172},
+/* 15990 */ {21,172},
+/* 15991 */ {21,172},
+/* 15992 */ {21,172},
+/* 15993 */ {21,172},
+/* 15994 */ {21,172},
+/* 15995 */ {21,172},
+/* 15996 */ {21,172},
+/* 15997 */ {21,172},
+/* 15998 */ {21,172},
+/* 15999 */ {21,172},
+/* 16000 */ {21,172},
+/* 16001 */ {21,172},
+/* 16002 */ {21,172},
+/* 16003 */ {21,172},
+/* 16004 */ {21,172},
+/* 16005 */ {21,172},
+/* 16006 */ {21,172},
+/* 16007 */ {21,172},
+/* 16008 */ {21,172},
+/* 16009 */ {21,172},
+/* 16010 */ {21,172},
+/* 16011 */ {21,172},
+/* 16012 */ {21,172},
+/* 16013 */ {21,172},
+/* 16014 */ {21,172},
+/* 16015 */ {21,172},
+/* 16016 */ {21,172},
+/* 16017 */ {21,172},
+/* 16018 */ {21,172},
+/* 16019 */ {21,172},
+/* 16020 */ {21,172},
+/* 16021 */ {21,172},
+/* 16022 */ {21,172},
+/* 16023 */ {21,172},
+/* 16024 */ {21,172},
+/* 16025 */ {21,172},
+/* 16026 */ {21,172},
+/* 16027 */ {21,172},
+/* 16028 */ {21,172},
+/* 16029 */ {21,172},
+/* 16030 */ {21,172},
+/* 16031 */ {21,172},
+/* 16032 */ {21,172},
+/* 16033 */ {21,172},
+/* 16034 */ {21,172},
+/* 16035 */ {21,172},
+/* 16036 */ {21,172},
+/* 16037 */ {21,172},
+/* 16038 */ {21,172},
+/* 16039 */ {21,172},
+/* 16040 */ {21,172},
+/* 16041 */ {21,172},
+/* 16042 */ {21,172},
+/* 16043 */ {21,172},
+/* 16044 */ {21,172},
+/* 16045 */ {21,172},
+/* 16046 */ {21,172},
+/* 16047 */ {21,172},
+/* 16048 */ {21,172},
+/* 16049 */ {21,172},
+/* 16050 */ {21,172},
+/* 16051 */ {21,172},
+/* 16052 */ {21,172},
+/* 16053 */ {21,172},
+/* 16054 */ {21,172},
+/* 16055 */ {21,172},
+/* 16056 */ {21,172},
+/* 16057 */ {21,172},
+/* 16058 */ {21,172},
+/* 16059 */ {21,172},
+/* 16060 */ {21,172},
+/* 16061 */ {21,172},
+/* 16062 */ {21,172},
+/* 16063 */ {21,172},
+/* 16064 */ {21,172},
+/* 16065 */ {21,172},
+/* 16066 */ {21,172},
+/* 16067 */ {21,172},
+/* 16068 */ {21,172},
+/* 16069 */ {21,172},
+/* 16070 */ {21,172},
+/* 16071 */ {21,172},
+/* 16072 */ {21,172},
+/* 16073 */ {21,172},
+/* 16074 */ {21,172},
+/* 16075 */ {21,172},
+/* 16076 */ {21,172},
+/* 16077 */ {21,172},
+/* 16078 */ {21,172},
+/* 16079 */ {21,172},
+/* 16080 */ {21,172},
+/* 16081 */ {21,172},
+/* 16082 */ {21,172},
+/* 16083 */ {21,172},
+/* 16084 */ {21,172},
+/* 16085 */ {21,172},
+/* 16086 */ {21,172},
+/* 16087 */ {21,172},
+/* 16088 */ {21,172},
+/* 16089 */ {21,172},
+/* 16090 */ {21,172},
+/* 16091 */ {21,172},
+/* 16092 */ {21,172},
+/* 16093 */ {21,172},
+/* 16094 */ {21,172},
+/* 16095 */ {21,172},
+/* 16096 */ {21,172},
+/* 16097 */ {21,172},
+/* 16098 */ {21,172},
+/* 16099 */ {21,172},
+/* 16100 */ {21,172},
+/* 16101 */ {21,172},
+/* 16102 */ {21,172},
+/* 16103 */ {21,172},
+/* 16104 */ {21,172},
+/* 16105 */ {21,172},
+/* 16106 */ {21,172},
+/* 16107 */ {21,172},
+/* 16108 */ {21,172},
+/* 16109 */ {21,172},
+/* 16110 */ {21,172},
+/* 16111 */ {21,172},
+/* 16112 */ {21,172},
+/* 16113 */ {21,172},
+/* 16114 */ {21,172},
+/* 16115 */ {21,172},
+/* 16116 */ {21,172},
+/* 16117 */ {21,172},
+/* 16118 */ {21,172},
+/* 16119 */ {21,172},
+/* 16120 */ {21,172},
+/* 16121 */ {21,172},
+/* 16122 */ {21,172},
+/* 16123 */ {21,172},
+/* 16124 */ {21,172},
+/* 16125 */ {21,172},
+/* 16126 */ {21,172},
+/* 16127 */ {21,172},
+/* 16128 */ {21,172},
+/* 16129 */ {21,172},
+/* 16130 */ {21,172},
+/* 16131 */ {21,172},
+/* 16132 */ {21,172},
+/* 16133 */ {21,172},
+/* 16134 */ {21,172},
+/* 16135 */ {21,172},
+/* 16136 */ {21,172},
+/* 16137 */ {21,172},
+/* 16138 */ {21,172},
+/* 16139 */ {21,172},
+/* 16140 */ {21,172},
+/* 16141 */ {21,172},
+/* 16142 */ {21,172},
+/* 16143 */ {21,172},
+/* 16144 */ {21,172},
+/* 16145 */ {21,172},
+/* 16146 */ {21,172},
+/* 16147 */ {21,172},
+/* 16148 */ {21,172},
+/* 16149 */ {21,172},
+/* 16150 */ {21,172},
+/* 16151 */ {21,172},
+/* 16152 */ {21,172},
+/* 16153 */ {21,172},
+/* 16154 */ {21,172},
+/* 16155 */ {21,172},
+/* 16156 */ {21,172},
+/* 16157 */ {21,172},
+/* 16158 */ {21,172},
+/* 16159 */ {21,172},
+/* 16160 */ {21,172},
+/* 16161 */ {21,172},
+/* 16162 */ {21,172},
+/* 16163 */ {21,172},
+/* 16164 */ {21,172},
+/* 16165 */ {21,172},
+/* 16166 */ {21,172},
+/* 16167 */ {21,172},
+/* 16168 */ {21,172},
+/* 16169 */ {21,172},
+/* 16170 */ {21,172},
+/* 16171 */ {21,172},
+/* 16172 */ {21,172},
+/* 16173 */ {21,172},
+/* 16174 */ {21,172},
+/* 16175 */ {21,172},
+/* 16176 */ {21,172},
+/* 16177 */ {21,172},
+/* 16178 */ {21,172},
+/* 16179 */ {21,172},
+/* 16180 */ {21,172},
+/* 16181 */ {21,172},
+/* 16182 */ {21,172},
+/* 16183 */ {21,172},
+/* 16184 */ {21,172},
+/* 16185 */ {21,172},
+/* 16186 */ {21,172},
+/* 16187 */ {21,172},
+/* 16188 */ {21,172},
+/* 16189 */ {21,172},
+/* 16190 */ {21,172},
+/* 16191 */ {21,172},
+/* 16192 */ {21,172},
+/* 16193 */ {21,172},
+/* 16194 */ {21,172},
+/* 16195 */ {21,172},
+/* 16196 */ {21,172},
+/* 16197 */ {21,172},
+/* 16198 */ {21,172},
+/* 16199 */ {21,172},
+/* 16200 */ {21,172},
+/* 16201 */ {21,172},
+/* 16202 */ {21,172},
+/* 16203 */ {21,172},
+/* 16204 */ {21,172},
+/* 16205 */ {21,172},
+/* 16206 */ {21,172},
+/* 16207 */ {21,172},
+/* 16208 */ {21,172},
+/* 16209 */ {21,172},
+/* 16210 */ {21,172},
+/* 16211 */ {21,172},
+/* 16212 */ {21,172},
+/* 16213 */ {21,172},
+/* 16214 */ {21,172},
+/* 16215 */ {21,172},
+/* 16216 */ {21,172},
+/* 16217 */ {21,172},
+/* 16218 */ {21,172},
+/* 16219 */ {21,172},
+/* 16220 */ {21,172},
+/* 16221 */ {21,172},
+/* 16222 */ {21,172},
+/* 16223 */ {21,172},
+/* 16224 */ {21,172},
+/* 16225 */ {21,172},
+/* 16226 */ {21,172},
+/* 16227 */ {21,172},
+/* 16228 */ {21,172},
+/* 16229 */ {21,172},
+/* 16230 */ {21,172},
+/* 16231 */ {21,172},
+/* 16232 */ {21,172},
+/* 16233 */ {21,172},
+/* 16234 */ {21,172},
+/* 16235 */ {21,172},
+/* 16236 */ {21,172},
+/* 16237 */ {21,172},
+/* 16238 */ {21,172},
+/* 16239 */ {21,172},
+/* 16240 */ {21,172},
+/* 16241 */ {21,172},
+/* 16242 */ {21,172},
+/* 16243 */ {21,172},
+/* 16244 */ {21,172},
+/* 16245 */ {21,172},
+/* 16246 */ {21,172},
+/* 16247 */ {21,172},
+/* 16248 */ {21,172},
+/* 16249 */ {21,172},
+/* 16250 */ {21,172},
+/* 16251 */ {21,172},
+/* 16252 */ {21,172},
+/* 16253 */ {21,172},
+/* 16254 */ {21,172},
+/* 16255 */ {21,172},
+/* 16256 */ {21,172},
+/* 16257 */ {21,172},
+/* 16258 */ {21,172},
+/* 16259 */ {21,172},
+/* 16260 */ {21,172},
+/* 16261 */ {21,172},
+/* 16262 */ {21,172},
+/* 16263 */ {21,172},
+/* 16264 */ {21,172},
+/* 16265 */ {21,172},
+/* 16266 */ {21,172},
+/* 16267 */ {21,172},
+/* 16268 */ {21,172},
+/* 16269 */ {21,172},
+/* 16270 */ {21,172},
+/* 16271 */ {21,172},
+/* 16272 */ {21,172},
+/* 16273 */ {21,172},
+/* 16274 */ {21,172},
+/* 16275 */ {21,172},
+/* 16276 */ {21,172},
+/* 16277 */ {21,172},
+/* 16278 */ {21,172},
+/* 16279 */ {21,172},
+/* 16280 */ {21,172},
+/* 16281 */ {21,172},
+/* 16282 */ {21,172},
+/* 16283 */ {21,172},
+/* 16284 */ {21,172},
+/* 16285 */ {21,172},
+/* 16286 */ {21,172},
+/* 16287 */ {21,172},
+/* 16288 */ {21,172},
+/* 16289 */ {21,172},
+/* 16290 */ {21,172},
+/* 16291 */ {21,172},
+/* 16292 */ {21,172},
+/* 16293 */ {21,172},
+/* 16294 */ {21,172},
+/* 16295 */ {21,172},
+/* 16296 */ {21,172},
+/* 16297 */ {21,172},
+/* 16298 */ {21,172},
+/* 16299 */ {21,172},
+/* 16300 */ {21,172},
+/* 16301 */ {21,172},
+/* 16302 */ {21,172},
+/* 16303 */ {21,172},
+/* 16304 */ {21,172},
+/* 16305 */ {21,172},
+/* 16306 */ {21,172},
+/* 16307 */ {21,172},
+/* 16308 */ {21,172},
+/* 16309 */ {21,172},
+/* 16310 */ {21,172},
+/* 16311 */ {21,172},
+/* 16312 */ {21,172},
+/* 16313 */ {21,172},
+/* 16314 */ {21,172},
+/* 16315 */ {21,172},
+/* 16316 */ {21,172},
+/* 16317 */ {21,172},
+/* 16318 */ {21,172},
+/* 16319 */ {21,172},
+/* 16320 */ {21,172},
+/* 16321 */ {21,172},
+/* 16322 */ {21,172},
+/* 16323 */ {21,172},
+/* 16324 */ {21,172},
+/* 16325 */ {21,172},
+/* 16326 */ {21,172},
+/* 16327 */ {21,172},
+/* 16328 */ {21,172},
+/* 16329 */ {21,172},
+/* 16330 */ {21,172},
+/* 16331 */ {21,172},
+/* 16332 */ {21,172},
+/* 16333 */ {21,172},
+/* 16334 */ {21,172},
+/* 16335 */ {21,172},
+/* 16336 */ {21,172},
+/* 16337 */ {21,172},
+/* 16338 */ {21,172},
+/* 16339 */ {21,172},
+/* 16340 */ {21,172},
+/* 16341 */ {21,172},
+/* 16342 */ {21,172},
+/* 16343 */ {21,172},
+/* 16344 */ {21,172},
+/* 16345 */ {21,172},
+/* 16346 */ {21,172},
+/* 16347 */ {21,172},
+/* 16348 */ {21,172},
+/* 16349 */ {21,172},
+/* 16350 */ {21,172},
+/* 16351 */ {21,172},
+/* 16352 */ {21,172},
+/* 16353 */ {21,172},
+/* 16354 */ {21,172},
+/* 16355 */ {21,172},
+/* 16356 */ {21,172},
+/* 16357 */ {21,172},
+/* 16358 */ {21,172},
+/* 16359 */ {21,172},
+/* 16360 */ {21,172},
+/* 16361 */ {21,172},
+/* 16362 */ {21,172},
+/* 16363 */ {21,172},
+/* 16364 */ {21,172},
+/* 16365 */ {21,172},
+/* 16366 */ {21,172},
+/* 16367 */ {21,172},
+/* 16368 */ {21,172},
+/* 16369 */ {21,172},
+/* 16370 */ {21,172},
+/* 16371 */ {21,172},
+/* 16372 */ {21,172},
+/* 16373 */ {21,172},
+/* 16374 */ {21,172},
+/* 16375 */ {21,172},
+/* 16376 */ {21,172},
+/* 16377 */ {21,172},
+/* 16378 */ {21,172},
+/* 16379 */ {21,172},
+/* 16380 */ {21,172},
+/* 16381 */ {21,172},
+/* 16382 */ {21,172},
+/* 16383 */ {21,172},
+/* 16384 */ {21,176},
+/* 16385 */ {21,176},
+/* 16386 */ {21,176},
+/* 16387 */ {21,176},
+/* 16388 */ {21,176},
+/* 16389 */ {21,176},
+/* 16390 */ {21,176},
+/* 16391 */ {21,176},
+/* 16392 */ {21,176},
+/* 16393 */ {21,176},
+/* 16394 */ {21,176},
+/* 16395 */ {21,176},
+/* 16396 */ {21,176},
+/* 16397 */ {21,176},
+/* 16398 */ {21,176},
+/* 16399 */ {21,176},
+/* 16400 */ {21,176},
+/* 16401 */ {21,176},
+/* 16402 */ {21,176},
+/* 16403 */ {21,176},
+/* 16404 */ {21,176},
+/* 16405 */ {21,176},
+/* 16406 */ {21,176},
+/* 16407 */ {21,176},
+/* 16408 */ {21,176},
+/* 16409 */ {21,176},
+/* 16410 */ {21,176},
+/* 16411 */ {21,176},
+/* 16412 */ {21,176},
+/* 16413 */ {21,176},
+/* 16414 */ {21,176},
+/* 16415 */ {21,176},
+/* 16416 */ {21,176},
+/* 16417 */ {21,176},
+/* 16418 */ {21,176},
+/* 16419 */ {21,176},
+/* 16420 */ {21,176},
+/* 16421 */ {21,176},
+/* 16422 */ {21,176},
+/* 16423 */ {21,176},
+/* 16424 */ {21,176},
+/* 16425 */ {21,176},
+/* 16426 */ {21,176},
+/* 16427 */ {21,176},
+/* 16428 */ {21,176},
+/* 16429 */ {21,176},
+/* 16430 */ {21,176},
+/* 16431 */ {21,176},
+/* 16432 */ {21,176},
+/* 16433 */ {21,176},
+/* 16434 */ {21,176},
+/* 16435 */ {21,176},
+/* 16436 */ {21,176},
+/* 16437 */ {21,176},
+/* 16438 */ {21,176},
+/* 16439 */ {21,176},
+/* 16440 */ {21,176},
+/* 16441 */ {21,176},
+/* 16442 */ {21,176},
+/* 16443 */ {21,176},
+/* 16444 */ {21,176},
+/* 16445 */ {21,176},
+/* 16446 */ {21,176},
+/* 16447 */ {21,176},
+/* 16448 */ {21,176},
+/* 16449 */ {21,176},
+/* 16450 */ {21,176},
+/* 16451 */ {21,176},
+/* 16452 */ {21,176},
+/* 16453 */ {21,176},
+/* 16454 */ {21,176},
+/* 16455 */ {21,176},
+/* 16456 */ {21,176},
+/* 16457 */ {21,176},
+/* 16458 */ {21,176},
+/* 16459 */ {21,176},
+/* 16460 */ {21,176},
+/* 16461 */ {21,176},
+/* 16462 */ {21,176},
+/* 16463 */ {21,176},
+/* 16464 */ {21,176},
+/* 16465 */ {21,176},
+/* 16466 */ {21,176},
+/* 16467 */ {21,176},
+/* 16468 */ {21,176},
+/* 16469 */ {21,176},
+/* 16470 */ {21,176},
+/* 16471 */ {21,176},
+/* 16472 */ {21,176},
+/* 16473 */ {21,176},
+/* 16474 */ {21,176},
+/* 16475 */ {21,176},
+/* 16476 */ {21,176},
+/* 16477 */ {21,176},
+/* 16478 */ {21,176},
+/* 16479 */ {21,176},
+/* 16480 */ {21,176},
+/* 16481 */ {21,176},
+/* 16482 */ {21,176},
+/* 16483 */ {21,176},
+/* 16484 */ {21,176},
+/* 16485 */ {21,176},
+/* 16486 */ {21,176},
+/* 16487 */ {21,176},
+/* 16488 */ {21,176},
+/* 16489 */ {21,176},
+/* 16490 */ {21,176},
+/* 16491 */ {21,176},
+/* 16492 */ {21,176},
+/* 16493 */ {21,176},
+/* 16494 */ {21,176},
+/* 16495 */ {21,176},
+/* 16496 */ {21,176},
+/* 16497 */ {21,176},
+/* 16498 */ {21,176},
+/* 16499 */ {21,176},
+/* 16500 */ {21,176},
+/* 16501 */ {21,176},
+/* 16502 */ {21,176},
+/* 16503 */ {21,176},
+/* 16504 */ {21,176},
+/* 16505 */ {21,176},
+/* 16506 */ {21,176},
+/* 16507 */ {21,176},
+/* 16508 */ {21,176},
+/* 16509 */ {21,176},
+/* 16510 */ {21,176},
+/* 16511 */ {21,176},
+/* 16512 */ {21,176},
+/* 16513 */ {21,176},
+/* 16514 */ {21,176},
+/* 16515 */ {21,176},
+/* 16516 */ {21,176},
+/* 16517 */ {21,176},
+/* 16518 */ {21,176},
+/* 16519 */ {21,176},
+/* 16520 */ {21,176},
+/* 16521 */ {21,176},
+/* 16522 */ {21,176},
+/* 16523 */ {21,176},
+/* 16524 */ {21,176},
+/* 16525 */ {21,176},
+/* 16526 */ {21,176},
+/* 16527 */ {21,176},
+/* 16528 */ {21,176},
+/* 16529 */ {21,176},
+/* 16530 */ {21,176},
+/* 16531 */ {21,176},
+/* 16532 */ {21,176},
+/* 16533 */ {21,176},
+/* 16534 */ {21,176},
+/* 16535 */ {21,176},
+/* 16536 */ {21,176},
+/* 16537 */ {21,176},
+/* 16538 */ {21,176},
+/* 16539 */ {21,176},
+/* 16540 */ {21,176},
+/* 16541 */ {21,176},
+/* 16542 */ {21,176},
+/* 16543 */ {21,176},
+/* 16544 */ {21,176},
+/* 16545 */ {21,176},
+/* 16546 */ {21,176},
+/* 16547 */ {21,176},
+/* 16548 */ {21,176},
+/* 16549 */ {21,176},
+/* 16550 */ {21,176},
+/* 16551 */ {21,176},
+/* 16552 */ {21,176},
+/* 16553 */ {21,176},
+/* 16554 */ {21,176},
+/* 16555 */ {21,176},
+/* 16556 */ {21,176},
+/* 16557 */ {21,176},
+/* 16558 */ {21,176},
+/* 16559 */ {21,176},
+/* 16560 */ {21,176},
+/* 16561 */ {21,176},
+/* 16562 */ {21,176},
+/* 16563 */ {21,176},
+/* 16564 */ {21,176},
+/* 16565 */ {21,176},
+/* 16566 */ {21,176},
+/* 16567 */ {21,176},
+/* 16568 */ {21,176},
+/* 16569 */ {21,176},
+/* 16570 */ {21,176},
+/* 16571 */ {21,176},
+/* 16572 */ {21,176},
+/* 16573 */ {21,176},
+/* 16574 */ {21,176},
+/* 16575 */ {21,176},
+/* 16576 */ {21,176},
+/* 16577 */ {21,176},
+/* 16578 */ {21,176},
+/* 16579 */ {21,176},
+/* 16580 */ {21,176},
+/* 16581 */ {21,176},
+/* 16582 */ {21,176},
+/* 16583 */ {21,176},
+/* 16584 */ {21,176},
+/* 16585 */ {21,176},
+/* 16586 */ {21,176},
+/* 16587 */ {21,176},
+/* 16588 */ {21,176},
+/* 16589 */ {21,176},
+/* 16590 */ {21,176},
+/* 16591 */ {21,176},
+/* 16592 */ {21,176},
+/* 16593 */ {21,176},
+/* 16594 */ {21,176},
+/* 16595 */ {21,176},
+/* 16596 */ {21,176},
+/* 16597 */ {21,176},
+/* 16598 */ {21,176},
+/* 16599 */ {21,176},
+/* 16600 */ {21,176},
+/* 16601 */ {21,176},
+/* 16602 */ {21,176},
+/* 16603 */ {21,176},
+/* 16604 */ {21,176},
+/* 16605 */ {21,176},
+/* 16606 */ {21,176},
+/* 16607 */ {21,176},
+/* 16608 */ {21,176},
+/* 16609 */ {21,176},
+/* 16610 */ {21,176},
+/* 16611 */ {21,176},
+/* 16612 */ {21,176},
+/* 16613 */ {21,176},
+/* 16614 */ {21,176},
+/* 16615 */ {21,176},
+/* 16616 */ {21,176},
+/* 16617 */ {21,176},
+/* 16618 */ {21,176},
+/* 16619 */ {21,176},
+/* 16620 */ {21,176},
+/* 16621 */ {21,176},
+/* 16622 */ {21,176},
+/* 16623 */ {21,176},
+/* 16624 */ {21,176},
+/* 16625 */ {21,176},
+/* 16626 */ {21,176},
+/* 16627 */ {21,176},
+/* 16628 */ {21,176},
+/* 16629 */ {21,176},
+/* 16630 */ {21,176},
+/* 16631 */ {21,176},
+/* 16632 */ {21,176},
+/* 16633 */ {21,176},
+/* 16634 */ {21,176},
+/* 16635 */ {21,176},
+/* 16636 */ {21,176},
+/* 16637 */ {21,176},
+/* 16638 */ {21,176},
+/* 16639 */ {21,176},
+/* 16640 */ {21,176},
+/* 16641 */ {21,176},
+/* 16642 */ {21,176},
+/* 16643 */ {21,176},
+/* 16644 */ {21,176},
+/* 16645 */ {21,176},
+/* 16646 */ {21,176},
+/* 16647 */ {21,176},
+/* 16648 */ {21,176},
+/* 16649 */ {21,176},
+/* 16650 */ {21,176},
+/* 16651 */ {21,176},
+/* 16652 */ {21,176},
+/* 16653 */ {21,176},
+/* 16654 */ {21,176},
+/* 16655 */ {21,176},
+/* 16656 */ {21,176},
+/* 16657 */ {21,176},
+/* 16658 */ {21,176},
+/* 16659 */ {21,176},
+/* 16660 */ {21,176},
+/* 16661 */ {21,176},
+/* 16662 */ {21,176},
+/* 16663 */ {21,176},
+/* 16664 */ {21,176},
+/* 16665 */ {21,176},
+/* 16666 */ {21,176},
+/* 16667 */ {21,176},
+/* 16668 */ {21,176},
+/* 16669 */ {21,176},
+/* 16670 */ {21,176},
+/* 16671 */ {21,176},
+/* 16672 */ {21,176},
+/* 16673 */ {21,176},
+/* 16674 */ {21,176},
+/* 16675 */ {21,176},
+/* 16676 */ {21,176},
+/* 16677 */ {21,176},
+/* 16678 */ {21,176},
+/* 16679 */ {21,176},
+/* 16680 */ {21,176},
+/* 16681 */ {21,176},
+/* 16682 */ {21,176},
+/* 16683 */ {21,176},
+/* 16684 */ {21,176},
+/* 16685 */ {21,176},
+/* 16686 */ {21,176},
+/* 16687 */ {21,176},
+/* 16688 */ {21,176},
+/* 16689 */ {21,176},
+/* 16690 */ {21,176},
+/* 16691 */ {21,176},
+/* 16692 */ {21,176},
+/* 16693 */ {21,176},
+/* 16694 */ {21,176},
+/* 16695 */ {21,176},
+/* 16696 */ {21,176},
+/* 16697 */ {21,176},
+/* 16698 */ {21,176},
+/* 16699 */ {21,176},
+/* 16700 */ {21,176},
+/* 16701 */ {21,176},
+/* 16702 */ {21,176},
+/* 16703 */ {21,176},
+/* 16704 */ {21,176},
+/* 16705 */ {21,176},
+/* 16706 */ {21,176},
+/* 16707 */ {21,176},
+/* 16708 */ {21,176},
+/* 16709 */ {21,176},
+/* 16710 */ {21,176},
+/* 16711 */ {21,176},
+/* 16712 */ {21,176},
+/* 16713 */ {21,176},
+/* 16714 */ {21,176},
+/* 16715 */ {21,176},
+/* 16716 */ {21,176},
+/* 16717 */ {21,176},
+/* 16718 */ {21,176},
+/* 16719 */ {21,176},
+/* 16720 */ {21,176},
+/* 16721 */ {21,176},
+/* 16722 */ {21,176},
+/* 16723 */ {21,176},
+/* 16724 */ {21,176},
+/* 16725 */ {21,176},
+/* 16726 */ {21,176},
+/* 16727 */ {21,176},
+/* 16728 */ {21,176},
+/* 16729 */ {21,176},
+/* 16730 */ {21,176},
+/* 16731 */ {21,176},
+/* 16732 */ {21,176},
+/* 16733 */ {21,176},
+/* 16734 */ {21,176},
+/* 16735 */ {21,176},
+/* 16736 */ {21,176},
+/* 16737 */ {21,176},
+/* 16738 */ {21,176},
+/* 16739 */ {21,176},
+/* 16740 */ {21,176},
+/* 16741 */ {21,176},
+/* 16742 */ {21,176},
+/* 16743 */ {21,176},
+/* 16744 */ {21,176},
+/* 16745 */ {21,176},
+/* 16746 */ {21,176},
+/* 16747 */ {21,176},
+/* 16748 */ {21,176},
+/* 16749 */ {21,176},
+/* 16750 */ {21,176},
+/* 16751 */ {21,176},
+/* 16752 */ {21,176},
+/* 16753 */ {21,176},
+/* 16754 */ {21,176},
+/* 16755 */ {21,176},
+/* 16756 */ {21,176},
+/* 16757 */ {21,176},
+/* 16758 */ {21,176},
+/* 16759 */ {21,176},
+/* 16760 */ {21,176},
+/* 16761 */ {21,176},
+/* 16762 */ {21,176},
+/* 16763 */ {21,176},
+/* 16764 */ {21,176},
+/* 16765 */ {21,176},
+/* 16766 */ {21,176},
+/* 16767 */ {21,176},
+/* 16768 */ {21,176},
+/* 16769 */ {21,176},
+/* 16770 */ {21,176},
+/* 16771 */ {21,176},
+/* 16772 */ {21,176},
+/* 16773 */ {21,176},
+/* 16774 */ {21,176},
+/* 16775 */ {21,176},
+/* 16776 */ {21,176},
+/* 16777 */ {21,176},
+/* 16778 */ {21,176},
+/* 16779 */ {21,176},
+/* 16780 */ {21,176},
+/* 16781 */ {21,176},
+/* 16782 */ {21,176},
+/* 16783 */ {21,176},
+/* 16784 */ {21,176},
+/* 16785 */ {21,176},
+/* 16786 */ {21,176},
+/* 16787 */ {21,176},
+/* 16788 */ {21,176},
+/* 16789 */ {21,176},
+/* 16790 */ {21,176},
+/* 16791 */ {21,176},
+/* 16792 */ {21,176},
+/* 16793 */ {21,176},
+/* 16794 */ {21,176},
+/* 16795 */ {21,176},
+/* 16796 */ {21,176},
+/* 16797 */ {21,176},
+/* 16798 */ {21,176},
+/* 16799 */ {21,176},
+/* 16800 */ {21,176},
+/* 16801 */ {21,176},
+/* 16802 */ {21,176},
+/* 16803 */ {21,176},
+/* 16804 */ {21,176},
+/* 16805 */ {21,176},
+/* 16806 */ {21,176},
+/* 16807 */ {21,176},
+/* 16808 */ {21,176},
+/* 16809 */ {21,176},
+/* 16810 */ {21,176},
+/* 16811 */ {21,176},
+/* 16812 */ {21,176},
+/* 16813 */ {21,176},
+/* 16814 */ {21,176},
+/* 16815 */ {21,176},
+/* 16816 */ {21,176},
+/* 16817 */ {21,176},
+/* 16818 */ {21,176},
+/* 16819 */ {21,176},
+/* 16820 */ {21,176},
+/* 16821 */ {21,176},
+/* 16822 */ {21,176},
+/* 16823 */ {21,176},
+/* 16824 */ {21,176},
+/* 16825 */ {21,176},
+/* 16826 */ {21,176},
+/* 16827 */ {21,176},
+/* 16828 */ {21,176},
+/* 16829 */ {21,176},
+/* 16830 */ {21,176},
+/* 16831 */ {21,176},
+/* 16832 */ {21,176},
+/* 16833 */ {21,176},
+/* 16834 */ {21,176},
+/* 16835 */ {21,176},
+/* 16836 */ {21,176},
+/* 16837 */ {21,176},
+/* 16838 */ {21,176},
+/* 16839 */ {21,176},
+/* 16840 */ {21,176},
+/* 16841 */ {21,176},
+/* 16842 */ {21,176},
+/* 16843 */ {21,176},
+/* 16844 */ {21,176},
+/* 16845 */ {21,176},
+/* 16846 */ {21,176},
+/* 16847 */ {21,176},
+/* 16848 */ {21,176},
+/* 16849 */ {21,176},
+/* 16850 */ {21,176},
+/* 16851 */ {21,176},
+/* 16852 */ {21,176},
+/* 16853 */ {21,176},
+/* 16854 */ {21,176},
+/* 16855 */ {21,176},
+/* 16856 */ {21,176},
+/* 16857 */ {21,176},
+/* 16858 */ {21,176},
+/* 16859 */ {21,176},
+/* 16860 */ {21,176},
+/* 16861 */ {21,176},
+/* 16862 */ {21,176},
+/* 16863 */ {21,176},
+/* 16864 */ {21,176},
+/* 16865 */ {21,176},
+/* 16866 */ {21,176},
+/* 16867 */ {21,176},
+/* 16868 */ {21,176},
+/* 16869 */ {21,176},
+/* 16870 */ {21,176},
+/* 16871 */ {21,176},
+/* 16872 */ {21,176},
+/* 16873 */ {21,176},
+/* 16874 */ {21,176},
+/* 16875 */ {21,176},
+/* 16876 */ {21,176},
+/* 16877 */ {21,176},
+/* 16878 */ {21,176},
+/* 16879 */ {21,176},
+/* 16880 */ {21,176},
+/* 16881 */ {21,176},
+/* 16882 */ {21,176},
+/* 16883 */ {21,176},
+/* 16884 */ {21,176},
+/* 16885 */ {21,176},
+/* 16886 */ {21,176},
+/* 16887 */ {21,176},
+/* 16888 */ {21,176},
+/* 16889 */ {21,176},
+/* 16890 */ {21,176},
+/* 16891 */ {21,176},
+/* 16892 */ {21,176},
+/* 16893 */ {21,176},
+/* 16894 */ {21,176},
+/* 16895 */ {21,176},
+/* 16896 */ {21,177},
+/* 16897 */ {21,177},
+/* 16898 */ {21,177},
+/* 16899 */ {21,177},
+/* 16900 */ {21,177},
+/* 16901 */ {21,177},
+/* 16902 */ {21,177},
+/* 16903 */ {21,177},
+/* 16904 */ {21,177},
+/* 16905 */ {21,177},
+/* 16906 */ {21,177},
+/* 16907 */ {21,177},
+/* 16908 */ {21,177},
+/* 16909 */ {21,177},
+/* 16910 */ {21,177},
+/* 16911 */ {21,177},
+/* 16912 */ {21,177},
+/* 16913 */ {21,177},
+/* 16914 */ {21,177},
+/* 16915 */ {21,177},
+/* 16916 */ {21,177},
+/* 16917 */ {21,177},
+/* 16918 */ {21,177},
+/* 16919 */ {21,177},
+/* 16920 */ {21,177},
+/* 16921 */ {21,177},
+/* 16922 */ {21,177},
+/* 16923 */ {21,177},
+/* 16924 */ {21,177},
+/* 16925 */ {21,177},
+/* 16926 */ {21,177},
+/* 16927 */ {21,177},
+/* 16928 */ {21,177},
+/* 16929 */ {21,177},
+/* 16930 */ {21,177},
+/* 16931 */ {21,177},
+/* 16932 */ {21,177},
+/* 16933 */ {21,177},
+/* 16934 */ {21,177},
+/* 16935 */ {21,177},
+/* 16936 */ {21,177},
+/* 16937 */ {21,177},
+/* 16938 */ {21,177},
+/* 16939 */ {21,177},
+/* 16940 */ {21,177},
+/* 16941 */ {21,177},
+/* 16942 */ {21,177},
+/* 16943 */ {21,177},
+/* 16944 */ {21,177},
+/* 16945 */ {21,177},
+/* 16946 */ {21,177},
+/* 16947 */ {21,177},
+/* 16948 */ {21,177},
+/* 16949 */ {21,177},
+/* 16950 */ {21,177},
+/* 16951 */ {21,177},
+/* 16952 */ {21,177},
+/* 16953 */ {21,177},
+/* 16954 */ {21,177},
+/* 16955 */ {21,177},
+/* 16956 */ {21,177},
+/* 16957 */ {21,177},
+/* 16958 */ {21,177},
+/* 16959 */ {21,177},
+/* 16960 */ {21,177},
+/* 16961 */ {21,177},
+/* 16962 */ {21,177},
+/* 16963 */ {21,177},
+/* 16964 */ {21,177},
+/* 16965 */ {21,177},
+/* 16966 */ {21,177},
+/* 16967 */ {21,177},
+/* 16968 */ {21,177},
+/* 16969 */ {21,177},
+/* 16970 */ {21,177},
+/* 16971 */ {21,177},
+/* 16972 */ {21,177},
+/* 16973 */ {21,177},
+/* 16974 */ {21,177},
+/* 16975 */ {21,177},
+/* 16976 */ {21,177},
+/* 16977 */ {21,177},
+/* 16978 */ {21,177},
+/* 16979 */ {21,177},
+/* 16980 */ {21,177},
+/* 16981 */ {21,177},
+/* 16982 */ {21,177},
+/* 16983 */ {21,177},
+/* 16984 */ {21,177},
+/* 16985 */ {21,177},
+/* 16986 */ {21,177},
+/* 16987 */ {21,177},
+/* 16988 */ {21,177},
+/* 16989 */ {21,177},
+/* 16990 */ {21,177},
+/* 16991 */ {21,177},
+/* 16992 */ {21,177},
+/* 16993 */ {21,177},
+/* 16994 */ {21,177},
+/* 16995 */ {21,177},
+/* 16996 */ {21,177},
+/* 16997 */ {21,177},
+/* 16998 */ {21,177},
+/* 16999 */ {21,177},
+/* 17000 */ {21,177},
+/* 17001 */ {21,177},
+/* 17002 */ {21,177},
+/* 17003 */ {21,177},
+/* 17004 */ {21,177},
+/* 17005 */ {21,177},
+/* 17006 */ {21,177},
+/* 17007 */ {21,177},
+/* 17008 */ {21,177},
+/* 17009 */ {21,177},
+/* 17010 */ {21,177},
+/* 17011 */ {21,177},
+/* 17012 */ {21,177},
+/* 17013 */ {21,177},
+/* 17014 */ {21,177},
+/* 17015 */ {21,177},
+/* 17016 */ {21,177},
+/* 17017 */ {21,177},
+/* 17018 */ {21,177},
+/* 17019 */ {21,177},
+/* 17020 */ {21,177},
+/* 17021 */ {21,177},
+/* 17022 */ {21,177},
+/* 17023 */ {21,177},
+/* 17024 */ {21,177},
+/* 17025 */ {21,177},
+/* 17026 */ {21,177},
+/* 17027 */ {21,177},
+/* 17028 */ {21,177},
+/* 17029 */ {21,177},
+/* 17030 */ {21,177},
+/* 17031 */ {21,177},
+/* 17032 */ {21,177},
+/* 17033 */ {21,177},
+/* 17034 */ {21,177},
+/* 17035 */ {21,177},
+/* 17036 */ {21,177},
+/* 17037 */ {21,177},
+/* 17038 */ {21,177},
+/* 17039 */ {21,177},
+/* 17040 */ {21,177},
+/* 17041 */ {21,177},
+/* 17042 */ {21,177},
+/* 17043 */ {21,177},
+/* 17044 */ {21,177},
+/* 17045 */ {21,177},
+/* 17046 */ {21,177},
+/* 17047 */ {21,177},
+/* 17048 */ {21,177},
+/* 17049 */ {21,177},
+/* 17050 */ {21,177},
+/* 17051 */ {21,177},
+/* 17052 */ {21,177},
+/* 17053 */ {21,177},
+/* 17054 */ {21,177},
+/* 17055 */ {21,177},
+/* 17056 */ {21,177},
+/* 17057 */ {21,177},
+/* 17058 */ {21,177},
+/* 17059 */ {21,177},
+/* 17060 */ {21,177},
+/* 17061 */ {21,177},
+/* 17062 */ {21,177},
+/* 17063 */ {21,177},
+/* 17064 */ {21,177},
+/* 17065 */ {21,177},
+/* 17066 */ {21,177},
+/* 17067 */ {21,177},
+/* 17068 */ {21,177},
+/* 17069 */ {21,177},
+/* 17070 */ {21,177},
+/* 17071 */ {21,177},
+/* 17072 */ {21,177},
+/* 17073 */ {21,177},
+/* 17074 */ {21,177},
+/* 17075 */ {21,177},
+/* 17076 */ {21,177},
+/* 17077 */ {21,177},
+/* 17078 */ {21,177},
+/* 17079 */ {21,177},
+/* 17080 */ {21,177},
+/* 17081 */ {21,177},
+/* 17082 */ {21,177},
+/* 17083 */ {21,177},
+/* 17084 */ {21,177},
+/* 17085 */ {21,177},
+/* 17086 */ {21,177},
+/* 17087 */ {21,177},
+/* 17088 */ {21,177},
+/* 17089 */ {21,177},
+/* 17090 */ {21,177},
+/* 17091 */ {21,177},
+/* 17092 */ {21,177},
+/* 17093 */ {21,177},
+/* 17094 */ {21,177},
+/* 17095 */ {21,177},
+/* 17096 */ {21,177},
+/* 17097 */ {21,177},
+/* 17098 */ {21,177},
+/* 17099 */ {21,177},
+/* 17100 */ {21,177},
+/* 17101 */ {21,177},
+/* 17102 */ {21,177},
+/* 17103 */ {21,177},
+/* 17104 */ {21,177},
+/* 17105 */ {21,177},
+/* 17106 */ {21,177},
+/* 17107 */ {21,177},
+/* 17108 */ {21,177},
+/* 17109 */ {21,177},
+/* 17110 */ {21,177},
+/* 17111 */ {21,177},
+/* 17112 */ {21,177},
+/* 17113 */ {21,177},
+/* 17114 */ {21,177},
+/* 17115 */ {21,177},
+/* 17116 */ {21,177},
+/* 17117 */ {21,177},
+/* 17118 */ {21,177},
+/* 17119 */ {21,177},
+/* 17120 */ {21,177},
+/* 17121 */ {21,177},
+/* 17122 */ {21,177},
+/* 17123 */ {21,177},
+/* 17124 */ {21,177},
+/* 17125 */ {21,177},
+/* 17126 */ {21,177},
+/* 17127 */ {21,177},
+/* 17128 */ {21,177},
+/* 17129 */ {21,177},
+/* 17130 */ {21,177},
+/* 17131 */ {21,177},
+/* 17132 */ {21,177},
+/* 17133 */ {21,177},
+/* 17134 */ {21,177},
+/* 17135 */ {21,177},
+/* 17136 */ {21,177},
+/* 17137 */ {21,177},
+/* 17138 */ {21,177},
+/* 17139 */ {21,177},
+/* 17140 */ {21,177},
+/* 17141 */ {21,177},
+/* 17142 */ {21,177},
+/* 17143 */ {21,177},
+/* 17144 */ {21,177},
+/* 17145 */ {21,177},
+/* 17146 */ {21,177},
+/* 17147 */ {21,177},
+/* 17148 */ {21,177},
+/* 17149 */ {21,177},
+/* 17150 */ {21,177},
+/* 17151 */ {21,177},
+/* 17152 */ {21,177},
+/* 17153 */ {21,177},
+/* 17154 */ {21,177},
+/* 17155 */ {21,177},
+/* 17156 */ {21,177},
+/* 17157 */ {21,177},
+/* 17158 */ {21,177},
+/* 17159 */ {21,177},
+/* 17160 */ {21,177},
+/* 17161 */ {21,177},
+/* 17162 */ {21,177},
+/* 17163 */ {21,177},
+/* 17164 */ {21,177},
+/* 17165 */ {21,177},
+/* 17166 */ {21,177},
+/* 17167 */ {21,177},
+/* 17168 */ {21,177},
+/* 17169 */ {21,177},
+/* 17170 */ {21,177},
+/* 17171 */ {21,177},
+/* 17172 */ {21,177},
+/* 17173 */ {21,177},
+/* 17174 */ {21,177},
+/* 17175 */ {21,177},
+/* 17176 */ {21,177},
+/* 17177 */ {21,177},
+/* 17178 */ {21,177},
+/* 17179 */ {21,177},
+/* 17180 */ {21,177},
+/* 17181 */ {21,177},
+/* 17182 */ {21,177},
+/* 17183 */ {21,177},
+/* 17184 */ {21,177},
+/* 17185 */ {21,177},
+/* 17186 */ {21,177},
+/* 17187 */ {21,177},
+/* 17188 */ {21,177},
+/* 17189 */ {21,177},
+/* 17190 */ {21,177},
+/* 17191 */ {21,177},
+/* 17192 */ {21,177},
+/* 17193 */ {21,177},
+/* 17194 */ {21,177},
+/* 17195 */ {21,177},
+/* 17196 */ {21,177},
+/* 17197 */ {21,177},
+/* 17198 */ {21,177},
+/* 17199 */ {21,177},
+/* 17200 */ {21,177},
+/* 17201 */ {21,177},
+/* 17202 */ {21,177},
+/* 17203 */ {21,177},
+/* 17204 */ {21,177},
+/* 17205 */ {21,177},
+/* 17206 */ {21,177},
+/* 17207 */ {21,177},
+/* 17208 */ {21,177},
+/* 17209 */ {21,177},
+/* 17210 */ {21,177},
+/* 17211 */ {21,177},
+/* 17212 */ {21,177},
+/* 17213 */ {21,177},
+/* 17214 */ {21,177},
+/* 17215 */ {21,177},
+/* 17216 */ {21,177},
+/* 17217 */ {21,177},
+/* 17218 */ {21,177},
+/* 17219 */ {21,177},
+/* 17220 */ {21,177},
+/* 17221 */ {21,177},
+/* 17222 */ {21,177},
+/* 17223 */ {21,177},
+/* 17224 */ {21,177},
+/* 17225 */ {21,177},
+/* 17226 */ {21,177},
+/* 17227 */ {21,177},
+/* 17228 */ {21,177},
+/* 17229 */ {21,177},
+/* 17230 */ {21,177},
+/* 17231 */ {21,177},
+/* 17232 */ {21,177},
+/* 17233 */ {21,177},
+/* 17234 */ {21,177},
+/* 17235 */ {21,177},
+/* 17236 */ {21,177},
+/* 17237 */ {21,177},
+/* 17238 */ {21,177},
+/* 17239 */ {21,177},
+/* 17240 */ {21,177},
+/* 17241 */ {21,177},
+/* 17242 */ {21,177},
+/* 17243 */ {21,177},
+/* 17244 */ {21,177},
+/* 17245 */ {21,177},
+/* 17246 */ {21,177},
+/* 17247 */ {21,177},
+/* 17248 */ {21,177},
+/* 17249 */ {21,177},
+/* 17250 */ {21,177},
+/* 17251 */ {21,177},
+/* 17252 */ {21,177},
+/* 17253 */ {21,177},
+/* 17254 */ {21,177},
+/* 17255 */ {21,177},
+/* 17256 */ {21,177},
+/* 17257 */ {21,177},
+/* 17258 */ {21,177},
+/* 17259 */ {21,177},
+/* 17260 */ {21,177},
+/* 17261 */ {21,177},
+/* 17262 */ {21,177},
+/* 17263 */ {21,177},
+/* 17264 */ {21,177},
+/* 17265 */ {21,177},
+/* 17266 */ {21,177},
+/* 17267 */ {21,177},
+/* 17268 */ {21,177},
+/* 17269 */ {21,177},
+/* 17270 */ {21,177},
+/* 17271 */ {21,177},
+/* 17272 */ {21,177},
+/* 17273 */ {21,177},
+/* 17274 */ {21,177},
+/* 17275 */ {21,177},
+/* 17276 */ {21,177},
+/* 17277 */ {21,177},
+/* 17278 */ {21,177},
+/* 17279 */ {21,177},
+/* 17280 */ {21,177},
+/* 17281 */ {21,177},
+/* 17282 */ {21,177},
+/* 17283 */ {21,177},
+/* 17284 */ {21,177},
+/* 17285 */ {21,177},
+/* 17286 */ {21,177},
+/* 17287 */ {21,177},
+/* 17288 */ {21,177},
+/* 17289 */ {21,177},
+/* 17290 */ {21,177},
+/* 17291 */ {21,177},
+/* 17292 */ {21,177},
+/* 17293 */ {21,177},
+/* 17294 */ {21,177},
+/* 17295 */ {21,177},
+/* 17296 */ {21,177},
+/* 17297 */ {21,177},
+/* 17298 */ {21,177},
+/* 17299 */ {21,177},
+/* 17300 */ {21,177},
+/* 17301 */ {21,177},
+/* 17302 */ {21,177},
+/* 17303 */ {21,177},
+/* 17304 */ {21,177},
+/* 17305 */ {21,177},
+/* 17306 */ {21,177},
+/* 17307 */ {21,177},
+/* 17308 */ {21,177},
+/* 17309 */ {21,177},
+/* 17310 */ {21,177},
+/* 17311 */ {21,177},
+/* 17312 */ {21,177},
+/* 17313 */ {21,177},
+/* 17314 */ {21,177},
+/* 17315 */ {21,177},
+/* 17316 */ {21,177},
+/* 17317 */ {21,177},
+/* 17318 */ {21,177},
+/* 17319 */ {21,177},
+/* 17320 */ {21,177},
+/* 17321 */ {21,177},
+/* 17322 */ {21,177},
+/* 17323 */ {21,177},
+/* 17324 */ {21,177},
+/* 17325 */ {21,177},
+/* 17326 */ {21,177},
+/* 17327 */ {21,177},
+/* 17328 */ {21,177},
+/* 17329 */ {21,177},
+/* 17330 */ {21,177},
+/* 17331 */ {21,177},
+/* 17332 */ {21,177},
+/* 17333 */ {21,177},
+/* 17334 */ {21,177},
+/* 17335 */ {21,177},
+/* 17336 */ {21,177},
+/* 17337 */ {21,177},
+/* 17338 */ {21,177},
+/* 17339 */ {21,177},
+/* 17340 */ {21,177},
+/* 17341 */ {21,177},
+/* 17342 */ {21,177},
+/* 17343 */ {21,177},
+/* 17344 */ {21,177},
+/* 17345 */ {21,177},
+/* 17346 */ {21,177},
+/* 17347 */ {21,177},
+/* 17348 */ {21,177},
+/* 17349 */ {21,177},
+/* 17350 */ {21,177},
+/* 17351 */ {21,177},
+/* 17352 */ {21,177},
+/* 17353 */ {21,177},
+/* 17354 */ {21,177},
+/* 17355 */ {21,177},
+/* 17356 */ {21,177},
+/* 17357 */ {21,177},
+/* 17358 */ {21,177},
+/* 17359 */ {21,177},
+/* 17360 */ {21,177},
+/* 17361 */ {21,177},
+/* 17362 */ {21,177},
+/* 17363 */ {21,177},
+/* 17364 */ {21,177},
+/* 17365 */ {21,177},
+/* 17366 */ {21,177},
+/* 17367 */ {21,177},
+/* 17368 */ {21,177},
+/* 17369 */ {21,177},
+/* 17370 */ {21,177},
+/* 17371 */ {21,177},
+/* 17372 */ {21,177},
+/* 17373 */ {21,177},
+/* 17374 */ {21,177},
+/* 17375 */ {21,177},
+/* 17376 */ {21,177},
+/* 17377 */ {21,177},
+/* 17378 */ {21,177},
+/* 17379 */ {21,177},
+/* 17380 */ {21,177},
+/* 17381 */ {21,177},
+/* 17382 */ {21,177},
+/* 17383 */ {21,177},
+/* 17384 */ {21,177},
+/* 17385 */ {21,177},
+/* 17386 */ {21,177},
+/* 17387 */ {21,177},
+/* 17388 */ {21,177},
+/* 17389 */ {21,177},
+/* 17390 */ {21,177},
+/* 17391 */ {21,177},
+/* 17392 */ {21,177},
+/* 17393 */ {21,177},
+/* 17394 */ {21,177},
+/* 17395 */ {21,177},
+/* 17396 */ {21,177},
+/* 17397 */ {21,177},
+/* 17398 */ {21,177},
+/* 17399 */ {21,177},
+/* 17400 */ {21,177},
+/* 17401 */ {21,177},
+/* 17402 */ {21,177},
+/* 17403 */ {21,177},
+/* 17404 */ {21,177},
+/* 17405 */ {21,177},
+/* 17406 */ {21,177},
+/* 17407 */ {21,177},
+/* 17408 */ {21,179},
+/* 17409 */ {21,179},
+/* 17410 */ {21,179},
+/* 17411 */ {21,179},
+/* 17412 */ {21,179},
+/* 17413 */ {21,179},
+/* 17414 */ {21,179},
+/* 17415 */ {21,179},
+/* 17416 */ {21,179},
+/* 17417 */ {21,179},
+/* 17418 */ {21,179},
+/* 17419 */ {21,179},
+/* 17420 */ {21,179},
+/* 17421 */ {21,179},
+/* 17422 */ {21,179},
+/* 17423 */ {21,179},
+/* 17424 */ {21,179},
+/* 17425 */ {21,179},
+/* 17426 */ {21,179},
+/* 17427 */ {21,179},
+/* 17428 */ {21,179},
+/* 17429 */ {21,179},
+/* 17430 */ {21,179},
+/* 17431 */ {21,179},
+/* 17432 */ {21,179},
+/* 17433 */ {21,179},
+/* 17434 */ {21,179},
+/* 17435 */ {21,179},
+/* 17436 */ {21,179},
+/* 17437 */ {21,179},
+/* 17438 */ {21,179},
+/* 17439 */ {21,179},
+/* 17440 */ {21,179},
+/* 17441 */ {21,179},
+/* 17442 */ {21,179},
+/* 17443 */ {21,179},
+/* 17444 */ {21,179},
+/* 17445 */ {21,179},
+/* 17446 */ {21,179},
+/* 17447 */ {21,179},
+/* 17448 */ {21,179},
+/* 17449 */ {21,179},
+/* 17450 */ {21,179},
+/* 17451 */ {21,179},
+/* 17452 */ {21,179},
+/* 17453 */ {21,179},
+/* 17454 */ {21,179},
+/* 17455 */ {21,179},
+/* 17456 */ {21,179},
+/* 17457 */ {21,179},
+/* 17458 */ {21,179},
+/* 17459 */ {21,179},
+/* 17460 */ {21,179},
+/* 17461 */ {21,179},
+/* 17462 */ {21,179},
+/* 17463 */ {21,179},
+/* 17464 */ {21,179},
+/* 17465 */ {21,179},
+/* 17466 */ {21,179},
+/* 17467 */ {21,179},
+/* 17468 */ {21,179},
+/* 17469 */ {21,179},
+/* 17470 */ {21,179},
+/* 17471 */ {21,179},
+/* 17472 */ {21,179},
+/* 17473 */ {21,179},
+/* 17474 */ {21,179},
+/* 17475 */ {21,179},
+/* 17476 */ {21,179},
+/* 17477 */ {21,179},
+/* 17478 */ {21,179},
+/* 17479 */ {21,179},
+/* 17480 */ {21,179},
+/* 17481 */ {21,179},
+/* 17482 */ {21,179},
+/* 17483 */ {21,179},
+/* 17484 */ {21,179},
+/* 17485 */ {21,179},
+/* 17486 */ {21,179},
+/* 17487 */ {21,179},
+/* 17488 */ {21,179},
+/* 17489 */ {21,179},
+/* 17490 */ {21,179},
+/* 17491 */ {21,179},
+/* 17492 */ {21,179},
+/* 17493 */ {21,179},
+/* 17494 */ {21,179},
+/* 17495 */ {21,179},
+/* 17496 */ {21,179},
+/* 17497 */ {21,179},
+/* 17498 */ {21,179},
+/* 17499 */ {21,179},
+/* 17500 */ {21,179},
+/* 17501 */ {21,179},
+/* 17502 */ {21,179},
+/* 17503 */ {21,179},
+/* 17504 */ {21,179},
+/* 17505 */ {21,179},
+/* 17506 */ {21,179},
+/* 17507 */ {21,179},
+/* 17508 */ {21,179},
+/* 17509 */ {21,179},
+/* 17510 */ {21,179},
+/* 17511 */ {21,179},
+/* 17512 */ {21,179},
+/* 17513 */ {21,179},
+/* 17514 */ {21,179},
+/* 17515 */ {21,179},
+/* 17516 */ {21,179},
+/* 17517 */ {21,179},
+/* 17518 */ {21,179},
+/* 17519 */ {21,179},
+/* 17520 */ {21,179},
+/* 17521 */ {21,179},
+/* 17522 */ {21,179},
+/* 17523 */ {21,179},
+/* 17524 */ {21,179},
+/* 17525 */ {21,179},
+/* 17526 */ {21,179},
+/* 17527 */ {21,179},
+/* 17528 */ {21,179},
+/* 17529 */ {21,179},
+/* 17530 */ {21,179},
+/* 17531 */ {21,179},
+/* 17532 */ {21,179},
+/* 17533 */ {21,179},
+/* 17534 */ {21,179},
+/* 17535 */ {21,179},
+/* 17536 */ {21,179},
+/* 17537 */ {21,179},
+/* 17538 */ {21,179},
+/* 17539 */ {21,179},
+/* 17540 */ {21,179},
+/* 17541 */ {21,179},
+/* 17542 */ {21,179},
+/* 17543 */ {21,179},
+/* 17544 */ {21,179},
+/* 17545 */ {21,179},
+/* 17546 */ {21,179},
+/* 17547 */ {21,179},
+/* 17548 */ {21,179},
+/* 17549 */ {21,179},
+/* 17550 */ {21,179},
+/* 17551 */ {21,179},
+/* 17552 */ {21,179},
+/* 17553 */ {21,179},
+/* 17554 */ {21,179},
+/* 17555 */ {21,179},
+/* 17556 */ {21,179},
+/* 17557 */ {21,179},
+/* 17558 */ {21,179},
+/* 17559 */ {21,179},
+/* 17560 */ {21,179},
+/* 17561 */ {21,179},
+/* 17562 */ {21,179},
+/* 17563 */ {21,179},
+/* 17564 */ {21,179},
+/* 17565 */ {21,179},
+/* 17566 */ {21,179},
+/* 17567 */ {21,179},
+/* 17568 */ {21,179},
+/* 17569 */ {21,179},
+/* 17570 */ {21,179},
+/* 17571 */ {21,179},
+/* 17572 */ {21,179},
+/* 17573 */ {21,179},
+/* 17574 */ {21,179},
+/* 17575 */ {21,179},
+/* 17576 */ {21,179},
+/* 17577 */ {21,179},
+/* 17578 */ {21,179},
+/* 17579 */ {21,179},
+/* 17580 */ {21,179},
+/* 17581 */ {21,179},
+/* 17582 */ {21,179},
+/* 17583 */ {21,179},
+/* 17584 */ {21,179},
+/* 17585 */ {21,179},
+/* 17586 */ {21,179},
+/* 17587 */ {21,179},
+/* 17588 */ {21,179},
+/* 17589 */ {21,179},
+/* 17590 */ {21,179},
+/* 17591 */ {21,179},
+/* 17592 */ {21,179},
+/* 17593 */ {21,179},
+/* 17594 */ {21,179},
+/* 17595 */ {21,179},
+/* 17596 */ {21,179},
+/* 17597 */ {21,179},
+/* 17598 */ {21,179},
+/* 17599 */ {21,179},
+/* 17600 */ {21,179},
+/* 17601 */ {21,179},
+/* 17602 */ {21,179},
+/* 17603 */ {21,179},
+/* 17604 */ {21,179},
+/* 17605 */ {21,179},
+/* 17606 */ {21,179},
+/* 17607 */ {21,179},
+/* 17608 */ {21,179},
+/* 17609 */ {21,179},
+/* 17610 */ {21,179},
+/* 17611 */ {21,179},
+/* 17612 */ {21,179},
+/* 17613 */ {21,179},
+/* 17614 */ {21,179},
+/* 17615 */ {21,179},
+/* 17616 */ {21,179},
+/* 17617 */ {21,179},
+/* 17618 */ {21,179},
+/* 17619 */ {21,179},
+/* 17620 */ {21,179},
+/* 17621 */ {21,179},
+/* 17622 */ {21,179},
+/* 17623 */ {21,179},
+/* 17624 */ {21,179},
+/* 17625 */ {21,179},
+/* 17626 */ {21,179},
+/* 17627 */ {21,179},
+/* 17628 */ {21,179},
+/* 17629 */ {21,179},
+/* 17630 */ {21,179},
+/* 17631 */ {21,179},
+/* 17632 */ {21,179},
+/* 17633 */ {21,179},
+/* 17634 */ {21,179},
+/* 17635 */ {21,179},
+/* 17636 */ {21,179},
+/* 17637 */ {21,179},
+/* 17638 */ {21,179},
+/* 17639 */ {21,179},
+/* 17640 */ {21,179},
+/* 17641 */ {21,179},
+/* 17642 */ {21,179},
+/* 17643 */ {21,179},
+/* 17644 */ {21,179},
+/* 17645 */ {21,179},
+/* 17646 */ {21,179},
+/* 17647 */ {21,179},
+/* 17648 */ {21,179},
+/* 17649 */ {21,179},
+/* 17650 */ {21,179},
+/* 17651 */ {21,179},
+/* 17652 */ {21,179},
+/* 17653 */ {21,179},
+/* 17654 */ {21,179},
+/* 17655 */ {21,179},
+/* 17656 */ {21,179},
+/* 17657 */ {21,179},
+/* 17658 */ {21,179},
+/* 17659 */ {21,179},
+/* 17660 */ {21,179},
+/* 17661 */ {21,179},
+/* 17662 */ {21,179},
+/* 17663 */ {21,179},
+/* 17664 */ {21,179},
+/* 17665 */ {21,179},
+/* 17666 */ {21,179},
+/* 17667 */ {21,179},
+/* 17668 */ {21,179},
+/* 17669 */ {21,179},
+/* 17670 */ {21,179},
+/* 17671 */ {21,179},
+/* 17672 */ {21,179},
+/* 17673 */ {21,179},
+/* 17674 */ {21,179},
+/* 17675 */ {21,179},
+/* 17676 */ {21,179},
+/* 17677 */ {21,179},
+/* 17678 */ {21,179},
+/* 17679 */ {21,179},
+/* 17680 */ {21,179},
+/* 17681 */ {21,179},
+/* 17682 */ {21,179},
+/* 17683 */ {21,179},
+/* 17684 */ {21,179},
+/* 17685 */ {21,179},
+/* 17686 */ {21,179},
+/* 17687 */ {21,179},
+/* 17688 */ {21,179},
+/* 17689 */ {21,179},
+/* 17690 */ {21,179},
+/* 17691 */ {21,179},
+/* 17692 */ {21,179},
+/* 17693 */ {21,179},
+/* 17694 */ {21,179},
+/* 17695 */ {21,179},
+/* 17696 */ {21,179},
+/* 17697 */ {21,179},
+/* 17698 */ {21,179},
+/* 17699 */ {21,179},
+/* 17700 */ {21,179},
+/* 17701 */ {21,179},
+/* 17702 */ {21,179},
+/* 17703 */ {21,179},
+/* 17704 */ {21,179},
+/* 17705 */ {21,179},
+/* 17706 */ {21,179},
+/* 17707 */ {21,179},
+/* 17708 */ {21,179},
+/* 17709 */ {21,179},
+/* 17710 */ {21,179},
+/* 17711 */ {21,179},
+/* 17712 */ {21,179},
+/* 17713 */ {21,179},
+/* 17714 */ {21,179},
+/* 17715 */ {21,179},
+/* 17716 */ {21,179},
+/* 17717 */ {21,179},
+/* 17718 */ {21,179},
+/* 17719 */ {21,179},
+/* 17720 */ {21,179},
+/* 17721 */ {21,179},
+/* 17722 */ {21,179},
+/* 17723 */ {21,179},
+/* 17724 */ {21,179},
+/* 17725 */ {21,179},
+/* 17726 */ {21,179},
+/* 17727 */ {21,179},
+/* 17728 */ {21,179},
+/* 17729 */ {21,179},
+/* 17730 */ {21,179},
+/* 17731 */ {21,179},
+/* 17732 */ {21,179},
+/* 17733 */ {21,179},
+/* 17734 */ {21,179},
+/* 17735 */ {21,179},
+/* 17736 */ {21,179},
+/* 17737 */ {21,179},
+/* 17738 */ {21,179},
+/* 17739 */ {21,179},
+/* 17740 */ {21,179},
+/* 17741 */ {21,179},
+/* 17742 */ {21,179},
+/* 17743 */ {21,179},
+/* 17744 */ {21,179},
+/* 17745 */ {21,179},
+/* 17746 */ {21,179},
+/* 17747 */ {21,179},
+/* 17748 */ {21,179},
+/* 17749 */ {21,179},
+/* 17750 */ {21,179},
+/* 17751 */ {21,179},
+/* 17752 */ {21,179},
+/* 17753 */ {21,179},
+/* 17754 */ {21,179},
+/* 17755 */ {21,179},
+/* 17756 */ {21,179},
+/* 17757 */ {21,179},
+/* 17758 */ {21,179},
+/* 17759 */ {21,179},
+/* 17760 */ {21,179},
+/* 17761 */ {21,179},
+/* 17762 */ {21,179},
+/* 17763 */ {21,179},
+/* 17764 */ {21,179},
+/* 17765 */ {21,179},
+/* 17766 */ {21,179},
+/* 17767 */ {21,179},
+/* 17768 */ {21,179},
+/* 17769 */ {21,179},
+/* 17770 */ {21,179},
+/* 17771 */ {21,179},
+/* 17772 */ {21,179},
+/* 17773 */ {21,179},
+/* 17774 */ {21,179},
+/* 17775 */ {21,179},
+/* 17776 */ {21,179},
+/* 17777 */ {21,179},
+/* 17778 */ {21,179},
+/* 17779 */ {21,179},
+/* 17780 */ {21,179},
+/* 17781 */ {21,179},
+/* 17782 */ {21,179},
+/* 17783 */ {21,179},
+/* 17784 */ {21,179},
+/* 17785 */ {21,179},
+/* 17786 */ {21,179},
+/* 17787 */ {21,179},
+/* 17788 */ {21,179},
+/* 17789 */ {21,179},
+/* 17790 */ {21,179},
+/* 17791 */ {21,179},
+/* 17792 */ {21,179},
+/* 17793 */ {21,179},
+/* 17794 */ {21,179},
+/* 17795 */ {21,179},
+/* 17796 */ {21,179},
+/* 17797 */ {21,179},
+/* 17798 */ {21,179},
+/* 17799 */ {21,179},
+/* 17800 */ {21,179},
+/* 17801 */ {21,179},
+/* 17802 */ {21,179},
+/* 17803 */ {21,179},
+/* 17804 */ {21,179},
+/* 17805 */ {21,179},
+/* 17806 */ {21,179},
+/* 17807 */ {21,179},
+/* 17808 */ {21,179},
+/* 17809 */ {21,179},
+/* 17810 */ {21,179},
+/* 17811 */ {21,179},
+/* 17812 */ {21,179},
+/* 17813 */ {21,179},
+/* 17814 */ {21,179},
+/* 17815 */ {21,179},
+/* 17816 */ {21,179},
+/* 17817 */ {21,179},
+/* 17818 */ {21,179},
+/* 17819 */ {21,179},
+/* 17820 */ {21,179},
+/* 17821 */ {21,179},
+/* 17822 */ {21,179},
+/* 17823 */ {21,179},
+/* 17824 */ {21,179},
+/* 17825 */ {21,179},
+/* 17826 */ {21,179},
+/* 17827 */ {21,179},
+/* 17828 */ {21,179},
+/* 17829 */ {21,179},
+/* 17830 */ {21,179},
+/* 17831 */ {21,179},
+/* 17832 */ {21,179},
+/* 17833 */ {21,179},
+/* 17834 */ {21,179},
+/* 17835 */ {21,179},
+/* 17836 */ {21,179},
+/* 17837 */ {21,179},
+/* 17838 */ {21,179},
+/* 17839 */ {21,179},
+/* 17840 */ {21,179},
+/* 17841 */ {21,179},
+/* 17842 */ {21,179},
+/* 17843 */ {21,179},
+/* 17844 */ {21,179},
+/* 17845 */ {21,179},
+/* 17846 */ {21,179},
+/* 17847 */ {21,179},
+/* 17848 */ {21,179},
+/* 17849 */ {21,179},
+/* 17850 */ {21,179},
+/* 17851 */ {21,179},
+/* 17852 */ {21,179},
+/* 17853 */ {21,179},
+/* 17854 */ {21,179},
+/* 17855 */ {21,179},
+/* 17856 */ {21,179},
+/* 17857 */ {21,179},
+/* 17858 */ {21,179},
+/* 17859 */ {21,179},
+/* 17860 */ {21,179},
+/* 17861 */ {21,179},
+/* 17862 */ {21,179},
+/* 17863 */ {21,179},
+/* 17864 */ {21,179},
+/* 17865 */ {21,179},
+/* 17866 */ {21,179},
+/* 17867 */ {21,179},
+/* 17868 */ {21,179},
+/* 17869 */ {21,179},
+/* 17870 */ {21,179},
+/* 17871 */ {21,179},
+/* 17872 */ {21,179},
+/* 17873 */ {21,179},
+/* 17874 */ {21,179},
+/* 17875 */ {21,179},
+/* 17876 */ {21,179},
+/* 17877 */ {21,179},
+/* 17878 */ {21,179},
+/* 17879 */ {21,179},
+/* 17880 */ {21,179},
+/* 17881 */ {21,179},
+/* 17882 */ {21,179},
+/* 17883 */ {21,179},
+/* 17884 */ {21,179},
+/* 17885 */ {21,179},
+/* 17886 */ {21,179},
+/* 17887 */ {21,179},
+/* 17888 */ {21,179},
+/* 17889 */ {21,179},
+/* 17890 */ {21,179},
+/* 17891 */ {21,179},
+/* 17892 */ {21,179},
+/* 17893 */ {21,179},
+/* 17894 */ {21,179},
+/* 17895 */ {21,179},
+/* 17896 */ {21,179},
+/* 17897 */ {21,179},
+/* 17898 */ {21,179},
+/* 17899 */ {21,179},
+/* 17900 */ {21,179},
+/* 17901 */ {21,179},
+/* 17902 */ {21,179},
+/* 17903 */ {21,179},
+/* 17904 */ {21,179},
+/* 17905 */ {21,179},
+/* 17906 */ {21,179},
+/* 17907 */ {21,179},
+/* 17908 */ {21,179},
+/* 17909 */ {21,179},
+/* 17910 */ {21,179},
+/* 17911 */ {21,179},
+/* 17912 */ {21,179},
+/* 17913 */ {21,179},
+/* 17914 */ {21,179},
+/* 17915 */ {21,179},
+/* 17916 */ {21,179},
+/* 17917 */ {21,179},
+/* 17918 */ {21,179},
+/* 17919 */ {21,179},
+/* 17920 */ {21,209},
+/* 17921 */ {21,209},
+/* 17922 */ {21,209},
+/* 17923 */ {21,209},
+/* 17924 */ {21,209},
+/* 17925 */ {21,209},
+/* 17926 */ {21,209},
+/* 17927 */ {21,209},
+/* 17928 */ {21,209},
+/* 17929 */ {21,209},
+/* 17930 */ {21,209},
+/* 17931 */ {21,209},
+/* 17932 */ {21,209},
+/* 17933 */ {21,209},
+/* 17934 */ {21,209},
+/* 17935 */ {21,209},
+/* 17936 */ {21,209},
+/* 17937 */ {21,209},
+/* 17938 */ {21,209},
+/* 17939 */ {21,209},
+/* 17940 */ {21,209},
+/* 17941 */ {21,209},
+/* 17942 */ {21,209},
+/* 17943 */ {21,209},
+/* 17944 */ {21,209},
+/* 17945 */ {21,209},
+/* 17946 */ {21,209},
+/* 17947 */ {21,209},
+/* 17948 */ {21,209},
+/* 17949 */ {21,209},
+/* 17950 */ {21,209},
+/* 17951 */ {21,209},
+/* 17952 */ {21,209},
+/* 17953 */ {21,209},
+/* 17954 */ {21,209},
+/* 17955 */ {21,209},
+/* 17956 */ {21,209},
+/* 17957 */ {21,209},
+/* 17958 */ {21,209},
+/* 17959 */ {21,209},
+/* 17960 */ {21,209},
+/* 17961 */ {21,209},
+/* 17962 */ {21,209},
+/* 17963 */ {21,209},
+/* 17964 */ {21,209},
+/* 17965 */ {21,209},
+/* 17966 */ {21,209},
+/* 17967 */ {21,209},
+/* 17968 */ {21,209},
+/* 17969 */ {21,209},
+/* 17970 */ {21,209},
+/* 17971 */ {21,209},
+/* 17972 */ {21,209},
+/* 17973 */ {21,209},
+/* 17974 */ {21,209},
+/* 17975 */ {21,209},
+/* 17976 */ {21,209},
+/* 17977 */ {21,209},
+/* 17978 */ {21,209},
+/* 17979 */ {21,209},
+/* 17980 */ {21,209},
+/* 17981 */ {21,209},
+/* 17982 */ {21,209},
+/* 17983 */ {21,209},
+/* 17984 */ {21,209},
+/* 17985 */ {21,209},
+/* 17986 */ {21,209},
+/* 17987 */ {21,209},
+/* 17988 */ {21,209},
+/* 17989 */ {21,209},
+/* 17990 */ {21,209},
+/* 17991 */ {21,209},
+/* 17992 */ {21,209},
+/* 17993 */ {21,209},
+/* 17994 */ {21,209},
+/* 17995 */ {21,209},
+/* 17996 */ {21,209},
+/* 17997 */ {21,209},
+/* 17998 */ {21,209},
+/* 17999 */ {21,209},
+/* 18000 */ {21,209},
+/* 18001 */ {21,209},
+/* 18002 */ {21,209},
+/* 18003 */ {21,209},
+/* 18004 */ {21,209},
+/* 18005 */ {21,209},
+/* 18006 */ {21,209},
+/* 18007 */ {21,209},
+/* 18008 */ {21,209},
+/* 18009 */ {21,209},
+/* 18010 */ {21,209},
+/* 18011 */ {21,209},
+/* 18012 */ {21,209},
+/* 18013 */ {21,209},
+/* 18014 */ {21,209},
+/* 18015 */ {21,209},
+/* 18016 */ {21,209},
+/* 18017 */ {21,209},
+/* 18018 */ {21,209},
+/* 18019 */ {21,209},
+/* 18020 */ {21,209},
+/* 18021 */ {21,209},
+/* 18022 */ {21,209},
+/* 18023 */ {21,209},
+/* 18024 */ {21,209},
+/* 18025 */ {21,209},
+/* 18026 */ {21,209},
+/* 18027 */ {21,209},
+/* 18028 */ {21,209},
+/* 18029 */ {21,209},
+/* 18030 */ {21,209},
+/* 18031 */ {21,209},
+/* 18032 */ {21,209},
+/* 18033 */ {21,209},
+/* 18034 */ {21,209},
+/* 18035 */ {21,209},
+/* 18036 */ {21,209},
+/* 18037 */ {21,209},
+/* 18038 */ {21,209},
+/* 18039 */ {21,209},
+/* 18040 */ {21,209},
+/* 18041 */ {21,209},
+/* 18042 */ {21,209},
+/* 18043 */ {21,209},
+/* 18044 */ {21,209},
+/* 18045 */ {21,209},
+/* 18046 */ {21,209},
+/* 18047 */ {21,209},
+/* 18048 */ {21,209},
+/* 18049 */ {21,209},
+/* 18050 */ {21,209},
+/* 18051 */ {21,209},
+/* 18052 */ {21,209},
+/* 18053 */ {21,209},
+/* 18054 */ {21,209},
+/* 18055 */ {21,209},
+/* 18056 */ {21,209},
+/* 18057 */ {21,209},
+/* 18058 */ {21,209},
+/* 18059 */ {21,209},
+/* 18060 */ {21,209},
+/* 18061 */ {21,209},
+/* 18062 */ {21,209},
+/* 18063 */ {21,209},
+/* 18064 */ {21,209},
+/* 18065 */ {21,209},
+/* 18066 */ {21,209},
+/* 18067 */ {21,209},
+/* 18068 */ {21,209},
+/* 18069 */ {21,209},
+/* 18070 */ {21,209},
+/* 18071 */ {21,209},
+/* 18072 */ {21,209},
+/* 18073 */ {21,209},
+/* 18074 */ {21,209},
+/* 18075 */ {21,209},
+/* 18076 */ {21,209},
+/* 18077 */ {21,209},
+/* 18078 */ {21,209},
+/* 18079 */ {21,209},
+/* 18080 */ {21,209},
+/* 18081 */ {21,209},
+/* 18082 */ {21,209},
+/* 18083 */ {21,209},
+/* 18084 */ {21,209},
+/* 18085 */ {21,209},
+/* 18086 */ {21,209},
+/* 18087 */ {21,209},
+/* 18088 */ {21,209},
+/* 18089 */ {21,209},
+/* 18090 */ {21,209},
+/* 18091 */ {21,209},
+/* 18092 */ {21,209},
+/* 18093 */ {21,209},
+/* 18094 */ {21,209},
+/* 18095 */ {21,209},
+/* 18096 */ {21,209},
+/* 18097 */ {21,209},
+/* 18098 */ {21,209},
+/* 18099 */ {21,209},
+/* 18100 */ {21,209},
+/* 18101 */ {21,209},
+/* 18102 */ {21,209},
+/* 18103 */ {21,209},
+/* 18104 */ {21,209},
+/* 18105 */ {21,209},
+/* 18106 */ {21,209},
+/* 18107 */ {21,209},
+/* 18108 */ {21,209},
+/* 18109 */ {21,209},
+/* 18110 */ {21,209},
+/* 18111 */ {21,209},
+/* 18112 */ {21,209},
+/* 18113 */ {21,209},
+/* 18114 */ {21,209},
+/* 18115 */ {21,209},
+/* 18116 */ {21,209},
+/* 18117 */ {21,209},
+/* 18118 */ {21,209},
+/* 18119 */ {21,209},
+/* 18120 */ {21,209},
+/* 18121 */ {21,209},
+/* 18122 */ {21,209},
+/* 18123 */ {21,209},
+/* 18124 */ {21,209},
+/* 18125 */ {21,209},
+/* 18126 */ {21,209},
+/* 18127 */ {21,209},
+/* 18128 */ {21,209},
+/* 18129 */ {21,209},
+/* 18130 */ {21,209},
+/* 18131 */ {21,209},
+/* 18132 */ {21,209},
+/* 18133 */ {21,209},
+/* 18134 */ {21,209},
+/* 18135 */ {21,209},
+/* 18136 */ {21,209},
+/* 18137 */ {21,209},
+/* 18138 */ {21,209},
+/* 18139 */ {21,209},
+/* 18140 */ {21,209},
+/* 18141 */ {21,209},
+/* 18142 */ {21,209},
+/* 18143 */ {21,209},
+/* 18144 */ {21,209},
+/* 18145 */ {21,209},
+/* 18146 */ {21,209},
+/* 18147 */ {21,209},
+/* 18148 */ {21,209},
+/* 18149 */ {21,209},
+/* 18150 */ {21,209},
+/* 18151 */ {21,209},
+/* 18152 */ {21,209},
+/* 18153 */ {21,209},
+/* 18154 */ {21,209},
+/* 18155 */ {21,209},
+/* 18156 */ {21,209},
+/* 18157 */ {21,209},
+/* 18158 */ {21,209},
+/* 18159 */ {21,209},
+/* 18160 */ {21,209},
+/* 18161 */ {21,209},
+/* 18162 */ {21,209},
+/* 18163 */ {21,209},
+/* 18164 */ {21,209},
+/* 18165 */ {21,209},
+/* 18166 */ {21,209},
+/* 18167 */ {21,209},
+/* 18168 */ {21,209},
+/* 18169 */ {21,209},
+/* 18170 */ {21,209},
+/* 18171 */ {21,209},
+/* 18172 */ {21,209},
+/* 18173 */ {21,209},
+/* 18174 */ {21,209},
+/* 18175 */ {21,209},
+/* 18176 */ {21,209},
+/* 18177 */ {21,209},
+/* 18178 */ {21,209},
+/* 18179 */ {21,209},
+/* 18180 */ {21,209},
+/* 18181 */ {21,209},
+/* 18182 */ {21,209},
+/* 18183 */ {21,209},
+/* 18184 */ {21,209},
+/* 18185 */ {21,209},
+/* 18186 */ {21,209},
+/* 18187 */ {21,209},
+/* 18188 */ {21,209},
+/* 18189 */ {21,209},
+/* 18190 */ {21,209},
+/* 18191 */ {21,209},
+/* 18192 */ {21,209},
+/* 18193 */ {21,209},
+/* 18194 */ {21,209},
+/* 18195 */ {21,209},
+/* 18196 */ {21,209},
+/* 18197 */ {21,209},
+/* 18198 */ {21,209},
+/* 18199 */ {21,209},
+/* 18200 */ {21,209},
+/* 18201 */ {21,209},
+/* 18202 */ {21,209},
+/* 18203 */ {21,209},
+/* 18204 */ {21,209},
+/* 18205 */ {21,209},
+/* 18206 */ {21,209},
+/* 18207 */ {21,209},
+/* 18208 */ {21,209},
+/* 18209 */ {21,209},
+/* 18210 */ {21,209},
+/* 18211 */ {21,209},
+/* 18212 */ {21,209},
+/* 18213 */ {21,209},
+/* 18214 */ {21,209},
+/* 18215 */ {21,209},
+/* 18216 */ {21,209},
+/* 18217 */ {21,209},
+/* 18218 */ {21,209},
+/* 18219 */ {21,209},
+/* 18220 */ {21,209},
+/* 18221 */ {21,209},
+/* 18222 */ {21,209},
+/* 18223 */ {21,209},
+/* 18224 */ {21,209},
+/* 18225 */ {21,209},
+/* 18226 */ {21,209},
+/* 18227 */ {21,209},
+/* 18228 */ {21,209},
+/* 18229 */ {21,209},
+/* 18230 */ {21,209},
+/* 18231 */ {21,209},
+/* 18232 */ {21,209},
+/* 18233 */ {21,209},
+/* 18234 */ {21,209},
+/* 18235 */ {21,209},
+/* 18236 */ {21,209},
+/* 18237 */ {21,209},
+/* 18238 */ {21,209},
+/* 18239 */ {21,209},
+/* 18240 */ {21,209},
+/* 18241 */ {21,209},
+/* 18242 */ {21,209},
+/* 18243 */ {21,209},
+/* 18244 */ {21,209},
+/* 18245 */ {21,209},
+/* 18246 */ {21,209},
+/* 18247 */ {21,209},
+/* 18248 */ {21,209},
+/* 18249 */ {21,209},
+/* 18250 */ {21,209},
+/* 18251 */ {21,209},
+/* 18252 */ {21,209},
+/* 18253 */ {21,209},
+/* 18254 */ {21,209},
+/* 18255 */ {21,209},
+/* 18256 */ {21,209},
+/* 18257 */ {21,209},
+/* 18258 */ {21,209},
+/* 18259 */ {21,209},
+/* 18260 */ {21,209},
+/* 18261 */ {21,209},
+/* 18262 */ {21,209},
+/* 18263 */ {21,209},
+/* 18264 */ {21,209},
+/* 18265 */ {21,209},
+/* 18266 */ {21,209},
+/* 18267 */ {21,209},
+/* 18268 */ {21,209},
+/* 18269 */ {21,209},
+/* 18270 */ {21,209},
+/* 18271 */ {21,209},
+/* 18272 */ {21,209},
+/* 18273 */ {21,209},
+/* 18274 */ {21,209},
+/* 18275 */ {21,209},
+/* 18276 */ {21,209},
+/* 18277 */ {21,209},
+/* 18278 */ {21,209},
+/* 18279 */ {21,209},
+/* 18280 */ {21,209},
+/* 18281 */ {21,209},
+/* 18282 */ {21,209},
+/* 18283 */ {21,209},
+/* 18284 */ {21,209},
+/* 18285 */ {21,209},
+/* 18286 */ {21,209},
+/* 18287 */ {21,209},
+/* 18288 */ {21,209},
+/* 18289 */ {21,209},
+/* 18290 */ {21,209},
+/* 18291 */ {21,209},
+/* 18292 */ {21,209},
+/* 18293 */ {21,209},
+/* 18294 */ {21,209},
+/* 18295 */ {21,209},
+/* 18296 */ {21,209},
+/* 18297 */ {21,209},
+/* 18298 */ {21,209},
+/* 18299 */ {21,209},
+/* 18300 */ {21,209},
+/* 18301 */ {21,209},
+/* 18302 */ {21,209},
+/* 18303 */ {21,209},
+/* 18304 */ {21,209},
+/* 18305 */ {21,209},
+/* 18306 */ {21,209},
+/* 18307 */ {21,209},
+/* 18308 */ {21,209},
+/* 18309 */ {21,209},
+/* 18310 */ {21,209},
+/* 18311 */ {21,209},
+/* 18312 */ {21,209},
+/* 18313 */ {21,209},
+/* 18314 */ {21,209},
+/* 18315 */ {21,209},
+/* 18316 */ {21,209},
+/* 18317 */ {21,209},
+/* 18318 */ {21,209},
+/* 18319 */ {21,209},
+/* 18320 */ {21,209},
+/* 18321 */ {21,209},
+/* 18322 */ {21,209},
+/* 18323 */ {21,209},
+/* 18324 */ {21,209},
+/* 18325 */ {21,209},
+/* 18326 */ {21,209},
+/* 18327 */ {21,209},
+/* 18328 */ {21,209},
+/* 18329 */ {21,209},
+/* 18330 */ {21,209},
+/* 18331 */ {21,209},
+/* 18332 */ {21,209},
+/* 18333 */ {21,209},
+/* 18334 */ {21,209},
+/* 18335 */ {21,209},
+/* 18336 */ {21,209},
+/* 18337 */ {21,209},
+/* 18338 */ {21,209},
+/* 18339 */ {21,209},
+/* 18340 */ {21,209},
+/* 18341 */ {21,209},
+/* 18342 */ {21,209},
+/* 18343 */ {21,209},
+/* 18344 */ {21,209},
+/* 18345 */ {21,209},
+/* 18346 */ {21,209},
+/* 18347 */ {21,209},
+/* 18348 */ {21,209},
+/* 18349 */ {21,209},
+/* 18350 */ {21,209},
+/* 18351 */ {21,209},
+/* 18352 */ {21,209},
+/* 18353 */ {21,209},
+/* 18354 */ {21,209},
+/* 18355 */ {21,209},
+/* 18356 */ {21,209},
+/* 18357 */ {21,209},
+/* 18358 */ {21,209},
+/* 18359 */ {21,209},
+/* 18360 */ {21,209},
+/* 18361 */ {21,209},
+/* 18362 */ {21,209},
+/* 18363 */ {21,209},
+/* 18364 */ {21,209},
+/* 18365 */ {21,209},
+/* 18366 */ {21,209},
+/* 18367 */ {21,209},
+/* 18368 */ {21,209},
+/* 18369 */ {21,209},
+/* 18370 */ {21,209},
+/* 18371 */ {21,209},
+/* 18372 */ {21,209},
+/* 18373 */ {21,209},
+/* 18374 */ {21,209},
+/* 18375 */ {21,209},
+/* 18376 */ {21,209},
+/* 18377 */ {21,209},
+/* 18378 */ {21,209},
+/* 18379 */ {21,209},
+/* 18380 */ {21,209},
+/* 18381 */ {21,209},
+/* 18382 */ {21,209},
+/* 18383 */ {21,209},
+/* 18384 */ {21,209},
+/* 18385 */ {21,209},
+/* 18386 */ {21,209},
+/* 18387 */ {21,209},
+/* 18388 */ {21,209},
+/* 18389 */ {21,209},
+/* 18390 */ {21,209},
+/* 18391 */ {21,209},
+/* 18392 */ {21,209},
+/* 18393 */ {21,209},
+/* 18394 */ {21,209},
+/* 18395 */ {21,209},
+/* 18396 */ {21,209},
+/* 18397 */ {21,209},
+/* 18398 */ {21,209},
+/* 18399 */ {21,209},
+/* 18400 */ {21,209},
+/* 18401 */ {21,209},
+/* 18402 */ {21,209},
+/* 18403 */ {21,209},
+/* 18404 */ {21,209},
+/* 18405 */ {21,209},
+/* 18406 */ {21,209},
+/* 18407 */ {21,209},
+/* 18408 */ {21,209},
+/* 18409 */ {21,209},
+/* 18410 */ {21,209},
+/* 18411 */ {21,209},
+/* 18412 */ {21,209},
+/* 18413 */ {21,209},
+/* 18414 */ {21,209},
+/* 18415 */ {21,209},
+/* 18416 */ {21,209},
+/* 18417 */ {21,209},
+/* 18418 */ {21,209},
+/* 18419 */ {21,209},
+/* 18420 */ {21,209},
+/* 18421 */ {21,209},
+/* 18422 */ {21,209},
+/* 18423 */ {21,209},
+/* 18424 */ {21,209},
+/* 18425 */ {21,209},
+/* 18426 */ {21,209},
+/* 18427 */ {21,209},
+/* 18428 */ {21,209},
+/* 18429 */ {21,209},
+/* 18430 */ {21,209},
+/* 18431 */ {21,209},
+/* 18432 */ {21,216},
+/* 18433 */ {21,216},
+/* 18434 */ {21,216},
+/* 18435 */ {21,216},
+/* 18436 */ {21,216},
+/* 18437 */ {21,216},
+/* 18438 */ {21,216},
+/* 18439 */ {21,216},
+/* 18440 */ {21,216},
+/* 18441 */ {21,216},
+/* 18442 */ {21,216},
+/* 18443 */ {21,216},
+/* 18444 */ {21,216},
+/* 18445 */ {21,216},
+/* 18446 */ {21,216},
+/* 18447 */ {21,216},
+/* 18448 */ {21,216},
+/* 18449 */ {21,216},
+/* 18450 */ {21,216},
+/* 18451 */ {21,216},
+/* 18452 */ {21,216},
+/* 18453 */ {21,216},
+/* 18454 */ {21,216},
+/* 18455 */ {21,216},
+/* 18456 */ {21,216},
+/* 18457 */ {21,216},
+/* 18458 */ {21,216},
+/* 18459 */ {21,216},
+/* 18460 */ {21,216},
+/* 18461 */ {21,216},
+/* 18462 */ {21,216},
+/* 18463 */ {21,216},
+/* 18464 */ {21,216},
+/* 18465 */ {21,216},
+/* 18466 */ {21,216},
+/* 18467 */ {21,216},
+/* 18468 */ {21,216},
+/* 18469 */ {21,216},
+/* 18470 */ {21,216},
+/* 18471 */ {21,216},
+/* 18472 */ {21,216},
+/* 18473 */ {21,216},
+/* 18474 */ {21,216},
+/* 18475 */ {21,216},
+/* 18476 */ {21,216},
+/* 18477 */ {21,216},
+/* 18478 */ {21,216},
+/* 18479 */ {21,216},
+/* 18480 */ {21,216},
+/* 18481 */ {21,216},
+/* 18482 */ {21,216},
+/* 18483 */ {21,216},
+/* 18484 */ {21,216},
+/* 18485 */ {21,216},
+/* 18486 */ {21,216},
+/* 18487 */ {21,216},
+/* 18488 */ {21,216},
+/* 18489 */ {21,216},
+/* 18490 */ {21,216},
+/* 18491 */ {21,216},
+/* 18492 */ {21,216},
+/* 18493 */ {21,216},
+/* 18494 */ {21,216},
+/* 18495 */ {21,216},
+/* 18496 */ {21,216},
+/* 18497 */ {21,216},
+/* 18498 */ {21,216},
+/* 18499 */ {21,216},
+/* 18500 */ {21,216},
+/* 18501 */ {21,216},
+/* 18502 */ {21,216},
+/* 18503 */ {21,216},
+/* 18504 */ {21,216},
+/* 18505 */ {21,216},
+/* 18506 */ {21,216},
+/* 18507 */ {21,216},
+/* 18508 */ {21,216},
+/* 18509 */ {21,216},
+/* 18510 */ {21,216},
+/* 18511 */ {21,216},
+/* 18512 */ {21,216},
+/* 18513 */ {21,216},
+/* 18514 */ {21,216},
+/* 18515 */ {21,216},
+/* 18516 */ {21,216},
+/* 18517 */ {21,216},
+/* 18518 */ {21,216},
+/* 18519 */ {21,216},
+/* 18520 */ {21,216},
+/* 18521 */ {21,216},
+/* 18522 */ {21,216},
+/* 18523 */ {21,216},
+/* 18524 */ {21,216},
+/* 18525 */ {21,216},
+/* 18526 */ {21,216},
+/* 18527 */ {21,216},
+/* 18528 */ {21,216},
+/* 18529 */ {21,216},
+/* 18530 */ {21,216},
+/* 18531 */ {21,216},
+/* 18532 */ {21,216},
+/* 18533 */ {21,216},
+/* 18534 */ {21,216},
+/* 18535 */ {21,216},
+/* 18536 */ {21,216},
+/* 18537 */ {21,216},
+/* 18538 */ {21,216},
+/* 18539 */ {21,216},
+/* 18540 */ {21,216},
+/* 18541 */ {21,216},
+/* 18542 */ {21,216},
+/* 18543 */ {21,216},
+/* 18544 */ {21,216},
+/* 18545 */ {21,216},
+/* 18546 */ {21,216},
+/* 18547 */ {21,216},
+/* 18548 */ {21,216},
+/* 18549 */ {21,216},
+/* 18550 */ {21,216},
+/* 18551 */ {21,216},
+/* 18552 */ {21,216},
+/* 18553 */ {21,216},
+/* 18554 */ {21,216},
+/* 18555 */ {21,216},
+/* 18556 */ {21,216},
+/* 18557 */ {21,216},
+/* 18558 */ {21,216},
+/* 18559 */ {21,216},
+/* 18560 */ {21,216},
+/* 18561 */ {21,216},
+/* 18562 */ {21,216},
+/* 18563 */ {21,216},
+/* 18564 */ {21,216},
+/* 18565 */ {21,216},
+/* 18566 */ {21,216},
+/* 18567 */ {21,216},
+/* 18568 */ {21,216},
+/* 18569 */ {21,216},
+/* 18570 */ {21,216},
+/* 18571 */ {21,216},
+/* 18572 */ {21,216},
+/* 18573 */ {21,216},
+/* 18574 */ {21,216},
+/* 18575 */ {21,216},
+/* 18576 */ {21,216},
+/* 18577 */ {21,216},
+/* 18578 */ {21,216},
+/* 18579 */ {21,216},
+/* 18580 */ {21,216},
+/* 18581 */ {21,216},
+/* 18582 */ {21,216},
+/* 18583 */ {21,216},
+/* 18584 */ {21,216},
+/* 18585 */ {21,216},
+/* 18586 */ {21,216},
+/* 18587 */ {21,216},
+/* 18588 */ {21,216},
+/* 18589 */ {21,216},
+/* 18590 */ {21,216},
+/* 18591 */ {21,216},
+/* 18592 */ {21,216},
+/* 18593 */ {21,216},
+/* 18594 */ {21,216},
+/* 18595 */ {21,216},
+/* 18596 */ {21,216},
+/* 18597 */ {21,216},
+/* 18598 */ {21,216},
+/* 18599 */ {21,216},
+/* 18600 */ {21,216},
+/* 18601 */ {21,216},
+/* 18602 */ {21,216},
+/* 18603 */ {21,216},
+/* 18604 */ {21,216},
+/* 18605 */ {21,216},
+/* 18606 */ {21,216},
+/* 18607 */ {21,216},
+/* 18608 */ {21,216},
+/* 18609 */ {21,216},
+/* 18610 */ {21,216},
+/* 18611 */ {21,216},
+/* 18612 */ {21,216},
+/* 18613 */ {21,216},
+/* 18614 */ {21,216},
+/* 18615 */ {21,216},
+/* 18616 */ {21,216},
+/* 18617 */ {21,216},
+/* 18618 */ {21,216},
+/* 18619 */ {21,216},
+/* 18620 */ {21,216},
+/* 18621 */ {21,216},
+/* 18622 */ {21,216},
+/* 18623 */ {21,216},
+/* 18624 */ {21,216},
+/* 18625 */ {21,216},
+/* 18626 */ {21,216},
+/* 18627 */ {21,216},
+/* 18628 */ {21,216},
+/* 18629 */ {21,216},
+/* 18630 */ {21,216},
+/* 18631 */ {21,216},
+/* 18632 */ {21,216},
+/* 18633 */ {21,216},
+/* 18634 */ {21,216},
+/* 18635 */ {21,216},
+/* 18636 */ {21,216},
+/* 18637 */ {21,216},
+/* 18638 */ {21,216},
+/* 18639 */ {21,216},
+/* 18640 */ {21,216},
+/* 18641 */ {21,216},
+/* 18642 */ {21,216},
+/* 18643 */ {21,216},
+/* 18644 */ {21,216},
+/* 18645 */ {21,216},
+/* 18646 */ {21,216},
+/* 18647 */ {21,216},
+/* 18648 */ {21,216},
+/* 18649 */ {21,216},
+/* 18650 */ {21,216},
+/* 18651 */ {21,216},
+/* 18652 */ {21,216},
+/* 18653 */ {21,216},
+/* 18654 */ {21,216},
+/* 18655 */ {21,216},
+/* 18656 */ {21,216},
+/* 18657 */ {21,216},
+/* 18658 */ {21,216},
+/* 18659 */ {21,216},
+/* 18660 */ {21,216},
+/* 18661 */ {21,216},
+/* 18662 */ {21,216},
+/* 18663 */ {21,216},
+/* 18664 */ {21,216},
+/* 18665 */ {21,216},
+/* 18666 */ {21,216},
+/* 18667 */ {21,216},
+/* 18668 */ {21,216},
+/* 18669 */ {21,216},
+/* 18670 */ {21,216},
+/* 18671 */ {21,216},
+/* 18672 */ {21,216},
+/* 18673 */ {21,216},
+/* 18674 */ {21,216},
+/* 18675 */ {21,216},
+/* 18676 */ {21,216},
+/* 18677 */ {21,216},
+/* 18678 */ {21,216},
+/* 18679 */ {21,216},
+/* 18680 */ {21,216},
+/* 18681 */ {21,216},
+/* 18682 */ {21,216},
+/* 18683 */ {21,216},
+/* 18684 */ {21,216},
+/* 18685 */ {21,216},
+/* 18686 */ {21,216},
+/* 18687 */ {21,216},
+/* 18688 */ {21,216},
+/* 18689 */ {21,216},
+/* 18690 */ {21,216},
+/* 18691 */ {21,216},
+/* 18692 */ {21,216},
+/* 18693 */ {21,216},
+/* 18694 */ {21,216},
+/* 18695 */ {21,216},
+/* 18696 */ {21,216},
+/* 18697 */ {21,216},
+/* 18698 */ {21,216},
+/* 18699 */ {21,216},
+/* 18700 */ {21,216},
+/* 18701 */ {21,216},
+/* 18702 */ {21,216},
+/* 18703 */ {21,216},
+/* 18704 */ {21,216},
+/* 18705 */ {21,216},
+/* 18706 */ {21,216},
+/* 18707 */ {21,216},
+/* 18708 */ {21,216},
+/* 18709 */ {21,216},
+/* 18710 */ {21,216},
+/* 18711 */ {21,216},
+/* 18712 */ {21,216},
+/* 18713 */ {21,216},
+/* 18714 */ {21,216},
+/* 18715 */ {21,216},
+/* 18716 */ {21,216},
+/* 18717 */ {21,216},
+/* 18718 */ {21,216},
+/* 18719 */ {21,216},
+/* 18720 */ {21,216},
+/* 18721 */ {21,216},
+/* 18722 */ {21,216},
+/* 18723 */ {21,216},
+/* 18724 */ {21,216},
+/* 18725 */ {21,216},
+/* 18726 */ {21,216},
+/* 18727 */ {21,216},
+/* 18728 */ {21,216},
+/* 18729 */ {21,216},
+/* 18730 */ {21,216},
+/* 18731 */ {21,216},
+/* 18732 */ {21,216},
+/* 18733 */ {21,216},
+/* 18734 */ {21,216},
+/* 18735 */ {21,216},
+/* 18736 */ {21,216},
+/* 18737 */ {21,216},
+/* 18738 */ {21,216},
+/* 18739 */ {21,216},
+/* 18740 */ {21,216},
+/* 18741 */ {21,216},
+/* 18742 */ {21,216},
+/* 18743 */ {21,216},
+/* 18744 */ {21,216},
+/* 18745 */ {21,216},
+/* 18746 */ {21,216},
+/* 18747 */ {21,216},
+/* 18748 */ {21,216},
+/* 18749 */ {21,216},
+/* 18750 */ {21,216},
+/* 18751 */ {21,216},
+/* 18752 */ {21,216},
+/* 18753 */ {21,216},
+/* 18754 */ {21,216},
+/* 18755 */ {21,216},
+/* 18756 */ {21,216},
+/* 18757 */ {21,216},
+/* 18758 */ {21,216},
+/* 18759 */ {21,216},
+/* 18760 */ {21,216},
+/* 18761 */ {21,216},
+/* 18762 */ {21,216},
+/* 18763 */ {21,216},
+/* 18764 */ {21,216},
+/* 18765 */ {21,216},
+/* 18766 */ {21,216},
+/* 18767 */ {21,216},
+/* 18768 */ {21,216},
+/* 18769 */ {21,216},
+/* 18770 */ {21,216},
+/* 18771 */ {21,216},
+/* 18772 */ {21,216},
+/* 18773 */ {21,216},
+/* 18774 */ {21,216},
+/* 18775 */ {21,216},
+/* 18776 */ {21,216},
+/* 18777 */ {21,216},
+/* 18778 */ {21,216},
+/* 18779 */ {21,216},
+/* 18780 */ {21,216},
+/* 18781 */ {21,216},
+/* 18782 */ {21,216},
+/* 18783 */ {21,216},
+/* 18784 */ {21,216},
+/* 18785 */ {21,216},
+/* 18786 */ {21,216},
+/* 18787 */ {21,216},
+/* 18788 */ {21,216},
+/* 18789 */ {21,216},
+/* 18790 */ {21,216},
+/* 18791 */ {21,216},
+/* 18792 */ {21,216},
+/* 18793 */ {21,216},
+/* 18794 */ {21,216},
+/* 18795 */ {21,216},
+/* 18796 */ {21,216},
+/* 18797 */ {21,216},
+/* 18798 */ {21,216},
+/* 18799 */ {21,216},
+/* 18800 */ {21,216},
+/* 18801 */ {21,216},
+/* 18802 */ {21,216},
+/* 18803 */ {21,216},
+/* 18804 */ {21,216},
+/* 18805 */ {21,216},
+/* 18806 */ {21,216},
+/* 18807 */ {21,216},
+/* 18808 */ {21,216},
+/* 18809 */ {21,216},
+/* 18810 */ {21,216},
+/* 18811 */ {21,216},
+/* 18812 */ {21,216},
+/* 18813 */ {21,216},
+/* 18814 */ {21,216},
+/* 18815 */ {21,216},
+/* 18816 */ {21,216},
+/* 18817 */ {21,216},
+/* 18818 */ {21,216},
+/* 18819 */ {21,216},
+/* 18820 */ {21,216},
+/* 18821 */ {21,216},
+/* 18822 */ {21,216},
+/* 18823 */ {21,216},
+/* 18824 */ {21,216},
+/* 18825 */ {21,216},
+/* 18826 */ {21,216},
+/* 18827 */ {21,216},
+/* 18828 */ {21,216},
+/* 18829 */ {21,216},
+/* 18830 */ {21,216},
+/* 18831 */ {21,216},
+/* 18832 */ {21,216},
+/* 18833 */ {21,216},
+/* 18834 */ {21,216},
+/* 18835 */ {21,216},
+/* 18836 */ {21,216},
+/* 18837 */ {21,216},
+/* 18838 */ {21,216},
+/* 18839 */ {21,216},
+/* 18840 */ {21,216},
+/* 18841 */ {21,216},
+/* 18842 */ {21,216},
+/* 18843 */ {21,216},
+/* 18844 */ {21,216},
+/* 18845 */ {21,216},
+/* 18846 */ {21,216},
+/* 18847 */ {21,216},
+/* 18848 */ {21,216},
+/* 18849 */ {21,216},
+/* 18850 */ {21,216},
+/* 18851 */ {21,216},
+/* 18852 */ {21,216},
+/* 18853 */ {21,216},
+/* 18854 */ {21,216},
+/* 18855 */ {21,216},
+/* 18856 */ {21,216},
+/* 18857 */ {21,216},
+/* 18858 */ {21,216},
+/* 18859 */ {21,216},
+/* 18860 */ {21,216},
+/* 18861 */ {21,216},
+/* 18862 */ {21,216},
+/* 18863 */ {21,216},
+/* 18864 */ {21,216},
+/* 18865 */ {21,216},
+/* 18866 */ {21,216},
+/* 18867 */ {21,216},
+/* 18868 */ {21,216},
+/* 18869 */ {21,216},
+/* 18870 */ {21,216},
+/* 18871 */ {21,216},
+/* 18872 */ {21,216},
+/* 18873 */ {21,216},
+/* 18874 */ {21,216},
+/* 18875 */ {21,216},
+/* 18876 */ {21,216},
+/* 18877 */ {21,216},
+/* 18878 */ {21,216},
+/* 18879 */ {21,216},
+/* 18880 */ {21,216},
+/* 18881 */ {21,216},
+/* 18882 */ {21,216},
+/* 18883 */ {21,216},
+/* 18884 */ {21,216},
+/* 18885 */ {21,216},
+/* 18886 */ {21,216},
+/* 18887 */ {21,216},
+/* 18888 */ {21,216},
+/* 18889 */ {21,216},
+/* 18890 */ {21,216},
+/* 18891 */ {21,216},
+/* 18892 */ {21,216},
+/* 18893 */ {21,216},
+/* 18894 */ {21,216},
+/* 18895 */ {21,216},
+/* 18896 */ {21,216},
+/* 18897 */ {21,216},
+/* 18898 */ {21,216},
+/* 18899 */ {21,216},
+/* 18900 */ {21,216},
+/* 18901 */ {21,216},
+/* 18902 */ {21,216},
+/* 18903 */ {21,216},
+/* 18904 */ {21,216},
+/* 18905 */ {21,216},
+/* 18906 */ {21,216},
+/* 18907 */ {21,216},
+/* 18908 */ {21,216},
+/* 18909 */ {21,216},
+/* 18910 */ {21,216},
+/* 18911 */ {21,216},
+/* 18912 */ {21,216},
+/* 18913 */ {21,216},
+/* 18914 */ {21,216},
+/* 18915 */ {21,216},
+/* 18916 */ {21,216},
+/* 18917 */ {21,216},
+/* 18918 */ {21,216},
+/* 18919 */ {21,216},
+/* 18920 */ {21,216},
+/* 18921 */ {21,216},
+/* 18922 */ {21,216},
+/* 18923 */ {21,216},
+/* 18924 */ {21,216},
+/* 18925 */ {21,216},
+/* 18926 */ {21,216},
+/* 18927 */ {21,216},
+/* 18928 */ {21,216},
+/* 18929 */ {21,216},
+/* 18930 */ {21,216},
+/* 18931 */ {21,216},
+/* 18932 */ {21,216},
+/* 18933 */ {21,216},
+/* 18934 */ {21,216},
+/* 18935 */ {21,216},
+/* 18936 */ {21,216},
+/* 18937 */ {21,216},
+/* 18938 */ {21,216},
+/* 18939 */ {21,216},
+/* 18940 */ {21,216},
+/* 18941 */ {21,216},
+/* 18942 */ {21,216},
+/* 18943 */ {21,216},
+/* 18944 */ {21,217},
+/* 18945 */ {21,217},
+/* 18946 */ {21,217},
+/* 18947 */ {21,217},
+/* 18948 */ {21,217},
+/* 18949 */ {21,217},
+/* 18950 */ {21,217},
+/* 18951 */ {21,217},
+/* 18952 */ {21,217},
+/* 18953 */ {21,217},
+/* 18954 */ {21,217},
+/* 18955 */ {21,217},
+/* 18956 */ {21,217},
+/* 18957 */ {21,217},
+/* 18958 */ {21,217},
+/* 18959 */ {21,217},
+/* 18960 */ {21,217},
+/* 18961 */ {21,217},
+/* 18962 */ {21,217},
+/* 18963 */ {21,217},
+/* 18964 */ {21,217},
+/* 18965 */ {21,217},
+/* 18966 */ {21,217},
+/* 18967 */ {21,217},
+/* 18968 */ {21,217},
+/* 18969 */ {21,217},
+/* 18970 */ {21,217},
+/* 18971 */ {21,217},
+/* 18972 */ {21,217},
+/* 18973 */ {21,217},
+/* 18974 */ {21,217},
+/* 18975 */ {21,217},
+/* 18976 */ {21,217},
+/* 18977 */ {21,217},
+/* 18978 */ {21,217},
+/* 18979 */ {21,217},
+/* 18980 */ {21,217},
+/* 18981 */ {21,217},
+/* 18982 */ {21,217},
+/* 18983 */ {21,217},
+/* 18984 */ {21,217},
+/* 18985 */ {21,217},
+/* 18986 */ {21,217},
+/* 18987 */ {21,217},
+/* 18988 */ {21,217},
+/* 18989 */ {21,217},
+/* 18990 */ {21,217},
+/* 18991 */ {21,217},
+/* 18992 */ {21,217},
+/* 18993 */ {21,217},
+/* 18994 */ {21,217},
+/* 18995 */ {21,217},
+/* 18996 */ {21,217},
+/* 18997 */ {21,217},
+/* 18998 */ {21,217},
+/* 18999 */ {21,217},
+/* 19000 */ {21,217},
+/* 19001 */ {21,217},
+/* 19002 */ {21,217},
+/* 19003 */ {21,217},
+/* 19004 */ {21,217},
+/* 19005 */ {21,217},
+/* 19006 */ {21,217},
+/* 19007 */ {21,217},
+/* 19008 */ {21,217},
+/* 19009 */ {21,217},
+/* 19010 */ {21,217},
+/* 19011 */ {21,217},
+/* 19012 */ {21,217},
+/* 19013 */ {21,217},
+/* 19014 */ {21,217},
+/* 19015 */ {21,217},
+/* 19016 */ {21,217},
+/* 19017 */ {21,217},
+/* 19018 */ {21,217},
+/* 19019 */ {21,217},
+/* 19020 */ {21,217},
+/* 19021 */ {21,217},
+/* 19022 */ {21,217},
+/* 19023 */ {21,217},
+/* 19024 */ {21,217},
+/* 19025 */ {21,217},
+/* 19026 */ {21,217},
+/* 19027 */ {21,217},
+/* 19028 */ {21,217},
+/* 19029 */ {21,217},
+/* 19030 */ {21,217},
+/* 19031 */ {21,217},
+/* 19032 */ {21,217},
+/* 19033 */ {21,217},
+/* 19034 */ {21,217},
+/* 19035 */ {21,217},
+/* 19036 */ {21,217},
+/* 19037 */ {21,217},
+/* 19038 */ {21,217},
+/* 19039 */ {21,217},
+/* 19040 */ {21,217},
+/* 19041 */ {21,217},
+/* 19042 */ {21,217},
+/* 19043 */ {21,217},
+/* 19044 */ {21,217},
+/* 19045 */ {21,217},
+/* 19046 */ {21,217},
+/* 19047 */ {21,217},
+/* 19048 */ {21,217},
+/* 19049 */ {21,217},
+/* 19050 */ {21,217},
+/* 19051 */ {21,217},
+/* 19052 */ {21,217},
+/* 19053 */ {21,217},
+/* 19054 */ {21,217},
+/* 19055 */ {21,217},
+/* 19056 */ {21,217},
+/* 19057 */ {21,217},
+/* 19058 */ {21,217},
+/* 19059 */ {21,217},
+/* 19060 */ {21,217},
+/* 19061 */ {21,217},
+/* 19062 */ {21,217},
+/* 19063 */ {21,217},
+/* 19064 */ {21,217},
+/* 19065 */ {21,217},
+/* 19066 */ {21,217},
+/* 19067 */ {21,217},
+/* 19068 */ {21,217},
+/* 19069 */ {21,217},
+/* 19070 */ {21,217},
+/* 19071 */ {21,217},
+/* 19072 */ {21,217},
+/* 19073 */ {21,217},
+/* 19074 */ {21,217},
+/* 19075 */ {21,217},
+/* 19076 */ {21,217},
+/* 19077 */ {21,217},
+/* 19078 */ {21,217},
+/* 19079 */ {21,217},
+/* 19080 */ {21,217},
+/* 19081 */ {21,217},
+/* 19082 */ {21,217},
+/* 19083 */ {21,217},
+/* 19084 */ {21,217},
+/* 19085 */ {21,217},
+/* 19086 */ {21,217},
+/* 19087 */ {21,217},
+/* 19088 */ {21,217},
+/* 19089 */ {21,217},
+/* 19090 */ {21,217},
+/* 19091 */ {21,217},
+/* 19092 */ {21,217},
+/* 19093 */ {21,217},
+/* 19094 */ {21,217},
+/* 19095 */ {21,217},
+/* 19096 */ {21,217},
+/* 19097 */ {21,217},
+/* 19098 */ {21,217},
+/* 19099 */ {21,217},
+/* 19100 */ {21,217},
+/* 19101 */ {21,217},
+/* 19102 */ {21,217},
+/* 19103 */ {21,217},
+/* 19104 */ {21,217},
+/* 19105 */ {21,217},
+/* 19106 */ {21,217},
+/* 19107 */ {21,217},
+/* 19108 */ {21,217},
+/* 19109 */ {21,217},
+/* 19110 */ {21,217},
+/* 19111 */ {21,217},
+/* 19112 */ {21,217},
+/* 19113 */ {21,217},
+/* 19114 */ {21,217},
+/* 19115 */ {21,217},
+/* 19116 */ {21,217},
+/* 19117 */ {21,217},
+/* 19118 */ {21,217},
+/* 19119 */ {21,217},
+/* 19120 */ {21,217},
+/* 19121 */ {21,217},
+/* 19122 */ {21,217},
+/* 19123 */ {21,217},
+/* 19124 */ {21,217},
+/* 19125 */ {21,217},
+/* 19126 */ {21,217},
+/* 19127 */ {21,217},
+/* 19128 */ {21,217},
+/* 19129 */ {21,217},
+/* 19130 */ {21,217},
+/* 19131 */ {21,217},
+/* 19132 */ {21,217},
+/* 19133 */ {21,217},
+/* 19134 */ {21,217},
+/* 19135 */ {21,217},
+/* 19136 */ {21,217},
+/* 19137 */ {21,217},
+/* 19138 */ {21,217},
+/* 19139 */ {21,217},
+/* 19140 */ {21,217},
+/* 19141 */ {21,217},
+/* 19142 */ {21,217},
+/* 19143 */ {21,217},
+/* 19144 */ {21,217},
+/* 19145 */ {21,217},
+/* 19146 */ {21,217},
+/* 19147 */ {21,217},
+/* 19148 */ {21,217},
+/* 19149 */ {21,217},
+/* 19150 */ {21,217},
+/* 19151 */ {21,217},
+/* 19152 */ {21,217},
+/* 19153 */ {21,217},
+/* 19154 */ {21,217},
+/* 19155 */ {21,217},
+/* 19156 */ {21,217},
+/* 19157 */ {21,217},
+/* 19158 */ {21,217},
+/* 19159 */ {21,217},
+/* 19160 */ {21,217},
+/* 19161 */ {21,217},
+/* 19162 */ {21,217},
+/* 19163 */ {21,217},
+/* 19164 */ {21,217},
+/* 19165 */ {21,217},
+/* 19166 */ {21,217},
+/* 19167 */ {21,217},
+/* 19168 */ {21,217},
+/* 19169 */ {21,217},
+/* 19170 */ {21,217},
+/* 19171 */ {21,217},
+/* 19172 */ {21,217},
+/* 19173 */ {21,217},
+/* 19174 */ {21,217},
+/* 19175 */ {21,217},
+/* 19176 */ {21,217},
+/* 19177 */ {21,217},
+/* 19178 */ {21,217},
+/* 19179 */ {21,217},
+/* 19180 */ {21,217},
+/* 19181 */ {21,217},
+/* 19182 */ {21,217},
+/* 19183 */ {21,217},
+/* 19184 */ {21,217},
+/* 19185 */ {21,217},
+/* 19186 */ {21,217},
+/* 19187 */ {21,217},
+/* 19188 */ {21,217},
+/* 19189 */ {21,217},
+/* 19190 */ {21,217},
+/* 19191 */ {21,217},
+/* 19192 */ {21,217},
+/* 19193 */ {21,217},
+/* 19194 */ {21,217},
+/* 19195 */ {21,217},
+/* 19196 */ {21,217},
+/* 19197 */ {21,217},
+/* 19198 */ {21,217},
+/* 19199 */ {21,217},
+/* 19200 */ {21,217},
+/* 19201 */ {21,217},
+/* 19202 */ {21,217},
+/* 19203 */ {21,217},
+/* 19204 */ {21,217},
+/* 19205 */ {21,217},
+/* 19206 */ {21,217},
+/* 19207 */ {21,217},
+/* 19208 */ {21,217},
+/* 19209 */ {21,217},
+/* 19210 */ {21,217},
+/* 19211 */ {21,217},
+/* 19212 */ {21,217},
+/* 19213 */ {21,217},
+/* 19214 */ {21,217},
+/* 19215 */ {21,217},
+/* 19216 */ {21,217},
+/* 19217 */ {21,217},
+/* 19218 */ {21,217},
+/* 19219 */ {21,217},
+/* 19220 */ {21,217},
+/* 19221 */ {21,217},
+/* 19222 */ {21,217},
+/* 19223 */ {21,217},
+/* 19224 */ {21,217},
+/* 19225 */ {21,217},
+/* 19226 */ {21,217},
+/* 19227 */ {21,217},
+/* 19228 */ {21,217},
+/* 19229 */ {21,217},
+/* 19230 */ {21,217},
+/* 19231 */ {21,217},
+/* 19232 */ {21,217},
+/* 19233 */ {21,217},
+/* 19234 */ {21,217},
+/* 19235 */ {21,217},
+/* 19236 */ {21,217},
+/* 19237 */ {21,217},
+/* 19238 */ {21,217},
+/* 19239 */ {21,217},
+/* 19240 */ {21,217},
+/* 19241 */ {21,217},
+/* 19242 */ {21,217},
+/* 19243 */ {21,217},
+/* 19244 */ {21,217},
+/* 19245 */ {21,217},
+/* 19246 */ {21,217},
+/* 19247 */ {21,217},
+/* 19248 */ {21,217},
+/* 19249 */ {21,217},
+/* 19250 */ {21,217},
+/* 19251 */ {21,217},
+/* 19252 */ {21,217},
+/* 19253 */ {21,217},
+/* 19254 */ {21,217},
+/* 19255 */ {21,217},
+/* 19256 */ {21,217},
+/* 19257 */ {21,217},
+/* 19258 */ {21,217},
+/* 19259 */ {21,217},
+/* 19260 */ {21,217},
+/* 19261 */ {21,217},
+/* 19262 */ {21,217},
+/* 19263 */ {21,217},
+/* 19264 */ {21,217},
+/* 19265 */ {21,217},
+/* 19266 */ {21,217},
+/* 19267 */ {21,217},
+/* 19268 */ {21,217},
+/* 19269 */ {21,217},
+/* 19270 */ {21,217},
+/* 19271 */ {21,217},
+/* 19272 */ {21,217},
+/* 19273 */ {21,217},
+/* 19274 */ {21,217},
+/* 19275 */ {21,217},
+/* 19276 */ {21,217},
+/* 19277 */ {21,217},
+/* 19278 */ {21,217},
+/* 19279 */ {21,217},
+/* 19280 */ {21,217},
+/* 19281 */ {21,217},
+/* 19282 */ {21,217},
+/* 19283 */ {21,217},
+/* 19284 */ {21,217},
+/* 19285 */ {21,217},
+/* 19286 */ {21,217},
+/* 19287 */ {21,217},
+/* 19288 */ {21,217},
+/* 19289 */ {21,217},
+/* 19290 */ {21,217},
+/* 19291 */ {21,217},
+/* 19292 */ {21,217},
+/* 19293 */ {21,217},
+/* 19294 */ {21,217},
+/* 19295 */ {21,217},
+/* 19296 */ {21,217},
+/* 19297 */ {21,217},
+/* 19298 */ {21,217},
+/* 19299 */ {21,217},
+/* 19300 */ {21,217},
+/* 19301 */ {21,217},
+/* 19302 */ {21,217},
+/* 19303 */ {21,217},
+/* 19304 */ {21,217},
+/* 19305 */ {21,217},
+/* 19306 */ {21,217},
+/* 19307 */ {21,217},
+/* 19308 */ {21,217},
+/* 19309 */ {21,217},
+/* 19310 */ {21,217},
+/* 19311 */ {21,217},
+/* 19312 */ {21,217},
+/* 19313 */ {21,217},
+/* 19314 */ {21,217},
+/* 19315 */ {21,217},
+/* 19316 */ {21,217},
+/* 19317 */ {21,217},
+/* 19318 */ {21,217},
+/* 19319 */ {21,217},
+/* 19320 */ {21,217},
+/* 19321 */ {21,217},
+/* 19322 */ {21,217},
+/* 19323 */ {21,217},
+/* 19324 */ {21,217},
+/* 19325 */ {21,217},
+/* 19326 */ {21,217},
+/* 19327 */ {21,217},
+/* 19328 */ {21,217},
+/* 19329 */ {21,217},
+/* 19330 */ {21,217},
+/* 19331 */ {21,217},
+/* 19332 */ {21,217},
+/* 19333 */ {21,217},
+/* 19334 */ {21,217},
+/* 19335 */ {21,217},
+/* 19336 */ {21,217},
+/* 19337 */ {21,217},
+/* 19338 */ {21,217},
+/* 19339 */ {21,217},
+/* 19340 */ {21,217},
+/* 19341 */ {21,217},
+/* 19342 */ {21,217},
+/* 19343 */ {21,217},
+/* 19344 */ {21,217},
+/* 19345 */ {21,217},
+/* 19346 */ {21,217},
+/* 19347 */ {21,217},
+/* 19348 */ {21,217},
+/* 19349 */ {21,217},
+/* 19350 */ {21,217},
+/* 19351 */ {21,217},
+/* 19352 */ {21,217},
+/* 19353 */ {21,217},
+/* 19354 */ {21,217},
+/* 19355 */ {21,217},
+/* 19356 */ {21,217},
+/* 19357 */ {21,217},
+/* 19358 */ {21,217},
+/* 19359 */ {21,217},
+/* 19360 */ {21,217},
+/* 19361 */ {21,217},
+/* 19362 */ {21,217},
+/* 19363 */ {21,217},
+/* 19364 */ {21,217},
+/* 19365 */ {21,217},
+/* 19366 */ {21,217},
+/* 19367 */ {21,217},
+/* 19368 */ {21,217},
+/* 19369 */ {21,217},
+/* 19370 */ {21,217},
+/* 19371 */ {21,217},
+/* 19372 */ {21,217},
+/* 19373 */ {21,217},
+/* 19374 */ {21,217},
+/* 19375 */ {21,217},
+/* 19376 */ {21,217},
+/* 19377 */ {21,217},
+/* 19378 */ {21,217},
+/* 19379 */ {21,217},
+/* 19380 */ {21,217},
+/* 19381 */ {21,217},
+/* 19382 */ {21,217},
+/* 19383 */ {21,217},
+/* 19384 */ {21,217},
+/* 19385 */ {21,217},
+/* 19386 */ {21,217},
+/* 19387 */ {21,217},
+/* 19388 */ {21,217},
+/* 19389 */ {21,217},
+/* 19390 */ {21,217},
+/* 19391 */ {21,217},
+/* 19392 */ {21,217},
+/* 19393 */ {21,217},
+/* 19394 */ {21,217},
+/* 19395 */ {21,217},
+/* 19396 */ {21,217},
+/* 19397 */ {21,217},
+/* 19398 */ {21,217},
+/* 19399 */ {21,217},
+/* 19400 */ {21,217},
+/* 19401 */ {21,217},
+/* 19402 */ {21,217},
+/* 19403 */ {21,217},
+/* 19404 */ {21,217},
+/* 19405 */ {21,217},
+/* 19406 */ {21,217},
+/* 19407 */ {21,217},
+/* 19408 */ {21,217},
+/* 19409 */ {21,217},
+/* 19410 */ {21,217},
+/* 19411 */ {21,217},
+/* 19412 */ {21,217},
+/* 19413 */ {21,217},
+/* 19414 */ {21,217},
+/* 19415 */ {21,217},
+/* 19416 */ {21,217},
+/* 19417 */ {21,217},
+/* 19418 */ {21,217},
+/* 19419 */ {21,217},
+/* 19420 */ {21,217},
+/* 19421 */ {21,217},
+/* 19422 */ {21,217},
+/* 19423 */ {21,217},
+/* 19424 */ {21,217},
+/* 19425 */ {21,217},
+/* 19426 */ {21,217},
+/* 19427 */ {21,217},
+/* 19428 */ {21,217},
+/* 19429 */ {21,217},
+/* 19430 */ {21,217},
+/* 19431 */ {21,217},
+/* 19432 */ {21,217},
+/* 19433 */ {21,217},
+/* 19434 */ {21,217},
+/* 19435 */ {21,217},
+/* 19436 */ {21,217},
+/* 19437 */ {21,217},
+/* 19438 */ {21,217},
+/* 19439 */ {21,217},
+/* 19440 */ {21,217},
+/* 19441 */ {21,217},
+/* 19442 */ {21,217},
+/* 19443 */ {21,217},
+/* 19444 */ {21,217},
+/* 19445 */ {21,217},
+/* 19446 */ {21,217},
+/* 19447 */ {21,217},
+/* 19448 */ {21,217},
+/* 19449 */ {21,217},
+/* 19450 */ {21,217},
+/* 19451 */ {21,217},
+/* 19452 */ {21,217},
+/* 19453 */ {21,217},
+/* 19454 */ {21,217},
+/* 19455 */ {21,217},
+/* 19456 */ {21,227},
+/* 19457 */ {21,227},
+/* 19458 */ {21,227},
+/* 19459 */ {21,227},
+/* 19460 */ {21,227},
+/* 19461 */ {21,227},
+/* 19462 */ {21,227},
+/* 19463 */ {21,227},
+/* 19464 */ {21,227},
+/* 19465 */ {21,227},
+/* 19466 */ {21,227},
+/* 19467 */ {21,227},
+/* 19468 */ {21,227},
+/* 19469 */ {21,227},
+/* 19470 */ {21,227},
+/* 19471 */ {21,227},
+/* 19472 */ {21,227},
+/* 19473 */ {21,227},
+/* 19474 */ {21,227},
+/* 19475 */ {21,227},
+/* 19476 */ {21,227},
+/* 19477 */ {21,227},
+/* 19478 */ {21,227},
+/* 19479 */ {21,227},
+/* 19480 */ {21,227},
+/* 19481 */ {21,227},
+/* 19482 */ {21,227},
+/* 19483 */ {21,227},
+/* 19484 */ {21,227},
+/* 19485 */ {21,227},
+/* 19486 */ {21,227},
+/* 19487 */ {21,227},
+/* 19488 */ {21,227},
+/* 19489 */ {21,227},
+/* 19490 */ {21,227},
+/* 19491 */ {21,227},
+/* 19492 */ {21,227},
+/* 19493 */ {21,227},
+/* 19494 */ {21,227},
+/* 19495 */ {21,227},
+/* 19496 */ {21,227},
+/* 19497 */ {21,227},
+/* 19498 */ {21,227},
+/* 19499 */ {21,227},
+/* 19500 */ {21,227},
+/* 19501 */ {21,227},
+/* 19502 */ {21,227},
+/* 19503 */ {21,227},
+/* 19504 */ {21,227},
+/* 19505 */ {21,227},
+/* 19506 */ {21,227},
+/* 19507 */ {21,227},
+/* 19508 */ {21,227},
+/* 19509 */ {21,227},
+/* 19510 */ {21,227},
+/* 19511 */ {21,227},
+/* 19512 */ {21,227},
+/* 19513 */ {21,227},
+/* 19514 */ {21,227},
+/* 19515 */ {21,227},
+/* 19516 */ {21,227},
+/* 19517 */ {21,227},
+/* 19518 */ {21,227},
+/* 19519 */ {21,227},
+/* 19520 */ {21,227},
+/* 19521 */ {21,227},
+/* 19522 */ {21,227},
+/* 19523 */ {21,227},
+/* 19524 */ {21,227},
+/* 19525 */ {21,227},
+/* 19526 */ {21,227},
+/* 19527 */ {21,227},
+/* 19528 */ {21,227},
+/* 19529 */ {21,227},
+/* 19530 */ {21,227},
+/* 19531 */ {21,227},
+/* 19532 */ {21,227},
+/* 19533 */ {21,227},
+/* 19534 */ {21,227},
+/* 19535 */ {21,227},
+/* 19536 */ {21,227},
+/* 19537 */ {21,227},
+/* 19538 */ {21,227},
+/* 19539 */ {21,227},
+/* 19540 */ {21,227},
+/* 19541 */ {21,227},
+/* 19542 */ {21,227},
+/* 19543 */ {21,227},
+/* 19544 */ {21,227},
+/* 19545 */ {21,227},
+/* 19546 */ {21,227},
+/* 19547 */ {21,227},
+/* 19548 */ {21,227},
+/* 19549 */ {21,227},
+/* 19550 */ {21,227},
+/* 19551 */ {21,227},
+/* 19552 */ {21,227},
+/* 19553 */ {21,227},
+/* 19554 */ {21,227},
+/* 19555 */ {21,227},
+/* 19556 */ {21,227},
+/* 19557 */ {21,227},
+/* 19558 */ {21,227},
+/* 19559 */ {21,227},
+/* 19560 */ {21,227},
+/* 19561 */ {21,227},
+/* 19562 */ {21,227},
+/* 19563 */ {21,227},
+/* 19564 */ {21,227},
+/* 19565 */ {21,227},
+/* 19566 */ {21,227},
+/* 19567 */ {21,227},
+/* 19568 */ {21,227},
+/* 19569 */ {21,227},
+/* 19570 */ {21,227},
+/* 19571 */ {21,227},
+/* 19572 */ {21,227},
+/* 19573 */ {21,227},
+/* 19574 */ {21,227},
+/* 19575 */ {21,227},
+/* 19576 */ {21,227},
+/* 19577 */ {21,227},
+/* 19578 */ {21,227},
+/* 19579 */ {21,227},
+/* 19580 */ {21,227},
+/* 19581 */ {21,227},
+/* 19582 */ {21,227},
+/* 19583 */ {21,227},
+/* 19584 */ {21,227},
+/* 19585 */ {21,227},
+/* 19586 */ {21,227},
+/* 19587 */ {21,227},
+/* 19588 */ {21,227},
+/* 19589 */ {21,227},
+/* 19590 */ {21,227},
+/* 19591 */ {21,227},
+/* 19592 */ {21,227},
+/* 19593 */ {21,227},
+/* 19594 */ {21,227},
+/* 19595 */ {21,227},
+/* 19596 */ {21,227},
+/* 19597 */ {21,227},
+/* 19598 */ {21,227},
+/* 19599 */ {21,227},
+/* 19600 */ {21,227},
+/* 19601 */ {21,227},
+/* 19602 */ {21,227},
+/* 19603 */ {21,227},
+/* 19604 */ {21,227},
+/* 19605 */ {21,227},
+/* 19606 */ {21,227},
+/* 19607 */ {21,227},
+/* 19608 */ {21,227},
+/* 19609 */ {21,227},
+/* 19610 */ {21,227},
+/* 19611 */ {21,227},
+/* 19612 */ {21,227},
+/* 19613 */ {21,227},
+/* 19614 */ {21,227},
+/* 19615 */ {21,227},
+/* 19616 */ {21,227},
+/* 19617 */ {21,227},
+/* 19618 */ {21,227},
+/* 19619 */ {21,227},
+/* 19620 */ {21,227},
+/* 19621 */ {21,227},
+/* 19622 */ {21,227},
+/* 19623 */ {21,227},
+/* 19624 */ {21,227},
+/* 19625 */ {21,227},
+/* 19626 */ {21,227},
+/* 19627 */ {21,227},
+/* 19628 */ {21,227},
+/* 19629 */ {21,227},
+/* 19630 */ {21,227},
+/* 19631 */ {21,227},
+/* 19632 */ {21,227},
+/* 19633 */ {21,227},
+/* 19634 */ {21,227},
+/* 19635 */ {21,227},
+/* 19636 */ {21,227},
+/* 19637 */ {21,227},
+/* 19638 */ {21,227},
+/* 19639 */ {21,227},
+/* 19640 */ {21,227},
+/* 19641 */ {21,227},
+/* 19642 */ {21,227},
+/* 19643 */ {21,227},
+/* 19644 */ {21,227},
+/* 19645 */ {21,227},
+/* 19646 */ {21,227},
+/* 19647 */ {21,227},
+/* 19648 */ {21,227},
+/* 19649 */ {21,227},
+/* 19650 */ {21,227},
+/* 19651 */ {21,227},
+/* 19652 */ {21,227},
+/* 19653 */ {21,227},
+/* 19654 */ {21,227},
+/* 19655 */ {21,227},
+/* 19656 */ {21,227},
+/* 19657 */ {21,227},
+/* 19658 */ {21,227},
+/* 19659 */ {21,227},
+/* 19660 */ {21,227},
+/* 19661 */ {21,227},
+/* 19662 */ {21,227},
+/* 19663 */ {21,227},
+/* 19664 */ {21,227},
+/* 19665 */ {21,227},
+/* 19666 */ {21,227},
+/* 19667 */ {21,227},
+/* 19668 */ {21,227},
+/* 19669 */ {21,227},
+/* 19670 */ {21,227},
+/* 19671 */ {21,227},
+/* 19672 */ {21,227},
+/* 19673 */ {21,227},
+/* 19674 */ {21,227},
+/* 19675 */ {21,227},
+/* 19676 */ {21,227},
+/* 19677 */ {21,227},
+/* 19678 */ {21,227},
+/* 19679 */ {21,227},
+/* 19680 */ {21,227},
+/* 19681 */ {21,227},
+/* 19682 */ {21,227},
+/* 19683 */ {21,227},
+/* 19684 */ {21,227},
+/* 19685 */ {21,227},
+/* 19686 */ {21,227},
+/* 19687 */ {21,227},
+/* 19688 */ {21,227},
+/* 19689 */ {21,227},
+/* 19690 */ {21,227},
+/* 19691 */ {21,227},
+/* 19692 */ {21,227},
+/* 19693 */ {21,227},
+/* 19694 */ {21,227},
+/* 19695 */ {21,227},
+/* 19696 */ {21,227},
+/* 19697 */ {21,227},
+/* 19698 */ {21,227},
+/* 19699 */ {21,227},
+/* 19700 */ {21,227},
+/* 19701 */ {21,227},
+/* 19702 */ {21,227},
+/* 19703 */ {21,227},
+/* 19704 */ {21,227},
+/* 19705 */ {21,227},
+/* 19706 */ {21,227},
+/* 19707 */ {21,227},
+/* 19708 */ {21,227},
+/* 19709 */ {21,227},
+/* 19710 */ {21,227},
+/* 19711 */ {21,227},
+/* 19712 */ {21,227},
+/* 19713 */ {21,227},
+/* 19714 */ {21,227},
+/* 19715 */ {21,227},
+/* 19716 */ {21,227},
+/* 19717 */ {21,227},
+/* 19718 */ {21,227},
+/* 19719 */ {21,227},
+/* 19720 */ {21,227},
+/* 19721 */ {21,227},
+/* 19722 */ {21,227},
+/* 19723 */ {21,227},
+/* 19724 */ {21,227},
+/* 19725 */ {21,227},
+/* 19726 */ {21,227},
+/* 19727 */ {21,227},
+/* 19728 */ {21,227},
+/* 19729 */ {21,227},
+/* 19730 */ {21,227},
+/* 19731 */ {21,227},
+/* 19732 */ {21,227},
+/* 19733 */ {21,227},
+/* 19734 */ {21,227},
+/* 19735 */ {21,227},
+/* 19736 */ {21,227},
+/* 19737 */ {21,227},
+/* 19738 */ {21,227},
+/* 19739 */ {21,227},
+/* 19740 */ {21,227},
+/* 19741 */ {21,227},
+/* 19742 */ {21,227},
+/* 19743 */ {21,227},
+/* 19744 */ {21,227},
+/* 19745 */ {21,227},
+/* 19746 */ {21,227},
+/* 19747 */ {21,227},
+/* 19748 */ {21,227},
+/* 19749 */ {21,227},
+/* 19750 */ {21,227},
+/* 19751 */ {21,227},
+/* 19752 */ {21,227},
+/* 19753 */ {21,227},
+/* 19754 */ {21,227},
+/* 19755 */ {21,227},
+/* 19756 */ {21,227},
+/* 19757 */ {21,227},
+/* 19758 */ {21,227},
+/* 19759 */ {21,227},
+/* 19760 */ {21,227},
+/* 19761 */ {21,227},
+/* 19762 */ {21,227},
+/* 19763 */ {21,227},
+/* 19764 */ {21,227},
+/* 19765 */ {21,227},
+/* 19766 */ {21,227},
+/* 19767 */ {21,227},
+/* 19768 */ {21,227},
+/* 19769 */ {21,227},
+/* 19770 */ {21,227},
+/* 19771 */ {21,227},
+/* 19772 */ {21,227},
+/* 19773 */ {21,227},
+/* 19774 */ {21,227},
+/* 19775 */ {21,227},
+/* 19776 */ {21,227},
+/* 19777 */ {21,227},
+/* 19778 */ {21,227},
+/* 19779 */ {21,227},
+/* 19780 */ {21,227},
+/* 19781 */ {21,227},
+/* 19782 */ {21,227},
+/* 19783 */ {21,227},
+/* 19784 */ {21,227},
+/* 19785 */ {21,227},
+/* 19786 */ {21,227},
+/* 19787 */ {21,227},
+/* 19788 */ {21,227},
+/* 19789 */ {21,227},
+/* 19790 */ {21,227},
+/* 19791 */ {21,227},
+/* 19792 */ {21,227},
+/* 19793 */ {21,227},
+/* 19794 */ {21,227},
+/* 19795 */ {21,227},
+/* 19796 */ {21,227},
+/* 19797 */ {21,227},
+/* 19798 */ {21,227},
+/* 19799 */ {21,227},
+/* 19800 */ {21,227},
+/* 19801 */ {21,227},
+/* 19802 */ {21,227},
+/* 19803 */ {21,227},
+/* 19804 */ {21,227},
+/* 19805 */ {21,227},
+/* 19806 */ {21,227},
+/* 19807 */ {21,227},
+/* 19808 */ {21,227},
+/* 19809 */ {21,227},
+/* 19810 */ {21,227},
+/* 19811 */ {21,227},
+/* 19812 */ {21,227},
+/* 19813 */ {21,227},
+/* 19814 */ {21,227},
+/* 19815 */ {21,227},
+/* 19816 */ {21,227},
+/* 19817 */ {21,227},
+/* 19818 */ {21,227},
+/* 19819 */ {21,227},
+/* 19820 */ {21,227},
+/* 19821 */ {21,227},
+/* 19822 */ {21,227},
+/* 19823 */ {21,227},
+/* 19824 */ {21,227},
+/* 19825 */ {21,227},
+/* 19826 */ {21,227},
+/* 19827 */ {21,227},
+/* 19828 */ {21,227},
+/* 19829 */ {21,227},
+/* 19830 */ {21,227},
+/* 19831 */ {21,227},
+/* 19832 */ {21,227},
+/* 19833 */ {21,227},
+/* 19834 */ {21,227},
+/* 19835 */ {21,227},
+/* 19836 */ {21,227},
+/* 19837 */ {21,227},
+/* 19838 */ {21,227},
+/* 19839 */ {21,227},
+/* 19840 */ {21,227},
+/* 19841 */ {21,227},
+/* 19842 */ {21,227},
+/* 19843 */ {21,227},
+/* 19844 */ {21,227},
+/* 19845 */ {21,227},
+/* 19846 */ {21,227},
+/* 19847 */ {21,227},
+/* 19848 */ {21,227},
+/* 19849 */ {21,227},
+/* 19850 */ {21,227},
+/* 19851 */ {21,227},
+/* 19852 */ {21,227},
+/* 19853 */ {21,227},
+/* 19854 */ {21,227},
+/* 19855 */ {21,227},
+/* 19856 */ {21,227},
+/* 19857 */ {21,227},
+/* 19858 */ {21,227},
+/* 19859 */ {21,227},
+/* 19860 */ {21,227},
+/* 19861 */ {21,227},
+/* 19862 */ {21,227},
+/* 19863 */ {21,227},
+/* 19864 */ {21,227},
+/* 19865 */ {21,227},
+/* 19866 */ {21,227},
+/* 19867 */ {21,227},
+/* 19868 */ {21,227},
+/* 19869 */ {21,227},
+/* 19870 */ {21,227},
+/* 19871 */ {21,227},
+/* 19872 */ {21,227},
+/* 19873 */ {21,227},
+/* 19874 */ {21,227},
+/* 19875 */ {21,227},
+/* 19876 */ {21,227},
+/* 19877 */ {21,227},
+/* 19878 */ {21,227},
+/* 19879 */ {21,227},
+/* 19880 */ {21,227},
+/* 19881 */ {21,227},
+/* 19882 */ {21,227},
+/* 19883 */ {21,227},
+/* 19884 */ {21,227},
+/* 19885 */ {21,227},
+/* 19886 */ {21,227},
+/* 19887 */ {21,227},
+/* 19888 */ {21,227},
+/* 19889 */ {21,227},
+/* 19890 */ {21,227},
+/* 19891 */ {21,227},
+/* 19892 */ {21,227},
+/* 19893 */ {21,227},
+/* 19894 */ {21,227},
+/* 19895 */ {21,227},
+/* 19896 */ {21,227},
+/* 19897 */ {21,227},
+/* 19898 */ {21,227},
+/* 19899 */ {21,227},
+/* 19900 */ {21,227},
+/* 19901 */ {21,227},
+/* 19902 */ {21,227},
+/* 19903 */ {21,227},
+/* 19904 */ {21,227},
+/* 19905 */ {21,227},
+/* 19906 */ {21,227},
+/* 19907 */ {21,227},
+/* 19908 */ {21,227},
+/* 19909 */ {21,227},
+/* 19910 */ {21,227},
+/* 19911 */ {21,227},
+/* 19912 */ {21,227},
+/* 19913 */ {21,227},
+/* 19914 */ {21,227},
+/* 19915 */ {21,227},
+/* 19916 */ {21,227},
+/* 19917 */ {21,227},
+/* 19918 */ {21,227},
+/* 19919 */ {21,227},
+/* 19920 */ {21,227},
+/* 19921 */ {21,227},
+/* 19922 */ {21,227},
+/* 19923 */ {21,227},
+/* 19924 */ {21,227},
+/* 19925 */ {21,227},
+/* 19926 */ {21,227},
+/* 19927 */ {21,227},
+/* 19928 */ {21,227},
+/* 19929 */ {21,227},
+/* 19930 */ {21,227},
+/* 19931 */ {21,227},
+/* 19932 */ {21,227},
+/* 19933 */ {21,227},
+/* 19934 */ {21,227},
+/* 19935 */ {21,227},
+/* 19936 */ {21,227},
+/* 19937 */ {21,227},
+/* 19938 */ {21,227},
+/* 19939 */ {21,227},
+/* 19940 */ {21,227},
+/* 19941 */ {21,227},
+/* 19942 */ {21,227},
+/* 19943 */ {21,227},
+/* 19944 */ {21,227},
+/* 19945 */ {21,227},
+/* 19946 */ {21,227},
+/* 19947 */ {21,227},
+/* 19948 */ {21,227},
+/* 19949 */ {21,227},
+/* 19950 */ {21,227},
+/* 19951 */ {21,227},
+/* 19952 */ {21,227},
+/* 19953 */ {21,227},
+/* 19954 */ {21,227},
+/* 19955 */ {21,227},
+/* 19956 */ {21,227},
+/* 19957 */ {21,227},
+/* 19958 */ {21,227},
+/* 19959 */ {21,227},
+/* 19960 */ {21,227},
+/* 19961 */ {21,227},
+/* 19962 */ {21,227},
+/* 19963 */ {21,227},
+/* 19964 */ {21,227},
+/* 19965 */ {21,227},
+/* 19966 */ {21,227},
+/* 19967 */ {21,227},
+/* 19968 */ {21,229},
+/* 19969 */ {21,229},
+/* 19970 */ {21,229},
+/* 19971 */ {21,229},
+/* 19972 */ {21,229},
+/* 19973 */ {21,229},
+/* 19974 */ {21,229},
+/* 19975 */ {21,229},
+/* 19976 */ {21,229},
+/* 19977 */ {21,229},
+/* 19978 */ {21,229},
+/* 19979 */ {21,229},
+/* 19980 */ {21,229},
+/* 19981 */ {21,229},
+/* 19982 */ {21,229},
+/* 19983 */ {21,229},
+/* 19984 */ {21,229},
+/* 19985 */ {21,229},
+/* 19986 */ {21,229},
+/* 19987 */ {21,229},
+/* 19988 */ {21,229},
+/* 19989 */ {21,229},
+/* 19990 */ {21,229},
+/* 19991 */ {21,229},
+/* 19992 */ {21,229},
+/* 19993 */ {21,229},
+/* 19994 */ {21,229},
+/* 19995 */ {21,229},
+/* 19996 */ {21,229},
+/* 19997 */ {21,229},
+/* 19998 */ {21,229},
+/* 19999 */ {21,229},
+/* 20000 */ {21,229},
+/* 20001 */ {21,229},
+/* 20002 */ {21,229},
+/* 20003 */ {21,229},
+/* 20004 */ {21,229},
+/* 20005 */ {21,229},
+/* 20006 */ {21,229},
+/* 20007 */ {21,229},
+/* 20008 */ {21,229},
+/* 20009 */ {21,229},
+/* 20010 */ {21,229},
+/* 20011 */ {21,229},
+/* 20012 */ {21,229},
+/* 20013 */ {21,229},
+/* 20014 */ {21,229},
+/* 20015 */ {21,229},
+/* 20016 */ {21,229},
+/* 20017 */ {21,229},
+/* 20018 */ {21,229},
+/* 20019 */ {21,229},
+/* 20020 */ {21,229},
+/* 20021 */ {21,229},
+/* 20022 */ {21,229},
+/* 20023 */ {21,229},
+/* 20024 */ {21,229},
+/* 20025 */ {21,229},
+/* 20026 */ {21,229},
+/* 20027 */ {21,229},
+/* 20028 */ {21,229},
+/* 20029 */ {21,229},
+/* 20030 */ {21,229},
+/* 20031 */ {21,229},
+/* 20032 */ {21,229},
+/* 20033 */ {21,229},
+/* 20034 */ {21,229},
+/* 20035 */ {21,229},
+/* 20036 */ {21,229},
+/* 20037 */ {21,229},
+/* 20038 */ {21,229},
+/* 20039 */ {21,229},
+/* 20040 */ {21,229},
+/* 20041 */ {21,229},
+/* 20042 */ {21,229},
+/* 20043 */ {21,229},
+/* 20044 */ {21,229},
+/* 20045 */ {21,229},
+/* 20046 */ {21,229},
+/* 20047 */ {21,229},
+/* 20048 */ {21,229},
+/* 20049 */ {21,229},
+/* 20050 */ {21,229},
+/* 20051 */ {21,229},
+/* 20052 */ {21,229},
+/* 20053 */ {21,229},
+/* 20054 */ {21,229},
+/* 20055 */ {21,229},
+/* 20056 */ {21,229},
+/* 20057 */ {21,229},
+/* 20058 */ {21,229},
+/* 20059 */ {21,229},
+/* 20060 */ {21,229},
+/* 20061 */ {21,229},
+/* 20062 */ {21,229},
+/* 20063 */ {21,229},
+/* 20064 */ {21,229},
+/* 20065 */ {21,229},
+/* 20066 */ {21,229},
+/* 20067 */ {21,229},
+/* 20068 */ {21,229},
+/* 20069 */ {21,229},
+/* 20070 */ {21,229},
+/* 20071 */ {21,229},
+/* 20072 */ {21,229},
+/* 20073 */ {21,229},
+/* 20074 */ {21,229},
+/* 20075 */ {21,229},
+/* 20076 */ {21,229},
+/* 20077 */ {21,229},
+/* 20078 */ {21,229},
+/* 20079 */ {21,229},
+/* 20080 */ {21,229},
+/* 20081 */ {21,229},
+/* 20082 */ {21,229},
+/* 20083 */ {21,229},
+/* 20084 */ {21,229},
+/* 20085 */ {21,229},
+/* 20086 */ {21,229},
+/* 20087 */ {21,229},
+/* 20088 */ {21,229},
+/* 20089 */ {21,229},
+/* 20090 */ {21,229},
+/* 20091 */ {21,229},
+/* 20092 */ {21,229},
+/* 20093 */ {21,229},
+/* 20094 */ {21,229},
+/* 20095 */ {21,229},
+/* 20096 */ {21,229},
+/* 20097 */ {21,229},
+/* 20098 */ {21,229},
+/* 20099 */ {21,229},
+/* 20100 */ {21,229},
+/* 20101 */ {21,229},
+/* 20102 */ {21,229},
+/* 20103 */ {21,229},
+/* 20104 */ {21,229},
+/* 20105 */ {21,229},
+/* 20106 */ {21,229},
+/* 20107 */ {21,229},
+/* 20108 */ {21,229},
+/* 20109 */ {21,229},
+/* 20110 */ {21,229},
+/* 20111 */ {21,229},
+/* 20112 */ {21,229},
+/* 20113 */ {21,229},
+/* 20114 */ {21,229},
+/* 20115 */ {21,229},
+/* 20116 */ {21,229},
+/* 20117 */ {21,229},
+/* 20118 */ {21,229},
+/* 20119 */ {21,229},
+/* 20120 */ {21,229},
+/* 20121 */ {21,229},
+/* 20122 */ {21,229},
+/* 20123 */ {21,229},
+/* 20124 */ {21,229},
+/* 20125 */ {21,229},
+/* 20126 */ {21,229},
+/* 20127 */ {21,229},
+/* 20128 */ {21,229},
+/* 20129 */ {21,229},
+/* 20130 */ {21,229},
+/* 20131 */ {21,229},
+/* 20132 */ {21,229},
+/* 20133 */ {21,229},
+/* 20134 */ {21,229},
+/* 20135 */ {21,229},
+/* 20136 */ {21,229},
+/* 20137 */ {21,229},
+/* 20138 */ {21,229},
+/* 20139 */ {21,229},
+/* 20140 */ {21,229},
+/* 20141 */ {21,229},
+/* 20142 */ {21,229},
+/* 20143 */ {21,229},
+/* 20144 */ {21,229},
+/* 20145 */ {21,229},
+/* 20146 */ {21,229},
+/* 20147 */ {21,229},
+/* 20148 */ {21,229},
+/* 20149 */ {21,229},
+/* 20150 */ {21,229},
+/* 20151 */ {21,229},
+/* 20152 */ {21,229},
+/* 20153 */ {21,229},
+/* 20154 */ {21,229},
+/* 20155 */ {21,229},
+/* 20156 */ {21,229},
+/* 20157 */ {21,229},
+/* 20158 */ {21,229},
+/* 20159 */ {21,229},
+/* 20160 */ {21,229},
+/* 20161 */ {21,229},
+/* 20162 */ {21,229},
+/* 20163 */ {21,229},
+/* 20164 */ {21,229},
+/* 20165 */ {21,229},
+/* 20166 */ {21,229},
+/* 20167 */ {21,229},
+/* 20168 */ {21,229},
+/* 20169 */ {21,229},
+/* 20170 */ {21,229},
+/* 20171 */ {21,229},
+/* 20172 */ {21,229},
+/* 20173 */ {21,229},
+/* 20174 */ {21,229},
+/* 20175 */ {21,229},
+/* 20176 */ {21,229},
+/* 20177 */ {21,229},
+/* 20178 */ {21,229},
+/* 20179 */ {21,229},
+/* 20180 */ {21,229},
+/* 20181 */ {21,229},
+/* 20182 */ {21,229},
+/* 20183 */ {21,229},
+/* 20184 */ {21,229},
+/* 20185 */ {21,229},
+/* 20186 */ {21,229},
+/* 20187 */ {21,229},
+/* 20188 */ {21,229},
+/* 20189 */ {21,229},
+/* 20190 */ {21,229},
+/* 20191 */ {21,229},
+/* 20192 */ {21,229},
+/* 20193 */ {21,229},
+/* 20194 */ {21,229},
+/* 20195 */ {21,229},
+/* 20196 */ {21,229},
+/* 20197 */ {21,229},
+/* 20198 */ {21,229},
+/* 20199 */ {21,229},
+/* 20200 */ {21,229},
+/* 20201 */ {21,229},
+/* 20202 */ {21,229},
+/* 20203 */ {21,229},
+/* 20204 */ {21,229},
+/* 20205 */ {21,229},
+/* 20206 */ {21,229},
+/* 20207 */ {21,229},
+/* 20208 */ {21,229},
+/* 20209 */ {21,229},
+/* 20210 */ {21,229},
+/* 20211 */ {21,229},
+/* 20212 */ {21,229},
+/* 20213 */ {21,229},
+/* 20214 */ {21,229},
+/* 20215 */ {21,229},
+/* 20216 */ {21,229},
+/* 20217 */ {21,229},
+/* 20218 */ {21,229},
+/* 20219 */ {21,229},
+/* 20220 */ {21,229},
+/* 20221 */ {21,229},
+/* 20222 */ {21,229},
+/* 20223 */ {21,229},
+/* 20224 */ {21,229},
+/* 20225 */ {21,229},
+/* 20226 */ {21,229},
+/* 20227 */ {21,229},
+/* 20228 */ {21,229},
+/* 20229 */ {21,229},
+/* 20230 */ {21,229},
+/* 20231 */ {21,229},
+/* 20232 */ {21,229},
+/* 20233 */ {21,229},
+/* 20234 */ {21,229},
+/* 20235 */ {21,229},
+/* 20236 */ {21,229},
+/* 20237 */ {21,229},
+/* 20238 */ {21,229},
+/* 20239 */ {21,229},
+/* 20240 */ {21,229},
+/* 20241 */ {21,229},
+/* 20242 */ {21,229},
+/* 20243 */ {21,229},
+/* 20244 */ {21,229},
+/* 20245 */ {21,229},
+/* 20246 */ {21,229},
+/* 20247 */ {21,229},
+/* 20248 */ {21,229},
+/* 20249 */ {21,229},
+/* 20250 */ {21,229},
+/* 20251 */ {21,229},
+/* 20252 */ {21,229},
+/* 20253 */ {21,229},
+/* 20254 */ {21,229},
+/* 20255 */ {21,229},
+/* 20256 */ {21,229},
+/* 20257 */ {21,229},
+/* 20258 */ {21,229},
+/* 20259 */ {21,229},
+/* 20260 */ {21,229},
+/* 20261 */ {21,229},
+/* 20262 */ {21,229},
+/* 20263 */ {21,229},
+/* 20264 */ {21,229},
+/* 20265 */ {21,229},
+/* 20266 */ {21,229},
+/* 20267 */ {21,229},
+/* 20268 */ {21,229},
+/* 20269 */ {21,229},
+/* 20270 */ {21,229},
+/* 20271 */ {21,229},
+/* 20272 */ {21,229},
+/* 20273 */ {21,229},
+/* 20274 */ {21,229},
+/* 20275 */ {21,229},
+/* 20276 */ {21,229},
+/* 20277 */ {21,229},
+/* 20278 */ {21,229},
+/* 20279 */ {21,229},
+/* 20280 */ {21,229},
+/* 20281 */ {21,229},
+/* 20282 */ {21,229},
+/* 20283 */ {21,229},
+/* 20284 */ {21,229},
+/* 20285 */ {21,229},
+/* 20286 */ {21,229},
+/* 20287 */ {21,229},
+/* 20288 */ {21,229},
+/* 20289 */ {21,229},
+/* 20290 */ {21,229},
+/* 20291 */ {21,229},
+/* 20292 */ {21,229},
+/* 20293 */ {21,229},
+/* 20294 */ {21,229},
+/* 20295 */ {21,229},
+/* 20296 */ {21,229},
+/* 20297 */ {21,229},
+/* 20298 */ {21,229},
+/* 20299 */ {21,229},
+/* 20300 */ {21,229},
+/* 20301 */ {21,229},
+/* 20302 */ {21,229},
+/* 20303 */ {21,229},
+/* 20304 */ {21,229},
+/* 20305 */ {21,229},
+/* 20306 */ {21,229},
+/* 20307 */ {21,229},
+/* 20308 */ {21,229},
+/* 20309 */ {21,229},
+/* 20310 */ {21,229},
+/* 20311 */ {21,229},
+/* 20312 */ {21,229},
+/* 20313 */ {21,229},
+/* 20314 */ {21,229},
+/* 20315 */ {21,229},
+/* 20316 */ {21,229},
+/* 20317 */ {21,229},
+/* 20318 */ {21,229},
+/* 20319 */ {21,229},
+/* 20320 */ {21,229},
+/* 20321 */ {21,229},
+/* 20322 */ {21,229},
+/* 20323 */ {21,229},
+/* 20324 */ {21,229},
+/* 20325 */ {21,229},
+/* 20326 */ {21,229},
+/* 20327 */ {21,229},
+/* 20328 */ {21,229},
+/* 20329 */ {21,229},
+/* 20330 */ {21,229},
+/* 20331 */ {21,229},
+/* 20332 */ {21,229},
+/* 20333 */ {21,229},
+/* 20334 */ {21,229},
+/* 20335 */ {21,229},
+/* 20336 */ {21,229},
+/* 20337 */ {21,229},
+/* 20338 */ {21,229},
+/* 20339 */ {21,229},
+/* 20340 */ {21,229},
+/* 20341 */ {21,229},
+/* 20342 */ {21,229},
+/* 20343 */ {21,229},
+/* 20344 */ {21,229},
+/* 20345 */ {21,229},
+/* 20346 */ {21,229},
+/* 20347 */ {21,229},
+/* 20348 */ {21,229},
+/* 20349 */ {21,229},
+/* 20350 */ {21,229},
+/* 20351 */ {21,229},
+/* 20352 */ {21,229},
+/* 20353 */ {21,229},
+/* 20354 */ {21,229},
+/* 20355 */ {21,229},
+/* 20356 */ {21,229},
+/* 20357 */ {21,229},
+/* 20358 */ {21,229},
+/* 20359 */ {21,229},
+/* 20360 */ {21,229},
+/* 20361 */ {21,229},
+/* 20362 */ {21,229},
+/* 20363 */ {21,229},
+/* 20364 */ {21,229},
+/* 20365 */ {21,229},
+/* 20366 */ {21,229},
+/* 20367 */ {21,229},
+/* 20368 */ {21,229},
+/* 20369 */ {21,229},
+/* 20370 */ {21,229},
+/* 20371 */ {21,229},
+/* 20372 */ {21,229},
+/* 20373 */ {21,229},
+/* 20374 */ {21,229},
+/* 20375 */ {21,229},
+/* 20376 */ {21,229},
+/* 20377 */ {21,229},
+/* 20378 */ {21,229},
+/* 20379 */ {21,229},
+/* 20380 */ {21,229},
+/* 20381 */ {21,229},
+/* 20382 */ {21,229},
+/* 20383 */ {21,229},
+/* 20384 */ {21,229},
+/* 20385 */ {21,229},
+/* 20386 */ {21,229},
+/* 20387 */ {21,229},
+/* 20388 */ {21,229},
+/* 20389 */ {21,229},
+/* 20390 */ {21,229},
+/* 20391 */ {21,229},
+/* 20392 */ {21,229},
+/* 20393 */ {21,229},
+/* 20394 */ {21,229},
+/* 20395 */ {21,229},
+/* 20396 */ {21,229},
+/* 20397 */ {21,229},
+/* 20398 */ {21,229},
+/* 20399 */ {21,229},
+/* 20400 */ {21,229},
+/* 20401 */ {21,229},
+/* 20402 */ {21,229},
+/* 20403 */ {21,229},
+/* 20404 */ {21,229},
+/* 20405 */ {21,229},
+/* 20406 */ {21,229},
+/* 20407 */ {21,229},
+/* 20408 */ {21,229},
+/* 20409 */ {21,229},
+/* 20410 */ {21,229},
+/* 20411 */ {21,229},
+/* 20412 */ {21,229},
+/* 20413 */ {21,229},
+/* 20414 */ {21,229},
+/* 20415 */ {21,229},
+/* 20416 */ {21,229},
+/* 20417 */ {21,229},
+/* 20418 */ {21,229},
+/* 20419 */ {21,229},
+/* 20420 */ {21,229},
+/* 20421 */ {21,229},
+/* 20422 */ {21,229},
+/* 20423 */ {21,229},
+/* 20424 */ {21,229},
+/* 20425 */ {21,229},
+/* 20426 */ {21,229},
+/* 20427 */ {21,229},
+/* 20428 */ {21,229},
+/* 20429 */ {21,229},
+/* 20430 */ {21,229},
+/* 20431 */ {21,229},
+/* 20432 */ {21,229},
+/* 20433 */ {21,229},
+/* 20434 */ {21,229},
+/* 20435 */ {21,229},
+/* 20436 */ {21,229},
+/* 20437 */ {21,229},
+/* 20438 */ {21,229},
+/* 20439 */ {21,229},
+/* 20440 */ {21,229},
+/* 20441 */ {21,229},
+/* 20442 */ {21,229},
+/* 20443 */ {21,229},
+/* 20444 */ {21,229},
+/* 20445 */ {21,229},
+/* 20446 */ {21,229},
+/* 20447 */ {21,229},
+/* 20448 */ {21,229},
+/* 20449 */ {21,229},
+/* 20450 */ {21,229},
+/* 20451 */ {21,229},
+/* 20452 */ {21,229},
+/* 20453 */ {21,229},
+/* 20454 */ {21,229},
+/* 20455 */ {21,229},
+/* 20456 */ {21,229},
+/* 20457 */ {21,229},
+/* 20458 */ {21,229},
+/* 20459 */ {21,229},
+/* 20460 */ {21,229},
+/* 20461 */ {21,229},
+/* 20462 */ {21,229},
+/* 20463 */ {21,229},
+/* 20464 */ {21,229},
+/* 20465 */ {21,229},
+/* 20466 */ {21,229},
+/* 20467 */ {21,229},
+/* 20468 */ {21,229},
+/* 20469 */ {21,229},
+/* 20470 */ {21,229},
+/* 20471 */ {21,229},
+/* 20472 */ {21,229},
+/* 20473 */ {21,229},
+/* 20474 */ {21,229},
+/* 20475 */ {21,229},
+/* 20476 */ {21,229},
+/* 20477 */ {21,229},
+/* 20478 */ {21,229},
+/* 20479 */ {21,229},
+/* 20480 */ {21,230},
+/* 20481 */ {21,230},
+/* 20482 */ {21,230},
+/* 20483 */ {21,230},
+/* 20484 */ {21,230},
+/* 20485 */ {21,230},
+/* 20486 */ {21,230},
+/* 20487 */ {21,230},
+/* 20488 */ {21,230},
+/* 20489 */ {21,230},
+/* 20490 */ {21,230},
+/* 20491 */ {21,230},
+/* 20492 */ {21,230},
+/* 20493 */ {21,230},
+/* 20494 */ {21,230},
+/* 20495 */ {21,230},
+/* 20496 */ {21,230},
+/* 20497 */ {21,230},
+/* 20498 */ {21,230},
+/* 20499 */ {21,230},
+/* 20500 */ {21,230},
+/* 20501 */ {21,230},
+/* 20502 */ {21,230},
+/* 20503 */ {21,230},
+/* 20504 */ {21,230},
+/* 20505 */ {21,230},
+/* 20506 */ {21,230},
+/* 20507 */ {21,230},
+/* 20508 */ {21,230},
+/* 20509 */ {21,230},
+/* 20510 */ {21,230},
+/* 20511 */ {21,230},
+/* 20512 */ {21,230},
+/* 20513 */ {21,230},
+/* 20514 */ {21,230},
+/* 20515 */ {21,230},
+/* 20516 */ {21,230},
+/* 20517 */ {21,230},
+/* 20518 */ {21,230},
+/* 20519 */ {21,230},
+/* 20520 */ {21,230},
+/* 20521 */ {21,230},
+/* 20522 */ {21,230},
+/* 20523 */ {21,230},
+/* 20524 */ {21,230},
+/* 20525 */ {21,230},
+/* 20526 */ {21,230},
+/* 20527 */ {21,230},
+/* 20528 */ {21,230},
+/* 20529 */ {21,230},
+/* 20530 */ {21,230},
+/* 20531 */ {21,230},
+/* 20532 */ {21,230},
+/* 20533 */ {21,230},
+/* 20534 */ {21,230},
+/* 20535 */ {21,230},
+/* 20536 */ {21,230},
+/* 20537 */ {21,230},
+/* 20538 */ {21,230},
+/* 20539 */ {21,230},
+/* 20540 */ {21,230},
+/* 20541 */ {21,230},
+/* 20542 */ {21,230},
+/* 20543 */ {21,230},
+/* 20544 */ {21,230},
+/* 20545 */ {21,230},
+/* 20546 */ {21,230},
+/* 20547 */ {21,230},
+/* 20548 */ {21,230},
+/* 20549 */ {21,230},
+/* 20550 */ {21,230},
+/* 20551 */ {21,230},
+/* 20552 */ {21,230},
+/* 20553 */ {21,230},
+/* 20554 */ {21,230},
+/* 20555 */ {21,230},
+/* 20556 */ {21,230},
+/* 20557 */ {21,230},
+/* 20558 */ {21,230},
+/* 20559 */ {21,230},
+/* 20560 */ {21,230},
+/* 20561 */ {21,230},
+/* 20562 */ {21,230},
+/* 20563 */ {21,230},
+/* 20564 */ {21,230},
+/* 20565 */ {21,230},
+/* 20566 */ {21,230},
+/* 20567 */ {21,230},
+/* 20568 */ {21,230},
+/* 20569 */ {21,230},
+/* 20570 */ {21,230},
+/* 20571 */ {21,230},
+/* 20572 */ {21,230},
+/* 20573 */ {21,230},
+/* 20574 */ {21,230},
+/* 20575 */ {21,230},
+/* 20576 */ {21,230},
+/* 20577 */ {21,230},
+/* 20578 */ {21,230},
+/* 20579 */ {21,230},
+/* 20580 */ {21,230},
+/* 20581 */ {21,230},
+/* 20582 */ {21,230},
+/* 20583 */ {21,230},
+/* 20584 */ {21,230},
+/* 20585 */ {21,230},
+/* 20586 */ {21,230},
+/* 20587 */ {21,230},
+/* 20588 */ {21,230},
+/* 20589 */ {21,230},
+/* 20590 */ {21,230},
+/* 20591 */ {21,230},
+/* 20592 */ {21,230},
+/* 20593 */ {21,230},
+/* 20594 */ {21,230},
+/* 20595 */ {21,230},
+/* 20596 */ {21,230},
+/* 20597 */ {21,230},
+/* 20598 */ {21,230},
+/* 20599 */ {21,230},
+/* 20600 */ {21,230},
+/* 20601 */ {21,230},
+/* 20602 */ {21,230},
+/* 20603 */ {21,230},
+/* 20604 */ {21,230},
+/* 20605 */ {21,230},
+/* 20606 */ {21,230},
+/* 20607 */ {21,230},
+/* 20608 */ {21,230},
+/* 20609 */ {21,230},
+/* 20610 */ {21,230},
+/* 20611 */ {21,230},
+/* 20612 */ {21,230},
+/* 20613 */ {21,230},
+/* 20614 */ {21,230},
+/* 20615 */ {21,230},
+/* 20616 */ {21,230},
+/* 20617 */ {21,230},
+/* 20618 */ {21,230},
+/* 20619 */ {21,230},
+/* 20620 */ {21,230},
+/* 20621 */ {21,230},
+/* 20622 */ {21,230},
+/* 20623 */ {21,230},
+/* 20624 */ {21,230},
+/* 20625 */ {21,230},
+/* 20626 */ {21,230},
+/* 20627 */ {21,230},
+/* 20628 */ {21,230},
+/* 20629 */ {21,230},
+/* 20630 */ {21,230},
+/* 20631 */ {21,230},
+/* 20632 */ {21,230},
+/* 20633 */ {21,230},
+/* 20634 */ {21,230},
+/* 20635 */ {21,230},
+/* 20636 */ {21,230},
+/* 20637 */ {21,230},
+/* 20638 */ {21,230},
+/* 20639 */ {21,230},
+/* 20640 */ {21,230},
+/* 20641 */ {21,230},
+/* 20642 */ {21,230},
+/* 20643 */ {21,230},
+/* 20644 */ {21,230},
+/* 20645 */ {21,230},
+/* 20646 */ {21,230},
+/* 20647 */ {21,230},
+/* 20648 */ {21,230},
+/* 20649 */ {21,230},
+/* 20650 */ {21,230},
+/* 20651 */ {21,230},
+/* 20652 */ {21,230},
+/* 20653 */ {21,230},
+/* 20654 */ {21,230},
+/* 20655 */ {21,230},
+/* 20656 */ {21,230},
+/* 20657 */ {21,230},
+/* 20658 */ {21,230},
+/* 20659 */ {21,230},
+/* 20660 */ {21,230},
+/* 20661 */ {21,230},
+/* 20662 */ {21,230},
+/* 20663 */ {21,230},
+/* 20664 */ {21,230},
+/* 20665 */ {21,230},
+/* 20666 */ {21,230},
+/* 20667 */ {21,230},
+/* 20668 */ {21,230},
+/* 20669 */ {21,230},
+/* 20670 */ {21,230},
+/* 20671 */ {21,230},
+/* 20672 */ {21,230},
+/* 20673 */ {21,230},
+/* 20674 */ {21,230},
+/* 20675 */ {21,230},
+/* 20676 */ {21,230},
+/* 20677 */ {21,230},
+/* 20678 */ {21,230},
+/* 20679 */ {21,230},
+/* 20680 */ {21,230},
+/* 20681 */ {21,230},
+/* 20682 */ {21,230},
+/* 20683 */ {21,230},
+/* 20684 */ {21,230},
+/* 20685 */ {21,230},
+/* 20686 */ {21,230},
+/* 20687 */ {21,230},
+/* 20688 */ {21,230},
+/* 20689 */ {21,230},
+/* 20690 */ {21,230},
+/* 20691 */ {21,230},
+/* 20692 */ {21,230},
+/* 20693 */ {21,230},
+/* 20694 */ {21,230},
+/* 20695 */ {21,230},
+/* 20696 */ {21,230},
+/* 20697 */ {21,230},
+/* 20698 */ {21,230},
+/* 20699 */ {21,230},
+/* 20700 */ {21,230},
+/* 20701 */ {21,230},
+/* 20702 */ {21,230},
+/* 20703 */ {21,230},
+/* 20704 */ {21,230},
+/* 20705 */ {21,230},
+/* 20706 */ {21,230},
+/* 20707 */ {21,230},
+/* 20708 */ {21,230},
+/* 20709 */ {21,230},
+/* 20710 */ {21,230},
+/* 20711 */ {21,230},
+/* 20712 */ {21,230},
+/* 20713 */ {21,230},
+/* 20714 */ {21,230},
+/* 20715 */ {21,230},
+/* 20716 */ {21,230},
+/* 20717 */ {21,230},
+/* 20718 */ {21,230},
+/* 20719 */ {21,230},
+/* 20720 */ {21,230},
+/* 20721 */ {21,230},
+/* 20722 */ {21,230},
+/* 20723 */ {21,230},
+/* 20724 */ {21,230},
+/* 20725 */ {21,230},
+/* 20726 */ {21,230},
+/* 20727 */ {21,230},
+/* 20728 */ {21,230},
+/* 20729 */ {21,230},
+/* 20730 */ {21,230},
+/* 20731 */ {21,230},
+/* 20732 */ {21,230},
+/* 20733 */ {21,230},
+/* 20734 */ {21,230},
+/* 20735 */ {21,230},
+/* 20736 */ {21,230},
+/* 20737 */ {21,230},
+/* 20738 */ {21,230},
+/* 20739 */ {21,230},
+/* 20740 */ {21,230},
+/* 20741 */ {21,230},
+/* 20742 */ {21,230},
+/* 20743 */ {21,230},
+/* 20744 */ {21,230},
+/* 20745 */ {21,230},
+/* 20746 */ {21,230},
+/* 20747 */ {21,230},
+/* 20748 */ {21,230},
+/* 20749 */ {21,230},
+/* 20750 */ {21,230},
+/* 20751 */ {21,230},
+/* 20752 */ {21,230},
+/* 20753 */ {21,230},
+/* 20754 */ {21,230},
+/* 20755 */ {21,230},
+/* 20756 */ {21,230},
+/* 20757 */ {21,230},
+/* 20758 */ {21,230},
+/* 20759 */ {21,230},
+/* 20760 */ {21,230},
+/* 20761 */ {21,230},
+/* 20762 */ {21,230},
+/* 20763 */ {21,230},
+/* 20764 */ {21,230},
+/* 20765 */ {21,230},
+/* 20766 */ {21,230},
+/* 20767 */ {21,230},
+/* 20768 */ {21,230},
+/* 20769 */ {21,230},
+/* 20770 */ {21,230},
+/* 20771 */ {21,230},
+/* 20772 */ {21,230},
+/* 20773 */ {21,230},
+/* 20774 */ {21,230},
+/* 20775 */ {21,230},
+/* 20776 */ {21,230},
+/* 20777 */ {21,230},
+/* 20778 */ {21,230},
+/* 20779 */ {21,230},
+/* 20780 */ {21,230},
+/* 20781 */ {21,230},
+/* 20782 */ {21,230},
+/* 20783 */ {21,230},
+/* 20784 */ {21,230},
+/* 20785 */ {21,230},
+/* 20786 */ {21,230},
+/* 20787 */ {21,230},
+/* 20788 */ {21,230},
+/* 20789 */ {21,230},
+/* 20790 */ {21,230},
+/* 20791 */ {21,230},
+/* 20792 */ {21,230},
+/* 20793 */ {21,230},
+/* 20794 */ {21,230},
+/* 20795 */ {21,230},
+/* 20796 */ {21,230},
+/* 20797 */ {21,230},
+/* 20798 */ {21,230},
+/* 20799 */ {21,230},
+/* 20800 */ {21,230},
+/* 20801 */ {21,230},
+/* 20802 */ {21,230},
+/* 20803 */ {21,230},
+/* 20804 */ {21,230},
+/* 20805 */ {21,230},
+/* 20806 */ {21,230},
+/* 20807 */ {21,230},
+/* 20808 */ {21,230},
+/* 20809 */ {21,230},
+/* 20810 */ {21,230},
+/* 20811 */ {21,230},
+/* 20812 */ {21,230},
+/* 20813 */ {21,230},
+/* 20814 */ {21,230},
+/* 20815 */ {21,230},
+/* 20816 */ {21,230},
+/* 20817 */ {21,230},
+/* 20818 */ {21,230},
+/* 20819 */ {21,230},
+/* 20820 */ {21,230},
+/* 20821 */ {21,230},
+/* 20822 */ {21,230},
+/* 20823 */ {21,230},
+/* 20824 */ {21,230},
+/* 20825 */ {21,230},
+/* 20826 */ {21,230},
+/* 20827 */ {21,230},
+/* 20828 */ {21,230},
+/* 20829 */ {21,230},
+/* 20830 */ {21,230},
+/* 20831 */ {21,230},
+/* 20832 */ {21,230},
+/* 20833 */ {21,230},
+/* 20834 */ {21,230},
+/* 20835 */ {21,230},
+/* 20836 */ {21,230},
+/* 20837 */ {21,230},
+/* 20838 */ {21,230},
+/* 20839 */ {21,230},
+/* 20840 */ {21,230},
+/* 20841 */ {21,230},
+/* 20842 */ {21,230},
+/* 20843 */ {21,230},
+/* 20844 */ {21,230},
+/* 20845 */ {21,230},
+/* 20846 */ {21,230},
+/* 20847 */ {21,230},
+/* 20848 */ {21,230},
+/* 20849 */ {21,230},
+/* 20850 */ {21,230},
+/* 20851 */ {21,230},
+/* 20852 */ {21,230},
+/* 20853 */ {21,230},
+/* 20854 */ {21,230},
+/* 20855 */ {21,230},
+/* 20856 */ {21,230},
+/* 20857 */ {21,230},
+/* 20858 */ {21,230},
+/* 20859 */ {21,230},
+/* 20860 */ {21,230},
+/* 20861 */ {21,230},
+/* 20862 */ {21,230},
+/* 20863 */ {21,230},
+/* 20864 */ {21,230},
+/* 20865 */ {21,230},
+/* 20866 */ {21,230},
+/* 20867 */ {21,230},
+/* 20868 */ {21,230},
+/* 20869 */ {21,230},
+/* 20870 */ {21,230},
+/* 20871 */ {21,230},
+/* 20872 */ {21,230},
+/* 20873 */ {21,230},
+/* 20874 */ {21,230},
+/* 20875 */ {21,230},
+/* 20876 */ {21,230},
+/* 20877 */ {21,230},
+/* 20878 */ {21,230},
+/* 20879 */ {21,230},
+/* 20880 */ {21,230},
+/* 20881 */ {21,230},
+/* 20882 */ {21,230},
+/* 20883 */ {21,230},
+/* 20884 */ {21,230},
+/* 20885 */ {21,230},
+/* 20886 */ {21,230},
+/* 20887 */ {21,230},
+/* 20888 */ {21,230},
+/* 20889 */ {21,230},
+/* 20890 */ {21,230},
+/* 20891 */ {21,230},
+/* 20892 */ {21,230},
+/* 20893 */ {21,230},
+/* 20894 */ {21,230},
+/* 20895 */ {21,230},
+/* 20896 */ {21,230},
+/* 20897 */ {21,230},
+/* 20898 */ {21,230},
+/* 20899 */ {21,230},
+/* 20900 */ {21,230},
+/* 20901 */ {21,230},
+/* 20902 */ {21,230},
+/* 20903 */ {21,230},
+/* 20904 */ {21,230},
+/* 20905 */ {21,230},
+/* 20906 */ {21,230},
+/* 20907 */ {21,230},
+/* 20908 */ {21,230},
+/* 20909 */ {21,230},
+/* 20910 */ {21,230},
+/* 20911 */ {21,230},
+/* 20912 */ {21,230},
+/* 20913 */ {21,230},
+/* 20914 */ {21,230},
+/* 20915 */ {21,230},
+/* 20916 */ {21,230},
+/* 20917 */ {21,230},
+/* 20918 */ {21,230},
+/* 20919 */ {21,230},
+/* 20920 */ {21,230},
+/* 20921 */ {21,230},
+/* 20922 */ {21,230},
+/* 20923 */ {21,230},
+/* 20924 */ {21,230},
+/* 20925 */ {21,230},
+/* 20926 */ {21,230},
+/* 20927 */ {21,230},
+/* 20928 */ {21,230},
+/* 20929 */ {21,230},
+/* 20930 */ {21,230},
+/* 20931 */ {21,230},
+/* 20932 */ {21,230},
+/* 20933 */ {21,230},
+/* 20934 */ {21,230},
+/* 20935 */ {21,230},
+/* 20936 */ {21,230},
+/* 20937 */ {21,230},
+/* 20938 */ {21,230},
+/* 20939 */ {21,230},
+/* 20940 */ {21,230},
+/* 20941 */ {21,230},
+/* 20942 */ {21,230},
+/* 20943 */ {21,230},
+/* 20944 */ {21,230},
+/* 20945 */ {21,230},
+/* 20946 */ {21,230},
+/* 20947 */ {21,230},
+/* 20948 */ {21,230},
+/* 20949 */ {21,230},
+/* 20950 */ {21,230},
+/* 20951 */ {21,230},
+/* 20952 */ {21,230},
+/* 20953 */ {21,230},
+/* 20954 */ {21,230},
+/* 20955 */ {21,230},
+/* 20956 */ {21,230},
+/* 20957 */ {21,230},
+/* 20958 */ {21,230},
+/* 20959 */ {21,230},
+/* 20960 */ {21,230},
+/* 20961 */ {21,230},
+/* 20962 */ {21,230},
+/* 20963 */ {21,230},
+/* 20964 */ {21,230},
+/* 20965 */ {21,230},
+/* 20966 */ {21,230},
+/* 20967 */ {21,230},
+/* 20968 */ {21,230},
+/* 20969 */ {21,230},
+/* 20970 */ {21,230},
+/* 20971 */ {21,230},
+/* 20972 */ {21,230},
+/* 20973 */ {21,230},
+/* 20974 */ {21,230},
+/* 20975 */ {21,230},
+/* 20976 */ {21,230},
+/* 20977 */ {21,230},
+/* 20978 */ {21,230},
+/* 20979 */ {21,230},
+/* 20980 */ {21,230},
+/* 20981 */ {21,230},
+/* 20982 */ {21,230},
+/* 20983 */ {21,230},
+/* 20984 */ {21,230},
+/* 20985 */ {21,230},
+/* 20986 */ {21,230},
+/* 20987 */ {21,230},
+/* 20988 */ {21,230},
+/* 20989 */ {21,230},
+/* 20990 */ {21,230},
+/* 20991 */ {21,230},
+/* 20992 */ {22,129},
+/* 20993 */ {22,129},
+/* 20994 */ {22,129},
+/* 20995 */ {22,129},
+/* 20996 */ {22,129},
+/* 20997 */ {22,129},
+/* 20998 */ {22,129},
+/* 20999 */ {22,129},
+/* 21000 */ {22,129},
+/* 21001 */ {22,129},
+/* 21002 */ {22,129},
+/* 21003 */ {22,129},
+/* 21004 */ {22,129},
+/* 21005 */ {22,129},
+/* 21006 */ {22,129},
+/* 21007 */ {22,129},
+/* 21008 */ {22,129},
+/* 21009 */ {22,129},
+/* 21010 */ {22,129},
+/* 21011 */ {22,129},
+/* 21012 */ {22,129},
+/* 21013 */ {22,129},
+/* 21014 */ {22,129},
+/* 21015 */ {22,129},
+/* 21016 */ {22,129},
+/* 21017 */ {22,129},
+/* 21018 */ {22,129},
+/* 21019 */ {22,129},
+/* 21020 */ {22,129},
+/* 21021 */ {22,129},
+/* 21022 */ {22,129},
+/* 21023 */ {22,129},
+/* 21024 */ {22,129},
+/* 21025 */ {22,129},
+/* 21026 */ {22,129},
+/* 21027 */ {22,129},
+/* 21028 */ {22,129},
+/* 21029 */ {22,129},
+/* 21030 */ {22,129},
+/* 21031 */ {22,129},
+/* 21032 */ {22,129},
+/* 21033 */ {22,129},
+/* 21034 */ {22,129},
+/* 21035 */ {22,129},
+/* 21036 */ {22,129},
+/* 21037 */ {22,129},
+/* 21038 */ {22,129},
+/* 21039 */ {22,129},
+/* 21040 */ {22,129},
+/* 21041 */ {22,129},
+/* 21042 */ {22,129},
+/* 21043 */ {22,129},
+/* 21044 */ {22,129},
+/* 21045 */ {22,129},
+/* 21046 */ {22,129},
+/* 21047 */ {22,129},
+/* 21048 */ {22,129},
+/* 21049 */ {22,129},
+/* 21050 */ {22,129},
+/* 21051 */ {22,129},
+/* 21052 */ {22,129},
+/* 21053 */ {22,129},
+/* 21054 */ {22,129},
+/* 21055 */ {22,129},
+/* 21056 */ {22,129},
+/* 21057 */ {22,129},
+/* 21058 */ {22,129},
+/* 21059 */ {22,129},
+/* 21060 */ {22,129},
+/* 21061 */ {22,129},
+/* 21062 */ {22,129},
+/* 21063 */ {22,129},
+/* 21064 */ {22,129},
+/* 21065 */ {22,129},
+/* 21066 */ {22,129},
+/* 21067 */ {22,129},
+/* 21068 */ {22,129},
+/* 21069 */ {22,129},
+/* 21070 */ {22,129},
+/* 21071 */ {22,129},
+/* 21072 */ {22,129},
+/* 21073 */ {22,129},
+/* 21074 */ {22,129},
+/* 21075 */ {22,129},
+/* 21076 */ {22,129},
+/* 21077 */ {22,129},
+/* 21078 */ {22,129},
+/* 21079 */ {22,129},
+/* 21080 */ {22,129},
+/* 21081 */ {22,129},
+/* 21082 */ {22,129},
+/* 21083 */ {22,129},
+/* 21084 */ {22,129},
+/* 21085 */ {22,129},
+/* 21086 */ {22,129},
+/* 21087 */ {22,129},
+/* 21088 */ {22,129},
+/* 21089 */ {22,129},
+/* 21090 */ {22,129},
+/* 21091 */ {22,129},
+/* 21092 */ {22,129},
+/* 21093 */ {22,129},
+/* 21094 */ {22,129},
+/* 21095 */ {22,129},
+/* 21096 */ {22,129},
+/* 21097 */ {22,129},
+/* 21098 */ {22,129},
+/* 21099 */ {22,129},
+/* 21100 */ {22,129},
+/* 21101 */ {22,129},
+/* 21102 */ {22,129},
+/* 21103 */ {22,129},
+/* 21104 */ {22,129},
+/* 21105 */ {22,129},
+/* 21106 */ {22,129},
+/* 21107 */ {22,129},
+/* 21108 */ {22,129},
+/* 21109 */ {22,129},
+/* 21110 */ {22,129},
+/* 21111 */ {22,129},
+/* 21112 */ {22,129},
+/* 21113 */ {22,129},
+/* 21114 */ {22,129},
+/* 21115 */ {22,129},
+/* 21116 */ {22,129},
+/* 21117 */ {22,129},
+/* 21118 */ {22,129},
+/* 21119 */ {22,129},
+/* 21120 */ {22,129},
+/* 21121 */ {22,129},
+/* 21122 */ {22,129},
+/* 21123 */ {22,129},
+/* 21124 */ {22,129},
+/* 21125 */ {22,129},
+/* 21126 */ {22,129},
+/* 21127 */ {22,129},
+/* 21128 */ {22,129},
+/* 21129 */ {22,129},
+/* 21130 */ {22,129},
+/* 21131 */ {22,129},
+/* 21132 */ {22,129},
+/* 21133 */ {22,129},
+/* 21134 */ {22,129},
+/* 21135 */ {22,129},
+/* 21136 */ {22,129},
+/* 21137 */ {22,129},
+/* 21138 */ {22,129},
+/* 21139 */ {22,129},
+/* 21140 */ {22,129},
+/* 21141 */ {22,129},
+/* 21142 */ {22,129},
+/* 21143 */ {22,129},
+/* 21144 */ {22,129},
+/* 21145 */ {22,129},
+/* 21146 */ {22,129},
+/* 21147 */ {22,129},
+/* 21148 */ {22,129},
+/* 21149 */ {22,129},
+/* 21150 */ {22,129},
+/* 21151 */ {22,129},
+/* 21152 */ {22,129},
+/* 21153 */ {22,129},
+/* 21154 */ {22,129},
+/* 21155 */ {22,129},
+/* 21156 */ {22,129},
+/* 21157 */ {22,129},
+/* 21158 */ {22,129},
+/* 21159 */ {22,129},
+/* 21160 */ {22,129},
+/* 21161 */ {22,129},
+/* 21162 */ {22,129},
+/* 21163 */ {22,129},
+/* 21164 */ {22,129},
+/* 21165 */ {22,129},
+/* 21166 */ {22,129},
+/* 21167 */ {22,129},
+/* 21168 */ {22,129},
+/* 21169 */ {22,129},
+/* 21170 */ {22,129},
+/* 21171 */ {22,129},
+/* 21172 */ {22,129},
+/* 21173 */ {22,129},
+/* 21174 */ {22,129},
+/* 21175 */ {22,129},
+/* 21176 */ {22,129},
+/* 21177 */ {22,129},
+/* 21178 */ {22,129},
+/* 21179 */ {22,129},
+/* 21180 */ {22,129},
+/* 21181 */ {22,129},
+/* 21182 */ {22,129},
+/* 21183 */ {22,129},
+/* 21184 */ {22,129},
+/* 21185 */ {22,129},
+/* 21186 */ {22,129},
+/* 21187 */ {22,129},
+/* 21188 */ {22,129},
+/* 21189 */ {22,129},
+/* 21190 */ {22,129},
+/* 21191 */ {22,129},
+/* 21192 */ {22,129},
+/* 21193 */ {22,129},
+/* 21194 */ {22,129},
+/* 21195 */ {22,129},
+/* 21196 */ {22,129},
+/* 21197 */ {22,129},
+/* 21198 */ {22,129},
+/* 21199 */ {22,129},
+/* 21200 */ {22,129},
+/* 21201 */ {22,129},
+/* 21202 */ {22,129},
+/* 21203 */ {22,129},
+/* 21204 */ {22,129},
+/* 21205 */ {22,129},
+/* 21206 */ {22,129},
+/* 21207 */ {22,129},
+/* 21208 */ {22,129},
+/* 21209 */ {22,129},
+/* 21210 */ {22,129},
+/* 21211 */ {22,129},
+/* 21212 */ {22,129},
+/* 21213 */ {22,129},
+/* 21214 */ {22,129},
+/* 21215 */ {22,129},
+/* 21216 */ {22,129},
+/* 21217 */ {22,129},
+/* 21218 */ {22,129},
+/* 21219 */ {22,129},
+/* 21220 */ {22,129},
+/* 21221 */ {22,129},
+/* 21222 */ {22,129},
+/* 21223 */ {22,129},
+/* 21224 */ {22,129},
+/* 21225 */ {22,129},
+/* 21226 */ {22,129},
+/* 21227 */ {22,129},
+/* 21228 */ {22,129},
+/* 21229 */ {22,129},
+/* 21230 */ {22,129},
+/* 21231 */ {22,129},
+/* 21232 */ {22,129},
+/* 21233 */ {22,129},
+/* 21234 */ {22,129},
+/* 21235 */ {22,129},
+/* 21236 */ {22,129},
+/* 21237 */ {22,129},
+/* 21238 */ {22,129},
+/* 21239 */ {22,129},
+/* 21240 */ {22,129},
+/* 21241 */ {22,129},
+/* 21242 */ {22,129},
+/* 21243 */ {22,129},
+/* 21244 */ {22,129},
+/* 21245 */ {22,129},
+/* 21246 */ {22,129},
+/* 21247 */ {22,129},
+/* 21248 */ {22,132},
+/* 21249 */ {22,132},
+/* 21250 */ {22,132},
+/* 21251 */ {22,132},
+/* 21252 */ {22,132},
+/* 21253 */ {22,132},
+/* 21254 */ {22,132},
+/* 21255 */ {22,132},
+/* 21256 */ {22,132},
+/* 21257 */ {22,132},
+/* 21258 */ {22,132},
+/* 21259 */ {22,132},
+/* 21260 */ {22,132},
+/* 21261 */ {22,132},
+/* 21262 */ {22,132},
+/* 21263 */ {22,132},
+/* 21264 */ {22,132},
+/* 21265 */ {22,132},
+/* 21266 */ {22,132},
+/* 21267 */ {22,132},
+/* 21268 */ {22,132},
+/* 21269 */ {22,132},
+/* 21270 */ {22,132},
+/* 21271 */ {22,132},
+/* 21272 */ {22,132},
+/* 21273 */ {22,132},
+/* 21274 */ {22,132},
+/* 21275 */ {22,132},
+/* 21276 */ {22,132},
+/* 21277 */ {22,132},
+/* 21278 */ {22,132},
+/* 21279 */ {22,132},
+/* 21280 */ {22,132},
+/* 21281 */ {22,132},
+/* 21282 */ {22,132},
+/* 21283 */ {22,132},
+/* 21284 */ {22,132},
+/* 21285 */ {22,132},
+/* 21286 */ {22,132},
+/* 21287 */ {22,132},
+/* 21288 */ {22,132},
+/* 21289 */ {22,132},
+/* 21290 */ {22,132},
+/* 21291 */ {22,132},
+/* 21292 */ {22,132},
+/* 21293 */ {22,132},
+/* 21294 */ {22,132},
+/* 21295 */ {22,132},
+/* 21296 */ {22,132},
+/* 21297 */ {22,132},
+/* 21298 */ {22,132},
+/* 21299 */ {22,132},
+/* 21300 */ {22,132},
+/* 21301 */ {22,132},
+/* 21302 */ {22,132},
+/* 21303 */ {22,132},
+/* 21304 */ {22,132},
+/* 21305 */ {22,132},
+/* 21306 */ {22,132},
+/* 21307 */ {22,132},
+/* 21308 */ {22,132},
+/* 21309 */ {22,132},
+/* 21310 */ {22,132},
+/* 21311 */ {22,132},
+/* 21312 */ {22,132},
+/* 21313 */ {22,132},
+/* 21314 */ {22,132},
+/* 21315 */ {22,132},
+/* 21316 */ {22,132},
+/* 21317 */ {22,132},
+/* 21318 */ {22,132},
+/* 21319 */ {22,132},
+/* 21320 */ {22,132},
+/* 21321 */ {22,132},
+/* 21322 */ {22,132},
+/* 21323 */ {22,132},
+/* 21324 */ {22,132},
+/* 21325 */ {22,132},
+/* 21326 */ {22,132},
+/* 21327 */ {22,132},
+/* 21328 */ {22,132},
+/* 21329 */ {22,132},
+/* 21330 */ {22,132},
+/* 21331 */ {22,132},
+/* 21332 */ {22,132},
+/* 21333 */ {22,132},
+/* 21334 */ {22,132},
+/* 21335 */ {22,132},
+/* 21336 */ {22,132},
+/* 21337 */ {22,132},
+/* 21338 */ {22,132},
+/* 21339 */ {22,132},
+/* 21340 */ {22,132},
+/* 21341 */ {22,132},
+/* 21342 */ {22,132},
+/* 21343 */ {22,132},
+/* 21344 */ {22,132},
+/* 21345 */ {22,132},
+/* 21346 */ {22,132},
+/* 21347 */ {22,132},
+/* 21348 */ {22,132},
+/* 21349 */ {22,132},
+/* 21350 */ {22,132},
+/* 21351 */ {22,132},
+/* 21352 */ {22,132},
+/* 21353 */ {22,132},
+/* 21354 */ {22,132},
+/* 21355 */ {22,132},
+/* 21356 */ {22,132},
+/* 21357 */ {22,132},
+/* 21358 */ {22,132},
+/* 21359 */ {22,132},
+/* 21360 */ {22,132},
+/* 21361 */ {22,132},
+/* 21362 */ {22,132},
+/* 21363 */ {22,132},
+/* 21364 */ {22,132},
+/* 21365 */ {22,132},
+/* 21366 */ {22,132},
+/* 21367 */ {22,132},
+/* 21368 */ {22,132},
+/* 21369 */ {22,132},
+/* 21370 */ {22,132},
+/* 21371 */ {22,132},
+/* 21372 */ {22,132},
+/* 21373 */ {22,132},
+/* 21374 */ {22,132},
+/* 21375 */ {22,132},
+/* 21376 */ {22,132},
+/* 21377 */ {22,132},
+/* 21378 */ {22,132},
+/* 21379 */ {22,132},
+/* 21380 */ {22,132},
+/* 21381 */ {22,132},
+/* 21382 */ {22,132},
+/* 21383 */ {22,132},
+/* 21384 */ {22,132},
+/* 21385 */ {22,132},
+/* 21386 */ {22,132},
+/* 21387 */ {22,132},
+/* 21388 */ {22,132},
+/* 21389 */ {22,132},
+/* 21390 */ {22,132},
+/* 21391 */ {22,132},
+/* 21392 */ {22,132},
+/* 21393 */ {22,132},
+/* 21394 */ {22,132},
+/* 21395 */ {22,132},
+/* 21396 */ {22,132},
+/* 21397 */ {22,132},
+/* 21398 */ {22,132},
+/* 21399 */ {22,132},
+/* 21400 */ {22,132},
+/* 21401 */ {22,132},
+/* 21402 */ {22,132},
+/* 21403 */ {22,132},
+/* 21404 */ {22,132},
+/* 21405 */ {22,132},
+/* 21406 */ {22,132},
+/* 21407 */ {22,132},
+/* 21408 */ {22,132},
+/* 21409 */ {22,132},
+/* 21410 */ {22,132},
+/* 21411 */ {22,132},
+/* 21412 */ {22,132},
+/* 21413 */ {22,132},
+/* 21414 */ {22,132},
+/* 21415 */ {22,132},
+/* 21416 */ {22,132},
+/* 21417 */ {22,132},
+/* 21418 */ {22,132},
+/* 21419 */ {22,132},
+/* 21420 */ {22,132},
+/* 21421 */ {22,132},
+/* 21422 */ {22,132},
+/* 21423 */ {22,132},
+/* 21424 */ {22,132},
+/* 21425 */ {22,132},
+/* 21426 */ {22,132},
+/* 21427 */ {22,132},
+/* 21428 */ {22,132},
+/* 21429 */ {22,132},
+/* 21430 */ {22,132},
+/* 21431 */ {22,132},
+/* 21432 */ {22,132},
+/* 21433 */ {22,132},
+/* 21434 */ {22,132},
+/* 21435 */ {22,132},
+/* 21436 */ {22,132},
+/* 21437 */ {22,132},
+/* 21438 */ {22,132},
+/* 21439 */ {22,132},
+/* 21440 */ {22,132},
+/* 21441 */ {22,132},
+/* 21442 */ {22,132},
+/* 21443 */ {22,132},
+/* 21444 */ {22,132},
+/* 21445 */ {22,132},
+/* 21446 */ {22,132},
+/* 21447 */ {22,132},
+/* 21448 */ {22,132},
+/* 21449 */ {22,132},
+/* 21450 */ {22,132},
+/* 21451 */ {22,132},
+/* 21452 */ {22,132},
+/* 21453 */ {22,132},
+/* 21454 */ {22,132},
+/* 21455 */ {22,132},
+/* 21456 */ {22,132},
+/* 21457 */ {22,132},
+/* 21458 */ {22,132},
+/* 21459 */ {22,132},
+/* 21460 */ {22,132},
+/* 21461 */ {22,132},
+/* 21462 */ {22,132},
+/* 21463 */ {22,132},
+/* 21464 */ {22,132},
+/* 21465 */ {22,132},
+/* 21466 */ {22,132},
+/* 21467 */ {22,132},
+/* 21468 */ {22,132},
+/* 21469 */ {22,132},
+/* 21470 */ {22,132},
+/* 21471 */ {22,132},
+/* 21472 */ {22,132},
+/* 21473 */ {22,132},
+/* 21474 */ {22,132},
+/* 21475 */ {22,132},
+/* 21476 */ {22,132},
+/* 21477 */ {22,132},
+/* 21478 */ {22,132},
+/* 21479 */ {22,132},
+/* 21480 */ {22,132},
+/* 21481 */ {22,132},
+/* 21482 */ {22,132},
+/* 21483 */ {22,132},
+/* 21484 */ {22,132},
+/* 21485 */ {22,132},
+/* 21486 */ {22,132},
+/* 21487 */ {22,132},
+/* 21488 */ {22,132},
+/* 21489 */ {22,132},
+/* 21490 */ {22,132},
+/* 21491 */ {22,132},
+/* 21492 */ {22,132},
+/* 21493 */ {22,132},
+/* 21494 */ {22,132},
+/* 21495 */ {22,132},
+/* 21496 */ {22,132},
+/* 21497 */ {22,132},
+/* 21498 */ {22,132},
+/* 21499 */ {22,132},
+/* 21500 */ {22,132},
+/* 21501 */ {22,132},
+/* 21502 */ {22,132},
+/* 21503 */ {22,132},
+/* 21504 */ {22,133},
+/* 21505 */ {22,133},
+/* 21506 */ {22,133},
+/* 21507 */ {22,133},
+/* 21508 */ {22,133},
+/* 21509 */ {22,133},
+/* 21510 */ {22,133},
+/* 21511 */ {22,133},
+/* 21512 */ {22,133},
+/* 21513 */ {22,133},
+/* 21514 */ {22,133},
+/* 21515 */ {22,133},
+/* 21516 */ {22,133},
+/* 21517 */ {22,133},
+/* 21518 */ {22,133},
+/* 21519 */ {22,133},
+/* 21520 */ {22,133},
+/* 21521 */ {22,133},
+/* 21522 */ {22,133},
+/* 21523 */ {22,133},
+/* 21524 */ {22,133},
+/* 21525 */ {22,133},
+/* 21526 */ {22,133},
+/* 21527 */ {22,133},
+/* 21528 */ {22,133},
+/* 21529 */ {22,133},
+/* 21530 */ {22,133},
+/* 21531 */ {22,133},
+/* 21532 */ {22,133},
+/* 21533 */ {22,133},
+/* 21534 */ {22,133},
+/* 21535 */ {22,133},
+/* 21536 */ {22,133},
+/* 21537 */ {22,133},
+/* 21538 */ {22,133},
+/* 21539 */ {22,133},
+/* 21540 */ {22,133},
+/* 21541 */ {22,133},
+/* 21542 */ {22,133},
+/* 21543 */ {22,133},
+/* 21544 */ {22,133},
+/* 21545 */ {22,133},
+/* 21546 */ {22,133},
+/* 21547 */ {22,133},
+/* 21548 */ {22,133},
+/* 21549 */ {22,133},
+/* 21550 */ {22,133},
+/* 21551 */ {22,133},
+/* 21552 */ {22,133},
+/* 21553 */ {22,133},
+/* 21554 */ {22,133},
+/* 21555 */ {22,133},
+/* 21556 */ {22,133},
+/* 21557 */ {22,133},
+/* 21558 */ {22,133},
+/* 21559 */ {22,133},
+/* 21560 */ {22,133},
+/* 21561 */ {22,133},
+/* 21562 */ {22,133},
+/* 21563 */ {22,133},
+/* 21564 */ {22,133},
+/* 21565 */ {22,133},
+/* 21566 */ {22,133},
+/* 21567 */ {22,133},
+/* 21568 */ {22,133},
+/* 21569 */ {22,133},
+/* 21570 */ {22,133},
+/* 21571 */ {22,133},
+/* 21572 */ {22,133},
+/* 21573 */ {22,133},
+/* 21574 */ {22,133},
+/* 21575 */ {22,133},
+/* 21576 */ {22,133},
+/* 21577 */ {22,133},
+/* 21578 */ {22,133},
+/* 21579 */ {22,133},
+/* 21580 */ {22,133},
+/* 21581 */ {22,133},
+/* 21582 */ {22,133},
+/* 21583 */ {22,133},
+/* 21584 */ {22,133},
+/* 21585 */ {22,133},
+/* 21586 */ {22,133},
+/* 21587 */ {22,133},
+/* 21588 */ {22,133},
+/* 21589 */ {22,133},
+/* 21590 */ {22,133},
+/* 21591 */ {22,133},
+/* 21592 */ {22,133},
+/* 21593 */ {22,133},
+/* 21594 */ {22,133},
+/* 21595 */ {22,133},
+/* 21596 */ {22,133},
+/* 21597 */ {22,133},
+/* 21598 */ {22,133},
+/* 21599 */ {22,133},
+/* 21600 */ {22,133},
+/* 21601 */ {22,133},
+/* 21602 */ {22,133},
+/* 21603 */ {22,133},
+/* 21604 */ {22,133},
+/* 21605 */ {22,133},
+/* 21606 */ {22,133},
+/* 21607 */ {22,133},
+/* 21608 */ {22,133},
+/* 21609 */ {22,133},
+/* 21610 */ {22,133},
+/* 21611 */ {22,133},
+/* 21612 */ {22,133},
+/* 21613 */ {22,133},
+/* 21614 */ {22,133},
+/* 21615 */ {22,133},
+/* 21616 */ {22,133},
+/* 21617 */ {22,133},
+/* 21618 */ {22,133},
+/* 21619 */ {22,133},
+/* 21620 */ {22,133},
+/* 21621 */ {22,133},
+/* 21622 */ {22,133},
+/* 21623 */ {22,133},
+/* 21624 */ {22,133},
+/* 21625 */ {22,133},
+/* 21626 */ {22,133},
+/* 21627 */ {22,133},
+/* 21628 */ {22,133},
+/* 21629 */ {22,133},
+/* 21630 */ {22,133},
+/* 21631 */ {22,133},
+/* 21632 */ {22,133},
+/* 21633 */ {22,133},
+/* 21634 */ {22,133},
+/* 21635 */ {22,133},
+/* 21636 */ {22,133},
+/* 21637 */ {22,133},
+/* 21638 */ {22,133},
+/* 21639 */ {22,133},
+/* 21640 */ {22,133},
+/* 21641 */ {22,133},
+/* 21642 */ {22,133},
+/* 21643 */ {22,133},
+/* 21644 */ {22,133},
+/* 21645 */ {22,133},
+/* 21646 */ {22,133},
+/* 21647 */ {22,133},
+/* 21648 */ {22,133},
+/* 21649 */ {22,133},
+/* 21650 */ {22,133},
+/* 21651 */ {22,133},
+/* 21652 */ {22,133},
+/* 21653 */ {22,133},
+/* 21654 */ {22,133},
+/* 21655 */ {22,133},
+/* 21656 */ {22,133},
+/* 21657 */ {22,133},
+/* 21658 */ {22,133},
+/* 21659 */ {22,133},
+/* 21660 */ {22,133},
+/* 21661 */ {22,133},
+/* 21662 */ {22,133},
+/* 21663 */ {22,133},
+/* 21664 */ {22,133},
+/* 21665 */ {22,133},
+/* 21666 */ {22,133},
+/* 21667 */ {22,133},
+/* 21668 */ {22,133},
+/* 21669 */ {22,133},
+/* 21670 */ {22,133},
+/* 21671 */ {22,133},
+/* 21672 */ {22,133},
+/* 21673 */ {22,133},
+/* 21674 */ {22,133},
+/* 21675 */ {22,133},
+/* 21676 */ {22,133},
+/* 21677 */ {22,133},
+/* 21678 */ {22,133},
+/* 21679 */ {22,133},
+/* 21680 */ {22,133},
+/* 21681 */ {22,133},
+/* 21682 */ {22,133},
+/* 21683 */ {22,133},
+/* 21684 */ {22,133},
+/* 21685 */ {22,133},
+/* 21686 */ {22,133},
+/* 21687 */ {22,133},
+/* 21688 */ {22,133},
+/* 21689 */ {22,133},
+/* 21690 */ {22,133},
+/* 21691 */ {22,133},
+/* 21692 */ {22,133},
+/* 21693 */ {22,133},
+/* 21694 */ {22,133},
+/* 21695 */ {22,133},
+/* 21696 */ {22,133},
+/* 21697 */ {22,133},
+/* 21698 */ {22,133},
+/* 21699 */ {22,133},
+/* 21700 */ {22,133},
+/* 21701 */ {22,133},
+/* 21702 */ {22,133},
+/* 21703 */ {22,133},
+/* 21704 */ {22,133},
+/* 21705 */ {22,133},
+/* 21706 */ {22,133},
+/* 21707 */ {22,133},
+/* 21708 */ {22,133},
+/* 21709 */ {22,133},
+/* 21710 */ {22,133},
+/* 21711 */ {22,133},
+/* 21712 */ {22,133},
+/* 21713 */ {22,133},
+/* 21714 */ {22,133},
+/* 21715 */ {22,133},
+/* 21716 */ {22,133},
+/* 21717 */ {22,133},
+/* 21718 */ {22,133},
+/* 21719 */ {22,133},
+/* 21720 */ {22,133},
+/* 21721 */ {22,133},
+/* 21722 */ {22,133},
+/* 21723 */ {22,133},
+/* 21724 */ {22,133},
+/* 21725 */ {22,133},
+/* 21726 */ {22,133},
+/* 21727 */ {22,133},
+/* 21728 */ {22,133},
+/* 21729 */ {22,133},
+/* 21730 */ {22,133},
+/* 21731 */ {22,133},
+/* 21732 */ {22,133},
+/* 21733 */ {22,133},
+/* 21734 */ {22,133},
+/* 21735 */ {22,133},
+/* 21736 */ {22,133},
+/* 21737 */ {22,133},
+/* 21738 */ {22,133},
+/* 21739 */ {22,133},
+/* 21740 */ {22,133},
+/* 21741 */ {22,133},
+/* 21742 */ {22,133},
+/* 21743 */ {22,133},
+/* 21744 */ {22,133},
+/* 21745 */ {22,133},
+/* 21746 */ {22,133},
+/* 21747 */ {22,133},
+/* 21748 */ {22,133},
+/* 21749 */ {22,133},
+/* 21750 */ {22,133},
+/* 21751 */ {22,133},
+/* 21752 */ {22,133},
+/* 21753 */ {22,133},
+/* 21754 */ {22,133},
+/* 21755 */ {22,133},
+/* 21756 */ {22,133},
+/* 21757 */ {22,133},
+/* 21758 */ {22,133},
+/* 21759 */ {22,133},
+/* 21760 */ {22,134},
+/* 21761 */ {22,134},
+/* 21762 */ {22,134},
+/* 21763 */ {22,134},
+/* 21764 */ {22,134},
+/* 21765 */ {22,134},
+/* 21766 */ {22,134},
+/* 21767 */ {22,134},
+/* 21768 */ {22,134},
+/* 21769 */ {22,134},
+/* 21770 */ {22,134},
+/* 21771 */ {22,134},
+/* 21772 */ {22,134},
+/* 21773 */ {22,134},
+/* 21774 */ {22,134},
+/* 21775 */ {22,134},
+/* 21776 */ {22,134},
+/* 21777 */ {22,134},
+/* 21778 */ {22,134},
+/* 21779 */ {22,134},
+/* 21780 */ {22,134},
+/* 21781 */ {22,134},
+/* 21782 */ {22,134},
+/* 21783 */ {22,134},
+/* 21784 */ {22,134},
+/* 21785 */ {22,134},
+/* 21786 */ {22,134},
+/* 21787 */ {22,134},
+/* 21788 */ {22,134},
+/* 21789 */ {22,134},
+/* 21790 */ {22,134},
+/* 21791 */ {22,134},
+/* 21792 */ {22,134},
+/* 21793 */ {22,134},
+/* 21794 */ {22,134},
+/* 21795 */ {22,134},
+/* 21796 */ {22,134},
+/* 21797 */ {22,134},
+/* 21798 */ {22,134},
+/* 21799 */ {22,134},
+/* 21800 */ {22,134},
+/* 21801 */ {22,134},
+/* 21802 */ {22,134},
+/* 21803 */ {22,134},
+/* 21804 */ {22,134},
+/* 21805 */ {22,134},
+/* 21806 */ {22,134},
+/* 21807 */ {22,134},
+/* 21808 */ {22,134},
+/* 21809 */ {22,134},
+/* 21810 */ {22,134},
+/* 21811 */ {22,134},
+/* 21812 */ {22,134},
+/* 21813 */ {22,134},
+/* 21814 */ {22,134},
+/* 21815 */ {22,134},
+/* 21816 */ {22,134},
+/* 21817 */ {22,134},
+/* 21818 */ {22,134},
+/* 21819 */ {22,134},
+/* 21820 */ {22,134},
+/* 21821 */ {22,134},
+/* 21822 */ {22,134},
+/* 21823 */ {22,134},
+/* 21824 */ {22,134},
+/* 21825 */ {22,134},
+/* 21826 */ {22,134},
+/* 21827 */ {22,134},
+/* 21828 */ {22,134},
+/* 21829 */ {22,134},
+/* 21830 */ {22,134},
+/* 21831 */ {22,134},
+/* 21832 */ {22,134},
+/* 21833 */ {22,134},
+/* 21834 */ {22,134},
+/* 21835 */ {22,134},
+/* 21836 */ {22,134},
+/* 21837 */ {22,134},
+/* 21838 */ {22,134},
+/* 21839 */ {22,134},
+/* 21840 */ {22,134},
+/* 21841 */ {22,134},
+/* 21842 */ {22,134},
+/* 21843 */ {22,134},
+/* 21844 */ {22,134},
+/* 21845 */ {22,134},
+/* 21846 */ {22,134},
+/* 21847 */ {22,134},
+/* 21848 */ {22,134},
+/* 21849 */ {22,134},
+/* 21850 */ {22,134},
+/* 21851 */ {22,134},
+/* 21852 */ {22,134},
+/* 21853 */ {22,134},
+/* 21854 */ {22,134},
+/* 21855 */ {22,134},
+/* 21856 */ {22,134},
+/* 21857 */ {22,134},
+/* 21858 */ {22,134},
+/* 21859 */ {22,134},
+/* 21860 */ {22,134},
+/* 21861 */ {22,134},
+/* 21862 */ {22,134},
+/* 21863 */ {22,134},
+/* 21864 */ {22,134},
+/* 21865 */ {22,134},
+/* 21866 */ {22,134},
+/* 21867 */ {22,134},
+/* 21868 */ {22,134},
+/* 21869 */ {22,134},
+/* 21870 */ {22,134},
+/* 21871 */ {22,134},
+/* 21872 */ {22,134},
+/* 21873 */ {22,134},
+/* 21874 */ {22,134},
+/* 21875 */ {22,134},
+/* 21876 */ {22,134},
+/* 21877 */ {22,134},
+/* 21878 */ {22,134},
+/* 21879 */ {22,134},
+/* 21880 */ {22,134},
+/* 21881 */ {22,134},
+/* 21882 */ {22,134},
+/* 21883 */ {22,134},
+/* 21884 */ {22,134},
+/* 21885 */ {22,134},
+/* 21886 */ {22,134},
+/* 21887 */ {22,134},
+/* 21888 */ {22,134},
+/* 21889 */ {22,134},
+/* 21890 */ {22,134},
+/* 21891 */ {22,134},
+/* 21892 */ {22,134},
+/* 21893 */ {22,134},
+/* 21894 */ {22,134},
+/* 21895 */ {22,134},
+/* 21896 */ {22,134},
+/* 21897 */ {22,134},
+/* 21898 */ {22,134},
+/* 21899 */ {22,134},
+/* 21900 */ {22,134},
+/* 21901 */ {22,134},
+/* 21902 */ {22,134},
+/* 21903 */ {22,134},
+/* 21904 */ {22,134},
+/* 21905 */ {22,134},
+/* 21906 */ {22,134},
+/* 21907 */ {22,134},
+/* 21908 */ {22,134},
+/* 21909 */ {22,134},
+/* 21910 */ {22,134},
+/* 21911 */ {22,134},
+/* 21912 */ {22,134},
+/* 21913 */ {22,134},
+/* 21914 */ {22,134},
+/* 21915 */ {22,134},
+/* 21916 */ {22,134},
+/* 21917 */ {22,134},
+/* 21918 */ {22,134},
+/* 21919 */ {22,134},
+/* 21920 */ {22,134},
+/* 21921 */ {22,134},
+/* 21922 */ {22,134},
+/* 21923 */ {22,134},
+/* 21924 */ {22,134},
+/* 21925 */ {22,134},
+/* 21926 */ {22,134},
+/* 21927 */ {22,134},
+/* 21928 */ {22,134},
+/* 21929 */ {22,134},
+/* 21930 */ {22,134},
+/* 21931 */ {22,134},
+/* 21932 */ {22,134},
+/* 21933 */ {22,134},
+/* 21934 */ {22,134},
+/* 21935 */ {22,134},
+/* 21936 */ {22,134},
+/* 21937 */ {22,134},
+/* 21938 */ {22,134},
+/* 21939 */ {22,134},
+/* 21940 */ {22,134},
+/* 21941 */ {22,134},
+/* 21942 */ {22,134},
+/* 21943 */ {22,134},
+/* 21944 */ {22,134},
+/* 21945 */ {22,134},
+/* 21946 */ {22,134},
+/* 21947 */ {22,134},
+/* 21948 */ {22,134},
+/* 21949 */ {22,134},
+/* 21950 */ {22,134},
+/* 21951 */ {22,134},
+/* 21952 */ {22,134},
+/* 21953 */ {22,134},
+/* 21954 */ {22,134},
+/* 21955 */ {22,134},
+/* 21956 */ {22,134},
+/* 21957 */ {22,134},
+/* 21958 */ {22,134},
+/* 21959 */ {22,134},
+/* 21960 */ {22,134},
+/* 21961 */ {22,134},
+/* 21962 */ {22,134},
+/* 21963 */ {22,134},
+/* 21964 */ {22,134},
+/* 21965 */ {22,134},
+/* 21966 */ {22,134},
+/* 21967 */ {22,134},
+/* 21968 */ {22,134},
+/* 21969 */ {22,134},
+/* 21970 */ {22,134},
+/* 21971 */ {22,134},
+/* 21972 */ {22,134},
+/* 21973 */ {22,134},
+/* 21974 */ {22,134},
+/* 21975 */ {22,134},
+/* 21976 */ {22,134},
+/* 21977 */ {22,134},
+/* 21978 */ {22,134},
+/* 21979 */ {22,134},
+/* 21980 */ {22,134},
+/* 21981 */ {22,134},
+/* 21982 */ {22,134},
+/* 21983 */ {22,134},
+/* 21984 */ {22,134},
+/* 21985 */ {22,134},
+/* 21986 */ {22,134},
+/* 21987 */ {22,134},
+/* 21988 */ {22,134},
+/* 21989 */ {22,134},
+/* 21990 */ {22,134},
+/* 21991 */ {22,134},
+/* 21992 */ {22,134},
+/* 21993 */ {22,134},
+/* 21994 */ {22,134},
+/* 21995 */ {22,134},
+/* 21996 */ {22,134},
+/* 21997 */ {22,134},
+/* 21998 */ {22,134},
+/* 21999 */ {22,134},
+/* 22000 */ {22,134},
+/* 22001 */ {22,134},
+/* 22002 */ {22,134},
+/* 22003 */ {22,134},
+/* 22004 */ {22,134},
+/* 22005 */ {22,134},
+/* 22006 */ {22,134},
+/* 22007 */ {22,134},
+/* 22008 */ {22,134},
+/* 22009 */ {22,134},
+/* 22010 */ {22,134},
+/* 22011 */ {22,134},
+/* 22012 */ {22,134},
+/* 22013 */ {22,134},
+/* 22014 */ {22,134},
+/* 22015 */ {22,134},
+/* 22016 */ {22,136},
+/* 22017 */ {22,136},
+/* 22018 */ {22,136},
+/* 22019 */ {22,136},
+/* 22020 */ {22,136},
+/* 22021 */ {22,136},
+/* 22022 */ {22,136},
+/* 22023 */ {22,136},
+/* 22024 */ {22,136},
+/* 22025 */ {22,136},
+/* 22026 */ {22,136},
+/* 22027 */ {22,136},
+/* 22028 */ {22,136},
+/* 22029 */ {22,136},
+/* 22030 */ {22,136},
+/* 22031 */ {22,136},
+/* 22032 */ {22,136},
+/* 22033 */ {22,136},
+/* 22034 */ {22,136},
+/* 22035 */ {22,136},
+/* 22036 */ {22,136},
+/* 22037 */ {22,136},
+/* 22038 */ {22,136},
+/* 22039 */ {22,136},
+/* 22040 */ {22,136},
+/* 22041 */ {22,136},
+/* 22042 */ {22,136},
+/* 22043 */ {22,136},
+/* 22044 */ {22,136},
+/* 22045 */ {22,136},
+/* 22046 */ {22,136},
+/* 22047 */ {22,136},
+/* 22048 */ {22,136},
+/* 22049 */ {22,136},
+/* 22050 */ {22,136},
+/* 22051 */ {22,136},
+/* 22052 */ {22,136},
+/* 22053 */ {22,136},
+/* 22054 */ {22,136},
+/* 22055 */ {22,136},
+/* 22056 */ {22,136},
+/* 22057 */ {22,136},
+/* 22058 */ {22,136},
+/* 22059 */ {22,136},
+/* 22060 */ {22,136},
+/* 22061 */ {22,136},
+/* 22062 */ {22,136},
+/* 22063 */ {22,136},
+/* 22064 */ {22,136},
+/* 22065 */ {22,136},
+/* 22066 */ {22,136},
+/* 22067 */ {22,136},
+/* 22068 */ {22,136},
+/* 22069 */ {22,136},
+/* 22070 */ {22,136},
+/* 22071 */ {22,136},
+/* 22072 */ {22,136},
+/* 22073 */ {22,136},
+/* 22074 */ {22,136},
+/* 22075 */ {22,136},
+/* 22076 */ {22,136},
+/* 22077 */ {22,136},
+/* 22078 */ {22,136},
+/* 22079 */ {22,136},
+/* 22080 */ {22,136},
+/* 22081 */ {22,136},
+/* 22082 */ {22,136},
+/* 22083 */ {22,136},
+/* 22084 */ {22,136},
+/* 22085 */ {22,136},
+/* 22086 */ {22,136},
+/* 22087 */ {22,136},
+/* 22088 */ {22,136},
+/* 22089 */ {22,136},
+/* 22090 */ {22,136},
+/* 22091 */ {22,136},
+/* 22092 */ {22,136},
+/* 22093 */ {22,136},
+/* 22094 */ {22,136},
+/* 22095 */ {22,136},
+/* 22096 */ {22,136},
+/* 22097 */ {22,136},
+/* 22098 */ {22,136},
+/* 22099 */ {22,136},
+/* 22100 */ {22,136},
+/* 22101 */ {22,136},
+/* 22102 */ {22,136},
+/* 22103 */ {22,136},
+/* 22104 */ {22,136},
+/* 22105 */ {22,136},
+/* 22106 */ {22,136},
+/* 22107 */ {22,136},
+/* 22108 */ {22,136},
+/* 22109 */ {22,136},
+/* 22110 */ {22,136},
+/* 22111 */ {22,136},
+/* 22112 */ {22,136},
+/* 22113 */ {22,136},
+/* 22114 */ {22,136},
+/* 22115 */ {22,136},
+/* 22116 */ {22,136},
+/* 22117 */ {22,136},
+/* 22118 */ {22,136},
+/* 22119 */ {22,136},
+/* 22120 */ {22,136},
+/* 22121 */ {22,136},
+/* 22122 */ {22,136},
+/* 22123 */ {22,136},
+/* 22124 */ {22,136},
+/* 22125 */ {22,136},
+/* 22126 */ {22,136},
+/* 22127 */ {22,136},
+/* 22128 */ {22,136},
+/* 22129 */ {22,136},
+/* 22130 */ {22,136},
+/* 22131 */ {22,136},
+/* 22132 */ {22,136},
+/* 22133 */ {22,136},
+/* 22134 */ {22,136},
+/* 22135 */ {22,136},
+/* 22136 */ {22,136},
+/* 22137 */ {22,136},
+/* 22138 */ {22,136},
+/* 22139 */ {22,136},
+/* 22140 */ {22,136},
+/* 22141 */ {22,136},
+/* 22142 */ {22,136},
+/* 22143 */ {22,136},
+/* 22144 */ {22,136},
+/* 22145 */ {22,136},
+/* 22146 */ {22,136},
+/* 22147 */ {22,136},
+/* 22148 */ {22,136},
+/* 22149 */ {22,136},
+/* 22150 */ {22,136},
+/* 22151 */ {22,136},
+/* 22152 */ {22,136},
+/* 22153 */ {22,136},
+/* 22154 */ {22,136},
+/* 22155 */ {22,136},
+/* 22156 */ {22,136},
+/* 22157 */ {22,136},
+/* 22158 */ {22,136},
+/* 22159 */ {22,136},
+/* 22160 */ {22,136},
+/* 22161 */ {22,136},
+/* 22162 */ {22,136},
+/* 22163 */ {22,136},
+/* 22164 */ {22,136},
+/* 22165 */ {22,136},
+/* 22166 */ {22,136},
+/* 22167 */ {22,136},
+/* 22168 */ {22,136},
+/* 22169 */ {22,136},
+/* 22170 */ {22,136},
+/* 22171 */ {22,136},
+/* 22172 */ {22,136},
+/* 22173 */ {22,136},
+/* 22174 */ {22,136},
+/* 22175 */ {22,136},
+/* 22176 */ {22,136},
+/* 22177 */ {22,136},
+/* 22178 */ {22,136},
+/* 22179 */ {22,136},
+/* 22180 */ {22,136},
+/* 22181 */ {22,136},
+/* 22182 */ {22,136},
+/* 22183 */ {22,136},
+/* 22184 */ {22,136},
+/* 22185 */ {22,136},
+/* 22186 */ {22,136},
+/* 22187 */ {22,136},
+/* 22188 */ {22,136},
+/* 22189 */ {22,136},
+/* 22190 */ {22,136},
+/* 22191 */ {22,136},
+/* 22192 */ {22,136},
+/* 22193 */ {22,136},
+/* 22194 */ {22,136},
+/* 22195 */ {22,136},
+/* 22196 */ {22,136},
+/* 22197 */ {22,136},
+/* 22198 */ {22,136},
+/* 22199 */ {22,136},
+/* 22200 */ {22,136},
+/* 22201 */ {22,136},
+/* 22202 */ {22,136},
+/* 22203 */ {22,136},
+/* 22204 */ {22,136},
+/* 22205 */ {22,136},
+/* 22206 */ {22,136},
+/* 22207 */ {22,136},
+/* 22208 */ {22,136},
+/* 22209 */ {22,136},
+/* 22210 */ {22,136},
+/* 22211 */ {22,136},
+/* 22212 */ {22,136},
+/* 22213 */ {22,136},
+/* 22214 */ {22,136},
+/* 22215 */ {22,136},
+/* 22216 */ {22,136},
+/* 22217 */ {22,136},
+/* 22218 */ {22,136},
+/* 22219 */ {22,136},
+/* 22220 */ {22,136},
+/* 22221 */ {22,136},
+/* 22222 */ {22,136},
+/* 22223 */ {22,136},
+/* 22224 */ {22,136},
+/* 22225 */ {22,136},
+/* 22226 */ {22,136},
+/* 22227 */ {22,136},
+/* 22228 */ {22,136},
+/* 22229 */ {22,136},
+/* 22230 */ {22,136},
+/* 22231 */ {22,136},
+/* 22232 */ {22,136},
+/* 22233 */ {22,136},
+/* 22234 */ {22,136},
+/* 22235 */ {22,136},
+/* 22236 */ {22,136},
+/* 22237 */ {22,136},
+/* 22238 */ {22,136},
+/* 22239 */ {22,136},
+/* 22240 */ {22,136},
+/* 22241 */ {22,136},
+/* 22242 */ {22,136},
+/* 22243 */ {22,136},
+/* 22244 */ {22,136},
+/* 22245 */ {22,136},
+/* 22246 */ {22,136},
+/* 22247 */ {22,136},
+/* 22248 */ {22,136},
+/* 22249 */ {22,136},
+/* 22250 */ {22,136},
+/* 22251 */ {22,136},
+/* 22252 */ {22,136},
+/* 22253 */ {22,136},
+/* 22254 */ {22,136},
+/* 22255 */ {22,136},
+/* 22256 */ {22,136},
+/* 22257 */ {22,136},
+/* 22258 */ {22,136},
+/* 22259 */ {22,136},
+/* 22260 */ {22,136},
+/* 22261 */ {22,136},
+/* 22262 */ {22,136},
+/* 22263 */ {22,136},
+/* 22264 */ {22,136},
+/* 22265 */ {22,136},
+/* 22266 */ {22,136},
+/* 22267 */ {22,136},
+/* 22268 */ {22,136},
+/* 22269 */ {22,136},
+/* 22270 */ {22,136},
+/* 22271 */ {22,136},
+/* 22272 */ {22,146},
+/* 22273 */ {22,146},
+/* 22274 */ {22,146},
+/* 22275 */ {22,146},
+/* 22276 */ {22,146},
+/* 22277 */ {22,146},
+/* 22278 */ {22,146},
+/* 22279 */ {22,146},
+/* 22280 */ {22,146},
+/* 22281 */ {22,146},
+/* 22282 */ {22,146},
+/* 22283 */ {22,146},
+/* 22284 */ {22,146},
+/* 22285 */ {22,146},
+/* 22286 */ {22,146},
+/* 22287 */ {22,146},
+/* 22288 */ {22,146},
+/* 22289 */ {22,146},
+/* 22290 */ {22,146},
+/* 22291 */ {22,146},
+/* 22292 */ {22,146},
+/* 22293 */ {22,146},
+/* 22294 */ {22,146},
+/* 22295 */ {22,146},
+/* 22296 */ {22,146},
+/* 22297 */ {22,146},
+/* 22298 */ {22,146},
+/* 22299 */ {22,146},
+/* 22300 */ {22,146},
+/* 22301 */ {22,146},
+/* 22302 */ {22,146},
+/* 22303 */ {22,146},
+/* 22304 */ {22,146},
+/* 22305 */ {22,146},
+/* 22306 */ {22,146},
+/* 22307 */ {22,146},
+/* 22308 */ {22,146},
+/* 22309 */ {22,146},
+/* 22310 */ {22,146},
+/* 22311 */ {22,146},
+/* 22312 */ {22,146},
+/* 22313 */ {22,146},
+/* 22314 */ {22,146},
+/* 22315 */ {22,146},
+/* 22316 */ {22,146},
+/* 22317 */ {22,146},
+/* 22318 */ {22,146},
+/* 22319 */ {22,146},
+/* 22320 */ {22,146},
+/* 22321 */ {22,146},
+/* 22322 */ {22,146},
+/* 22323 */ {22,146},
+/* 22324 */ {22,146},
+/* 22325 */ {22,146},
+/* 22326 */ {22,146},
+/* 22327 */ {22,146},
+/* 22328 */ {22,146},
+/* 22329 */ {22,146},
+/* 22330 */ {22,146},
+/* 22331 */ {22,146},
+/* 22332 */ {22,146},
+/* 22333 */ {22,146},
+/* 22334 */ {22,146},
+/* 22335 */ {22,146},
+/* 22336 */ {22,146},
+/* 22337 */ {22,146},
+/* 22338 */ {22,146},
+/* 22339 */ {22,146},
+/* 22340 */ {22,146},
+/* 22341 */ {22,146},
+/* 22342 */ {22,146},
+/* 22343 */ {22,146},
+/* 22344 */ {22,146},
+/* 22345 */ {22,146},
+/* 22346 */ {22,146},
+/* 22347 */ {22,146},
+/* 22348 */ {22,146},
+/* 22349 */ {22,146},
+/* 22350 */ {22,146},
+/* 22351 */ {22,146},
+/* 22352 */ {22,146},
+/* 22353 */ {22,146},
+/* 22354 */ {22,146},
+/* 22355 */ {22,146},
+/* 22356 */ {22,146},
+/* 22357 */ {22,146},
+/* 22358 */ {22,146},
+/* 22359 */ {22,146},
+/* 22360 */ {22,146},
+/* 22361 */ {22,146},
+/* 22362 */ {22,146},
+/* 22363 */ {22,146},
+/* 22364 */ {22,146},
+/* 22365 */ {22,146},
+/* 22366 */ {22,146},
+/* 22367 */ {22,146},
+/* 22368 */ {22,146},
+/* 22369 */ {22,146},
+/* 22370 */ {22,146},
+/* 22371 */ {22,146},
+/* 22372 */ {22,146},
+/* 22373 */ {22,146},
+/* 22374 */ {22,146},
+/* 22375 */ {22,146},
+/* 22376 */ {22,146},
+/* 22377 */ {22,146},
+/* 22378 */ {22,146},
+/* 22379 */ {22,146},
+/* 22380 */ {22,146},
+/* 22381 */ {22,146},
+/* 22382 */ {22,146},
+/* 22383 */ {22,146},
+/* 22384 */ {22,146},
+/* 22385 */ {22,146},
+/* 22386 */ {22,146},
+/* 22387 */ {22,146},
+/* 22388 */ {22,146},
+/* 22389 */ {22,146},
+/* 22390 */ {22,146},
+/* 22391 */ {22,146},
+/* 22392 */ {22,146},
+/* 22393 */ {22,146},
+/* 22394 */ {22,146},
+/* 22395 */ {22,146},
+/* 22396 */ {22,146},
+/* 22397 */ {22,146},
+/* 22398 */ {22,146},
+/* 22399 */ {22,146},
+/* 22400 */ {22,146},
+/* 22401 */ {22,146},
+/* 22402 */ {22,146},
+/* 22403 */ {22,146},
+/* 22404 */ {22,146},
+/* 22405 */ {22,146},
+/* 22406 */ {22,146},
+/* 22407 */ {22,146},
+/* 22408 */ {22,146},
+/* 22409 */ {22,146},
+/* 22410 */ {22,146},
+/* 22411 */ {22,146},
+/* 22412 */ {22,146},
+/* 22413 */ {22,146},
+/* 22414 */ {22,146},
+/* 22415 */ {22,146},
+/* 22416 */ {22,146},
+/* 22417 */ {22,146},
+/* 22418 */ {22,146},
+/* 22419 */ {22,146},
+/* 22420 */ {22,146},
+/* 22421 */ {22,146},
+/* 22422 */ {22,146},
+/* 22423 */ {22,146},
+/* 22424 */ {22,146},
+/* 22425 */ {22,146},
+/* 22426 */ {22,146},
+/* 22427 */ {22,146},
+/* 22428 */ {22,146},
+/* 22429 */ {22,146},
+/* 22430 */ {22,146},
+/* 22431 */ {22,146},
+/* 22432 */ {22,146},
+/* 22433 */ {22,146},
+/* 22434 */ {22,146},
+/* 22435 */ {22,146},
+/* 22436 */ {22,146},
+/* 22437 */ {22,146},
+/* 22438 */ {22,146},
+/* 22439 */ {22,146},
+/* 22440 */ {22,146},
+/* 22441 */ {22,146},
+/* 22442 */ {22,146},
+/* 22443 */ {22,146},
+/* 22444 */ {22,146},
+/* 22445 */ {22,146},
+/* 22446 */ {22,146},
+/* 22447 */ {22,146},
+/* 22448 */ {22,146},
+/* 22449 */ {22,146},
+/* 22450 */ {22,146},
+/* 22451 */ {22,146},
+/* 22452 */ {22,146},
+/* 22453 */ {22,146},
+/* 22454 */ {22,146},
+/* 22455 */ {22,146},
+/* 22456 */ {22,146},
+/* 22457 */ {22,146},
+/* 22458 */ {22,146},
+/* 22459 */ {22,146},
+/* 22460 */ {22,146},
+/* 22461 */ {22,146},
+/* 22462 */ {22,146},
+/* 22463 */ {22,146},
+/* 22464 */ {22,146},
+/* 22465 */ {22,146},
+/* 22466 */ {22,146},
+/* 22467 */ {22,146},
+/* 22468 */ {22,146},
+/* 22469 */ {22,146},
+/* 22470 */ {22,146},
+/* 22471 */ {22,146},
+/* 22472 */ {22,146},
+/* 22473 */ {22,146},
+/* 22474 */ {22,146},
+/* 22475 */ {22,146},
+/* 22476 */ {22,146},
+/* 22477 */ {22,146},
+/* 22478 */ {22,146},
+/* 22479 */ {22,146},
+/* 22480 */ {22,146},
+/* 22481 */ {22,146},
+/* 22482 */ {22,146},
+/* 22483 */ {22,146},
+/* 22484 */ {22,146},
+/* 22485 */ {22,146},
+/* 22486 */ {22,146},
+/* 22487 */ {22,146},
+/* 22488 */ {22,146},
+/* 22489 */ {22,146},
+/* 22490 */ {22,146},
+/* 22491 */ {22,146},
+/* 22492 */ {22,146},
+/* 22493 */ {22,146},
+/* 22494 */ {22,146},
+/* 22495 */ {22,146},
+/* 22496 */ {22,146},
+/* 22497 */ {22,146},
+/* 22498 */ {22,146},
+/* 22499 */ {22,146},
+/* 22500 */ {22,146},
+/* 22501 */ {22,146},
+/* 22502 */ {22,146},
+/* 22503 */ {22,146},
+/* 22504 */ {22,146},
+/* 22505 */ {22,146},
+/* 22506 */ {22,146},
+/* 22507 */ {22,146},
+/* 22508 */ {22,146},
+/* 22509 */ {22,146},
+/* 22510 */ {22,146},
+/* 22511 */ {22,146},
+/* 22512 */ {22,146},
+/* 22513 */ {22,146},
+/* 22514 */ {22,146},
+/* 22515 */ {22,146},
+/* 22516 */ {22,146},
+/* 22517 */ {22,146},
+/* 22518 */ {22,146},
+/* 22519 */ {22,146},
+/* 22520 */ {22,146},
+/* 22521 */ {22,146},
+/* 22522 */ {22,146},
+/* 22523 */ {22,146},
+/* 22524 */ {22,146},
+/* 22525 */ {22,146},
+/* 22526 */ {22,146},
+/* 22527 */ {22,146},
+/* 22528 */ {22,154},
+/* 22529 */ {22,154},
+/* 22530 */ {22,154},
+/* 22531 */ {22,154},
+/* 22532 */ {22,154},
+/* 22533 */ {22,154},
+/* 22534 */ {22,154},
+/* 22535 */ {22,154},
+/* 22536 */ {22,154},
+/* 22537 */ {22,154},
+/* 22538 */ {22,154},
+/* 22539 */ {22,154},
+/* 22540 */ {22,154},
+/* 22541 */ {22,154},
+/* 22542 */ {22,154},
+/* 22543 */ {22,154},
+/* 22544 */ {22,154},
+/* 22545 */ {22,154},
+/* 22546 */ {22,154},
+/* 22547 */ {22,154},
+/* 22548 */ {22,154},
+/* 22549 */ {22,154},
+/* 22550 */ {22,154},
+/* 22551 */ {22,154},
+/* 22552 */ {22,154},
+/* 22553 */ {22,154},
+/* 22554 */ {22,154},
+/* 22555 */ {22,154},
+/* 22556 */ {22,154},
+/* 22557 */ {22,154},
+/* 22558 */ {22,154},
+/* 22559 */ {22,154},
+/* 22560 */ {22,154},
+/* 22561 */ {22,154},
+/* 22562 */ {22,154},
+/* 22563 */ {22,154},
+/* 22564 */ {22,154},
+/* 22565 */ {22,154},
+/* 22566 */ {22,154},
+/* 22567 */ {22,154},
+/* 22568 */ {22,154},
+/* 22569 */ {22,154},
+/* 22570 */ {22,154},
+/* 22571 */ {22,154},
+/* 22572 */ {22,154},
+/* 22573 */ {22,154},
+/* 22574 */ {22,154},
+/* 22575 */ {22,154},
+/* 22576 */ {22,154},
+/* 22577 */ {22,154},
+/* 22578 */ {22,154},
+/* 22579 */ {22,154},
+/* 22580 */ {22,154},
+/* 22581 */ {22,154},
+/* 22582 */ {22,154},
+/* 22583 */ {22,154},
+/* 22584 */ {22,154},
+/* 22585 */ {22,154},
+/* 22586 */ {22,154},
+/* 22587 */ {22,154},
+/* 22588 */ {22,154},
+/* 22589 */ {22,154},
+/* 22590 */ {22,154},
+/* 22591 */ {22,154},
+/* 22592 */ {22,154},
+/* 22593 */ {22,154},
+/* 22594 */ {22,154},
+/* 22595 */ {22,154},
+/* 22596 */ {22,154},
+/* 22597 */ {22,154},
+/* 22598 */ {22,154},
+/* 22599 */ {22,154},
+/* 22600 */ {22,154},
+/* 22601 */ {22,154},
+/* 22602 */ {22,154},
+/* 22603 */ {22,154},
+/* 22604 */ {22,154},
+/* 22605 */ {22,154},
+/* 22606 */ {22,154},
+/* 22607 */ {22,154},
+/* 22608 */ {22,154},
+/* 22609 */ {22,154},
+/* 22610 */ {22,154},
+/* 22611 */ {22,154},
+/* 22612 */ {22,154},
+/* 22613 */ {22,154},
+/* 22614 */ {22,154},
+/* 22615 */ {22,154},
+/* 22616 */ {22,154},
+/* 22617 */ {22,154},
+/* 22618 */ {22,154},
+/* 22619 */ {22,154},
+/* 22620 */ {22,154},
+/* 22621 */ {22,154},
+/* 22622 */ {22,154},
+/* 22623 */ {22,154},
+/* 22624 */ {22,154},
+/* 22625 */ {22,154},
+/* 22626 */ {22,154},
+/* 22627 */ {22,154},
+/* 22628 */ {22,154},
+/* 22629 */ {22,154},
+/* 22630 */ {22,154},
+/* 22631 */ {22,154},
+/* 22632 */ {22,154},
+/* 22633 */ {22,154},
+/* 22634 */ {22,154},
+/* 22635 */ {22,154},
+/* 22636 */ {22,154},
+/* 22637 */ {22,154},
+/* 22638 */ {22,154},
+/* 22639 */ {22,154},
+/* 22640 */ {22,154},
+/* 22641 */ {22,154},
+/* 22642 */ {22,154},
+/* 22643 */ {22,154},
+/* 22644 */ {22,154},
+/* 22645 */ {22,154},
+/* 22646 */ {22,154},
+/* 22647 */ {22,154},
+/* 22648 */ {22,154},
+/* 22649 */ {22,154},
+/* 22650 */ {22,154},
+/* 22651 */ {22,154},
+/* 22652 */ {22,154},
+/* 22653 */ {22,154},
+/* 22654 */ {22,154},
+/* 22655 */ {22,154},
+/* 22656 */ {22,154},
+/* 22657 */ {22,154},
+/* 22658 */ {22,154},
+/* 22659 */ {22,154},
+/* 22660 */ {22,154},
+/* 22661 */ {22,154},
+/* 22662 */ {22,154},
+/* 22663 */ {22,154},
+/* 22664 */ {22,154},
+/* 22665 */ {22,154},
+/* 22666 */ {22,154},
+/* 22667 */ {22,154},
+/* 22668 */ {22,154},
+/* 22669 */ {22,154},
+/* 22670 */ {22,154},
+/* 22671 */ {22,154},
+/* 22672 */ {22,154},
+/* 22673 */ {22,154},
+/* 22674 */ {22,154},
+/* 22675 */ {22,154},
+/* 22676 */ {22,154},
+/* 22677 */ {22,154},
+/* 22678 */ {22,154},
+/* 22679 */ {22,154},
+/* 22680 */ {22,154},
+/* 22681 */ {22,154},
+/* 22682 */ {22,154},
+/* 22683 */ {22,154},
+/* 22684 */ {22,154},
+/* 22685 */ {22,154},
+/* 22686 */ {22,154},
+/* 22687 */ {22,154},
+/* 22688 */ {22,154},
+/* 22689 */ {22,154},
+/* 22690 */ {22,154},
+/* 22691 */ {22,154},
+/* 22692 */ {22,154},
+/* 22693 */ {22,154},
+/* 22694 */ {22,154},
+/* 22695 */ {22,154},
+/* 22696 */ {22,154},
+/* 22697 */ {22,154},
+/* 22698 */ {22,154},
+/* 22699 */ {22,154},
+/* 22700 */ {22,154},
+/* 22701 */ {22,154},
+/* 22702 */ {22,154},
+/* 22703 */ {22,154},
+/* 22704 */ {22,154},
+/* 22705 */ {22,154},
+/* 22706 */ {22,154},
+/* 22707 */ {22,154},
+/* 22708 */ {22,154},
+/* 22709 */ {22,154},
+/* 22710 */ {22,154},
+/* 22711 */ {22,154},
+/* 22712 */ {22,154},
+/* 22713 */ {22,154},
+/* 22714 */ {22,154},
+/* 22715 */ {22,154},
+/* 22716 */ {22,154},
+/* 22717 */ {22,154},
+/* 22718 */ {22,154},
+/* 22719 */ {22,154},
+/* 22720 */ {22,154},
+/* 22721 */ {22,154},
+/* 22722 */ {22,154},
+/* 22723 */ {22,154},
+/* 22724 */ {22,154},
+/* 22725 */ {22,154},
+/* 22726 */ {22,154},
+/* 22727 */ {22,154},
+/* 22728 */ {22,154},
+/* 22729 */ {22,154},
+/* 22730 */ {22,154},
+/* 22731 */ {22,154},
+/* 22732 */ {22,154},
+/* 22733 */ {22,154},
+/* 22734 */ {22,154},
+/* 22735 */ {22,154},
+/* 22736 */ {22,154},
+/* 22737 */ {22,154},
+/* 22738 */ {22,154},
+/* 22739 */ {22,154},
+/* 22740 */ {22,154},
+/* 22741 */ {22,154},
+/* 22742 */ {22,154},
+/* 22743 */ {22,154},
+/* 22744 */ {22,154},
+/* 22745 */ {22,154},
+/* 22746 */ {22,154},
+/* 22747 */ {22,154},
+/* 22748 */ {22,154},
+/* 22749 */ {22,154},
+/* 22750 */ {22,154},
+/* 22751 */ {22,154},
+/* 22752 */ {22,154},
+/* 22753 */ {22,154},
+/* 22754 */ {22,154},
+/* 22755 */ {22,154},
+/* 22756 */ {22,154},
+/* 22757 */ {22,154},
+/* 22758 */ {22,154},
+/* 22759 */ {22,154},
+/* 22760 */ {22,154},
+/* 22761 */ {22,154},
+/* 22762 */ {22,154},
+/* 22763 */ {22,154},
+/* 22764 */ {22,154},
+/* 22765 */ {22,154},
+/* 22766 */ {22,154},
+/* 22767 */ {22,154},
+/* 22768 */ {22,154},
+/* 22769 */ {22,154},
+/* 22770 */ {22,154},
+/* 22771 */ {22,154},
+/* 22772 */ {22,154},
+/* 22773 */ {22,154},
+/* 22774 */ {22,154},
+/* 22775 */ {22,154},
+/* 22776 */ {22,154},
+/* 22777 */ {22,154},
+/* 22778 */ {22,154},
+/* 22779 */ {22,154},
+/* 22780 */ {22,154},
+/* 22781 */ {22,154},
+/* 22782 */ {22,154},
+/* 22783 */ {22,154},
+/* 22784 */ {22,156},
+/* 22785 */ {22,156},
+/* 22786 */ {22,156},
+/* 22787 */ {22,156},
+/* 22788 */ {22,156},
+/* 22789 */ {22,156},
+/* 22790 */ {22,156},
+/* 22791 */ {22,156},
+/* 22792 */ {22,156},
+/* 22793 */ {22,156},
+/* 22794 */ {22,156},
+/* 22795 */ {22,156},
+/* 22796 */ {22,156},
+/* 22797 */ {22,156},
+/* 22798 */ {22,156},
+/* 22799 */ {22,156},
+/* 22800 */ {22,156},
+/* 22801 */ {22,156},
+/* 22802 */ {22,156},
+/* 22803 */ {22,156},
+/* 22804 */ {22,156},
+/* 22805 */ {22,156},
+/* 22806 */ {22,156},
+/* 22807 */ {22,156},
+/* 22808 */ {22,156},
+/* 22809 */ {22,156},
+/* 22810 */ {22,156},
+/* 22811 */ {22,156},
+/* 22812 */ {22,156},
+/* 22813 */ {22,156},
+/* 22814 */ {22,156},
+/* 22815 */ {22,156},
+/* 22816 */ {22,156},
+/* 22817 */ {22,156},
+/* 22818 */ {22,156},
+/* 22819 */ {22,156},
+/* 22820 */ {22,156},
+/* 22821 */ {22,156},
+/* 22822 */ {22,156},
+/* 22823 */ {22,156},
+/* 22824 */ {22,156},
+/* 22825 */ {22,156},
+/* 22826 */ {22,156},
+/* 22827 */ {22,156},
+/* 22828 */ {22,156},
+/* 22829 */ {22,156},
+/* 22830 */ {22,156},
+/* 22831 */ {22,156},
+/* 22832 */ {22,156},
+/* 22833 */ {22,156},
+/* 22834 */ {22,156},
+/* 22835 */ {22,156},
+/* 22836 */ {22,156},
+/* 22837 */ {22,156},
+/* 22838 */ {22,156},
+/* 22839 */ {22,156},
+/* 22840 */ {22,156},
+/* 22841 */ {22,156},
+/* 22842 */ {22,156},
+/* 22843 */ {22,156},
+/* 22844 */ {22,156},
+/* 22845 */ {22,156},
+/* 22846 */ {22,156},
+/* 22847 */ {22,156},
+/* 22848 */ {22,156},
+/* 22849 */ {22,156},
+/* 22850 */ {22,156},
+/* 22851 */ {22,156},
+/* 22852 */ {22,156},
+/* 22853 */ {22,156},
+/* 22854 */ {22,156},
+/* 22855 */ {22,156},
+/* 22856 */ {22,156},
+/* 22857 */ {22,156},
+/* 22858 */ {22,156},
+/* 22859 */ {22,156},
+/* 22860 */ {22,156},
+/* 22861 */ {22,156},
+/* 22862 */ {22,156},
+/* 22863 */ {22,156},
+/* 22864 */ {22,156},
+/* 22865 */ {22,156},
+/* 22866 */ {22,156},
+/* 22867 */ {22,156},
+/* 22868 */ {22,156},
+/* 22869 */ {22,156},
+/* 22870 */ {22,156},
+/* 22871 */ {22,156},
+/* 22872 */ {22,156},
+/* 22873 */ {22,156},
+/* 22874 */ {22,156},
+/* 22875 */ {22,156},
+/* 22876 */ {22,156},
+/* 22877 */ {22,156},
+/* 22878 */ {22,156},
+/* 22879 */ {22,156},
+/* 22880 */ {22,156},
+/* 22881 */ {22,156},
+/* 22882 */ {22,156},
+/* 22883 */ {22,156},
+/* 22884 */ {22,156},
+/* 22885 */ {22,156},
+/* 22886 */ {22,156},
+/* 22887 */ {22,156},
+/* 22888 */ {22,156},
+/* 22889 */ {22,156},
+/* 22890 */ {22,156},
+/* 22891 */ {22,156},
+/* 22892 */ {22,156},
+/* 22893 */ {22,156},
+/* 22894 */ {22,156},
+/* 22895 */ {22,156},
+/* 22896 */ {22,156},
+/* 22897 */ {22,156},
+/* 22898 */ {22,156},
+/* 22899 */ {22,156},
+/* 22900 */ {22,156},
+/* 22901 */ {22,156},
+/* 22902 */ {22,156},
+/* 22903 */ {22,156},
+/* 22904 */ {22,156},
+/* 22905 */ {22,156},
+/* 22906 */ {22,156},
+/* 22907 */ {22,156},
+/* 22908 */ {22,156},
+/* 22909 */ {22,156},
+/* 22910 */ {22,156},
+/* 22911 */ {22,156},
+/* 22912 */ {22,156},
+/* 22913 */ {22,156},
+/* 22914 */ {22,156},
+/* 22915 */ {22,156},
+/* 22916 */ {22,156},
+/* 22917 */ {22,156},
+/* 22918 */ {22,156},
+/* 22919 */ {22,156},
+/* 22920 */ {22,156},
+/* 22921 */ {22,156},
+/* 22922 */ {22,156},
+/* 22923 */ {22,156},
+/* 22924 */ {22,156},
+/* 22925 */ {22,156},
+/* 22926 */ {22,156},
+/* 22927 */ {22,156},
+/* 22928 */ {22,156},
+/* 22929 */ {22,156},
+/* 22930 */ {22,156},
+/* 22931 */ {22,156},
+/* 22932 */ {22,156},
+/* 22933 */ {22,156},
+/* 22934 */ {22,156},
+/* 22935 */ {22,156},
+/* 22936 */ {22,156},
+/* 22937 */ {22,156},
+/* 22938 */ {22,156},
+/* 22939 */ {22,156},
+/* 22940 */ {22,156},
+/* 22941 */ {22,156},
+/* 22942 */ {22,156},
+/* 22943 */ {22,156},
+/* 22944 */ {22,156},
+/* 22945 */ {22,156},
+/* 22946 */ {22,156},
+/* 22947 */ {22,156},
+/* 22948 */ {22,156},
+/* 22949 */ {22,156},
+/* 22950 */ {22,156},
+/* 22951 */ {22,156},
+/* 22952 */ {22,156},
+/* 22953 */ {22,156},
+/* 22954 */ {22,156},
+/* 22955 */ {22,156},
+/* 22956 */ {22,156},
+/* 22957 */ {22,156},
+/* 22958 */ {22,156},
+/* 22959 */ {22,156},
+/* 22960 */ {22,156},
+/* 22961 */ {22,156},
+/* 22962 */ {22,156},
+/* 22963 */ {22,156},
+/* 22964 */ {22,156},
+/* 22965 */ {22,156},
+/* 22966 */ {22,156},
+/* 22967 */ {22,156},
+/* 22968 */ {22,156},
+/* 22969 */ {22,156},
+/* 22970 */ {22,156},
+/* 22971 */ {22,156},
+/* 22972 */ {22,156},
+/* 22973 */ {22,156},
+/* 22974 */ {22,156},
+/* 22975 */ {22,156},
+/* 22976 */ {22,156},
+/* 22977 */ {22,156},
+/* 22978 */ {22,156},
+/* 22979 */ {22,156},
+/* 22980 */ {22,156},
+/* 22981 */ {22,156},
+/* 22982 */ {22,156},
+/* 22983 */ {22,156},
+/* 22984 */ {22,156},
+/* 22985 */ {22,156},
+/* 22986 */ {22,156},
+/* 22987 */ {22,156},
+/* 22988 */ {22,156},
+/* 22989 */ {22,156},
+/* 22990 */ {22,156},
+/* 22991 */ {22,156},
+/* 22992 */ {22,156},
+/* 22993 */ {22,156},
+/* 22994 */ {22,156},
+/* 22995 */ {22,156},
+/* 22996 */ {22,156},
+/* 22997 */ {22,156},
+/* 22998 */ {22,156},
+/* 22999 */ {22,156},
+/* 23000 */ {22,156},
+/* 23001 */ {22,156},
+/* 23002 */ {22,156},
+/* 23003 */ {22,156},
+/* 23004 */ {22,156},
+/* 23005 */ {22,156},
+/* 23006 */ {22,156},
+/* 23007 */ {22,156},
+/* 23008 */ {22,156},
+/* 23009 */ {22,156},
+/* 23010 */ {22,156},
+/* 23011 */ {22,156},
+/* 23012 */ {22,156},
+/* 23013 */ {22,156},
+/* 23014 */ {22,156},
+/* 23015 */ {22,156},
+/* 23016 */ {22,156},
+/* 23017 */ {22,156},
+/* 23018 */ {22,156},
+/* 23019 */ {22,156},
+/* 23020 */ {22,156},
+/* 23021 */ {22,156},
+/* 23022 */ {22,156},
+/* 23023 */ {22,156},
+/* 23024 */ {22,156},
+/* 23025 */ {22,156},
+/* 23026 */ {22,156},
+/* 23027 */ {22,156},
+/* 23028 */ {22,156},
+/* 23029 */ {22,156},
+/* 23030 */ {22,156},
+/* 23031 */ {22,156},
+/* 23032 */ {22,156},
+/* 23033 */ {22,156},
+/* 23034 */ {22,156},
+/* 23035 */ {22,156},
+/* 23036 */ {22,156},
+/* 23037 */ {22,156},
+/* 23038 */ {22,156},
+/* 23039 */ {22,156},
+/* 23040 */ {22,160},
+/* 23041 */ {22,160},
+/* 23042 */ {22,160},
+/* 23043 */ {22,160},
+/* 23044 */ {22,160},
+/* 23045 */ {22,160},
+/* 23046 */ {22,160},
+/* 23047 */ {22,160},
+/* 23048 */ {22,160},
+/* 23049 */ {22,160},
+/* 23050 */ {22,160},
+/* 23051 */ {22,160},
+/* 23052 */ {22,160},
+/* 23053 */ {22,160},
+/* 23054 */ {22,160},
+/* 23055 */ {22,160},
+/* 23056 */ {22,160},
+/* 23057 */ {22,160},
+/* 23058 */ {22,160},
+/* 23059 */ {22,160},
+/* 23060 */ {22,160},
+/* 23061 */ {22,160},
+/* 23062 */ {22,160},
+/* 23063 */ {22,160},
+/* 23064 */ {22,160},
+/* 23065 */ {22,160},
+/* 23066 */ {22,160},
+/* 23067 */ {22,160},
+/* 23068 */ {22,160},
+/* 23069 */ {22,160},
+/* 23070 */ {22,160},
+/* 23071 */ {22,160},
+/* 23072 */ {22,160},
+/* 23073 */ {22,160},
+/* 23074 */ {22,160},
+/* 23075 */ {22,160},
+/* 23076 */ {22,160},
+/* 23077 */ {22,160},
+/* 23078 */ {22,160},
+/* 23079 */ {22,160},
+/* 23080 */ {22,160},
+/* 23081 */ {22,160},
+/* 23082 */ {22,160},
+/* 23083 */ {22,160},
+/* 23084 */ {22,160},
+/* 23085 */ {22,160},
+/* 23086 */ {22,160},
+/* 23087 */ {22,160},
+/* 23088 */ {22,160},
+/* 23089 */ {22,160},
+/* 23090 */ {22,160},
+/* 23091 */ {22,160},
+/* 23092 */ {22,160},
+/* 23093 */ {22,160},
+/* 23094 */ {22,160},
+/* 23095 */ {22,160},
+/* 23096 */ {22,160},
+/* 23097 */ {22,160},
+/* 23098 */ {22,160},
+/* 23099 */ {22,160},
+/* 23100 */ {22,160},
+/* 23101 */ {22,160},
+/* 23102 */ {22,160},
+/* 23103 */ {22,160},
+/* 23104 */ {22,160},
+/* 23105 */ {22,160},
+/* 23106 */ {22,160},
+/* 23107 */ {22,160},
+/* 23108 */ {22,160},
+/* 23109 */ {22,160},
+/* 23110 */ {22,160},
+/* 23111 */ {22,160},
+/* 23112 */ {22,160},
+/* 23113 */ {22,160},
+/* 23114 */ {22,160},
+/* 23115 */ {22,160},
+/* 23116 */ {22,160},
+/* 23117 */ {22,160},
+/* 23118 */ {22,160},
+/* 23119 */ {22,160},
+/* 23120 */ {22,160},
+/* 23121 */ {22,160},
+/* 23122 */ {22,160},
+/* 23123 */ {22,160},
+/* 23124 */ {22,160},
+/* 23125 */ {22,160},
+/* 23126 */ {22,160},
+/* 23127 */ {22,160},
+/* 23128 */ {22,160},
+/* 23129 */ {22,160},
+/* 23130 */ {22,160},
+/* 23131 */ {22,160},
+/* 23132 */ {22,160},
+/* 23133 */ {22,160},
+/* 23134 */ {22,160},
+/* 23135 */ {22,160},
+/* 23136 */ {22,160},
+/* 23137 */ {22,160},
+/* 23138 */ {22,160},
+/* 23139 */ {22,160},
+/* 23140 */ {22,160},
+/* 23141 */ {22,160},
+/* 23142 */ {22,160},
+/* 23143 */ {22,160},
+/* 23144 */ {22,160},
+/* 23145 */ {22,160},
+/* 23146 */ {22,160},
+/* 23147 */ {22,160},
+/* 23148 */ {22,160},
+/* 23149 */ {22,160},
+/* 23150 */ {22,160},
+/* 23151 */ {22,160},
+/* 23152 */ {22,160},
+/* 23153 */ {22,160},
+/* 23154 */ {22,160},
+/* 23155 */ {22,160},
+/* 23156 */ {22,160},
+/* 23157 */ {22,160},
+/* 23158 */ {22,160},
+/* 23159 */ {22,160},
+/* 23160 */ {22,160},
+/* 23161 */ {22,160},
+/* 23162 */ {22,160},
+/* 23163 */ {22,160},
+/* 23164 */ {22,160},
+/* 23165 */ {22,160},
+/* 23166 */ {22,160},
+/* 23167 */ {22,160},
+/* 23168 */ {22,160},
+/* 23169 */ {22,160},
+/* 23170 */ {22,160},
+/* 23171 */ {22,160},
+/* 23172 */ {22,160},
+/* 23173 */ {22,160},
+/* 23174 */ {22,160},
+/* 23175 */ {22,160},
+/* 23176 */ {22,160},
+/* 23177 */ {22,160},
+/* 23178 */ {22,160},
+/* 23179 */ {22,160},
+/* 23180 */ {22,160},
+/* 23181 */ {22,160},
+/* 23182 */ {22,160},
+/* 23183 */ {22,160},
+/* 23184 */ {22,160},
+/* 23185 */ {22,160},
+/* 23186 */ {22,160},
+/* 23187 */ {22,160},
+/* 23188 */ {22,160},
+/* 23189 */ {22,160},
+/* 23190 */ {22,160},
+/* 23191 */ {22,160},
+/* 23192 */ {22,160},
+/* 23193 */ {22,160},
+/* 23194 */ {22,160},
+/* 23195 */ {22,160},
+/* 23196 */ {22,160},
+/* 23197 */ {22,160},
+/* 23198 */ {22,160},
+/* 23199 */ {22,160},
+/* 23200 */ {22,160},
+/* 23201 */ {22,160},
+/* 23202 */ {22,160},
+/* 23203 */ {22,160},
+/* 23204 */ {22,160},
+/* 23205 */ {22,160},
+/* 23206 */ {22,160},
+/* 23207 */ {22,160},
+/* 23208 */ {22,160},
+/* 23209 */ {22,160},
+/* 23210 */ {22,160},
+/* 23211 */ {22,160},
+/* 23212 */ {22,160},
+/* 23213 */ {22,160},
+/* 23214 */ {22,160},
+/* 23215 */ {22,160},
+/* 23216 */ {22,160},
+/* 23217 */ {22,160},
+/* 23218 */ {22,160},
+/* 23219 */ {22,160},
+/* 23220 */ {22,160},
+/* 23221 */ {22,160},
+/* 23222 */ {22,160},
+/* 23223 */ {22,160},
+/* 23224 */ {22,160},
+/* 23225 */ {22,160},
+/* 23226 */ {22,160},
+/* 23227 */ {22,160},
+/* 23228 */ {22,160},
+/* 23229 */ {22,160},
+/* 23230 */ {22,160},
+/* 23231 */ {22,160},
+/* 23232 */ {22,160},
+/* 23233 */ {22,160},
+/* 23234 */ {22,160},
+/* 23235 */ {22,160},
+/* 23236 */ {22,160},
+/* 23237 */ {22,160},
+/* 23238 */ {22,160},
+/* 23239 */ {22,160},
+/* 23240 */ {22,160},
+/* 23241 */ {22,160},
+/* 23242 */ {22,160},
+/* 23243 */ {22,160},
+/* 23244 */ {22,160},
+/* 23245 */ {22,160},
+/* 23246 */ {22,160},
+/* 23247 */ {22,160},
+/* 23248 */ {22,160},
+/* 23249 */ {22,160},
+/* 23250 */ {22,160},
+/* 23251 */ {22,160},
+/* 23252 */ {22,160},
+/* 23253 */ {22,160},
+/* 23254 */ {22,160},
+/* 23255 */ {22,160},
+/* 23256 */ {22,160},
+/* 23257 */ {22,160},
+/* 23258 */ {22,160},
+/* 23259 */ {22,160},
+/* 23260 */ {22,160},
+/* 23261 */ {22,160},
+/* 23262 */ {22,160},
+/* 23263 */ {22,160},
+/* 23264 */ {22,160},
+/* 23265 */ {22,160},
+/* 23266 */ {22,160},
+/* 23267 */ {22,160},
+/* 23268 */ {22,160},
+/* 23269 */ {22,160},
+/* 23270 */ {22,160},
+/* 23271 */ {22,160},
+/* 23272 */ {22,160},
+/* 23273 */ {22,160},
+/* 23274 */ {22,160},
+/* 23275 */ {22,160},
+/* 23276 */ {22,160},
+/* 23277 */ {22,160},
+/* 23278 */ {22,160},
+/* 23279 */ {22,160},
+/* 23280 */ {22,160},
+/* 23281 */ {22,160},
+/* 23282 */ {22,160},
+/* 23283 */ {22,160},
+/* 23284 */ {22,160},
+/* 23285 */ {22,160},
+/* 23286 */ {22,160},
+/* 23287 */ {22,160},
+/* 23288 */ {22,160},
+/* 23289 */ {22,160},
+/* 23290 */ {22,160},
+/* 23291 */ {22,160},
+/* 23292 */ {22,160},
+/* 23293 */ {22,160},
+/* 23294 */ {22,160},
+/* 23295 */ {22,160},
+/* 23296 */ {22,163},
+/* 23297 */ {22,163},
+/* 23298 */ {22,163},
+/* 23299 */ {22,163},
+/* 23300 */ {22,163},
+/* 23301 */ {22,163},
+/* 23302 */ {22,163},
+/* 23303 */ {22,163},
+/* 23304 */ {22,163},
+/* 23305 */ {22,163},
+/* 23306 */ {22,163},
+/* 23307 */ {22,163},
+/* 23308 */ {22,163},
+/* 23309 */ {22,163},
+/* 23310 */ {22,163},
+/* 23311 */ {22,163},
+/* 23312 */ {22,163},
+/* 23313 */ {22,163},
+/* 23314 */ {22,163},
+/* 23315 */ {22,163},
+/* 23316 */ {22,163},
+/* 23317 */ {22,163},
+/* 23318 */ {22,163},
+/* 23319 */ {22,163},
+/* 23320 */ {22,163},
+/* 23321 */ {22,163},
+/* 23322 */ {22,163},
+/* 23323 */ {22,163},
+/* 23324 */ {22,163},
+/* 23325 */ {22,163},
+/* 23326 */ {22,163},
+/* 23327 */ {22,163},
+/* 23328 */ {22,163},
+/* 23329 */ {22,163},
+/* 23330 */ {22,163},
+/* 23331 */ {22,163},
+/* 23332 */ {22,163},
+/* 23333 */ {22,163},
+/* 23334 */ {22,163},
+/* 23335 */ {22,163},
+/* 23336 */ {22,163},
+/* 23337 */ {22,163},
+/* 23338 */ {22,163},
+/* 23339 */ {22,163},
+/* 23340 */ {22,163},
+/* 23341 */ {22,163},
+/* 23342 */ {22,163},
+/* 23343 */ {22,163},
+/* 23344 */ {22,163},
+/* 23345 */ {22,163},
+/* 23346 */ {22,163},
+/* 23347 */ {22,163},
+/* 23348 */ {22,163},
+/* 23349 */ {22,163},
+/* 23350 */ {22,163},
+/* 23351 */ {22,163},
+/* 23352 */ {22,163},
+/* 23353 */ {22,163},
+/* 23354 */ {22,163},
+/* 23355 */ {22,163},
+/* 23356 */ {22,163},
+/* 23357 */ {22,163},
+/* 23358 */ {22,163},
+/* 23359 */ {22,163},
+/* 23360 */ {22,163},
+/* 23361 */ {22,163},
+/* 23362 */ {22,163},
+/* 23363 */ {22,163},
+/* 23364 */ {22,163},
+/* 23365 */ {22,163},
+/* 23366 */ {22,163},
+/* 23367 */ {22,163},
+/* 23368 */ {22,163},
+/* 23369 */ {22,163},
+/* 23370 */ {22,163},
+/* 23371 */ {22,163},
+/* 23372 */ {22,163},
+/* 23373 */ {22,163},
+/* 23374 */ {22,163},
+/* 23375 */ {22,163},
+/* 23376 */ {22,163},
+/* 23377 */ {22,163},
+/* 23378 */ {22,163},
+/* 23379 */ {22,163},
+/* 23380 */ {22,163},
+/* 23381 */ {22,163},
+/* 23382 */ {22,163},
+/* 23383 */ {22,163},
+/* 23384 */ {22,163},
+/* 23385 */ {22,163},
+/* 23386 */ {22,163},
+/* 23387 */ {22,163},
+/* 23388 */ {22,163},
+/* 23389 */ {22,163},
+/* 23390 */ {22,163},
+/* 23391 */ {22,163},
+/* 23392 */ {22,163},
+/* 23393 */ {22,163},
+/* 23394 */ {22,163},
+/* 23395 */ {22,163},
+/* 23396 */ {22,163},
+/* 23397 */ {22,163},
+/* 23398 */ {22,163},
+/* 23399 */ {22,163},
+/* 23400 */ {22,163},
+/* 23401 */ {22,163},
+/* 23402 */ {22,163},
+/* 23403 */ {22,163},
+/* 23404 */ {22,163},
+/* 23405 */ {22,163},
+/* 23406 */ {22,163},
+/* 23407 */ {22,163},
+/* 23408 */ {22,163},
+/* 23409 */ {22,163},
+/* 23410 */ {22,163},
+/* 23411 */ {22,163},
+/* 23412 */ {22,163},
+/* 23413 */ {22,163},
+/* 23414 */ {22,163},
+/* 23415 */ {22,163},
+/* 23416 */ {22,163},
+/* 23417 */ {22,163},
+/* 23418 */ {22,163},
+/* 23419 */ {22,163},
+/* 23420 */ {22,163},
+/* 23421 */ {22,163},
+/* 23422 */ {22,163},
+/* 23423 */ {22,163},
+/* 23424 */ {22,163},
+/* 23425 */ {22,163},
+/* 23426 */ {22,163},
+/* 23427 */ {22,163},
+/* 23428 */ {22,163},
+/* 23429 */ {22,163},
+/* 23430 */ {22,163},
+/* 23431 */ {22,163},
+/* 23432 */ {22,163},
+/* 23433 */ {22,163},
+/* 23434 */ {22,163},
+/* 23435 */ {22,163},
+/* 23436 */ {22,163},
+/* 23437 */ {22,163},
+/* 23438 */ {22,163},
+/* 23439 */ {22,163},
+/* 23440 */ {22,163},
+/* 23441 */ {22,163},
+/* 23442 */ {22,163},
+/* 23443 */ {22,163},
+/* 23444 */ {22,163},
+/* 23445 */ {22,163},
+/* 23446 */ {22,163},
+/* 23447 */ {22,163},
+/* 23448 */ {22,163},
+/* 23449 */ {22,163},
+/* 23450 */ {22,163},
+/* 23451 */ {22,163},
+/* 23452 */ {22,163},
+/* 23453 */ {22,163},
+/* 23454 */ {22,163},
+/* 23455 */ {22,163},
+/* 23456 */ {22,163},
+/* 23457 */ {22,163},
+/* 23458 */ {22,163},
+/* 23459 */ {22,163},
+/* 23460 */ {22,163},
+/* 23461 */ {22,163},
+/* 23462 */ {22,163},
+/* 23463 */ {22,163},
+/* 23464 */ {22,163},
+/* 23465 */ {22,163},
+/* 23466 */ {22,163},
+/* 23467 */ {22,163},
+/* 23468 */ {22,163},
+/* 23469 */ {22,163},
+/* 23470 */ {22,163},
+/* 23471 */ {22,163},
+/* 23472 */ {22,163},
+/* 23473 */ {22,163},
+/* 23474 */ {22,163},
+/* 23475 */ {22,163},
+/* 23476 */ {22,163},
+/* 23477 */ {22,163},
+/* 23478 */ {22,163},
+/* 23479 */ {22,163},
+/* 23480 */ {22,163},
+/* 23481 */ {22,163},
+/* 23482 */ {22,163},
+/* 23483 */ {22,163},
+/* 23484 */ {22,163},
+/* 23485 */ {22,163},
+/* 23486 */ {22,163},
+/* 23487 */ {22,163},
+/* 23488 */ {22,163},
+/* 23489 */ {22,163},
+/* 23490 */ {22,163},
+/* 23491 */ {22,163},
+/* 23492 */ {22,163},
+/* 23493 */ {22,163},
+/* 23494 */ {22,163},
+/* 23495 */ {22,163},
+/* 23496 */ {22,163},
+/* 23497 */ {22,163},
+/* 23498 */ {22,163},
+/* 23499 */ {22,163},
+/* 23500 */ {22,163},
+/* 23501 */ {22,163},
+/* 23502 */ {22,163},
+/* 23503 */ {22,163},
+/* 23504 */ {22,163},
+/* 23505 */ {22,163},
+/* 23506 */ {22,163},
+/* 23507 */ {22,163},
+/* 23508 */ {22,163},
+/* 23509 */ {22,163},
+/* 23510 */ {22,163},
+/* 23511 */ {22,163},
+/* 23512 */ {22,163},
+/* 23513 */ {22,163},
+/* 23514 */ {22,163},
+/* 23515 */ {22,163},
+/* 23516 */ {22,163},
+/* 23517 */ {22,163},
+/* 23518 */ {22,163},
+/* 23519 */ {22,163},
+/* 23520 */ {22,163},
+/* 23521 */ {22,163},
+/* 23522 */ {22,163},
+/* 23523 */ {22,163},
+/* 23524 */ {22,163},
+/* 23525 */ {22,163},
+/* 23526 */ {22,163},
+/* 23527 */ {22,163},
+/* 23528 */ {22,163},
+/* 23529 */ {22,163},
+/* 23530 */ {22,163},
+/* 23531 */ {22,163},
+/* 23532 */ {22,163},
+/* 23533 */ {22,163},
+/* 23534 */ {22,163},
+/* 23535 */ {22,163},
+/* 23536 */ {22,163},
+/* 23537 */ {22,163},
+/* 23538 */ {22,163},
+/* 23539 */ {22,163},
+/* 23540 */ {22,163},
+/* 23541 */ {22,163},
+/* 23542 */ {22,163},
+/* 23543 */ {22,163},
+/* 23544 */ {22,163},
+/* 23545 */ {22,163},
+/* 23546 */ {22,163},
+/* 23547 */ {22,163},
+/* 23548 */ {22,163},
+/* 23549 */ {22,163},
+/* 23550 */ {22,163},
+/* 23551 */ {22,163},
+/* 23552 */ {22,164},
+/* 23553 */ {22,164},
+/* 23554 */ {22,164},
+/* 23555 */ {22,164},
+/* 23556 */ {22,164},
+/* 23557 */ {22,164},
+/* 23558 */ {22,164},
+/* 23559 */ {22,164},
+/* 23560 */ {22,164},
+/* 23561 */ {22,164},
+/* 23562 */ {22,164},
+/* 23563 */ {22,164},
+/* 23564 */ {22,164},
+/* 23565 */ {22,164},
+/* 23566 */ {22,164},
+/* 23567 */ {22,164},
+/* 23568 */ {22,164},
+/* 23569 */ {22,164},
+/* 23570 */ {22,164},
+/* 23571 */ {22,164},
+/* 23572 */ {22,164},
+/* 23573 */ {22,164},
+/* 23574 */ {22,164},
+/* 23575 */ {22,164},
+/* 23576 */ {22,164},
+/* 23577 */ {22,164},
+/* 23578 */ {22,164},
+/* 23579 */ {22,164},
+/* 23580 */ {22,164},
+/* 23581 */ {22,164},
+/* 23582 */ {22,164},
+/* 23583 */ {22,164},
+/* 23584 */ {22,164},
+/* 23585 */ {22,164},
+/* 23586 */ {22,164},
+/* 23587 */ {22,164},
+/* 23588 */ {22,164},
+/* 23589 */ {22,164},
+/* 23590 */ {22,164},
+/* 23591 */ {22,164},
+/* 23592 */ {22,164},
+/* 23593 */ {22,164},
+/* 23594 */ {22,164},
+/* 23595 */ {22,164},
+/* 23596 */ {22,164},
+/* 23597 */ {22,164},
+/* 23598 */ {22,164},
+/* 23599 */ {22,164},
+/* 23600 */ {22,164},
+/* 23601 */ {22,164},
+/* 23602 */ {22,164},
+/* 23603 */ {22,164},
+/* 23604 */ {22,164},
+/* 23605 */ {22,164},
+/* 23606 */ {22,164},
+/* 23607 */ {22,164},
+/* 23608 */ {22,164},
+/* 23609 */ {22,164},
+/* 23610 */ {22,164},
+/* 23611 */ {22,164},
+/* 23612 */ {22,164},
+/* 23613 */ {22,164},
+/* 23614 */ {22,164},
+/* 23615 */ {22,164},
+/* 23616 */ {22,164},
+/* 23617 */ {22,164},
+/* 23618 */ {22,164},
+/* 23619 */ {22,164},
+/* 23620 */ {22,164},
+/* 23621 */ {22,164},
+/* 23622 */ {22,164},
+/* 23623 */ {22,164},
+/* 23624 */ {22,164},
+/* 23625 */ {22,164},
+/* 23626 */ {22,164},
+/* 23627 */ {22,164},
+/* 23628 */ {22,164},
+/* 23629 */ {22,164},
+/* 23630 */ {22,164},
+/* 23631 */ {22,164},
+/* 23632 */ {22,164},
+/* 23633 */ {22,164},
+/* 23634 */ {22,164},
+/* 23635 */ {22,164},
+/* 23636 */ {22,164},
+/* 23637 */ {22,164},
+/* 23638 */ {22,164},
+/* 23639 */ {22,164},
+/* 23640 */ {22,164},
+/* 23641 */ {22,164},
+/* 23642 */ {22,164},
+/* 23643 */ {22,164},
+/* 23644 */ {22,164},
+/* 23645 */ {22,164},
+/* 23646 */ {22,164},
+/* 23647 */ {22,164},
+/* 23648 */ {22,164},
+/* 23649 */ {22,164},
+/* 23650 */ {22,164},
+/* 23651 */ {22,164},
+/* 23652 */ {22,164},
+/* 23653 */ {22,164},
+/* 23654 */ {22,164},
+/* 23655 */ {22,164},
+/* 23656 */ {22,164},
+/* 23657 */ {22,164},
+/* 23658 */ {22,164},
+/* 23659 */ {22,164},
+/* 23660 */ {22,164},
+/* 23661 */ {22,164},
+/* 23662 */ {22,164},
+/* 23663 */ {22,164},
+/* 23664 */ {22,164},
+/* 23665 */ {22,164},
+/* 23666 */ {22,164},
+/* 23667 */ {22,164},
+/* 23668 */ {22,164},
+/* 23669 */ {22,164},
+/* 23670 */ {22,164},
+/* 23671 */ {22,164},
+/* 23672 */ {22,164},
+/* 23673 */ {22,164},
+/* 23674 */ {22,164},
+/* 23675 */ {22,164},
+/* 23676 */ {22,164},
+/* 23677 */ {22,164},
+/* 23678 */ {22,164},
+/* 23679 */ {22,164},
+/* 23680 */ {22,164},
+/* 23681 */ {22,164},
+/* 23682 */ {22,164},
+/* 23683 */ {22,164},
+/* 23684 */ {22,164},
+/* 23685 */ {22,164},
+/* 23686 */ {22,164},
+/* 23687 */ {22,164},
+/* 23688 */ {22,164},
+/* 23689 */ {22,164},
+/* 23690 */ {22,164},
+/* 23691 */ {22,164},
+/* 23692 */ {22,164},
+/* 23693 */ {22,164},
+/* 23694 */ {22,164},
+/* 23695 */ {22,164},
+/* 23696 */ {22,164},
+/* 23697 */ {22,164},
+/* 23698 */ {22,164},
+/* 23699 */ {22,164},
+/* 23700 */ {22,164},
+/* 23701 */ {22,164},
+/* 23702 */ {22,164},
+/* 23703 */ {22,164},
+/* 23704 */ {22,164},
+/* 23705 */ {22,164},
+/* 23706 */ {22,164},
+/* 23707 */ {22,164},
+/* 23708 */ {22,164},
+/* 23709 */ {22,164},
+/* 23710 */ {22,164},
+/* 23711 */ {22,164},
+/* 23712 */ {22,164},
+/* 23713 */ {22,164},
+/* 23714 */ {22,164},
+/* 23715 */ {22,164},
+/* 23716 */ {22,164},
+/* 23717 */ {22,164},
+/* 23718 */ {22,164},
+/* 23719 */ {22,164},
+/* 23720 */ {22,164},
+/* 23721 */ {22,164},
+/* 23722 */ {22,164},
+/* 23723 */ {22,164},
+/* 23724 */ {22,164},
+/* 23725 */ {22,164},
+/* 23726 */ {22,164},
+/* 23727 */ {22,164},
+/* 23728 */ {22,164},
+/* 23729 */ {22,164},
+/* 23730 */ {22,164},
+/* 23731 */ {22,164},
+/* 23732 */ {22,164},
+/* 23733 */ {22,164},
+/* 23734 */ {22,164},
+/* 23735 */ {22,164},
+/* 23736 */ {22,164},
+/* 23737 */ {22,164},
+/* 23738 */ {22,164},
+/* 23739 */ {22,164},
+/* 23740 */ {22,164},
+/* 23741 */ {22,164},
+/* 23742 */ {22,164},
+/* 23743 */ {22,164},
+/* 23744 */ {22,164},
+/* 23745 */ {22,164},
+/* 23746 */ {22,164},
+/* 23747 */ {22,164},
+/* 23748 */ {22,164},
+/* 23749 */ {22,164},
+/* 23750 */ {22,164},
+/* 23751 */ {22,164},
+/* 23752 */ {22,164},
+/* 23753 */ {22,164},
+/* 23754 */ {22,164},
+/* 23755 */ {22,164},
+/* 23756 */ {22,164},
+/* 23757 */ {22,164},
+/* 23758 */ {22,164},
+/* 23759 */ {22,164},
+/* 23760 */ {22,164},
+/* 23761 */ {22,164},
+/* 23762 */ {22,164},
+/* 23763 */ {22,164},
+/* 23764 */ {22,164},
+/* 23765 */ {22,164},
+/* 23766 */ {22,164},
+/* 23767 */ {22,164},
+/* 23768 */ {22,164},
+/* 23769 */ {22,164},
+/* 23770 */ {22,164},
+/* 23771 */ {22,164},
+/* 23772 */ {22,164},
+/* 23773 */ {22,164},
+/* 23774 */ {22,164},
+/* 23775 */ {22,164},
+/* 23776 */ {22,164},
+/* 23777 */ {22,164},
+/* 23778 */ {22,164},
+/* 23779 */ {22,164},
+/* 23780 */ {22,164},
+/* 23781 */ {22,164},
+/* 23782 */ {22,164},
+/* 23783 */ {22,164},
+/* 23784 */ {22,164},
+/* 23785 */ {22,164},
+/* 23786 */ {22,164},
+/* 23787 */ {22,164},
+/* 23788 */ {22,164},
+/* 23789 */ {22,164},
+/* 23790 */ {22,164},
+/* 23791 */ {22,164},
+/* 23792 */ {22,164},
+/* 23793 */ {22,164},
+/* 23794 */ {22,164},
+/* 23795 */ {22,164},
+/* 23796 */ {22,164},
+/* 23797 */ {22,164},
+/* 23798 */ {22,164},
+/* 23799 */ {22,164},
+/* 23800 */ {22,164},
+/* 23801 */ {22,164},
+/* 23802 */ {22,164},
+/* 23803 */ {22,164},
+/* 23804 */ {22,164},
+/* 23805 */ {22,164},
+/* 23806 */ {22,164},
+/* 23807 */ {22,164},
+/* 23808 */ {22,169},
+/* 23809 */ {22,169},
+/* 23810 */ {22,169},
+/* 23811 */ {22,169},
+/* 23812 */ {22,169},
+/* 23813 */ {22,169},
+/* 23814 */ {22,169},
+/* 23815 */ {22,169},
+/* 23816 */ {22,169},
+/* 23817 */ {22,169},
+/* 23818 */ {22,169},
+/* 23819 */ {22,169},
+/* 23820 */ {22,169},
+/* 23821 */ {22,169},
+/* 23822 */ {22,169},
+/* 23823 */ {22,169},
+/* 23824 */ {22,169},
+/* 23825 */ {22,169},
+/* 23826 */ {22,169},
+/* 23827 */ {22,169},
+/* 23828 */ {22,169},
+/* 23829 */ {22,169},
+/* 23830 */ {22,169},
+/* 23831 */ {22,169},
+/* 23832 */ {22,169},
+/* 23833 */ {22,169},
+/* 23834 */ {22,169},
+/* 23835 */ {22,169},
+/* 23836 */ {22,169},
+/* 23837 */ {22,169},
+/* 23838 */ {22,169},
+/* 23839 */ {22,169},
+/* 23840 */ {22,169},
+/* 23841 */ {22,169},
+/* 23842 */ {22,169},
+/* 23843 */ {22,169},
+/* 23844 */ {22,169},
+/* 23845 */ {22,169},
+/* 23846 */ {22,169},
+/* 23847 */ {22,169},
+/* 23848 */ {22,169},
+/* 23849 */ {22,169},
+/* 23850 */ {22,169},
+/* 23851 */ {22,169},
+/* 23852 */ {22,169},
+/* 23853 */ {22,169},
+/* 23854 */ {22,169},
+/* 23855 */ {22,169},
+/* 23856 */ {22,169},
+/* 23857 */ {22,169},
+/* 23858 */ {22,169},
+/* 23859 */ {22,169},
+/* 23860 */ {22,169},
+/* 23861 */ {22,169},
+/* 23862 */ {22,169},
+/* 23863 */ {22,169},
+/* 23864 */ {22,169},
+/* 23865 */ {22,169},
+/* 23866 */ {22,169},
+/* 23867 */ {22,169},
+/* 23868 */ {22,169},
+/* 23869 */ {22,169},
+/* 23870 */ {22,169},
+/* 23871 */ {22,169},
+/* 23872 */ {22,169},
+/* 23873 */ {22,169},
+/* 23874 */ {22,169},
+/* 23875 */ {22,169},
+/* 23876 */ {22,169},
+/* 23877 */ {22,169},
+/* 23878 */ {22,169},
+/* 23879 */ {22,169},
+/* 23880 */ {22,169},
+/* 23881 */ {22,169},
+/* 23882 */ {22,169},
+/* 23883 */ {22,169},
+/* 23884 */ {22,169},
+/* 23885 */ {22,169},
+/* 23886 */ {22,169},
+/* 23887 */ {22,169},
+/* 23888 */ {22,169},
+/* 23889 */ {22,169},
+/* 23890 */ {22,169},
+/* 23891 */ {22,169},
+/* 23892 */ {22,169},
+/* 23893 */ {22,169},
+/* 23894 */ {22,169},
+/* 23895 */ {22,169},
+/* 23896 */ {22,169},
+/* 23897 */ {22,169},
+/* 23898 */ {22,169},
+/* 23899 */ {22,169},
+/* 23900 */ {22,169},
+/* 23901 */ {22,169},
+/* 23902 */ {22,169},
+/* 23903 */ {22,169},
+/* 23904 */ {22,169},
+/* 23905 */ {22,169},
+/* 23906 */ {22,169},
+/* 23907 */ {22,169},
+/* 23908 */ {22,169},
+/* 23909 */ {22,169},
+/* 23910 */ {22,169},
+/* 23911 */ {22,169},
+/* 23912 */ {22,169},
+/* 23913 */ {22,169},
+/* 23914 */ {22,169},
+/* 23915 */ {22,169},
+/* 23916 */ {22,169},
+/* 23917 */ {22,169},
+/* 23918 */ {22,169},
+/* 23919 */ {22,169},
+/* 23920 */ {22,169},
+/* 23921 */ {22,169},
+/* 23922 */ {22,169},
+/* 23923 */ {22,169},
+/* 23924 */ {22,169},
+/* 23925 */ {22,169},
+/* 23926 */ {22,169},
+/* 23927 */ {22,169},
+/* 23928 */ {22,169},
+/* 23929 */ {22,169},
+/* 23930 */ {22,169},
+/* 23931 */ {22,169},
+/* 23932 */ {22,169},
+/* 23933 */ {22,169},
+/* 23934 */ {22,169},
+/* 23935 */ {22,169},
+/* 23936 */ {22,169},
+/* 23937 */ {22,169},
+/* 23938 */ {22,169},
+/* 23939 */ {22,169},
+/* 23940 */ {22,169},
+/* 23941 */ {22,169},
+/* 23942 */ {22,169},
+/* 23943 */ {22,169},
+/* 23944 */ {22,169},
+/* 23945 */ {22,169},
+/* 23946 */ {22,169},
+/* 23947 */ {22,169},
+/* 23948 */ {22,169},
+/* 23949 */ {22,169},
+/* 23950 */ {22,169},
+/* 23951 */ {22,169},
+/* 23952 */ {22,169},
+/* 23953 */ {22,169},
+/* 23954 */ {22,169},
+/* 23955 */ {22,169},
+/* 23956 */ {22,169},
+/* 23957 */ {22,169},
+/* 23958 */ {22,169},
+/* 23959 */ {22,169},
+/* 23960 */ {22,169},
+/* 23961 */ {22,169},
+/* 23962 */ {22,169},
+/* 23963 */ {22,169},
+/* 23964 */ {22,169},
+/* 23965 */ {22,169},
+/* 23966 */ {22,169},
+/* 23967 */ {22,169},
+/* 23968 */ {22,169},
+/* 23969 */ {22,169},
+/* 23970 */ {22,169},
+/* 23971 */ {22,169},
+/* 23972 */ {22,169},
+/* 23973 */ {22,169},
+/* 23974 */ {22,169},
+/* 23975 */ {22,169},
+/* 23976 */ {22,169},
+/* 23977 */ {22,169},
+/* 23978 */ {22,169},
+/* 23979 */ {22,169},
+/* 23980 */ {22,169},
+/* 23981 */ {22,169},
+/* 23982 */ {22,169},
+/* 23983 */ {22,169},
+/* 23984 */ {22,169},
+/* 23985 */ {22,169},
+/* 23986 */ {22,169},
+/* 23987 */ {22,169},
+/* 23988 */ {22,169},
+/* 23989 */ {22,169},
+/* 23990 */ {22,169},
+/* 23991 */ {22,169},
+/* 23992 */ {22,169},
+/* 23993 */ {22,169},
+/* 23994 */ {22,169},
+/* 23995 */ {22,169},
+/* 23996 */ {22,169},
+/* 23997 */ {22,169},
+/* 23998 */ {22,169},
+/* 23999 */ {22,169},
+/* 24000 */ {22,169},
+/* 24001 */ {22,169},
+/* 24002 */ {22,169},
+/* 24003 */ {22,169},
+/* 24004 */ {22,169},
+/* 24005 */ {22,169},
+/* 24006 */ {22,169},
+/* 24007 */ {22,169},
+/* 24008 */ {22,169},
+/* 24009 */ {22,169},
+/* 24010 */ {22,169},
+/* 24011 */ {22,169},
+/* 24012 */ {22,169},
+/* 24013 */ {22,169},
+/* 24014 */ {22,169},
+/* 24015 */ {22,169},
+/* 24016 */ {22,169},
+/* 24017 */ {22,169},
+/* 24018 */ {22,169},
+/* 24019 */ {22,169},
+/* 24020 */ {22,169},
+/* 24021 */ {22,169},
+/* 24022 */ {22,169},
+/* 24023 */ {22,169},
+/* 24024 */ {22,169},
+/* 24025 */ {22,169},
+/* 24026 */ {22,169},
+/* 24027 */ {22,169},
+/* 24028 */ {22,169},
+/* 24029 */ {22,169},
+/* 24030 */ {22,169},
+/* 24031 */ {22,169},
+/* 24032 */ {22,169},
+/* 24033 */ {22,169},
+/* 24034 */ {22,169},
+/* 24035 */ {22,169},
+/* 24036 */ {22,169},
+/* 24037 */ {22,169},
+/* 24038 */ {22,169},
+/* 24039 */ {22,169},
+/* 24040 */ {22,169},
+/* 24041 */ {22,169},
+/* 24042 */ {22,169},
+/* 24043 */ {22,169},
+/* 24044 */ {22,169},
+/* 24045 */ {22,169},
+/* 24046 */ {22,169},
+/* 24047 */ {22,169},
+/* 24048 */ {22,169},
+/* 24049 */ {22,169},
+/* 24050 */ {22,169},
+/* 24051 */ {22,169},
+/* 24052 */ {22,169},
+/* 24053 */ {22,169},
+/* 24054 */ {22,169},
+/* 24055 */ {22,169},
+/* 24056 */ {22,169},
+/* 24057 */ {22,169},
+/* 24058 */ {22,169},
+/* 24059 */ {22,169},
+/* 24060 */ {22,169},
+/* 24061 */ {22,169},
+/* 24062 */ {22,169},
+/* 24063 */ {22,169},
+/* 24064 */ {22,170},
+/* 24065 */ {22,170},
+/* 24066 */ {22,170},
+/* 24067 */ {22,170},
+/* 24068 */ {22,170},
+/* 24069 */ {22,170},
+/* 24070 */ {22,170},
+/* 24071 */ {22,170},
+/* 24072 */ {22,170},
+/* 24073 */ {22,170},
+/* 24074 */ {22,170},
+/* 24075 */ {22,170},
+/* 24076 */ {22,170},
+/* 24077 */ {22,170},
+/* 24078 */ {22,170},
+/* 24079 */ {22,170},
+/* 24080 */ {22,170},
+/* 24081 */ {22,170},
+/* 24082 */ {22,170},
+/* 24083 */ {22,170},
+/* 24084 */ {22,170},
+/* 24085 */ {22,170},
+/* 24086 */ {22,170},
+/* 24087 */ {22,170},
+/* 24088 */ {22,170},
+/* 24089 */ {22,170},
+/* 24090 */ {22,170},
+/* 24091 */ {22,170},
+/* 24092 */ {22,170},
+/* 24093 */ {22,170},
+/* 24094 */ {22,170},
+/* 24095 */ {22,170},
+/* 24096 */ {22,170},
+/* 24097 */ {22,170},
+/* 24098 */ {22,170},
+/* 24099 */ {22,170},
+/* 24100 */ {22,170},
+/* 24101 */ {22,170},
+/* 24102 */ {22,170},
+/* 24103 */ {22,170},
+/* 24104 */ {22,170},
+/* 24105 */ {22,170},
+/* 24106 */ {22,170},
+/* 24107 */ {22,170},
+/* 24108 */ {22,170},
+/* 24109 */ {22,170},
+/* 24110 */ {22,170},
+/* 24111 */ {22,170},
+/* 24112 */ {22,170},
+/* 24113 */ {22,170},
+/* 24114 */ {22,170},
+/* 24115 */ {22,170},
+/* 24116 */ {22,170},
+/* 24117 */ {22,170},
+/* 24118 */ {22,170},
+/* 24119 */ {22,170},
+/* 24120 */ {22,170},
+/* 24121 */ {22,170},
+/* 24122 */ {22,170},
+/* 24123 */ {22,170},
+/* 24124 */ {22,170},
+/* 24125 */ {22,170},
+/* 24126 */ {22,170},
+/* 24127 */ {22,170},
+/* 24128 */ {22,170},
+/* 24129 */ {22,170},
+/* 24130 */ {22,170},
+/* 24131 */ {22,170},
+/* 24132 */ {22,170},
+/* 24133 */ {22,170},
+/* 24134 */ {22,170},
+/* 24135 */ {22,170},
+/* 24136 */ {22,170},
+/* 24137 */ {22,170},
+/* 24138 */ {22,170},
+/* 24139 */ {22,170},
+/* 24140 */ {22,170},
+/* 24141 */ {22,170},
+/* 24142 */ {22,170},
+/* 24143 */ {22,170},
+/* 24144 */ {22,170},
+/* 24145 */ {22,170},
+/* 24146 */ {22,170},
+/* 24147 */ {22,170},
+/* 24148 */ {22,170},
+/* 24149 */ {22,170},
+/* 24150 */ {22,170},
+/* 24151 */ {22,170},
+/* 24152 */ {22,170},
+/* 24153 */ {22,170},
+/* 24154 */ {22,170},
+/* 24155 */ {22,170},
+/* 24156 */ {22,170},
+/* 24157 */ {22,170},
+/* 24158 */ {22,170},
+/* 24159 */ {22,170},
+/* 24160 */ {22,170},
+/* 24161 */ {22,170},
+/* 24162 */ {22,170},
+/* 24163 */ {22,170},
+/* 24164 */ {22,170},
+/* 24165 */ {22,170},
+/* 24166 */ {22,170},
+/* 24167 */ {22,170},
+/* 24168 */ {22,170},
+/* 24169 */ {22,170},
+/* 24170 */ {22,170},
+/* 24171 */ {22,170},
+/* 24172 */ {22,170},
+/* 24173 */ {22,170},
+/* 24174 */ {22,170},
+/* 24175 */ {22,170},
+/* 24176 */ {22,170},
+/* 24177 */ {22,170},
+/* 24178 */ {22,170},
+/* 24179 */ {22,170},
+/* 24180 */ {22,170},
+/* 24181 */ {22,170},
+/* 24182 */ {22,170},
+/* 24183 */ {22,170},
+/* 24184 */ {22,170},
+/* 24185 */ {22,170},
+/* 24186 */ {22,170},
+/* 24187 */ {22,170},
+/* 24188 */ {22,170},
+/* 24189 */ {22,170},
+/* 24190 */ {22,170},
+/* 24191 */ {22,170},
+/* 24192 */ {22,170},
+/* 24193 */ {22,170},
+/* 24194 */ {22,170},
+/* 24195 */ {22,170},
+/* 24196 */ {22,170},
+/* 24197 */ {22,170},
+/* 24198 */ {22,170},
+/* 24199 */ {22,170},
+/* 24200 */ {22,170},
+/* 24201 */ {22,170},
+/* 24202 */ {22,170},
+/* 24203 */ {22,170},
+/* 24204 */ {22,170},
+/* 24205 */ {22,170},
+/* 24206 */ {22,170},
+/* 24207 */ {22,170},
+/* 24208 */ {22,170},
+/* 24209 */ {22,170},
+/* 24210 */ {22,170},
+/* 24211 */ {22,170},
+/* 24212 */ {22,170},
+/* 24213 */ {22,170},
+/* 24214 */ {22,170},
+/* 24215 */ {22,170},
+/* 24216 */ {22,170},
+/* 24217 */ {22,170},
+/* 24218 */ {22,170},
+/* 24219 */ {22,170},
+/* 24220 */ {22,170},
+/* 24221 */ {22,170},
+/* 24222 */ {22,170},
+/* 24223 */ {22,170},
+/* 24224 */ {22,170},
+/* 24225 */ {22,170},
+/* 24226 */ {22,170},
+/* 24227 */ {22,170},
+/* 24228 */ {22,170},
+/* 24229 */ {22,170},
+/* 24230 */ {22,170},
+/* 24231 */ {22,170},
+/* 24232 */ {22,170},
+/* 24233 */ {22,170},
+/* 24234 */ {22,170},
+/* 24235 */ {22,170},
+/* 24236 */ {22,170},
+/* 24237 */ {22,170},
+/* 24238 */ {22,170},
+/* 24239 */ {22,170},
+/* 24240 */ {22,170},
+/* 24241 */ {22,170},
+/* 24242 */ {22,170},
+/* 24243 */ {22,170},
+/* 24244 */ {22,170},
+/* 24245 */ {22,170},
+/* 24246 */ {22,170},
+/* 24247 */ {22,170},
+/* 24248 */ {22,170},
+/* 24249 */ {22,170},
+/* 24250 */ {22,170},
+/* 24251 */ {22,170},
+/* 24252 */ {22,170},
+/* 24253 */ {22,170},
+/* 24254 */ {22,170},
+/* 24255 */ {22,170},
+/* 24256 */ {22,170},
+/* 24257 */ {22,170},
+/* 24258 */ {22,170},
+/* 24259 */ {22,170},
+/* 24260 */ {22,170},
+/* 24261 */ {22,170},
+/* 24262 */ {22,170},
+/* 24263 */ {22,170},
+/* 24264 */ {22,170},
+/* 24265 */ {22,170},
+/* 24266 */ {22,170},
+/* 24267 */ {22,170},
+/* 24268 */ {22,170},
+/* 24269 */ {22,170},
+/* 24270 */ {22,170},
+/* 24271 */ {22,170},
+/* 24272 */ {22,170},
+/* 24273 */ {22,170},
+/* 24274 */ {22,170},
+/* 24275 */ {22,170},
+/* 24276 */ {22,170},
+/* 24277 */ {22,170},
+/* 24278 */ {22,170},
+/* 24279 */ {22,170},
+/* 24280 */ {22,170},
+/* 24281 */ {22,170},
+/* 24282 */ {22,170},
+/* 24283 */ {22,170},
+/* 24284 */ {22,170},
+/* 24285 */ {22,170},
+/* 24286 */ {22,170},
+/* 24287 */ {22,170},
+/* 24288 */ {22,170},
+/* 24289 */ {22,170},
+/* 24290 */ {22,170},
+/* 24291 */ {22,170},
+/* 24292 */ {22,170},
+/* 24293 */ {22,170},
+/* 24294 */ {22,170},
+/* 24295 */ {22,170},
+/* 24296 */ {22,170},
+/* 24297 */ {22,170},
+/* 24298 */ {22,170},
+/* 24299 */ {22,170},
+/* 24300 */ {22,170},
+/* 24301 */ {22,170},
+/* 24302 */ {22,170},
+/* 24303 */ {22,170},
+/* 24304 */ {22,170},
+/* 24305 */ {22,170},
+/* 24306 */ {22,170},
+/* 24307 */ {22,170},
+/* 24308 */ {22,170},
+/* 24309 */ {22,170},
+/* 24310 */ {22,170},
+/* 24311 */ {22,170},
+/* 24312 */ {22,170},
+/* 24313 */ {22,170},
+/* 24314 */ {22,170},
+/* 24315 */ {22,170},
+/* 24316 */ {22,170},
+/* 24317 */ {22,170},
+/* 24318 */ {22,170},
+/* 24319 */ {22,170},
+/* 24320 */ {22,173},
+/* 24321 */ {22,173},
+/* 24322 */ {22,173},
+/* 24323 */ {22,173},
+/* 24324 */ {22,173},
+/* 24325 */ {22,173},
+/* 24326 */ {22,173},
+/* 24327 */ {22,173},
+/* 24328 */ {22,173},
+/* 24329 */ {22,173},
+/* 24330 */ {22,173},
+/* 24331 */ {22,173},
+/* 24332 */ {22,173},
+/* 24333 */ {22,173},
+/* 24334 */ {22,173},
+/* 24335 */ {22,173},
+/* 24336 */ {22,173},
+/* 24337 */ {22,173},
+/* 24338 */ {22,173},
+/* 24339 */ {22,173},
+/* 24340 */ {22,173},
+/* 24341 */ {22,173},
+/* 24342 */ {22,173},
+/* 24343 */ {22,173},
+/* 24344 */ {22,173},
+/* 24345 */ {22,173},
+/* 24346 */ {22,173},
+/* 24347 */ {22,173},
+/* 24348 */ {22,173},
+/* 24349 */ {22,173},
+/* 24350 */ {22,173},
+/* 24351 */ {22,173},
+/* 24352 */ {22,173},
+/* 24353 */ {22,173},
+/* 24354 */ {22,173},
+/* 24355 */ {22,173},
+/* 24356 */ {22,173},
+/* 24357 */ {22,173},
+/* 24358 */ {22,173},
+/* 24359 */ {22,173},
+/* 24360 */ {22,173},
+/* 24361 */ {22,173},
+/* 24362 */ {22,173},
+/* 24363 */ {22,173},
+/* 24364 */ {22,173},
+/* 24365 */ {22,173},
+/* 24366 */ {22,173},
+/* 24367 */ {22,173},
+/* 24368 */ {22,173},
+/* 24369 */ {22,173},
+/* 24370 */ {22,173},
+/* 24371 */ {22,173},
+/* 24372 */ {22,173},
+/* 24373 */ {22,173},
+/* 24374 */ {22,173},
+/* 24375 */ {22,173},
+/* 24376 */ {22,173},
+/* 24377 */ {22,173},
+/* 24378 */ {22,173},
+/* 24379 */ {22,173},
+/* 24380 */ {22,173},
+/* 24381 */ {22,173},
+/* 24382 */ {22,173},
+/* 24383 */ {22,173},
+/* 24384 */ {22,173},
+/* 24385 */ {22,173},
+/* 24386 */ {22,173},
+/* 24387 */ {22,173},
+/* 24388 */ {22,173},
+/* 24389 */ {22,173},
+/* 24390 */ {22,173},
+/* 24391 */ {22,173},
+/* 24392 */ {22,173},
+/* 24393 */ {22,173},
+/* 24394 */ {22,173},
+/* 24395 */ {22,173},
+/* 24396 */ {22,173},
+/* 24397 */ {22,173},
+/* 24398 */ {22,173},
+/* 24399 */ {22,173},
+/* 24400 */ {22,173},
+/* 24401 */ {22,173},
+/* 24402 */ {22,173},
+/* 24403 */ {22,173},
+/* 24404 */ {22,173},
+/* 24405 */ {22,173},
+/* 24406 */ {22,173},
+/* 24407 */ {22,173},
+/* 24408 */ {22,173},
+/* 24409 */ {22,173},
+/* 24410 */ {22,173},
+/* 24411 */ {22,173},
+/* 24412 */ {22,173},
+/* 24413 */ {22,173},
+/* 24414 */ {22,173},
+/* 24415 */ {22,173},
+/* 24416 */ {22,173},
+/* 24417 */ {22,173},
+/* 24418 */ {22,173},
+/* 24419 */ {22,173},
+/* 24420 */ {22,173},
+/* 24421 */ {22,173},
+/* 24422 */ {22,173},
+/* 24423 */ {22,173},
+/* 24424 */ {22,173},
+/* 24425 */ {22,173},
+/* 24426 */ {22,173},
+/* 24427 */ {22,173},
+/* 24428 */ {22,173},
+/* 24429 */ {22,173},
+/* 24430 */ {22,173},
+/* 24431 */ {22,173},
+/* 24432 */ {22,173},
+/* 24433 */ {22,173},
+/* 24434 */ {22,173},
+/* 24435 */ {22,173},
+/* 24436 */ {22,173},
+/* 24437 */ {22,173},
+/* 24438 */ {22,173},
+/* 24439 */ {22,173},
+/* 24440 */ {22,173},
+/* 24441 */ {22,173},
+/* 24442 */ {22,173},
+/* 24443 */ {22,173},
+/* 24444 */ {22,173},
+/* 24445 */ {22,173},
+/* 24446 */ {22,173},
+/* 24447 */ {22,173},
+/* 24448 */ {22,173},
+/* 24449 */ {22,173},
+/* 24450 */ {22,173},
+/* 24451 */ {22,173},
+/* 24452 */ {22,173},
+/* 24453 */ {22,173},
+/* 24454 */ {22,173},
+/* 24455 */ {22,173},
+/* 24456 */ {22,173},
+/* 24457 */ {22,173},
+/* 24458 */ {22,173},
+/* 24459 */ {22,173},
+/* 24460 */ {22,173},
+/* 24461 */ {22,173},
+/* 24462 */ {22,173},
+/* 24463 */ {22,173},
+/* 24464 */ {22,173},
+/* 24465 */ {22,173},
+/* 24466 */ {22,173},
+/* 24467 */ {22,173},
+/* 24468 */ {22,173},
+/* 24469 */ {22,173},
+/* 24470 */ {22,173},
+/* 24471 */ {22,173},
+/* 24472 */ {22,173},
+/* 24473 */ {22,173},
+/* 24474 */ {22,173},
+/* 24475 */ {22,173},
+/* 24476 */ {22,173},
+/* 24477 */ {22,173},
+/* 24478 */ {22,173},
+/* 24479 */ {22,173},
+/* 24480 */ {22,173},
+/* 24481 */ {22,173},
+/* 24482 */ {22,173},
+/* 24483 */ {22,173},
+/* 24484 */ {22,173},
+/* 24485 */ {22,173},
+/* 24486 */ {22,173},
+/* 24487 */ {22,173},
+/* 24488 */ {22,173},
+/* 24489 */ {22,173},
+/* 24490 */ {22,173},
+/* 24491 */ {22,173},
+/* 24492 */ {22,173},
+/* 24493 */ {22,173},
+/* 24494 */ {22,173},
+/* 24495 */ {22,173},
+/* 24496 */ {22,173},
+/* 24497 */ {22,173},
+/* 24498 */ {22,173},
+/* 24499 */ {22,173},
+/* 24500 */ {22,173},
+/* 24501 */ {22,173},
+/* 24502 */ {22,173},
+/* 24503 */ {22,173},
+/* 24504 */ {22,173},
+/* 24505 */ {22,173},
+/* 24506 */ {22,173},
+/* 24507 */ {22,173},
+/* 24508 */ {22,173},
+/* 24509 */ {22,173},
+/* 24510 */ {22,173},
+/* 24511 */ {22,173},
+/* 24512 */ {22,173},
+/* 24513 */ {22,173},
+/* 24514 */ {22,173},
+/* 24515 */ {22,173},
+/* 24516 */ {22,173},
+/* 24517 */ {22,173},
+/* 24518 */ {22,173},
+/* 24519 */ {22,173},
+/* 24520 */ {22,173},
+/* 24521 */ {22,173},
+/* 24522 */ {22,173},
+/* 24523 */ {22,173},
+/* 24524 */ {22,173},
+/* 24525 */ {22,173},
+/* 24526 */ {22,173},
+/* 24527 */ {22,173},
+/* 24528 */ {22,173},
+/* 24529 */ {22,173},
+/* 24530 */ {22,173},
+/* 24531 */ {22,173},
+/* 24532 */ {22,173},
+/* 24533 */ {22,173},
+/* 24534 */ {22,173},
+/* 24535 */ {22,173},
+/* 24536 */ {22,173},
+/* 24537 */ {22,173},
+/* 24538 */ {22,173},
+/* 24539 */ {22,173},
+/* 24540 */ {22,173},
+/* 24541 */ {22,173},
+/* 24542 */ {22,173},
+/* 24543 */ {22,173},
+/* 24544 */ {22,173},
+/* 24545 */ {22,173},
+/* 24546 */ {22,173},
+/* 24547 */ {22,173},
+/* 24548 */ {22,173},
+/* 24549 */ {22,173},
+/* 24550 */ {22,173},
+/* 24551 */ {22,173},
+/* 24552 */ {22,173},
+/* 24553 */ {22,173},
+/* 24554 */ {22,173},
+/* 24555 */ {22,173},
+/* 24556 */ {22,173},
+/* 24557 */ {22,173},
+/* 24558 */ {22,173},
+/* 24559 */ {22,173},
+/* 24560 */ {22,173},
+/* 24561 */ {22,173},
+/* 24562 */ {22,173},
+/* 24563 */ {22,173},
+/* 24564 */ {22,173},
+/* 24565 */ {22,173},
+/* 24566 */ {22,173},
+/* 24567 */ {22,173},
+/* 24568 */ {22,173},
+/* 24569 */ {22,173},
+/* 24570 */ {22,173},
+/* 24571 */ {22,173},
+/* 24572 */ {22,173},
+/* 24573 */ {22,173},
+/* 24574 */ {22,173},
+/* 24575 */ {22,173},
+/* 24576 */ {22,178},
+/* 24577 */ {22,178},
+/* 24578 */ {22,178},
+/* 24579 */ {22,178},
+/* 24580 */ {22,178},
+/* 24581 */ {22,178},
+/* 24582 */ {22,178},
+/* 24583 */ {22,178},
+/* 24584 */ {22,178},
+/* 24585 */ {22,178},
+/* 24586 */ {22,178},
+/* 24587 */ {22,178},
+/* 24588 */ {22,178},
+/* 24589 */ {22,178},
+/* 24590 */ {22,178},
+/* 24591 */ {22,178},
+/* 24592 */ {22,178},
+/* 24593 */ {22,178},
+/* 24594 */ {22,178},
+/* 24595 */ {22,178},
+/* 24596 */ {22,178},
+/* 24597 */ {22,178},
+/* 24598 */ {22,178},
+/* 24599 */ {22,178},
+/* 24600 */ {22,178},
+/* 24601 */ {22,178},
+/* 24602 */ {22,178},
+/* 24603 */ {22,178},
+/* 24604 */ {22,178},
+/* 24605 */ {22,178},
+/* 24606 */ {22,178},
+/* 24607 */ {22,178},
+/* 24608 */ {22,178},
+/* 24609 */ {22,178},
+/* 24610 */ {22,178},
+/* 24611 */ {22,178},
+/* 24612 */ {22,178},
+/* 24613 */ {22,178},
+/* 24614 */ {22,178},
+/* 24615 */ {22,178},
+/* 24616 */ {22,178},
+/* 24617 */ {22,178},
+/* 24618 */ {22,178},
+/* 24619 */ {22,178},
+/* 24620 */ {22,178},
+/* 24621 */ {22,178},
+/* 24622 */ {22,178},
+/* 24623 */ {22,178},
+/* 24624 */ {22,178},
+/* 24625 */ {22,178},
+/* 24626 */ {22,178},
+/* 24627 */ {22,178},
+/* 24628 */ {22,178},
+/* 24629 */ {22,178},
+/* 24630 */ {22,178},
+/* 24631 */ {22,178},
+/* 24632 */ {22,178},
+/* 24633 */ {22,178},
+/* 24634 */ {22,178},
+/* 24635 */ {22,178},
+/* 24636 */ {22,178},
+/* 24637 */ {22,178},
+/* 24638 */ {22,178},
+/* 24639 */ {22,178},
+/* 24640 */ {22,178},
+/* 24641 */ {22,178},
+/* 24642 */ {22,178},
+/* 24643 */ {22,178},
+/* 24644 */ {22,178},
+/* 24645 */ {22,178},
+/* 24646 */ {22,178},
+/* 24647 */ {22,178},
+/* 24648 */ {22,178},
+/* 24649 */ {22,178},
+/* 24650 */ {22,178},
+/* 24651 */ {22,178},
+/* 24652 */ {22,178},
+/* 24653 */ {22,178},
+/* 24654 */ {22,178},
+/* 24655 */ {22,178},
+/* 24656 */ {22,178},
+/* 24657 */ {22,178},
+/* 24658 */ {22,178},
+/* 24659 */ {22,178},
+/* 24660 */ {22,178},
+/* 24661 */ {22,178},
+/* 24662 */ {22,178},
+/* 24663 */ {22,178},
+/* 24664 */ {22,178},
+/* 24665 */ {22,178},
+/* 24666 */ {22,178},
+/* 24667 */ {22,178},
+/* 24668 */ {22,178},
+/* 24669 */ {22,178},
+/* 24670 */ {22,178},
+/* 24671 */ {22,178},
+/* 24672 */ {22,178},
+/* 24673 */ {22,178},
+/* 24674 */ {22,178},
+/* 24675 */ {22,178},
+/* 24676 */ {22,178},
+/* 24677 */ {22,178},
+/* 24678 */ {22,178},
+/* 24679 */ {22,178},
+/* 24680 */ {22,178},
+/* 24681 */ {22,178},
+/* 24682 */ {22,178},
+/* 24683 */ {22,178},
+/* 24684 */ {22,178},
+/* 24685 */ {22,178},
+/* 24686 */ {22,178},
+/* 24687 */ {22,178},
+/* 24688 */ {22,178},
+/* 24689 */ {22,178},
+/* 24690 */ {22,178},
+/* 24691 */ {22,178},
+/* 24692 */ {22,178},
+/* 24693 */ {22,178},
+/* 24694 */ {22,178},
+/* 24695 */ {22,178},
+/* 24696 */ {22,178},
+/* 24697 */ {22,178},
+/* 24698 */ {22,178},
+/* 24699 */ {22,178},
+/* 24700 */ {22,178},
+/* 24701 */ {22,178},
+/* 24702 */ {22,178},
+/* 24703 */ {22,178},
+/* 24704 */ {22,178},
+/* 24705 */ {22,178},
+/* 24706 */ {22,178},
+/* 24707 */ {22,178},
+/* 24708 */ {22,178},
+/* 24709 */ {22,178},
+/* 24710 */ {22,178},
+/* 24711 */ {22,178},
+/* 24712 */ {22,178},
+/* 24713 */ {22,178},
+/* 24714 */ {22,178},
+/* 24715 */ {22,178},
+/* 24716 */ {22,178},
+/* 24717 */ {22,178},
+/* 24718 */ {22,178},
+/* 24719 */ {22,178},
+/* 24720 */ {22,178},
+/* 24721 */ {22,178},
+/* 24722 */ {22,178},
+/* 24723 */ {22,178},
+/* 24724 */ {22,178},
+/* 24725 */ {22,178},
+/* 24726 */ {22,178},
+/* 24727 */ {22,178},
+/* 24728 */ {22,178},
+/* 24729 */ {22,178},
+/* 24730 */ {22,178},
+/* 24731 */ {22,178},
+/* 24732 */ {22,178},
+/* 24733 */ {22,178},
+/* 24734 */ {22,178},
+/* 24735 */ {22,178},
+/* 24736 */ {22,178},
+/* 24737 */ {22,178},
+/* 24738 */ {22,178},
+/* 24739 */ {22,178},
+/* 24740 */ {22,178},
+/* 24741 */ {22,178},
+/* 24742 */ {22,178},
+/* 24743 */ {22,178},
+/* 24744 */ {22,178},
+/* 24745 */ {22,178},
+/* 24746 */ {22,178},
+/* 24747 */ {22,178},
+/* 24748 */ {22,178},
+/* 24749 */ {22,178},
+/* 24750 */ {22,178},
+/* 24751 */ {22,178},
+/* 24752 */ {22,178},
+/* 24753 */ {22,178},
+/* 24754 */ {22,178},
+/* 24755 */ {22,178},
+/* 24756 */ {22,178},
+/* 24757 */ {22,178},
+/* 24758 */ {22,178},
+/* 24759 */ {22,178},
+/* 24760 */ {22,178},
+/* 24761 */ {22,178},
+/* 24762 */ {22,178},
+/* 24763 */ {22,178},
+/* 24764 */ {22,178},
+/* 24765 */ {22,178},
+/* 24766 */ {22,178},
+/* 24767 */ {22,178},
+/* 24768 */ {22,178},
+/* 24769 */ {22,178},
+/* 24770 */ {22,178},
+/* 24771 */ {22,178},
+/* 24772 */ {22,178},
+/* 24773 */ {22,178},
+/* 24774 */ {22,178},
+/* 24775 */ {22,178},
+/* 24776 */ {22,178},
+/* 24777 */ {22,178},
+/* 24778 */ {22,178},
+/* 24779 */ {22,178},
+/* 24780 */ {22,178},
+/* 24781 */ {22,178},
+/* 24782 */ {22,178},
+/* 24783 */ {22,178},
+/* 24784 */ {22,178},
+/* 24785 */ {22,178},
+/* 24786 */ {22,178},
+/* 24787 */ {22,178},
+/* 24788 */ {22,178},
+/* 24789 */ {22,178},
+/* 24790 */ {22,178},
+/* 24791 */ {22,178},
+/* 24792 */ {22,178},
+/* 24793 */ {22,178},
+/* 24794 */ {22,178},
+/* 24795 */ {22,178},
+/* 24796 */ {22,178},
+/* 24797 */ {22,178},
+/* 24798 */ {22,178},
+/* 24799 */ {22,178},
+/* 24800 */ {22,178},
+/* 24801 */ {22,178},
+/* 24802 */ {22,178},
+/* 24803 */ {22,178},
+/* 24804 */ {22,178},
+/* 24805 */ {22,178},
+/* 24806 */ {22,178},
+/* 24807 */ {22,178},
+/* 24808 */ {22,178},
+/* 24809 */ {22,178},
+/* 24810 */ {22,178},
+/* 24811 */ {22,178},
+/* 24812 */ {22,178},
+/* 24813 */ {22,178},
+/* 24814 */ {22,178},
+/* 24815 */ {22,178},
+/* 24816 */ {22,178},
+/* 24817 */ {22,178},
+/* 24818 */ {22,178},
+/* 24819 */ {22,178},
+/* 24820 */ {22,178},
+/* 24821 */ {22,178},
+/* 24822 */ {22,178},
+/* 24823 */ {22,178},
+/* 24824 */ {22,178},
+/* 24825 */ {22,178},
+/* 24826 */ {22,178},
+/* 24827 */ {22,178},
+/* 24828 */ {22,178},
+/* 24829 */ {22,178},
+/* 24830 */ {22,178},
+/* 24831 */ {22,178},
+/* 24832 */ {22,181},
+/* 24833 */ {22,181},
+/* 24834 */ {22,181},
+/* 24835 */ {22,181},
+/* 24836 */ {22,181},
+/* 24837 */ {22,181},
+/* 24838 */ {22,181},
+/* 24839 */ {22,181},
+/* 24840 */ {22,181},
+/* 24841 */ {22,181},
+/* 24842 */ {22,181},
+/* 24843 */ {22,181},
+/* 24844 */ {22,181},
+/* 24845 */ {22,181},
+/* 24846 */ {22,181},
+/* 24847 */ {22,181},
+/* 24848 */ {22,181},
+/* 24849 */ {22,181},
+/* 24850 */ {22,181},
+/* 24851 */ {22,181},
+/* 24852 */ {22,181},
+/* 24853 */ {22,181},
+/* 24854 */ {22,181},
+/* 24855 */ {22,181},
+/* 24856 */ {22,181},
+/* 24857 */ {22,181},
+/* 24858 */ {22,181},
+/* 24859 */ {22,181},
+/* 24860 */ {22,181},
+/* 24861 */ {22,181},
+/* 24862 */ {22,181},
+/* 24863 */ {22,181},
+/* 24864 */ {22,181},
+/* 24865 */ {22,181},
+/* 24866 */ {22,181},
+/* 24867 */ {22,181},
+/* 24868 */ {22,181},
+/* 24869 */ {22,181},
+/* 24870 */ {22,181},
+/* 24871 */ {22,181},
+/* 24872 */ {22,181},
+/* 24873 */ {22,181},
+/* 24874 */ {22,181},
+/* 24875 */ {22,181},
+/* 24876 */ {22,181},
+/* 24877 */ {22,181},
+/* 24878 */ {22,181},
+/* 24879 */ {22,181},
+/* 24880 */ {22,181},
+/* 24881 */ {22,181},
+/* 24882 */ {22,181},
+/* 24883 */ {22,181},
+/* 24884 */ {22,181},
+/* 24885 */ {22,181},
+/* 24886 */ {22,181},
+/* 24887 */ {22,181},
+/* 24888 */ {22,181},
+/* 24889 */ {22,181},
+/* 24890 */ {22,181},
+/* 24891 */ {22,181},
+/* 24892 */ {22,181},
+/* 24893 */ {22,181},
+/* 24894 */ {22,181},
+/* 24895 */ {22,181},
+/* 24896 */ {22,181},
+/* 24897 */ {22,181},
+/* 24898 */ {22,181},
+/* 24899 */ {22,181},
+/* 24900 */ {22,181},
+/* 24901 */ {22,181},
+/* 24902 */ {22,181},
+/* 24903 */ {22,181},
+/* 24904 */ {22,181},
+/* 24905 */ {22,181},
+/* 24906 */ {22,181},
+/* 24907 */ {22,181},
+/* 24908 */ {22,181},
+/* 24909 */ {22,181},
+/* 24910 */ {22,181},
+/* 24911 */ {22,181},
+/* 24912 */ {22,181},
+/* 24913 */ {22,181},
+/* 24914 */ {22,181},
+/* 24915 */ {22,181},
+/* 24916 */ {22,181},
+/* 24917 */ {22,181},
+/* 24918 */ {22,181},
+/* 24919 */ {22,181},
+/* 24920 */ {22,181},
+/* 24921 */ {22,181},
+/* 24922 */ {22,181},
+/* 24923 */ {22,181},
+/* 24924 */ {22,181},
+/* 24925 */ {22,181},
+/* 24926 */ {22,181},
+/* 24927 */ {22,181},
+/* 24928 */ {22,181},
+/* 24929 */ {22,181},
+/* 24930 */ {22,181},
+/* 24931 */ {22,181},
+/* 24932 */ {22,181},
+/* 24933 */ {22,181},
+/* 24934 */ {22,181},
+/* 24935 */ {22,181},
+/* 24936 */ {22,181},
+/* 24937 */ {22,181},
+/* 24938 */ {22,181},
+/* 24939 */ {22,181},
+/* 24940 */ {22,181},
+/* 24941 */ {22,181},
+/* 24942 */ {22,181},
+/* 24943 */ {22,181},
+/* 24944 */ {22,181},
+/* 24945 */ {22,181},
+/* 24946 */ {22,181},
+/* 24947 */ {22,181},
+/* 24948 */ {22,181},
+/* 24949 */ {22,181},
+/* 24950 */ {22,181},
+/* 24951 */ {22,181},
+/* 24952 */ {22,181},
+/* 24953 */ {22,181},
+/* 24954 */ {22,181},
+/* 24955 */ {22,181},
+/* 24956 */ {22,181},
+/* 24957 */ {22,181},
+/* 24958 */ {22,181},
+/* 24959 */ {22,181},
+/* 24960 */ {22,181},
+/* 24961 */ {22,181},
+/* 24962 */ {22,181},
+/* 24963 */ {22,181},
+/* 24964 */ {22,181},
+/* 24965 */ {22,181},
+/* 24966 */ {22,181},
+/* 24967 */ {22,181},
+/* 24968 */ {22,181},
+/* 24969 */ {22,181},
+/* 24970 */ {22,181},
+/* 24971 */ {22,181},
+/* 24972 */ {22,181},
+/* 24973 */ {22,181},
+/* 24974 */ {22,181},
+/* 24975 */ {22,181},
+/* 24976 */ {22,181},
+/* 24977 */ {22,181},
+/* 24978 */ {22,181},
+/* 24979 */ {22,181},
+/* 24980 */ {22,181},
+/* 24981 */ {22,181},
+/* 24982 */ {22,181},
+/* 24983 */ {22,181},
+/* 24984 */ {22,181},
+/* 24985 */ {22,181},
+/* 24986 */ {22,181},
+/* 24987 */ {22,181},
+/* 24988 */ {22,181},
+/* 24989 */ {22,181},
+/* 24990 */ {22,181},
+/* 24991 */ {22,181},
+/* 24992 */ {22,181},
+/* 24993 */ {22,181},
+/* 24994 */ {22,181},
+/* 24995 */ {22,181},
+/* 24996 */ {22,181},
+/* 24997 */ {22,181},
+/* 24998 */ {22,181},
+/* 24999 */ {22,181},
+/* 25000 */ {22,181},
+/* 25001 */ {22,181},
+/* 25002 */ {22,181},
+/* 25003 */ {22,181},
+/* 25004 */ {22,181},
+/* 25005 */ {22,181},
+/* 25006 */ {22,181},
+/* 25007 */ {22,181},
+/* 25008 */ {22,181},
+/* 25009 */ {22,181},
+/* 25010 */ {22,181},
+/* 25011 */ {22,181},
+/* 25012 */ {22,181},
+/* 25013 */ {22,181},
+/* 25014 */ {22,181},
+/* 25015 */ {22,181},
+/* 25016 */ {22,181},
+/* 25017 */ {22,181},
+/* 25018 */ {22,181},
+/* 25019 */ {22,181},
+/* 25020 */ {22,181},
+/* 25021 */ {22,181},
+/* 25022 */ {22,181},
+/* 25023 */ {22,181},
+/* 25024 */ {22,181},
+/* 25025 */ {22,181},
+/* 25026 */ {22,181},
+/* 25027 */ {22,181},
+/* 25028 */ {22,181},
+/* 25029 */ {22,181},
+/* 25030 */ {22,181},
+/* 25031 */ {22,181},
+/* 25032 */ {22,181},
+/* 25033 */ {22,181},
+/* 25034 */ {22,181},
+/* 25035 */ {22,181},
+/* 25036 */ {22,181},
+/* 25037 */ {22,181},
+/* 25038 */ {22,181},
+/* 25039 */ {22,181},
+/* 25040 */ {22,181},
+/* 25041 */ {22,181},
+/* 25042 */ {22,181},
+/* 25043 */ {22,181},
+/* 25044 */ {22,181},
+/* 25045 */ {22,181},
+/* 25046 */ {22,181},
+/* 25047 */ {22,181},
+/* 25048 */ {22,181},
+/* 25049 */ {22,181},
+/* 25050 */ {22,181},
+/* 25051 */ {22,181},
+/* 25052 */ {22,181},
+/* 25053 */ {22,181},
+/* 25054 */ {22,181},
+/* 25055 */ {22,181},
+/* 25056 */ {22,181},
+/* 25057 */ {22,181},
+/* 25058 */ {22,181},
+/* 25059 */ {22,181},
+/* 25060 */ {22,181},
+/* 25061 */ {22,181},
+/* 25062 */ {22,181},
+/* 25063 */ {22,181},
+/* 25064 */ {22,181},
+/* 25065 */ {22,181},
+/* 25066 */ {22,181},
+/* 25067 */ {22,181},
+/* 25068 */ {22,181},
+/* 25069 */ {22,181},
+/* 25070 */ {22,181},
+/* 25071 */ {22,181},
+/* 25072 */ {22,181},
+/* 25073 */ {22,181},
+/* 25074 */ {22,181},
+/* 25075 */ {22,181},
+/* 25076 */ {22,181},
+/* 25077 */ {22,181},
+/* 25078 */ {22,181},
+/* 25079 */ {22,181},
+/* 25080 */ {22,181},
+/* 25081 */ {22,181},
+/* 25082 */ {22,181},
+/* 25083 */ {22,181},
+/* 25084 */ {22,181},
+/* 25085 */ {22,181},
+/* 25086 */ {22,181},
+/* 25087 */ {22,181},
+/* 25088 */ {22,185},
+/* 25089 */ {22,185},
+/* 25090 */ {22,185},
+/* 25091 */ {22,185},
+/* 25092 */ {22,185},
+/* 25093 */ {22,185},
+/* 25094 */ {22,185},
+/* 25095 */ {22,185},
+/* 25096 */ {22,185},
+/* 25097 */ {22,185},
+/* 25098 */ {22,185},
+/* 25099 */ {22,185},
+/* 25100 */ {22,185},
+/* 25101 */ {22,185},
+/* 25102 */ {22,185},
+/* 25103 */ {22,185},
+/* 25104 */ {22,185},
+/* 25105 */ {22,185},
+/* 25106 */ {22,185},
+/* 25107 */ {22,185},
+/* 25108 */ {22,185},
+/* 25109 */ {22,185},
+/* 25110 */ {22,185},
+/* 25111 */ {22,185},
+/* 25112 */ {22,185},
+/* 25113 */ {22,185},
+/* 25114 */ {22,185},
+/* 25115 */ {22,185},
+/* 25116 */ {22,185},
+/* 25117 */ {22,185},
+/* 25118 */ {22,185},
+/* 25119 */ {22,185},
+/* 25120 */ {22,185},
+/* 25121 */ {22,185},
+/* 25122 */ {22,185},
+/* 25123 */ {22,185},
+/* 25124 */ {22,185},
+/* 25125 */ {22,185},
+/* 25126 */ {22,185},
+/* 25127 */ {22,185},
+/* 25128 */ {22,185},
+/* 25129 */ {22,185},
+/* 25130 */ {22,185},
+/* 25131 */ {22,185},
+/* 25132 */ {22,185},
+/* 25133 */ {22,185},
+/* 25134 */ {22,185},
+/* 25135 */ {22,185},
+/* 25136 */ {22,185},
+/* 25137 */ {22,185},
+/* 25138 */ {22,185},
+/* 25139 */ {22,185},
+/* 25140 */ {22,185},
+/* 25141 */ {22,185},
+/* 25142 */ {22,185},
+/* 25143 */ {22,185},
+/* 25144 */ {22,185},
+/* 25145 */ {22,185},
+/* 25146 */ {22,185},
+/* 25147 */ {22,185},
+/* 25148 */ {22,185},
+/* 25149 */ {22,185},
+/* 25150 */ {22,185},
+/* 25151 */ {22,185},
+/* 25152 */ {22,185},
+/* 25153 */ {22,185},
+/* 25154 */ {22,185},
+/* 25155 */ {22,185},
+/* 25156 */ {22,185},
+/* 25157 */ {22,185},
+/* 25158 */ {22,185},
+/* 25159 */ {22,185},
+/* 25160 */ {22,185},
+/* 25161 */ {22,185},
+/* 25162 */ {22,185},
+/* 25163 */ {22,185},
+/* 25164 */ {22,185},
+/* 25165 */ {22,185},
+/* 25166 */ {22,185},
+/* 25167 */ {22,185},
+/* 25168 */ {22,185},
+/* 25169 */ {22,185},
+/* 25170 */ {22,185},
+/* 25171 */ {22,185},
+/* 25172 */ {22,185},
+/* 25173 */ {22,185},
+/* 25174 */ {22,185},
+/* 25175 */ {22,185},
+/* 25176 */ {22,185},
+/* 25177 */ {22,185},
+/* 25178 */ {22,185},
+/* 25179 */ {22,185},
+/* 25180 */ {22,185},
+/* 25181 */ {22,185},
+/* 25182 */ {22,185},
+/* 25183 */ {22,185},
+/* 25184 */ {22,185},
+/* 25185 */ {22,185},
+/* 25186 */ {22,185},
+/* 25187 */ {22,185},
+/* 25188 */ {22,185},
+/* 25189 */ {22,185},
+/* 25190 */ {22,185},
+/* 25191 */ {22,185},
+/* 25192 */ {22,185},
+/* 25193 */ {22,185},
+/* 25194 */ {22,185},
+/* 25195 */ {22,185},
+/* 25196 */ {22,185},
+/* 25197 */ {22,185},
+/* 25198 */ {22,185},
+/* 25199 */ {22,185},
+/* 25200 */ {22,185},
+/* 25201 */ {22,185},
+/* 25202 */ {22,185},
+/* 25203 */ {22,185},
+/* 25204 */ {22,185},
+/* 25205 */ {22,185},
+/* 25206 */ {22,185},
+/* 25207 */ {22,185},
+/* 25208 */ {22,185},
+/* 25209 */ {22,185},
+/* 25210 */ {22,185},
+/* 25211 */ {22,185},
+/* 25212 */ {22,185},
+/* 25213 */ {22,185},
+/* 25214 */ {22,185},
+/* 25215 */ {22,185},
+/* 25216 */ {22,185},
+/* 25217 */ {22,185},
+/* 25218 */ {22,185},
+/* 25219 */ {22,185},
+/* 25220 */ {22,185},
+/* 25221 */ {22,185},
+/* 25222 */ {22,185},
+/* 25223 */ {22,185},
+/* 25224 */ {22,185},
+/* 25225 */ {22,185},
+/* 25226 */ {22,185},
+/* 25227 */ {22,185},
+/* 25228 */ {22,185},
+/* 25229 */ {22,185},
+/* 25230 */ {22,185},
+/* 25231 */ {22,185},
+/* 25232 */ {22,185},
+/* 25233 */ {22,185},
+/* 25234 */ {22,185},
+/* 25235 */ {22,185},
+/* 25236 */ {22,185},
+/* 25237 */ {22,185},
+/* 25238 */ {22,185},
+/* 25239 */ {22,185},
+/* 25240 */ {22,185},
+/* 25241 */ {22,185},
+/* 25242 */ {22,185},
+/* 25243 */ {22,185},
+/* 25244 */ {22,185},
+/* 25245 */ {22,185},
+/* 25246 */ {22,185},
+/* 25247 */ {22,185},
+/* 25248 */ {22,185},
+/* 25249 */ {22,185},
+/* 25250 */ {22,185},
+/* 25251 */ {22,185},
+/* 25252 */ {22,185},
+/* 25253 */ {22,185},
+/* 25254 */ {22,185},
+/* 25255 */ {22,185},
+/* 25256 */ {22,185},
+/* 25257 */ {22,185},
+/* 25258 */ {22,185},
+/* 25259 */ {22,185},
+/* 25260 */ {22,185},
+/* 25261 */ {22,185},
+/* 25262 */ {22,185},
+/* 25263 */ {22,185},
+/* 25264 */ {22,185},
+/* 25265 */ {22,185},
+/* 25266 */ {22,185},
+/* 25267 */ {22,185},
+/* 25268 */ {22,185},
+/* 25269 */ {22,185},
+/* 25270 */ {22,185},
+/* 25271 */ {22,185},
+/* 25272 */ {22,185},
+/* 25273 */ {22,185},
+/* 25274 */ {22,185},
+/* 25275 */ {22,185},
+/* 25276 */ {22,185},
+/* 25277 */ {22,185},
+/* 25278 */ {22,185},
+/* 25279 */ {22,185},
+/* 25280 */ {22,185},
+/* 25281 */ {22,185},
+/* 25282 */ {22,185},
+/* 25283 */ {22,185},
+/* 25284 */ {22,185},
+/* 25285 */ {22,185},
+/* 25286 */ {22,185},
+/* 25287 */ {22,185},
+/* 25288 */ {22,185},
+/* 25289 */ {22,185},
+/* 25290 */ {22,185},
+/* 25291 */ {22,185},
+/* 25292 */ {22,185},
+/* 25293 */ {22,185},
+/* 25294 */ {22,185},
+/* 25295 */ {22,185},
+/* 25296 */ {22,185},
+/* 25297 */ {22,185},
+/* 25298 */ {22,185},
+/* 25299 */ {22,185},
+/* 25300 */ {22,185},
+/* 25301 */ {22,185},
+/* 25302 */ {22,185},
+/* 25303 */ {22,185},
+/* 25304 */ {22,185},
+/* 25305 */ {22,185},
+/* 25306 */ {22,185},
+/* 25307 */ {22,185},
+/* 25308 */ {22,185},
+/* 25309 */ {22,185},
+/* 25310 */ {22,185},
+/* 25311 */ {22,185},
+/* 25312 */ {22,185},
+/* 25313 */ {22,185},
+/* 25314 */ {22,185},
+/* 25315 */ {22,185},
+/* 25316 */ {22,185},
+/* 25317 */ {22,185},
+/* 25318 */ {22,185},
+/* 25319 */ {22,185},
+/* 25320 */ {22,185},
+/* 25321 */ {22,185},
+/* 25322 */ {22,185},
+/* 25323 */ {22,185},
+/* 25324 */ {22,185},
+/* 25325 */ {22,185},
+/* 25326 */ {22,185},
+/* 25327 */ {22,185},
+/* 25328 */ {22,185},
+/* 25329 */ {22,185},
+/* 25330 */ {22,185},
+/* 25331 */ {22,185},
+/* 25332 */ {22,185},
+/* 25333 */ {22,185},
+/* 25334 */ {22,185},
+/* 25335 */ {22,185},
+/* 25336 */ {22,185},
+/* 25337 */ {22,185},
+/* 25338 */ {22,185},
+/* 25339 */ {22,185},
+/* 25340 */ {22,185},
+/* 25341 */ {22,185},
+/* 25342 */ {22,185},
+/* 25343 */ {22,185},
+/* 25344 */ {22,186},
+/* 25345 */ {22,186},
+/* 25346 */ {22,186},
+/* 25347 */ {22,186},
+/* 25348 */ {22,186},
+/* 25349 */ {22,186},
+/* 25350 */ {22,186},
+/* 25351 */ {22,186},
+/* 25352 */ {22,186},
+/* 25353 */ {22,186},
+/* 25354 */ {22,186},
+/* 25355 */ {22,186},
+/* 25356 */ {22,186},
+/* 25357 */ {22,186},
+/* 25358 */ {22,186},
+/* 25359 */ {22,186},
+/* 25360 */ {22,186},
+/* 25361 */ {22,186},
+/* 25362 */ {22,186},
+/* 25363 */ {22,186},
+/* 25364 */ {22,186},
+/* 25365 */ {22,186},
+/* 25366 */ {22,186},
+/* 25367 */ {22,186},
+/* 25368 */ {22,186},
+/* 25369 */ {22,186},
+/* 25370 */ {22,186},
+/* 25371 */ {22,186},
+/* 25372 */ {22,186},
+/* 25373 */ {22,186},
+/* 25374 */ {22,186},
+/* 25375 */ {22,186},
+/* 25376 */ {22,186},
+/* 25377 */ {22,186},
+/* 25378 */ {22,186},
+/* 25379 */ {22,186},
+/* 25380 */ {22,186},
+/* 25381 */ {22,186},
+/* 25382 */ {22,186},
+/* 25383 */ {22,186},
+/* 25384 */ {22,186},
+/* 25385 */ {22,186},
+/* 25386 */ {22,186},
+/* 25387 */ {22,186},
+/* 25388 */ {22,186},
+/* 25389 */ {22,186},
+/* 25390 */ {22,186},
+/* 25391 */ {22,186},
+/* 25392 */ {22,186},
+/* 25393 */ {22,186},
+/* 25394 */ {22,186},
+/* 25395 */ {22,186},
+/* 25396 */ {22,186},
+/* 25397 */ {22,186},
+/* 25398 */ {22,186},
+/* 25399 */ {22,186},
+/* 25400 */ {22,186},
+/* 25401 */ {22,186},
+/* 25402 */ {22,186},
+/* 25403 */ {22,186},
+/* 25404 */ {22,186},
+/* 25405 */ {22,186},
+/* 25406 */ {22,186},
+/* 25407 */ {22,186},
+/* 25408 */ {22,186},
+/* 25409 */ {22,186},
+/* 25410 */ {22,186},
+/* 25411 */ {22,186},
+/* 25412 */ {22,186},
+/* 25413 */ {22,186},
+/* 25414 */ {22,186},
+/* 25415 */ {22,186},
+/* 25416 */ {22,186},
+/* 25417 */ {22,186},
+/* 25418 */ {22,186},
+/* 25419 */ {22,186},
+/* 25420 */ {22,186},
+/* 25421 */ {22,186},
+/* 25422 */ {22,186},
+/* 25423 */ {22,186},
+/* 25424 */ {22,186},
+/* 25425 */ {22,186},
+/* 25426 */ {22,186},
+/* 25427 */ {22,186},
+/* 25428 */ {22,186},
+/* 25429 */ {22,186},
+/* 25430 */ {22,186},
+/* 25431 */ {22,186},
+/* 25432 */ {22,186},
+/* 25433 */ {22,186},
+/* 25434 */ {22,186},
+/* 25435 */ {22,186},
+/* 25436 */ {22,186},
+/* 25437 */ {22,186},
+/* 25438 */ {22,186},
+/* 25439 */ {22,186},
+/* 25440 */ {22,186},
+/* 25441 */ {22,186},
+/* 25442 */ {22,186},
+/* 25443 */ {22,186},
+/* 25444 */ {22,186},
+/* 25445 */ {22,186},
+/* 25446 */ {22,186},
+/* 25447 */ {22,186},
+/* 25448 */ {22,186},
+/* 25449 */ {22,186},
+/* 25450 */ {22,186},
+/* 25451 */ {22,186},
+/* 25452 */ {22,186},
+/* 25453 */ {22,186},
+/* 25454 */ {22,186},
+/* 25455 */ {22,186},
+/* 25456 */ {22,186},
+/* 25457 */ {22,186},
+/* 25458 */ {22,186},
+/* 25459 */ {22,186},
+/* 25460 */ {22,186},
+/* 25461 */ {22,186},
+/* 25462 */ {22,186},
+/* 25463 */ {22,186},
+/* 25464 */ {22,186},
+/* 25465 */ {22,186},
+/* 25466 */ {22,186},
+/* 25467 */ {22,186},
+/* 25468 */ {22,186},
+/* 25469 */ {22,186},
+/* 25470 */ {22,186},
+/* 25471 */ {22,186},
+/* 25472 */ {22,186},
+/* 25473 */ {22,186},
+/* 25474 */ {22,186},
+/* 25475 */ {22,186},
+/* 25476 */ {22,186},
+/* 25477 */ {22,186},
+/* 25478 */ {22,186},
+/* 25479 */ {22,186},
+/* 25480 */ {22,186},
+/* 25481 */ {22,186},
+/* 25482 */ {22,186},
+/* 25483 */ {22,186},
+/* 25484 */ {22,186},
+/* 25485 */ {22,186},
+/* 25486 */ {22,186},
+/* 25487 */ {22,186},
+/* 25488 */ {22,186},
+/* 25489 */ {22,186},
+/* 25490 */ {22,186},
+/* 25491 */ {22,186},
+/* 25492 */ {22,186},
+/* 25493 */ {22,186},
+/* 25494 */ {22,186},
+/* 25495 */ {22,186},
+/* 25496 */ {22,186},
+/* 25497 */ {22,186},
+/* 25498 */ {22,186},
+/* 25499 */ {22,186},
+/* 25500 */ {22,186},
+/* 25501 */ {22,186},
+/* 25502 */ {22,186},
+/* 25503 */ {22,186},
+/* 25504 */ {22,186},
+/* 25505 */ {22,186},
+/* 25506 */ {22,186},
+/* 25507 */ {22,186},
+/* 25508 */ {22,186},
+/* 25509 */ {22,186},
+/* 25510 */ {22,186},
+/* 25511 */ {22,186},
+/* 25512 */ {22,186},
+/* 25513 */ {22,186},
+/* 25514 */ {22,186},
+/* 25515 */ {22,186},
+/* 25516 */ {22,186},
+/* 25517 */ {22,186},
+/* 25518 */ {22,186},
+/* 25519 */ {22,186},
+/* 25520 */ {22,186},
+/* 25521 */ {22,186},
+/* 25522 */ {22,186},
+/* 25523 */ {22,186},
+/* 25524 */ {22,186},
+/* 25525 */ {22,186},
+/* 25526 */ {22,186},
+/* 25527 */ {22,186},
+/* 25528 */ {22,186},
+/* 25529 */ {22,186},
+/* 25530 */ {22,186},
+/* 25531 */ {22,186},
+/* 25532 */ {22,186},
+/* 25533 */ {22,186},
+/* 25534 */ {22,186},
+/* 25535 */ {22,186},
+/* 25536 */ {22,186},
+/* 25537 */ {22,186},
+/* 25538 */ {22,186},
+/* 25539 */ {22,186},
+/* 25540 */ {22,186},
+/* 25541 */ {22,186},
+/* 25542 */ {22,186},
+/* 25543 */ {22,186},
+/* 25544 */ {22,186},
+/* 25545 */ {22,186},
+/* 25546 */ {22,186},
+/* 25547 */ {22,186},
+/* 25548 */ {22,186},
+/* 25549 */ {22,186},
+/* 25550 */ {22,186},
+/* 25551 */ {22,186},
+/* 25552 */ {22,186},
+/* 25553 */ {22,186},
+/* 25554 */ {22,186},
+/* 25555 */ {22,186},
+/* 25556 */ {22,186},
+/* 25557 */ {22,186},
+/* 25558 */ {22,186},
+/* 25559 */ {22,186},
+/* 25560 */ {22,186},
+/* 25561 */ {22,186},
+/* 25562 */ {22,186},
+/* 25563 */ {22,186},
+/* 25564 */ {22,186},
+/* 25565 */ {22,186},
+/* 25566 */ {22,186},
+/* 25567 */ {22,186},
+/* 25568 */ {22,186},
+/* 25569 */ {22,186},
+/* 25570 */ {22,186},
+/* 25571 */ {22,186},
+/* 25572 */ {22,186},
+/* 25573 */ {22,186},
+/* 25574 */ {22,186},
+/* 25575 */ {22,186},
+/* 25576 */ {22,186},
+/* 25577 */ {22,186},
+/* 25578 */ {22,186},
+/* 25579 */ {22,186},
+/* 25580 */ {22,186},
+/* 25581 */ {22,186},
+/* 25582 */ {22,186},
+/* 25583 */ {22,186},
+/* 25584 */ {22,186},
+/* 25585 */ {22,186},
+/* 25586 */ {22,186},
+/* 25587 */ {22,186},
+/* 25588 */ {22,186},
+/* 25589 */ {22,186},
+/* 25590 */ {22,186},
+/* 25591 */ {22,186},
+/* 25592 */ {22,186},
+/* 25593 */ {22,186},
+/* 25594 */ {22,186},
+/* 25595 */ {22,186},
+/* 25596 */ {22,186},
+/* 25597 */ {22,186},
+/* 25598 */ {22,186},
+/* 25599 */ {22,186},
+/* 25600 */ {22,187},
+/* 25601 */ {22,187},
+/* 25602 */ {22,187},
+/* 25603 */ {22,187},
+/* 25604 */ {22,187},
+/* 25605 */ {22,187},
+/* 25606 */ {22,187},
+/* 25607 */ {22,187},
+/* 25608 */ {22,187},
+/* 25609 */ {22,187},
+/* 25610 */ {22,187},
+/* 25611 */ {22,187},
+/* 25612 */ {22,187},
+/* 25613 */ {22,187},
+/* 25614 */ {22,187},
+/* 25615 */ {22,187},
+/* 25616 */ {22,187},
+/* 25617 */ {22,187},
+/* 25618 */ {22,187},
+/* 25619 */ {22,187},
+/* 25620 */ {22,187},
+/* 25621 */ {22,187},
+/* 25622 */ {22,187},
+/* 25623 */ {22,187},
+/* 25624 */ {22,187},
+/* 25625 */ {22,187},
+/* 25626 */ {22,187},
+/* 25627 */ {22,187},
+/* 25628 */ {22,187},
+/* 25629 */ {22,187},
+/* 25630 */ {22,187},
+/* 25631 */ {22,187},
+/* 25632 */ {22,187},
+/* 25633 */ {22,187},
+/* 25634 */ {22,187},
+/* 25635 */ {22,187},
+/* 25636 */ {22,187},
+/* 25637 */ {22,187},
+/* 25638 */ {22,187},
+/* 25639 */ {22,187},
+/* 25640 */ {22,187},
+/* 25641 */ {22,187},
+/* 25642 */ {22,187},
+/* 25643 */ {22,187},
+/* 25644 */ {22,187},
+/* 25645 */ {22,187},
+/* 25646 */ {22,187},
+/* 25647 */ {22,187},
+/* 25648 */ {22,187},
+/* 25649 */ {22,187},
+/* 25650 */ {22,187},
+/* 25651 */ {22,187},
+/* 25652 */ {22,187},
+/* 25653 */ {22,187},
+/* 25654 */ {22,187},
+/* 25655 */ {22,187},
+/* 25656 */ {22,187},
+/* 25657 */ {22,187},
+/* 25658 */ {22,187},
+/* 25659 */ {22,187},
+/* 25660 */ {22,187},
+/* 25661 */ {22,187},
+/* 25662 */ {22,187},
+/* 25663 */ {22,187},
+/* 25664 */ {22,187},
+/* 25665 */ {22,187},
+/* 25666 */ {22,187},
+/* 25667 */ {22,187},
+/* 25668 */ {22,187},
+/* 25669 */ {22,187},
+/* 25670 */ {22,187},
+/* 25671 */ {22,187},
+/* 25672 */ {22,187},
+/* 25673 */ {22,187},
+/* 25674 */ {22,187},
+/* 25675 */ {22,187},
+/* 25676 */ {22,187},
+/* 25677 */ {22,187},
+/* 25678 */ {22,187},
+/* 25679 */ {22,187},
+/* 25680 */ {22,187},
+/* 25681 */ {22,187},
+/* 25682 */ {22,187},
+/* 25683 */ {22,187},
+/* 25684 */ {22,187},
+/* 25685 */ {22,187},
+/* 25686 */ {22,187},
+/* 25687 */ {22,187},
+/* 25688 */ {22,187},
+/* 25689 */ {22,187},
+/* 25690 */ {22,187},
+/* 25691 */ {22,187},
+/* 25692 */ {22,187},
+/* 25693 */ {22,187},
+/* 25694 */ {22,187},
+/* 25695 */ {22,187},
+/* 25696 */ {22,187},
+/* 25697 */ {22,187},
+/* 25698 */ {22,187},
+/* 25699 */ {22,187},
+/* 25700 */ {22,187},
+/* 25701 */ {22,187},
+/* 25702 */ {22,187},
+/* 25703 */ {22,187},
+/* 25704 */ {22,187},
+/* 25705 */ {22,187},
+/* 25706 */ {22,187},
+/* 25707 */ {22,187},
+/* 25708 */ {22,187},
+/* 25709 */ {22,187},
+/* 25710 */ {22,187},
+/* 25711 */ {22,187},
+/* 25712 */ {22,187},
+/* 25713 */ {22,187},
+/* 25714 */ {22,187},
+/* 25715 */ {22,187},
+/* 25716 */ {22,187},
+/* 25717 */ {22,187},
+/* 25718 */ {22,187},
+/* 25719 */ {22,187},
+/* 25720 */ {22,187},
+/* 25721 */ {22,187},
+/* 25722 */ {22,187},
+/* 25723 */ {22,187},
+/* 25724 */ {22,187},
+/* 25725 */ {22,187},
+/* 25726 */ {22,187},
+/* 25727 */ {22,187},
+/* 25728 */ {22,187},
+/* 25729 */ {22,187},
+/* 25730 */ {22,187},
+/* 25731 */ {22,187},
+/* 25732 */ {22,187},
+/* 25733 */ {22,187},
+/* 25734 */ {22,187},
+/* 25735 */ {22,187},
+/* 25736 */ {22,187},
+/* 25737 */ {22,187},
+/* 25738 */ {22,187},
+/* 25739 */ {22,187},
+/* 25740 */ {22,187},
+/* 25741 */ {22,187},
+/* 25742 */ {22,187},
+/* 25743 */ {22,187},
+/* 25744 */ {22,187},
+/* 25745 */ {22,187},
+/* 25746 */ {22,187},
+/* 25747 */ {22,187},
+/* 25748 */ {22,187},
+/* 25749 */ {22,187},
+/* 25750 */ {22,187},
+/* 25751 */ {22,187},
+/* 25752 */ {22,187},
+/* 25753 */ {22,187},
+/* 25754 */ {22,187},
+/* 25755 */ {22,187},
+/* 25756 */ {22,187},
+/* 25757 */ {22,187},
+/* 25758 */ {22,187},
+/* 25759 */ {22,187},
+/* 25760 */ {22,187},
+/* 25761 */ {22,187},
+/* 25762 */ {22,187},
+/* 25763 */ {22,187},
+/* 25764 */ {22,187},
+/* 25765 */ {22,187},
+/* 25766 */ {22,187},
+/* 25767 */ {22,187},
+/* 25768 */ {22,187},
+/* 25769 */ {22,187},
+/* 25770 */ {22,187},
+/* 25771 */ {22,187},
+/* 25772 */ {22,187},
+/* 25773 */ {22,187},
+/* 25774 */ {22,187},
+/* 25775 */ {22,187},
+/* 25776 */ {22,187},
+/* 25777 */ {22,187},
+/* 25778 */ {22,187},
+/* 25779 */ {22,187},
+/* 25780 */ {22,187},
+/* 25781 */ {22,187},
+/* 25782 */ {22,187},
+/* 25783 */ {22,187},
+/* 25784 */ {22,187},
+/* 25785 */ {22,187},
+/* 25786 */ {22,187},
+/* 25787 */ {22,187},
+/* 25788 */ {22,187},
+/* 25789 */ {22,187},
+/* 25790 */ {22,187},
+/* 25791 */ {22,187},
+/* 25792 */ {22,187},
+/* 25793 */ {22,187},
+/* 25794 */ {22,187},
+/* 25795 */ {22,187},
+/* 25796 */ {22,187},
+/* 25797 */ {22,187},
+/* 25798 */ {22,187},
+/* 25799 */ {22,187},
+/* 25800 */ {22,187},
+/* 25801 */ {22,187},
+/* 25802 */ {22,187},
+/* 25803 */ {22,187},
+/* 25804 */ {22,187},
+/* 25805 */ {22,187},
+/* 25806 */ {22,187},
+/* 25807 */ {22,187},
+/* 25808 */ {22,187},
+/* 25809 */ {22,187},
+/* 25810 */ {22,187},
+/* 25811 */ {22,187},
+/* 25812 */ {22,187},
+/* 25813 */ {22,187},
+/* 25814 */ {22,187},
+/* 25815 */ {22,187},
+/* 25816 */ {22,187},
+/* 25817 */ {22,187},
+/* 25818 */ {22,187},
+/* 25819 */ {22,187},
+/* 25820 */ {22,187},
+/* 25821 */ {22,187},
+/* 25822 */ {22,187},
+/* 25823 */ {22,187},
+/* 25824 */ {22,187},
+/* 25825 */ {22,187},
+/* 25826 */ {22,187},
+/* 25827 */ {22,187},
+/* 25828 */ {22,187},
+/* 25829 */ {22,187},
+/* 25830 */ {22,187},
+/* 25831 */ {22,187},
+/* 25832 */ {22,187},
+/* 25833 */ {22,187},
+/* 25834 */ {22,187},
+/* 25835 */ {22,187},
+/* 25836 */ {22,187},
+/* 25837 */ {22,187},
+/* 25838 */ {22,187},
+/* 25839 */ {22,187},
+/* 25840 */ {22,187},
+/* 25841 */ {22,187},
+/* 25842 */ {22,187},
+/* 25843 */ {22,187},
+/* 25844 */ {22,187},
+/* 25845 */ {22,187},
+/* 25846 */ {22,187},
+/* 25847 */ {22,187},
+/* 25848 */ {22,187},
+/* 25849 */ {22,187},
+/* 25850 */ {22,187},
+/* 25851 */ {22,187},
+/* 25852 */ {22,187},
+/* 25853 */ {22,187},
+/* 25854 */ {22,187},
+/* 25855 */ {22,187},
+/* 25856 */ {22,189},
+/* 25857 */ {22,189},
+/* 25858 */ {22,189},
+/* 25859 */ {22,189},
+/* 25860 */ {22,189},
+/* 25861 */ {22,189},
+/* 25862 */ {22,189},
+/* 25863 */ {22,189},
+/* 25864 */ {22,189},
+/* 25865 */ {22,189},
+/* 25866 */ {22,189},
+/* 25867 */ {22,189},
+/* 25868 */ {22,189},
+/* 25869 */ {22,189},
+/* 25870 */ {22,189},
+/* 25871 */ {22,189},
+/* 25872 */ {22,189},
+/* 25873 */ {22,189},
+/* 25874 */ {22,189},
+/* 25875 */ {22,189},
+/* 25876 */ {22,189},
+/* 25877 */ {22,189},
+/* 25878 */ {22,189},
+/* 25879 */ {22,189},
+/* 25880 */ {22,189},
+/* 25881 */ {22,189},
+/* 25882 */ {22,189},
+/* 25883 */ {22,189},
+/* 25884 */ {22,189},
+/* 25885 */ {22,189},
+/* 25886 */ {22,189},
+/* 25887 */ {22,189},
+/* 25888 */ {22,189},
+/* 25889 */ {22,189},
+/* 25890 */ {22,189},
+/* 25891 */ {22,189},
+/* 25892 */ {22,189},
+/* 25893 */ {22,189},
+/* 25894 */ {22,189},
+/* 25895 */ {22,189},
+/* 25896 */ {22,189},
+/* 25897 */ {22,189},
+/* 25898 */ {22,189},
+/* 25899 */ {22,189},
+/* 25900 */ {22,189},
+/* 25901 */ {22,189},
+/* 25902 */ {22,189},
+/* 25903 */ {22,189},
+/* 25904 */ {22,189},
+/* 25905 */ {22,189},
+/* 25906 */ {22,189},
+/* 25907 */ {22,189},
+/* 25908 */ {22,189},
+/* 25909 */ {22,189},
+/* 25910 */ {22,189},
+/* 25911 */ {22,189},
+/* 25912 */ {22,189},
+/* 25913 */ {22,189},
+/* 25914 */ {22,189},
+/* 25915 */ {22,189},
+/* 25916 */ {22,189},
+/* 25917 */ {22,189},
+/* 25918 */ {22,189},
+/* 25919 */ {22,189},
+/* 25920 */ {22,189},
+/* 25921 */ {22,189},
+/* 25922 */ {22,189},
+/* 25923 */ {22,189},
+/* 25924 */ {22,189},
+/* 25925 */ {22,189},
+/* 25926 */ {22,189},
+/* 25927 */ {22,189},
+/* 25928 */ {22,189},
+/* 25929 */ {22,189},
+/* 25930 */ {22,189},
+/* 25931 */ {22,189},
+/* 25932 */ {22,189},
+/* 25933 */ {22,189},
+/* 25934 */ {22,189},
+/* 25935 */ {22,189},
+/* 25936 */ {22,189},
+/* 25937 */ {22,189},
+/* 25938 */ {22,189},
+/* 25939 */ {22,189},
+/* 25940 */ {22,189},
+/* 25941 */ {22,189},
+/* 25942 */ {22,189},
+/* 25943 */ {22,189},
+/* 25944 */ {22,189},
+/* 25945 */ {22,189},
+/* 25946 */ {22,189},
+/* 25947 */ {22,189},
+/* 25948 */ {22,189},
+/* 25949 */ {22,189},
+/* 25950 */ {22,189},
+/* 25951 */ {22,189},
+/* 25952 */ {22,189},
+/* 25953 */ {22,189},
+/* 25954 */ {22,189},
+/* 25955 */ {22,189},
+/* 25956 */ {22,189},
+/* 25957 */ {22,189},
+/* 25958 */ {22,189},
+/* 25959 */ {22,189},
+/* 25960 */ {22,189},
+/* 25961 */ {22,189},
+/* 25962 */ {22,189},
+/* 25963 */ {22,189},
+/* 25964 */ {22,189},
+/* 25965 */ {22,189},
+/* 25966 */ {22,189},
+/* 25967 */ {22,189},
+/* 25968 */ {22,189},
+/* 25969 */ {22,189},
+/* 25970 */ {22,189},
+/* 25971 */ {22,189},
+/* 25972 */ {22,189},
+/* 25973 */ {22,189},
+/* 25974 */ {22,189},
+/* 25975 */ {22,189},
+/* 25976 */ {22,189},
+/* 25977 */ {22,189},
+/* 25978 */ {22,189},
+/* 25979 */ {22,189},
+/* 25980 */ {22,189},
+/* 25981 */ {22,189},
+/* 25982 */ {22,189},
+/* 25983 */ {22,189},
+/* 25984 */ {22,189},
+/* 25985 */ {22,189},
+/* 25986 */ {22,189},
+/* 25987 */ {22,189},
+/* 25988 */ {22,189},
+/* 25989 */ {22,189},
+/* 25990 */ {22,189},
+/* 25991 */ {22,189},
+/* 25992 */ {22,189},
+/* 25993 */ {22,189},
+/* 25994 */ {22,189},
+/* 25995 */ {22,189},
+/* 25996 */ {22,189},
+/* 25997 */ {22,189},
+/* 25998 */ {22,189},
+/* 25999 */ {22,189},
+/* 26000 */ {22,189},
+/* 26001 */ {22,189},
+/* 26002 */ {22,189},
+/* 26003 */ {22,189},
+/* 26004 */ {22,189},
+/* 26005 */ {22,189},
+/* 26006 */ {22,189},
+/* 26007 */ {22,189},
+/* 26008 */ {22,189},
+/* 26009 */ {22,189},
+/* 26010 */ {22,189},
+/* 26011 */ {22,189},
+/* 26012 */ {22,189},
+/* 26013 */ {22,189},
+/* 26014 */ {22,189},
+/* 26015 */ {22,189},
+/* 26016 */ {22,189},
+/* 26017 */ {22,189},
+/* 26018 */ {22,189},
+/* 26019 */ {22,189},
+/* 26020 */ {22,189},
+/* 26021 */ {22,189},
+/* 26022 */ {22,189},
+/* 26023 */ {22,189},
+/* 26024 */ {22,189},
+/* 26025 */ {22,189},
+/* 26026 */ {22,189},
+/* 26027 */ {22,189},
+/* 26028 */ {22,189},
+/* 26029 */ {22,189},
+/* 26030 */ {22,189},
+/* 26031 */ {22,189},
+/* 26032 */ {22,189},
+/* 26033 */ {22,189},
+/* 26034 */ {22,189},
+/* 26035 */ {22,189},
+/* 26036 */ {22,189},
+/* 26037 */ {22,189},
+/* 26038 */ {22,189},
+/* 26039 */ {22,189},
+/* 26040 */ {22,189},
+/* 26041 */ {22,189},
+/* 26042 */ {22,189},
+/* 26043 */ {22,189},
+/* 26044 */ {22,189},
+/* 26045 */ {22,189},
+/* 26046 */ {22,189},
+/* 26047 */ {22,189},
+/* 26048 */ {22,189},
+/* 26049 */ {22,189},
+/* 26050 */ {22,189},
+/* 26051 */ {22,189},
+/* 26052 */ {22,189},
+/* 26053 */ {22,189},
+/* 26054 */ {22,189},
+/* 26055 */ {22,189},
+/* 26056 */ {22,189},
+/* 26057 */ {22,189},
+/* 26058 */ {22,189},
+/* 26059 */ {22,189},
+/* 26060 */ {22,189},
+/* 26061 */ {22,189},
+/* 26062 */ {22,189},
+/* 26063 */ {22,189},
+/* 26064 */ {22,189},
+/* 26065 */ {22,189},
+/* 26066 */ {22,189},
+/* 26067 */ {22,189},
+/* 26068 */ {22,189},
+/* 26069 */ {22,189},
+/* 26070 */ {22,189},
+/* 26071 */ {22,189},
+/* 26072 */ {22,189},
+/* 26073 */ {22,189},
+/* 26074 */ {22,189},
+/* 26075 */ {22,189},
+/* 26076 */ {22,189},
+/* 26077 */ {22,189},
+/* 26078 */ {22,189},
+/* 26079 */ {22,189},
+/* 26080 */ {22,189},
+/* 26081 */ {22,189},
+/* 26082 */ {22,189},
+/* 26083 */ {22,189},
+/* 26084 */ {22,189},
+/* 26085 */ {22,189},
+/* 26086 */ {22,189},
+/* 26087 */ {22,189},
+/* 26088 */ {22,189},
+/* 26089 */ {22,189},
+/* 26090 */ {22,189},
+/* 26091 */ {22,189},
+/* 26092 */ {22,189},
+/* 26093 */ {22,189},
+/* 26094 */ {22,189},
+/* 26095 */ {22,189},
+/* 26096 */ {22,189},
+/* 26097 */ {22,189},
+/* 26098 */ {22,189},
+/* 26099 */ {22,189},
+/* 26100 */ {22,189},
+/* 26101 */ {22,189},
+/* 26102 */ {22,189},
+/* 26103 */ {22,189},
+/* 26104 */ {22,189},
+/* 26105 */ {22,189},
+/* 26106 */ {22,189},
+/* 26107 */ {22,189},
+/* 26108 */ {22,189},
+/* 26109 */ {22,189},
+/* 26110 */ {22,189},
+/* 26111 */ {22,189},
+/* 26112 */ {22,190},
+/* 26113 */ {22,190},
+/* 26114 */ {22,190},
+/* 26115 */ {22,190},
+/* 26116 */ {22,190},
+/* 26117 */ {22,190},
+/* 26118 */ {22,190},
+/* 26119 */ {22,190},
+/* 26120 */ {22,190},
+/* 26121 */ {22,190},
+/* 26122 */ {22,190},
+/* 26123 */ {22,190},
+/* 26124 */ {22,190},
+/* 26125 */ {22,190},
+/* 26126 */ {22,190},
+/* 26127 */ {22,190},
+/* 26128 */ {22,190},
+/* 26129 */ {22,190},
+/* 26130 */ {22,190},
+/* 26131 */ {22,190},
+/* 26132 */ {22,190},
+/* 26133 */ {22,190},
+/* 26134 */ {22,190},
+/* 26135 */ {22,190},
+/* 26136 */ {22,190},
+/* 26137 */ {22,190},
+/* 26138 */ {22,190},
+/* 26139 */ {22,190},
+/* 26140 */ {22,190},
+/* 26141 */ {22,190},
+/* 26142 */ {22,190},
+/* 26143 */ {22,190},
+/* 26144 */ {22,190},
+/* 26145 */ {22,190},
+/* 26146 */ {22,190},
+/* 26147 */ {22,190},
+/* 26148 */ {22,190},
+/* 26149 */ {22,190},
+/* 26150 */ {22,190},
+/* 26151 */ {22,190},
+/* 26152 */ {22,190},
+/* 26153 */ {22,190},
+/* 26154 */ {22,190},
+/* 26155 */ {22,190},
+/* 26156 */ {22,190},
+/* 26157 */ {22,190},
+/* 26158 */ {22,190},
+/* 26159 */ {22,190},
+/* 26160 */ {22,190},
+/* 26161 */ {22,190},
+/* 26162 */ {22,190},
+/* 26163 */ {22,190},
+/* 26164 */ {22,190},
+/* 26165 */ {22,190},
+/* 26166 */ {22,190},
+/* 26167 */ {22,190},
+/* 26168 */ {22,190},
+/* 26169 */ {22,190},
+/* 26170 */ {22,190},
+/* 26171 */ {22,190},
+/* 26172 */ {22,190},
+/* 26173 */ {22,190},
+/* 26174 */ {22,190},
+/* 26175 */ {22,190},
+/* 26176 */ {22,190},
+/* 26177 */ {22,190},
+/* 26178 */ {22,190},
+/* 26179 */ {22,190},
+/* 26180 */ {22,190},
+/* 26181 */ {22,190},
+/* 26182 */ {22,190},
+/* 26183 */ {22,190},
+/* 26184 */ {22,190},
+/* 26185 */ {22,190},
+/* 26186 */ {22,190},
+/* 26187 */ {22,190},
+/* 26188 */ {22,190},
+/* 26189 */ {22,190},
+/* 26190 */ {22,190},
+/* 26191 */ {22,190},
+/* 26192 */ {22,190},
+/* 26193 */ {22,190},
+/* 26194 */ {22,190},
+/* 26195 */ {22,190},
+/* 26196 */ {22,190},
+/* 26197 */ {22,190},
+/* 26198 */ {22,190},
+/* 26199 */ {22,190},
+/* 26200 */ {22,190},
+/* 26201 */ {22,190},
+/* 26202 */ {22,190},
+/* 26203 */ {22,190},
+/* 26204 */ {22,190},
+/* 26205 */ {22,190},
+/* 26206 */ {22,190},
+/* 26207 */ {22,190},
+/* 26208 */ {22,190},
+/* 26209 */ {22,190},
+/* 26210 */ {22,190},
+/* 26211 */ {22,190},
+/* 26212 */ {22,190},
+/* 26213 */ {22,190},
+/* 26214 */ {22,190},
+/* 26215 */ {22,190},
+/* 26216 */ {22,190},
+/* 26217 */ {22,190},
+/* 26218 */ {22,190},
+/* 26219 */ {22,190},
+/* 26220 */ {22,190},
+/* 26221 */ {22,190},
+/* 26222 */ {22,190},
+/* 26223 */ {22,190},
+/* 26224 */ {22,190},
+/* 26225 */ {22,190},
+/* 26226 */ {22,190},
+/* 26227 */ {22,190},
+/* 26228 */ {22,190},
+/* 26229 */ {22,190},
+/* 26230 */ {22,190},
+/* 26231 */ {22,190},
+/* 26232 */ {22,190},
+/* 26233 */ {22,190},
+/* 26234 */ {22,190},
+/* 26235 */ {22,190},
+/* 26236 */ {22,190},
+/* 26237 */ {22,190},
+/* 26238 */ {22,190},
+/* 26239 */ {22,190},
+/* 26240 */ {22,190},
+/* 26241 */ {22,190},
+/* 26242 */ {22,190},
+/* 26243 */ {22,190},
+/* 26244 */ {22,190},
+/* 26245 */ {22,190},
+/* 26246 */ {22,190},
+/* 26247 */ {22,190},
+/* 26248 */ {22,190},
+/* 26249 */ {22,190},
+/* 26250 */ {22,190},
+/* 26251 */ {22,190},
+/* 26252 */ {22,190},
+/* 26253 */ {22,190},
+/* 26254 */ {22,190},
+/* 26255 */ {22,190},
+/* 26256 */ {22,190},
+/* 26257 */ {22,190},
+/* 26258 */ {22,190},
+/* 26259 */ {22,190},
+/* 26260 */ {22,190},
+/* 26261 */ {22,190},
+/* 26262 */ {22,190},
+/* 26263 */ {22,190},
+/* 26264 */ {22,190},
+/* 26265 */ {22,190},
+/* 26266 */ {22,190},
+/* 26267 */ {22,190},
+/* 26268 */ {22,190},
+/* 26269 */ {22,190},
+/* 26270 */ {22,190},
+/* 26271 */ {22,190},
+/* 26272 */ {22,190},
+/* 26273 */ {22,190},
+/* 26274 */ {22,190},
+/* 26275 */ {22,190},
+/* 26276 */ {22,190},
+/* 26277 */ {22,190},
+/* 26278 */ {22,190},
+/* 26279 */ {22,190},
+/* 26280 */ {22,190},
+/* 26281 */ {22,190},
+/* 26282 */ {22,190},
+/* 26283 */ {22,190},
+/* 26284 */ {22,190},
+/* 26285 */ {22,190},
+/* 26286 */ {22,190},
+/* 26287 */ {22,190},
+/* 26288 */ {22,190},
+/* 26289 */ {22,190},
+/* 26290 */ {22,190},
+/* 26291 */ {22,190},
+/* 26292 */ {22,190},
+/* 26293 */ {22,190},
+/* 26294 */ {22,190},
+/* 26295 */ {22,190},
+/* 26296 */ {22,190},
+/* 26297 */ {22,190},
+/* 26298 */ {22,190},
+/* 26299 */ {22,190},
+/* 26300 */ {22,190},
+/* 26301 */ {22,190},
+/* 26302 */ {22,190},
+/* 26303 */ {22,190},
+/* 26304 */ {22,190},
+/* 26305 */ {22,190},
+/* 26306 */ {22,190},
+/* 26307 */ {22,190},
+/* 26308 */ {22,190},
+/* 26309 */ {22,190},
+/* 26310 */ {22,190},
+/* 26311 */ {22,190},
+/* 26312 */ {22,190},
+/* 26313 */ {22,190},
+/* 26314 */ {22,190},
+/* 26315 */ {22,190},
+/* 26316 */ {22,190},
+/* 26317 */ {22,190},
+/* 26318 */ {22,190},
+/* 26319 */ {22,190},
+/* 26320 */ {22,190},
+/* 26321 */ {22,190},
+/* 26322 */ {22,190},
+/* 26323 */ {22,190},
+/* 26324 */ {22,190},
+/* 26325 */ {22,190},
+/* 26326 */ {22,190},
+/* 26327 */ {22,190},
+/* 26328 */ {22,190},
+/* 26329 */ {22,190},
+/* 26330 */ {22,190},
+/* 26331 */ {22,190},
+/* 26332 */ {22,190},
+/* 26333 */ {22,190},
+/* 26334 */ {22,190},
+/* 26335 */ {22,190},
+/* 26336 */ {22,190},
+/* 26337 */ {22,190},
+/* 26338 */ {22,190},
+/* 26339 */ {22,190},
+/* 26340 */ {22,190},
+/* 26341 */ {22,190},
+/* 26342 */ {22,190},
+/* 26343 */ {22,190},
+/* 26344 */ {22,190},
+/* 26345 */ {22,190},
+/* 26346 */ {22,190},
+/* 26347 */ {22,190},
+/* 26348 */ {22,190},
+/* 26349 */ {22,190},
+/* 26350 */ {22,190},
+/* 26351 */ {22,190},
+/* 26352 */ {22,190},
+/* 26353 */ {22,190},
+/* 26354 */ {22,190},
+/* 26355 */ {22,190},
+/* 26356 */ {22,190},
+/* 26357 */ {22,190},
+/* 26358 */ {22,190},
+/* 26359 */ {22,190},
+/* 26360 */ {22,190},
+/* 26361 */ {22,190},
+/* 26362 */ {22,190},
+/* 26363 */ {22,190},
+/* 26364 */ {22,190},
+/* 26365 */ {22,190},
+/* 26366 */ {22,190},
+/* 26367 */ {22,190},
+/* 26368 */ {22,196},
+/* 26369 */ {22,196},
+/* 26370 */ {22,196},
+/* 26371 */ {22,196},
+/* 26372 */ {22,196},
+/* 26373 */ {22,196},
+/* 26374 */ {22,196},
+/* 26375 */ {22,196},
+/* 26376 */ {22,196},
+/* 26377 */ {22,196},
+/* 26378 */ {22,196},
+/* 26379 */ {22,196},
+/* 26380 */ {22,196},
+/* 26381 */ {22,196},
+/* 26382 */ {22,196},
+/* 26383 */ {22,196},
+/* 26384 */ {22,196},
+/* 26385 */ {22,196},
+/* 26386 */ {22,196},
+/* 26387 */ {22,196},
+/* 26388 */ {22,196},
+/* 26389 */ {22,196},
+/* 26390 */ {22,196},
+/* 26391 */ {22,196},
+/* 26392 */ {22,196},
+/* 26393 */ {22,196},
+/* 26394 */ {22,196},
+/* 26395 */ {22,196},
+/* 26396 */ {22,196},
+/* 26397 */ {22,196},
+/* 26398 */ {22,196},
+/* 26399 */ {22,196},
+/* 26400 */ {22,196},
+/* 26401 */ {22,196},
+/* 26402 */ {22,196},
+/* 26403 */ {22,196},
+/* 26404 */ {22,196},
+/* 26405 */ {22,196},
+/* 26406 */ {22,196},
+/* 26407 */ {22,196},
+/* 26408 */ {22,196},
+/* 26409 */ {22,196},
+/* 26410 */ {22,196},
+/* 26411 */ {22,196},
+/* 26412 */ {22,196},
+/* 26413 */ {22,196},
+/* 26414 */ {22,196},
+/* 26415 */ {22,196},
+/* 26416 */ {22,196},
+/* 26417 */ {22,196},
+/* 26418 */ {22,196},
+/* 26419 */ {22,196},
+/* 26420 */ {22,196},
+/* 26421 */ {22,196},
+/* 26422 */ {22,196},
+/* 26423 */ {22,196},
+/* 26424 */ {22,196},
+/* 26425 */ {22,196},
+/* 26426 */ {22,196},
+/* 26427 */ {22,196},
+/* 26428 */ {22,196},
+/* 26429 */ {22,196},
+/* 26430 */ {22,196},
+/* 26431 */ {22,196},
+/* 26432 */ {22,196},
+/* 26433 */ {22,196},
+/* 26434 */ {22,196},
+/* 26435 */ {22,196},
+/* 26436 */ {22,196},
+/* 26437 */ {22,196},
+/* 26438 */ {22,196},
+/* 26439 */ {22,196},
+/* 26440 */ {22,196},
+/* 26441 */ {22,196},
+/* 26442 */ {22,196},
+/* 26443 */ {22,196},
+/* 26444 */ {22,196},
+/* 26445 */ {22,196},
+/* 26446 */ {22,196},
+/* 26447 */ {22,196},
+/* 26448 */ {22,196},
+/* 26449 */ {22,196},
+/* 26450 */ {22,196},
+/* 26451 */ {22,196},
+/* 26452 */ {22,196},
+/* 26453 */ {22,196},
+/* 26454 */ {22,196},
+/* 26455 */ {22,196},
+/* 26456 */ {22,196},
+/* 26457 */ {22,196},
+/* 26458 */ {22,196},
+/* 26459 */ {22,196},
+/* 26460 */ {22,196},
+/* 26461 */ {22,196},
+/* 26462 */ {22,196},
+/* 26463 */ {22,196},
+/* 26464 */ {22,196},
+/* 26465 */ {22,196},
+/* 26466 */ {22,196},
+/* 26467 */ {22,196},
+/* 26468 */ {22,196},
+/* 26469 */ {22,196},
+/* 26470 */ {22,196},
+/* 26471 */ {22,196},
+/* 26472 */ {22,196},
+/* 26473 */ {22,196},
+/* 26474 */ {22,196},
+/* 26475 */ {22,196},
+/* 26476 */ {22,196},
+/* 26477 */ {22,196},
+/* 26478 */ {22,196},
+/* 26479 */ {22,196},
+/* 26480 */ {22,196},
+/* 26481 */ {22,196},
+/* 26482 */ {22,196},
+/* 26483 */ {22,196},
+/* 26484 */ {22,196},
+/* 26485 */ {22,196},
+/* 26486 */ {22,196},
+/* 26487 */ {22,196},
+/* 26488 */ {22,196},
+/* 26489 */ {22,196},
+/* 26490 */ {22,196},
+/* 26491 */ {22,196},
+/* 26492 */ {22,196},
+/* 26493 */ {22,196},
+/* 26494 */ {22,196},
+/* 26495 */ {22,196},
+/* 26496 */ {22,196},
+/* 26497 */ {22,196},
+/* 26498 */ {22,196},
+/* 26499 */ {22,196},
+/* 26500 */ {22,196},
+/* 26501 */ {22,196},
+/* 26502 */ {22,196},
+/* 26503 */ {22,196},
+/* 26504 */ {22,196},
+/* 26505 */ {22,196},
+/* 26506 */ {22,196},
+/* 26507 */ {22,196},
+/* 26508 */ {22,196},
+/* 26509 */ {22,196},
+/* 26510 */ {22,196},
+/* 26511 */ {22,196},
+/* 26512 */ {22,196},
+/* 26513 */ {22,196},
+/* 26514 */ {22,196},
+/* 26515 */ {22,196},
+/* 26516 */ {22,196},
+/* 26517 */ {22,196},
+/* 26518 */ {22,196},
+/* 26519 */ {22,196},
+/* 26520 */ {22,196},
+/* 26521 */ {22,196},
+/* 26522 */ {22,196},
+/* 26523 */ {22,196},
+/* 26524 */ {22,196},
+/* 26525 */ {22,196},
+/* 26526 */ {22,196},
+/* 26527 */ {22,196},
+/* 26528 */ {22,196},
+/* 26529 */ {22,196},
+/* 26530 */ {22,196},
+/* 26531 */ {22,196},
+/* 26532 */ {22,196},
+/* 26533 */ {22,196},
+/* 26534 */ {22,196},
+/* 26535 */ {22,196},
+/* 26536 */ {22,196},
+/* 26537 */ {22,196},
+/* 26538 */ {22,196},
+/* 26539 */ {22,196},
+/* 26540 */ {22,196},
+/* 26541 */ {22,196},
+/* 26542 */ {22,196},
+/* 26543 */ {22,196},
+/* 26544 */ {22,196},
+/* 26545 */ {22,196},
+/* 26546 */ {22,196},
+/* 26547 */ {22,196},
+/* 26548 */ {22,196},
+/* 26549 */ {22,196},
+/* 26550 */ {22,196},
+/* 26551 */ {22,196},
+/* 26552 */ {22,196},
+/* 26553 */ {22,196},
+/* 26554 */ {22,196},
+/* 26555 */ {22,196},
+/* 26556 */ {22,196},
+/* 26557 */ {22,196},
+/* 26558 */ {22,196},
+/* 26559 */ {22,196},
+/* 26560 */ {22,196},
+/* 26561 */ {22,196},
+/* 26562 */ {22,196},
+/* 26563 */ {22,196},
+/* 26564 */ {22,196},
+/* 26565 */ {22,196},
+/* 26566 */ {22,196},
+/* 26567 */ {22,196},
+/* 26568 */ {22,196},
+/* 26569 */ {22,196},
+/* 26570 */ {22,196},
+/* 26571 */ {22,196},
+/* 26572 */ {22,196},
+/* 26573 */ {22,196},
+/* 26574 */ {22,196},
+/* 26575 */ {22,196},
+/* 26576 */ {22,196},
+/* 26577 */ {22,196},
+/* 26578 */ {22,196},
+/* 26579 */ {22,196},
+/* 26580 */ {22,196},
+/* 26581 */ {22,196},
+/* 26582 */ {22,196},
+/* 26583 */ {22,196},
+/* 26584 */ {22,196},
+/* 26585 */ {22,196},
+/* 26586 */ {22,196},
+/* 26587 */ {22,196},
+/* 26588 */ {22,196},
+/* 26589 */ {22,196},
+/* 26590 */ {22,196},
+/* 26591 */ {22,196},
+/* 26592 */ {22,196},
+/* 26593 */ {22,196},
+/* 26594 */ {22,196},
+/* 26595 */ {22,196},
+/* 26596 */ {22,196},
+/* 26597 */ {22,196},
+/* 26598 */ {22,196},
+/* 26599 */ {22,196},
+/* 26600 */ {22,196},
+/* 26601 */ {22,196},
+/* 26602 */ {22,196},
+/* 26603 */ {22,196},
+/* 26604 */ {22,196},
+/* 26605 */ {22,196},
+/* 26606 */ {22,196},
+/* 26607 */ {22,196},
+/* 26608 */ {22,196},
+/* 26609 */ {22,196},
+/* 26610 */ {22,196},
+/* 26611 */ {22,196},
+/* 26612 */ {22,196},
+/* 26613 */ {22,196},
+/* 26614 */ {22,196},
+/* 26615 */ {22,196},
+/* 26616 */ {22,196},
+/* 26617 */ {22,196},
+/* 26618 */ {22,196},
+/* 26619 */ {22,196},
+/* 26620 */ {22,196},
+/* 26621 */ {22,196},
+/* 26622 */ {22,196},
+/* 26623 */ {22,196},
+/* 26624 */ {22,198},
+/* 26625 */ {22,198},
+/* 26626 */ {22,198},
+/* 26627 */ {22,198},
+/* 26628 */ {22,198},
+/* 26629 */ {22,198},
+/* 26630 */ {22,198},
+/* 26631 */ {22,198},
+/* 26632 */ {22,198},
+/* 26633 */ {22,198},
+/* 26634 */ {22,198},
+/* 26635 */ {22,198},
+/* 26636 */ {22,198},
+/* 26637 */ {22,198},
+/* 26638 */ {22,198},
+/* 26639 */ {22,198},
+/* 26640 */ {22,198},
+/* 26641 */ {22,198},
+/* 26642 */ {22,198},
+/* 26643 */ {22,198},
+/* 26644 */ {22,198},
+/* 26645 */ {22,198},
+/* 26646 */ {22,198},
+/* 26647 */ {22,198},
+/* 26648 */ {22,198},
+/* 26649 */ {22,198},
+/* 26650 */ {22,198},
+/* 26651 */ {22,198},
+/* 26652 */ {22,198},
+/* 26653 */ {22,198},
+/* 26654 */ {22,198},
+/* 26655 */ {22,198},
+/* 26656 */ {22,198},
+/* 26657 */ {22,198},
+/* 26658 */ {22,198},
+/* 26659 */ {22,198},
+/* 26660 */ {22,198},
+/* 26661 */ {22,198},
+/* 26662 */ {22,198},
+/* 26663 */ {22,198},
+/* 26664 */ {22,198},
+/* 26665 */ {22,198},
+/* 26666 */ {22,198},
+/* 26667 */ {22,198},
+/* 26668 */ {22,198},
+/* 26669 */ {22,198},
+/* 26670 */ {22,198},
+/* 26671 */ {22,198},
+/* 26672 */ {22,198},
+/* 26673 */ {22,198},
+/* 26674 */ {22,198},
+/* 26675 */ {22,198},
+/* 26676 */ {22,198},
+/* 26677 */ {22,198},
+/* 26678 */ {22,198},
+/* 26679 */ {22,198},
+/* 26680 */ {22,198},
+/* 26681 */ {22,198},
+/* 26682 */ {22,198},
+/* 26683 */ {22,198},
+/* 26684 */ {22,198},
+/* 26685 */ {22,198},
+/* 26686 */ {22,198},
+/* 26687 */ {22,198},
+/* 26688 */ {22,198},
+/* 26689 */ {22,198},
+/* 26690 */ {22,198},
+/* 26691 */ {22,198},
+/* 26692 */ {22,198},
+/* 26693 */ {22,198},
+/* 26694 */ {22,198},
+/* 26695 */ {22,198},
+/* 26696 */ {22,198},
+/* 26697 */ {22,198},
+/* 26698 */ {22,198},
+/* 26699 */ {22,198},
+/* 26700 */ {22,198},
+/* 26701 */ {22,198},
+/* 26702 */ {22,198},
+/* 26703 */ {22,198},
+/* 26704 */ {22,198},
+/* 26705 */ {22,198},
+/* 26706 */ {22,198},
+/* 26707 */ {22,198},
+/* 26708 */ {22,198},
+/* 26709 */ {22,198},
+/* 26710 */ {22,198},
+/* 26711 */ {22,198},
+/* 26712 */ {22,198},
+/* 26713 */ {22,198},
+/* 26714 */ {22,198},
+/* 26715 */ {22,198},
+/* 26716 */ {22,198},
+/* 26717 */ {22,198},
+/* 26718 */ {22,198},
+/* 26719 */ {22,198},
+/* 26720 */ {22,198},
+/* 26721 */ {22,198},
+/* 26722 */ {22,198},
+/* 26723 */ {22,198},
+/* 26724 */ {22,198},
+/* 26725 */ {22,198},
+/* 26726 */ {22,198},
+/* 26727 */ {22,198},
+/* 26728 */ {22,198},
+/* 26729 */ {22,198},
+/* 26730 */ {22,198},
+/* 26731 */ {22,198},
+/* 26732 */ {22,198},
+/* 26733 */ {22,198},
+/* 26734 */ {22,198},
+/* 26735 */ {22,198},
+/* 26736 */ {22,198},
+/* 26737 */ {22,198},
+/* 26738 */ {22,198},
+/* 26739 */ {22,198},
+/* 26740 */ {22,198},
+/* 26741 */ {22,198},
+/* 26742 */ {22,198},
+/* 26743 */ {22,198},
+/* 26744 */ {22,198},
+/* 26745 */ {22,198},
+/* 26746 */ {22,198},
+/* 26747 */ {22,198},
+/* 26748 */ {22,198},
+/* 26749 */ {22,198},
+/* 26750 */ {22,198},
+/* 26751 */ {22,198},
+/* 26752 */ {22,198},
+/* 26753 */ {22,198},
+/* 26754 */ {22,198},
+/* 26755 */ {22,198},
+/* 26756 */ {22,198},
+/* 26757 */ {22,198},
+/* 26758 */ {22,198},
+/* 26759 */ {22,198},
+/* 26760 */ {22,198},
+/* 26761 */ {22,198},
+/* 26762 */ {22,198},
+/* 26763 */ {22,198},
+/* 26764 */ {22,198},
+/* 26765 */ {22,198},
+/* 26766 */ {22,198},
+/* 26767 */ {22,198},
+/* 26768 */ {22,198},
+/* 26769 */ {22,198},
+/* 26770 */ {22,198},
+/* 26771 */ {22,198},
+/* 26772 */ {22,198},
+/* 26773 */ {22,198},
+/* 26774 */ {22,198},
+/* 26775 */ {22,198},
+/* 26776 */ {22,198},
+/* 26777 */ {22,198},
+/* 26778 */ {22,198},
+/* 26779 */ {22,198},
+/* 26780 */ {22,198},
+/* 26781 */ {22,198},
+/* 26782 */ {22,198},
+/* 26783 */ {22,198},
+/* 26784 */ {22,198},
+/* 26785 */ {22,198},
+/* 26786 */ {22,198},
+/* 26787 */ {22,198},
+/* 26788 */ {22,198},
+/* 26789 */ {22,198},
+/* 26790 */ {22,198},
+/* 26791 */ {22,198},
+/* 26792 */ {22,198},
+/* 26793 */ {22,198},
+/* 26794 */ {22,198},
+/* 26795 */ {22,198},
+/* 26796 */ {22,198},
+/* 26797 */ {22,198},
+/* 26798 */ {22,198},
+/* 26799 */ {22,198},
+/* 26800 */ {22,198},
+/* 26801 */ {22,198},
+/* 26802 */ {22,198},
+/* 26803 */ {22,198},
+/* 26804 */ {22,198},
+/* 26805 */ {22,198},
+/* 26806 */ {22,198},
+/* 26807 */ {22,198},
+/* 26808 */ {22,198},
+/* 26809 */ {22,198},
+/* 26810 */ {22,198},
+/* 26811 */ {22,198},
+/* 26812 */ {22,198},
+/* 26813 */ {22,198},
+/* 26814 */ {22,198},
+/* 26815 */ {22,198},
+/* 26816 */ {22,198},
+/* 26817 */ {22,198},
+/* 26818 */ {22,198},
+/* 26819 */ {22,198},
+/* 26820 */ {22,198},
+/* 26821 */ {22,198},
+/* 26822 */ {22,198},
+/* 26823 */ {22,198},
+/* 26824 */ {22,198},
+/* 26825 */ {22,198},
+/* 26826 */ {22,198},
+/* 26827 */ {22,198},
+/* 26828 */ {22,198},
+/* 26829 */ {22,198},
+/* 26830 */ {22,198},
+/* 26831 */ {22,198},
+/* 26832 */ {22,198},
+/* 26833 */ {22,198},
+/* 26834 */ {22,198},
+/* 26835 */ {22,198},
+/* 26836 */ {22,198},
+/* 26837 */ {22,198},
+/* 26838 */ {22,198},
+/* 26839 */ {22,198},
+/* 26840 */ {22,198},
+/* 26841 */ {22,198},
+/* 26842 */ {22,198},
+/* 26843 */ {22,198},
+/* 26844 */ {22,198},
+/* 26845 */ {22,198},
+/* 26846 */ {22,198},
+/* 26847 */ {22,198},
+/* 26848 */ {22,198},
+/* 26849 */ {22,198},
+/* 26850 */ {22,198},
+/* 26851 */ {22,198},
+/* 26852 */ {22,198},
+/* 26853 */ {22,198},
+/* 26854 */ {22,198},
+/* 26855 */ {22,198},
+/* 26856 */ {22,198},
+/* 26857 */ {22,198},
+/* 26858 */ {22,198},
+/* 26859 */ {22,198},
+/* 26860 */ {22,198},
+/* 26861 */ {22,198},
+/* 26862 */ {22,198},
+/* 26863 */ {22,198},
+/* 26864 */ {22,198},
+/* 26865 */ {22,198},
+/* 26866 */ {22,198},
+/* 26867 */ {22,198},
+/* 26868 */ {22,198},
+/* 26869 */ {22,198},
+/* 26870 */ {22,198},
+/* 26871 */ {22,198},
+/* 26872 */ {22,198},
+/* 26873 */ {22,198},
+/* 26874 */ {22,198},
+/* 26875 */ {22,198},
+/* 26876 */ {22,198},
+/* 26877 */ {22,198},
+/* 26878 */ {22,198},
+/* 26879 */ {22,198},
+/* 26880 */ {22,228},
+/* 26881 */ {22,228},
+/* 26882 */ {22,228},
+/* 26883 */ {22,228},
+/* 26884 */ {22,228},
+/* 26885 */ {22,228},
+/* 26886 */ {22,228},
+/* 26887 */ {22,228},
+/* 26888 */ {22,228},
+/* 26889 */ {22,228},
+/* 26890 */ {22,228},
+/* 26891 */ {22,228},
+/* 26892 */ {22,228},
+/* 26893 */ {22,228},
+/* 26894 */ {22,228},
+/* 26895 */ {22,228},
+/* 26896 */ {22,228},
+/* 26897 */ {22,228},
+/* 26898 */ {22,228},
+/* 26899 */ {22,228},
+/* 26900 */ {22,228},
+/* 26901 */ {22,228},
+/* 26902 */ {22,228},
+/* 26903 */ {22,228},
+/* 26904 */ {22,228},
+/* 26905 */ {22,228},
+/* 26906 */ {22,228},
+/* 26907 */ {22,228},
+/* 26908 */ {22,228},
+/* 26909 */ {22,228},
+/* 26910 */ {22,228},
+/* 26911 */ {22,228},
+/* 26912 */ {22,228},
+/* 26913 */ {22,228},
+/* 26914 */ {22,228},
+/* 26915 */ {22,228},
+/* 26916 */ {22,228},
+/* 26917 */ {22,228},
+/* 26918 */ {22,228},
+/* 26919 */ {22,228},
+/* 26920 */ {22,228},
+/* 26921 */ {22,228},
+/* 26922 */ {22,228},
+/* 26923 */ {22,228},
+/* 26924 */ {22,228},
+/* 26925 */ {22,228},
+/* 26926 */ {22,228},
+/* 26927 */ {22,228},
+/* 26928 */ {22,228},
+/* 26929 */ {22,228},
+/* 26930 */ {22,228},
+/* 26931 */ {22,228},
+/* 26932 */ {22,228},
+/* 26933 */ {22,228},
+/* 26934 */ {22,228},
+/* 26935 */ {22,228},
+/* 26936 */ {22,228},
+/* 26937 */ {22,228},
+/* 26938 */ {22,228},
+/* 26939 */ {22,228},
+/* 26940 */ {22,228},
+/* 26941 */ {22,228},
+/* 26942 */ {22,228},
+/* 26943 */ {22,228},
+/* 26944 */ {22,228},
+/* 26945 */ {22,228},
+/* 26946 */ {22,228},
+/* 26947 */ {22,228},
+/* 26948 */ {22,228},
+/* 26949 */ {22,228},
+/* 26950 */ {22,228},
+/* 26951 */ {22,228},
+/* 26952 */ {22,228},
+/* 26953 */ {22,228},
+/* 26954 */ {22,228},
+/* 26955 */ {22,228},
+/* 26956 */ {22,228},
+/* 26957 */ {22,228},
+/* 26958 */ {22,228},
+/* 26959 */ {22,228},
+/* 26960 */ {22,228},
+/* 26961 */ {22,228},
+/* 26962 */ {22,228},
+/* 26963 */ {22,228},
+/* 26964 */ {22,228},
+/* 26965 */ {22,228},
+/* 26966 */ {22,228},
+/* 26967 */ {22,228},
+/* 26968 */ {22,228},
+/* 26969 */ {22,228},
+/* 26970 */ {22,228},
+/* 26971 */ {22,228},
+/* 26972 */ {22,228},
+/* 26973 */ {22,228},
+/* 26974 */ {22,228},
+/* 26975 */ {22,228},
+/* 26976 */ {22,228},
+/* 26977 */ {22,228},
+/* 26978 */ {22,228},
+/* 26979 */ {22,228},
+/* 26980 */ {22,228},
+/* 26981 */ {22,228},
+/* 26982 */ {22,228},
+/* 26983 */ {22,228},
+/* 26984 */ {22,228},
+/* 26985 */ {22,228},
+/* 26986 */ {22,228},
+/* 26987 */ {22,228},
+/* 26988 */ {22,228},
+/* 26989 */ {22,228},
+/* 26990 */ {22,228},
+/* 26991 */ {22,228},
+/* 26992 */ {22,228},
+/* 26993 */ {22,228},
+/* 26994 */ {22,228},
+/* 26995 */ {22,228},
+/* 26996 */ {22,228},
+/* 26997 */ {22,228},
+/* 26998 */ {22,228},
+/* 26999 */ {22,228},
+/* 27000 */ {22,228},
+/* 27001 */ {22,228},
+/* 27002 */ {22,228},
+/* 27003 */ {22,228},
+/* 27004 */ {22,228},
+/* 27005 */ {22,228},
+/* 27006 */ {22,228},
+/* 27007 */ {22,228},
+/* 27008 */ {22,228},
+/* 27009 */ {22,228},
+/* 27010 */ {22,228},
+/* 27011 */ {22,228},
+/* 27012 */ {22,228},
+/* 27013 */ {22,228},
+/* 27014 */ {22,228},
+/* 27015 */ {22,228},
+/* 27016 */ {22,228},
+/* 27017 */ {22,228},
+/* 27018 */ {22,228},
+/* 27019 */ {22,228},
+/* 27020 */ {22,228},
+/* 27021 */ {22,228},
+/* 27022 */ {22,228},
+/* 27023 */ {22,228},
+/* 27024 */ {22,228},
+/* 27025 */ {22,228},
+/* 27026 */ {22,228},
+/* 27027 */ {22,228},
+/* 27028 */ {22,228},
+/* 27029 */ {22,228},
+/* 27030 */ {22,228},
+/* 27031 */ {22,228},
+/* 27032 */ {22,228},
+/* 27033 */ {22,228},
+/* 27034 */ {22,228},
+/* 27035 */ {22,228},
+/* 27036 */ {22,228},
+/* 27037 */ {22,228},
+/* 27038 */ {22,228},
+/* 27039 */ {22,228},
+/* 27040 */ {22,228},
+/* 27041 */ {22,228},
+/* 27042 */ {22,228},
+/* 27043 */ {22,228},
+/* 27044 */ {22,228},
+/* 27045 */ {22,228},
+/* 27046 */ {22,228},
+/* 27047 */ {22,228},
+/* 27048 */ {22,228},
+/* 27049 */ {22,228},
+/* 27050 */ {22,228},
+/* 27051 */ {22,228},
+/* 27052 */ {22,228},
+/* 27053 */ {22,228},
+/* 27054 */ {22,228},
+/* 27055 */ {22,228},
+/* 27056 */ {22,228},
+/* 27057 */ {22,228},
+/* 27058 */ {22,228},
+/* 27059 */ {22,228},
+/* 27060 */ {22,228},
+/* 27061 */ {22,228},
+/* 27062 */ {22,228},
+/* 27063 */ {22,228},
+/* 27064 */ {22,228},
+/* 27065 */ {22,228},
+/* 27066 */ {22,228},
+/* 27067 */ {22,228},
+/* 27068 */ {22,228},
+/* 27069 */ {22,228},
+/* 27070 */ {22,228},
+/* 27071 */ {22,228},
+/* 27072 */ {22,228},
+/* 27073 */ {22,228},
+/* 27074 */ {22,228},
+/* 27075 */ {22,228},
+/* 27076 */ {22,228},
+/* 27077 */ {22,228},
+/* 27078 */ {22,228},
+/* 27079 */ {22,228},
+/* 27080 */ {22,228},
+/* 27081 */ {22,228},
+/* 27082 */ {22,228},
+/* 27083 */ {22,228},
+/* 27084 */ {22,228},
+/* 27085 */ {22,228},
+/* 27086 */ {22,228},
+/* 27087 */ {22,228},
+/* 27088 */ {22,228},
+/* 27089 */ {22,228},
+/* 27090 */ {22,228},
+/* 27091 */ {22,228},
+/* 27092 */ {22,228},
+/* 27093 */ {22,228},
+/* 27094 */ {22,228},
+/* 27095 */ {22,228},
+/* 27096 */ {22,228},
+/* 27097 */ {22,228},
+/* 27098 */ {22,228},
+/* 27099 */ {22,228},
+/* 27100 */ {22,228},
+/* 27101 */ {22,228},
+/* 27102 */ {22,228},
+/* 27103 */ {22,228},
+/* 27104 */ {22,228},
+/* 27105 */ {22,228},
+/* 27106 */ {22,228},
+/* 27107 */ {22,228},
+/* 27108 */ {22,228},
+/* 27109 */ {22,228},
+/* 27110 */ {22,228},
+/* 27111 */ {22,228},
+/* 27112 */ {22,228},
+/* 27113 */ {22,228},
+/* 27114 */ {22,228},
+/* 27115 */ {22,228},
+/* 27116 */ {22,228},
+/* 27117 */ {22,228},
+/* 27118 */ {22,228},
+/* 27119 */ {22,228},
+/* 27120 */ {22,228},
+/* 27121 */ {22,228},
+/* 27122 */ {22,228},
+/* 27123 */ {22,228},
+/* 27124 */ {22,228},
+/* 27125 */ {22,228},
+/* 27126 */ {22,228},
+/* 27127 */ {22,228},
+/* 27128 */ {22,228},
+/* 27129 */ {22,228},
+/* 27130 */ {22,228},
+/* 27131 */ {22,228},
+/* 27132 */ {22,228},
+/* 27133 */ {22,228},
+/* 27134 */ {22,228},
+/* 27135 */ {22,228},
+/* 27136 */ {22,232},
+/* 27137 */ {22,232},
+/* 27138 */ {22,232},
+/* 27139 */ {22,232},
+/* 27140 */ {22,232},
+/* 27141 */ {22,232},
+/* 27142 */ {22,232},
+/* 27143 */ {22,232},
+/* 27144 */ {22,232},
+/* 27145 */ {22,232},
+/* 27146 */ {22,232},
+/* 27147 */ {22,232},
+/* 27148 */ {22,232},
+/* 27149 */ {22,232},
+/* 27150 */ {22,232},
+/* 27151 */ {22,232},
+/* 27152 */ {22,232},
+/* 27153 */ {22,232},
+/* 27154 */ {22,232},
+/* 27155 */ {22,232},
+/* 27156 */ {22,232},
+/* 27157 */ {22,232},
+/* 27158 */ {22,232},
+/* 27159 */ {22,232},
+/* 27160 */ {22,232},
+/* 27161 */ {22,232},
+/* 27162 */ {22,232},
+/* 27163 */ {22,232},
+/* 27164 */ {22,232},
+/* 27165 */ {22,232},
+/* 27166 */ {22,232},
+/* 27167 */ {22,232},
+/* 27168 */ {22,232},
+/* 27169 */ {22,232},
+/* 27170 */ {22,232},
+/* 27171 */ {22,232},
+/* 27172 */ {22,232},
+/* 27173 */ {22,232},
+/* 27174 */ {22,232},
+/* 27175 */ {22,232},
+/* 27176 */ {22,232},
+/* 27177 */ {22,232},
+/* 27178 */ {22,232},
+/* 27179 */ {22,232},
+/* 27180 */ {22,232},
+/* 27181 */ {22,232},
+/* 27182 */ {22,232},
+/* 27183 */ {22,232},
+/* 27184 */ {22,232},
+/* 27185 */ {22,232},
+/* 27186 */ {22,232},
+/* 27187 */ {22,232},
+/* 27188 */ {22,232},
+/* 27189 */ {22,232},
+/* 27190 */ {22,232},
+/* 27191 */ {22,232},
+/* 27192 */ {22,232},
+/* 27193 */ {22,232},
+/* 27194 */ {22,232},
+/* 27195 */ {22,232},
+/* 27196 */ {22,232},
+/* 27197 */ {22,232},
+/* 27198 */ {22,232},
+/* 27199 */ {22,232},
+/* 27200 */ {22,232},
+/* 27201 */ {22,232},
+/* 27202 */ {22,232},
+/* 27203 */ {22,232},
+/* 27204 */ {22,232},
+/* 27205 */ {22,232},
+/* 27206 */ {22,232},
+/* 27207 */ {22,232},
+/* 27208 */ {22,232},
+/* 27209 */ {22,232},
+/* 27210 */ {22,232},
+/* 27211 */ {22,232},
+/* 27212 */ {22,232},
+/* 27213 */ {22,232},
+/* 27214 */ {22,232},
+/* 27215 */ {22,232},
+/* 27216 */ {22,232},
+/* 27217 */ {22,232},
+/* 27218 */ {22,232},
+/* 27219 */ {22,232},
+/* 27220 */ {22,232},
+/* 27221 */ {22,232},
+/* 27222 */ {22,232},
+/* 27223 */ {22,232},
+/* 27224 */ {22,232},
+/* 27225 */ {22,232},
+/* 27226 */ {22,232},
+/* 27227 */ {22,232},
+/* 27228 */ {22,232},
+/* 27229 */ {22,232},
+/* 27230 */ {22,232},
+/* 27231 */ {22,232},
+/* 27232 */ {22,232},
+/* 27233 */ {22,232},
+/* 27234 */ {22,232},
+/* 27235 */ {22,232},
+/* 27236 */ {22,232},
+/* 27237 */ {22,232},
+/* 27238 */ {22,232},
+/* 27239 */ {22,232},
+/* 27240 */ {22,232},
+/* 27241 */ {22,232},
+/* 27242 */ {22,232},
+/* 27243 */ {22,232},
+/* 27244 */ {22,232},
+/* 27245 */ {22,232},
+/* 27246 */ {22,232},
+/* 27247 */ {22,232},
+/* 27248 */ {22,232},
+/* 27249 */ {22,232},
+/* 27250 */ {22,232},
+/* 27251 */ {22,232},
+/* 27252 */ {22,232},
+/* 27253 */ {22,232},
+/* 27254 */ {22,232},
+/* 27255 */ {22,232},
+/* 27256 */ {22,232},
+/* 27257 */ {22,232},
+/* 27258 */ {22,232},
+/* 27259 */ {22,232},
+/* 27260 */ {22,232},
+/* 27261 */ {22,232},
+/* 27262 */ {22,232},
+/* 27263 */ {22,232},
+/* 27264 */ {22,232},
+/* 27265 */ {22,232},
+/* 27266 */ {22,232},
+/* 27267 */ {22,232},
+/* 27268 */ {22,232},
+/* 27269 */ {22,232},
+/* 27270 */ {22,232},
+/* 27271 */ {22,232},
+/* 27272 */ {22,232},
+/* 27273 */ {22,232},
+/* 27274 */ {22,232},
+/* 27275 */ {22,232},
+/* 27276 */ {22,232},
+/* 27277 */ {22,232},
+/* 27278 */ {22,232},
+/* 27279 */ {22,232},
+/* 27280 */ {22,232},
+/* 27281 */ {22,232},
+/* 27282 */ {22,232},
+/* 27283 */ {22,232},
+/* 27284 */ {22,232},
+/* 27285 */ {22,232},
+/* 27286 */ {22,232},
+/* 27287 */ {22,232},
+/* 27288 */ {22,232},
+/* 27289 */ {22,232},
+/* 27290 */ {22,232},
+/* 27291 */ {22,232},
+/* 27292 */ {22,232},
+/* 27293 */ {22,232},
+/* 27294 */ {22,232},
+/* 27295 */ {22,232},
+/* 27296 */ {22,232},
+/* 27297 */ {22,232},
+/* 27298 */ {22,232},
+/* 27299 */ {22,232},
+/* 27300 */ {22,232},
+/* 27301 */ {22,232},
+/* 27302 */ {22,232},
+/* 27303 */ {22,232},
+/* 27304 */ {22,232},
+/* 27305 */ {22,232},
+/* 27306 */ {22,232},
+/* 27307 */ {22,232},
+/* 27308 */ {22,232},
+/* 27309 */ {22,232},
+/* 27310 */ {22,232},
+/* 27311 */ {22,232},
+/* 27312 */ {22,232},
+/* 27313 */ {22,232},
+/* 27314 */ {22,232},
+/* 27315 */ {22,232},
+/* 27316 */ {22,232},
+/* 27317 */ {22,232},
+/* 27318 */ {22,232},
+/* 27319 */ {22,232},
+/* 27320 */ {22,232},
+/* 27321 */ {22,232},
+/* 27322 */ {22,232},
+/* 27323 */ {22,232},
+/* 27324 */ {22,232},
+/* 27325 */ {22,232},
+/* 27326 */ {22,232},
+/* 27327 */ {22,232},
+/* 27328 */ {22,232},
+/* 27329 */ {22,232},
+/* 27330 */ {22,232},
+/* 27331 */ {22,232},
+/* 27332 */ {22,232},
+/* 27333 */ {22,232},
+/* 27334 */ {22,232},
+/* 27335 */ {22,232},
+/* 27336 */ {22,232},
+/* 27337 */ {22,232},
+/* 27338 */ {22,232},
+/* 27339 */ {22,232},
+/* 27340 */ {22,232},
+/* 27341 */ {22,232},
+/* 27342 */ {22,232},
+/* 27343 */ {22,232},
+/* 27344 */ {22,232},
+/* 27345 */ {22,232},
+/* 27346 */ {22,232},
+/* 27347 */ {22,232},
+/* 27348 */ {22,232},
+/* 27349 */ {22,232},
+/* 27350 */ {22,232},
+/* 27351 */ {22,232},
+/* 27352 */ {22,232},
+/* 27353 */ {22,232},
+/* 27354 */ {22,232},
+/* 27355 */ {22,232},
+/* 27356 */ {22,232},
+/* 27357 */ {22,232},
+/* 27358 */ {22,232},
+/* 27359 */ {22,232},
+/* 27360 */ {22,232},
+/* 27361 */ {22,232},
+/* 27362 */ {22,232},
+/* 27363 */ {22,232},
+/* 27364 */ {22,232},
+/* 27365 */ {22,232},
+/* 27366 */ {22,232},
+/* 27367 */ {22,232},
+/* 27368 */ {22,232},
+/* 27369 */ {22,232},
+/* 27370 */ {22,232},
+/* 27371 */ {22,232},
+/* 27372 */ {22,232},
+/* 27373 */ {22,232},
+/* 27374 */ {22,232},
+/* 27375 */ {22,232},
+/* 27376 */ {22,232},
+/* 27377 */ {22,232},
+/* 27378 */ {22,232},
+/* 27379 */ {22,232},
+/* 27380 */ {22,232},
+/* 27381 */ {22,232},
+/* 27382 */ {22,232},
+/* 27383 */ {22,232},
+/* 27384 */ {22,232},
+/* 27385 */ {22,232},
+/* 27386 */ {22,232},
+/* 27387 */ {22,232},
+/* 27388 */ {22,232},
+/* 27389 */ {22,232},
+/* 27390 */ {22,232},
+/* 27391 */ {22,232},
+/* 27392 */ {22,233},
+/* 27393 */ {22,233},
+/* 27394 */ {22,233},
+/* 27395 */ {22,233},
+/* 27396 */ {22,233},
+/* 27397 */ {22,233},
+/* 27398 */ {22,233},
+/* 27399 */ {22,233},
+/* 27400 */ {22,233},
+/* 27401 */ {22,233},
+/* 27402 */ {22,233},
+/* 27403 */ {22,233},
+/* 27404 */ {22,233},
+/* 27405 */ {22,233},
+/* 27406 */ {22,233},
+/* 27407 */ {22,233},
+/* 27408 */ {22,233},
+/* 27409 */ {22,233},
+/* 27410 */ {22,233},
+/* 27411 */ {22,233},
+/* 27412 */ {22,233},
+/* 27413 */ {22,233},
+/* 27414 */ {22,233},
+/* 27415 */ {22,233},
+/* 27416 */ {22,233},
+/* 27417 */ {22,233},
+/* 27418 */ {22,233},
+/* 27419 */ {22,233},
+/* 27420 */ {22,233},
+/* 27421 */ {22,233},
+/* 27422 */ {22,233},
+/* 27423 */ {22,233},
+/* 27424 */ {22,233},
+/* 27425 */ {22,233},
+/* 27426 */ {22,233},
+/* 27427 */ {22,233},
+/* 27428 */ {22,233},
+/* 27429 */ {22,233},
+/* 27430 */ {22,233},
+/* 27431 */ {22,233},
+/* 27432 */ {22,233},
+/* 27433 */ {22,233},
+/* 27434 */ {22,233},
+/* 27435 */ {22,233},
+/* 27436 */ {22,233},
+/* 27437 */ {22,233},
+/* 27438 */ {22,233},
+/* 27439 */ {22,233},
+/* 27440 */ {22,233},
+/* 27441 */ {22,233},
+/* 27442 */ {22,233},
+/* 27443 */ {22,233},
+/* 27444 */ {22,233},
+/* 27445 */ {22,233},
+/* 27446 */ {22,233},
+/* 27447 */ {22,233},
+/* 27448 */ {22,233},
+/* 27449 */ {22,233},
+/* 27450 */ {22,233},
+/* 27451 */ {22,233},
+/* 27452 */ {22,233},
+/* 27453 */ {22,233},
+/* 27454 */ {22,233},
+/* 27455 */ {22,233},
+/* 27456 */ {22,233},
+/* 27457 */ {22,233},
+/* 27458 */ {22,233},
+/* 27459 */ {22,233},
+/* 27460 */ {22,233},
+/* 27461 */ {22,233},
+/* 27462 */ {22,233},
+/* 27463 */ {22,233},
+/* 27464 */ {22,233},
+/* 27465 */ {22,233},
+/* 27466 */ {22,233},
+/* 27467 */ {22,233},
+/* 27468 */ {22,233},
+/* 27469 */ {22,233},
+/* 27470 */ {22,233},
+/* 27471 */ {22,233},
+/* 27472 */ {22,233},
+/* 27473 */ {22,233},
+/* 27474 */ {22,233},
+/* 27475 */ {22,233},
+/* 27476 */ {22,233},
+/* 27477 */ {22,233},
+/* 27478 */ {22,233},
+/* 27479 */ {22,233},
+/* 27480 */ {22,233},
+/* 27481 */ {22,233},
+/* 27482 */ {22,233},
+/* 27483 */ {22,233},
+/* 27484 */ {22,233},
+/* 27485 */ {22,233},
+/* 27486 */ {22,233},
+/* 27487 */ {22,233},
+/* 27488 */ {22,233},
+/* 27489 */ {22,233},
+/* 27490 */ {22,233},
+/* 27491 */ {22,233},
+/* 27492 */ {22,233},
+/* 27493 */ {22,233},
+/* 27494 */ {22,233},
+/* 27495 */ {22,233},
+/* 27496 */ {22,233},
+/* 27497 */ {22,233},
+/* 27498 */ {22,233},
+/* 27499 */ {22,233},
+/* 27500 */ {22,233},
+/* 27501 */ {22,233},
+/* 27502 */ {22,233},
+/* 27503 */ {22,233},
+/* 27504 */ {22,233},
+/* 27505 */ {22,233},
+/* 27506 */ {22,233},
+/* 27507 */ {22,233},
+/* 27508 */ {22,233},
+/* 27509 */ {22,233},
+/* 27510 */ {22,233},
+/* 27511 */ {22,233},
+/* 27512 */ {22,233},
+/* 27513 */ {22,233},
+/* 27514 */ {22,233},
+/* 27515 */ {22,233},
+/* 27516 */ {22,233},
+/* 27517 */ {22,233},
+/* 27518 */ {22,233},
+/* 27519 */ {22,233},
+/* 27520 */ {22,233},
+/* 27521 */ {22,233},
+/* 27522 */ {22,233},
+/* 27523 */ {22,233},
+/* 27524 */ {22,233},
+/* 27525 */ {22,233},
+/* 27526 */ {22,233},
+/* 27527 */ {22,233},
+/* 27528 */ {22,233},
+/* 27529 */ {22,233},
+/* 27530 */ {22,233},
+/* 27531 */ {22,233},
+/* 27532 */ {22,233},
+/* 27533 */ {22,233},
+/* 27534 */ {22,233},
+/* 27535 */ {22,233},
+/* 27536 */ {22,233},
+/* 27537 */ {22,233},
+/* 27538 */ {22,233},
+/* 27539 */ {22,233},
+/* 27540 */ {22,233},
+/* 27541 */ {22,233},
+/* 27542 */ {22,233},
+/* 27543 */ {22,233},
+/* 27544 */ {22,233},
+/* 27545 */ {22,233},
+/* 27546 */ {22,233},
+/* 27547 */ {22,233},
+/* 27548 */ {22,233},
+/* 27549 */ {22,233},
+/* 27550 */ {22,233},
+/* 27551 */ {22,233},
+/* 27552 */ {22,233},
+/* 27553 */ {22,233},
+/* 27554 */ {22,233},
+/* 27555 */ {22,233},
+/* 27556 */ {22,233},
+/* 27557 */ {22,233},
+/* 27558 */ {22,233},
+/* 27559 */ {22,233},
+/* 27560 */ {22,233},
+/* 27561 */ {22,233},
+/* 27562 */ {22,233},
+/* 27563 */ {22,233},
+/* 27564 */ {22,233},
+/* 27565 */ {22,233},
+/* 27566 */ {22,233},
+/* 27567 */ {22,233},
+/* 27568 */ {22,233},
+/* 27569 */ {22,233},
+/* 27570 */ {22,233},
+/* 27571 */ {22,233},
+/* 27572 */ {22,233},
+/* 27573 */ {22,233},
+/* 27574 */ {22,233},
+/* 27575 */ {22,233},
+/* 27576 */ {22,233},
+/* 27577 */ {22,233},
+/* 27578 */ {22,233},
+/* 27579 */ {22,233},
+/* 27580 */ {22,233},
+/* 27581 */ {22,233},
+/* 27582 */ {22,233},
+/* 27583 */ {22,233},
+/* 27584 */ {22,233},
+/* 27585 */ {22,233},
+/* 27586 */ {22,233},
+/* 27587 */ {22,233},
+/* 27588 */ {22,233},
+/* 27589 */ {22,233},
+/* 27590 */ {22,233},
+/* 27591 */ {22,233},
+/* 27592 */ {22,233},
+/* 27593 */ {22,233},
+/* 27594 */ {22,233},
+/* 27595 */ {22,233},
+/* 27596 */ {22,233},
+/* 27597 */ {22,233},
+/* 27598 */ {22,233},
+/* 27599 */ {22,233},
+/* 27600 */ {22,233},
+/* 27601 */ {22,233},
+/* 27602 */ {22,233},
+/* 27603 */ {22,233},
+/* 27604 */ {22,233},
+/* 27605 */ {22,233},
+/* 27606 */ {22,233},
+/* 27607 */ {22,233},
+/* 27608 */ {22,233},
+/* 27609 */ {22,233},
+/* 27610 */ {22,233},
+/* 27611 */ {22,233},
+/* 27612 */ {22,233},
+/* 27613 */ {22,233},
+/* 27614 */ {22,233},
+/* 27615 */ {22,233},
+/* 27616 */ {22,233},
+/* 27617 */ {22,233},
+/* 27618 */ {22,233},
+/* 27619 */ {22,233},
+/* 27620 */ {22,233},
+/* 27621 */ {22,233},
+/* 27622 */ {22,233},
+/* 27623 */ {22,233},
+/* 27624 */ {22,233},
+/* 27625 */ {22,233},
+/* 27626 */ {22,233},
+/* 27627 */ {22,233},
+/* 27628 */ {22,233},
+/* 27629 */ {22,233},
+/* 27630 */ {22,233},
+/* 27631 */ {22,233},
+/* 27632 */ {22,233},
+/* 27633 */ {22,233},
+/* 27634 */ {22,233},
+/* 27635 */ {22,233},
+/* 27636 */ {22,233},
+/* 27637 */ {22,233},
+/* 27638 */ {22,233},
+/* 27639 */ {22,233},
+/* 27640 */ {22,233},
+/* 27641 */ {22,233},
+/* 27642 */ {22,233},
+/* 27643 */ {22,233},
+/* 27644 */ {22,233},
+/* 27645 */ {22,233},
+/* 27646 */ {22,233},
+/* 27647 */ {22,233},
+/* 27648 */ {23,1},
+/* 27649 */ {23,1},
+/* 27650 */ {23,1},
+/* 27651 */ {23,1},
+/* 27652 */ {23,1},
+/* 27653 */ {23,1},
+/* 27654 */ {23,1},
+/* 27655 */ {23,1},
+/* 27656 */ {23,1},
+/* 27657 */ {23,1},
+/* 27658 */ {23,1},
+/* 27659 */ {23,1},
+/* 27660 */ {23,1},
+/* 27661 */ {23,1},
+/* 27662 */ {23,1},
+/* 27663 */ {23,1},
+/* 27664 */ {23,1},
+/* 27665 */ {23,1},
+/* 27666 */ {23,1},
+/* 27667 */ {23,1},
+/* 27668 */ {23,1},
+/* 27669 */ {23,1},
+/* 27670 */ {23,1},
+/* 27671 */ {23,1},
+/* 27672 */ {23,1},
+/* 27673 */ {23,1},
+/* 27674 */ {23,1},
+/* 27675 */ {23,1},
+/* 27676 */ {23,1},
+/* 27677 */ {23,1},
+/* 27678 */ {23,1},
+/* 27679 */ {23,1},
+/* 27680 */ {23,1},
+/* 27681 */ {23,1},
+/* 27682 */ {23,1},
+/* 27683 */ {23,1},
+/* 27684 */ {23,1},
+/* 27685 */ {23,1},
+/* 27686 */ {23,1},
+/* 27687 */ {23,1},
+/* 27688 */ {23,1},
+/* 27689 */ {23,1},
+/* 27690 */ {23,1},
+/* 27691 */ {23,1},
+/* 27692 */ {23,1},
+/* 27693 */ {23,1},
+/* 27694 */ {23,1},
+/* 27695 */ {23,1},
+/* 27696 */ {23,1},
+/* 27697 */ {23,1},
+/* 27698 */ {23,1},
+/* 27699 */ {23,1},
+/* 27700 */ {23,1},
+/* 27701 */ {23,1},
+/* 27702 */ {23,1},
+/* 27703 */ {23,1},
+/* 27704 */ {23,1},
+/* 27705 */ {23,1},
+/* 27706 */ {23,1},
+/* 27707 */ {23,1},
+/* 27708 */ {23,1},
+/* 27709 */ {23,1},
+/* 27710 */ {23,1},
+/* 27711 */ {23,1},
+/* 27712 */ {23,1},
+/* 27713 */ {23,1},
+/* 27714 */ {23,1},
+/* 27715 */ {23,1},
+/* 27716 */ {23,1},
+/* 27717 */ {23,1},
+/* 27718 */ {23,1},
+/* 27719 */ {23,1},
+/* 27720 */ {23,1},
+/* 27721 */ {23,1},
+/* 27722 */ {23,1},
+/* 27723 */ {23,1},
+/* 27724 */ {23,1},
+/* 27725 */ {23,1},
+/* 27726 */ {23,1},
+/* 27727 */ {23,1},
+/* 27728 */ {23,1},
+/* 27729 */ {23,1},
+/* 27730 */ {23,1},
+/* 27731 */ {23,1},
+/* 27732 */ {23,1},
+/* 27733 */ {23,1},
+/* 27734 */ {23,1},
+/* 27735 */ {23,1},
+/* 27736 */ {23,1},
+/* 27737 */ {23,1},
+/* 27738 */ {23,1},
+/* 27739 */ {23,1},
+/* 27740 */ {23,1},
+/* 27741 */ {23,1},
+/* 27742 */ {23,1},
+/* 27743 */ {23,1},
+/* 27744 */ {23,1},
+/* 27745 */ {23,1},
+/* 27746 */ {23,1},
+/* 27747 */ {23,1},
+/* 27748 */ {23,1},
+/* 27749 */ {23,1},
+/* 27750 */ {23,1},
+/* 27751 */ {23,1},
+/* 27752 */ {23,1},
+/* 27753 */ {23,1},
+/* 27754 */ {23,1},
+/* 27755 */ {23,1},
+/* 27756 */ {23,1},
+/* 27757 */ {23,1},
+/* 27758 */ {23,1},
+/* 27759 */ {23,1},
+/* 27760 */ {23,1},
+/* 27761 */ {23,1},
+/* 27762 */ {23,1},
+/* 27763 */ {23,1},
+/* 27764 */ {23,1},
+/* 27765 */ {23,1},
+/* 27766 */ {23,1},
+/* 27767 */ {23,1},
+/* 27768 */ {23,1},
+/* 27769 */ {23,1},
+/* 27770 */ {23,1},
+/* 27771 */ {23,1},
+/* 27772 */ {23,1},
+/* 27773 */ {23,1},
+/* 27774 */ {23,1},
+/* 27775 */ {23,1},
+/* 27776 */ {23,135},
+/* 27777 */ {23,135},
+/* 27778 */ {23,135},
+/* 27779 */ {23,135},
+/* 27780 */ {23,135},
+/* 27781 */ {23,135},
+/* 27782 */ {23,135},
+/* 27783 */ {23,135},
+/* 27784 */ {23,135},
+/* 27785 */ {23,135},
+/* 27786 */ {23,135},
+/* 27787 */ {23,135},
+/* 27788 */ {23,135},
+/* 27789 */ {23,135},
+/* 27790 */ {23,135},
+/* 27791 */ {23,135},
+/* 27792 */ {23,135},
+/* 27793 */ {23,135},
+/* 27794 */ {23,135},
+/* 27795 */ {23,135},
+/* 27796 */ {23,135},
+/* 27797 */ {23,135},
+/* 27798 */ {23,135},
+/* 27799 */ {23,135},
+/* 27800 */ {23,135},
+/* 27801 */ {23,135},
+/* 27802 */ {23,135},
+/* 27803 */ {23,135},
+/* 27804 */ {23,135},
+/* 27805 */ {23,135},
+/* 27806 */ {23,135},
+/* 27807 */ {23,135},
+/* 27808 */ {23,135},
+/* 27809 */ {23,135},
+/* 27810 */ {23,135},
+/* 27811 */ {23,135},
+/* 27812 */ {23,135},
+/* 27813 */ {23,135},
+/* 27814 */ {23,135},
+/* 27815 */ {23,135},
+/* 27816 */ {23,135},
+/* 27817 */ {23,135},
+/* 27818 */ {23,135},
+/* 27819 */ {23,135},
+/* 27820 */ {23,135},
+/* 27821 */ {23,135},
+/* 27822 */ {23,135},
+/* 27823 */ {23,135},
+/* 27824 */ {23,135},
+/* 27825 */ {23,135},
+/* 27826 */ {23,135},
+/* 27827 */ {23,135},
+/* 27828 */ {23,135},
+/* 27829 */ {23,135},
+/* 27830 */ {23,135},
+/* 27831 */ {23,135},
+/* 27832 */ {23,135},
+/* 27833 */ {23,135},
+/* 27834 */ {23,135},
+/* 27835 */ {23,135},
+/* 27836 */ {23,135},
+/* 27837 */ {23,135},
+/* 27838 */ {23,135},
+/* 27839 */ {23,135},
+/* 27840 */ {23,135},
+/* 27841 */ {23,135},
+/* 27842 */ {23,135},
+/* 27843 */ {23,135},
+/* 27844 */ {23,135},
+/* 27845 */ {23,135},
+/* 27846 */ {23,135},
+/* 27847 */ {23,135},
+/* 27848 */ {23,135},
+/* 27849 */ {23,135},
+/* 27850 */ {23,135},
+/* 27851 */ {23,135},
+/* 27852 */ {23,135},
+/* 27853 */ {23,135},
+/* 27854 */ {23,135},
+/* 27855 */ {23,135},
+/* 27856 */ {23,135},
+/* 27857 */ {23,135},
+/* 27858 */ {23,135},
+/* 27859 */ {23,135},
+/* 27860 */ {23,135},
+/* 27861 */ {23,135},
+/* 27862 */ {23,135},
+/* 27863 */ {23,135},
+/* 27864 */ {23,135},
+/* 27865 */ {23,135},
+/* 27866 */ {23,135},
+/* 27867 */ {23,135},
+/* 27868 */ {23,135},
+/* 27869 */ {23,135},
+/* 27870 */ {23,135},
+/* 27871 */ {23,135},
+/* 27872 */ {23,135},
+/* 27873 */ {23,135},
+/* 27874 */ {23,135},
+/* 27875 */ {23,135},
+/* 27876 */ {23,135},
+/* 27877 */ {23,135},
+/* 27878 */ {23,135},
+/* 27879 */ {23,135},
+/* 27880 */ {23,135},
+/* 27881 */ {23,135},
+/* 27882 */ {23,135},
+/* 27883 */ {23,135},
+/* 27884 */ {23,135},
+/* 27885 */ {23,135},
+/* 27886 */ {23,135},
+/* 27887 */ {23,135},
+/* 27888 */ {23,135},
+/* 27889 */ {23,135},
+/* 27890 */ {23,135},
+/* 27891 */ {23,135},
+/* 27892 */ {23,135},
+/* 27893 */ {23,135},
+/* 27894 */ {23,135},
+/* 27895 */ {23,135},
+/* 27896 */ {23,135},
+/* 27897 */ {23,135},
+/* 27898 */ {23,135},
+/* 27899 */ {23,135},
+/* 27900 */ {23,135},
+/* 27901 */ {23,135},
+/* 27902 */ {23,135},
+/* 27903 */ {23,135},
+/* 27904 */ {23,137},
+/* 27905 */ {23,137},
+/* 27906 */ {23,137},
+/* 27907 */ {23,137},
+/* 27908 */ {23,137},
+/* 27909 */ {23,137},
+/* 27910 */ {23,137},
+/* 27911 */ {23,137},
+/* 27912 */ {23,137},
+/* 27913 */ {23,137},
+/* 27914 */ {23,137},
+/* 27915 */ {23,137},
+/* 27916 */ {23,137},
+/* 27917 */ {23,137},
+/* 27918 */ {23,137},
+/* 27919 */ {23,137},
+/* 27920 */ {23,137},
+/* 27921 */ {23,137},
+/* 27922 */ {23,137},
+/* 27923 */ {23,137},
+/* 27924 */ {23,137},
+/* 27925 */ {23,137},
+/* 27926 */ {23,137},
+/* 27927 */ {23,137},
+/* 27928 */ {23,137},
+/* 27929 */ {23,137},
+/* 27930 */ {23,137},
+/* 27931 */ {23,137},
+/* 27932 */ {23,137},
+/* 27933 */ {23,137},
+/* 27934 */ {23,137},
+/* 27935 */ {23,137},
+/* 27936 */ {23,137},
+/* 27937 */ {23,137},
+/* 27938 */ {23,137},
+/* 27939 */ {23,137},
+/* 27940 */ {23,137},
+/* 27941 */ {23,137},
+/* 27942 */ {23,137},
+/* 27943 */ {23,137},
+/* 27944 */ {23,137},
+/* 27945 */ {23,137},
+/* 27946 */ {23,137},
+/* 27947 */ {23,137},
+/* 27948 */ {23,137},
+/* 27949 */ {23,137},
+/* 27950 */ {23,137},
+/* 27951 */ {23,137},
+/* 27952 */ {23,137},
+/* 27953 */ {23,137},
+/* 27954 */ {23,137},
+/* 27955 */ {23,137},
+/* 27956 */ {23,137},
+/* 27957 */ {23,137},
+/* 27958 */ {23,137},
+/* 27959 */ {23,137},
+/* 27960 */ {23,137},
+/* 27961 */ {23,137},
+/* 27962 */ {23,137},
+/* 27963 */ {23,137},
+/* 27964 */ {23,137},
+/* 27965 */ {23,137},
+/* 27966 */ {23,137},
+/* 27967 */ {23,137},
+/* 27968 */ {23,137},
+/* 27969 */ {23,137},
+/* 27970 */ {23,137},
+/* 27971 */ {23,137},
+/* 27972 */ {23,137},
+/* 27973 */ {23,137},
+/* 27974 */ {23,137},
+/* 27975 */ {23,137},
+/* 27976 */ {23,137},
+/* 27977 */ {23,137},
+/* 27978 */ {23,137},
+/* 27979 */ {23,137},
+/* 27980 */ {23,137},
+/* 27981 */ {23,137},
+/* 27982 */ {23,137},
+/* 27983 */ {23,137},
+/* 27984 */ {23,137},
+/* 27985 */ {23,137},
+/* 27986 */ {23,137},
+/* 27987 */ {23,137},
+/* 27988 */ {23,137},
+/* 27989 */ {23,137},
+/* 27990 */ {23,137},
+/* 27991 */ {23,137},
+/* 27992 */ {23,137},
+/* 27993 */ {23,137},
+/* 27994 */ {23,137},
+/* 27995 */ {23,137},
+/* 27996 */ {23,137},
+/* 27997 */ {23,137},
+/* 27998 */ {23,137},
+/* 27999 */ {23,137},
+/* 28000 */ {23,137},
+/* 28001 */ {23,137},
+/* 28002 */ {23,137},
+/* 28003 */ {23,137},
+/* 28004 */ {23,137},
+/* 28005 */ {23,137},
+/* 28006 */ {23,137},
+/* 28007 */ {23,137},
+/* 28008 */ {23,137},
+/* 28009 */ {23,137},
+/* 28010 */ {23,137},
+/* 28011 */ {23,137},
+/* 28012 */ {23,137},
+/* 28013 */ {23,137},
+/* 28014 */ {23,137},
+/* 28015 */ {23,137},
+/* 28016 */ {23,137},
+/* 28017 */ {23,137},
+/* 28018 */ {23,137},
+/* 28019 */ {23,137},
+/* 28020 */ {23,137},
+/* 28021 */ {23,137},
+/* 28022 */ {23,137},
+/* 28023 */ {23,137},
+/* 28024 */ {23,137},
+/* 28025 */ {23,137},
+/* 28026 */ {23,137},
+/* 28027 */ {23,137},
+/* 28028 */ {23,137},
+/* 28029 */ {23,137},
+/* 28030 */ {23,137},
+/* 28031 */ {23,137},
+/* 28032 */ {23,138},
+/* 28033 */ {23,138},
+/* 28034 */ {23,138},
+/* 28035 */ {23,138},
+/* 28036 */ {23,138},
+/* 28037 */ {23,138},
+/* 28038 */ {23,138},
+/* 28039 */ {23,138},
+/* 28040 */ {23,138},
+/* 28041 */ {23,138},
+/* 28042 */ {23,138},
+/* 28043 */ {23,138},
+/* 28044 */ {23,138},
+/* 28045 */ {23,138},
+/* 28046 */ {23,138},
+/* 28047 */ {23,138},
+/* 28048 */ {23,138},
+/* 28049 */ {23,138},
+/* 28050 */ {23,138},
+/* 28051 */ {23,138},
+/* 28052 */ {23,138},
+/* 28053 */ {23,138},
+/* 28054 */ {23,138},
+/* 28055 */ {23,138},
+/* 28056 */ {23,138},
+/* 28057 */ {23,138},
+/* 28058 */ {23,138},
+/* 28059 */ {23,138},
+/* 28060 */ {23,138},
+/* 28061 */ {23,138},
+/* 28062 */ {23,138},
+/* 28063 */ {23,138},
+/* 28064 */ {23,138},
+/* 28065 */ {23,138},
+/* 28066 */ {23,138},
+/* 28067 */ {23,138},
+/* 28068 */ {23,138},
+/* 28069 */ {23,138},
+/* 28070 */ {23,138},
+/* 28071 */ {23,138},
+/* 28072 */ {23,138},
+/* 28073 */ {23,138},
+/* 28074 */ {23,138},
+/* 28075 */ {23,138},
+/* 28076 */ {23,138},
+/* 28077 */ {23,138},
+/* 28078 */ {23,138},
+/* 28079 */ {23,138},
+/* 28080 */ {23,138},
+/* 28081 */ {23,138},
+/* 28082 */ {23,138},
+/* 28083 */ {23,138},
+/* 28084 */ {23,138},
+/* 28085 */ {23,138},
+/* 28086 */ {23,138},
+/* 28087 */ {23,138},
+/* 28088 */ {23,138},
+/* 28089 */ {23,138},
+/* 28090 */ {23,138},
+/* 28091 */ {23,138},
+/* 28092 */ {23,138},
+/* 28093 */ {23,138},
+/* 28094 */ {23,138},
+/* 28095 */ {23,138},
+/* 28096 */ {23,138},
+/* 28097 */ {23,138},
+/* 28098 */ {23,138},
+/* 28099 */ {23,138},
+/* 28100 */ {23,138},
+/* 28101 */ {23,138},
+/* 28102 */ {23,138},
+/* 28103 */ {23,138},
+/* 28104 */ {23,138},
+/* 28105 */ {23,138},
+/* 28106 */ {23,138},
+/* 28107 */ {23,138},
+/* 28108 */ {23,138},
+/* 28109 */ {23,138},
+/* 28110 */ {23,138},
+/* 28111 */ {23,138},
+/* 28112 */ {23,138},
+/* 28113 */ {23,138},
+/* 28114 */ {23,138},
+/* 28115 */ {23,138},
+/* 28116 */ {23,138},
+/* 28117 */ {23,138},
+/* 28118 */ {23,138},
+/* 28119 */ {23,138},
+/* 28120 */ {23,138},
+/* 28121 */ {23,138},
+/* 28122 */ {23,138},
+/* 28123 */ {23,138},
+/* 28124 */ {23,138},
+/* 28125 */ {23,138},
+/* 28126 */ {23,138},
+/* 28127 */ {23,138},
+/* 28128 */ {23,138},
+/* 28129 */ {23,138},
+/* 28130 */ {23,138},
+/* 28131 */ {23,138},
+/* 28132 */ {23,138},
+/* 28133 */ {23,138},
+/* 28134 */ {23,138},
+/* 28135 */ {23,138},
+/* 28136 */ {23,138},
+/* 28137 */ {23,138},
+/* 28138 */ {23,138},
+/* 28139 */ {23,138},
+/* 28140 */ {23,138},
+/* 28141 */ {23,138},
+/* 28142 */ {23,138},
+/* 28143 */ {23,138},
+/* 28144 */ {23,138},
+/* 28145 */ {23,138},
+/* 28146 */ {23,138},
+/* 28147 */ {23,138},
+/* 28148 */ {23,138},
+/* 28149 */ {23,138},
+/* 28150 */ {23,138},
+/* 28151 */ {23,138},
+/* 28152 */ {23,138},
+/* 28153 */ {23,138},
+/* 28154 */ {23,138},
+/* 28155 */ {23,138},
+/* 28156 */ {23,138},
+/* 28157 */ {23,138},
+/* 28158 */ {23,138},
+/* 28159 */ {23,138},
+/* 28160 */ {23,139},
+/* 28161 */ {23,139},
+/* 28162 */ {23,139},
+/* 28163 */ {23,139},
+/* 28164 */ {23,139},
+/* 28165 */ {23,139},
+/* 28166 */ {23,139},
+/* 28167 */ {23,139},
+/* 28168 */ {23,139},
+/* 28169 */ {23,139},
+/* 28170 */ {23,139},
+/* 28171 */ {23,139},
+/* 28172 */ {23,139},
+/* 28173 */ {23,139},
+/* 28174 */ {23,139},
+/* 28175 */ {23,139},
+/* 28176 */ {23,139},
+/* 28177 */ {23,139},
+/* 28178 */ {23,139},
+/* 28179 */ {23,139},
+/* 28180 */ {23,139},
+/* 28181 */ {23,139},
+/* 28182 */ {23,139},
+/* 28183 */ {23,139},
+/* 28184 */ {23,139},
+/* 28185 */ {23,139},
+/* 28186 */ {23,139},
+/* 28187 */ {23,139},
+/* 28188 */ {23,139},
+/* 28189 */ {23,139},
+/* 28190 */ {23,139},
+/* 28191 */ {23,139},
+/* 28192 */ {23,139},
+/* 28193 */ {23,139},
+/* 28194 */ {23,139},
+/* 28195 */ {23,139},
+/* 28196 */ {23,139},
+/* 28197 */ {23,139},
+/* 28198 */ {23,139},
+/* 28199 */ {23,139},
+/* 28200 */ {23,139},
+/* 28201 */ {23,139},
+/* 28202 */ {23,139},
+/* 28203 */ {23,139},
+/* 28204 */ {23,139},
+/* 28205 */ {23,139},
+/* 28206 */ {23,139},
+/* 28207 */ {23,139},
+/* 28208 */ {23,139},
+/* 28209 */ {23,139},
+/* 28210 */ {23,139},
+/* 28211 */ {23,139},
+/* 28212 */ {23,139},
+/* 28213 */ {23,139},
+/* 28214 */ {23,139},
+/* 28215 */ {23,139},
+/* 28216 */ {23,139},
+/* 28217 */ {23,139},
+/* 28218 */ {23,139},
+/* 28219 */ {23,139},
+/* 28220 */ {23,139},
+/* 28221 */ {23,139},
+/* 28222 */ {23,139},
+/* 28223 */ {23,139},
+/* 28224 */ {23,139},
+/* 28225 */ {23,139},
+/* 28226 */ {23,139},
+/* 28227 */ {23,139},
+/* 28228 */ {23,139},
+/* 28229 */ {23,139},
+/* 28230 */ {23,139},
+/* 28231 */ {23,139},
+/* 28232 */ {23,139},
+/* 28233 */ {23,139},
+/* 28234 */ {23,139},
+/* 28235 */ {23,139},
+/* 28236 */ {23,139},
+/* 28237 */ {23,139},
+/* 28238 */ {23,139},
+/* 28239 */ {23,139},
+/* 28240 */ {23,139},
+/* 28241 */ {23,139},
+/* 28242 */ {23,139},
+/* 28243 */ {23,139},
+/* 28244 */ {23,139},
+/* 28245 */ {23,139},
+/* 28246 */ {23,139},
+/* 28247 */ {23,139},
+/* 28248 */ {23,139},
+/* 28249 */ {23,139},
+/* 28250 */ {23,139},
+/* 28251 */ {23,139},
+/* 28252 */ {23,139},
+/* 28253 */ {23,139},
+/* 28254 */ {23,139},
+/* 28255 */ {23,139},
+/* 28256 */ {23,139},
+/* 28257 */ {23,139},
+/* 28258 */ {23,139},
+/* 28259 */ {23,139},
+/* 28260 */ {23,139},
+/* 28261 */ {23,139},
+/* 28262 */ {23,139},
+/* 28263 */ {23,139},
+/* 28264 */ {23,139},
+/* 28265 */ {23,139},
+/* 28266 */ {23,139},
+/* 28267 */ {23,139},
+/* 28268 */ {23,139},
+/* 28269 */ {23,139},
+/* 28270 */ {23,139},
+/* 28271 */ {23,139},
+/* 28272 */ {23,139},
+/* 28273 */ {23,139},
+/* 28274 */ {23,139},
+/* 28275 */ {23,139},
+/* 28276 */ {23,139},
+/* 28277 */ {23,139},
+/* 28278 */ {23,139},
+/* 28279 */ {23,139},
+/* 28280 */ {23,139},
+/* 28281 */ {23,139},
+/* 28282 */ {23,139},
+/* 28283 */ {23,139},
+/* 28284 */ {23,139},
+/* 28285 */ {23,139},
+/* 28286 */ {23,139},
+/* 28287 */ {23,139},
+/* 28288 */ {23,140},
+/* 28289 */ {23,140},
+/* 28290 */ {23,140},
+/* 28291 */ {23,140},
+/* 28292 */ {23,140},
+/* 28293 */ {23,140},
+/* 28294 */ {23,140},
+/* 28295 */ {23,140},
+/* 28296 */ {23,140},
+/* 28297 */ {23,140},
+/* 28298 */ {23,140},
+/* 28299 */ {23,140},
+/* 28300 */ {23,140},
+/* 28301 */ {23,140},
+/* 28302 */ {23,140},
+/* 28303 */ {23,140},
+/* 28304 */ {23,140},
+/* 28305 */ {23,140},
+/* 28306 */ {23,140},
+/* 28307 */ {23,140},
+/* 28308 */ {23,140},
+/* 28309 */ {23,140},
+/* 28310 */ {23,140},
+/* 28311 */ {23,140},
+/* 28312 */ {23,140},
+/* 28313 */ {23,140},
+/* 28314 */ {23,140},
+/* 28315 */ {23,140},
+/* 28316 */ {23,140},
+/* 28317 */ {23,140},
+/* 28318 */ {23,140},
+/* 28319 */ {23,140},
+/* 28320 */ {23,140},
+/* 28321 */ {23,140},
+/* 28322 */ {23,140},
+/* 28323 */ {23,140},
+/* 28324 */ {23,140},
+/* 28325 */ {23,140},
+/* 28326 */ {23,140},
+/* 28327 */ {23,140},
+/* 28328 */ {23,140},
+/* 28329 */ {23,140},
+/* 28330 */ {23,140},
+/* 28331 */ {23,140},
+/* 28332 */ {23,140},
+/* 28333 */ {23,140},
+/* 28334 */ {23,140},
+/* 28335 */ {23,140},
+/* 28336 */ {23,140},
+/* 28337 */ {23,140},
+/* 28338 */ {23,140},
+/* 28339 */ {23,140},
+/* 28340 */ {23,140},
+/* 28341 */ {23,140},
+/* 28342 */ {23,140},
+/* 28343 */ {23,140},
+/* 28344 */ {23,140},
+/* 28345 */ {23,140},
+/* 28346 */ {23,140},
+/* 28347 */ {23,140},
+/* 28348 */ {23,140},
+/* 28349 */ {23,140},
+/* 28350 */ {23,140},
+/* 28351 */ {23,140},
+/* 28352 */ {23,140},
+/* 28353 */ {23,140},
+/* 28354 */ {23,140},
+/* 28355 */ {23,140},
+/* 28356 */ {23,140},
+/* 28357 */ {23,140},
+/* 28358 */ {23,140},
+/* 28359 */ {23,140},
+/* 28360 */ {23,140},
+/* 28361 */ {23,140},
+/* 28362 */ {23,140},
+/* 28363 */ {23,140},
+/* 28364 */ {23,140},
+/* 28365 */ {23,140},
+/* 28366 */ {23,140},
+/* 28367 */ {23,140},
+/* 28368 */ {23,140},
+/* 28369 */ {23,140},
+/* 28370 */ {23,140},
+/* 28371 */ {23,140},
+/* 28372 */ {23,140},
+/* 28373 */ {23,140},
+/* 28374 */ {23,140},
+/* 28375 */ {23,140},
+/* 28376 */ {23,140},
+/* 28377 */ {23,140},
+/* 28378 */ {23,140},
+/* 28379 */ {23,140},
+/* 28380 */ {23,140},
+/* 28381 */ {23,140},
+/* 28382 */ {23,140},
+/* 28383 */ {23,140},
+/* 28384 */ {23,140},
+/* 28385 */ {23,140},
+/* 28386 */ {23,140},
+/* 28387 */ {23,140},
+/* 28388 */ {23,140},
+/* 28389 */ {23,140},
+/* 28390 */ {23,140},
+/* 28391 */ {23,140},
+/* 28392 */ {23,140},
+/* 28393 */ {23,140},
+/* 28394 */ {23,140},
+/* 28395 */ {23,140},
+/* 28396 */ {23,140},
+/* 28397 */ {23,140},
+/* 28398 */ {23,140},
+/* 28399 */ {23,140},
+/* 28400 */ {23,140},
+/* 28401 */ {23,140},
+/* 28402 */ {23,140},
+/* 28403 */ {23,140},
+/* 28404 */ {23,140},
+/* 28405 */ {23,140},
+/* 28406 */ {23,140},
+/* 28407 */ {23,140},
+/* 28408 */ {23,140},
+/* 28409 */ {23,140},
+/* 28410 */ {23,140},
+/* 28411 */ {23,140},
+/* 28412 */ {23,140},
+/* 28413 */ {23,140},
+/* 28414 */ {23,140},
+/* 28415 */ {23,140},
+/* 28416 */ {23,141},
+/* 28417 */ {23,141},
+/* 28418 */ {23,141},
+/* 28419 */ {23,141},
+/* 28420 */ {23,141},
+/* 28421 */ {23,141},
+/* 28422 */ {23,141},
+/* 28423 */ {23,141},
+/* 28424 */ {23,141},
+/* 28425 */ {23,141},
+/* 28426 */ {23,141},
+/* 28427 */ {23,141},
+/* 28428 */ {23,141},
+/* 28429 */ {23,141},
+/* 28430 */ {23,141},
+/* 28431 */ {23,141},
+/* 28432 */ {23,141},
+/* 28433 */ {23,141},
+/* 28434 */ {23,141},
+/* 28435 */ {23,141},
+/* 28436 */ {23,141},
+/* 28437 */ {23,141},
+/* 28438 */ {23,141},
+/* 28439 */ {23,141},
+/* 28440 */ {23,141},
+/* 28441 */ {23,141},
+/* 28442 */ {23,141},
+/* 28443 */ {23,141},
+/* 28444 */ {23,141},
+/* 28445 */ {23,141},
+/* 28446 */ {23,141},
+/* 28447 */ {23,141},
+/* 28448 */ {23,141},
+/* 28449 */ {23,141},
+/* 28450 */ {23,141},
+/* 28451 */ {23,141},
+/* 28452 */ {23,141},
+/* 28453 */ {23,141},
+/* 28454 */ {23,141},
+/* 28455 */ {23,141},
+/* 28456 */ {23,141},
+/* 28457 */ {23,141},
+/* 28458 */ {23,141},
+/* 28459 */ {23,141},
+/* 28460 */ {23,141},
+/* 28461 */ {23,141},
+/* 28462 */ {23,141},
+/* 28463 */ {23,141},
+/* 28464 */ {23,141},
+/* 28465 */ {23,141},
+/* 28466 */ {23,141},
+/* 28467 */ {23,141},
+/* 28468 */ {23,141},
+/* 28469 */ {23,141},
+/* 28470 */ {23,141},
+/* 28471 */ {23,141},
+/* 28472 */ {23,141},
+/* 28473 */ {23,141},
+/* 28474 */ {23,141},
+/* 28475 */ {23,141},
+/* 28476 */ {23,141},
+/* 28477 */ {23,141},
+/* 28478 */ {23,141},
+/* 28479 */ {23,141},
+/* 28480 */ {23,141},
+/* 28481 */ {23,141},
+/* 28482 */ {23,141},
+/* 28483 */ {23,141},
+/* 28484 */ {23,141},
+/* 28485 */ {23,141},
+/* 28486 */ {23,141},
+/* 28487 */ {23,141},
+/* 28488 */ {23,141},
+/* 28489 */ {23,141},
+/* 28490 */ {23,141},
+/* 28491 */ {23,141},
+/* 28492 */ {23,141},
+/* 28493 */ {23,141},
+/* 28494 */ {23,141},
+/* 28495 */ {23,141},
+/* 28496 */ {23,141},
+/* 28497 */ {23,141},
+/* 28498 */ {23,141},
+/* 28499 */ {23,141},
+/* 28500 */ {23,141},
+/* 28501 */ {23,141},
+/* 28502 */ {23,141},
+/* 28503 */ {23,141},
+/* 28504 */ {23,141},
+/* 28505 */ {23,141},
+/* 28506 */ {23,141},
+/* 28507 */ {23,141},
+/* 28508 */ {23,141},
+/* 28509 */ {23,141},
+/* 28510 */ {23,141},
+/* 28511 */ {23,141},
+/* 28512 */ {23,141},
+/* 28513 */ {23,141},
+/* 28514 */ {23,141},
+/* 28515 */ {23,141},
+/* 28516 */ {23,141},
+/* 28517 */ {23,141},
+/* 28518 */ {23,141},
+/* 28519 */ {23,141},
+/* 28520 */ {23,141},
+/* 28521 */ {23,141},
+/* 28522 */ {23,141},
+/* 28523 */ {23,141},
+/* 28524 */ {23,141},
+/* 28525 */ {23,141},
+/* 28526 */ {23,141},
+/* 28527 */ {23,141},
+/* 28528 */ {23,141},
+/* 28529 */ {23,141},
+/* 28530 */ {23,141},
+/* 28531 */ {23,141},
+/* 28532 */ {23,141},
+/* 28533 */ {23,141},
+/* 28534 */ {23,141},
+/* 28535 */ {23,141},
+/* 28536 */ {23,141},
+/* 28537 */ {23,141},
+/* 28538 */ {23,141},
+/* 28539 */ {23,141},
+/* 28540 */ {23,141},
+/* 28541 */ {23,141},
+/* 28542 */ {23,141},
+/* 28543 */ {23,141},
+/* 28544 */ {23,143},
+/* 28545 */ {23,143},
+/* 28546 */ {23,143},
+/* 28547 */ {23,143},
+/* 28548 */ {23,143},
+/* 28549 */ {23,143},
+/* 28550 */ {23,143},
+/* 28551 */ {23,143},
+/* 28552 */ {23,143},
+/* 28553 */ {23,143},
+/* 28554 */ {23,143},
+/* 28555 */ {23,143},
+/* 28556 */ {23,143},
+/* 28557 */ {23,143},
+/* 28558 */ {23,143},
+/* 28559 */ {23,143},
+/* 28560 */ {23,143},
+/* 28561 */ {23,143},
+/* 28562 */ {23,143},
+/* 28563 */ {23,143},
+/* 28564 */ {23,143},
+/* 28565 */ {23,143},
+/* 28566 */ {23,143},
+/* 28567 */ {23,143},
+/* 28568 */ {23,143},
+/* 28569 */ {23,143},
+/* 28570 */ {23,143},
+/* 28571 */ {23,143},
+/* 28572 */ {23,143},
+/* 28573 */ {23,143},
+/* 28574 */ {23,143},
+/* 28575 */ {23,143},
+/* 28576 */ {23,143},
+/* 28577 */ {23,143},
+/* 28578 */ {23,143},
+/* 28579 */ {23,143},
+/* 28580 */ {23,143},
+/* 28581 */ {23,143},
+/* 28582 */ {23,143},
+/* 28583 */ {23,143},
+/* 28584 */ {23,143},
+/* 28585 */ {23,143},
+/* 28586 */ {23,143},
+/* 28587 */ {23,143},
+/* 28588 */ {23,143},
+/* 28589 */ {23,143},
+/* 28590 */ {23,143},
+/* 28591 */ {23,143},
+/* 28592 */ {23,143},
+/* 28593 */ {23,143},
+/* 28594 */ {23,143},
+/* 28595 */ {23,143},
+/* 28596 */ {23,143},
+/* 28597 */ {23,143},
+/* 28598 */ {23,143},
+/* 28599 */ {23,143},
+/* 28600 */ {23,143},
+/* 28601 */ {23,143},
+/* 28602 */ {23,143},
+/* 28603 */ {23,143},
+/* 28604 */ {23,143},
+/* 28605 */ {23,143},
+/* 28606 */ {23,143},
+/* 28607 */ {23,143},
+/* 28608 */ {23,143},
+/* 28609 */ {23,143},
+/* 28610 */ {23,143},
+/* 28611 */ {23,143},
+/* 28612 */ {23,143},
+/* 28613 */ {23,143},
+/* 28614 */ {23,143},
+/* 28615 */ {23,143},
+/* 28616 */ {23,143},
+/* 28617 */ {23,143},
+/* 28618 */ {23,143},
+/* 28619 */ {23,143},
+/* 28620 */ {23,143},
+/* 28621 */ {23,143},
+/* 28622 */ {23,143},
+/* 28623 */ {23,143},
+/* 28624 */ {23,143},
+/* 28625 */ {23,143},
+/* 28626 */ {23,143},
+/* 28627 */ {23,143},
+/* 28628 */ {23,143},
+/* 28629 */ {23,143},
+/* 28630 */ {23,143},
+/* 28631 */ {23,143},
+/* 28632 */ {23,143},
+/* 28633 */ {23,143},
+/* 28634 */ {23,143},
+/* 28635 */ {23,143},
+/* 28636 */ {23,143},
+/* 28637 */ {23,143},
+/* 28638 */ {23,143},
+/* 28639 */ {23,143},
+/* 28640 */ {23,143},
+/* 28641 */ {23,143},
+/* 28642 */ {23,143},
+/* 28643 */ {23,143},
+/* 28644 */ {23,143},
+/* 28645 */ {23,143},
+/* 28646 */ {23,143},
+/* 28647 */ {23,143},
+/* 28648 */ {23,143},
+/* 28649 */ {23,143},
+/* 28650 */ {23,143},
+/* 28651 */ {23,143},
+/* 28652 */ {23,143},
+/* 28653 */ {23,143},
+/* 28654 */ {23,143},
+/* 28655 */ {23,143},
+/* 28656 */ {23,143},
+/* 28657 */ {23,143},
+/* 28658 */ {23,143},
+/* 28659 */ {23,143},
+/* 28660 */ {23,143},
+/* 28661 */ {23,143},
+/* 28662 */ {23,143},
+/* 28663 */ {23,143},
+/* 28664 */ {23,143},
+/* 28665 */ {23,143},
+/* 28666 */ {23,143},
+/* 28667 */ {23,143},
+/* 28668 */ {23,143},
+/* 28669 */ {23,143},
+/* 28670 */ {23,143},
+/* 28671 */ {23,143},
+/* 28672 */ {23,147},
+/* 28673 */ {23,147},
+/* 28674 */ {23,147},
+/* 28675 */ {23,147},
+/* 28676 */ {23,147},
+/* 28677 */ {23,147},
+/* 28678 */ {23,147},
+/* 28679 */ {23,147},
+/* 28680 */ {23,147},
+/* 28681 */ {23,147},
+/* 28682 */ {23,147},
+/* 28683 */ {23,147},
+/* 28684 */ {23,147},
+/* 28685 */ {23,147},
+/* 28686 */ {23,147},
+/* 28687 */ {23,147},
+/* 28688 */ {23,147},
+/* 28689 */ {23,147},
+/* 28690 */ {23,147},
+/* 28691 */ {23,147},
+/* 28692 */ {23,147},
+/* 28693 */ {23,147},
+/* 28694 */ {23,147},
+/* 28695 */ {23,147},
+/* 28696 */ {23,147},
+/* 28697 */ {23,147},
+/* 28698 */ {23,147},
+/* 28699 */ {23,147},
+/* 28700 */ {23,147},
+/* 28701 */ {23,147},
+/* 28702 */ {23,147},
+/* 28703 */ {23,147},
+/* 28704 */ {23,147},
+/* 28705 */ {23,147},
+/* 28706 */ {23,147},
+/* 28707 */ {23,147},
+/* 28708 */ {23,147},
+/* 28709 */ {23,147},
+/* 28710 */ {23,147},
+/* 28711 */ {23,147},
+/* 28712 */ {23,147},
+/* 28713 */ {23,147},
+/* 28714 */ {23,147},
+/* 28715 */ {23,147},
+/* 28716 */ {23,147},
+/* 28717 */ {23,147},
+/* 28718 */ {23,147},
+/* 28719 */ {23,147},
+/* 28720 */ {23,147},
+/* 28721 */ {23,147},
+/* 28722 */ {23,147},
+/* 28723 */ {23,147},
+/* 28724 */ {23,147},
+/* 28725 */ {23,147},
+/* 28726 */ {23,147},
+/* 28727 */ {23,147},
+/* 28728 */ {23,147},
+/* 28729 */ {23,147},
+/* 28730 */ {23,147},
+/* 28731 */ {23,147},
+/* 28732 */ {23,147},
+/* 28733 */ {23,147},
+/* 28734 */ {23,147},
+/* 28735 */ {23,147},
+/* 28736 */ {23,147},
+/* 28737 */ {23,147},
+/* 28738 */ {23,147},
+/* 28739 */ {23,147},
+/* 28740 */ {23,147},
+/* 28741 */ {23,147},
+/* 28742 */ {23,147},
+/* 28743 */ {23,147},
+/* 28744 */ {23,147},
+/* 28745 */ {23,147},
+/* 28746 */ {23,147},
+/* 28747 */ {23,147},
+/* 28748 */ {23,147},
+/* 28749 */ {23,147},
+/* 28750 */ {23,147},
+/* 28751 */ {23,147},
+/* 28752 */ {23,147},
+/* 28753 */ {23,147},
+/* 28754 */ {23,147},
+/* 28755 */ {23,147},
+/* 28756 */ {23,147},
+/* 28757 */ {23,147},
+/* 28758 */ {23,147},
+/* 28759 */ {23,147},
+/* 28760 */ {23,147},
+/* 28761 */ {23,147},
+/* 28762 */ {23,147},
+/* 28763 */ {23,147},
+/* 28764 */ {23,147},
+/* 28765 */ {23,147},
+/* 28766 */ {23,147},
+/* 28767 */ {23,147},
+/* 28768 */ {23,147},
+/* 28769 */ {23,147},
+/* 28770 */ {23,147},
+/* 28771 */ {23,147},
+/* 28772 */ {23,147},
+/* 28773 */ {23,147},
+/* 28774 */ {23,147},
+/* 28775 */ {23,147},
+/* 28776 */ {23,147},
+/* 28777 */ {23,147},
+/* 28778 */ {23,147},
+/* 28779 */ {23,147},
+/* 28780 */ {23,147},
+/* 28781 */ {23,147},
+/* 28782 */ {23,147},
+/* 28783 */ {23,147},
+/* 28784 */ {23,147},
+/* 28785 */ {23,147},
+/* 28786 */ {23,147},
+/* 28787 */ {23,147},
+/* 28788 */ {23,147},
+/* 28789 */ {23,147},
+/* 28790 */ {23,147},
+/* 28791 */ {23,147},
+/* 28792 */ {23,147},
+/* 28793 */ {23,147},
+/* 28794 */ {23,147},
+/* 28795 */ {23,147},
+/* 28796 */ {23,147},
+/* 28797 */ {23,147},
+/* 28798 */ {23,147},
+/* 28799 */ {23,147},
+/* 28800 */ {23,149},
+/* 28801 */ {23,149},
+/* 28802 */ {23,149},
+/* 28803 */ {23,149},
+/* 28804 */ {23,149},
+/* 28805 */ {23,149},
+/* 28806 */ {23,149},
+/* 28807 */ {23,149},
+/* 28808 */ {23,149},
+/* 28809 */ {23,149},
+/* 28810 */ {23,149},
+/* 28811 */ {23,149},
+/* 28812 */ {23,149},
+/* 28813 */ {23,149},
+/* 28814 */ {23,149},
+/* 28815 */ {23,149},
+/* 28816 */ {23,149},
+/* 28817 */ {23,149},
+/* 28818 */ {23,149},
+/* 28819 */ {23,149},
+/* 28820 */ {23,149},
+/* 28821 */ {23,149},
+/* 28822 */ {23,149},
+/* 28823 */ {23,149},
+/* 28824 */ {23,149},
+/* 28825 */ {23,149},
+/* 28826 */ {23,149},
+/* 28827 */ {23,149},
+/* 28828 */ {23,149},
+/* 28829 */ {23,149},
+/* 28830 */ {23,149},
+/* 28831 */ {23,149},
+/* 28832 */ {23,149},
+/* 28833 */ {23,149},
+/* 28834 */ {23,149},
+/* 28835 */ {23,149},
+/* 28836 */ {23,149},
+/* 28837 */ {23,149},
+/* 28838 */ {23,149},
+/* 28839 */ {23,149},
+/* 28840 */ {23,149},
+/* 28841 */ {23,149},
+/* 28842 */ {23,149},
+/* 28843 */ {23,149},
+/* 28844 */ {23,149},
+/* 28845 */ {23,149},
+/* 28846 */ {23,149},
+/* 28847 */ {23,149},
+/* 28848 */ {23,149},
+/* 28849 */ {23,149},
+/* 28850 */ {23,149},
+/* 28851 */ {23,149},
+/* 28852 */ {23,149},
+/* 28853 */ {23,149},
+/* 28854 */ {23,149},
+/* 28855 */ {23,149},
+/* 28856 */ {23,149},
+/* 28857 */ {23,149},
+/* 28858 */ {23,149},
+/* 28859 */ {23,149},
+/* 28860 */ {23,149},
+/* 28861 */ {23,149},
+/* 28862 */ {23,149},
+/* 28863 */ {23,149},
+/* 28864 */ {23,149},
+/* 28865 */ {23,149},
+/* 28866 */ {23,149},
+/* 28867 */ {23,149},
+/* 28868 */ {23,149},
+/* 28869 */ {23,149},
+/* 28870 */ {23,149},
+/* 28871 */ {23,149},
+/* 28872 */ {23,149},
+/* 28873 */ {23,149},
+/* 28874 */ {23,149},
+/* 28875 */ {23,149},
+/* 28876 */ {23,149},
+/* 28877 */ {23,149},
+/* 28878 */ {23,149},
+/* 28879 */ {23,149},
+/* 28880 */ {23,149},
+/* 28881 */ {23,149},
+/* 28882 */ {23,149},
+/* 28883 */ {23,149},
+/* 28884 */ {23,149},
+/* 28885 */ {23,149},
+/* 28886 */ {23,149},
+/* 28887 */ {23,149},
+/* 28888 */ {23,149},
+/* 28889 */ {23,149},
+/* 28890 */ {23,149},
+/* 28891 */ {23,149},
+/* 28892 */ {23,149},
+/* 28893 */ {23,149},
+/* 28894 */ {23,149},
+/* 28895 */ {23,149},
+/* 28896 */ {23,149},
+/* 28897 */ {23,149},
+/* 28898 */ {23,149},
+/* 28899 */ {23,149},
+/* 28900 */ {23,149},
+/* 28901 */ {23,149},
+/* 28902 */ {23,149},
+/* 28903 */ {23,149},
+/* 28904 */ {23,149},
+/* 28905 */ {23,149},
+/* 28906 */ {23,149},
+/* 28907 */ {23,149},
+/* 28908 */ {23,149},
+/* 28909 */ {23,149},
+/* 28910 */ {23,149},
+/* 28911 */ {23,149},
+/* 28912 */ {23,149},
+/* 28913 */ {23,149},
+/* 28914 */ {23,149},
+/* 28915 */ {23,149},
+/* 28916 */ {23,149},
+/* 28917 */ {23,149},
+/* 28918 */ {23,149},
+/* 28919 */ {23,149},
+/* 28920 */ {23,149},
+/* 28921 */ {23,149},
+/* 28922 */ {23,149},
+/* 28923 */ {23,149},
+/* 28924 */ {23,149},
+/* 28925 */ {23,149},
+/* 28926 */ {23,149},
+/* 28927 */ {23,149},
+/* 28928 */ {23,150},
+/* 28929 */ {23,150},
+/* 28930 */ {23,150},
+/* 28931 */ {23,150},
+/* 28932 */ {23,150},
+/* 28933 */ {23,150},
+/* 28934 */ {23,150},
+/* 28935 */ {23,150},
+/* 28936 */ {23,150},
+/* 28937 */ {23,150},
+/* 28938 */ {23,150},
+/* 28939 */ {23,150},
+/* 28940 */ {23,150},
+/* 28941 */ {23,150},
+/* 28942 */ {23,150},
+/* 28943 */ {23,150},
+/* 28944 */ {23,150},
+/* 28945 */ {23,150},
+/* 28946 */ {23,150},
+/* 28947 */ {23,150},
+/* 28948 */ {23,150},
+/* 28949 */ {23,150},
+/* 28950 */ {23,150},
+/* 28951 */ {23,150},
+/* 28952 */ {23,150},
+/* 28953 */ {23,150},
+/* 28954 */ {23,150},
+/* 28955 */ {23,150},
+/* 28956 */ {23,150},
+/* 28957 */ {23,150},
+/* 28958 */ {23,150},
+/* 28959 */ {23,150},
+/* 28960 */ {23,150},
+/* 28961 */ {23,150},
+/* 28962 */ {23,150},
+/* 28963 */ {23,150},
+/* 28964 */ {23,150},
+/* 28965 */ {23,150},
+/* 28966 */ {23,150},
+/* 28967 */ {23,150},
+/* 28968 */ {23,150},
+/* 28969 */ {23,150},
+/* 28970 */ {23,150},
+/* 28971 */ {23,150},
+/* 28972 */ {23,150},
+/* 28973 */ {23,150},
+/* 28974 */ {23,150},
+/* 28975 */ {23,150},
+/* 28976 */ {23,150},
+/* 28977 */ {23,150},
+/* 28978 */ {23,150},
+/* 28979 */ {23,150},
+/* 28980 */ {23,150},
+/* 28981 */ {23,150},
+/* 28982 */ {23,150},
+/* 28983 */ {23,150},
+/* 28984 */ {23,150},
+/* 28985 */ {23,150},
+/* 28986 */ {23,150},
+/* 28987 */ {23,150},
+/* 28988 */ {23,150},
+/* 28989 */ {23,150},
+/* 28990 */ {23,150},
+/* 28991 */ {23,150},
+/* 28992 */ {23,150},
+/* 28993 */ {23,150},
+/* 28994 */ {23,150},
+/* 28995 */ {23,150},
+/* 28996 */ {23,150},
+/* 28997 */ {23,150},
+/* 28998 */ {23,150},
+/* 28999 */ {23,150},
+/* 29000 */ {23,150},
+/* 29001 */ {23,150},
+/* 29002 */ {23,150},
+/* 29003 */ {23,150},
+/* 29004 */ {23,150},
+/* 29005 */ {23,150},
+/* 29006 */ {23,150},
+/* 29007 */ {23,150},
+/* 29008 */ {23,150},
+/* 29009 */ {23,150},
+/* 29010 */ {23,150},
+/* 29011 */ {23,150},
+/* 29012 */ {23,150},
+/* 29013 */ {23,150},
+/* 29014 */ {23,150},
+/* 29015 */ {23,150},
+/* 29016 */ {23,150},
+/* 29017 */ {23,150},
+/* 29018 */ {23,150},
+/* 29019 */ {23,150},
+/* 29020 */ {23,150},
+/* 29021 */ {23,150},
+/* 29022 */ {23,150},
+/* 29023 */ {23,150},
+/* 29024 */ {23,150},
+/* 29025 */ {23,150},
+/* 29026 */ {23,150},
+/* 29027 */ {23,150},
+/* 29028 */ {23,150},
+/* 29029 */ {23,150},
+/* 29030 */ {23,150},
+/* 29031 */ {23,150},
+/* 29032 */ {23,150},
+/* 29033 */ {23,150},
+/* 29034 */ {23,150},
+/* 29035 */ {23,150},
+/* 29036 */ {23,150},
+/* 29037 */ {23,150},
+/* 29038 */ {23,150},
+/* 29039 */ {23,150},
+/* 29040 */ {23,150},
+/* 29041 */ {23,150},
+/* 29042 */ {23,150},
+/* 29043 */ {23,150},
+/* 29044 */ {23,150},
+/* 29045 */ {23,150},
+/* 29046 */ {23,150},
+/* 29047 */ {23,150},
+/* 29048 */ {23,150},
+/* 29049 */ {23,150},
+/* 29050 */ {23,150},
+/* 29051 */ {23,150},
+/* 29052 */ {23,150},
+/* 29053 */ {23,150},
+/* 29054 */ {23,150},
+/* 29055 */ {23,150},
+/* 29056 */ {23,151},
+/* 29057 */ {23,151},
+/* 29058 */ {23,151},
+/* 29059 */ {23,151},
+/* 29060 */ {23,151},
+/* 29061 */ {23,151},
+/* 29062 */ {23,151},
+/* 29063 */ {23,151},
+/* 29064 */ {23,151},
+/* 29065 */ {23,151},
+/* 29066 */ {23,151},
+/* 29067 */ {23,151},
+/* 29068 */ {23,151},
+/* 29069 */ {23,151},
+/* 29070 */ {23,151},
+/* 29071 */ {23,151},
+/* 29072 */ {23,151},
+/* 29073 */ {23,151},
+/* 29074 */ {23,151},
+/* 29075 */ {23,151},
+/* 29076 */ {23,151},
+/* 29077 */ {23,151},
+/* 29078 */ {23,151},
+/* 29079 */ {23,151},
+/* 29080 */ {23,151},
+/* 29081 */ {23,151},
+/* 29082 */ {23,151},
+/* 29083 */ {23,151},
+/* 29084 */ {23,151},
+/* 29085 */ {23,151},
+/* 29086 */ {23,151},
+/* 29087 */ {23,151},
+/* 29088 */ {23,151},
+/* 29089 */ {23,151},
+/* 29090 */ {23,151},
+/* 29091 */ {23,151},
+/* 29092 */ {23,151},
+/* 29093 */ {23,151},
+/* 29094 */ {23,151},
+/* 29095 */ {23,151},
+/* 29096 */ {23,151},
+/* 29097 */ {23,151},
+/* 29098 */ {23,151},
+/* 29099 */ {23,151},
+/* 29100 */ {23,151},
+/* 29101 */ {23,151},
+/* 29102 */ {23,151},
+/* 29103 */ {23,151},
+/* 29104 */ {23,151},
+/* 29105 */ {23,151},
+/* 29106 */ {23,151},
+/* 29107 */ {23,151},
+/* 29108 */ {23,151},
+/* 29109 */ {23,151},
+/* 29110 */ {23,151},
+/* 29111 */ {23,151},
+/* 29112 */ {23,151},
+/* 29113 */ {23,151},
+/* 29114 */ {23,151},
+/* 29115 */ {23,151},
+/* 29116 */ {23,151},
+/* 29117 */ {23,151},
+/* 29118 */ {23,151},
+/* 29119 */ {23,151},
+/* 29120 */ {23,151},
+/* 29121 */ {23,151},
+/* 29122 */ {23,151},
+/* 29123 */ {23,151},
+/* 29124 */ {23,151},
+/* 29125 */ {23,151},
+/* 29126 */ {23,151},
+/* 29127 */ {23,151},
+/* 29128 */ {23,151},
+/* 29129 */ {23,151},
+/* 29130 */ {23,151},
+/* 29131 */ {23,151},
+/* 29132 */ {23,151},
+/* 29133 */ {23,151},
+/* 29134 */ {23,151},
+/* 29135 */ {23,151},
+/* 29136 */ {23,151},
+/* 29137 */ {23,151},
+/* 29138 */ {23,151},
+/* 29139 */ {23,151},
+/* 29140 */ {23,151},
+/* 29141 */ {23,151},
+/* 29142 */ {23,151},
+/* 29143 */ {23,151},
+/* 29144 */ {23,151},
+/* 29145 */ {23,151},
+/* 29146 */ {23,151},
+/* 29147 */ {23,151},
+/* 29148 */ {23,151},
+/* 29149 */ {23,151},
+/* 29150 */ {23,151},
+/* 29151 */ {23,151},
+/* 29152 */ {23,151},
+/* 29153 */ {23,151},
+/* 29154 */ {23,151},
+/* 29155 */ {23,151},
+/* 29156 */ {23,151},
+/* 29157 */ {23,151},
+/* 29158 */ {23,151},
+/* 29159 */ {23,151},
+/* 29160 */ {23,151},
+/* 29161 */ {23,151},
+/* 29162 */ {23,151},
+/* 29163 */ {23,151},
+/* 29164 */ {23,151},
+/* 29165 */ {23,151},
+/* 29166 */ {23,151},
+/* 29167 */ {23,151},
+/* 29168 */ {23,151},
+/* 29169 */ {23,151},
+/* 29170 */ {23,151},
+/* 29171 */ {23,151},
+/* 29172 */ {23,151},
+/* 29173 */ {23,151},
+/* 29174 */ {23,151},
+/* 29175 */ {23,151},
+/* 29176 */ {23,151},
+/* 29177 */ {23,151},
+/* 29178 */ {23,151},
+/* 29179 */ {23,151},
+/* 29180 */ {23,151},
+/* 29181 */ {23,151},
+/* 29182 */ {23,151},
+/* 29183 */ {23,151},
+/* 29184 */ {23,152},
+/* 29185 */ {23,152},
+/* 29186 */ {23,152},
+/* 29187 */ {23,152},
+/* 29188 */ {23,152},
+/* 29189 */ {23,152},
+/* 29190 */ {23,152},
+/* 29191 */ {23,152},
+/* 29192 */ {23,152},
+/* 29193 */ {23,152},
+/* 29194 */ {23,152},
+/* 29195 */ {23,152},
+/* 29196 */ {23,152},
+/* 29197 */ {23,152},
+/* 29198 */ {23,152},
+/* 29199 */ {23,152},
+/* 29200 */ {23,152},
+/* 29201 */ {23,152},
+/* 29202 */ {23,152},
+/* 29203 */ {23,152},
+/* 29204 */ {23,152},
+/* 29205 */ {23,152},
+/* 29206 */ {23,152},
+/* 29207 */ {23,152},
+/* 29208 */ {23,152},
+/* 29209 */ {23,152},
+/* 29210 */ {23,152},
+/* 29211 */ {23,152},
+/* 29212 */ {23,152},
+/* 29213 */ {23,152},
+/* 29214 */ {23,152},
+/* 29215 */ {23,152},
+/* 29216 */ {23,152},
+/* 29217 */ {23,152},
+/* 29218 */ {23,152},
+/* 29219 */ {23,152},
+/* 29220 */ {23,152},
+/* 29221 */ {23,152},
+/* 29222 */ {23,152},
+/* 29223 */ {23,152},
+/* 29224 */ {23,152},
+/* 29225 */ {23,152},
+/* 29226 */ {23,152},
+/* 29227 */ {23,152},
+/* 29228 */ {23,152},
+/* 29229 */ {23,152},
+/* 29230 */ {23,152},
+/* 29231 */ {23,152},
+/* 29232 */ {23,152},
+/* 29233 */ {23,152},
+/* 29234 */ {23,152},
+/* 29235 */ {23,152},
+/* 29236 */ {23,152},
+/* 29237 */ {23,152},
+/* 29238 */ {23,152},
+/* 29239 */ {23,152},
+/* 29240 */ {23,152},
+/* 29241 */ {23,152},
+/* 29242 */ {23,152},
+/* 29243 */ {23,152},
+/* 29244 */ {23,152},
+/* 29245 */ {23,152},
+/* 29246 */ {23,152},
+/* 29247 */ {23,152},
+/* 29248 */ {23,152},
+/* 29249 */ {23,152},
+/* 29250 */ {23,152},
+/* 29251 */ {23,152},
+/* 29252 */ {23,152},
+/* 29253 */ {23,152},
+/* 29254 */ {23,152},
+/* 29255 */ {23,152},
+/* 29256 */ {23,152},
+/* 29257 */ {23,152},
+/* 29258 */ {23,152},
+/* 29259 */ {23,152},
+/* 29260 */ {23,152},
+/* 29261 */ {23,152},
+/* 29262 */ {23,152},
+/* 29263 */ {23,152},
+/* 29264 */ {23,152},
+/* 29265 */ {23,152},
+/* 29266 */ {23,152},
+/* 29267 */ {23,152},
+/* 29268 */ {23,152},
+/* 29269 */ {23,152},
+/* 29270 */ {23,152},
+/* 29271 */ {23,152},
+/* 29272 */ {23,152},
+/* 29273 */ {23,152},
+/* 29274 */ {23,152},
+/* 29275 */ {23,152},
+/* 29276 */ {23,152},
+/* 29277 */ {23,152},
+/* 29278 */ {23,152},
+/* 29279 */ {23,152},
+/* 29280 */ {23,152},
+/* 29281 */ {23,152},
+/* 29282 */ {23,152},
+/* 29283 */ {23,152},
+/* 29284 */ {23,152},
+/* 29285 */ {23,152},
+/* 29286 */ {23,152},
+/* 29287 */ {23,152},
+/* 29288 */ {23,152},
+/* 29289 */ {23,152},
+/* 29290 */ {23,152},
+/* 29291 */ {23,152},
+/* 29292 */ {23,152},
+/* 29293 */ {23,152},
+/* 29294 */ {23,152},
+/* 29295 */ {23,152},
+/* 29296 */ {23,152},
+/* 29297 */ {23,152},
+/* 29298 */ {23,152},
+/* 29299 */ {23,152},
+/* 29300 */ {23,152},
+/* 29301 */ {23,152},
+/* 29302 */ {23,152},
+/* 29303 */ {23,152},
+/* 29304 */ {23,152},
+/* 29305 */ {23,152},
+/* 29306 */ {23,152},
+/* 29307 */ {23,152},
+/* 29308 */ {23,152},
+/* 29309 */ {23,152},
+/* 29310 */ {23,152},
+/* 29311 */ {23,152},
+/* 29312 */ {23,155},
+/* 29313 */ {23,155},
+/* 29314 */ {23,155},
+/* 29315 */ {23,155},
+/* 29316 */ {23,155},
+/* 29317 */ {23,155},
+/* 29318 */ {23,155},
+/* 29319 */ {23,155},
+/* 29320 */ {23,155},
+/* 29321 */ {23,155},
+/* 29322 */ {23,155},
+/* 29323 */ {23,155},
+/* 29324 */ {23,155},
+/* 29325 */ {23,155},
+/* 29326 */ {23,155},
+/* 29327 */ {23,155},
+/* 29328 */ {23,155},
+/* 29329 */ {23,155},
+/* 29330 */ {23,155},
+/* 29331 */ {23,155},
+/* 29332 */ {23,155},
+/* 29333 */ {23,155},
+/* 29334 */ {23,155},
+/* 29335 */ {23,155},
+/* 29336 */ {23,155},
+/* 29337 */ {23,155},
+/* 29338 */ {23,155},
+/* 29339 */ {23,155},
+/* 29340 */ {23,155},
+/* 29341 */ {23,155},
+/* 29342 */ {23,155},
+/* 29343 */ {23,155},
+/* 29344 */ {23,155},
+/* 29345 */ {23,155},
+/* 29346 */ {23,155},
+/* 29347 */ {23,155},
+/* 29348 */ {23,155},
+/* 29349 */ {23,155},
+/* 29350 */ {23,155},
+/* 29351 */ {23,155},
+/* 29352 */ {23,155},
+/* 29353 */ {23,155},
+/* 29354 */ {23,155},
+/* 29355 */ {23,155},
+/* 29356 */ {23,155},
+/* 29357 */ {23,155},
+/* 29358 */ {23,155},
+/* 29359 */ {23,155},
+/* 29360 */ {23,155},
+/* 29361 */ {23,155},
+/* 29362 */ {23,155},
+/* 29363 */ {23,155},
+/* 29364 */ {23,155},
+/* 29365 */ {23,155},
+/* 29366 */ {23,155},
+/* 29367 */ {23,155},
+/* 29368 */ {23,155},
+/* 29369 */ {23,155},
+/* 29370 */ {23,155},
+/* 29371 */ {23,155},
+/* 29372 */ {23,155},
+/* 29373 */ {23,155},
+/* 29374 */ {23,155},
+/* 29375 */ {23,155},
+/* 29376 */ {23,155},
+/* 29377 */ {23,155},
+/* 29378 */ {23,155},
+/* 29379 */ {23,155},
+/* 29380 */ {23,155},
+/* 29381 */ {23,155},
+/* 29382 */ {23,155},
+/* 29383 */ {23,155},
+/* 29384 */ {23,155},
+/* 29385 */ {23,155},
+/* 29386 */ {23,155},
+/* 29387 */ {23,155},
+/* 29388 */ {23,155},
+/* 29389 */ {23,155},
+/* 29390 */ {23,155},
+/* 29391 */ {23,155},
+/* 29392 */ {23,155},
+/* 29393 */ {23,155},
+/* 29394 */ {23,155},
+/* 29395 */ {23,155},
+/* 29396 */ {23,155},
+/* 29397 */ {23,155},
+/* 29398 */ {23,155},
+/* 29399 */ {23,155},
+/* 29400 */ {23,155},
+/* 29401 */ {23,155},
+/* 29402 */ {23,155},
+/* 29403 */ {23,155},
+/* 29404 */ {23,155},
+/* 29405 */ {23,155},
+/* 29406 */ {23,155},
+/* 29407 */ {23,155},
+/* 29408 */ {23,155},
+/* 29409 */ {23,155},
+/* 29410 */ {23,155},
+/* 29411 */ {23,155},
+/* 29412 */ {23,155},
+/* 29413 */ {23,155},
+/* 29414 */ {23,155},
+/* 29415 */ {23,155},
+/* 29416 */ {23,155},
+/* 29417 */ {23,155},
+/* 29418 */ {23,155},
+/* 29419 */ {23,155},
+/* 29420 */ {23,155},
+/* 29421 */ {23,155},
+/* 29422 */ {23,155},
+/* 29423 */ {23,155},
+/* 29424 */ {23,155},
+/* 29425 */ {23,155},
+/* 29426 */ {23,155},
+/* 29427 */ {23,155},
+/* 29428 */ {23,155},
+/* 29429 */ {23,155},
+/* 29430 */ {23,155},
+/* 29431 */ {23,155},
+/* 29432 */ {23,155},
+/* 29433 */ {23,155},
+/* 29434 */ {23,155},
+/* 29435 */ {23,155},
+/* 29436 */ {23,155},
+/* 29437 */ {23,155},
+/* 29438 */ {23,155},
+/* 29439 */ {23,155},
+/* 29440 */ {23,157},
+/* 29441 */ {23,157},
+/* 29442 */ {23,157},
+/* 29443 */ {23,157},
+/* 29444 */ {23,157},
+/* 29445 */ {23,157},
+/* 29446 */ {23,157},
+/* 29447 */ {23,157},
+/* 29448 */ {23,157},
+/* 29449 */ {23,157},
+/* 29450 */ {23,157},
+/* 29451 */ {23,157},
+/* 29452 */ {23,157},
+/* 29453 */ {23,157},
+/* 29454 */ {23,157},
+/* 29455 */ {23,157},
+/* 29456 */ {23,157},
+/* 29457 */ {23,157},
+/* 29458 */ {23,157},
+/* 29459 */ {23,157},
+/* 29460 */ {23,157},
+/* 29461 */ {23,157},
+/* 29462 */ {23,157},
+/* 29463 */ {23,157},
+/* 29464 */ {23,157},
+/* 29465 */ {23,157},
+/* 29466 */ {23,157},
+/* 29467 */ {23,157},
+/* 29468 */ {23,157},
+/* 29469 */ {23,157},
+/* 29470 */ {23,157},
+/* 29471 */ {23,157},
+/* 29472 */ {23,157},
+/* 29473 */ {23,157},
+/* 29474 */ {23,157},
+/* 29475 */ {23,157},
+/* 29476 */ {23,157},
+/* 29477 */ {23,157},
+/* 29478 */ {23,157},
+/* 29479 */ {23,157},
+/* 29480 */ {23,157},
+/* 29481 */ {23,157},
+/* 29482 */ {23,157},
+/* 29483 */ {23,157},
+/* 29484 */ {23,157},
+/* 29485 */ {23,157},
+/* 29486 */ {23,157},
+/* 29487 */ {23,157},
+/* 29488 */ {23,157},
+/* 29489 */ {23,157},
+/* 29490 */ {23,157},
+/* 29491 */ {23,157},
+/* 29492 */ {23,157},
+/* 29493 */ {23,157},
+/* 29494 */ {23,157},
+/* 29495 */ {23,157},
+/* 29496 */ {23,157},
+/* 29497 */ {23,157},
+/* 29498 */ {23,157},
+/* 29499 */ {23,157},
+/* 29500 */ {23,157},
+/* 29501 */ {23,157},
+/* 29502 */ {23,157},
+/* 29503 */ {23,157},
+/* 29504 */ {23,157},
+/* 29505 */ {23,157},
+/* 29506 */ {23,157},
+/* 29507 */ {23,157},
+/* 29508 */ {23,157},
+/* 29509 */ {23,157},
+/* 29510 */ {23,157},
+/* 29511 */ {23,157},
+/* 29512 */ {23,157},
+/* 29513 */ {23,157},
+/* 29514 */ {23,157},
+/* 29515 */ {23,157},
+/* 29516 */ {23,157},
+/* 29517 */ {23,157},
+/* 29518 */ {23,157},
+/* 29519 */ {23,157},
+/* 29520 */ {23,157},
+/* 29521 */ {23,157},
+/* 29522 */ {23,157},
+/* 29523 */ {23,157},
+/* 29524 */ {23,157},
+/* 29525 */ {23,157},
+/* 29526 */ {23,157},
+/* 29527 */ {23,157},
+/* 29528 */ {23,157},
+/* 29529 */ {23,157},
+/* 29530 */ {23,157},
+/* 29531 */ {23,157},
+/* 29532 */ {23,157},
+/* 29533 */ {23,157},
+/* 29534 */ {23,157},
+/* 29535 */ {23,157},
+/* 29536 */ {23,157},
+/* 29537 */ {23,157},
+/* 29538 */ {23,157},
+/* 29539 */ {23,157},
+/* 29540 */ {23,157},
+/* 29541 */ {23,157},
+/* 29542 */ {23,157},
+/* 29543 */ {23,157},
+/* 29544 */ {23,157},
+/* 29545 */ {23,157},
+/* 29546 */ {23,157},
+/* 29547 */ {23,157},
+/* 29548 */ {23,157},
+/* 29549 */ {23,157},
+/* 29550 */ {23,157},
+/* 29551 */ {23,157},
+/* 29552 */ {23,157},
+/* 29553 */ {23,157},
+/* 29554 */ {23,157},
+/* 29555 */ {23,157},
+/* 29556 */ {23,157},
+/* 29557 */ {23,157},
+/* 29558 */ {23,157},
+/* 29559 */ {23,157},
+/* 29560 */ {23,157},
+/* 29561 */ {23,157},
+/* 29562 */ {23,157},
+/* 29563 */ {23,157},
+/* 29564 */ {23,157},
+/* 29565 */ {23,157},
+/* 29566 */ {23,157},
+/* 29567 */ {23,157},
+/* 29568 */ {23,158},
+/* 29569 */ {23,158},
+/* 29570 */ {23,158},
+/* 29571 */ {23,158},
+/* 29572 */ {23,158},
+/* 29573 */ {23,158},
+/* 29574 */ {23,158},
+/* 29575 */ {23,158},
+/* 29576 */ {23,158},
+/* 29577 */ {23,158},
+/* 29578 */ {23,158},
+/* 29579 */ {23,158},
+/* 29580 */ {23,158},
+/* 29581 */ {23,158},
+/* 29582 */ {23,158},
+/* 29583 */ {23,158},
+/* 29584 */ {23,158},
+/* 29585 */ {23,158},
+/* 29586 */ {23,158},
+/* 29587 */ {23,158},
+/* 29588 */ {23,158},
+/* 29589 */ {23,158},
+/* 29590 */ {23,158},
+/* 29591 */ {23,158},
+/* 29592 */ {23,158},
+/* 29593 */ {23,158},
+/* 29594 */ {23,158},
+/* 29595 */ {23,158},
+/* 29596 */ {23,158},
+/* 29597 */ {23,158},
+/* 29598 */ {23,158},
+/* 29599 */ {23,158},
+/* 29600 */ {23,158},
+/* 29601 */ {23,158},
+/* 29602 */ {23,158},
+/* 29603 */ {23,158},
+/* 29604 */ {23,158},
+/* 29605 */ {23,158},
+/* 29606 */ {23,158},
+/* 29607 */ {23,158},
+/* 29608 */ {23,158},
+/* 29609 */ {23,158},
+/* 29610 */ {23,158},
+/* 29611 */ {23,158},
+/* 29612 */ {23,158},
+/* 29613 */ {23,158},
+/* 29614 */ {23,158},
+/* 29615 */ {23,158},
+/* 29616 */ {23,158},
+/* 29617 */ {23,158},
+/* 29618 */ {23,158},
+/* 29619 */ {23,158},
+/* 29620 */ {23,158},
+/* 29621 */ {23,158},
+/* 29622 */ {23,158},
+/* 29623 */ {23,158},
+/* 29624 */ {23,158},
+/* 29625 */ {23,158},
+/* 29626 */ {23,158},
+/* 29627 */ {23,158},
+/* 29628 */ {23,158},
+/* 29629 */ {23,158},
+/* 29630 */ {23,158},
+/* 29631 */ {23,158},
+/* 29632 */ {23,158},
+/* 29633 */ {23,158},
+/* 29634 */ {23,158},
+/* 29635 */ {23,158},
+/* 29636 */ {23,158},
+/* 29637 */ {23,158},
+/* 29638 */ {23,158},
+/* 29639 */ {23,158},
+/* 29640 */ {23,158},
+/* 29641 */ {23,158},
+/* 29642 */ {23,158},
+/* 29643 */ {23,158},
+/* 29644 */ {23,158},
+/* 29645 */ {23,158},
+/* 29646 */ {23,158},
+/* 29647 */ {23,158},
+/* 29648 */ {23,158},
+/* 29649 */ {23,158},
+/* 29650 */ {23,158},
+/* 29651 */ {23,158},
+/* 29652 */ {23,158},
+/* 29653 */ {23,158},
+/* 29654 */ {23,158},
+/* 29655 */ {23,158},
+/* 29656 */ {23,158},
+/* 29657 */ {23,158},
+/* 29658 */ {23,158},
+/* 29659 */ {23,158},
+/* 29660 */ {23,158},
+/* 29661 */ {23,158},
+/* 29662 */ {23,158},
+/* 29663 */ {23,158},
+/* 29664 */ {23,158},
+/* 29665 */ {23,158},
+/* 29666 */ {23,158},
+/* 29667 */ {23,158},
+/* 29668 */ {23,158},
+/* 29669 */ {23,158},
+/* 29670 */ {23,158},
+/* 29671 */ {23,158},
+/* 29672 */ {23,158},
+/* 29673 */ {23,158},
+/* 29674 */ {23,158},
+/* 29675 */ {23,158},
+/* 29676 */ {23,158},
+/* 29677 */ {23,158},
+/* 29678 */ {23,158},
+/* 29679 */ {23,158},
+/* 29680 */ {23,158},
+/* 29681 */ {23,158},
+/* 29682 */ {23,158},
+/* 29683 */ {23,158},
+/* 29684 */ {23,158},
+/* 29685 */ {23,158},
+/* 29686 */ {23,158},
+/* 29687 */ {23,158},
+/* 29688 */ {23,158},
+/* 29689 */ {23,158},
+/* 29690 */ {23,158},
+/* 29691 */ {23,158},
+/* 29692 */ {23,158},
+/* 29693 */ {23,158},
+/* 29694 */ {23,158},
+/* 29695 */ {23,158},
+/* 29696 */ {23,165},
+/* 29697 */ {23,165},
+/* 29698 */ {23,165},
+/* 29699 */ {23,165},
+/* 29700 */ {23,165},
+/* 29701 */ {23,165},
+/* 29702 */ {23,165},
+/* 29703 */ {23,165},
+/* 29704 */ {23,165},
+/* 29705 */ {23,165},
+/* 29706 */ {23,165},
+/* 29707 */ {23,165},
+/* 29708 */ {23,165},
+/* 29709 */ {23,165},
+/* 29710 */ {23,165},
+/* 29711 */ {23,165},
+/* 29712 */ {23,165},
+/* 29713 */ {23,165},
+/* 29714 */ {23,165},
+/* 29715 */ {23,165},
+/* 29716 */ {23,165},
+/* 29717 */ {23,165},
+/* 29718 */ {23,165},
+/* 29719 */ {23,165},
+/* 29720 */ {23,165},
+/* 29721 */ {23,165},
+/* 29722 */ {23,165},
+/* 29723 */ {23,165},
+/* 29724 */ {23,165},
+/* 29725 */ {23,165},
+/* 29726 */ {23,165},
+/* 29727 */ {23,165},
+/* 29728 */ {23,165},
+/* 29729 */ {23,165},
+/* 29730 */ {23,165},
+/* 29731 */ {23,165},
+/* 29732 */ {23,165},
+/* 29733 */ {23,165},
+/* 29734 */ {23,165},
+/* 29735 */ {23,165},
+/* 29736 */ {23,165},
+/* 29737 */ {23,165},
+/* 29738 */ {23,165},
+/* 29739 */ {23,165},
+/* 29740 */ {23,165},
+/* 29741 */ {23,165},
+/* 29742 */ {23,165},
+/* 29743 */ {23,165},
+/* 29744 */ {23,165},
+/* 29745 */ {23,165},
+/* 29746 */ {23,165},
+/* 29747 */ {23,165},
+/* 29748 */ {23,165},
+/* 29749 */ {23,165},
+/* 29750 */ {23,165},
+/* 29751 */ {23,165},
+/* 29752 */ {23,165},
+/* 29753 */ {23,165},
+/* 29754 */ {23,165},
+/* 29755 */ {23,165},
+/* 29756 */ {23,165},
+/* 29757 */ {23,165},
+/* 29758 */ {23,165},
+/* 29759 */ {23,165},
+/* 29760 */ {23,165},
+/* 29761 */ {23,165},
+/* 29762 */ {23,165},
+/* 29763 */ {23,165},
+/* 29764 */ {23,165},
+/* 29765 */ {23,165},
+/* 29766 */ {23,165},
+/* 29767 */ {23,165},
+/* 29768 */ {23,165},
+/* 29769 */ {23,165},
+/* 29770 */ {23,165},
+/* 29771 */ {23,165},
+/* 29772 */ {23,165},
+/* 29773 */ {23,165},
+/* 29774 */ {23,165},
+/* 29775 */ {23,165},
+/* 29776 */ {23,165},
+/* 29777 */ {23,165},
+/* 29778 */ {23,165},
+/* 29779 */ {23,165},
+/* 29780 */ {23,165},
+/* 29781 */ {23,165},
+/* 29782 */ {23,165},
+/* 29783 */ {23,165},
+/* 29784 */ {23,165},
+/* 29785 */ {23,165},
+/* 29786 */ {23,165},
+/* 29787 */ {23,165},
+/* 29788 */ {23,165},
+/* 29789 */ {23,165},
+/* 29790 */ {23,165},
+/* 29791 */ {23,165},
+/* 29792 */ {23,165},
+/* 29793 */ {23,165},
+/* 29794 */ {23,165},
+/* 29795 */ {23,165},
+/* 29796 */ {23,165},
+/* 29797 */ {23,165},
+/* 29798 */ {23,165},
+/* 29799 */ {23,165},
+/* 29800 */ {23,165},
+/* 29801 */ {23,165},
+/* 29802 */ {23,165},
+/* 29803 */ {23,165},
+/* 29804 */ {23,165},
+/* 29805 */ {23,165},
+/* 29806 */ {23,165},
+/* 29807 */ {23,165},
+/* 29808 */ {23,165},
+/* 29809 */ {23,165},
+/* 29810 */ {23,165},
+/* 29811 */ {23,165},
+/* 29812 */ {23,165},
+/* 29813 */ {23,165},
+/* 29814 */ {23,165},
+/* 29815 */ {23,165},
+/* 29816 */ {23,165},
+/* 29817 */ {23,165},
+/* 29818 */ {23,165},
+/* 29819 */ {23,165},
+/* 29820 */ {23,165},
+/* 29821 */ {23,165},
+/* 29822 */ {23,165},
+/* 29823 */ {23,165},
+/* 29824 */ {23,166},
+/* 29825 */ {23,166},
+/* 29826 */ {23,166},
+/* 29827 */ {23,166},
+/* 29828 */ {23,166},
+/* 29829 */ {23,166},
+/* 29830 */ {23,166},
+/* 29831 */ {23,166},
+/* 29832 */ {23,166},
+/* 29833 */ {23,166},
+/* 29834 */ {23,166},
+/* 29835 */ {23,166},
+/* 29836 */ {23,166},
+/* 29837 */ {23,166},
+/* 29838 */ {23,166},
+/* 29839 */ {23,166},
+/* 29840 */ {23,166},
+/* 29841 */ {23,166},
+/* 29842 */ {23,166},
+/* 29843 */ {23,166},
+/* 29844 */ {23,166},
+/* 29845 */ {23,166},
+/* 29846 */ {23,166},
+/* 29847 */ {23,166},
+/* 29848 */ {23,166},
+/* 29849 */ {23,166},
+/* 29850 */ {23,166},
+/* 29851 */ {23,166},
+/* 29852 */ {23,166},
+/* 29853 */ {23,166},
+/* 29854 */ {23,166},
+/* 29855 */ {23,166},
+/* 29856 */ {23,166},
+/* 29857 */ {23,166},
+/* 29858 */ {23,166},
+/* 29859 */ {23,166},
+/* 29860 */ {23,166},
+/* 29861 */ {23,166},
+/* 29862 */ {23,166},
+/* 29863 */ {23,166},
+/* 29864 */ {23,166},
+/* 29865 */ {23,166},
+/* 29866 */ {23,166},
+/* 29867 */ {23,166},
+/* 29868 */ {23,166},
+/* 29869 */ {23,166},
+/* 29870 */ {23,166},
+/* 29871 */ {23,166},
+/* 29872 */ {23,166},
+/* 29873 */ {23,166},
+/* 29874 */ {23,166},
+/* 29875 */ {23,166},
+/* 29876 */ {23,166},
+/* 29877 */ {23,166},
+/* 29878 */ {23,166},
+/* 29879 */ {23,166},
+/* 29880 */ {23,166},
+/* 29881 */ {23,166},
+/* 29882 */ {23,166},
+/* 29883 */ {23,166},
+/* 29884 */ {23,166},
+/* 29885 */ {23,166},
+/* 29886 */ {23,166},
+/* 29887 */ {23,166},
+/* 29888 */ {23,166},
+/* 29889 */ {23,166},
+/* 29890 */ {23,166},
+/* 29891 */ {23,166},
+/* 29892 */ {23,166},
+/* 29893 */ {23,166},
+/* 29894 */ {23,166},
+/* 29895 */ {23,166},
+/* 29896 */ {23,166},
+/* 29897 */ {23,166},
+/* 29898 */ {23,166},
+/* 29899 */ {23,166},
+/* 29900 */ {23,166},
+/* 29901 */ {23,166},
+/* 29902 */ {23,166},
+/* 29903 */ {23,166},
+/* 29904 */ {23,166},
+/* 29905 */ {23,166},
+/* 29906 */ {23,166},
+/* 29907 */ {23,166},
+/* 29908 */ {23,166},
+/* 29909 */ {23,166},
+/* 29910 */ {23,166},
+/* 29911 */ {23,166},
+/* 29912 */ {23,166},
+/* 29913 */ {23,166},
+/* 29914 */ {23,166},
+/* 29915 */ {23,166},
+/* 29916 */ {23,166},
+/* 29917 */ {23,166},
+/* 29918 */ {23,166},
+/* 29919 */ {23,166},
+/* 29920 */ {23,166},
+/* 29921 */ {23,166},
+/* 29922 */ {23,166},
+/* 29923 */ {23,166},
+/* 29924 */ {23,166},
+/* 29925 */ {23,166},
+/* 29926 */ {23,166},
+/* 29927 */ {23,166},
+/* 29928 */ {23,166},
+/* 29929 */ {23,166},
+/* 29930 */ {23,166},
+/* 29931 */ {23,166},
+/* 29932 */ {23,166},
+/* 29933 */ {23,166},
+/* 29934 */ {23,166},
+/* 29935 */ {23,166},
+/* 29936 */ {23,166},
+/* 29937 */ {23,166},
+/* 29938 */ {23,166},
+/* 29939 */ {23,166},
+/* 29940 */ {23,166},
+/* 29941 */ {23,166},
+/* 29942 */ {23,166},
+/* 29943 */ {23,166},
+/* 29944 */ {23,166},
+/* 29945 */ {23,166},
+/* 29946 */ {23,166},
+/* 29947 */ {23,166},
+/* 29948 */ {23,166},
+/* 29949 */ {23,166},
+/* 29950 */ {23,166},
+/* 29951 */ {23,166},
+/* 29952 */ {23,168},
+/* 29953 */ {23,168},
+/* 29954 */ {23,168},
+/* 29955 */ {23,168},
+/* 29956 */ {23,168},
+/* 29957 */ {23,168},
+/* 29958 */ {23,168},
+/* 29959 */ {23,168},
+/* 29960 */ {23,168},
+/* 29961 */ {23,168},
+/* 29962 */ {23,168},
+/* 29963 */ {23,168},
+/* 29964 */ {23,168},
+/* 29965 */ {23,168},
+/* 29966 */ {23,168},
+/* 29967 */ {23,168},
+/* 29968 */ {23,168},
+/* 29969 */ {23,168},
+/* 29970 */ {23,168},
+/* 29971 */ {23,168},
+/* 29972 */ {23,168},
+/* 29973 */ {23,168},
+/* 29974 */ {23,168},
+/* 29975 */ {23,168},
+/* 29976 */ {23,168},
+/* 29977 */ {23,168},
+/* 29978 */ {23,168},
+/* 29979 */ {23,168},
+/* 29980 */ {23,168},
+/* 29981 */ {23,168},
+/* 29982 */ {23,168},
+/* 29983 */ {23,168},
+/* 29984 */ {23,168},
+/* 29985 */ {23,168},
+/* 29986 */ {23,168},
+/* 29987 */ {23,168},
+/* 29988 */ {23,168},
+/* 29989 */ {23,168},
+/* 29990 */ {23,168},
+/* 29991 */ {23,168},
+/* 29992 */ {23,168},
+/* 29993 */ {23,168},
+/* 29994 */ {23,168},
+/* 29995 */ {23,168},
+/* 29996 */ {23,168},
+/* 29997 */ {23,168},
+/* 29998 */ {23,168},
+/* 29999 */ {23,168},
+/* 30000 */ {23,168},
+/* 30001 */ {23,168},
+/* 30002 */ {23,168},
+/* 30003 */ {23,168},
+/* 30004 */ {23,168},
+/* 30005 */ {23,168},
+/* 30006 */ {23,168},
+/* 30007 */ {23,168},
+/* 30008 */ {23,168},
+/* 30009 */ {23,168},
+/* 30010 */ {23,168},
+/* 30011 */ {23,168},
+/* 30012 */ {23,168},
+/* 30013 */ {23,168},
+/* 30014 */ {23,168},
+/* 30015 */ {23,168},
+/* 30016 */ {23,168},
+/* 30017 */ {23,168},
+/* 30018 */ {23,168},
+/* 30019 */ {23,168},
+/* 30020 */ {23,168},
+/* 30021 */ {23,168},
+/* 30022 */ {23,168},
+/* 30023 */ {23,168},
+/* 30024 */ {23,168},
+/* 30025 */ {23,168},
+/* 30026 */ {23,168},
+/* 30027 */ {23,168},
+/* 30028 */ {23,168},
+/* 30029 */ {23,168},
+/* 30030 */ {23,168},
+/* 30031 */ {23,168},
+/* 30032 */ {23,168},
+/* 30033 */ {23,168},
+/* 30034 */ {23,168},
+/* 30035 */ {23,168},
+/* 30036 */ {23,168},
+/* 30037 */ {23,168},
+/* 30038 */ {23,168},
+/* 30039 */ {23,168},
+/* 30040 */ {23,168},
+/* 30041 */ {23,168},
+/* 30042 */ {23,168},
+/* 30043 */ {23,168},
+/* 30044 */ {23,168},
+/* 30045 */ {23,168},
+/* 30046 */ {23,168},
+/* 30047 */ {23,168},
+/* 30048 */ {23,168},
+/* 30049 */ {23,168},
+/* 30050 */ {23,168},
+/* 30051 */ {23,168},
+/* 30052 */ {23,168},
+/* 30053 */ {23,168},
+/* 30054 */ {23,168},
+/* 30055 */ {23,168},
+/* 30056 */ {23,168},
+/* 30057 */ {23,168},
+/* 30058 */ {23,168},
+/* 30059 */ {23,168},
+/* 30060 */ {23,168},
+/* 30061 */ {23,168},
+/* 30062 */ {23,168},
+/* 30063 */ {23,168},
+/* 30064 */ {23,168},
+/* 30065 */ {23,168},
+/* 30066 */ {23,168},
+/* 30067 */ {23,168},
+/* 30068 */ {23,168},
+/* 30069 */ {23,168},
+/* 30070 */ {23,168},
+/* 30071 */ {23,168},
+/* 30072 */ {23,168},
+/* 30073 */ {23,168},
+/* 30074 */ {23,168},
+/* 30075 */ {23,168},
+/* 30076 */ {23,168},
+/* 30077 */ {23,168},
+/* 30078 */ {23,168},
+/* 30079 */ {23,168},
+/* 30080 */ {23,174},
+/* 30081 */ {23,174},
+/* 30082 */ {23,174},
+/* 30083 */ {23,174},
+/* 30084 */ {23,174},
+/* 30085 */ {23,174},
+/* 30086 */ {23,174},
+/* 30087 */ {23,174},
+/* 30088 */ {23,174},
+/* 30089 */ {23,174},
+/* 30090 */ {23,174},
+/* 30091 */ {23,174},
+/* 30092 */ {23,174},
+/* 30093 */ {23,174},
+/* 30094 */ {23,174},
+/* 30095 */ {23,174},
+/* 30096 */ {23,174},
+/* 30097 */ {23,174},
+/* 30098 */ {23,174},
+/* 30099 */ {23,174},
+/* 30100 */ {23,174},
+/* 30101 */ {23,174},
+/* 30102 */ {23,174},
+/* 30103 */ {23,174},
+/* 30104 */ {23,174},
+/* 30105 */ {23,174},
+/* 30106 */ {23,174},
+/* 30107 */ {23,174},
+/* 30108 */ {23,174},
+/* 30109 */ {23,174},
+/* 30110 */ {23,174},
+/* 30111 */ {23,174},
+/* 30112 */ {23,174},
+/* 30113 */ {23,174},
+/* 30114 */ {23,174},
+/* 30115 */ {23,174},
+/* 30116 */ {23,174},
+/* 30117 */ {23,174},
+/* 30118 */ {23,174},
+/* 30119 */ {23,174},
+/* 30120 */ {23,174},
+/* 30121 */ {23,174},
+/* 30122 */ {23,174},
+/* 30123 */ {23,174},
+/* 30124 */ {23,174},
+/* 30125 */ {23,174},
+/* 30126 */ {23,174},
+/* 30127 */ {23,174},
+/* 30128 */ {23,174},
+/* 30129 */ {23,174},
+/* 30130 */ {23,174},
+/* 30131 */ {23,174},
+/* 30132 */ {23,174},
+/* 30133 */ {23,174},
+/* 30134 */ {23,174},
+/* 30135 */ {23,174},
+/* 30136 */ {23,174},
+/* 30137 */ {23,174},
+/* 30138 */ {23,174},
+/* 30139 */ {23,174},
+/* 30140 */ {23,174},
+/* 30141 */ {23,174},
+/* 30142 */ {23,174},
+/* 30143 */ {23,174},
+/* 30144 */ {23,174},
+/* 30145 */ {23,174},
+/* 30146 */ {23,174},
+/* 30147 */ {23,174},
+/* 30148 */ {23,174},
+/* 30149 */ {23,174},
+/* 30150 */ {23,174},
+/* 30151 */ {23,174},
+/* 30152 */ {23,174},
+/* 30153 */ {23,174},
+/* 30154 */ {23,174},
+/* 30155 */ {23,174},
+/* 30156 */ {23,174},
+/* 30157 */ {23,174},
+/* 30158 */ {23,174},
+/* 30159 */ {23,174},
+/* 30160 */ {23,174},
+/* 30161 */ {23,174},
+/* 30162 */ {23,174},
+/* 30163 */ {23,174},
+/* 30164 */ {23,174},
+/* 30165 */ {23,174},
+/* 30166 */ {23,174},
+/* 30167 */ {23,174},
+/* 30168 */ {23,174},
+/* 30169 */ {23,174},
+/* 30170 */ {23,174},
+/* 30171 */ {23,174},
+/* 30172 */ {23,174},
+/* 30173 */ {23,174},
+/* 30174 */ {23,174},
+/* 30175 */ {23,174},
+/* 30176 */ {23,174},
+/* 30177 */ {23,174},
+/* 30178 */ {23,174},
+/* 30179 */ {23,174},
+/* 30180 */ {23,174},
+/* 30181 */ {23,174},
+/* 30182 */ {23,174},
+/* 30183 */ {23,174},
+/* 30184 */ {23,174},
+/* 30185 */ {23,174},
+/* 30186 */ {23,174},
+/* 30187 */ {23,174},
+/* 30188 */ {23,174},
+/* 30189 */ {23,174},
+/* 30190 */ {23,174},
+/* 30191 */ {23,174},
+/* 30192 */ {23,174},
+/* 30193 */ {23,174},
+/* 30194 */ {23,174},
+/* 30195 */ {23,174},
+/* 30196 */ {23,174},
+/* 30197 */ {23,174},
+/* 30198 */ {23,174},
+/* 30199 */ {23,174},
+/* 30200 */ {23,174},
+/* 30201 */ {23,174},
+/* 30202 */ {23,174},
+/* 30203 */ {23,174},
+/* 30204 */ {23,174},
+/* 30205 */ {23,174},
+/* 30206 */ {23,174},
+/* 30207 */ {23,174},
+/* 30208 */ {23,175},
+/* 30209 */ {23,175},
+/* 30210 */ {23,175},
+/* 30211 */ {23,175},
+/* 30212 */ {23,175},
+/* 30213 */ {23,175},
+/* 30214 */ {23,175},
+/* 30215 */ {23,175},
+/* 30216 */ {23,175},
+/* 30217 */ {23,175},
+/* 30218 */ {23,175},
+/* 30219 */ {23,175},
+/* 30220 */ {23,175},
+/* 30221 */ {23,175},
+/* 30222 */ {23,175},
+/* 30223 */ {23,175},
+/* 30224 */ {23,175},
+/* 30225 */ {23,175},
+/* 30226 */ {23,175},
+/* 30227 */ {23,175},
+/* 30228 */ {23,175},
+/* 30229 */ {23,175},
+/* 30230 */ {23,175},
+/* 30231 */ {23,175},
+/* 30232 */ {23,175},
+/* 30233 */ {23,175},
+/* 30234 */ {23,175},
+/* 30235 */ {23,175},
+/* 30236 */ {23,175},
+/* 30237 */ {23,175},
+/* 30238 */ {23,175},
+/* 30239 */ {23,175},
+/* 30240 */ {23,175},
+/* 30241 */ {23,175},
+/* 30242 */ {23,175},
+/* 30243 */ {23,175},
+/* 30244 */ {23,175},
+/* 30245 */ {23,175},
+/* 30246 */ {23,175},
+/* 30247 */ {23,175},
+/* 30248 */ {23,175},
+/* 30249 */ {23,175},
+/* 30250 */ {23,175},
+/* 30251 */ {23,175},
+/* 30252 */ {23,175},
+/* 30253 */ {23,175},
+/* 30254 */ {23,175},
+/* 30255 */ {23,175},
+/* 30256 */ {23,175},
+/* 30257 */ {23,175},
+/* 30258 */ {23,175},
+/* 30259 */ {23,175},
+/* 30260 */ {23,175},
+/* 30261 */ {23,175},
+/* 30262 */ {23,175},
+/* 30263 */ {23,175},
+/* 30264 */ {23,175},
+/* 30265 */ {23,175},
+/* 30266 */ {23,175},
+/* 30267 */ {23,175},
+/* 30268 */ {23,175},
+/* 30269 */ {23,175},
+/* 30270 */ {23,175},
+/* 30271 */ {23,175},
+/* 30272 */ {23,175},
+/* 30273 */ {23,175},
+/* 30274 */ {23,175},
+/* 30275 */ {23,175},
+/* 30276 */ {23,175},
+/* 30277 */ {23,175},
+/* 30278 */ {23,175},
+/* 30279 */ {23,175},
+/* 30280 */ {23,175},
+/* 30281 */ {23,175},
+/* 30282 */ {23,175},
+/* 30283 */ {23,175},
+/* 30284 */ {23,175},
+/* 30285 */ {23,175},
+/* 30286 */ {23,175},
+/* 30287 */ {23,175},
+/* 30288 */ {23,175},
+/* 30289 */ {23,175},
+/* 30290 */ {23,175},
+/* 30291 */ {23,175},
+/* 30292 */ {23,175},
+/* 30293 */ {23,175},
+/* 30294 */ {23,175},
+/* 30295 */ {23,175},
+/* 30296 */ {23,175},
+/* 30297 */ {23,175},
+/* 30298 */ {23,175},
+/* 30299 */ {23,175},
+/* 30300 */ {23,175},
+/* 30301 */ {23,175},
+/* 30302 */ {23,175},
+/* 30303 */ {23,175},
+/* 30304 */ {23,175},
+/* 30305 */ {23,175},
+/* 30306 */ {23,175},
+/* 30307 */ {23,175},
+/* 30308 */ {23,175},
+/* 30309 */ {23,175},
+/* 30310 */ {23,175},
+/* 30311 */ {23,175},
+/* 30312 */ {23,175},
+/* 30313 */ {23,175},
+/* 30314 */ {23,175},
+/* 30315 */ {23,175},
+/* 30316 */ {23,175},
+/* 30317 */ {23,175},
+/* 30318 */ {23,175},
+/* 30319 */ {23,175},
+/* 30320 */ {23,175},
+/* 30321 */ {23,175},
+/* 30322 */ {23,175},
+/* 30323 */ {23,175},
+/* 30324 */ {23,175},
+/* 30325 */ {23,175},
+/* 30326 */ {23,175},
+/* 30327 */ {23,175},
+/* 30328 */ {23,175},
+/* 30329 */ {23,175},
+/* 30330 */ {23,175},
+/* 30331 */ {23,175},
+/* 30332 */ {23,175},
+/* 30333 */ {23,175},
+/* 30334 */ {23,175},
+/* 30335 */ {23,175},
+/* 30336 */ {23,180},
+/* 30337 */ {23,180},
+/* 30338 */ {23,180},
+/* 30339 */ {23,180},
+/* 30340 */ {23,180},
+/* 30341 */ {23,180},
+/* 30342 */ {23,180},
+/* 30343 */ {23,180},
+/* 30344 */ {23,180},
+/* 30345 */ {23,180},
+/* 30346 */ {23,180},
+/* 30347 */ {23,180},
+/* 30348 */ {23,180},
+/* 30349 */ {23,180},
+/* 30350 */ {23,180},
+/* 30351 */ {23,180},
+/* 30352 */ {23,180},
+/* 30353 */ {23,180},
+/* 30354 */ {23,180},
+/* 30355 */ {23,180},
+/* 30356 */ {23,180},
+/* 30357 */ {23,180},
+/* 30358 */ {23,180},
+/* 30359 */ {23,180},
+/* 30360 */ {23,180},
+/* 30361 */ {23,180},
+/* 30362 */ {23,180},
+/* 30363 */ {23,180},
+/* 30364 */ {23,180},
+/* 30365 */ {23,180},
+/* 30366 */ {23,180},
+/* 30367 */ {23,180},
+/* 30368 */ {23,180},
+/* 30369 */ {23,180},
+/* 30370 */ {23,180},
+/* 30371 */ {23,180},
+/* 30372 */ {23,180},
+/* 30373 */ {23,180},
+/* 30374 */ {23,180},
+/* 30375 */ {23,180},
+/* 30376 */ {23,180},
+/* 30377 */ {23,180},
+/* 30378 */ {23,180},
+/* 30379 */ {23,180},
+/* 30380 */ {23,180},
+/* 30381 */ {23,180},
+/* 30382 */ {23,180},
+/* 30383 */ {23,180},
+/* 30384 */ {23,180},
+/* 30385 */ {23,180},
+/* 30386 */ {23,180},
+/* 30387 */ {23,180},
+/* 30388 */ {23,180},
+/* 30389 */ {23,180},
+/* 30390 */ {23,180},
+/* 30391 */ {23,180},
+/* 30392 */ {23,180},
+/* 30393 */ {23,180},
+/* 30394 */ {23,180},
+/* 30395 */ {23,180},
+/* 30396 */ {23,180},
+/* 30397 */ {23,180},
+/* 30398 */ {23,180},
+/* 30399 */ {23,180},
+/* 30400 */ {23,180},
+/* 30401 */ {23,180},
+/* 30402 */ {23,180},
+/* 30403 */ {23,180},
+/* 30404 */ {23,180},
+/* 30405 */ {23,180},
+/* 30406 */ {23,180},
+/* 30407 */ {23,180},
+/* 30408 */ {23,180},
+/* 30409 */ {23,180},
+/* 30410 */ {23,180},
+/* 30411 */ {23,180},
+/* 30412 */ {23,180},
+/* 30413 */ {23,180},
+/* 30414 */ {23,180},
+/* 30415 */ {23,180},
+/* 30416 */ {23,180},
+/* 30417 */ {23,180},
+/* 30418 */ {23,180},
+/* 30419 */ {23,180},
+/* 30420 */ {23,180},
+/* 30421 */ {23,180},
+/* 30422 */ {23,180},
+/* 30423 */ {23,180},
+/* 30424 */ {23,180},
+/* 30425 */ {23,180},
+/* 30426 */ {23,180},
+/* 30427 */ {23,180},
+/* 30428 */ {23,180},
+/* 30429 */ {23,180},
+/* 30430 */ {23,180},
+/* 30431 */ {23,180},
+/* 30432 */ {23,180},
+/* 30433 */ {23,180},
+/* 30434 */ {23,180},
+/* 30435 */ {23,180},
+/* 30436 */ {23,180},
+/* 30437 */ {23,180},
+/* 30438 */ {23,180},
+/* 30439 */ {23,180},
+/* 30440 */ {23,180},
+/* 30441 */ {23,180},
+/* 30442 */ {23,180},
+/* 30443 */ {23,180},
+/* 30444 */ {23,180},
+/* 30445 */ {23,180},
+/* 30446 */ {23,180},
+/* 30447 */ {23,180},
+/* 30448 */ {23,180},
+/* 30449 */ {23,180},
+/* 30450 */ {23,180},
+/* 30451 */ {23,180},
+/* 30452 */ {23,180},
+/* 30453 */ {23,180},
+/* 30454 */ {23,180},
+/* 30455 */ {23,180},
+/* 30456 */ {23,180},
+/* 30457 */ {23,180},
+/* 30458 */ {23,180},
+/* 30459 */ {23,180},
+/* 30460 */ {23,180},
+/* 30461 */ {23,180},
+/* 30462 */ {23,180},
+/* 30463 */ {23,180},
+/* 30464 */ {23,182},
+/* 30465 */ {23,182},
+/* 30466 */ {23,182},
+/* 30467 */ {23,182},
+/* 30468 */ {23,182},
+/* 30469 */ {23,182},
+/* 30470 */ {23,182},
+/* 30471 */ {23,182},
+/* 30472 */ {23,182},
+/* 30473 */ {23,182},
+/* 30474 */ {23,182},
+/* 30475 */ {23,182},
+/* 30476 */ {23,182},
+/* 30477 */ {23,182},
+/* 30478 */ {23,182},
+/* 30479 */ {23,182},
+/* 30480 */ {23,182},
+/* 30481 */ {23,182},
+/* 30482 */ {23,182},
+/* 30483 */ {23,182},
+/* 30484 */ {23,182},
+/* 30485 */ {23,182},
+/* 30486 */ {23,182},
+/* 30487 */ {23,182},
+/* 30488 */ {23,182},
+/* 30489 */ {23,182},
+/* 30490 */ {23,182},
+/* 30491 */ {23,182},
+/* 30492 */ {23,182},
+/* 30493 */ {23,182},
+/* 30494 */ {23,182},
+/* 30495 */ {23,182},
+/* 30496 */ {23,182},
+/* 30497 */ {23,182},
+/* 30498 */ {23,182},
+/* 30499 */ {23,182},
+/* 30500 */ {23,182},
+/* 30501 */ {23,182},
+/* 30502 */ {23,182},
+/* 30503 */ {23,182},
+/* 30504 */ {23,182},
+/* 30505 */ {23,182},
+/* 30506 */ {23,182},
+/* 30507 */ {23,182},
+/* 30508 */ {23,182},
+/* 30509 */ {23,182},
+/* 30510 */ {23,182},
+/* 30511 */ {23,182},
+/* 30512 */ {23,182},
+/* 30513 */ {23,182},
+/* 30514 */ {23,182},
+/* 30515 */ {23,182},
+/* 30516 */ {23,182},
+/* 30517 */ {23,182},
+/* 30518 */ {23,182},
+/* 30519 */ {23,182},
+/* 30520 */ {23,182},
+/* 30521 */ {23,182},
+/* 30522 */ {23,182},
+/* 30523 */ {23,182},
+/* 30524 */ {23,182},
+/* 30525 */ {23,182},
+/* 30526 */ {23,182},
+/* 30527 */ {23,182},
+/* 30528 */ {23,182},
+/* 30529 */ {23,182},
+/* 30530 */ {23,182},
+/* 30531 */ {23,182},
+/* 30532 */ {23,182},
+/* 30533 */ {23,182},
+/* 30534 */ {23,182},
+/* 30535 */ {23,182},
+/* 30536 */ {23,182},
+/* 30537 */ {23,182},
+/* 30538 */ {23,182},
+/* 30539 */ {23,182},
+/* 30540 */ {23,182},
+/* 30541 */ {23,182},
+/* 30542 */ {23,182},
+/* 30543 */ {23,182},
+/* 30544 */ {23,182},
+/* 30545 */ {23,182},
+/* 30546 */ {23,182},
+/* 30547 */ {23,182},
+/* 30548 */ {23,182},
+/* 30549 */ {23,182},
+/* 30550 */ {23,182},
+/* 30551 */ {23,182},
+/* 30552 */ {23,182},
+/* 30553 */ {23,182},
+/* 30554 */ {23,182},
+/* 30555 */ {23,182},
+/* 30556 */ {23,182},
+/* 30557 */ {23,182},
+/* 30558 */ {23,182},
+/* 30559 */ {23,182},
+/* 30560 */ {23,182},
+/* 30561 */ {23,182},
+/* 30562 */ {23,182},
+/* 30563 */ {23,182},
+/* 30564 */ {23,182},
+/* 30565 */ {23,182},
+/* 30566 */ {23,182},
+/* 30567 */ {23,182},
+/* 30568 */ {23,182},
+/* 30569 */ {23,182},
+/* 30570 */ {23,182},
+/* 30571 */ {23,182},
+/* 30572 */ {23,182},
+/* 30573 */ {23,182},
+/* 30574 */ {23,182},
+/* 30575 */ {23,182},
+/* 30576 */ {23,182},
+/* 30577 */ {23,182},
+/* 30578 */ {23,182},
+/* 30579 */ {23,182},
+/* 30580 */ {23,182},
+/* 30581 */ {23,182},
+/* 30582 */ {23,182},
+/* 30583 */ {23,182},
+/* 30584 */ {23,182},
+/* 30585 */ {23,182},
+/* 30586 */ {23,182},
+/* 30587 */ {23,182},
+/* 30588 */ {23,182},
+/* 30589 */ {23,182},
+/* 30590 */ {23,182},
+/* 30591 */ {23,182},
+/* 30592 */ {23,183},
+/* 30593 */ {23,183},
+/* 30594 */ {23,183},
+/* 30595 */ {23,183},
+/* 30596 */ {23,183},
+/* 30597 */ {23,183},
+/* 30598 */ {23,183},
+/* 30599 */ {23,183},
+/* 30600 */ {23,183},
+/* 30601 */ {23,183},
+/* 30602 */ {23,183},
+/* 30603 */ {23,183},
+/* 30604 */ {23,183},
+/* 30605 */ {23,183},
+/* 30606 */ {23,183},
+/* 30607 */ {23,183},
+/* 30608 */ {23,183},
+/* 30609 */ {23,183},
+/* 30610 */ {23,183},
+/* 30611 */ {23,183},
+/* 30612 */ {23,183},
+/* 30613 */ {23,183},
+/* 30614 */ {23,183},
+/* 30615 */ {23,183},
+/* 30616 */ {23,183},
+/* 30617 */ {23,183},
+/* 30618 */ {23,183},
+/* 30619 */ {23,183},
+/* 30620 */ {23,183},
+/* 30621 */ {23,183},
+/* 30622 */ {23,183},
+/* 30623 */ {23,183},
+/* 30624 */ {23,183},
+/* 30625 */ {23,183},
+/* 30626 */ {23,183},
+/* 30627 */ {23,183},
+/* 30628 */ {23,183},
+/* 30629 */ {23,183},
+/* 30630 */ {23,183},
+/* 30631 */ {23,183},
+/* 30632 */ {23,183},
+/* 30633 */ {23,183},
+/* 30634 */ {23,183},
+/* 30635 */ {23,183},
+/* 30636 */ {23,183},
+/* 30637 */ {23,183},
+/* 30638 */ {23,183},
+/* 30639 */ {23,183},
+/* 30640 */ {23,183},
+/* 30641 */ {23,183},
+/* 30642 */ {23,183},
+/* 30643 */ {23,183},
+/* 30644 */ {23,183},
+/* 30645 */ {23,183},
+/* 30646 */ {23,183},
+/* 30647 */ {23,183},
+/* 30648 */ {23,183},
+/* 30649 */ {23,183},
+/* 30650 */ {23,183},
+/* 30651 */ {23,183},
+/* 30652 */ {23,183},
+/* 30653 */ {23,183},
+/* 30654 */ {23,183},
+/* 30655 */ {23,183},
+/* 30656 */ {23,183},
+/* 30657 */ {23,183},
+/* 30658 */ {23,183},
+/* 30659 */ {23,183},
+/* 30660 */ {23,183},
+/* 30661 */ {23,183},
+/* 30662 */ {23,183},
+/* 30663 */ {23,183},
+/* 30664 */ {23,183},
+/* 30665 */ {23,183},
+/* 30666 */ {23,183},
+/* 30667 */ {23,183},
+/* 30668 */ {23,183},
+/* 30669 */ {23,183},
+/* 30670 */ {23,183},
+/* 30671 */ {23,183},
+/* 30672 */ {23,183},
+/* 30673 */ {23,183},
+/* 30674 */ {23,183},
+/* 30675 */ {23,183},
+/* 30676 */ {23,183},
+/* 30677 */ {23,183},
+/* 30678 */ {23,183},
+/* 30679 */ {23,183},
+/* 30680 */ {23,183},
+/* 30681 */ {23,183},
+/* 30682 */ {23,183},
+/* 30683 */ {23,183},
+/* 30684 */ {23,183},
+/* 30685 */ {23,183},
+/* 30686 */ {23,183},
+/* 30687 */ {23,183},
+/* 30688 */ {23,183},
+/* 30689 */ {23,183},
+/* 30690 */ {23,183},
+/* 30691 */ {23,183},
+/* 30692 */ {23,183},
+/* 30693 */ {23,183},
+/* 30694 */ {23,183},
+/* 30695 */ {23,183},
+/* 30696 */ {23,183},
+/* 30697 */ {23,183},
+/* 30698 */ {23,183},
+/* 30699 */ {23,183},
+/* 30700 */ {23,183},
+/* 30701 */ {23,183},
+/* 30702 */ {23,183},
+/* 30703 */ {23,183},
+/* 30704 */ {23,183},
+/* 30705 */ {23,183},
+/* 30706 */ {23,183},
+/* 30707 */ {23,183},
+/* 30708 */ {23,183},
+/* 30709 */ {23,183},
+/* 30710 */ {23,183},
+/* 30711 */ {23,183},
+/* 30712 */ {23,183},
+/* 30713 */ {23,183},
+/* 30714 */ {23,183},
+/* 30715 */ {23,183},
+/* 30716 */ {23,183},
+/* 30717 */ {23,183},
+/* 30718 */ {23,183},
+/* 30719 */ {23,183},
+/* 30720 */ {23,188},
+/* 30721 */ {23,188},
+/* 30722 */ {23,188},
+/* 30723 */ {23,188},
+/* 30724 */ {23,188},
+/* 30725 */ {23,188},
+/* 30726 */ {23,188},
+/* 30727 */ {23,188},
+/* 30728 */ {23,188},
+/* 30729 */ {23,188},
+/* 30730 */ {23,188},
+/* 30731 */ {23,188},
+/* 30732 */ {23,188},
+/* 30733 */ {23,188},
+/* 30734 */ {23,188},
+/* 30735 */ {23,188},
+/* 30736 */ {23,188},
+/* 30737 */ {23,188},
+/* 30738 */ {23,188},
+/* 30739 */ {23,188},
+/* 30740 */ {23,188},
+/* 30741 */ {23,188},
+/* 30742 */ {23,188},
+/* 30743 */ {23,188},
+/* 30744 */ {23,188},
+/* 30745 */ {23,188},
+/* 30746 */ {23,188},
+/* 30747 */ {23,188},
+/* 30748 */ {23,188},
+/* 30749 */ {23,188},
+/* 30750 */ {23,188},
+/* 30751 */ {23,188},
+/* 30752 */ {23,188},
+/* 30753 */ {23,188},
+/* 30754 */ {23,188},
+/* 30755 */ {23,188},
+/* 30756 */ {23,188},
+/* 30757 */ {23,188},
+/* 30758 */ {23,188},
+/* 30759 */ {23,188},
+/* 30760 */ {23,188},
+/* 30761 */ {23,188},
+/* 30762 */ {23,188},
+/* 30763 */ {23,188},
+/* 30764 */ {23,188},
+/* 30765 */ {23,188},
+/* 30766 */ {23,188},
+/* 30767 */ {23,188},
+/* 30768 */ {23,188},
+/* 30769 */ {23,188},
+/* 30770 */ {23,188},
+/* 30771 */ {23,188},
+/* 30772 */ {23,188},
+/* 30773 */ {23,188},
+/* 30774 */ {23,188},
+/* 30775 */ {23,188},
+/* 30776 */ {23,188},
+/* 30777 */ {23,188},
+/* 30778 */ {23,188},
+/* 30779 */ {23,188},
+/* 30780 */ {23,188},
+/* 30781 */ {23,188},
+/* 30782 */ {23,188},
+/* 30783 */ {23,188},
+/* 30784 */ {23,188},
+/* 30785 */ {23,188},
+/* 30786 */ {23,188},
+/* 30787 */ {23,188},
+/* 30788 */ {23,188},
+/* 30789 */ {23,188},
+/* 30790 */ {23,188},
+/* 30791 */ {23,188},
+/* 30792 */ {23,188},
+/* 30793 */ {23,188},
+/* 30794 */ {23,188},
+/* 30795 */ {23,188},
+/* 30796 */ {23,188},
+/* 30797 */ {23,188},
+/* 30798 */ {23,188},
+/* 30799 */ {23,188},
+/* 30800 */ {23,188},
+/* 30801 */ {23,188},
+/* 30802 */ {23,188},
+/* 30803 */ {23,188},
+/* 30804 */ {23,188},
+/* 30805 */ {23,188},
+/* 30806 */ {23,188},
+/* 30807 */ {23,188},
+/* 30808 */ {23,188},
+/* 30809 */ {23,188},
+/* 30810 */ {23,188},
+/* 30811 */ {23,188},
+/* 30812 */ {23,188},
+/* 30813 */ {23,188},
+/* 30814 */ {23,188},
+/* 30815 */ {23,188},
+/* 30816 */ {23,188},
+/* 30817 */ {23,188},
+/* 30818 */ {23,188},
+/* 30819 */ {23,188},
+/* 30820 */ {23,188},
+/* 30821 */ {23,188},
+/* 30822 */ {23,188},
+/* 30823 */ {23,188},
+/* 30824 */ {23,188},
+/* 30825 */ {23,188},
+/* 30826 */ {23,188},
+/* 30827 */ {23,188},
+/* 30828 */ {23,188},
+/* 30829 */ {23,188},
+/* 30830 */ {23,188},
+/* 30831 */ {23,188},
+/* 30832 */ {23,188},
+/* 30833 */ {23,188},
+/* 30834 */ {23,188},
+/* 30835 */ {23,188},
+/* 30836 */ {23,188},
+/* 30837 */ {23,188},
+/* 30838 */ {23,188},
+/* 30839 */ {23,188},
+/* 30840 */ {23,188},
+/* 30841 */ {23,188},
+/* 30842 */ {23,188},
+/* 30843 */ {23,188},
+/* 30844 */ {23,188},
+/* 30845 */ {23,188},
+/* 30846 */ {23,188},
+/* 30847 */ {23,188},
+/* 30848 */ {23,191},
+/* 30849 */ {23,191},
+/* 30850 */ {23,191},
+/* 30851 */ {23,191},
+/* 30852 */ {23,191},
+/* 30853 */ {23,191},
+/* 30854 */ {23,191},
+/* 30855 */ {23,191},
+/* 30856 */ {23,191},
+/* 30857 */ {23,191},
+/* 30858 */ {23,191},
+/* 30859 */ {23,191},
+/* 30860 */ {23,191},
+/* 30861 */ {23,191},
+/* 30862 */ {23,191},
+/* 30863 */ {23,191},
+/* 30864 */ {23,191},
+/* 30865 */ {23,191},
+/* 30866 */ {23,191},
+/* 30867 */ {23,191},
+/* 30868 */ {23,191},
+/* 30869 */ {23,191},
+/* 30870 */ {23,191},
+/* 30871 */ {23,191},
+/* 30872 */ {23,191},
+/* 30873 */ {23,191},
+/* 30874 */ {23,191},
+/* 30875 */ {23,191},
+/* 30876 */ {23,191},
+/* 30877 */ {23,191},
+/* 30878 */ {23,191},
+/* 30879 */ {23,191},
+/* 30880 */ {23,191},
+/* 30881 */ {23,191},
+/* 30882 */ {23,191},
+/* 30883 */ {23,191},
+/* 30884 */ {23,191},
+/* 30885 */ {23,191},
+/* 30886 */ {23,191},
+/* 30887 */ {23,191},
+/* 30888 */ {23,191},
+/* 30889 */ {23,191},
+/* 30890 */ {23,191},
+/* 30891 */ {23,191},
+/* 30892 */ {23,191},
+/* 30893 */ {23,191},
+/* 30894 */ {23,191},
+/* 30895 */ {23,191},
+/* 30896 */ {23,191},
+/* 30897 */ {23,191},
+/* 30898 */ {23,191},
+/* 30899 */ {23,191},
+/* 30900 */ {23,191},
+/* 30901 */ {23,191},
+/* 30902 */ {23,191},
+/* 30903 */ {23,191},
+/* 30904 */ {23,191},
+/* 30905 */ {23,191},
+/* 30906 */ {23,191},
+/* 30907 */ {23,191},
+/* 30908 */ {23,191},
+/* 30909 */ {23,191},
+/* 30910 */ {23,191},
+/* 30911 */ {23,191},
+/* 30912 */ {23,191},
+/* 30913 */ {23,191},
+/* 30914 */ {23,191},
+/* 30915 */ {23,191},
+/* 30916 */ {23,191},
+/* 30917 */ {23,191},
+/* 30918 */ {23,191},
+/* 30919 */ {23,191},
+/* 30920 */ {23,191},
+/* 30921 */ {23,191},
+/* 30922 */ {23,191},
+/* 30923 */ {23,191},
+/* 30924 */ {23,191},
+/* 30925 */ {23,191},
+/* 30926 */ {23,191},
+/* 30927 */ {23,191},
+/* 30928 */ {23,191},
+/* 30929 */ {23,191},
+/* 30930 */ {23,191},
+/* 30931 */ {23,191},
+/* 30932 */ {23,191},
+/* 30933 */ {23,191},
+/* 30934 */ {23,191},
+/* 30935 */ {23,191},
+/* 30936 */ {23,191},
+/* 30937 */ {23,191},
+/* 30938 */ {23,191},
+/* 30939 */ {23,191},
+/* 30940 */ {23,191},
+/* 30941 */ {23,191},
+/* 30942 */ {23,191},
+/* 30943 */ {23,191},
+/* 30944 */ {23,191},
+/* 30945 */ {23,191},
+/* 30946 */ {23,191},
+/* 30947 */ {23,191},
+/* 30948 */ {23,191},
+/* 30949 */ {23,191},
+/* 30950 */ {23,191},
+/* 30951 */ {23,191},
+/* 30952 */ {23,191},
+/* 30953 */ {23,191},
+/* 30954 */ {23,191},
+/* 30955 */ {23,191},
+/* 30956 */ {23,191},
+/* 30957 */ {23,191},
+/* 30958 */ {23,191},
+/* 30959 */ {23,191},
+/* 30960 */ {23,191},
+/* 30961 */ {23,191},
+/* 30962 */ {23,191},
+/* 30963 */ {23,191},
+/* 30964 */ {23,191},
+/* 30965 */ {23,191},
+/* 30966 */ {23,191},
+/* 30967 */ {23,191},
+/* 30968 */ {23,191},
+/* 30969 */ {23,191},
+/* 30970 */ {23,191},
+/* 30971 */ {23,191},
+/* 30972 */ {23,191},
+/* 30973 */ {23,191},
+/* 30974 */ {23,191},
+/* 30975 */ {23,191},
+/* 30976 */ {23,197},
+/* 30977 */ {23,197},
+/* 30978 */ {23,197},
+/* 30979 */ {23,197},
+/* 30980 */ {23,197},
+/* 30981 */ {23,197},
+/* 30982 */ {23,197},
+/* 30983 */ {23,197},
+/* 30984 */ {23,197},
+/* 30985 */ {23,197},
+/* 30986 */ {23,197},
+/* 30987 */ {23,197},
+/* 30988 */ {23,197},
+/* 30989 */ {23,197},
+/* 30990 */ {23,197},
+/* 30991 */ {23,197},
+/* 30992 */ {23,197},
+/* 30993 */ {23,197},
+/* 30994 */ {23,197},
+/* 30995 */ {23,197},
+/* 30996 */ {23,197},
+/* 30997 */ {23,197},
+/* 30998 */ {23,197},
+/* 30999 */ {23,197},
+/* 31000 */ {23,197},
+/* 31001 */ {23,197},
+/* 31002 */ {23,197},
+/* 31003 */ {23,197},
+/* 31004 */ {23,197},
+/* 31005 */ {23,197},
+/* 31006 */ {23,197},
+/* 31007 */ {23,197},
+/* 31008 */ {23,197},
+/* 31009 */ {23,197},
+/* 31010 */ {23,197},
+/* 31011 */ {23,197},
+/* 31012 */ {23,197},
+/* 31013 */ {23,197},
+/* 31014 */ {23,197},
+/* 31015 */ {23,197},
+/* 31016 */ {23,197},
+/* 31017 */ {23,197},
+/* 31018 */ {23,197},
+/* 31019 */ {23,197},
+/* 31020 */ {23,197},
+/* 31021 */ {23,197},
+/* 31022 */ {23,197},
+/* 31023 */ {23,197},
+/* 31024 */ {23,197},
+/* 31025 */ {23,197},
+/* 31026 */ {23,197},
+/* 31027 */ {23,197},
+/* 31028 */ {23,197},
+/* 31029 */ {23,197},
+/* 31030 */ {23,197},
+/* 31031 */ {23,197},
+/* 31032 */ {23,197},
+/* 31033 */ {23,197},
+/* 31034 */ {23,197},
+/* 31035 */ {23,197},
+/* 31036 */ {23,197},
+/* 31037 */ {23,197},
+/* 31038 */ {23,197},
+/* 31039 */ {23,197},
+/* 31040 */ {23,197},
+/* 31041 */ {23,197},
+/* 31042 */ {23,197},
+/* 31043 */ {23,197},
+/* 31044 */ {23,197},
+/* 31045 */ {23,197},
+/* 31046 */ {23,197},
+/* 31047 */ {23,197},
+/* 31048 */ {23,197},
+/* 31049 */ {23,197},
+/* 31050 */ {23,197},
+/* 31051 */ {23,197},
+/* 31052 */ {23,197},
+/* 31053 */ {23,197},
+/* 31054 */ {23,197},
+/* 31055 */ {23,197},
+/* 31056 */ {23,197},
+/* 31057 */ {23,197},
+/* 31058 */ {23,197},
+/* 31059 */ {23,197},
+/* 31060 */ {23,197},
+/* 31061 */ {23,197},
+/* 31062 */ {23,197},
+/* 31063 */ {23,197},
+/* 31064 */ {23,197},
+/* 31065 */ {23,197},
+/* 31066 */ {23,197},
+/* 31067 */ {23,197},
+/* 31068 */ {23,197},
+/* 31069 */ {23,197},
+/* 31070 */ {23,197},
+/* 31071 */ {23,197},
+/* 31072 */ {23,197},
+/* 31073 */ {23,197},
+/* 31074 */ {23,197},
+/* 31075 */ {23,197},
+/* 31076 */ {23,197},
+/* 31077 */ {23,197},
+/* 31078 */ {23,197},
+/* 31079 */ {23,197},
+/* 31080 */ {23,197},
+/* 31081 */ {23,197},
+/* 31082 */ {23,197},
+/* 31083 */ {23,197},
+/* 31084 */ {23,197},
+/* 31085 */ {23,197},
+/* 31086 */ {23,197},
+/* 31087 */ {23,197},
+/* 31088 */ {23,197},
+/* 31089 */ {23,197},
+/* 31090 */ {23,197},
+/* 31091 */ {23,197},
+/* 31092 */ {23,197},
+/* 31093 */ {23,197},
+/* 31094 */ {23,197},
+/* 31095 */ {23,197},
+/* 31096 */ {23,197},
+/* 31097 */ {23,197},
+/* 31098 */ {23,197},
+/* 31099 */ {23,197},
+/* 31100 */ {23,197},
+/* 31101 */ {23,197},
+/* 31102 */ {23,197},
+/* 31103 */ {23,197},
+/* 31104 */ {23,231},
+/* 31105 */ {23,231},
+/* 31106 */ {23,231},
+/* 31107 */ {23,231},
+/* 31108 */ {23,231},
+/* 31109 */ {23,231},
+/* 31110 */ {23,231},
+/* 31111 */ {23,231},
+/* 31112 */ {23,231},
+/* 31113 */ {23,231},
+/* 31114 */ {23,231},
+/* 31115 */ {23,231},
+/* 31116 */ {23,231},
+/* 31117 */ {23,231},
+/* 31118 */ {23,231},
+/* 31119 */ {23,231},
+/* 31120 */ {23,231},
+/* 31121 */ {23,231},
+/* 31122 */ {23,231},
+/* 31123 */ {23,231},
+/* 31124 */ {23,231},
+/* 31125 */ {23,231},
+/* 31126 */ {23,231},
+/* 31127 */ {23,231},
+/* 31128 */ {23,231},
+/* 31129 */ {23,231},
+/* 31130 */ {23,231},
+/* 31131 */ {23,231},
+/* 31132 */ {23,231},
+/* 31133 */ {23,231},
+/* 31134 */ {23,231},
+/* 31135 */ {23,231},
+/* 31136 */ {23,231},
+/* 31137 */ {23,231},
+/* 31138 */ {23,231},
+/* 31139 */ {23,231},
+/* 31140 */ {23,231},
+/* 31141 */ {23,231},
+/* 31142 */ {23,231},
+/* 31143 */ {23,231},
+/* 31144 */ {23,231},
+/* 31145 */ {23,231},
+/* 31146 */ {23,231},
+/* 31147 */ {23,231},
+/* 31148 */ {23,231},
+/* 31149 */ {23,231},
+/* 31150 */ {23,231},
+/* 31151 */ {23,231},
+/* 31152 */ {23,231},
+/* 31153 */ {23,231},
+/* 31154 */ {23,231},
+/* 31155 */ {23,231},
+/* 31156 */ {23,231},
+/* 31157 */ {23,231},
+/* 31158 */ {23,231},
+/* 31159 */ {23,231},
+/* 31160 */ {23,231},
+/* 31161 */ {23,231},
+/* 31162 */ {23,231},
+/* 31163 */ {23,231},
+/* 31164 */ {23,231},
+/* 31165 */ {23,231},
+/* 31166 */ {23,231},
+/* 31167 */ {23,231},
+/* 31168 */ {23,231},
+/* 31169 */ {23,231},
+/* 31170 */ {23,231},
+/* 31171 */ {23,231},
+/* 31172 */ {23,231},
+/* 31173 */ {23,231},
+/* 31174 */ {23,231},
+/* 31175 */ {23,231},
+/* 31176 */ {23,231},
+/* 31177 */ {23,231},
+/* 31178 */ {23,231},
+/* 31179 */ {23,231},
+/* 31180 */ {23,231},
+/* 31181 */ {23,231},
+/* 31182 */ {23,231},
+/* 31183 */ {23,231},
+/* 31184 */ {23,231},
+/* 31185 */ {23,231},
+/* 31186 */ {23,231},
+/* 31187 */ {23,231},
+/* 31188 */ {23,231},
+/* 31189 */ {23,231},
+/* 31190 */ {23,231},
+/* 31191 */ {23,231},
+/* 31192 */ {23,231},
+/* 31193 */ {23,231},
+/* 31194 */ {23,231},
+/* 31195 */ {23,231},
+/* 31196 */ {23,231},
+/* 31197 */ {23,231},
+/* 31198 */ {23,231},
+/* 31199 */ {23,231},
+/* 31200 */ {23,231},
+/* 31201 */ {23,231},
+/* 31202 */ {23,231},
+/* 31203 */ {23,231},
+/* 31204 */ {23,231},
+/* 31205 */ {23,231},
+/* 31206 */ {23,231},
+/* 31207 */ {23,231},
+/* 31208 */ {23,231},
+/* 31209 */ {23,231},
+/* 31210 */ {23,231},
+/* 31211 */ {23,231},
+/* 31212 */ {23,231},
+/* 31213 */ {23,231},
+/* 31214 */ {23,231},
+/* 31215 */ {23,231},
+/* 31216 */ {23,231},
+/* 31217 */ {23,231},
+/* 31218 */ {23,231},
+/* 31219 */ {23,231},
+/* 31220 */ {23,231},
+/* 31221 */ {23,231},
+/* 31222 */ {23,231},
+/* 31223 */ {23,231},
+/* 31224 */ {23,231},
+/* 31225 */ {23,231},
+/* 31226 */ {23,231},
+/* 31227 */ {23,231},
+/* 31228 */ {23,231},
+/* 31229 */ {23,231},
+/* 31230 */ {23,231},
+/* 31231 */ {23,231},
+/* 31232 */ {23,239},
+/* 31233 */ {23,239},
+/* 31234 */ {23,239},
+/* 31235 */ {23,239},
+/* 31236 */ {23,239},
+/* 31237 */ {23,239},
+/* 31238 */ {23,239},
+/* 31239 */ {23,239},
+/* 31240 */ {23,239},
+/* 31241 */ {23,239},
+/* 31242 */ {23,239},
+/* 31243 */ {23,239},
+/* 31244 */ {23,239},
+/* 31245 */ {23,239},
+/* 31246 */ {23,239},
+/* 31247 */ {23,239},
+/* 31248 */ {23,239},
+/* 31249 */ {23,239},
+/* 31250 */ {23,239},
+/* 31251 */ {23,239},
+/* 31252 */ {23,239},
+/* 31253 */ {23,239},
+/* 31254 */ {23,239},
+/* 31255 */ {23,239},
+/* 31256 */ {23,239},
+/* 31257 */ {23,239},
+/* 31258 */ {23,239},
+/* 31259 */ {23,239},
+/* 31260 */ {23,239},
+/* 31261 */ {23,239},
+/* 31262 */ {23,239},
+/* 31263 */ {23,239},
+/* 31264 */ {23,239},
+/* 31265 */ {23,239},
+/* 31266 */ {23,239},
+/* 31267 */ {23,239},
+/* 31268 */ {23,239},
+/* 31269 */ {23,239},
+/* 31270 */ {23,239},
+/* 31271 */ {23,239},
+/* 31272 */ {23,239},
+/* 31273 */ {23,239},
+/* 31274 */ {23,239},
+/* 31275 */ {23,239},
+/* 31276 */ {23,239},
+/* 31277 */ {23,239},
+/* 31278 */ {23,239},
+/* 31279 */ {23,239},
+/* 31280 */ {23,239},
+/* 31281 */ {23,239},
+/* 31282 */ {23,239},
+/* 31283 */ {23,239},
+/* 31284 */ {23,239},
+/* 31285 */ {23,239},
+/* 31286 */ {23,239},
+/* 31287 */ {23,239},
+/* 31288 */ {23,239},
+/* 31289 */ {23,239},
+/* 31290 */ {23,239},
+/* 31291 */ {23,239},
+/* 31292 */ {23,239},
+/* 31293 */ {23,239},
+/* 31294 */ {23,239},
+/* 31295 */ {23,239},
+/* 31296 */ {23,239},
+/* 31297 */ {23,239},
+/* 31298 */ {23,239},
+/* 31299 */ {23,239},
+/* 31300 */ {23,239},
+/* 31301 */ {23,239},
+/* 31302 */ {23,239},
+/* 31303 */ {23,239},
+/* 31304 */ {23,239},
+/* 31305 */ {23,239},
+/* 31306 */ {23,239},
+/* 31307 */ {23,239},
+/* 31308 */ {23,239},
+/* 31309 */ {23,239},
+/* 31310 */ {23,239},
+/* 31311 */ {23,239},
+/* 31312 */ {23,239},
+/* 31313 */ {23,239},
+/* 31314 */ {23,239},
+/* 31315 */ {23,239},
+/* 31316 */ {23,239},
+/* 31317 */ {23,239},
+/* 31318 */ {23,239},
+/* 31319 */ {23,239},
+/* 31320 */ {23,239},
+/* 31321 */ {23,239},
+/* 31322 */ {23,239},
+/* 31323 */ {23,239},
+/* 31324 */ {23,239},
+/* 31325 */ {23,239},
+/* 31326 */ {23,239},
+/* 31327 */ {23,239},
+/* 31328 */ {23,239},
+/* 31329 */ {23,239},
+/* 31330 */ {23,239},
+/* 31331 */ {23,239},
+/* 31332 */ {23,239},
+/* 31333 */ {23,239},
+/* 31334 */ {23,239},
+/* 31335 */ {23,239},
+/* 31336 */ {23,239},
+/* 31337 */ {23,239},
+/* 31338 */ {23,239},
+/* 31339 */ {23,239},
+/* 31340 */ {23,239},
+/* 31341 */ {23,239},
+/* 31342 */ {23,239},
+/* 31343 */ {23,239},
+/* 31344 */ {23,239},
+/* 31345 */ {23,239},
+/* 31346 */ {23,239},
+/* 31347 */ {23,239},
+/* 31348 */ {23,239},
+/* 31349 */ {23,239},
+/* 31350 */ {23,239},
+/* 31351 */ {23,239},
+/* 31352 */ {23,239},
+/* 31353 */ {23,239},
+/* 31354 */ {23,239},
+/* 31355 */ {23,239},
+/* 31356 */ {23,239},
+/* 31357 */ {23,239},
+/* 31358 */ {23,239},
+/* 31359 */ {23,239},
+/* 31360 */ {24,9},
+/* 31361 */ {24,9},
+/* 31362 */ {24,9},
+/* 31363 */ {24,9},
+/* 31364 */ {24,9},
+/* 31365 */ {24,9},
+/* 31366 */ {24,9},
+/* 31367 */ {24,9},
+/* 31368 */ {24,9},
+/* 31369 */ {24,9},
+/* 31370 */ {24,9},
+/* 31371 */ {24,9},
+/* 31372 */ {24,9},
+/* 31373 */ {24,9},
+/* 31374 */ {24,9},
+/* 31375 */ {24,9},
+/* 31376 */ {24,9},
+/* 31377 */ {24,9},
+/* 31378 */ {24,9},
+/* 31379 */ {24,9},
+/* 31380 */ {24,9},
+/* 31381 */ {24,9},
+/* 31382 */ {24,9},
+/* 31383 */ {24,9},
+/* 31384 */ {24,9},
+/* 31385 */ {24,9},
+/* 31386 */ {24,9},
+/* 31387 */ {24,9},
+/* 31388 */ {24,9},
+/* 31389 */ {24,9},
+/* 31390 */ {24,9},
+/* 31391 */ {24,9},
+/* 31392 */ {24,9},
+/* 31393 */ {24,9},
+/* 31394 */ {24,9},
+/* 31395 */ {24,9},
+/* 31396 */ {24,9},
+/* 31397 */ {24,9},
+/* 31398 */ {24,9},
+/* 31399 */ {24,9},
+/* 31400 */ {24,9},
+/* 31401 */ {24,9},
+/* 31402 */ {24,9},
+/* 31403 */ {24,9},
+/* 31404 */ {24,9},
+/* 31405 */ {24,9},
+/* 31406 */ {24,9},
+/* 31407 */ {24,9},
+/* 31408 */ {24,9},
+/* 31409 */ {24,9},
+/* 31410 */ {24,9},
+/* 31411 */ {24,9},
+/* 31412 */ {24,9},
+/* 31413 */ {24,9},
+/* 31414 */ {24,9},
+/* 31415 */ {24,9},
+/* 31416 */ {24,9},
+/* 31417 */ {24,9},
+/* 31418 */ {24,9},
+/* 31419 */ {24,9},
+/* 31420 */ {24,9},
+/* 31421 */ {24,9},
+/* 31422 */ {24,9},
+/* 31423 */ {24,9},
+/* 31424 */ {24,142},
+/* 31425 */ {24,142},
+/* 31426 */ {24,142},
+/* 31427 */ {24,142},
+/* 31428 */ {24,142},
+/* 31429 */ {24,142},
+/* 31430 */ {24,142},
+/* 31431 */ {24,142},
+/* 31432 */ {24,142},
+/* 31433 */ {24,142},
+/* 31434 */ {24,142},
+/* 31435 */ {24,142},
+/* 31436 */ {24,142},
+/* 31437 */ {24,142},
+/* 31438 */ {24,142},
+/* 31439 */ {24,142},
+/* 31440 */ {24,142},
+/* 31441 */ {24,142},
+/* 31442 */ {24,142},
+/* 31443 */ {24,142},
+/* 31444 */ {24,142},
+/* 31445 */ {24,142},
+/* 31446 */ {24,142},
+/* 31447 */ {24,142},
+/* 31448 */ {24,142},
+/* 31449 */ {24,142},
+/* 31450 */ {24,142},
+/* 31451 */ {24,142},
+/* 31452 */ {24,142},
+/* 31453 */ {24,142},
+/* 31454 */ {24,142},
+/* 31455 */ {24,142},
+/* 31456 */ {24,142},
+/* 31457 */ {24,142},
+/* 31458 */ {24,142},
+/* 31459 */ {24,142},
+/* 31460 */ {24,142},
+/* 31461 */ {24,142},
+/* 31462 */ {24,142},
+/* 31463 */ {24,142},
+/* 31464 */ {24,142},
+/* 31465 */ {24,142},
+/* 31466 */ {24,142},
+/* 31467 */ {24,142},
+/* 31468 */ {24,142},
+/* 31469 */ {24,142},
+/* 31470 */ {24,142},
+/* 31471 */ {24,142},
+/* 31472 */ {24,142},
+/* 31473 */ {24,142},
+/* 31474 */ {24,142},
+/* 31475 */ {24,142},
+/* 31476 */ {24,142},
+/* 31477 */ {24,142},
+/* 31478 */ {24,142},
+/* 31479 */ {24,142},
+/* 31480 */ {24,142},
+/* 31481 */ {24,142},
+/* 31482 */ {24,142},
+/* 31483 */ {24,142},
+/* 31484 */ {24,142},
+/* 31485 */ {24,142},
+/* 31486 */ {24,142},
+/* 31487 */ {24,142},
+/* 31488 */ {24,144},
+/* 31489 */ {24,144},
+/* 31490 */ {24,144},
+/* 31491 */ {24,144},
+/* 31492 */ {24,144},
+/* 31493 */ {24,144},
+/* 31494 */ {24,144},
+/* 31495 */ {24,144},
+/* 31496 */ {24,144},
+/* 31497 */ {24,144},
+/* 31498 */ {24,144},
+/* 31499 */ {24,144},
+/* 31500 */ {24,144},
+/* 31501 */ {24,144},
+/* 31502 */ {24,144},
+/* 31503 */ {24,144},
+/* 31504 */ {24,144},
+/* 31505 */ {24,144},
+/* 31506 */ {24,144},
+/* 31507 */ {24,144},
+/* 31508 */ {24,144},
+/* 31509 */ {24,144},
+/* 31510 */ {24,144},
+/* 31511 */ {24,144},
+/* 31512 */ {24,144},
+/* 31513 */ {24,144},
+/* 31514 */ {24,144},
+/* 31515 */ {24,144},
+/* 31516 */ {24,144},
+/* 31517 */ {24,144},
+/* 31518 */ {24,144},
+/* 31519 */ {24,144},
+/* 31520 */ {24,144},
+/* 31521 */ {24,144},
+/* 31522 */ {24,144},
+/* 31523 */ {24,144},
+/* 31524 */ {24,144},
+/* 31525 */ {24,144},
+/* 31526 */ {24,144},
+/* 31527 */ {24,144},
+/* 31528 */ {24,144},
+/* 31529 */ {24,144},
+/* 31530 */ {24,144},
+/* 31531 */ {24,144},
+/* 31532 */ {24,144},
+/* 31533 */ {24,144},
+/* 31534 */ {24,144},
+/* 31535 */ {24,144},
+/* 31536 */ {24,144},
+/* 31537 */ {24,144},
+/* 31538 */ {24,144},
+/* 31539 */ {24,144},
+/* 31540 */ {24,144},
+/* 31541 */ {24,144},
+/* 31542 */ {24,144},
+/* 31543 */ {24,144},
+/* 31544 */ {24,144},
+/* 31545 */ {24,144},
+/* 31546 */ {24,144},
+/* 31547 */ {24,144},
+/* 31548 */ {24,144},
+/* 31549 */ {24,144},
+/* 31550 */ {24,144},
+/* 31551 */ {24,144},
+/* 31552 */ {24,145},
+/* 31553 */ {24,145},
+/* 31554 */ {24,145},
+/* 31555 */ {24,145},
+/* 31556 */ {24,145},
+/* 31557 */ {24,145},
+/* 31558 */ {24,145},
+/* 31559 */ {24,145},
+/* 31560 */ {24,145},
+/* 31561 */ {24,145},
+/* 31562 */ {24,145},
+/* 31563 */ {24,145},
+/* 31564 */ {24,145},
+/* 31565 */ {24,145},
+/* 31566 */ {24,145},
+/* 31567 */ {24,145},
+/* 31568 */ {24,145},
+/* 31569 */ {24,145},
+/* 31570 */ {24,145},
+/* 31571 */ {24,145},
+/* 31572 */ {24,145},
+/* 31573 */ {24,145},
+/* 31574 */ {24,145},
+/* 31575 */ {24,145},
+/* 31576 */ {24,145},
+/* 31577 */ {24,145},
+/* 31578 */ {24,145},
+/* 31579 */ {24,145},
+/* 31580 */ {24,145},
+/* 31581 */ {24,145},
+/* 31582 */ {24,145},
+/* 31583 */ {24,145},
+/* 31584 */ {24,145},
+/* 31585 */ {24,145},
+/* 31586 */ {24,145},
+/* 31587 */ {24,145},
+/* 31588 */ {24,145},
+/* 31589 */ {24,145},
+/* 31590 */ {24,145},
+/* 31591 */ {24,145},
+/* 31592 */ {24,145},
+/* 31593 */ {24,145},
+/* 31594 */ {24,145},
+/* 31595 */ {24,145},
+/* 31596 */ {24,145},
+/* 31597 */ {24,145},
+/* 31598 */ {24,145},
+/* 31599 */ {24,145},
+/* 31600 */ {24,145},
+/* 31601 */ {24,145},
+/* 31602 */ {24,145},
+/* 31603 */ {24,145},
+/* 31604 */ {24,145},
+/* 31605 */ {24,145},
+/* 31606 */ {24,145},
+/* 31607 */ {24,145},
+/* 31608 */ {24,145},
+/* 31609 */ {24,145},
+/* 31610 */ {24,145},
+/* 31611 */ {24,145},
+/* 31612 */ {24,145},
+/* 31613 */ {24,145},
+/* 31614 */ {24,145},
+/* 31615 */ {24,145},
+/* 31616 */ {24,148},
+/* 31617 */ {24,148},
+/* 31618 */ {24,148},
+/* 31619 */ {24,148},
+/* 31620 */ {24,148},
+/* 31621 */ {24,148},
+/* 31622 */ {24,148},
+/* 31623 */ {24,148},
+/* 31624 */ {24,148},
+/* 31625 */ {24,148},
+/* 31626 */ {24,148},
+/* 31627 */ {24,148},
+/* 31628 */ {24,148},
+/* 31629 */ {24,148},
+/* 31630 */ {24,148},
+/* 31631 */ {24,148},
+/* 31632 */ {24,148},
+/* 31633 */ {24,148},
+/* 31634 */ {24,148},
+/* 31635 */ {24,148},
+/* 31636 */ {24,148},
+/* 31637 */ {24,148},
+/* 31638 */ {24,148},
+/* 31639 */ {24,148},
+/* 31640 */ {24,148},
+/* 31641 */ {24,148},
+/* 31642 */ {24,148},
+/* 31643 */ {24,148},
+/* 31644 */ {24,148},
+/* 31645 */ {24,148},
+/* 31646 */ {24,148},
+/* 31647 */ {24,148},
+/* 31648 */ {24,148},
+/* 31649 */ {24,148},
+/* 31650 */ {24,148},
+/* 31651 */ {24,148},
+/* 31652 */ {24,148},
+/* 31653 */ {24,148},
+/* 31654 */ {24,148},
+/* 31655 */ {24,148},
+/* 31656 */ {24,148},
+/* 31657 */ {24,148},
+/* 31658 */ {24,148},
+/* 31659 */ {24,148},
+/* 31660 */ {24,148},
+/* 31661 */ {24,148},
+/* 31662 */ {24,148},
+/* 31663 */ {24,148},
+/* 31664 */ {24,148},
+/* 31665 */ {24,148},
+/* 31666 */ {24,148},
+/* 31667 */ {24,148},
+/* 31668 */ {24,148},
+/* 31669 */ {24,148},
+/* 31670 */ {24,148},
+/* 31671 */ {24,148},
+/* 31672 */ {24,148},
+/* 31673 */ {24,148},
+/* 31674 */ {24,148},
+/* 31675 */ {24,148},
+/* 31676 */ {24,148},
+/* 31677 */ {24,148},
+/* 31678 */ {24,148},
+/* 31679 */ {24,148},
+/* 31680 */ {24,159},
+/* 31681 */ {24,159},
+/* 31682 */ {24,159},
+/* 31683 */ {24,159},
+/* 31684 */ {24,159},
+/* 31685 */ {24,159},
+/* 31686 */ {24,159},
+/* 31687 */ {24,159},
+/* 31688 */ {24,159},
+/* 31689 */ {24,159},
+/* 31690 */ {24,159},
+/* 31691 */ {24,159},
+/* 31692 */ {24,159},
+/* 31693 */ {24,159},
+/* 31694 */ {24,159},
+/* 31695 */ {24,159},
+/* 31696 */ {24,159},
+/* 31697 */ {24,159},
+/* 31698 */ {24,159},
+/* 31699 */ {24,159},
+/* 31700 */ {24,159},
+/* 31701 */ {24,159},
+/* 31702 */ {24,159},
+/* 31703 */ {24,159},
+/* 31704 */ {24,159},
+/* 31705 */ {24,159},
+/* 31706 */ {24,159},
+/* 31707 */ {24,159},
+/* 31708 */ {24,159},
+/* 31709 */ {24,159},
+/* 31710 */ {24,159},
+/* 31711 */ {24,159},
+/* 31712 */ {24,159},
+/* 31713 */ {24,159},
+/* 31714 */ {24,159},
+/* 31715 */ {24,159},
+/* 31716 */ {24,159},
+/* 31717 */ {24,159},
+/* 31718 */ {24,159},
+/* 31719 */ {24,159},
+/* 31720 */ {24,159},
+/* 31721 */ {24,159},
+/* 31722 */ {24,159},
+/* 31723 */ {24,159},
+/* 31724 */ {24,159},
+/* 31725 */ {24,159},
+/* 31726 */ {24,159},
+/* 31727 */ {24,159},
+/* 31728 */ {24,159},
+/* 31729 */ {24,159},
+/* 31730 */ {24,159},
+/* 31731 */ {24,159},
+/* 31732 */ {24,159},
+/* 31733 */ {24,159},
+/* 31734 */ {24,159},
+/* 31735 */ {24,159},
+/* 31736 */ {24,159},
+/* 31737 */ {24,159},
+/* 31738 */ {24,159},
+/* 31739 */ {24,159},
+/* 31740 */ {24,159},
+/* 31741 */ {24,159},
+/* 31742 */ {24,159},
+/* 31743 */ {24,159},
+/* 31744 */ {24,171},
+/* 31745 */ {24,171},
+/* 31746 */ {24,171},
+/* 31747 */ {24,171},
+/* 31748 */ {24,171},
+/* 31749 */ {24,171},
+/* 31750 */ {24,171},
+/* 31751 */ {24,171},
+/* 31752 */ {24,171},
+/* 31753 */ {24,171},
+/* 31754 */ {24,171},
+/* 31755 */ {24,171},
+/* 31756 */ {24,171},
+/* 31757 */ {24,171},
+/* 31758 */ {24,171},
+/* 31759 */ {24,171},
+/* 31760 */ {24,171},
+/* 31761 */ {24,171},
+/* 31762 */ {24,171},
+/* 31763 */ {24,171},
+/* 31764 */ {24,171},
+/* 31765 */ {24,171},
+/* 31766 */ {24,171},
+/* 31767 */ {24,171},
+/* 31768 */ {24,171},
+/* 31769 */ {24,171},
+/* 31770 */ {24,171},
+/* 31771 */ {24,171},
+/* 31772 */ {24,171},
+/* 31773 */ {24,171},
+/* 31774 */ {24,171},
+/* 31775 */ {24,171},
+/* 31776 */ {24,171},
+/* 31777 */ {24,171},
+/* 31778 */ {24,171},
+/* 31779 */ {24,171},
+/* 31780 */ {24,171},
+/* 31781 */ {24,171},
+/* 31782 */ {24,171},
+/* 31783 */ {24,171},
+/* 31784 */ {24,171},
+/* 31785 */ {24,171},
+/* 31786 */ {24,171},
+/* 31787 */ {24,171},
+/* 31788 */ {24,171},
+/* 31789 */ {24,171},
+/* 31790 */ {24,171},
+/* 31791 */ {24,171},
+/* 31792 */ {24,171},
+/* 31793 */ {24,171},
+/* 31794 */ {24,171},
+/* 31795 */ {24,171},
+/* 31796 */ {24,171},
+/* 31797 */ {24,171},
+/* 31798 */ {24,171},
+/* 31799 */ {24,171},
+/* 31800 */ {24,171},
+/* 31801 */ {24,171},
+/* 31802 */ {24,171},
+/* 31803 */ {24,171},
+/* 31804 */ {24,171},
+/* 31805 */ {24,171},
+/* 31806 */ {24,171},
+/* 31807 */ {24,171},
+/* 31808 */ {24,206},
+/* 31809 */ {24,206},
+/* 31810 */ {24,206},
+/* 31811 */ {24,206},
+/* 31812 */ {24,206},
+/* 31813 */ {24,206},
+/* 31814 */ {24,206},
+/* 31815 */ {24,206},
+/* 31816 */ {24,206},
+/* 31817 */ {24,206},
+/* 31818 */ {24,206},
+/* 31819 */ {24,206},
+/* 31820 */ {24,206},
+/* 31821 */ {24,206},
+/* 31822 */ {24,206},
+/* 31823 */ {24,206},
+/* 31824 */ {24,206},
+/* 31825 */ {24,206},
+/* 31826 */ {24,206},
+/* 31827 */ {24,206},
+/* 31828 */ {24,206},
+/* 31829 */ {24,206},
+/* 31830 */ {24,206},
+/* 31831 */ {24,206},
+/* 31832 */ {24,206},
+/* 31833 */ {24,206},
+/* 31834 */ {24,206},
+/* 31835 */ {24,206},
+/* 31836 */ {24,206},
+/* 31837 */ {24,206},
+/* 31838 */ {24,206},
+/* 31839 */ {24,206},
+/* 31840 */ {24,206},
+/* 31841 */ {24,206},
+/* 31842 */ {24,206},
+/* 31843 */ {24,206},
+/* 31844 */ {24,206},
+/* 31845 */ {24,206},
+/* 31846 */ {24,206},
+/* 31847 */ {24,206},
+/* 31848 */ {24,206},
+/* 31849 */ {24,206},
+/* 31850 */ {24,206},
+/* 31851 */ {24,206},
+/* 31852 */ {24,206},
+/* 31853 */ {24,206},
+/* 31854 */ {24,206},
+/* 31855 */ {24,206},
+/* 31856 */ {24,206},
+/* 31857 */ {24,206},
+/* 31858 */ {24,206},
+/* 31859 */ {24,206},
+/* 31860 */ {24,206},
+/* 31861 */ {24,206},
+/* 31862 */ {24,206},
+/* 31863 */ {24,206},
+/* 31864 */ {24,206},
+/* 31865 */ {24,206},
+/* 31866 */ {24,206},
+/* 31867 */ {24,206},
+/* 31868 */ {24,206},
+/* 31869 */ {24,206},
+/* 31870 */ {24,206},
+/* 31871 */ {24,206},
+/* 31872 */ {24,215},
+/* 31873 */ {24,215},
+/* 31874 */ {24,215},
+/* 31875 */ {24,215},
+/* 31876 */ {24,215},
+/* 31877 */ {24,215},
+/* 31878 */ {24,215},
+/* 31879 */ {24,215},
+/* 31880 */ {24,215},
+/* 31881 */ {24,215},
+/* 31882 */ {24,215},
+/* 31883 */ {24,215},
+/* 31884 */ {24,215},
+/* 31885 */ {24,215},
+/* 31886 */ {24,215},
+/* 31887 */ {24,215},
+/* 31888 */ {24,215},
+/* 31889 */ {24,215},
+/* 31890 */ {24,215},
+/* 31891 */ {24,215},
+/* 31892 */ {24,215},
+/* 31893 */ {24,215},
+/* 31894 */ {24,215},
+/* 31895 */ {24,215},
+/* 31896 */ {24,215},
+/* 31897 */ {24,215},
+/* 31898 */ {24,215},
+/* 31899 */ {24,215},
+/* 31900 */ {24,215},
+/* 31901 */ {24,215},
+/* 31902 */ {24,215},
+/* 31903 */ {24,215},
+/* 31904 */ {24,215},
+/* 31905 */ {24,215},
+/* 31906 */ {24,215},
+/* 31907 */ {24,215},
+/* 31908 */ {24,215},
+/* 31909 */ {24,215},
+/* 31910 */ {24,215},
+/* 31911 */ {24,215},
+/* 31912 */ {24,215},
+/* 31913 */ {24,215},
+/* 31914 */ {24,215},
+/* 31915 */ {24,215},
+/* 31916 */ {24,215},
+/* 31917 */ {24,215},
+/* 31918 */ {24,215},
+/* 31919 */ {24,215},
+/* 31920 */ {24,215},
+/* 31921 */ {24,215},
+/* 31922 */ {24,215},
+/* 31923 */ {24,215},
+/* 31924 */ {24,215},
+/* 31925 */ {24,215},
+/* 31926 */ {24,215},
+/* 31927 */ {24,215},
+/* 31928 */ {24,215},
+/* 31929 */ {24,215},
+/* 31930 */ {24,215},
+/* 31931 */ {24,215},
+/* 31932 */ {24,215},
+/* 31933 */ {24,215},
+/* 31934 */ {24,215},
+/* 31935 */ {24,215},
+/* 31936 */ {24,225},
+/* 31937 */ {24,225},
+/* 31938 */ {24,225},
+/* 31939 */ {24,225},
+/* 31940 */ {24,225},
+/* 31941 */ {24,225},
+/* 31942 */ {24,225},
+/* 31943 */ {24,225},
+/* 31944 */ {24,225},
+/* 31945 */ {24,225},
+/* 31946 */ {24,225},
+/* 31947 */ {24,225},
+/* 31948 */ {24,225},
+/* 31949 */ {24,225},
+/* 31950 */ {24,225},
+/* 31951 */ {24,225},
+/* 31952 */ {24,225},
+/* 31953 */ {24,225},
+/* 31954 */ {24,225},
+/* 31955 */ {24,225},
+/* 31956 */ {24,225},
+/* 31957 */ {24,225},
+/* 31958 */ {24,225},
+/* 31959 */ {24,225},
+/* 31960 */ {24,225},
+/* 31961 */ {24,225},
+/* 31962 */ {24,225},
+/* 31963 */ {24,225},
+/* 31964 */ {24,225},
+/* 31965 */ {24,225},
+/* 31966 */ {24,225},
+/* 31967 */ {24,225},
+/* 31968 */ {24,225},
+/* 31969 */ {24,225},
+/* 31970 */ {24,225},
+/* 31971 */ {24,225},
+/* 31972 */ {24,225},
+/* 31973 */ {24,225},
+/* 31974 */ {24,225},
+/* 31975 */ {24,225},
+/* 31976 */ {24,225},
+/* 31977 */ {24,225},
+/* 31978 */ {24,225},
+/* 31979 */ {24,225},
+/* 31980 */ {24,225},
+/* 31981 */ {24,225},
+/* 31982 */ {24,225},
+/* 31983 */ {24,225},
+/* 31984 */ {24,225},
+/* 31985 */ {24,225},
+/* 31986 */ {24,225},
+/* 31987 */ {24,225},
+/* 31988 */ {24,225},
+/* 31989 */ {24,225},
+/* 31990 */ {24,225},
+/* 31991 */ {24,225},
+/* 31992 */ {24,225},
+/* 31993 */ {24,225},
+/* 31994 */ {24,225},
+/* 31995 */ {24,225},
+/* 31996 */ {24,225},
+/* 31997 */ {24,225},
+/* 31998 */ {24,225},
+/* 31999 */ {24,225},
+/* 32000 */ {24,236},
+/* 32001 */ {24,236},
+/* 32002 */ {24,236},
+/* 32003 */ {24,236},
+/* 32004 */ {24,236},
+/* 32005 */ {24,236},
+/* 32006 */ {24,236},
+/* 32007 */ {24,236},
+/* 32008 */ {24,236},
+/* 32009 */ {24,236},
+/* 32010 */ {24,236},
+/* 32011 */ {24,236},
+/* 32012 */ {24,236},
+/* 32013 */ {24,236},
+/* 32014 */ {24,236},
+/* 32015 */ {24,236},
+/* 32016 */ {24,236},
+/* 32017 */ {24,236},
+/* 32018 */ {24,236},
+/* 32019 */ {24,236},
+/* 32020 */ {24,236},
+/* 32021 */ {24,236},
+/* 32022 */ {24,236},
+/* 32023 */ {24,236},
+/* 32024 */ {24,236},
+/* 32025 */ {24,236},
+/* 32026 */ {24,236},
+/* 32027 */ {24,236},
+/* 32028 */ {24,236},
+/* 32029 */ {24,236},
+/* 32030 */ {24,236},
+/* 32031 */ {24,236},
+/* 32032 */ {24,236},
+/* 32033 */ {24,236},
+/* 32034 */ {24,236},
+/* 32035 */ {24,236},
+/* 32036 */ {24,236},
+/* 32037 */ {24,236},
+/* 32038 */ {24,236},
+/* 32039 */ {24,236},
+/* 32040 */ {24,236},
+/* 32041 */ {24,236},
+/* 32042 */ {24,236},
+/* 32043 */ {24,236},
+/* 32044 */ {24,236},
+/* 32045 */ {24,236},
+/* 32046 */ {24,236},
+/* 32047 */ {24,236},
+/* 32048 */ {24,236},
+/* 32049 */ {24,236},
+/* 32050 */ {24,236},
+/* 32051 */ {24,236},
+/* 32052 */ {24,236},
+/* 32053 */ {24,236},
+/* 32054 */ {24,236},
+/* 32055 */ {24,236},
+/* 32056 */ {24,236},
+/* 32057 */ {24,236},
+/* 32058 */ {24,236},
+/* 32059 */ {24,236},
+/* 32060 */ {24,236},
+/* 32061 */ {24,236},
+/* 32062 */ {24,236},
+/* 32063 */ {24,236},
+/* 32064 */ {24,237},
+/* 32065 */ {24,237},
+/* 32066 */ {24,237},
+/* 32067 */ {24,237},
+/* 32068 */ {24,237},
+/* 32069 */ {24,237},
+/* 32070 */ {24,237},
+/* 32071 */ {24,237},
+/* 32072 */ {24,237},
+/* 32073 */ {24,237},
+/* 32074 */ {24,237},
+/* 32075 */ {24,237},
+/* 32076 */ {24,237},
+/* 32077 */ {24,237},
+/* 32078 */ {24,237},
+/* 32079 */ {24,237},
+/* 32080 */ {24,237},
+/* 32081 */ {24,237},
+/* 32082 */ {24,237},
+/* 32083 */ {24,237},
+/* 32084 */ {24,237},
+/* 32085 */ {24,237},
+/* 32086 */ {24,237},
+/* 32087 */ {24,237},
+/* 32088 */ {24,237},
+/* 32089 */ {24,237},
+/* 32090 */ {24,237},
+/* 32091 */ {24,237},
+/* 32092 */ {24,237},
+/* 32093 */ {24,237},
+/* 32094 */ {24,237},
+/* 32095 */ {24,237},
+/* 32096 */ {24,237},
+/* 32097 */ {24,237},
+/* 32098 */ {24,237},
+/* 32099 */ {24,237},
+/* 32100 */ {24,237},
+/* 32101 */ {24,237},
+/* 32102 */ {24,237},
+/* 32103 */ {24,237},
+/* 32104 */ {24,237},
+/* 32105 */ {24,237},
+/* 32106 */ {24,237},
+/* 32107 */ {24,237},
+/* 32108 */ {24,237},
+/* 32109 */ {24,237},
+/* 32110 */ {24,237},
+/* 32111 */ {24,237},
+/* 32112 */ {24,237},
+/* 32113 */ {24,237},
+/* 32114 */ {24,237},
+/* 32115 */ {24,237},
+/* 32116 */ {24,237},
+/* 32117 */ {24,237},
+/* 32118 */ {24,237},
+/* 32119 */ {24,237},
+/* 32120 */ {24,237},
+/* 32121 */ {24,237},
+/* 32122 */ {24,237},
+/* 32123 */ {24,237},
+/* 32124 */ {24,237},
+/* 32125 */ {24,237},
+/* 32126 */ {24,237},
+/* 32127 */ {24,237},
+/* 32128 */ {25,199},
+/* 32129 */ {25,199},
+/* 32130 */ {25,199},
+/* 32131 */ {25,199},
+/* 32132 */ {25,199},
+/* 32133 */ {25,199},
+/* 32134 */ {25,199},
+/* 32135 */ {25,199},
+/* 32136 */ {25,199},
+/* 32137 */ {25,199},
+/* 32138 */ {25,199},
+/* 32139 */ {25,199},
+/* 32140 */ {25,199},
+/* 32141 */ {25,199},
+/* 32142 */ {25,199},
+/* 32143 */ {25,199},
+/* 32144 */ {25,199},
+/* 32145 */ {25,199},
+/* 32146 */ {25,199},
+/* 32147 */ {25,199},
+/* 32148 */ {25,199},
+/* 32149 */ {25,199},
+/* 32150 */ {25,199},
+/* 32151 */ {25,199},
+/* 32152 */ {25,199},
+/* 32153 */ {25,199},
+/* 32154 */ {25,199},
+/* 32155 */ {25,199},
+/* 32156 */ {25,199},
+/* 32157 */ {25,199},
+/* 32158 */ {25,199},
+/* 32159 */ {25,199},
+/* 32160 */ {25,207},
+/* 32161 */ {25,207},
+/* 32162 */ {25,207},
+/* 32163 */ {25,207},
+/* 32164 */ {25,207},
+/* 32165 */ {25,207},
+/* 32166 */ {25,207},
+/* 32167 */ {25,207},
+/* 32168 */ {25,207},
+/* 32169 */ {25,207},
+/* 32170 */ {25,207},
+/* 32171 */ {25,207},
+/* 32172 */ {25,207},
+/* 32173 */ {25,207},
+/* 32174 */ {25,207},
+/* 32175 */ {25,207},
+/* 32176 */ {25,207},
+/* 32177 */ {25,207},
+/* 32178 */ {25,207},
+/* 32179 */ {25,207},
+/* 32180 */ {25,207},
+/* 32181 */ {25,207},
+/* 32182 */ {25,207},
+/* 32183 */ {25,207},
+/* 32184 */ {25,207},
+/* 32185 */ {25,207},
+/* 32186 */ {25,207},
+/* 32187 */ {25,207},
+/* 32188 */ {25,207},
+/* 32189 */ {25,207},
+/* 32190 */ {25,207},
+/* 32191 */ {25,207},
+/* 32192 */ {25,234},
+/* 32193 */ {25,234},
+/* 32194 */ {25,234},
+/* 32195 */ {25,234},
+/* 32196 */ {25,234},
+/* 32197 */ {25,234},
+/* 32198 */ {25,234},
+/* 32199 */ {25,234},
+/* 32200 */ {25,234},
+/* 32201 */ {25,234},
+/* 32202 */ {25,234},
+/* 32203 */ {25,234},
+/* 32204 */ {25,234},
+/* 32205 */ {25,234},
+/* 32206 */ {25,234},
+/* 32207 */ {25,234},
+/* 32208 */ {25,234},
+/* 32209 */ {25,234},
+/* 32210 */ {25,234},
+/* 32211 */ {25,234},
+/* 32212 */ {25,234},
+/* 32213 */ {25,234},
+/* 32214 */ {25,234},
+/* 32215 */ {25,234},
+/* 32216 */ {25,234},
+/* 32217 */ {25,234},
+/* 32218 */ {25,234},
+/* 32219 */ {25,234},
+/* 32220 */ {25,234},
+/* 32221 */ {25,234},
+/* 32222 */ {25,234},
+/* 32223 */ {25,234},
+/* 32224 */ {25,235},
+/* 32225 */ {25,235},
+/* 32226 */ {25,235},
+/* 32227 */ {25,235},
+/* 32228 */ {25,235},
+/* 32229 */ {25,235},
+/* 32230 */ {25,235},
+/* 32231 */ {25,235},
+/* 32232 */ {25,235},
+/* 32233 */ {25,235},
+/* 32234 */ {25,235},
+/* 32235 */ {25,235},
+/* 32236 */ {25,235},
+/* 32237 */ {25,235},
+/* 32238 */ {25,235},
+/* 32239 */ {25,235},
+/* 32240 */ {25,235},
+/* 32241 */ {25,235},
+/* 32242 */ {25,235},
+/* 32243 */ {25,235},
+/* 32244 */ {25,235},
+/* 32245 */ {25,235},
+/* 32246 */ {25,235},
+/* 32247 */ {25,235},
+/* 32248 */ {25,235},
+/* 32249 */ {25,235},
+/* 32250 */ {25,235},
+/* 32251 */ {25,235},
+/* 32252 */ {25,235},
+/* 32253 */ {25,235},
+/* 32254 */ {25,235},
+/* 32255 */ {25,235},
+/* 32256 */ {26,192},
+/* 32257 */ {26,192},
+/* 32258 */ {26,192},
+/* 32259 */ {26,192},
+/* 32260 */ {26,192},
+/* 32261 */ {26,192},
+/* 32262 */ {26,192},
+/* 32263 */ {26,192},
+/* 32264 */ {26,192},
+/* 32265 */ {26,192},
+/* 32266 */ {26,192},
+/* 32267 */ {26,192},
+/* 32268 */ {26,192},
+/* 32269 */ {26,192},
+/* 32270 */ {26,192},
+/* 32271 */ {26,192},
+/* 32272 */ {26,193},
+/* 32273 */ {26,193},
+/* 32274 */ {26,193},
+/* 32275 */ {26,193},
+/* 32276 */ {26,193},
+/* 32277 */ {26,193},
+/* 32278 */ {26,193},
+/* 32279 */ {26,193},
+/* 32280 */ {26,193},
+/* 32281 */ {26,193},
+/* 32282 */ {26,193},
+/* 32283 */ {26,193},
+/* 32284 */ {26,193},
+/* 32285 */ {26,193},
+/* 32286 */ {26,193},
+/* 32287 */ {26,193},
+/* 32288 */ {26,200},
+/* 32289 */ {26,200},
+/* 32290 */ {26,200},
+/* 32291 */ {26,200},
+/* 32292 */ {26,200},
+/* 32293 */ {26,200},
+/* 32294 */ {26,200},
+/* 32295 */ {26,200},
+/* 32296 */ {26,200},
+/* 32297 */ {26,200},
+/* 32298 */ {26,200},
+/* 32299 */ {26,200},
+/* 32300 */ {26,200},
+/* 32301 */ {26,200},
+/* 32302 */ {26,200},
+/* 32303 */ {26,200},
+/* 32304 */ {26,201},
+/* 32305 */ {26,201},
+/* 32306 */ {26,201},
+/* 32307 */ {26,201},
+/* 32308 */ {26,201},
+/* 32309 */ {26,201},
+/* 32310 */ {26,201},
+/* 32311 */ {26,201},
+/* 32312 */ {26,201},
+/* 32313 */ {26,201},
+/* 32314 */ {26,201},
+/* 32315 */ {26,201},
+/* 32316 */ {26,201},
+/* 32317 */ {26,201},
+/* 32318 */ {26,201},
+/* 32319 */ {26,201},
+/* 32320 */ {26,202},
+/* 32321 */ {26,202},
+/* 32322 */ {26,202},
+/* 32323 */ {26,202},
+/* 32324 */ {26,202},
+/* 32325 */ {26,202},
+/* 32326 */ {26,202},
+/* 32327 */ {26,202},
+/* 32328 */ {26,202},
+/* 32329 */ {26,202},
+/* 32330 */ {26,202},
+/* 32331 */ {26,202},
+/* 32332 */ {26,202},
+/* 32333 */ {26,202},
+/* 32334 */ {26,202},
+/* 32335 */ {26,202},
+/* 32336 */ {26,205},
+/* 32337 */ {26,205},
+/* 32338 */ {26,205},
+/* 32339 */ {26,205},
+/* 32340 */ {26,205},
+/* 32341 */ {26,205},
+/* 32342 */ {26,205},
+/* 32343 */ {26,205},
+/* 32344 */ {26,205},
+/* 32345 */ {26,205},
+/* 32346 */ {26,205},
+/* 32347 */ {26,205},
+/* 32348 */ {26,205},
+/* 32349 */ {26,205},
+/* 32350 */ {26,205},
+/* 32351 */ {26,205},
+/* 32352 */ {26,210},
+/* 32353 */ {26,210},
+/* 32354 */ {26,210},
+/* 32355 */ {26,210},
+/* 32356 */ {26,210},
+/* 32357 */ {26,210},
+/* 32358 */ {26,210},
+/* 32359 */ {26,210},
+/* 32360 */ {26,210},
+/* 32361 */ {26,210},
+/* 32362 */ {26,210},
+/* 32363 */ {26,210},
+/* 32364 */ {26,210},
+/* 32365 */ {26,210},
+/* 32366 */ {26,210},
+/* 32367 */ {26,210},
+/* 32368 */ {26,213},
+/* 32369 */ {26,213},
+/* 32370 */ {26,213},
+/* 32371 */ {26,213},
+/* 32372 */ {26,213},
+/* 32373 */ {26,213},
+/* 32374 */ {26,213},
+/* 32375 */ {26,213},
+/* 32376 */ {26,213},
+/* 32377 */ {26,213},
+/* 32378 */ {26,213},
+/* 32379 */ {26,213},
+/* 32380 */ {26,213},
+/* 32381 */ {26,213},
+/* 32382 */ {26,213},
+/* 32383 */ {26,213},
+/* 32384 */ {26,218},
+/* 32385 */ {26,218},
+/* 32386 */ {26,218},
+/* 32387 */ {26,218},
+/* 32388 */ {26,218},
+/* 32389 */ {26,218},
+/* 32390 */ {26,218},
+/* 32391 */ {26,218},
+/* 32392 */ {26,218},
+/* 32393 */ {26,218},
+/* 32394 */ {26,218},
+/* 32395 */ {26,218},
+/* 32396 */ {26,218},
+/* 32397 */ {26,218},
+/* 32398 */ {26,218},
+/* 32399 */ {26,218},
+/* 32400 */ {26,219},
+/* 32401 */ {26,219},
+/* 32402 */ {26,219},
+/* 32403 */ {26,219},
+/* 32404 */ {26,219},
+/* 32405 */ {26,219},
+/* 32406 */ {26,219},
+/* 32407 */ {26,219},
+/* 32408 */ {26,219},
+/* 32409 */ {26,219},
+/* 32410 */ {26,219},
+/* 32411 */ {26,219},
+/* 32412 */ {26,219},
+/* 32413 */ {26,219},
+/* 32414 */ {26,219},
+/* 32415 */ {26,219},
+/* 32416 */ {26,238},
+/* 32417 */ {26,238},
+/* 32418 */ {26,238},
+/* 32419 */ {26,238},
+/* 32420 */ {26,238},
+/* 32421 */ {26,238},
+/* 32422 */ {26,238},
+/* 32423 */ {26,238},
+/* 32424 */ {26,238},
+/* 32425 */ {26,238},
+/* 32426 */ {26,238},
+/* 32427 */ {26,238},
+/* 32428 */ {26,238},
+/* 32429 */ {26,238},
+/* 32430 */ {26,238},
+/* 32431 */ {26,238},
+/* 32432 */ {26,240},
+/* 32433 */ {26,240},
+/* 32434 */ {26,240},
+/* 32435 */ {26,240},
+/* 32436 */ {26,240},
+/* 32437 */ {26,240},
+/* 32438 */ {26,240},
+/* 32439 */ {26,240},
+/* 32440 */ {26,240},
+/* 32441 */ {26,240},
+/* 32442 */ {26,240},
+/* 32443 */ {26,240},
+/* 32444 */ {26,240},
+/* 32445 */ {26,240},
+/* 32446 */ {26,240},
+/* 32447 */ {26,240},
+/* 32448 */ {26,242},
+/* 32449 */ {26,242},
+/* 32450 */ {26,242},
+/* 32451 */ {26,242},
+/* 32452 */ {26,242},
+/* 32453 */ {26,242},
+/* 32454 */ {26,242},
+/* 32455 */ {26,242},
+/* 32456 */ {26,242},
+/* 32457 */ {26,242},
+/* 32458 */ {26,242},
+/* 32459 */ {26,242},
+/* 32460 */ {26,242},
+/* 32461 */ {26,242},
+/* 32462 */ {26,242},
+/* 32463 */ {26,242},
+/* 32464 */ {26,243},
+/* 32465 */ {26,243},
+/* 32466 */ {26,243},
+/* 32467 */ {26,243},
+/* 32468 */ {26,243},
+/* 32469 */ {26,243},
+/* 32470 */ {26,243},
+/* 32471 */ {26,243},
+/* 32472 */ {26,243},
+/* 32473 */ {26,243},
+/* 32474 */ {26,243},
+/* 32475 */ {26,243},
+/* 32476 */ {26,243},
+/* 32477 */ {26,243},
+/* 32478 */ {26,243},
+/* 32479 */ {26,243},
+/* 32480 */ {26,255},
+/* 32481 */ {26,255},
+/* 32482 */ {26,255},
+/* 32483 */ {26,255},
+/* 32484 */ {26,255},
+/* 32485 */ {26,255},
+/* 32486 */ {26,255},
+/* 32487 */ {26,255},
+/* 32488 */ {26,255},
+/* 32489 */ {26,255},
+/* 32490 */ {26,255},
+/* 32491 */ {26,255},
+/* 32492 */ {26,255},
+/* 32493 */ {26,255},
+/* 32494 */ {26,255},
+/* 32495 */ {26,255},
+/* 32496 */ {27,203},
+/* 32497 */ {27,203},
+/* 32498 */ {27,203},
+/* 32499 */ {27,203},
+/* 32500 */ {27,203},
+/* 32501 */ {27,203},
+/* 32502 */ {27,203},
+/* 32503 */ {27,203},
+/* 32504 */ {27,204},
+/* 32505 */ {27,204},
+/* 32506 */ {27,204},
+/* 32507 */ {27,204},
+/* 32508 */ {27,204},
+/* 32509 */ {27,204},
+/* 32510 */ {27,204},
+/* 32511 */ {27,204},
+/* 32512 */ {27,211},
+/* 32513 */ {27,211},
+/* 32514 */ {27,211},
+/* 32515 */ {27,211},
+/* 32516 */ {27,211},
+/* 32517 */ {27,211},
+/* 32518 */ {27,211},
+/* 32519 */ {27,211},
+/* 32520 */ {27,212},
+/* 32521 */ {27,212},
+/* 32522 */ {27,212},
+/* 32523 */ {27,212},
+/* 32524 */ {27,212},
+/* 32525 */ {27,212},
+/* 32526 */ {27,212},
+/* 32527 */ {27,212},
+/* 32528 */ {27,214},
+/* 32529 */ {27,214},
+/* 32530 */ {27,214},
+/* 32531 */ {27,214},
+/* 32532 */ {27,214},
+/* 32533 */ {27,214},
+/* 32534 */ {27,214},
+/* 32535 */ {27,214},
+/* 32536 */ {27,221},
+/* 32537 */ {27,221},
+/* 32538 */ {27,221},
+/* 32539 */ {27,221},
+/* 32540 */ {27,221},
+/* 32541 */ {27,221},
+/* 32542 */ {27,221},
+/* 32543 */ {27,221},
+/* 32544 */ {27,222},
+/* 32545 */ {27,222},
+/* 32546 */ {27,222},
+/* 32547 */ {27,222},
+/* 32548 */ {27,222},
+/* 32549 */ {27,222},
+/* 32550 */ {27,222},
+/* 32551 */ {27,222},
+/* 32552 */ {27,223},
+/* 32553 */ {27,223},
+/* 32554 */ {27,223},
+/* 32555 */ {27,223},
+/* 32556 */ {27,223},
+/* 32557 */ {27,223},
+/* 32558 */ {27,223},
+/* 32559 */ {27,223},
+/* 32560 */ {27,241},
+/* 32561 */ {27,241},
+/* 32562 */ {27,241},
+/* 32563 */ {27,241},
+/* 32564 */ {27,241},
+/* 32565 */ {27,241},
+/* 32566 */ {27,241},
+/* 32567 */ {27,241},
+/* 32568 */ {27,244},
+/* 32569 */ {27,244},
+/* 32570 */ {27,244},
+/* 32571 */ {27,244},
+/* 32572 */ {27,244},
+/* 32573 */ {27,244},
+/* 32574 */ {27,244},
+/* 32575 */ {27,244},
+/* 32576 */ {27,245},
+/* 32577 */ {27,245},
+/* 32578 */ {27,245},
+/* 32579 */ {27,245},
+/* 32580 */ {27,245},
+/* 32581 */ {27,245},
+/* 32582 */ {27,245},
+/* 32583 */ {27,245},
+/* 32584 */ {27,246},
+/* 32585 */ {27,246},
+/* 32586 */ {27,246},
+/* 32587 */ {27,246},
+/* 32588 */ {27,246},
+/* 32589 */ {27,246},
+/* 32590 */ {27,246},
+/* 32591 */ {27,246},
+/* 32592 */ {27,247},
+/* 32593 */ {27,247},
+/* 32594 */ {27,247},
+/* 32595 */ {27,247},
+/* 32596 */ {27,247},
+/* 32597 */ {27,247},
+/* 32598 */ {27,247},
+/* 32599 */ {27,247},
+/* 32600 */ {27,248},
+/* 32601 */ {27,248},
+/* 32602 */ {27,248},
+/* 32603 */ {27,248},
+/* 32604 */ {27,248},
+/* 32605 */ {27,248},
+/* 32606 */ {27,248},
+/* 32607 */ {27,248},
+/* 32608 */ {27,250},
+/* 32609 */ {27,250},
+/* 32610 */ {27,250},
+/* 32611 */ {27,250},
+/* 32612 */ {27,250},
+/* 32613 */ {27,250},
+/* 32614 */ {27,250},
+/* 32615 */ {27,250},
+/* 32616 */ {27,251},
+/* 32617 */ {27,251},
+/* 32618 */ {27,251},
+/* 32619 */ {27,251},
+/* 32620 */ {27,251},
+/* 32621 */ {27,251},
+/* 32622 */ {27,251},
+/* 32623 */ {27,251},
+/* 32624 */ {27,252},
+/* 32625 */ {27,252},
+/* 32626 */ {27,252},
+/* 32627 */ {27,252},
+/* 32628 */ {27,252},
+/* 32629 */ {27,252},
+/* 32630 */ {27,252},
+/* 32631 */ {27,252},
+/* 32632 */ {27,253},
+/* 32633 */ {27,253},
+/* 32634 */ {27,253},
+/* 32635 */ {27,253},
+/* 32636 */ {27,253},
+/* 32637 */ {27,253},
+/* 32638 */ {27,253},
+/* 32639 */ {27,253},
+/* 32640 */ {27,254},
+/* 32641 */ {27,254},
+/* 32642 */ {27,254},
+/* 32643 */ {27,254},
+/* 32644 */ {27,254},
+/* 32645 */ {27,254},
+/* 32646 */ {27,254},
+/* 32647 */ {27,254},
+/* 32648 */ {28,2},
+/* 32649 */ {28,2},
+/* 32650 */ {28,2},
+/* 32651 */ {28,2},
+/* 32652 */ {28,3},
+/* 32653 */ {28,3},
+/* 32654 */ {28,3},
+/* 32655 */ {28,3},
+/* 32656 */ {28,4},
+/* 32657 */ {28,4},
+/* 32658 */ {28,4},
+/* 32659 */ {28,4},
+/* 32660 */ {28,5},
+/* 32661 */ {28,5},
+/* 32662 */ {28,5},
+/* 32663 */ {28,5},
+/* 32664 */ {28,6},
+/* 32665 */ {28,6},
+/* 32666 */ {28,6},
+/* 32667 */ {28,6},
+/* 32668 */ {28,7},
+/* 32669 */ {28,7},
+/* 32670 */ {28,7},
+/* 32671 */ {28,7},
+/* 32672 */ {28,8},
+/* 32673 */ {28,8},
+/* 32674 */ {28,8},
+/* 32675 */ {28,8},
+/* 32676 */ {28,11},
+/* 32677 */ {28,11},
+/* 32678 */ {28,11},
+/* 32679 */ {28,11},
+/* 32680 */ {28,12},
+/* 32681 */ {28,12},
+/* 32682 */ {28,12},
+/* 32683 */ {28,12},
+/* 32684 */ {28,14},
+/* 32685 */ {28,14},
+/* 32686 */ {28,14},
+/* 32687 */ {28,14},
+/* 32688 */ {28,15},
+/* 32689 */ {28,15},
+/* 32690 */ {28,15},
+/* 32691 */ {28,15},
+/* 32692 */ {28,16},
+/* 32693 */ {28,16},
+/* 32694 */ {28,16},
+/* 32695 */ {28,16},
+/* 32696 */ {28,17},
+/* 32697 */ {28,17},
+/* 32698 */ {28,17},
+/* 32699 */ {28,17},
+/* 32700 */ {28,18},
+/* 32701 */ {28,18},
+/* 32702 */ {28,18},
+/* 32703 */ {28,18},
+/* 32704 */ {28,19},
+/* 32705 */ {28,19},
+/* 32706 */ {28,19},
+/* 32707 */ {28,19},
+/* 32708 */ {28,20},
+/* 32709 */ {28,20},
+/* 32710 */ {28,20},
+/* 32711 */ {28,20},
+/* 32712 */ {28,21},
+/* 32713 */ {28,21},
+/* 32714 */ {28,21},
+/* 32715 */ {28,21},
+/* 32716 */ {28,23},
+/* 32717 */ {28,23},
+/* 32718 */ {28,23},
+/* 32719 */ {28,23},
+/* 32720 */ {28,24},
+/* 32721 */ {28,24},
+/* 32722 */ {28,24},
+/* 32723 */ {28,24},
+/* 32724 */ {28,25},
+/* 32725 */ {28,25},
+/* 32726 */ {28,25},
+/* 32727 */ {28,25},
+/* 32728 */ {28,26},
+/* 32729 */ {28,26},
+/* 32730 */ {28,26},
+/* 32731 */ {28,26},
+/* 32732 */ {28,27},
+/* 32733 */ {28,27},
+/* 32734 */ {28,27},
+/* 32735 */ {28,27},
+/* 32736 */ {28,28},
+/* 32737 */ {28,28},
+/* 32738 */ {28,28},
+/* 32739 */ {28,28},
+/* 32740 */ {28,29},
+/* 32741 */ {28,29},
+/* 32742 */ {28,29},
+/* 32743 */ {28,29},
+/* 32744 */ {28,30},
+/* 32745 */ {28,30},
+/* 32746 */ {28,30},
+/* 32747 */ {28,30},
+/* 32748 */ {28,31},
+/* 32749 */ {28,31},
+/* 32750 */ {28,31},
+/* 32751 */ {28,31},
+/* 32752 */ {28,127},
+/* 32753 */ {28,127},
+/* 32754 */ {28,127},
+/* 32755 */ {28,127},
+/* 32756 */ {28,220},
+/* 32757 */ {28,220},
+/* 32758 */ {28,220},
+/* 32759 */ {28,220},
+/* 32760 */ {28,249},
+/* 32761 */ {28,249},
+/* 32762 */ {28,249},
+/* 32763 */ {28,249},
+/* 32764 */ {30,10},
+/* 32765 */ {30,13},
+/* 32766 */ {30,22},
+/* 32767 */ {0,0},
+};
@@ -34,11 +34,26 @@ SOFTWARE.
 #endif
 #include XXH_HEADER_NAME
 
+#if LSHPACK_PROFILE
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#elif !defined(__aarch64__)
+#include <time.h>
+#endif
+#endif
+
+#if LSHPACK_USDT
+#include <sys/sdt.h>
+#endif
+
 #ifndef LS_HPACK_USE_LARGE_TABLES
 #define LS_HPACK_USE_LARGE_TABLES 1
 #endif
 
 #include "huff-tables.h"
+#if LS_HPACK_USE_LARGE_TABLES
+#include "huff-tables-long.h"
+#endif
 
 #define HPACK_STATIC_TABLE_SIZE   61
 #define INITIAL_DYNAMIC_TABLE_SIZE  4096
@@ -52,7 +67,121 @@ SOFTWARE.
  */
 #define DYNAMIC_ENTRY_OVERHEAD 32
 
-#define NAME_VAL(a, b) sizeof(a) - 1, sizeof(b) - 1, (a), (b)
+#if LSHPACK_PROFILE
+/* The clock runs for the innermost phase only: entering a phase stops the
+ * clock of the one it is nested in and leaving it restarts it.  HPROF()
+ * goes last among the declarations of the function to be timed; the
+ * cleanup attribute takes care of all the ways out of it.
+ */
+#define HPROF_MAX_DEPTH 8
+
+static __thread struct
+{
+    struct lshpack_prof     counts;
+    uint64_t                last;
+    unsigned                depth;
+    unsigned char           stack[HPROF_MAX_DEPTH];
+} s_hprof;
+
+
+static inline uint64_t
+hprof_now (void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#elif defined(__aarch64__)
+    uint64_t cnt;
+    __asm__ __volatile__ ("mrs %0, cntvct_el0" : "=r" (cnt));
+    return cnt;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000 + ts.tv_nsec;
+#endif
+}
+
+
+static inline int
+hprof_enter (enum lshpack_prof_phase phase)
+{
+    const uint64_t now = hprof_now();
+
+    assert(s_hprof.depth < HPROF_MAX_DEPTH);
+    if (s_hprof.depth > 0)
+        s_hprof.counts.cycles[ s_hprof.stack[ s_hprof.depth - 1 ] ]
+                                                        += now - s_hprof.last;
+    s_hprof.stack[ s_hprof.depth++ ] = phase;
+    ++s_hprof.counts.calls[phase];
+    s_hprof.last = now;
+    return 0;
+}
+
+
+static inline void
+hprof_leave (int *unused)
+{
+    const uint64_t now = hprof_now();
+
+    s_hprof.counts.cycles[ s_hprof.stack[ --s_hprof.depth ] ]
+                                                        += now - s_hprof.last;
+    s_hprof.last = now;
+}
+
+
+#define HPROF(phase_) int hprof_                                        \
+    __attribute__((cleanup(hprof_leave), unused)) = hprof_enter(phase_)
+
+
+void
+lshpack_prof_get (struct lshpack_prof *prof)
+{
+    *prof = s_hprof.counts;
+}
+
+
+void
+lshpack_prof_reset (void)
+{
+    memset(&s_hprof.counts, 0, sizeof(s_hprof.counts));
+}
+
+
+const char *
+lshpack_prof_phase_name (enum lshpack_prof_phase phase)
+{
+    static const char *const names[LSHPACK_PROF_N_PHASES] =
+    {
+        [LSHPACK_PROF_ENCODE]           = "encode",
+        [LSHPACK_PROF_DECODE]           = "decode",
+        [LSHPACK_PROF_HASH]             = "hash",
+        [LSHPACK_PROF_STATIC_LOOKUP]    = "static_lookup",
+        [LSHPACK_PROF_DYNAMIC_LOOKUP]   = "dynamic_lookup",
+        [LSHPACK_PROF_HUFF_ENCODE]      = "huff_encode",
+        [LSHPACK_PROF_HUFF_DECODE]      = "huff_decode",
+        [LSHPACK_PROF_PUSH]             = "push",
+        [LSHPACK_PROF_EVICT]            = "evict",
+        [LSHPACK_PROF_INT]              = "int",
+    };
+
+    return (unsigned) phase < LSHPACK_PROF_N_PHASES ? names[phase] : NULL;
+}
+#else
+#define HPROF(phase_)
+#endif
+
+/* Static tracepoints in provider `lshpack', for bpftrace, perf and
+ * SystemTap.  When LSHPACK_USDT is not set, they compile to nothing.
+ */
+#if LSHPACK_USDT
+#define HPROBE4(name_, a, b, c, d) DTRACE_PROBE4(lshpack, name_, a, b, c, d)
+#define HPROBE5(name_, a, b, c, d, e) \
+                                DTRACE_PROBE5(lshpack, name_, a, b, c, d, e)
+#else
+#define HPROBE4(name_, a, b, c, d)
+#define HPROBE5(name_, a, b, c, d, e)
+#endif
+
+#define NAME_VAL(a, b) sizeof(a) - 1, sizeof(b) - 1, (a), (b), a b
 
 static const struct
 {
@@ -60,6 +189,7 @@ static const struct
     unsigned          val_len;
     const char       *name;
     const char       *val;
+    const char       *name_val;     /* Name followed by value, for views */
 }
 static_table[HPACK_STATIC_TABLE_SIZE] =
 {
@@ -231,35 +361,69 @@ lshpack_arr_push (struct lshpack_arr *arr, uintptr_t val)
     return 0;
 }
 
-struct lshpack_double_enc_head
+/* Hash chains are linked by entry ID.  An ID is live if it belongs to one of
+ * the hpe_nelem newest entries; the chains are never unlinked, evicted
+ * entries simply fall off their ends.  A dead link is set to the ID right
+ * before the oldest entry: as entries are added, its age grows at least as
+ * fast as the table does, so it stays dead.
+ */
+struct lshpack_enc_bucket
 {
-    struct lshpack_enc_head by_name;
-    struct lshpack_enc_head by_nameval;
+    uint32_t                        by_name;
+    uint32_t                        by_nameval;
 };
 
-struct lshpack_enc_table_entry
+struct lshpack_enc_slot
 {
-    /* An entry always lives on the `all' and `nameval' lists.  If its name
-     * is not in the static table, it also lives on the `name' list.
-     */
-    STAILQ_ENTRY(lshpack_enc_table_entry)
-                                    ete_next_nameval,
-                                    ete_next_name,
-                                    ete_next_all;
-    unsigned                        ete_id;
-    unsigned                        ete_nameval_hash;
-    unsigned                        ete_name_hash;
-    unsigned                        ete_name_len;
-    unsigned                        ete_val_len;
-    char                            ete_buf[];
+    uint32_t                        ete_nameval_hash;
+    uint32_t                        ete_name_hash;
+    uint32_t                        ete_next_nameval;
+    uint32_t                        ete_next_name;
+    uint32_t                        ete_off;        /* Into hpe_payload */
+    lsxpack_strlen_t                ete_name_len;   /* In hpe_payload */
+    lsxpack_strlen_t                ete_val_len;
+    uint8_t                         ete_static_idx; /* Or 0 */
 };
 
-#define ETE_NAME(ete) ((ete)->ete_buf)
-#define ETE_VALUE(ete) (&(ete)->ete_buf[(ete)->ete_name_len])
+/* A name from the static table is not copied into the payload: such an
+ * entry has its static table index in ete_static_idx and zero
+ * ete_name_len.  An empty name is stored in the payload like any other.
+ */
+#define ETE_STATIC_NAME(ete) ((ete)->ete_static_idx != 0)
+#define ETE_NAME(enc, ete) (ETE_STATIC_NAME(ete) \
+            ? static_table[(ete)->ete_static_idx - 1].name \
+            : &(enc)->hpe_payload[(ete)->ete_off])
+#define ETE_NAME_LEN(ete) (ETE_STATIC_NAME(ete) \
+            ? static_table[(ete)->ete_static_idx - 1].name_len \
+            : (ete)->ete_name_len)
+#define ETE_VALUE(enc, ete) (&(enc)->hpe_payload[(ete)->ete_off \
+                                                    + (ete)->ete_name_len])
 
 
 #define N_BUCKETS(n_bits) (1U << (n_bits))
 #define BUCKNO(n_bits, hash) ((hash) & (N_BUCKETS(n_bits) - 1))
+#define N_SLOTS(n_bits) (N_BUCKETS(n_bits) / 2)
+
+#define HENC_SLOT(enc, id) \
+            (&(enc)->hpe_slots[(id) & (N_SLOTS((enc)->hpe_nbits) - 1)])
+#define HENC_ID_LIVE(enc, id) \
+            ((uint32_t) ((enc)->hpe_next_id - 1 - (id)) < (enc)->hpe_nelem)
+#define HENC_DEAD_ID(enc) ((enc)->hpe_next_id - (enc)->hpe_nelem - 1)
+#define HENC_OLDEST_ID(enc) ((enc)->hpe_next_id - (enc)->hpe_nelem)
+
+
+static void
+henc_init_buckets (struct lshpack_enc_bucket *buckets, unsigned nbits,
+                                                            uint32_t dead_id)
+{
+    unsigned i;
+
+    for (i = 0; i < N_BUCKETS(nbits); ++i)
+    {
+        buckets[i].by_name = dead_id;
+        buckets[i].by_nameval = dead_id;
+    }
+}
 
 
 /* We estimate average number of entries in the dynamic table to be 1/3
@@ -278,24 +442,24 @@ henc_hist_size (unsigned max_capacity)
 int
 lshpack_enc_init (struct lshpack_enc *enc)
 {
-    struct lshpack_double_enc_head *buckets;
+    struct lshpack_enc_bucket *buckets;
+    struct lshpack_enc_slot *slots;
     unsigned nbits = 2;
-    unsigned i;
 
     buckets = malloc(sizeof(buckets[0]) * N_BUCKETS(nbits));
     if (!buckets)
         return -1;
-
-    for (i = 0; i < N_BUCKETS(nbits); ++i)
+    slots = malloc(sizeof(slots[0]) * N_SLOTS(nbits));
+    if (!slots)
     {
-        STAILQ_INIT(&buckets[i].by_name);
-        STAILQ_INIT(&buckets[i].by_nameval);
+        free(buckets);
+        return -1;
     }
 
     memset(enc, 0, sizeof(*enc));
-    STAILQ_INIT(&enc->hpe_all_entries);
     enc->hpe_max_capacity = INITIAL_DYNAMIC_TABLE_SIZE;
     enc->hpe_buckets      = buckets;
+    enc->hpe_slots        = slots;
     /* The initial value of the entry ID is completely arbitrary.  As long as
      * there are fewer than 2^32 dynamic table entries, the math to calculate
      * the entry ID works.  To prove to ourselves that the wraparound works
@@ -305,6 +469,7 @@ lshpack_enc_init (struct lshpack_enc *enc)
     enc->hpe_next_id      = ~0 - 3;
     enc->hpe_nbits        = nbits;
     enc->hpe_nelem        = 0;
+    henc_init_buckets(buckets, nbits, HENC_DEAD_ID(enc));
     return 0;
 }
 
@@ -312,13 +477,10 @@ lshpack_enc_init (struct lshpack_enc *enc)
 void
 lshpack_enc_cleanup (struct lshpack_enc *enc)
 {
-    struct lshpack_enc_table_entry *entry, *next;
-    for (entry = STAILQ_FIRST(&enc->hpe_all_entries); entry; entry = next)
-    {
-        next = STAILQ_NEXT(entry, ete_next_all);
-        free(entry);
-    }
+    free(enc->hpe_huff_buf);
+    free(enc->hpe_payload);
     free(enc->hpe_hist_buf);
+    free(enc->hpe_slots);
     free(enc->hpe_buckets);
 }
 
@@ -416,8 +578,8 @@ static
 lshpack_enc_get_static_nameval (const struct lsxpack_header *input)
 {
     unsigned i;
+    HPROF(LSHPACK_PROF_STATIC_LOOKUP);
 
-    assert(input->name_len > 0);
     assert(input->flags & LSXPACK_NAMEVAL_HASH);
     i = (input->nameval_hash >> XXH_NAMEVAL_SHIFT) & ((1 << XXH_NAMEVAL_WIDTH) - 1);
     if (nameval2id[i])
@@ -442,6 +604,7 @@ static
 lshpack_enc_get_static_name (const struct lsxpack_header *input)
 {
     unsigned i;
+    HPROF(LSHPACK_PROF_STATIC_LOOKUP);
 
     assert(input->flags & LSXPACK_NAME_HASH);
     i = (input->name_hash >> XXH_NAME_SHIFT) & ((1 << XXH_NAME_WIDTH) - 1);
@@ -463,6 +626,8 @@ lshpack_enc_get_static_name (const struct lsxpack_header *input)
 static void
 update_hash (struct lsxpack_header *input)
 {
+    HPROF(LSHPACK_PROF_HASH);
+
     if (!(input->flags & LSXPACK_NAME_HASH))
         input->name_hash = XXH32(lsxpack_header_get_name(input),
                                  input->name_len, LSHPACK_XXH_SEED);
@@ -485,6 +650,7 @@ unsigned
 lshpack_enc_get_stx_tab_id (struct lsxpack_header *input)
 {
     unsigned i;
+    HPROF(LSHPACK_PROF_STATIC_LOOKUP);
 
     update_hash(input);
 
@@ -519,13 +685,32 @@ lshpack_enc_get_stx_tab_id (struct lsxpack_header *input)
 }
 
 
-/* Given a dynamic entry, return its table ID */
+/* Take name hash and static table index from the application registry */
+static void
+henc_use_app_name (const struct lshpack_app_reg *reg, lsxpack_header_t *input)
+{
+    const struct lshpack_app_name *app_name;
+
+    app_name = &reg->ar_names[input->app_index - 1];
+    assert(app_name->an_name_len == input->name_len
+        && 0 == memcmp(app_name->an_name, lsxpack_header_get_name(input),
+                                                            input->name_len));
+    if (!(input->flags & LSXPACK_NAME_HASH))
+    {
+        input->name_hash = app_name->an_name_hash;
+        input->flags |= LSXPACK_NAME_HASH;
+    }
+    if (input->hpack_index == LSHPACK_HDR_UNKNOWN)
+        input->hpack_index = app_name->an_hpack_index;
+}
+
+
+/* Given a dynamic entry ID, return its table ID */
 static unsigned
-henc_calc_table_id (const struct lshpack_enc *enc,
-                                    const struct lshpack_enc_table_entry *entry)
+henc_calc_table_id (const struct lshpack_enc *enc, uint32_t id)
 {
     return HPACK_STATIC_TABLE_SIZE
-         + (enc->hpe_next_id - entry->ete_id)
+         + (enc->hpe_next_id - id)
     ;
 }
 
@@ -534,14 +719,17 @@ static unsigned
 henc_find_table_id (struct lshpack_enc *enc, lsxpack_header_t *input,
                     int *val_matched)
 {
-    struct lshpack_enc_table_entry *entry;
+    const struct lshpack_enc_slot *entry;
     unsigned buckno, id;
+    uint32_t eid;
     const char *val_ptr = input->buf + input->val_offset;
     const char *name;
     unsigned int name_len;
+    HPROF(LSHPACK_PROF_DYNAMIC_LOOKUP);
 
     name_len = input->name_len;
-    name = lsxpack_header_get_name(input);
+    /* Not lsxpack_header_get_name(): an empty name is not NULL */
+    name = input->buf + input->name_offset;
 
     /* First, look for a match in the static table: */
     if (input->hpack_index)
@@ -595,19 +783,22 @@ henc_find_table_id (struct lshpack_enc *enc, lsxpack_header_t *input,
         }
     }
 
-    /* Search by name and value: */
+    /* Search by name and value, newest entry first: */
     buckno = BUCKNO(enc->hpe_nbits, input->nameval_hash);
-    STAILQ_FOREACH(entry, &enc->hpe_buckets[buckno].by_nameval,
-                                                        ete_next_nameval)
+    for (eid = enc->hpe_buckets[buckno].by_nameval; HENC_ID_LIVE(enc, eid);
+                                                eid = entry->ete_next_nameval)
+    {
+        entry = HENC_SLOT(enc, eid);
         if (input->nameval_hash == entry->ete_nameval_hash &&
-            name_len == entry->ete_name_len &&
+            name_len == ETE_NAME_LEN(entry) &&
             input->val_len == entry->ete_val_len &&
-            0 == memcmp(name, ETE_NAME(entry), name_len) &&
-            0 == memcmp(val_ptr, ETE_VALUE(entry), input->val_len))
+            0 == memcmp(name, ETE_NAME(enc, entry), name_len) &&
+            0 == memcmp(val_ptr, ETE_VALUE(enc, entry), input->val_len))
         {
             *val_matched = 1;
-            return henc_calc_table_id(enc, entry);
+            return henc_calc_table_id(enc, eid);
         }
+    }
 
     /* Name/value match is not found, look for header: */
     if (input->hpack_index == LSHPACK_HDR_UNKNOWN)
@@ -620,14 +811,19 @@ henc_find_table_id (struct lshpack_enc *enc, lsxpack_header_t *input,
 
     /* Search by name only: */
     buckno = BUCKNO(enc->hpe_nbits, input->name_hash);
-    STAILQ_FOREACH(entry, &enc->hpe_buckets[buckno].by_name, ete_next_name)
+    for (eid = enc->hpe_buckets[buckno].by_name; HENC_ID_LIVE(enc, eid);
+                                                    eid = entry->ete_next_name)
+    {
+        entry = HENC_SLOT(enc, eid);
         if (input->name_hash == entry->ete_name_hash &&
+            !ETE_STATIC_NAME(entry) &&
             input->name_len == entry->ete_name_len &&
-            0 == memcmp(name, ETE_NAME(entry), name_len))
+            0 == memcmp(name, ETE_NAME(enc, entry), name_len))
         {
             input->flags &= ~LSXPACK_HPACK_VAL_MATCHED;
-            return henc_calc_table_id(enc, entry);
+            return henc_calc_table_id(enc, eid);
         }
+    }
 
     return 0;
 }
@@ -640,31 +836,33 @@ static
 lshpack_enc_enc_int (unsigned char *dst, unsigned char *const end,
                                         uint32_t value, uint8_t prefix_bits)
 {
-    unsigned char *const dst_orig = dst;
+    const uint32_t prefix_max = (1 << prefix_bits) - 1;
+    unsigned n;
+    HPROF(LSHPACK_PROF_INT);
 
     /* This function assumes that at least one byte is available */
     assert(dst < end);
-    if (value < (uint32_t)(1 << prefix_bits) - 1)
+    if (value < prefix_max)
+    {
         *dst++ |= value;
-    else
+        return dst;
+    }
+
+    /* Count continuation bytes up front, so that there is a single bounds
+     * check and the loop below has none.
+     */
+    value -= prefix_max;
+    n = 1 + (value >= 1u << 7) + (value >= 1u << 14) + (value >= 1u << 21)
+                                                        + (value >= 1u << 28);
+    if ((size_t) (end - dst) <= n)
+        return dst;
+    *dst++ |= prefix_max;
+    while (value >= 128)
     {
-        *dst++ |= (1 << prefix_bits) - 1;
-        value -= (1 << prefix_bits) - 1;
-        while (value >= 128)
-        {
-            if (dst < end)
-            {
-                *dst++ = (0x80 | value);
-                value >>= 7;
-            }
-            else
-                return dst_orig;
-        }
-        if (dst < end)
-            *dst++ = value;
-        else
-            return dst_orig;
+        *dst++ = (0x80 | value);
+        value >>= 7;
     }
+    *dst++ = value;
     return dst;
 }
 
@@ -820,6 +1018,7 @@ lshpack_enc_enc_str (unsigned char *const dst, size_t dst_len,
     unsigned char *p;
     unsigned size_len;
     int rc;
+    HPROF(LSHPACK_PROF_HUFF_ENCODE);
 
     if (dst_len > 1)
         /* We guess that the string size fits into a single byte -- meaning
@@ -889,23 +1088,22 @@ lshpack_enc_enc_str (unsigned char *const dst, size_t dst_len,
 static void
 henc_drop_oldest_entry (struct lshpack_enc *enc)
 {
-    struct lshpack_enc_table_entry *entry;
-    unsigned buckno;
+    const struct lshpack_enc_slot *entry;
+    HPROF(LSHPACK_PROF_EVICT);
 
-    entry = STAILQ_FIRST(&enc->hpe_all_entries);
-    assert(entry);
-    STAILQ_REMOVE_HEAD(&enc->hpe_all_entries, ete_next_all);
-    buckno = BUCKNO(enc->hpe_nbits, entry->ete_nameval_hash);
-    assert(entry == STAILQ_FIRST(&enc->hpe_buckets[buckno].by_nameval));
-    STAILQ_REMOVE_HEAD(&enc->hpe_buckets[buckno].by_nameval, ete_next_nameval);
-    buckno = BUCKNO(enc->hpe_nbits, entry->ete_name_hash);
-    if (entry == STAILQ_FIRST(&enc->hpe_buckets[buckno].by_name))
-        STAILQ_REMOVE_HEAD(&enc->hpe_buckets[buckno].by_name, ete_next_name);
-
-    enc->hpe_cur_capacity -= DYNAMIC_ENTRY_OVERHEAD + entry->ete_name_len
+    assert(enc->hpe_nelem > 0);
+    entry = HENC_SLOT(enc, HENC_OLDEST_ID(enc));
+    assert(entry->ete_off == enc->hpe_pl_off);
+    enc->hpe_cur_capacity -= DYNAMIC_ENTRY_OVERHEAD + ETE_NAME_LEN(entry)
                                                         + entry->ete_val_len;
+    /* The entry is now dead: there is nothing to unlink */
     --enc->hpe_nelem;
-    free(entry);
+    HPROBE5(enc_evict, enc, ETE_NAME(enc, entry), ETE_NAME_LEN(entry),
+                                    entry->ete_val_len, enc->hpe_cur_capacity);
+    if (enc->hpe_nelem > 0)
+        enc->hpe_pl_off += entry->ete_name_len + entry->ete_val_len;
+    else
+        enc->hpe_pl_off = enc->hpe_pl_end = 0;
 }
 
 
@@ -920,46 +1118,81 @@ henc_remove_overflow_entries (struct lshpack_enc *enc)
 static int
 henc_grow_tables (struct lshpack_enc *enc)
 {
-    struct lshpack_double_enc_head *new_buckets, *new[2];
-    struct lshpack_enc_table_entry *entry;
-    unsigned n, old_nbits;
-    int idx;
+    struct lshpack_enc_bucket *new_buckets, *bucket;
+    struct lshpack_enc_slot *new_slots, *entry;
+    unsigned old_nbits, nbits;
+    uint32_t id;
 
     old_nbits = enc->hpe_nbits;
-    new_buckets = malloc(sizeof(enc->hpe_buckets[0])
-                                                * N_BUCKETS(old_nbits + 1));
+    nbits = old_nbits + 1;
+    new_buckets = malloc(sizeof(new_buckets[0]) * N_BUCKETS(nbits));
     if (!new_buckets)
         return -1;
+    new_slots = malloc(sizeof(new_slots[0]) * N_SLOTS(nbits));
+    if (!new_slots)
+    {
+        free(new_buckets);
+        return -1;
+    }
 
-    for (n = 0; n < N_BUCKETS(old_nbits); ++n)
+    /* Relink from oldest to newest, so that chains stay newest first */
+    henc_init_buckets(new_buckets, nbits, HENC_DEAD_ID(enc));
+    for (id = HENC_OLDEST_ID(enc); id != enc->hpe_next_id; ++id)
     {
-        new[0] = &new_buckets[n];
-        new[1] = &new_buckets[n + N_BUCKETS(old_nbits)];
-        STAILQ_INIT(&new[0]->by_name);
-        STAILQ_INIT(&new[1]->by_name);
-        STAILQ_INIT(&new[0]->by_nameval);
-        STAILQ_INIT(&new[1]->by_nameval);
-        while ((entry = STAILQ_FIRST(&enc->hpe_buckets[n].by_name)))
-        {
-            STAILQ_REMOVE_HEAD(&enc->hpe_buckets[n].by_name, ete_next_name);
-            idx = (BUCKNO(old_nbits + 1, entry->ete_name_hash)
-                                                        >> old_nbits) & 1;
-            STAILQ_INSERT_TAIL(&new[idx]->by_name, entry, ete_next_name);
-        }
-        while ((entry = STAILQ_FIRST(&enc->hpe_buckets[n].by_nameval)))
-        {
-            STAILQ_REMOVE_HEAD(&enc->hpe_buckets[n].by_nameval,
-                                                        ete_next_nameval);
-            idx = (BUCKNO(old_nbits + 1, entry->ete_nameval_hash)
-                                                        >> old_nbits) & 1;
-            STAILQ_INSERT_TAIL(&new[idx]->by_nameval, entry,
-                                                        ete_next_nameval);
-        }
+        entry = &new_slots[ id & (N_SLOTS(nbits) - 1) ];
+        *entry = *HENC_SLOT(enc, id);
+        bucket = &new_buckets[ BUCKNO(nbits, entry->ete_nameval_hash) ];
+        entry->ete_next_nameval = bucket->by_nameval;
+        bucket->by_nameval = id;
+        bucket = &new_buckets[ BUCKNO(nbits, entry->ete_name_hash) ];
+        entry->ete_next_name = bucket->by_name;
+        bucket->by_name = id;
     }
 
     free(enc->hpe_buckets);
-    enc->hpe_nbits   = old_nbits + 1;
+    free(enc->hpe_slots);
+    enc->hpe_nbits   = nbits;
     enc->hpe_buckets = new_buckets;
+    enc->hpe_slots   = new_slots;
+    HPROBE4(enc_grow_tables, enc, old_nbits, enc->hpe_nbits, enc->hpe_nelem);
+    return 0;
+}
+
+
+/* Make room for `size' more bytes at the end of the payload buffer.  Live
+ * payload is moved to the beginning of the buffer -- in place if that
+ * frees up at least a quarter of it, otherwise into a buffer twice as
+ * large -- and the slots' offsets are adjusted.
+ */
+static int
+henc_grow_payload (struct lshpack_enc *enc, unsigned size)
+{
+    char *new_buf;
+    unsigned live, n;
+    uint32_t id;
+
+    live = enc->hpe_pl_end - enc->hpe_pl_off;
+    if (live + size <= enc->hpe_pl_nalloc - enc->hpe_pl_nalloc / 4)
+        memmove(enc->hpe_payload, enc->hpe_payload + enc->hpe_pl_off, live);
+    else
+    {
+        n = enc->hpe_pl_nalloc ? enc->hpe_pl_nalloc * 2 : 256;
+        while (n < live + size)
+            n *= 2;
+        new_buf = malloc(n);
+        if (!new_buf)
+            return -1;
+        if (live)
+            memcpy(new_buf, enc->hpe_payload + enc->hpe_pl_off, live);
+        free(enc->hpe_payload);
+        enc->hpe_payload = new_buf;
+        enc->hpe_pl_nalloc = n;
+    }
+
+    for (id = HENC_OLDEST_ID(enc); id != enc->hpe_next_id; ++id)
+        HENC_SLOT(enc, id)->ete_off -= enc->hpe_pl_off;
+    enc->hpe_pl_end = live;
+    enc->hpe_pl_off = 0;
     return 0;
 }
 
@@ -971,50 +1204,73 @@ static
 lshpack_enc_push_entry (struct lshpack_enc *enc,
                         const struct lsxpack_header *input)
 {
-    unsigned buckno;
-    struct lshpack_enc_table_entry *entry;
-    size_t size;
-    const char *name;
-    unsigned int name_len;
+    struct lshpack_enc_bucket *bucket;
+    struct lshpack_enc_slot *entry;
+    unsigned int name_len, size, static_idx;
+    uint32_t id;
+    HPROF(LSHPACK_PROF_PUSH);
 
-    if (enc->hpe_nelem >= N_BUCKETS(enc->hpe_nbits) / 2 &&
+    if (enc->hpe_nelem >= N_SLOTS(enc->hpe_nbits) &&
                                                 0 != henc_grow_tables(enc))
         return -1;
     name_len = input->name_len;
-    if (name_len == 0)
+    if (input->hpack_index != LSHPACK_HDR_UNKNOWN
+        && (name_len == 0
+            || (name_len == static_table[input->hpack_index - 1].name_len
+                && 0 == memcmp(lsxpack_header_get_name(input),
+                        static_table[input->hpack_index - 1].name, name_len))))
     {
-        assert(input->hpack_index != LSHPACK_HDR_UNKNOWN);
-        name = static_table[input->hpack_index - 1].name;
+        static_idx = input->hpack_index;
         name_len = static_table[input->hpack_index - 1].name_len;
+        size = input->val_len;
     }
     else
-        name = lsxpack_header_get_name(input);
-    size = sizeof(*entry) + name_len + input->val_len;
-    entry = malloc(size);
-    if (!entry)
+    {
+        static_idx = 0;
+        size = name_len + input->val_len;
+    }
+    if (enc->hpe_pl_end + size > enc->hpe_pl_nalloc &&
+                                        0 != henc_grow_payload(enc, size))
         return -1;
 
-    entry->ete_name_hash = input->name_hash;
+    id = enc->hpe_next_id;
+    entry = HENC_SLOT(enc, id);
     entry->ete_nameval_hash = input->nameval_hash;
-    entry->ete_name_len = name_len;
     entry->ete_val_len = input->val_len;
-    entry->ete_id = enc->hpe_next_id++;
-    memcpy(ETE_NAME(entry), name, name_len);
-    memcpy(ETE_VALUE(entry), input->buf + input->val_offset, input->val_len);
-
-    STAILQ_INSERT_TAIL(&enc->hpe_all_entries, entry, ete_next_all);
-    buckno = BUCKNO(enc->hpe_nbits, input->nameval_hash);
-    STAILQ_INSERT_TAIL(&enc->hpe_buckets[buckno].by_nameval, entry,
-                                                        ete_next_nameval);
-    if (input->hpack_index == LSHPACK_HDR_UNKNOWN)
+    entry->ete_off = enc->hpe_pl_end;
+    entry->ete_name_hash = input->name_hash;
+    entry->ete_static_idx = static_idx;
+    if (static_idx)
+        entry->ete_name_len = 0;
+    else
     {
-        buckno = BUCKNO(enc->hpe_nbits, input->name_hash);
-        STAILQ_INSERT_TAIL(&enc->hpe_buckets[buckno].by_name, entry,
-                                                            ete_next_name);
+        entry->ete_name_len = name_len;
+        if (name_len > 0)
+            memcpy(&enc->hpe_payload[entry->ete_off],
+                                lsxpack_header_get_name(input), name_len);
     }
-    enc->hpe_cur_capacity += DYNAMIC_ENTRY_OVERHEAD + name_len
-                             + input->val_len;
+    memcpy(ETE_VALUE(enc, entry), input->buf + input->val_offset,
+                                                            input->val_len);
+    enc->hpe_pl_end += size;
+
+    /* Names from the static table are never looked up in the dynamic
+     * table, but it is simpler to chain all entries by name.
+     */
+    bucket = &enc->hpe_buckets[ BUCKNO(enc->hpe_nbits, input->nameval_hash) ];
+    entry->ete_next_nameval = HENC_ID_LIVE(enc, bucket->by_nameval)
+                            ? bucket->by_nameval : HENC_DEAD_ID(enc);
+    bucket->by_nameval = id;
+    bucket = &enc->hpe_buckets[ BUCKNO(enc->hpe_nbits, input->name_hash) ];
+    entry->ete_next_name = HENC_ID_LIVE(enc, bucket->by_name)
+                            ? bucket->by_name : HENC_DEAD_ID(enc);
+    bucket->by_name = id;
+
+    ++enc->hpe_next_id;
     ++enc->hpe_nelem;
+    enc->hpe_cur_capacity += DYNAMIC_ENTRY_OVERHEAD + name_len
+                                                        + input->val_len;
+    HPROBE5(enc_push, enc, ETE_NAME(enc, entry), name_len, input->val_len,
+                                                    enc->hpe_cur_capacity);
     henc_remove_overflow_entries(enc);
     return 0;
 }
@@ -1088,6 +1344,50 @@ henc_hist_add (struct lshpack_enc *enc, uint32_t nameval_hash)
 }
 
 
+/* A header decoded with lazy Huffman decoding still has its value
+ * Huffman-encoded.  The value is looked up and added to the dynamic table
+ * decoded, so copy the name and the decoded value into the scratch buffer
+ * and point `copy' at them.  Returns 0 on success or -1 if the value does
+ * not decode or is too long.
+ */
+static int
+henc_decode_lazy_value (struct lshpack_enc *enc,
+                    const lsxpack_header_t *input, lsxpack_header_t *copy)
+{
+    char *buf;
+    unsigned size;
+    int len;
+
+    len = lshpack_dec_huff_length(
+                    (const unsigned char *) lsxpack_header_get_value(input),
+                    input->val_len);
+    if (len < 0 || input->name_len + (unsigned) len > LSXPACK_MAX_STRLEN)
+        return -1;
+    size = input->name_len + len;
+    if (size > enc->hpe_huff_nalloc)
+    {
+        buf = realloc(enc->hpe_huff_buf, size);
+        if (!buf)
+            return -1;
+        enc->hpe_huff_buf = buf;
+        enc->hpe_huff_nalloc = size;
+    }
+    memcpy(enc->hpe_huff_buf, input->buf + input->name_offset,
+                                                            input->name_len);
+    if (len != lshpack_dec_decode_value(input,
+                                enc->hpe_huff_buf + input->name_len, len))
+        return -1;
+
+    *copy = *input;
+    copy->buf = enc->hpe_huff_buf;
+    copy->name_offset = 0;
+    copy->val_offset = input->name_len;
+    copy->val_len = len;
+    copy->flags &= ~(LSXPACK_VAL_HUFFMAN|LSXPACK_NAMEVAL_HASH);
+    return 0;
+}
+
+
 unsigned char *
 lshpack_enc_encode (struct lshpack_enc *enc, unsigned char *dst,
         unsigned char *dst_end, lsxpack_header_t *input)
@@ -1095,13 +1395,22 @@ lshpack_enc_encode (struct lshpack_enc *enc, unsigned char *dst,
     //indexed_type: 0, Add, 1,: without, 2: never
     static const char indexed_prefix_number[] = {0x40, 0x00, 0x10};
     unsigned char *const dst_org = dst;
+    lsxpack_header_t copy;
     int rc;
     int val_matched = 0;
     unsigned table_id;
+    HPROF(LSHPACK_PROF_ENCODE);
 
     if (dst_end <= dst)
         return dst_org;
 
+    if (input->flags & LSXPACK_VAL_HUFFMAN)
+    {
+        if (0 != henc_decode_lazy_value(enc, input, &copy))
+            return dst_org;
+        input = &copy;
+    }
+
     if (input->flags & LSXPACK_HPACK_VAL_MATCHED)
     {
         assert(input->hpack_index != LSHPACK_HDR_UNKNOWN);
@@ -1116,6 +1425,10 @@ lshpack_enc_encode (struct lshpack_enc *enc, unsigned char *dst,
     {
         if (input->flags & LSXPACK_NEVER_INDEX)
             input->indexed_type = 2;
+        if ((input->flags & LSXPACK_APP_IDX) && enc->hpe_app_reg
+                && input->app_index > 0
+                && input->app_index <= enc->hpe_app_reg->ar_count)
+            henc_use_app_name(enc->hpe_app_reg, input);
         table_id = henc_find_table_id(enc, input, &val_matched);
         if (enc->hpe_hist_buf)
         {
@@ -1152,10 +1465,9 @@ lshpack_enc_encode (struct lshpack_enc *enc, unsigned char *dst,
     }
     else
     {
-        assert(input->name_len > 0);
         *dst++ = indexed_prefix_number[input->indexed_type];
         rc = lshpack_enc_enc_str(dst, dst_end - dst,
-                                 (unsigned char *)lsxpack_header_get_name(input),
+                                 (unsigned char *)input->buf + input->name_offset,
                                  input->name_len);
         if (rc < 0)
             return dst_org; //Failed to enc this header, return unchanged ptr.
@@ -1189,11 +1501,84 @@ lshpack_enc_set_max_capacity (struct lshpack_enc *enc, unsigned max_capacity)
         henc_resize_history(enc);
 }
 
+
+void
+lshpack_enc_reset (struct lshpack_enc *enc, size_t max_keep)
+{
+    struct lshpack_enc_bucket *buckets;
+    struct lshpack_enc_slot *slots;
+
+    if (enc->hpe_nbits > 2
+            && (sizeof(buckets[0]) * N_BUCKETS(enc->hpe_nbits)
+                + sizeof(slots[0]) * N_SLOTS(enc->hpe_nbits)) > max_keep)
+    {
+        /* Shrinking: if realloc() fails, the old array is still good */
+        buckets = realloc(enc->hpe_buckets, sizeof(buckets[0]) * N_BUCKETS(2));
+        if (buckets)
+            enc->hpe_buckets = buckets;
+        slots = realloc(enc->hpe_slots, sizeof(slots[0]) * N_SLOTS(2));
+        if (slots)
+            enc->hpe_slots = slots;
+        enc->hpe_nbits = 2;
+    }
+    if (enc->hpe_pl_nalloc > max_keep)
+    {
+        free(enc->hpe_payload);
+        enc->hpe_payload = NULL;
+        enc->hpe_pl_nalloc = 0;
+    }
+    if (enc->hpe_huff_nalloc > max_keep)
+    {
+        free(enc->hpe_huff_buf);
+        enc->hpe_huff_buf = NULL;
+        enc->hpe_huff_nalloc = 0;
+    }
+    enc->hpe_pl_off = 0;
+    enc->hpe_pl_end = 0;
+
+    enc->hpe_cur_capacity = 0;
+    enc->hpe_next_id      = ~0 - 3;
+    enc->hpe_nelem        = 0;
+    henc_init_buckets(enc->hpe_buckets, enc->hpe_nbits, HENC_DEAD_ID(enc));
+    if (enc->hpe_hist_buf
+        && sizeof(enc->hpe_hist_buf[0]) * (enc->hpe_hist_size + 1) > max_keep)
+    {
+        free(enc->hpe_hist_buf);
+        enc->hpe_hist_buf  = NULL;
+        enc->hpe_hist_size = 0;
+    }
+    enc->hpe_max_capacity = INITIAL_DYNAMIC_TABLE_SIZE;
+    if (lshpack_enc_hist_used(enc))
+    {
+        if (enc->hpe_hist_buf)
+            henc_resize_history(enc);
+        else
+            (void) henc_use_hist(enc);
+    }
+    enc->hpe_hist_idx     = 0;
+    enc->hpe_hist_wrapped = 0;
+}
+
+
+size_t
+lshpack_enc_mem_used (const struct lshpack_enc *enc)
+{
+    size_t size;
+
+    size = sizeof(enc->hpe_buckets[0]) * N_BUCKETS(enc->hpe_nbits)
+         + sizeof(enc->hpe_slots[0]) * N_SLOTS(enc->hpe_nbits)
+         + enc->hpe_pl_nalloc
+         + enc->hpe_huff_nalloc;
+    if (enc->hpe_hist_buf)
+        size += sizeof(enc->hpe_hist_buf[0]) * (enc->hpe_hist_size + 1);
+    return size;
+}
+
 #if LS_HPACK_EMIT_TEST_CODE
 void
 lshpack_enc_iter_init (struct lshpack_enc *enc, void **iter)
 {
-    *iter = STAILQ_FIRST(&enc->hpe_all_entries);
+    *iter = NULL;   /* Number of entries returned so far */
 }
 
 
@@ -1202,19 +1587,23 @@ int
 lshpack_enc_iter_next (struct lshpack_enc *enc, void **iter,
                                         struct enc_dyn_table_entry *retval)
 {
-    const struct lshpack_enc_table_entry *entry;
+    const struct lshpack_enc_slot *entry;
+    uintptr_t n;
+    uint32_t id;
 
-    entry = *iter;
-    if (!entry)
+    n = (uintptr_t) *iter;
+    if (n >= enc->hpe_nelem)
         return -1;
 
-    *iter = STAILQ_NEXT(entry, ete_next_all);
+    *iter = (void *) (n + 1);
+    id = HENC_OLDEST_ID(enc) + n;
+    entry = HENC_SLOT(enc, id);
 
-    retval->name = ETE_NAME(entry);
-    retval->value = ETE_VALUE(entry);
-    retval->name_len = entry->ete_name_len;
+    retval->name = ETE_NAME(enc, entry);
+    retval->value = ETE_VALUE(enc, entry);
+    retval->name_len = ETE_NAME_LEN(entry);
     retval->value_len = entry->ete_val_len;
-    retval->entry_id = henc_calc_table_id(enc, entry);
+    retval->entry_id = henc_calc_table_id(enc, id);
     return 0;
 }
 #endif
@@ -1223,22 +1612,62 @@ lshpack_enc_iter_next (struct lshpack_enc *enc, void **iter,
 /* Dynamic table entry: */
 struct dec_table_entry
 {
-    unsigned    dte_name_len;
-    unsigned    dte_val_len;
-#if LSHPACK_DEC_CALC_HASH
     uint32_t    dte_name_hash;
     uint32_t    dte_nameval_hash;
+    uint32_t    dte_id;        /* See hdec_get_entry_by_id() */
+    lsxpack_strlen_t
+                dte_name_len;
+    lsxpack_strlen_t
+                dte_val_len;
     enum {
         DTEF_NAME_HASH      = LSXPACK_NAME_HASH,
         DTEF_NAMEVAL_HASH   = LSXPACK_NAMEVAL_HASH,
+        /* Set if validation found the name or value malformed: */
+        DTEF_BAD_NAME       = 1 << 0,
+        DTEF_BAD_VALUE      = 1 << 1,
+        /* The name is not copied, see hdec_push_entry(): */
+        DTEF_NAME_STATIC    = 1 << 2,
+        DTEF_NAME_REF       = 1 << 5,
+        /* Evicted, but kept for entries that point at its name: */
+        DTEF_EVICTED        = 1 << 6,
     }           dte_flags:8;
-#endif
     uint8_t     dte_name_idx;
-    char        dte_buf[];     /* Contains both name and value */
+    uint8_t     dte_app_idx;
+    uint8_t     dte_nrefs;     /* Entries that point at the name */
+    char        dte_buf[];     /* Name, unless it is not copied, and value */
 };
 
-#define DTE_NAME(dte) ((dte)->dte_buf)
-#define DTE_VALUE(dte) (&(dte)->dte_buf[(dte)->dte_name_len])
+/* Number of bytes the name takes up in dte_buf: none if it is in the
+ * static table, a pointer to the entry that has it if DTEF_NAME_REF is set.
+ */
+#define DTE_NAME_SIZE(dte) ((dte)->dte_flags & DTEF_NAME_STATIC ? 0 \
+    : (dte)->dte_flags & DTEF_NAME_REF ? sizeof(struct dec_table_entry *) \
+    : (dte)->dte_name_len)
+#define DTE_VALUE(dte) (&(dte)->dte_buf[DTE_NAME_SIZE(dte)])
+#define DTE_ALLOC_SIZE(dte) (sizeof(struct dec_table_entry) \
+                                + DTE_NAME_SIZE(dte) + (dte)->dte_val_len)
+
+
+static struct dec_table_entry *
+hdec_name_owner (const struct dec_table_entry *entry)
+{
+    struct dec_table_entry *owner;
+
+    memcpy(&owner, entry->dte_buf, sizeof(owner));
+    return owner;
+}
+
+
+static const char *
+hdec_entry_name (const struct dec_table_entry *entry)
+{
+    if (entry->dte_flags & DTEF_NAME_STATIC)
+        return static_table[entry->dte_name_idx - 1].name;
+    else if (entry->dte_flags & DTEF_NAME_REF)
+        return hdec_name_owner(entry)->dte_buf;
+    else
+        return entry->dte_buf;
+}
 
 enum
 {
@@ -1260,10 +1689,45 @@ lshpack_dec_init (struct lshpack_dec *dec)
     memset(dec, 0, sizeof(*dec));
     dec->hpd_max_capacity = INITIAL_DYNAMIC_TABLE_SIZE;
     dec->hpd_cur_max_capacity = INITIAL_DYNAMIC_TABLE_SIZE;
+#if LSHPACK_DEC_HTTP1X_OUTPUT
+    dec->hpd_flags |= LSHPACK_DEC_HTTP1X;
+#endif
+#if LSHPACK_DEC_CALC_HASH
+    dec->hpd_flags |= LSHPACK_DEC_HASH;
+#endif
     lshpack_arr_init(&dec->hpd_dyn_table);
 }
 
 
+/* An entry whose name other entries point at is freed after the last of
+ * them is.
+ */
+static void
+hdec_free_entry (struct lshpack_dec *dec, struct dec_table_entry *entry)
+{
+    struct dec_table_entry *owner;
+
+    if (entry->dte_nrefs > 0)
+    {
+        entry->dte_flags |= DTEF_EVICTED;
+        return;
+    }
+
+    if (entry->dte_flags & DTEF_NAME_REF)
+    {
+        owner = hdec_name_owner(entry);
+        assert(owner->dte_nrefs > 0);
+        if (--owner->dte_nrefs == 0 && (owner->dte_flags & DTEF_EVICTED))
+        {
+            dec->hpd_entries_size -= DTE_ALLOC_SIZE(owner);
+            free(owner);
+        }
+    }
+    dec->hpd_entries_size -= DTE_ALLOC_SIZE(entry);
+    free(entry);
+}
+
+
 void
 lshpack_dec_cleanup (struct lshpack_dec *dec)
 {
@@ -1272,9 +1736,53 @@ lshpack_dec_cleanup (struct lshpack_dec *dec)
     while (lshpack_arr_count(&dec->hpd_dyn_table) > 0)
     {
         val = lshpack_arr_pop(&dec->hpd_dyn_table);
-        free((struct dec_table_entry *) val);
+        hdec_free_entry(dec, (struct dec_table_entry *) val);
     }
     lshpack_arr_cleanup(&dec->hpd_dyn_table);
+    free(dec->hpd_resume.buf);
+}
+
+
+void
+lshpack_dec_reset (struct lshpack_dec *dec, size_t max_keep)
+{
+    uintptr_t val;
+
+    while (lshpack_arr_count(&dec->hpd_dyn_table) > 0)
+    {
+        val = lshpack_arr_pop(&dec->hpd_dyn_table);
+        hdec_free_entry(dec, (struct dec_table_entry *) val);
+    }
+    dec->hpd_dyn_table.off = 0;
+    if (sizeof(dec->hpd_dyn_table.els[0]) * dec->hpd_dyn_table.nalloc
+                                                                    > max_keep)
+        lshpack_arr_cleanup(&dec->hpd_dyn_table);
+
+    dec->hpd_resume.src = NULL;
+    if (dec->hpd_resume.nalloc > max_keep)
+    {
+        free(dec->hpd_resume.buf);
+        dec->hpd_resume.buf = NULL;
+        dec->hpd_resume.nalloc = 0;
+    }
+
+    /* hpd_ins_count keeps counting, so that entry IDs handed out before
+     * the reset do not find new entries.
+     */
+    dec->hpd_max_capacity = INITIAL_DYNAMIC_TABLE_SIZE;
+    dec->hpd_cur_max_capacity = INITIAL_DYNAMIC_TABLE_SIZE;
+    dec->hpd_cur_capacity = 0;
+    ++dec->hpd_state;
+    lshpack_dec_start_block(dec);
+}
+
+
+size_t
+lshpack_dec_mem_used (const struct lshpack_dec *dec)
+{
+    return dec->hpd_entries_size
+         + sizeof(dec->hpd_dyn_table.els[0]) * dec->hpd_dyn_table.nalloc
+         + dec->hpd_resume.nalloc;
 }
 
 
@@ -1282,6 +1790,20 @@ lshpack_dec_cleanup (struct lshpack_dec *dec)
 #define LSHPACK_UINT32_ENC_SZ 6
 
 
+#if __GNUC__
+static uint64_t
+hdec_load64 (const unsigned char *p)
+{
+    uint64_t w;
+    memcpy(&w, p, sizeof(w));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    w = __builtin_bswap64(w);
+#endif
+    return w;
+}
+#endif
+
+
 /* Assumption: we have at least one byte to work with */
 #if !LS_HPACK_EMIT_TEST_CODE
 static
@@ -1294,6 +1816,11 @@ lshpack_dec_dec_int (const unsigned char **src_p, const unsigned char *src_end,
     const unsigned char *src;
     unsigned prefix_max, M;
     uint32_t val, B;
+#if __GNUC__
+    uint64_t w, stop;
+    unsigned n;
+#endif
+    HPROF(LSHPACK_PROF_INT);
 
     src = *src_p;
 
@@ -1308,7 +1835,40 @@ lshpack_dec_dec_int (const unsigned char **src_p, const unsigned char *src_end,
         return 0;
     }
 
-    M = 0;
+    /* Most integers that do not fit the prefix fit in one more byte */
+    if (src < src_end && !(*src & 0x80))
+    {
+        *src_p = src + 1;
+        *value_p = val + *src;
+        return 0;
+    }
+
+#if __GNUC__
+    /* With eight bytes in hand, load them at once.  The first of the (at
+     * most five) continuation bytes with the high bit clear ends the
+     * integer; the 7-bit groups are then squeezed together in three steps.
+     */
+    if (src_end - orig_src >= 8)
+    {
+        w = hdec_load64(orig_src) >> 8;
+        stop = ~w & 0x8080808080ULL;
+        if (stop == 0)
+            return -2;
+        n = (__builtin_ctzll(stop) + 1) / 8;
+        w &= 0x7F7F7F7F7FULL >> (40 - n * 8);
+        w = (w & 0x007F007F007F007FULL) | ((w & 0x7F007F007F007F00ULL) >> 1);
+        w = (w & 0x00003FFF00003FFFULL) | ((w & 0x3FFF00003FFF0000ULL) >> 2);
+        w = (w & 0x000000000FFFFFFFULL) | ((w & 0x0FFFFFFF00000000ULL) >> 4);
+        w += prefix_max;
+        if (w > UINT32_MAX)
+            return -2;
+        *src_p = orig_src + 1 + n;
+        *value_p = (uint32_t) w;
+        return 0;
+    }
+#endif
+
+    M = 0;
     do
     {
         if (src < src_end)
@@ -1339,11 +1899,20 @@ static void
 hdec_drop_oldest_entry (struct lshpack_dec *dec)
 {
     struct dec_table_entry *entry;
+    HPROF(LSHPACK_PROF_EVICT);
+
     entry = (void *) lshpack_arr_shift(&dec->hpd_dyn_table);
+    /* Views are only made into entries that own their name, so dte_buf
+     * is what output->buf was set to.
+     */
+    if (dec->hpd_evict_cb)
+        dec->hpd_evict_cb(dec->hpd_evict_ctx, entry->dte_buf);
     dec->hpd_cur_capacity -= DYNAMIC_ENTRY_OVERHEAD + entry->dte_name_len
                                                         + entry->dte_val_len;
     ++dec->hpd_state;
-    free(entry);
+    HPROBE5(dec_evict, dec, hdec_entry_name(entry), entry->dte_name_len,
+                                    entry->dte_val_len, dec->hpd_cur_capacity);
+    hdec_free_entry(dec, entry);
 }
 
 
@@ -1358,6 +1927,8 @@ hdec_remove_overflow_entries (struct lshpack_dec *dec)
 static void
 hdec_update_max_capacity (struct lshpack_dec *dec, uint32_t new_capacity)
 {
+    HPROBE4(dec_update_max_capacity, dec, dec->hpd_cur_max_capacity,
+                                        new_capacity, dec->hpd_cur_capacity);
     dec->hpd_cur_max_capacity = new_capacity;
     hdec_remove_overflow_entries(dec);
 }
@@ -1405,6 +1976,7 @@ lshpack_dec_huff_decode_full (const unsigned char *src, int src_len,
     unsigned char *p_dst = dst;
     unsigned char *dst_end = dst + dst_len;
     struct decode_status status = { 0, 1 };
+    HPROF(LSHPACK_PROF_HUFF_DECODE);
 
     while (p_src != src_end)
     {
@@ -1433,416 +2005,2293 @@ lshpack_dec_huff_decode (const unsigned char *src, int src_len,
                                             unsigned char *dst, int dst_len);
 
 
-//reutrn the length in the dst, also update the src
-#if !LS_HPACK_EMIT_TEST_CODE
-static
-#endif
-       int
-hdec_dec_str (unsigned char *dst, size_t dst_len, const unsigned char **src,
-        const unsigned char *src_end)
+/* Return the decoded length of the string at `src' and advance `src' past
+ * it.  The string is validated, but not decoded.  If `raw' is set, the
+ * length of Huffman-encoded string is returned as is.
+ */
+static int
+hdec_skip_str (const unsigned char **src, const unsigned char *src_end,
+                                                                    int raw)
 {
+    int is_huffman, ret;
+    uint32_t len;
+
+    /* Empty string at the end of input, as in hdec_ingest_str() */
     if ((*src) == src_end)
         return 0;
 
-    int is_huffman = (*(*src) & 0x80);
-    uint32_t len;
+    is_huffman = (*(*src) & 0x80);
     if (0 != lshpack_dec_dec_int(src, src_end, 7, &len))
-        return LSHPACK_ERR_BAD_DATA;  //wrong int
+        return LSHPACK_ERR_BAD_DATA;
+    if ((uint32_t)(src_end - (*src)) < len)
+        return LSHPACK_ERR_BAD_DATA;
 
-    int ret = 0;
-    if ((uint32_t)(src_end - (*src)) < len) {
-        return LSHPACK_ERR_BAD_DATA;  //wrong int
+    if (is_huffman && !raw)
+    {
+        ret = lshpack_dec_huff_length(*src, len);
+        if (ret < 0)
+            return LSHPACK_ERR_BAD_DATA;
     }
+    else
+        ret = len;
 
-    if (is_huffman)
+    (*src) += len;
+    return ret;
+}
+
+
+/* Copy the string at `src' to `dst' without decoding it.  Returns the
+ * number of bytes copied or a negative value, like hdec_ingest_str() does.
+ */
+static int
+hdec_copy_str (unsigned char *dst, size_t dst_len, const unsigned char **src,
+        const unsigned char *src_end)
+{
+    uint32_t len;
+    int ret;
+
+    if (0 != lshpack_dec_dec_int(src, src_end, 7, &len))
+        return LSHPACK_ERR_BAD_DATA;
+    if ((uint32_t)(src_end - (*src)) < len)
+        return LSHPACK_ERR_BAD_DATA;
+
+    if (dst_len < len)
     {
-        ret = lshpack_dec_huff_decode(*src, len, dst, dst_len);
-        if (ret < 0)
-            return ret; //Wrong code
+        ret = dst_len - len;
+        if (ret > LSHPACK_ERR_MORE_BUF)
+            ret = LSHPACK_ERR_MORE_BUF;
+        return ret;
+    }
+
+    memcpy(dst, (*src), len);
+    (*src) += len;
+    return len;
+}
+
+
+/* String ingest kernel.  In a single pass over a literal, it can copy the
+ * bytes, calculate their XXH32 hash and check them for characters that
+ * RFC 9113, Section 8.2.1 forbids.  The hash is the same as XXH32().
+ */
+enum
+{
+    HDEC_SCAN_HASH  = 1 << 0,   /* Calculate hash */
+    HDEC_SCAN_CHECK = 1 << 1,   /* Check characters */
+    HDEC_SCAN_NAME  = 1 << 2,   /* String is a name, not a value */
+};
+
+#define XXH_PRIME32_1 2654435761U
+#define XXH_PRIME32_2 2246822519U
+#define XXH_PRIME32_3 3266489917U
+#define XXH_PRIME32_4  668265263U
+#define XXH_PRIME32_5  374761393U
+#define XXH_ROTL32(x_, r_) (((x_) << (r_)) | ((x_) >> (32 - (r_))))
+
+/* Four bytes at a time, these set the high bit of each byte that: */
+#define SWAR_ONES 0x01010101U
+/* ...is zero: */
+#define SWAR_ZERO(w_) (~((((w_) & 0x7F7F7F7FU) + 0x7F7F7F7FU) | (w_) \
+                                                            | 0x7F7F7F7FU))
+/* ...is less than n_, which is at most 0x80: */
+#define SWAR_LESS(w_, n_) (~(((w_) & 0x7F7F7F7FU)                        \
+                    + SWAR_ONES * (0x80 - (n_))) & ~(w_) & 0x80808080U)
+/* ...is not allowed in a name.  Colon is checked separately. */
+#define SWAR_BAD_NAME(w_) (SWAR_LESS(w_, 0x21)                              \
+    | (SWAR_LESS(w_, 0x5B) & ~SWAR_LESS(w_, 0x41))                          \
+    | ((w_) & 0x80808080U) | SWAR_ZERO((w_) ^ (SWAR_ONES * 0x7F)))
+/* ...is not allowed in a value: */
+#define SWAR_BAD_VALUE(w_) (SWAR_ZERO(w_)                                  \
+    | SWAR_ZERO((w_) ^ (SWAR_ONES * '\n'))                                  \
+    | SWAR_ZERO((w_) ^ (SWAR_ONES * '\r')))
+
+static uint32_t
+hdec_load32 (const unsigned char *p)
+{
+    uint32_t w;
+    memcpy(&w, p, sizeof(w));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    w = __builtin_bswap32(w);
+#endif
+    return w;
+}
+
 
-        (*src) += len;
+static int
+hdec_bad_char (unsigned char c, unsigned mode)
+{
+    if (mode & HDEC_SCAN_NAME)
+        return c <= 0x20 || (c >= 'A' && c <= 'Z') || c >= 0x7F || c == ':';
+    else
+        return c == '\0' || c == '\n' || c == '\r';
+}
+
+
+/* If `dst' is not NULL, `src' is copied to it.  DTEF_BAD_NAME or
+ * DTEF_BAD_VALUE is set in `*bad' if the string is not a valid name or
+ * value.  Returns hash of the string.
+ */
+static inline uint32_t
+#if __GNUC__
+__attribute__((always_inline))
+#endif
+hdec_scan_tmpl (unsigned char *dst, const unsigned char *src, size_t len,
+                        uint32_t seed, const unsigned mode, unsigned *bad)
+{
+    const unsigned char *p = src, *const end = src + len;
+    uint32_t v1, v2, v3, v4, h32, w, mask, colon, colon_ok;
+
+#define SCAN_WORD() do {                                                    \
+    w = hdec_load32(p);                                                     \
+    if (dst)                                                                \
+    {                                                                       \
+        memcpy(dst, p, 4);                                                  \
+        dst += 4;                                                           \
+    }                                                                       \
+    if (mode & HDEC_SCAN_CHECK)                                             \
+    {                                                                       \
+        if (mode & HDEC_SCAN_NAME)                                          \
+        {                                                                   \
+            mask |= SWAR_BAD_NAME(w);                                       \
+            colon |= SWAR_ZERO(w ^ (SWAR_ONES * ':')) & ~colon_ok;          \
+            colon_ok = 0;                                                   \
+        }                                                                   \
+        else                                                                \
+            mask |= SWAR_BAD_VALUE(w);                                      \
+    }                                                                       \
+    p += 4;                                                                 \
+} while (0)
+
+    mask = 0;
+    colon = 0;
+    /* Pseudo-header names start with a colon */
+    colon_ok = len > 0 && src[0] == ':' ? 0x80 : 0;
+
+    if (len >= 16)
+    {
+        v1 = seed + XXH_PRIME32_1 + XXH_PRIME32_2;
+        v2 = seed + XXH_PRIME32_2;
+        v3 = seed;
+        v4 = seed - XXH_PRIME32_1;
+        do
+        {
+#define XXH_ROUND(v_) do {                                                  \
+    SCAN_WORD();                                                            \
+    if (mode & HDEC_SCAN_HASH)                                              \
+    {                                                                       \
+        v_ += w * XXH_PRIME32_2;                                            \
+        v_ = XXH_ROTL32(v_, 13);                                            \
+        v_ *= XXH_PRIME32_1;                                                \
+    }                                                                       \
+} while (0)
+            XXH_ROUND(v1);
+            XXH_ROUND(v2);
+            XXH_ROUND(v3);
+            XXH_ROUND(v4);
+#undef XXH_ROUND
+        }
+        while (p + 16 <= end);
+        h32 = XXH_ROTL32(v1, 1) + XXH_ROTL32(v2, 7) + XXH_ROTL32(v3, 12)
+                                                        + XXH_ROTL32(v4, 18);
     }
     else
+        h32 = seed + XXH_PRIME32_5;
+
+    h32 += (uint32_t) len;
+
+    while (p + 4 <= end)
     {
-        if (dst_len < len)
+        SCAN_WORD();
+        if (mode & HDEC_SCAN_HASH)
         {
-            ret = dst_len - len;
-            if (ret > LSHPACK_ERR_MORE_BUF)
-                ret = LSHPACK_ERR_MORE_BUF;  //dst not enough space
+            h32 += w * XXH_PRIME32_3;
+            h32 = XXH_ROTL32(h32, 17) * XXH_PRIME32_4;
         }
-        else
+    }
+#undef SCAN_WORD
+
+    for ( ; p < end; ++p)
+    {
+        if (dst)
+            *dst++ = *p;
+        if ((mode & HDEC_SCAN_CHECK) && hdec_bad_char(*p, mode)
+                                                && !(p == src && colon_ok))
+            mask = 1;
+        if (mode & HDEC_SCAN_HASH)
         {
-            memcpy(dst, (*src), len);
-            (*src) += len;
-            ret = len;
+            h32 += *p * XXH_PRIME32_5;
+            h32 = XXH_ROTL32(h32, 11) * XXH_PRIME32_1;
         }
     }
 
-    return ret;
+    if (mode & HDEC_SCAN_CHECK)
+    {
+        if (mode & HDEC_SCAN_NAME)
+            mask |= colon | (len == 0);
+        else if (len > 0 && (src[0] == ' ' || src[0] == '\t'
+                            || src[len - 1] == ' ' || src[len - 1] == '\t'))
+            mask = 1;
+        if (mask)
+            *bad |= mode & HDEC_SCAN_NAME ? DTEF_BAD_NAME : DTEF_BAD_VALUE;
+    }
+
+    if (!(mode & HDEC_SCAN_HASH))
+        return 0;
+
+    h32 ^= h32 >> 15;
+    h32 *= XXH_PRIME32_2;
+    h32 ^= h32 >> 13;
+    h32 *= XXH_PRIME32_3;
+    h32 ^= h32 >> 16;
+    return h32;
 }
 
 
-/* hpd_dyn_table is a dynamic array.  New entries are pushed onto it,
- * while old entries are shifted from it.
+static uint32_t
+hdec_scan (unsigned char *dst, const unsigned char *src, size_t len,
+                                uint32_t seed, unsigned mode, unsigned *bad)
+{
+    switch (mode)
+    {
+    case HDEC_SCAN_HASH:
+    case HDEC_SCAN_HASH|HDEC_SCAN_NAME:
+        return hdec_scan_tmpl(dst, src, len, seed, HDEC_SCAN_HASH, bad);
+    case HDEC_SCAN_CHECK:
+        return hdec_scan_tmpl(dst, src, len, seed, HDEC_SCAN_CHECK, bad);
+    case HDEC_SCAN_CHECK|HDEC_SCAN_NAME:
+        return hdec_scan_tmpl(dst, src, len, seed,
+                                    HDEC_SCAN_CHECK|HDEC_SCAN_NAME, bad);
+    case HDEC_SCAN_HASH|HDEC_SCAN_CHECK:
+        return hdec_scan_tmpl(dst, src, len, seed,
+                                    HDEC_SCAN_HASH|HDEC_SCAN_CHECK, bad);
+    case HDEC_SCAN_HASH|HDEC_SCAN_CHECK|HDEC_SCAN_NAME:
+        return hdec_scan_tmpl(dst, src, len, seed,
+                    HDEC_SCAN_HASH|HDEC_SCAN_CHECK|HDEC_SCAN_NAME, bad);
+    default:
+        if (dst)
+            memcpy(dst, src, len);
+        return 0;
+    }
+}
+
+
+/* Decode string at `*src' into `dst', hash and check it as `mode' specifies.
+ * Raw strings are copied, hashed and checked in one pass; Huffman-encoded
+ * strings are hashed and checked right after they are decoded, while the
+ * output is still in cache.  Returns the length in `dst' and advances `*src'
+ * or returns a negative error code.
  */
-static struct dec_table_entry *
-hdec_get_table_entry (struct lshpack_dec *dec, uint32_t index)
+static int
+hdec_ingest_str (unsigned char *dst, size_t dst_len, const unsigned char **src,
+        const unsigned char *src_end, unsigned mode, uint32_t seed,
+        uint32_t *hash, unsigned *bad)
 {
-    uintptr_t val;
+    int is_huffman, ret;
+    uint32_t len;
 
-    index -= HPACK_STATIC_TABLE_SIZE;
-    if (index == 0 || index > lshpack_arr_count(&dec->hpd_dyn_table))
-        return NULL;
+    if ((*src) == src_end)
+    {
+        *hash = hdec_scan(NULL, dst, 0, seed, mode, bad);
+        return 0;
+    }
 
-    index = lshpack_arr_count(&dec->hpd_dyn_table) - index;
-    val = lshpack_arr_get(&dec->hpd_dyn_table, index);
-    return (struct dec_table_entry *) val;
+    is_huffman = (*(*src) & 0x80);
+    if (0 != lshpack_dec_dec_int(src, src_end, 7, &len))
+        return LSHPACK_ERR_BAD_DATA;
+    if ((uint32_t)(src_end - (*src)) < len)
+        return LSHPACK_ERR_BAD_DATA;
+
+    if (is_huffman)
+    {
+        ret = lshpack_dec_huff_decode(*src, len, dst, dst_len);
+        if (ret < 0)
+            return ret;
+        *hash = hdec_scan(NULL, dst, ret, seed, mode, bad);
+    }
+    else
+    {
+        if (dst_len < len)
+        {
+            ret = dst_len - len;
+            if (ret > LSHPACK_ERR_MORE_BUF)
+                ret = LSHPACK_ERR_MORE_BUF;
+            return ret;
+        }
+        *hash = hdec_scan(dst, *src, len, seed, mode, bad);
+        ret = len;
+    }
+
+    (*src) += len;
+    return ret;
 }
 
 
-#if !LS_HPACK_EMIT_TEST_CODE
-static
-#endif
-       int
-lshpack_dec_push_entry (struct lshpack_dec *dec,
-                                        const struct lsxpack_header *xhdr)
+/* Called when the output buffer is too small: decode Huffman-encoded
+ * literals starting at `src' into the resume buffer.  If `lazy_val' is set,
+ * the value is not decoded.  Returns 0 or a negative error code.
+ */
+static int
+hdec_resume_save (struct lshpack_dec *dec, const unsigned char *src,
+        const unsigned char *src_end, int n_lits, int lazy_val)
 {
-    struct dec_table_entry *entry;
-    unsigned name_len, val_len;
-    size_t size;
+    const unsigned char *end;
+    unsigned char *out;
+    unsigned char *new_buf;
+    size_t enc_len, need;
+    uint32_t len;
+    int i, is_huffman, ret;
 
-    name_len = xhdr->name_len;
-    val_len = xhdr->val_len;
+    dec->hpd_resume.src = NULL;
+    end = src;
+    for (i = 0; i < n_lits; ++i)
+        if (hdec_skip_str(&end, src_end, 1) < 0)
+            return LSHPACK_ERR_BAD_DATA;
+    enc_len = end - src;
 
-    size = sizeof(*entry) + name_len + val_len;
-    entry = malloc(size);
-    if (!entry)
-        return -1;
+    /* The shortest Huffman code is five bits long */
+    need = enc_len + enc_len * 8 / 5 + 1;
+    if (need > dec->hpd_resume.nalloc)
+    {
+        new_buf = realloc(dec->hpd_resume.buf, need);
+        if (!new_buf)
+            return LSHPACK_ERR_BAD_DATA;
+        dec->hpd_resume.buf = new_buf;
+        dec->hpd_resume.nalloc = need;
+    }
+    memcpy(dec->hpd_resume.buf, src, enc_len);
+    out = dec->hpd_resume.buf + enc_len;
 
-    if (0 != lshpack_arr_push(&dec->hpd_dyn_table, (uintptr_t) entry))
+    dec->hpd_resume.name_len = -1;
+    dec->hpd_resume.val_len = -1;
+    dec->hpd_resume.lit_len = 0;
+    for (i = 0; i < n_lits && src < src_end; ++i)
     {
-        free(entry);
-        return -1;
+        is_huffman = (*src & 0x80) && !(lazy_val && i == n_lits - 1);
+        if (0 != lshpack_dec_dec_int(&src, src_end, 7, &len))
+            return LSHPACK_ERR_BAD_DATA;
+        if (is_huffman)
+        {
+            ret = lshpack_dec_huff_decode(src, len, out,
+                            dec->hpd_resume.buf + need - out);
+            if (ret < 0)
+                return LSHPACK_ERR_BAD_DATA;
+            if (i == n_lits - 1)
+                dec->hpd_resume.val_len = ret;
+            else
+                dec->hpd_resume.name_len = ret;
+            out += ret;
+        }
+        else
+            ret = len;
+        dec->hpd_resume.lit_len += ret;
+        src += len;
     }
-    ++dec->hpd_state;
-    dec->hpd_cur_capacity += DYNAMIC_ENTRY_OVERHEAD + name_len + val_len;
-    entry->dte_name_len = name_len;
-    entry->dte_val_len = val_len;
-    entry->dte_name_idx = xhdr->hpack_index;
-#if LSHPACK_DEC_CALC_HASH
-    entry->dte_flags = xhdr->flags & (LSXPACK_NAME_HASH|LSXPACK_NAMEVAL_HASH);
-    entry->dte_name_hash = xhdr->name_hash;
-    entry->dte_nameval_hash = xhdr->nameval_hash;
-#endif
-    memcpy(DTE_NAME(entry), lsxpack_header_get_name(xhdr), name_len);
-    memcpy(DTE_VALUE(entry), lsxpack_header_get_value(xhdr), val_len);
+
+    dec->hpd_resume.enc_len = enc_len;
     return 0;
 }
 
 
+/* Copy string saved by hdec_resume_save() and advance `src' past its
+ * encoded form.  Returns values like hdec_ingest_str() does.
+ */
 static int
-lshpack_dec_copy_value (lsxpack_header_t *output, char *dest, const char *val,
-                       unsigned val_len)
+hdec_resume_copy (unsigned char *dst, size_t dst_len,
+        const unsigned char **src, const unsigned char *src_end,
+        const unsigned char *saved, int saved_len)
 {
-    if (val_len + LSHPACK_DEC_HTTP1X_EXTRA > (unsigned)output->val_len)
+    if (dst_len < (unsigned) saved_len)
         return LSHPACK_ERR_MORE_BUF;
-    output->val_offset = output->name_offset + output->name_len
-                         + LSHPACK_DEC_HTTP1X_EXTRA;
-
-    assert(dest == output->buf + output->val_offset);
-    output->val_len = val_len;
-    memcpy(dest, val, output->val_len);
-    dest += output->val_len;
-#if LSHPACK_DEC_HTTP1X_OUTPUT
-    *dest++ = '\r';
-    *dest++ = '\n';
-#endif
-    return 0;
+    memcpy(dst, saved, saved_len);
+    (void) hdec_skip_str(src, src_end, 1);
+    return saved_len;
 }
 
 
-static int
-lshpack_dec_copy_name (lsxpack_header_t *output, char **dest, const char *name,
-                       unsigned name_len)
+/* Slot of a name in the registry's perfect hash table */
+#define APP_REG_SLOT(reg_, hash_) \
+            ((uint32_t) ((hash_) * (reg_)->ar_mult) >> (32 - (reg_)->ar_nbits))
+
+
+static unsigned
+app_reg_find (const struct lshpack_app_reg *reg, const char *name,
+                                        unsigned name_len, uint32_t name_hash)
 {
-    if (name_len + LSHPACK_DEC_HTTP1X_EXTRA > (unsigned)output->val_len)
-        return LSHPACK_ERR_MORE_BUF;
-    output->val_len -= name_len + LSHPACK_DEC_HTTP1X_EXTRA;
-    output->name_len = name_len;
-    memcpy(*dest, name, name_len);
-    *dest += name_len;
-#if LSHPACK_DEC_HTTP1X_OUTPUT
-    *(*dest)++ = ':';
-    *(*dest)++ = ' ';
-#endif
+    const struct lshpack_app_name *app_name;
+    unsigned app_index;
+
+    app_index = reg->ar_slots[ APP_REG_SLOT(reg, name_hash) ];
+    if (app_index == 0)
+        return 0;
+    app_name = &reg->ar_names[app_index - 1];
+    if (app_name->an_name_hash == name_hash
+            && app_name->an_name_len == name_len
+            && 0 == memcmp(app_name->an_name, name, name_len))
+        return app_index;
     return 0;
 }
 
 
-enum
+/* Look for a multiplier that maps all names to different slots.  The table
+ * is made larger until one is found.
+ */
+static int
+app_reg_build_slots (struct lshpack_app_reg *reg)
 {
-    LSHPACK_ADD_INDEX = 0,
-    LSHPACK_NO_INDEX  = 1,
-    LSHPACK_NEVER_INDEX = 2,
-    LSHPACK_VAL_INDEX = 3,
-};
+    uint8_t *slots;
+    uint32_t mult;
+    unsigned nbits, n, try, slot;
+
+    for (nbits = 1; (1u << nbits) < reg->ar_count * 2; ++nbits)
+        ;
+    for ( ; nbits <= 16; ++nbits)
+    {
+        slots = malloc(1u << nbits);
+        if (!slots)
+            return -1;
+        reg->ar_nbits = nbits;
+        mult = 0x9E3779B1;
+        for (try = 0; try < 256; ++try)
+        {
+            reg->ar_mult = mult;
+            memset(slots, 0, 1u << nbits);
+            for (n = 0; n < reg->ar_count; ++n)
+            {
+                slot = APP_REG_SLOT(reg, reg->ar_names[n].an_name_hash);
+                if (slots[slot])
+                    break;
+                slots[slot] = n + 1;
+            }
+            if (n == reg->ar_count)
+            {
+                reg->ar_slots = slots;
+                return 0;
+            }
+            mult = (mult * 1103515245 + 12345) | 1;
+        }
+        free(slots);
+    }
+
+    return -1;
+}
 
 
 int
-lshpack_dec_decode (struct lshpack_dec *dec,
-    const unsigned char **src, const unsigned char *src_end,
-    struct lsxpack_header *output)
+lshpack_app_reg_init (struct lshpack_app_reg *reg, const char *const *names,
+                                                            unsigned n_names)
 {
-    struct dec_table_entry *entry;
-    uint32_t index, new_capacity;
-    int indexed_type, len;
-    const unsigned char *s;
-    size_t buf_len = output->val_len;
-    size_t extra_buf = 0;
+    struct lshpack_app_name *app_name;
+    size_t size;
+    unsigned n, i, n_static;
+    char *p;
 
-    if ((*src) == src_end)
-        return LSHPACK_ERR_BAD_DATA;
+    memset(reg, 0, sizeof(*reg));
+    if (n_names > UINT8_MAX)
+        return -1;
 
-    buf_len = output->val_len;
-    extra_buf = 0;
-    s = *src;
-    while ((*s & 0xe0) == 0x20)    //001 xxxxx
-    {
-        if (0 != lshpack_dec_dec_int(&s, src_end, 5, &new_capacity))
-            return LSHPACK_ERR_BAD_DATA;
-        if (new_capacity > dec->hpd_max_capacity)
-            return LSHPACK_ERR_BAD_DATA;
-        hdec_update_max_capacity(dec, new_capacity);
-        if (s == src_end)
-            return LSHPACK_ERR_BAD_DATA;
-    }
+    size = sizeof(reg->ar_names[0]) * n_names;
+    for (n = 0; n < n_names; ++n)
+        size += strlen(names[n]);
+    reg->ar_names = malloc(size ? size : 1);
+    if (!reg->ar_names)
+        return -1;
+    reg->ar_count = n_names;
 
-    /* lshpack_dec_dec_int() sets `index' and advances `src'.  If we do not
-     * call it, we set `index' and advance `src' ourselves:
-     */
-    if (*s & 0x80) //1 xxxxxxx
+    p = (char *) (reg->ar_names + n_names);
+    for (n = 0; n < n_names; ++n)
     {
-        if (0 != lshpack_dec_dec_int(&s, src_end, 7, &index))
-            return LSHPACK_ERR_BAD_DATA;
-        if (index == 0)
-            return LSHPACK_ERR_BAD_DATA;
-        indexed_type = LSHPACK_VAL_INDEX; //need to parse value
+        app_name = &reg->ar_names[n];
+        app_name->an_name_len = strlen(names[n]);
+        app_name->an_name = memcpy(p, names[n], app_name->an_name_len);
+        p += app_name->an_name_len;
+        app_name->an_name_hash = XXH32(app_name->an_name,
+                                app_name->an_name_len, LSHPACK_XXH_SEED);
+        app_name->an_hpack_index = 0;
+        n_static = 0;
+        for (i = 0; i < HPACK_STATIC_TABLE_SIZE; ++i)
+            if (static_table[i].name_len == app_name->an_name_len
+                    && 0 == memcmp(static_table[i].name, app_name->an_name,
+                                                    app_name->an_name_len))
+            {
+                reg->ar_static[i] = n + 1;
+                if (n_static++ == 0)
+                    app_name->an_hpack_index = i + 1;
+                else
+                    app_name->an_hpack_index = 0;
+            }
     }
-    else if (*s > 0x40) //01 xxxxxx
-    {
-        if (0 != lshpack_dec_dec_int(&s, src_end, 6, &index))
+
+    for (n = 0; n < n_names; ++n)
+        for (i = 0; i < n; ++i)
+            if (reg->ar_names[i].an_name_len == reg->ar_names[n].an_name_len
+                    && 0 == memcmp(reg->ar_names[i].an_name,
+                        reg->ar_names[n].an_name, reg->ar_names[n].an_name_len))
+                goto err;
+
+    if (0 != app_reg_build_slots(reg))
+        goto err;
+
+    return 0;
+
+  err:
+    lshpack_app_reg_cleanup(reg);
+    return -1;
+}
+
+
+void
+lshpack_app_reg_cleanup (struct lshpack_app_reg *reg)
+{
+    free(reg->ar_names);
+    free(reg->ar_slots);
+    memset(reg, 0, sizeof(*reg));
+}
+
+
+unsigned
+lshpack_app_reg_lookup (const struct lshpack_app_reg *reg, const char *name,
+                                                            unsigned name_len)
+{
+    if (reg->ar_count == 0)
+        return 0;
+    return app_reg_find(reg, name, name_len,
+                                XXH32(name, name_len, LSHPACK_XXH_SEED));
+}
+
+
+/* Until LSXPACK_NAMEVAL_HASH is set, nameval_hash of a header decoded from
+ * a dynamic table entry holds the entry ID instead, so that hashes computed
+ * by lshpack_dec_calc_hash() can be cached in the entry.
+ */
+#define HDEC_NAMEVAL_HASH(entry_) ((entry_)->dte_flags & DTEF_NAMEVAL_HASH \
+                    ? (entry_)->dte_nameval_hash : (entry_)->dte_id)
+
+
+/* Entries are numbered in the order they are added, so the entry with
+ * a given ID is found by its distance from the newest one.
+ */
+static struct dec_table_entry *
+hdec_get_entry_by_id (struct lshpack_dec *dec, uint32_t id)
+{
+    struct dec_table_entry *entry;
+    unsigned count;
+    uint32_t age;
+
+    count = lshpack_arr_count(&dec->hpd_dyn_table);
+    age = dec->hpd_ins_count - id;
+    if (id == 0 || age >= count)
+        return NULL;
+
+    entry = (void *) lshpack_arr_get(&dec->hpd_dyn_table, count - 1 - age);
+    if (entry->dte_id != id)
+        return NULL;
+    return entry;
+}
+
+
+/* Set app_index once the name of the header is known.  `entry' is the
+ * dynamic table entry the name comes from, if any.
+ */
+static void
+hdec_set_app_index (const struct lshpack_app_reg *reg,
+                    struct lsxpack_header *output, uint32_t index,
+                    const struct dec_table_entry *entry)
+{
+    if (index == 0)
+    {
+        if (!(output->flags & LSXPACK_NAME_HASH))
+        {
+            output->name_hash = XXH32(lsxpack_header_get_name(output),
+                                        output->name_len, LSHPACK_XXH_SEED);
+            output->flags |= LSXPACK_NAME_HASH;
+        }
+        output->app_index = app_reg_find(reg,
+                                    lsxpack_header_get_name(output),
+                                    output->name_len, output->name_hash);
+    }
+    else if (index <= HPACK_STATIC_TABLE_SIZE)
+        output->app_index = reg->ar_static[index - 1];
+    else
+        output->app_index = entry->dte_app_idx;
+
+    if (output->app_index)
+        output->flags |= LSXPACK_APP_IDX;
+}
+
+
+/* hpd_dyn_table is a dynamic array.  New entries are pushed onto it,
+ * while old entries are shifted from it.
+ */
+static struct dec_table_entry *
+hdec_get_table_entry (struct lshpack_dec *dec, uint32_t index)
+{
+    uintptr_t val;
+
+    index -= HPACK_STATIC_TABLE_SIZE;
+    if (index == 0 || index > lshpack_arr_count(&dec->hpd_dyn_table))
+        return NULL;
+
+    index = lshpack_arr_count(&dec->hpd_dyn_table) - index;
+    val = lshpack_arr_get(&dec->hpd_dyn_table, index);
+    return (struct dec_table_entry *) val;
+}
+
+
+/* Unless views are used, the name is not copied if it is in the static
+ * table or if the header refers to the name of entry `name_src'.  Views
+ * need the name and the value next to each other.
+ *
+ * An entry whose name is pointed at outlives its eviction, value and all.
+ * To keep that in check, only names long enough to save some memory and
+ * owned by entries in the newer half of the table are pointed at.
+ */
+static int
+hdec_push_entry (struct lshpack_dec *dec, const struct lsxpack_header *xhdr,
+                                            struct dec_table_entry *name_src)
+{
+    struct dec_table_entry *entry, *owner;
+    unsigned name_len, val_len, flags;
+    size_t size;
+    HPROF(LSHPACK_PROF_PUSH);
+
+    name_len = xhdr->name_len;
+    val_len = xhdr->val_len;
+
+    owner = NULL;
+    flags = 0;
+    size = sizeof(*entry) + name_len + val_len;
+    if (!(dec->hpd_flags & LSHPACK_DEC_VIEWS))
+    {
+        if (xhdr->hpack_index != LSHPACK_HDR_UNKNOWN
+            && xhdr->hpack_index <= HPACK_STATIC_TABLE_SIZE
+            && name_len == static_table[xhdr->hpack_index - 1].name_len
+            && 0 == memcmp(lsxpack_header_get_name(xhdr),
+                        static_table[xhdr->hpack_index - 1].name, name_len))
+        {
+            flags = DTEF_NAME_STATIC;
+            size = sizeof(*entry) + val_len;
+        }
+        else if (name_src && name_len >= 2 * sizeof(owner))
+        {
+            owner = name_src->dte_flags & DTEF_NAME_REF
+                                    ? hdec_name_owner(name_src) : name_src;
+            if (!(owner->dte_flags & (DTEF_EVICTED|DTEF_NAME_STATIC))
+                    && owner->dte_nrefs < UINT8_MAX
+                    && dec->hpd_ins_count - owner->dte_id
+                            < lshpack_arr_count(&dec->hpd_dyn_table) / 2)
+            {
+                flags = DTEF_NAME_REF;
+                size = sizeof(*entry) + sizeof(owner) + val_len;
+            }
+            else
+                owner = NULL;
+        }
+    }
+
+    entry = malloc(size);
+    if (!entry)
+        return -1;
+
+    if (0 != lshpack_arr_push(&dec->hpd_dyn_table, (uintptr_t) entry))
+    {
+        free(entry);
+        return -1;
+    }
+    ++dec->hpd_state;
+    dec->hpd_cur_capacity += DYNAMIC_ENTRY_OVERHEAD + name_len + val_len;
+    dec->hpd_entries_size += size;
+    entry->dte_name_len = name_len;
+    entry->dte_val_len = val_len;
+    entry->dte_name_idx = xhdr->hpack_index;
+    entry->dte_app_idx = xhdr->flags & LSXPACK_APP_IDX ? xhdr->app_index : 0;
+    entry->dte_flags = flags
+                    | (xhdr->flags & (LSXPACK_NAME_HASH|LSXPACK_NAMEVAL_HASH));
+    entry->dte_nrefs = 0;
+    entry->dte_name_hash = xhdr->name_hash;
+    entry->dte_nameval_hash = xhdr->nameval_hash;
+    if (++dec->hpd_ins_count == 0)
+        ++dec->hpd_ins_count;
+    entry->dte_id = dec->hpd_ins_count;
+    if (owner)
+    {
+        ++owner->dte_nrefs;
+        memcpy(entry->dte_buf, &owner, sizeof(owner));
+    }
+    else if (!(flags & DTEF_NAME_STATIC))
+        memcpy(entry->dte_buf, lsxpack_header_get_name(xhdr), name_len);
+    memcpy(DTE_VALUE(entry), lsxpack_header_get_value(xhdr), val_len);
+    HPROBE5(dec_push, dec, hdec_entry_name(entry), name_len, val_len,
+                                                    dec->hpd_cur_capacity);
+    hdec_remove_overflow_entries(dec);
+    return 0;
+}
+
+
+#if LS_HPACK_EMIT_TEST_CODE
+int
+lshpack_dec_push_entry (struct lshpack_dec *dec,
+                                        const struct lsxpack_header *xhdr)
+{
+    return hdec_push_entry(dec, xhdr, NULL);
+}
+#endif
+
+
+/* Number of bytes added after name and after value in HTTP/1.x mode */
+#define HTTP1X_EXTRA(http1x_) ((http1x_) ? 2 : 0)
+
+
+static int
+lshpack_dec_copy_value (lsxpack_header_t *output, char *dest, const char *val,
+                       unsigned val_len, const int http1x)
+{
+    if (val_len + HTTP1X_EXTRA(http1x) > (unsigned)output->val_len)
+        return LSHPACK_ERR_MORE_BUF;
+    output->val_offset = output->name_offset + output->name_len
+                         + HTTP1X_EXTRA(http1x);
+
+    assert(dest == output->buf + output->val_offset);
+    output->val_len = val_len;
+    memcpy(dest, val, output->val_len);
+    dest += output->val_len;
+    if (http1x)
+    {
+        *dest++ = '\r';
+        *dest++ = '\n';
+    }
+    return 0;
+}
+
+
+static int
+lshpack_dec_copy_name (lsxpack_header_t *output, char **dest, const char *name,
+                       unsigned name_len, const int http1x)
+{
+    if (name_len + HTTP1X_EXTRA(http1x) > (unsigned)output->val_len)
+        return LSHPACK_ERR_MORE_BUF;
+    output->val_len -= name_len + HTTP1X_EXTRA(http1x);
+    output->name_len = name_len;
+    memcpy(*dest, name, name_len);
+    *dest += name_len;
+    if (http1x)
+    {
+        *(*dest)++ = ':';
+        *(*dest)++ = ' ';
+    }
+    return 0;
+}
+
+
+enum
+{
+    LSHPACK_ADD_INDEX = 0,
+    LSHPACK_NO_INDEX  = 1,
+    LSHPACK_NEVER_INDEX = 2,
+    LSHPACK_VAL_INDEX = 3,
+    /* Only in hdec_ops[] below: */
+    HDEC_OP_SIZE_UPDATE,
+    HDEC_OP_BAD,
+};
+
+
+/* What the first byte of a representation says about it */
+struct hdec_op
+{
+    unsigned char   type;           /* One of the enum values above */
+    unsigned char   prefix_bits;    /* Of the integer that starts here */
+    unsigned char   n_lits;         /* Number of string literals that follow */
+};
+
+#define HOP_NO0 { LSHPACK_NO_INDEX,    4, 2, }  /* 0000 0000 */
+#define HOP_NO1 { LSHPACK_NO_INDEX,    4, 1, }  /* 0000 xxxx */
+#define HOP_NV0 { LSHPACK_NEVER_INDEX, 4, 2, }  /* 0001 0000 */
+#define HOP_NV1 { LSHPACK_NEVER_INDEX, 4, 1, }  /* 0001 xxxx */
+#define HOP_SZU { HDEC_OP_SIZE_UPDATE, 5, 0, }  /* 001x xxxx */
+#define HOP_AD0 { LSHPACK_ADD_INDEX,   6, 2, }  /* 0100 0000 */
+#define HOP_AD1 { LSHPACK_ADD_INDEX,   6, 1, }  /* 01xx xxxx */
+#define HOP_BAD { HDEC_OP_BAD,         7, 0, }  /* 1000 0000: index 0 */
+#define HOP_IDX { LSHPACK_VAL_INDEX,   7, 0, }  /* 1xxx xxxx */
+#define HOP_x15(op_) op_, op_, op_, op_, op_, op_, op_, op_, op_, op_, op_,  \
+                                                        op_, op_, op_, op_
+#define HOP_x16(op_) op_, op_, op_, op_, op_, op_, op_, op_, op_, op_, op_,  \
+                                                    op_, op_, op_, op_, op_
+
+static const struct hdec_op hdec_ops[0x100] =
+{
+    HOP_NO0, HOP_x15(HOP_NO1),  /* 0x00 */
+    HOP_NV0, HOP_x15(HOP_NV1),  /* 0x10 */
+    HOP_x16(HOP_SZU),           /* 0x20 */
+    HOP_x16(HOP_SZU),           /* 0x30 */
+    HOP_AD0, HOP_x15(HOP_AD1),  /* 0x40 */
+    HOP_x16(HOP_AD1),           /* 0x50 */
+    HOP_x16(HOP_AD1),           /* 0x60 */
+    HOP_x16(HOP_AD1),           /* 0x70 */
+    HOP_BAD, HOP_x15(HOP_IDX),  /* 0x80 */
+    HOP_x16(HOP_IDX),           /* 0x90 */
+    HOP_x16(HOP_IDX),           /* 0xA0 */
+    HOP_x16(HOP_IDX),           /* 0xB0 */
+    HOP_x16(HOP_IDX),           /* 0xC0 */
+    HOP_x16(HOP_IDX),           /* 0xD0 */
+    HOP_x16(HOP_IDX),           /* 0xE0 */
+    HOP_x16(HOP_IDX),           /* 0xF0 */
+};
+
+
+/* Record validation result in the entry just added to the dynamic table,
+ * so that headers that refer to it later are malformed, too.
+ */
+static void
+hdec_mark_bad (struct lshpack_dec *dec, unsigned bad)
+{
+    struct dec_table_entry *entry;
+
+    entry = hdec_get_entry_by_id(dec, dec->hpd_ins_count);
+    if (entry)
+        entry->dte_flags |= bad;
+}
+
+
+/* In view mode, point `output' directly at the name and value if they are
+ * contiguous: in the static table, in a dynamic table entry, or in the
+ * input when neither string is Huffman-encoded.  Returns 1 if the view was
+ * set up, 0 if the header has to be copied, or a negative error code.
+ */
+static int
+hdec_make_view (struct lshpack_dec *dec, struct lsxpack_header *output,
+                uint32_t index, int indexed_type,
+                const unsigned char **src, const unsigned char *src_end,
+                const int calc_hash, unsigned mode, unsigned *bad)
+{
+    struct dec_table_entry *entry;
+    const unsigned char *s, *name, *val;
+    uint32_t name_len, val_len, name_hash, val_hash;
+
+    if (indexed_type == LSHPACK_VAL_INDEX)
+    {
+        if (index <= HPACK_STATIC_TABLE_SIZE)
+        {
+            output->buf = (char *) static_table[index - 1].name_val;
+            output->name_len = static_table[index - 1].name_len;
+            output->val_len = static_table[index - 1].val_len;
+            output->flags |= LSXPACK_NAME_HASH | LSXPACK_NAMEVAL_HASH;
+            output->name_hash = static_table_name_hash[index - 1];
+            output->nameval_hash = static_table_nameval_hash[index - 1];
+            entry = NULL;
+        }
+        else
+        {
+            entry = hdec_get_table_entry(dec, index);
+            if (entry == NULL)
+                return LSHPACK_ERR_BAD_DATA;
+            if (entry->dte_flags & (DTEF_NAME_STATIC|DTEF_NAME_REF))
+                return 0;
+            output->buf = entry->dte_buf;
+            output->name_len = entry->dte_name_len;
+            output->val_len = entry->dte_val_len;
+            output->hpack_index = entry->dte_name_idx;
+            output->flags |= entry->dte_flags
+                                    & (DTEF_NAME_HASH|DTEF_NAMEVAL_HASH);
+            *bad |= entry->dte_flags & (DTEF_BAD_NAME|DTEF_BAD_VALUE);
+            output->name_hash = entry->dte_name_hash;
+            output->nameval_hash = HDEC_NAMEVAL_HASH(entry);
+        }
+        output->name_offset = 0;
+        output->val_offset = output->name_len;
+        if (dec->hpd_app_reg)
+            hdec_set_app_index(dec->hpd_app_reg, output, index, entry);
+        return 1;
+    }
+
+    if (index != 0)
+        return 0;
+
+    s = *src;
+    if (s == src_end || (*s & 0x80))
+        return 0;
+    if (0 != lshpack_dec_dec_int(&s, src_end, 7, &name_len))
+        return LSHPACK_ERR_BAD_DATA;
+    if ((uint32_t)(src_end - s) < name_len)
+        return LSHPACK_ERR_BAD_DATA;
+    name = s;
+    s += name_len;
+    if (s == src_end || (*s & 0x80))
+        return 0;
+    if (0 != lshpack_dec_dec_int(&s, src_end, 7, &val_len))
+        return LSHPACK_ERR_BAD_DATA;
+    if ((uint32_t)(src_end - s) < val_len)
+        return LSHPACK_ERR_BAD_DATA;
+    val = s;
+    s += val_len;
+    if (val - name > LSHPACK_MAX_STRLEN || val_len > LSHPACK_MAX_STRLEN)
+        return 0;
+
+    output->buf = (char *) name;
+    output->name_offset = 0;
+    output->name_len = name_len;
+    output->val_offset = val - name;
+    output->val_len = val_len;
+    name_hash = hdec_scan(NULL, name, name_len, LSHPACK_XXH_SEED,
+                                                mode | HDEC_SCAN_NAME, bad);
+    val_hash = hdec_scan(NULL, val, val_len, name_hash, mode, bad);
+    if (calc_hash)
+    {
+        output->flags |= LSXPACK_NAME_HASH | LSXPACK_NAMEVAL_HASH;
+        output->name_hash = name_hash;
+        output->nameval_hash = val_hash;
+    }
+    if (dec->hpd_app_reg)
+        hdec_set_app_index(dec->hpd_app_reg, output, 0, NULL);
+    if (indexed_type == LSHPACK_ADD_INDEX)
+    {
+        if (0 != hdec_push_entry(dec, output, NULL))
             return LSHPACK_ERR_BAD_DATA;
+        if (!(output->flags & LSXPACK_NAMEVAL_HASH))
+            output->nameval_hash = dec->hpd_ins_count;
+        if (*bad)
+            hdec_mark_bad(dec, *bad);
+    }
+    *src = s;
+    return 1;
+}
+
+
+/* The ratio limit is not enforced for smaller header lists */
+#define HDEC_RATIO_MIN_SIZE 4096
+
+static int
+hdec_over_limits (const struct lshpack_dec *dec, size_t list_size,
+                                        unsigned n_headers, size_t in_bytes)
+{
+    return (dec->hpd_limits.max_headers
+                && n_headers > dec->hpd_limits.max_headers)
+        || (dec->hpd_limits.max_list_size
+                && list_size > dec->hpd_limits.max_list_size)
+        || (dec->hpd_limits.max_ratio && list_size > HDEC_RATIO_MIN_SIZE
+                && list_size > (uint64_t) dec->hpd_limits.max_ratio
+                                                                * in_bytes);
+}
+
 
-        indexed_type = LSHPACK_ADD_INDEX;
+/* Check the header against the limits using string lengths only, before
+ * any string is decoded.  A Huffman-encoded string decodes to at least 8/30
+ * of its length.  On success, `*end' is set to the end of the
+ * representation and `*min_size' to the smallest size the header can have.
+ * Returns 0 or -1 if it cannot be parsed; the decoder proper will report
+ * the error then.
+ */
+static int
+hdec_check_limits (struct lshpack_dec *dec, const unsigned char *start,
+        const unsigned char *s, const unsigned char *src_end, uint32_t index,
+        int indexed_type, const unsigned char **end, size_t *min_size)
+{
+    struct dec_table_entry *entry;
+    size_t size;
+    int n_lits, is_huffman, len;
+
+    size = DYNAMIC_ENTRY_OVERHEAD;
+    n_lits = indexed_type != LSHPACK_VAL_INDEX;
+    if (index == 0)
+        ++n_lits;
+    else if (index <= HPACK_STATIC_TABLE_SIZE)
+    {
+        size += static_table[index - 1].name_len;
+        if (indexed_type == LSHPACK_VAL_INDEX)
+            size += static_table[index - 1].val_len;
     }
-    else if (*s == 0x40) //custmized //0100 0000
+    else
     {
-        indexed_type = LSHPACK_ADD_INDEX;
-        index = LSHPACK_HDR_UNKNOWN;
-        ++s;
+        entry = hdec_get_table_entry(dec, index);
+        if (entry == NULL)
+            return -1;
+        size += entry->dte_name_len;
+        if (indexed_type == LSHPACK_VAL_INDEX)
+            size += entry->dte_val_len;
     }
 
-    //Never indexed
-    else if (*s == 0x10)  //00010000
+    while (n_lits-- > 0)
     {
-        indexed_type = LSHPACK_NEVER_INDEX;
-        output->flags |= LSXPACK_NEVER_INDEX;
-        index = LSHPACK_HDR_UNKNOWN;
-        ++s;
+        is_huffman = s < src_end && (*s & 0x80);
+        len = hdec_skip_str(&s, src_end, 1);
+        if (len < 0)
+            return -1;
+        size += is_huffman ? (size_t) len * 8 / 30 : (size_t) len;
     }
-    else if ((*s & 0xf0) == 0x10)  //0001 xxxx
+
+    *end = s;
+    *min_size = size;
+    if (hdec_over_limits(dec, dec->hpd_limits.list_size + size,
+                        dec->hpd_limits.n_headers + 1,
+                        dec->hpd_limits.in_bytes + (s - start)))
+        dec->hpd_limits.exceeded = 1;
+    return 0;
+}
+
+
+/* The decoder proper.  `http1x' and `calc_hash' are constants in each of
+ * the variants below, so that the compiler removes the checks.
+ */
+static inline int
+#if __GNUC__
+__attribute__((always_inline))
+#endif
+hdec_decode (struct lshpack_dec *dec,
+    const unsigned char **src, const unsigned char *src_end,
+    struct lsxpack_header *output, const int http1x, const int calc_hash)
+{
+    struct dec_table_entry *entry = NULL;
+    const struct hdec_op *op;
+    uint32_t index, new_capacity;
+    int indexed_type, len;
+    const unsigned char *s, *lit_src, *lim_end;
+    unsigned char *saved;
+    size_t size, lim_size;
+    int lazy_val, resume, n_lits;
+    unsigned mode, bad;
+    uint32_t hash;
+    HPROF(LSHPACK_PROF_DECODE);
+
+    if ((*src) == src_end)
+        return LSHPACK_ERR_BAD_DATA;
+
+    s = *src;
+    while (hdec_ops[*s].type == HDEC_OP_SIZE_UPDATE)
     {
-        if (0 != lshpack_dec_dec_int(&s, src_end, 4, &index))
+        if (0 != lshpack_dec_dec_int(&s, src_end, 5, &new_capacity))
+            return LSHPACK_ERR_BAD_DATA;
+        if (new_capacity > dec->hpd_max_capacity)
             return LSHPACK_ERR_BAD_DATA;
+        hdec_update_max_capacity(dec, new_capacity);
+        if (s == src_end)
+            return LSHPACK_ERR_BAD_DATA;
+    }
 
-        indexed_type = LSHPACK_NEVER_INDEX;
+    /* The first byte gives the representation type and the width of the
+     * integer prefix.  The integer is the index; for literals with a new
+     * name it is zero, which is LSHPACK_HDR_UNKNOWN.
+     */
+    op = &hdec_ops[*s];
+    if (op->type == HDEC_OP_BAD)
+        return LSHPACK_ERR_BAD_DATA;
+    if (0 != lshpack_dec_dec_int(&s, src_end, op->prefix_bits, &index))
+        return LSHPACK_ERR_BAD_DATA;
+    indexed_type = op->type;
+    if (indexed_type == LSHPACK_NEVER_INDEX)
         output->flags |= LSXPACK_NEVER_INDEX;
+    if (index != LSHPACK_HDR_UNKNOWN && index <= LSHPACK_HDR_WWW_AUTHENTICATE)
+    {
+        output->hpack_index = index;
+    }
+    lit_src = s;
+    if ((dec->hpd_flags & LSHPACK_DEC_LIMITS)
+            && 0 == hdec_check_limits(dec, *src, s, src_end, index,
+                                        indexed_type, &lim_end, &lim_size)
+            && dec->hpd_limits.exceeded
+            && (indexed_type != LSHPACK_ADD_INDEX
+                                || lim_size > dec->hpd_cur_max_capacity))
+    {
+        /* The block is rejected anyway: only headers added to the dynamic
+         * table need decoding.  One too large for the table empties it.
+         */
+        if (indexed_type == LSHPACK_ADD_INDEX)
+            while (lshpack_arr_count(&dec->hpd_dyn_table) > 0)
+                hdec_drop_oldest_entry(dec);
+        *src = lim_end;
+        return LSHPACK_ERR_LIMIT;
+    }
+    /* Values added to the dynamic table must be decoded, and so must
+     * values that are to be validated or output in HTTP/1.x format.
+     */
+    lazy_val = (dec->hpd_flags & (LSHPACK_DEC_LAZY_HUFF|LSHPACK_DEC_VALIDATE
+                                    |LSHPACK_DEC_HTTP1X)) == LSHPACK_DEC_LAZY_HUFF
+                                        && indexed_type != LSHPACK_ADD_INDEX;
+    /* Pick up strings decoded by the previous call if it ran out of buffer
+     * on this very header.
+     */
+    resume = dec->hpd_resume.src == lit_src
+        && (size_t) (src_end - lit_src) >= dec->hpd_resume.enc_len
+        && 0 == memcmp(lit_src, dec->hpd_resume.buf, dec->hpd_resume.enc_len);
+    dec->hpd_resume.src = NULL;
+    saved = dec->hpd_resume.buf + dec->hpd_resume.enc_len;
+    /* Literals are hashed and validated as they are decoded */
+    mode = (calc_hash ? HDEC_SCAN_HASH : 0)
+         | (dec->hpd_flags & LSHPACK_DEC_VALIDATE ? HDEC_SCAN_CHECK : 0);
+    bad = 0;
+
+    if (dec->hpd_flags & LSHPACK_DEC_VIEWS)
+    {
+        len = hdec_make_view(dec, output, index, indexed_type, &s, src_end,
+                                                        calc_hash, mode, &bad);
+        if (len > 0)
+        {
+            *src = s;
+            return bad && (mode & HDEC_SCAN_CHECK) ? LSHPACK_ERR_MALFORMED : 0;
+        }
+        else if (len < 0)
+            return len;
+    }
+
+    char *name = output->buf + output->name_offset;
+    if (index > 0)
+    {
+        if (index <= HPACK_STATIC_TABLE_SIZE) //static table
+        {
+            if (lshpack_dec_copy_name(output, &name,
+                    static_table[index - 1].name,
+                    static_table[index - 1].name_len, http1x)
+                                                    == LSHPACK_ERR_MORE_BUF)
+                goto need_more_buf;
+            output->flags |= LSXPACK_NAME_HASH;
+            output->name_hash = static_table_name_hash[index - 1];
+            if (dec->hpd_app_reg)
+                hdec_set_app_index(dec->hpd_app_reg, output, index, NULL);
+
+            if (indexed_type == LSHPACK_VAL_INDEX)
+            {
+                if (lshpack_dec_copy_value(output, name,
+                                  static_table[index - 1].val,
+                                  static_table[index - 1].val_len,
+                                  http1x) == 0)
+                {
+                    output->flags |= LSXPACK_NAMEVAL_HASH;
+                    output->nameval_hash = static_table_nameval_hash[index - 1];
+                    goto decode_end;
+                }
+                else
+                    goto need_more_buf;
+            }
+        }
+        else
+        {
+            entry = hdec_get_table_entry(dec, index);
+            if (entry == NULL)
+                return LSHPACK_ERR_BAD_DATA;
+            if (lshpack_dec_copy_name(output, &name, hdec_entry_name(entry),
+                    entry->dte_name_len, http1x) == LSHPACK_ERR_MORE_BUF)
+                goto need_more_buf;
+
+            if (entry->dte_name_idx)
+                output->hpack_index = entry->dte_name_idx;
+            else
+                output->hpack_index = LSHPACK_HDR_UNKNOWN;
+            output->flags |= entry->dte_flags & DTEF_NAME_HASH;
+            output->name_hash = entry->dte_name_hash;
+            output->nameval_hash = entry->dte_id;
+            bad |= entry->dte_flags & DTEF_BAD_NAME;
+            if (dec->hpd_app_reg)
+                hdec_set_app_index(dec->hpd_app_reg, output, index, entry);
+            if (indexed_type == LSHPACK_VAL_INDEX)
+            {
+                if (lshpack_dec_copy_value(output, name, DTE_VALUE(entry),
+                                           entry->dte_val_len, http1x) == 0)
+                {
+                    output->flags |= entry->dte_flags & DTEF_NAMEVAL_HASH;
+                    output->nameval_hash = HDEC_NAMEVAL_HASH(entry);
+                    bad |= entry->dte_flags & DTEF_BAD_VALUE;
+                    goto decode_end;
+                }
+                else
+                    goto need_more_buf;
+            }
+        }
+    }
+    else
+    {
+        if (resume && dec->hpd_resume.name_len >= 0)
+        {
+            len = hdec_resume_copy((unsigned char *)name, output->val_len,
+                            &s, src_end, saved, dec->hpd_resume.name_len);
+            if (len >= 0)
+            {
+                saved += len;
+                hash = hdec_scan(NULL, (unsigned char *) name, len,
+                            LSHPACK_XXH_SEED, mode | HDEC_SCAN_NAME, &bad);
+            }
+        }
+        else
+            len = hdec_ingest_str((unsigned char *)name, output->val_len,
+                    &s, src_end, mode | HDEC_SCAN_NAME, LSHPACK_XXH_SEED,
+                    &hash, &bad);
+        if (len < 0)
+        {
+            if (len <= LSHPACK_ERR_MORE_BUF)
+                goto need_more_buf;
+            return len; //error
+        }
+        if (len > UINT16_MAX)
+            return LSHPACK_ERR_TOO_LARGE;
+        if (calc_hash)
+        {
+            output->flags |= LSXPACK_NAME_HASH;
+            output->name_hash = hash;
+        }
+        output->name_len = len;
+        if (dec->hpd_app_reg)
+            hdec_set_app_index(dec->hpd_app_reg, output, 0, NULL);
+        name += output->name_len;
+        if (http1x)
+        {
+            if (output->name_len + 2 <= output->val_len)
+            {
+                *name++ = ':';
+                *name++ = ' ';
+            }
+            else
+                goto need_more_buf;
+        }
+        output->val_len -= len + HTTP1X_EXTRA(http1x);
+    }
+
+    /* The name hash seeds the value hash.  It may be missing if the entry
+     * was added while hashing was off.
+     */
+    if (calc_hash && !(output->flags & LSXPACK_NAME_HASH))
+    {
+        output->flags |= LSXPACK_NAME_HASH;
+        output->name_hash = XXH32(output->buf + output->name_offset,
+                                output->name_len, LSHPACK_XXH_SEED);
+    }
+    if (resume && dec->hpd_resume.val_len >= 0)
+    {
+        len = hdec_resume_copy((unsigned char *)name, output->val_len, &s,
+                                    src_end, saved, dec->hpd_resume.val_len);
+        if (len >= 0)
+            hash = hdec_scan(NULL, (unsigned char *) name, len,
+                                            output->name_hash, mode, &bad);
+    }
+    else if (lazy_val && s < src_end && (*s & 0x80))
+    {
+        len = hdec_copy_str((unsigned char *)name, output->val_len, &s,
+                                                                    src_end);
+        if (len >= 0)
+            output->flags |= LSXPACK_VAL_HUFFMAN;
+    }
+    else
+        len = hdec_ingest_str((unsigned char *)name, output->val_len, &s,
+                            src_end, mode, output->name_hash, &hash, &bad);
+    if (len < 0)
+    {
+        if (len <= LSHPACK_ERR_MORE_BUF)
+            goto need_more_buf;
+        return len; //error
+    }
+    if (len > UINT16_MAX)
+        return LSHPACK_ERR_TOO_LARGE;
+    if (calc_hash && !(output->flags & LSXPACK_VAL_HUFFMAN))
+    {
+        output->flags |= LSXPACK_NAMEVAL_HASH;
+        output->nameval_hash = hash;
+    }
+    if (http1x)
+    {
+        if ((unsigned) len + 2 <= output->val_len)
+            memcpy(name + len, "\r\n", 2);
+        else
+            goto need_more_buf;
+    }
+    output->val_offset = output->name_offset + output->name_len
+                        + HTTP1X_EXTRA(http1x);
+    output->val_len = len;
+
+    if (indexed_type == LSHPACK_ADD_INDEX)
+    {
+        /* `entry' is set if the name is from the dynamic table */
+        if (0 != hdec_push_entry(dec, output, entry))
+            return LSHPACK_ERR_BAD_DATA;  //error
+        if (!(output->flags & LSXPACK_NAMEVAL_HASH))
+            output->nameval_hash = dec->hpd_ins_count;
+        if (bad)
+            hdec_mark_bad(dec, bad);
+    }
+decode_end:
+    *src = s;
+    if (http1x)
+        output->dec_overhead = 4;
+    return bad && (mode & HDEC_SCAN_CHECK) ? LSHPACK_ERR_MALFORMED : 0;
+need_more_buf:
+    /* Report the exact size of the output buffer required to decode this
+     * header, so that the caller can allocate it in one go.  Huffman-encoded
+     * literals are decoded into the resume buffer for use by the next call.
+     */
+    n_lits = (index == 0) + (indexed_type != LSHPACK_VAL_INDEX);
+    if (!resume && 0 != hdec_resume_save(dec, lit_src, src_end, n_lits,
+                                                                lazy_val))
+        return LSHPACK_ERR_BAD_DATA;
+    dec->hpd_resume.src = lit_src;
+    size = dec->hpd_resume.lit_len;
+    if (index > HPACK_STATIC_TABLE_SIZE)
+    {
+        size += entry->dte_name_len;
+        if (indexed_type == LSHPACK_VAL_INDEX)
+            size += entry->dte_val_len;
+    }
+    else if (index > 0)
+    {
+        size += static_table[index - 1].name_len;
+        if (indexed_type == LSHPACK_VAL_INDEX)
+            size += static_table[index - 1].val_len;
+    }
+    size += HTTP1X_EXTRA(http1x) * 2;
+    if (size > LSHPACK_MAX_STRLEN)
+        return LSHPACK_ERR_TOO_LARGE;
+    output->val_len = size;
+    return LSHPACK_ERR_MORE_BUF;
+}
+
+
+#define HDEC_DECODE_VARIANT(name_, http1x_, calc_hash_)                     \
+static int                                                                  \
+name_ (struct lshpack_dec *dec, const unsigned char **src,                  \
+        const unsigned char *src_end, struct lsxpack_header *output)        \
+{                                                                           \
+    return hdec_decode(dec, src, src_end, output, http1x_, calc_hash_);     \
+}
+
+HDEC_DECODE_VARIANT(hdec_decode_plain,       0, 0)
+HDEC_DECODE_VARIANT(hdec_decode_hash,        0, 1)
+HDEC_DECODE_VARIANT(hdec_decode_http1x,      1, 0)
+HDEC_DECODE_VARIANT(hdec_decode_http1x_hash, 1, 1)
+
+
+/* Count decoded header against the limits */
+static int
+hdec_count_header (struct lshpack_dec *dec, const unsigned char *start,
+                    const unsigned char *end,
+                    const struct lsxpack_header *output, int rc)
+{
+    int val_len;
+
+    /* A lazily decoded value counts at its decoded length */
+    val_len = output->val_len;
+    if (output->flags & LSXPACK_VAL_HUFFMAN)
+    {
+        val_len = lshpack_dec_huff_length(
+                (const unsigned char *) lsxpack_header_get_value(output),
+                output->val_len);
+        if (val_len < 0)
+            return LSHPACK_ERR_BAD_DATA;
+    }
+    dec->hpd_limits.list_size += DYNAMIC_ENTRY_OVERHEAD + output->name_len
+                                                                + val_len;
+    dec->hpd_limits.n_headers += 1;
+    dec->hpd_limits.in_bytes += end - start;
+    if (hdec_over_limits(dec, dec->hpd_limits.list_size,
+                    dec->hpd_limits.n_headers, dec->hpd_limits.in_bytes))
+        dec->hpd_limits.exceeded = 1;
+    if (dec->hpd_limits.exceeded)
+        return LSHPACK_ERR_LIMIT;
+    return rc;
+}
+
+
+int
+lshpack_dec_decode (struct lshpack_dec *dec,
+    const unsigned char **src, const unsigned char *src_end,
+    struct lsxpack_header *output)
+{
+    const unsigned char *const start = *src;
+    int rc;
+
+    switch (dec->hpd_flags & (LSHPACK_DEC_HTTP1X|LSHPACK_DEC_HASH))
+    {
+    case 0:
+        rc = hdec_decode_plain(dec, src, src_end, output);
+        break;
+    case LSHPACK_DEC_HASH:
+        rc = hdec_decode_hash(dec, src, src_end, output);
+        break;
+    case LSHPACK_DEC_HTTP1X:
+        rc = hdec_decode_http1x(dec, src, src_end, output);
+        break;
+    default:
+        rc = hdec_decode_http1x_hash(dec, src, src_end, output);
+        break;
+    }
+
+    if ((dec->hpd_flags & LSHPACK_DEC_LIMITS)
+                            && (rc == 0 || rc == LSHPACK_ERR_MALFORMED))
+        rc = hdec_count_header(dec, start, *src, output, rc);
+    return rc;
+}
+
+
+void
+lshpack_dec_block_init (struct lshpack_dec_block *block)
+{
+    memset(block, 0, sizeof(*block));
+}
+
+
+void
+lshpack_dec_block_cleanup (struct lshpack_dec_block *block)
+{
+    free(block->headers);
+    free(block->arena);
+    memset(block, 0, sizeof(*block));
+}
+
+
+/* Make room for at least `need' more bytes in the arena.  Headers already
+ * decoded into the arena are moved along with it.
+ */
+static int
+hdec_block_grow_arena (struct lshpack_dec_block *block, size_t need)
+{
+    char *new_arena;
+    size_t size;
+    unsigned n;
+
+    size = block->arena_size ? block->arena_size : 0x400;
+    while (size < block->arena_used + need)
+        size *= 2;
+
+    new_arena = malloc(size);
+    if (!new_arena)
+        return -1;
+
+    if (block->arena)
+    {
+        memcpy(new_arena, block->arena, block->arena_used);
+        for (n = 0; n < block->n_headers; ++n)
+            if (block->headers[n].buf >= block->arena
+                    && block->headers[n].buf
+                                    < block->arena + block->arena_size)
+                block->headers[n].buf = new_arena
+                                    + (block->headers[n].buf - block->arena);
+        free(block->arena);
+    }
+    block->arena = new_arena;
+    block->arena_size = size;
+    return 0;
+}
+
+
+int
+lshpack_dec_decode_block (struct lshpack_dec *dec,
+    const unsigned char *src, const unsigned char *src_end,
+    struct lshpack_dec_block *block, size_t max_size)
+{
+    struct lsxpack_header *hdr;
+    size_t total = 0;
+    int rc, too_large = 0, malformed = 0;
+
+    block->n_headers = 0;
+    block->arena_used = 0;
+    lshpack_dec_start_block(dec);
+
+    while (src < src_end)
+    {
+        if (block->n_headers >= block->n_alloc)
+        {
+            unsigned n_alloc = block->n_alloc ? block->n_alloc * 2 : 16;
+            hdr = realloc(block->headers, sizeof(hdr[0]) * n_alloc);
+            if (!hdr)
+                return LSHPACK_ERR_BAD_DATA;
+            block->headers = hdr;
+            block->n_alloc = n_alloc;
+        }
+        hdr = &block->headers[ block->n_headers ];
+        lsxpack_header_prepare_decode(hdr, block->arena + block->arena_used,
+                                0, block->arena_size - block->arena_used);
+        rc = lshpack_dec_decode(dec, &src, src_end, hdr);
+        if (rc == LSHPACK_ERR_MORE_BUF)
+        {
+            /* The exact size is known now: one retry is enough */
+            if (0 != hdec_block_grow_arena(block, hdr->val_len))
+                return LSHPACK_ERR_BAD_DATA;
+            lsxpack_header_prepare_decode(hdr,
+                                block->arena + block->arena_used,
+                                0, block->arena_size - block->arena_used);
+            rc = lshpack_dec_decode(dec, &src, src_end, hdr);
+        }
+        if (rc == LSHPACK_ERR_MALFORMED)
+            malformed = 1;
+        else if (rc == LSHPACK_ERR_LIMIT)
+        {
+            too_large = 1;
+            block->n_headers = 0;
+            block->arena_used = 0;
+            continue;
+        }
+        else if (rc != 0)
+            return rc;
+
+        total += hdr->name_len + hdr->val_len;
+        if (max_size && total > max_size)
+            too_large = 1;
+        if (too_large)
+        {
+            /* Keep decoding to stay in sync, but reuse the same space */
+            block->n_headers = 0;
+            block->arena_used = 0;
+            continue;
+        }
+
+        if (hdr->buf == block->arena + block->arena_used)
+            block->arena_used += lsxpack_header_get_dec_size(hdr);
+        ++block->n_headers;
+    }
+
+    if (too_large)
+        return LSHPACK_ERR_TOO_LARGE;
+    if (malformed)
+        return LSHPACK_ERR_MALFORMED;
+    return 0;
+}
+
+
+enum
+{
+    HDS_START,          /* First byte of a representation */
+    HDS_INT,            /* Rest of index or table size update */
+    HDS_STR,            /* First byte of string length */
+    HDS_STR_LEN,        /* Rest of string length */
+    HDS_STR_BODY,       /* String itself */
+};
+
+#define HDS_SIZE_UPDATE 1
+#define HDS_COMPLETE    2
+#define HDS_HUFFMAN     4   /* Current string is Huffman-encoded */
+#define HDS_ADD_INDEX   8   /* Header is added to the dynamic table */
+#define HDS_SKIP        16  /* Over the limits: not copied */
+
+/* Longest strings that can decode to at most LSHPACK_MAX_STRLEN bytes.  A
+ * split representation has at most two of them, three integers and, at the
+ * start of the block, a couple of table size updates.
+ */
+#define HDS_MAX_RAW_LEN LSHPACK_MAX_STRLEN
+#define HDS_MAX_HUFF_LEN ((uint64_t) LSHPACK_MAX_STRLEN * 30 / 8 + 1)
+#define HDS_MAX_BUF (LSHPACK_UINT32_ENC_SZ * 8 + HDS_MAX_HUFF_LEN * 2)
+
+
+void
+lshpack_dec_stream_init (struct lshpack_dec_stream *stream)
+{
+    memset(stream, 0, sizeof(*stream));
+}
+
+
+void
+lshpack_dec_stream_cleanup (struct lshpack_dec_stream *stream)
+{
+    free(stream->hds_buf);
+    memset(stream, 0, sizeof(*stream));
+}
+
+
+static void
+hdec_stream_reset (struct lshpack_dec_stream *stream)
+{
+    stream->hds_buf_len = 0;
+    stream->hds_rep_len = 0;
+    stream->hds_state = HDS_START;
+    stream->hds_flags = 0;
+}
+
+
+/* Called once the length of a string is known.  Like hdec_check_limits()
+ * does, count the smallest size the string can decode to and check the
+ * limits before the string is read, so that it is not copied for nothing.
+ * `in_bytes' is the size of the representation up to the end of the
+ * string.
+ */
+static int
+hdec_stream_check (struct lshpack_dec *dec, struct lshpack_dec_stream *stream,
+                                                            size_t in_bytes)
+{
+    uint32_t len;
+
+    len = stream->hds_str_left;
+    if (stream->hds_flags & HDS_HUFFMAN)
+    {
+        if (len > HDS_MAX_HUFF_LEN)
+            return LSHPACK_ERR_TOO_LARGE;
+        stream->hds_min_size += (size_t) len * 8 / 30;
+    }
+    else
+    {
+        if (len > HDS_MAX_RAW_LEN)
+            return LSHPACK_ERR_TOO_LARGE;
+        stream->hds_min_size += len;
+    }
+
+    if ((dec->hpd_flags & LSHPACK_DEC_LIMITS)
+        && !(stream->hds_flags & HDS_SKIP)
+        && (dec->hpd_limits.exceeded
+            || hdec_over_limits(dec,
+                    dec->hpd_limits.list_size + stream->hds_min_size,
+                    dec->hpd_limits.n_headers + 1,
+                    dec->hpd_limits.in_bytes + in_bytes)))
+    {
+        /* Headers added to the dynamic table must still be decoded */
+        dec->hpd_limits.exceeded = 1;
+        if (!(stream->hds_flags & HDS_ADD_INDEX)
+                        || stream->hds_min_size > dec->hpd_cur_max_capacity)
+            stream->hds_flags |= HDS_SKIP;
+    }
+    return 0;
+}
+
+
+/* Advance the stream state over input until the end of the current
+ * representation.  Sets HDS_COMPLETE if it is reached.  Returns the number
+ * of bytes scanned or a negative value if the input is invalid.  Only the
+ * framing, string lengths and limits are checked here; lshpack_dec_decode()
+ * does the rest.
+ */
+static int
+hdec_stream_scan (struct lshpack_dec *dec, struct lshpack_dec_stream *stream,
+                const unsigned char *src, const unsigned char *src_end)
+{
+    const unsigned char *p = src;
+    const struct hdec_op *op;
+    unsigned prefix_max;
+    size_t n;
+    int rc;
+
+    while (p < src_end)
+        switch (stream->hds_state)
+        {
+        case HDS_START:
+            op = &hdec_ops[*p];
+            if (op->type == HDEC_OP_SIZE_UPDATE)
+                stream->hds_flags |= HDS_SIZE_UPDATE;
+            if (op->type == LSHPACK_ADD_INDEX)
+                stream->hds_flags |= HDS_ADD_INDEX;
+            else
+                stream->hds_flags &= ~HDS_ADD_INDEX;
+            stream->hds_min_size = DYNAMIC_ENTRY_OVERHEAD;
+            prefix_max = (1u << op->prefix_bits) - 1;
+            stream->hds_n_str = op->n_lits;
+            if ((*p++ & prefix_max) == prefix_max)
+            {
+                stream->hds_n_cont = 0;
+                stream->hds_state = HDS_INT;
+                break;
+            }
+  int_done:
+            if (stream->hds_flags & HDS_SIZE_UPDATE)
+            {
+                stream->hds_flags &= ~HDS_SIZE_UPDATE;
+                stream->hds_state = HDS_START;
+            }
+            else if (stream->hds_n_str == 0)
+                goto complete;
+            else
+                stream->hds_state = HDS_STR;
+            break;
+        case HDS_INT:
+            if (++stream->hds_n_cont >= LSHPACK_UINT32_ENC_SZ)
+                return -1;
+            if (*p++ & 0x80)
+                break;
+            goto int_done;
+        case HDS_STR:
+            if (*p & 0x80)
+                stream->hds_flags |= HDS_HUFFMAN;
+            else
+                stream->hds_flags &= ~HDS_HUFFMAN;
+            stream->hds_int = *p & 0x7f;
+            if ((*p++ & 0x7f) == 0x7f)
+            {
+                stream->hds_n_cont = 0;
+                stream->hds_state = HDS_STR_LEN;
+                break;
+            }
+  str_len_done:
+            stream->hds_str_left = (uint32_t) stream->hds_int;
+            rc = hdec_stream_check(dec, stream, stream->hds_rep_len
+                                        + (p - src) + stream->hds_str_left);
+            if (rc < 0)
+                return rc;
+            stream->hds_state = HDS_STR_BODY;
+            if (stream->hds_str_left == 0)
+                goto str_done;
+            break;
+        case HDS_STR_LEN:
+            if (stream->hds_n_cont >= LSHPACK_UINT32_ENC_SZ - 1)
+                return -1;
+            stream->hds_int += (uint64_t) (*p & 0x7f)
+                                            << (7 * stream->hds_n_cont++);
+            if (*p++ & 0x80)
+                break;
+            if (stream->hds_int > UINT32_MAX)
+                return -1;
+            goto str_len_done;
+        default:
+            assert(stream->hds_state == HDS_STR_BODY);
+            n = src_end - p;
+            if (n > stream->hds_str_left)
+                n = stream->hds_str_left;
+            p += n;
+            stream->hds_str_left -= n;
+            if (stream->hds_str_left > 0)
+                break;
+  str_done:
+            if (--stream->hds_n_str == 0)
+                goto complete;
+            stream->hds_state = HDS_STR;
+            break;
+        }
+
+    return p - src;
+
+  complete:
+    stream->hds_flags |= HDS_COMPLETE;
+    return p - src;
+}
+
+
+int
+lshpack_dec_stream_decode (struct lshpack_dec *dec,
+    struct lshpack_dec_stream *stream,
+    const unsigned char **src, const unsigned char *src_end,
+    struct lsxpack_header *output)
+{
+    const unsigned char *s;
+    unsigned char *new_buf;
+    size_t size;
+    int n, rc, flags, whole;
+
+    if (!(stream->hds_flags & HDS_COMPLETE))
+    {
+        if (*src == src_end)
+            return LSHPACK_ERR_MORE_DATA;
+        whole = stream->hds_rep_len == 0;
+        n = hdec_stream_scan(dec, stream, *src, src_end);
+        if (n < 0)
+        {
+            hdec_stream_reset(stream);
+            return n;
+        }
+
+        if (whole && (stream->hds_flags & HDS_COMPLETE))
+        {
+            /* The whole representation is in this fragment */
+            hdec_stream_reset(stream);
+            s = *src;
+            rc = lshpack_dec_decode(dec, &s, *src + n, output);
+            if (rc == 0 || rc == LSHPACK_ERR_MALFORMED
+                                                || rc == LSHPACK_ERR_LIMIT)
+                *src = s;
+            return rc;
+        }
+
+        stream->hds_rep_len += n;
+        if (!(stream->hds_flags & HDS_SKIP))
+        {
+            if (stream->hds_buf_len + n > HDS_MAX_BUF)
+            {
+                hdec_stream_reset(stream);
+                return LSHPACK_ERR_TOO_LARGE;
+            }
+            if (stream->hds_buf_len + n > stream->hds_buf_alloc)
+            {
+                size = stream->hds_buf_alloc ? stream->hds_buf_alloc : 0x100;
+                while (size < stream->hds_buf_len + n)
+                    size *= 2;
+                if (size > HDS_MAX_BUF)
+                    size = HDS_MAX_BUF;
+                new_buf = realloc(stream->hds_buf, size);
+                if (!new_buf)
+                    return LSHPACK_ERR_BAD_DATA;
+                stream->hds_buf = new_buf;
+                stream->hds_buf_alloc = size;
+            }
+            memcpy(stream->hds_buf + stream->hds_buf_len, *src, n);
+            stream->hds_buf_len += n;
+        }
+        *src += n;
+        if (!(stream->hds_flags & HDS_COMPLETE))
+            return LSHPACK_ERR_MORE_DATA;
+    }
+
+    if (stream->hds_flags & HDS_SKIP)
+    {
+        /* As in hdec_decode(): one too large for the table empties it */
+        if (stream->hds_flags & HDS_ADD_INDEX)
+            while (lshpack_arr_count(&dec->hpd_dyn_table) > 0)
+                hdec_drop_oldest_entry(dec);
+        hdec_stream_reset(stream);
+        return LSHPACK_ERR_LIMIT;
+    }
+
+    /* The buffer is reused for the next split representation, so the
+     * header may not point into it.
+     */
+    flags = dec->hpd_flags;
+    dec->hpd_flags &= ~LSHPACK_DEC_VIEWS;
+    s = stream->hds_buf;
+    rc = lshpack_dec_decode(dec, &s, stream->hds_buf + stream->hds_buf_len,
+                                                                    output);
+    dec->hpd_flags = flags;
+    if (rc != LSHPACK_ERR_MORE_BUF)
+        hdec_stream_reset(stream);
+    return rc;
+}
+
+
+int
+lshpack_dec_stream_end (struct lshpack_dec_stream *stream)
+{
+    int incomplete;
+
+    incomplete = stream->hds_rep_len > 0 || stream->hds_state != HDS_START
+                                                        || stream->hds_flags;
+    hdec_stream_reset(stream);
+    return incomplete ? LSHPACK_ERR_BAD_DATA : 0;
+}
+
+
+void
+lshpack_dec_calc_hash (struct lshpack_dec *dec, struct lsxpack_header *hdr)
+{
+    struct dec_table_entry *entry;
+
+    if ((hdr->flags & (LSXPACK_NAME_HASH|LSXPACK_NAMEVAL_HASH))
+                                    == (LSXPACK_NAME_HASH|LSXPACK_NAMEVAL_HASH))
+        return;
+
+    entry = NULL;
+    if (!(hdr->flags & LSXPACK_NAMEVAL_HASH))
+    {
+        entry = hdec_get_entry_by_id(dec, hdr->nameval_hash);
+        if (entry && !(entry->dte_name_len == hdr->name_len
+                && 0 == memcmp(hdec_entry_name(entry),
+                            lsxpack_header_get_name(hdr), hdr->name_len)))
+            entry = NULL;
+    }
+
+    if (!(hdr->flags & LSXPACK_NAME_HASH))
+    {
+        if (entry && (entry->dte_flags & DTEF_NAME_HASH))
+            hdr->name_hash = entry->dte_name_hash;
+        else
+        {
+            hdr->name_hash = XXH32(lsxpack_header_get_name(hdr),
+                                            hdr->name_len, LSHPACK_XXH_SEED);
+            if (entry)
+            {
+                entry->dte_name_hash = hdr->name_hash;
+                entry->dte_flags |= DTEF_NAME_HASH;
+            }
+        }
+        hdr->flags |= LSXPACK_NAME_HASH;
+    }
+
+    /* Hash of a Huffman-encoded value would be of no use */
+    if (!(hdr->flags & (LSXPACK_NAMEVAL_HASH|LSXPACK_VAL_HUFFMAN)))
+    {
+        /* The name may come from the entry, but the value from the input */
+        if (entry && !(entry->dte_val_len == hdr->val_len
+                && 0 == memcmp(DTE_VALUE(entry),
+                            lsxpack_header_get_value(hdr), hdr->val_len)))
+            entry = NULL;
+        if (entry && (entry->dte_flags & DTEF_NAMEVAL_HASH))
+            hdr->nameval_hash = entry->dte_nameval_hash;
+        else
+        {
+            hdr->nameval_hash = XXH32(lsxpack_header_get_value(hdr),
+                                            hdr->val_len, hdr->name_hash);
+            if (entry)
+            {
+                entry->dte_nameval_hash = hdr->nameval_hash;
+                entry->dte_flags |= DTEF_NAMEVAL_HASH;
+            }
+        }
+        hdr->flags |= LSXPACK_NAMEVAL_HASH;
+    }
+}
+
+
+void
+lshpack_h1_head_init (struct lshpack_h1_head *head)
+{
+    memset(head, 0, sizeof(*head));
+}
+
+
+void
+lshpack_h1_head_cleanup (struct lshpack_h1_head *head)
+{
+    free(head->iov);
+    free(head->buf);
+    memset(head, 0, sizeof(*head));
+}
+
+
+#define H1_NAME_IS(hdr_, str_) ((hdr_)->name_len == sizeof(str_) - 1 \
+    && 0 == memcmp(lsxpack_header_get_name(hdr_), str_, sizeof(str_) - 1))
+
+#define H1_ADD(base_, len_) do {                                        \
+    iov->iov_base = (void *) (base_);                                   \
+    iov->iov_len = (len_);                                              \
+    head->size += iov->iov_len;                                         \
+    ++iov;                                                              \
+} while (0)
+
+#define H1_ADD_STR(str_) H1_ADD(str_, sizeof(str_) - 1)
+
+#define H1_ADD_VAL(hdr_) do {                                           \
+    val = h1_head_value(head, &lazy, hdr_, &val_len);                   \
+    if (!val || h1_head_bad(val, val_len, HDEC_SCAN_CHECK))             \
+        return LSHPACK_ERR_BAD_DATA;                                    \
+    H1_ADD(val, val_len);                                               \
+} while (0)
+
+
+/* The decoder only checks names and values if validation is on: this is
+ * where they would otherwise reach an HTTP/1 peer unchecked.
+ */
+static int
+h1_head_bad (const char *str, unsigned len, unsigned mode)
+{
+    unsigned bad = 0;
+
+    (void) hdec_scan(NULL, (const unsigned char *) str, len, 0, mode, &bad);
+    return bad != 0;
+}
+
+
+/* The last lazily decoded value: :authority is used twice in a row */
+struct h1_lazy
+{
+    const struct lsxpack_header *hdr;
+    const char                  *val;
+    unsigned                     len;
+    size_t                       off;
+};
+
+
+static const char *
+h1_head_value (struct lshpack_h1_head *head, struct h1_lazy *lazy,
+                        const struct lsxpack_header *hdr, unsigned *len)
+{
+    int rc;
+
+    if (!(hdr->flags & LSXPACK_VAL_HUFFMAN))
+    {
+        *len = hdr->val_len;
+        return lsxpack_header_get_value(hdr);
+    }
+
+    if (hdr != lazy->hdr)
+    {
+        rc = lshpack_dec_decode_value(hdr, head->buf + lazy->off,
+                                                head->buf_size - lazy->off);
+        if (rc < 0)
+            return NULL;
+        lazy->hdr = hdr;
+        lazy->val = head->buf + lazy->off;
+        lazy->len = rc;
+        lazy->off += rc;
+    }
+    *len = lazy->len;
+    return lazy->val;
+}
+
+
+int
+lshpack_h1_head_build (struct lshpack_h1_head *head,
+            const struct lsxpack_header *headers, unsigned n_headers)
+{
+    const struct lsxpack_header *hdr, *method, *path, *authority, *status,
+                                                                    *cookie;
+    struct iovec *iov;
+    struct h1_lazy lazy;
+    const char *val;
+    char *buf;
+    size_t lazy_size;
+    unsigned n, i, n_alloc, val_len, status_len;
+    int len;
+
+    method = path = authority = status = cookie = NULL;
+    lazy_size = 0;
+    status_len = 0;
+    for (n = 0; n < n_headers; ++n)
+    {
+        hdr = &headers[n];
+        if (hdr->flags & LSXPACK_VAL_HUFFMAN)
+        {
+            len = lshpack_dec_huff_length(
+                    (const unsigned char *) lsxpack_header_get_value(hdr),
+                    hdr->val_len);
+            if (len < 0)
+                return LSHPACK_ERR_BAD_DATA;
+            lazy_size += len;
+        }
+        else
+            len = hdr->val_len;
+        if (hdr->name_len == 0 || lsxpack_header_get_name(hdr)[0] != ':')
+            continue;
+        if (H1_NAME_IS(hdr, ":method"))
+            method = hdr;
+        else if (H1_NAME_IS(hdr, ":path"))
+            path = hdr;
+        else if (H1_NAME_IS(hdr, ":authority"))
+            authority = hdr;
+        else if (H1_NAME_IS(hdr, ":status"))
+        {
+            status = hdr;
+            status_len = len;
+        }
+    }
+
+    if (status ? method || path || status_len != 3
+               : !method || !(path || authority))
+        return LSHPACK_ERR_BAD_DATA;
+
+    if (lazy_size > head->buf_size)
+    {
+        buf = realloc(head->buf, lazy_size);
+        if (!buf)
+            return LSHPACK_ERR_BAD_DATA;
+        head->buf = buf;
+        head->buf_size = lazy_size;
     }
+    memset(&lazy, 0, sizeof(lazy));
 
-    //without indexed
-    else if (*s == 0x00)  //0000 0000
+    /* Only CONNECT uses authority-form, RFC 9113, Section 8.5 */
+    if (method && !path)
     {
-        indexed_type = LSHPACK_NO_INDEX;
-        index = LSHPACK_HDR_UNKNOWN;
-        ++s;
+        val = h1_head_value(head, &lazy, method, &val_len);
+        if (!(val && val_len == 7 && 0 == memcmp(val, "CONNECT", 7)))
+            return LSHPACK_ERR_BAD_DATA;
     }
-    else // 0000 xxxx
+
+    /* Start line and Host take at most seven; each header four; plus the
+     * empty line.
+     */
+    n_alloc = n_headers * 4 + 8;
+    if (n_alloc > head->n_alloc)
     {
-        if (0 != lshpack_dec_dec_int(&s, src_end, 4, &index))
+        iov = realloc(head->iov, sizeof(iov[0]) * n_alloc);
+        if (!iov)
             return LSHPACK_ERR_BAD_DATA;
+        head->iov = iov;
+        head->n_alloc = n_alloc;
+    }
+    iov = head->iov;
+    head->size = 0;
 
-        indexed_type = LSHPACK_NO_INDEX;
+    if (status)
+    {
+        H1_ADD_STR("HTTP/1.1 ");
+        H1_ADD_VAL(status);
+        H1_ADD_STR(" \r\n");
     }
-    if (index != LSHPACK_HDR_UNKNOWN && index <= LSHPACK_HDR_WWW_AUTHENTICATE)
+    else
     {
-        output->hpack_index = index;
+        H1_ADD_VAL(method);
+        H1_ADD_STR(" ");
+        if (path)
+            H1_ADD_VAL(path);
+        else    /* CONNECT */
+            H1_ADD_VAL(authority);
+        H1_ADD_STR(" HTTP/1.1\r\n");
+        if (authority)
+        {
+            H1_ADD_STR("host: ");
+            H1_ADD_VAL(authority);
+            H1_ADD_STR("\r\n");
+        }
     }
 
-    char *name = output->buf + output->name_offset;
-    if (index > 0)
+    for (n = 0; n < n_headers; ++n)
     {
-        if (index <= HPACK_STATIC_TABLE_SIZE) //static table
+        hdr = &headers[n];
+        if (hdr->name_len > 0 && lsxpack_header_get_name(hdr)[0] == ':')
+            continue;
+        if (h1_head_bad(lsxpack_header_get_name(hdr), hdr->name_len,
+                                            HDEC_SCAN_CHECK|HDEC_SCAN_NAME))
+            return LSHPACK_ERR_BAD_DATA;
+        if (authority && H1_NAME_IS(hdr, "host"))
+            continue;
+        if (H1_NAME_IS(hdr, "cookie"))
         {
-            if (lshpack_dec_copy_name(output, &name,
-                    static_table[index - 1].name,
-                    static_table[index - 1].name_len) == LSHPACK_ERR_MORE_BUF)
-            {
-                extra_buf = static_table[index - 1].name_len
-                        + LSHPACK_DEC_HTTP1X_EXTRA;
-                goto need_more_buf;
-            }
-            output->flags |= LSXPACK_NAME_HASH;
-            output->name_hash = static_table_name_hash[index - 1];
-
-            if (indexed_type == LSHPACK_VAL_INDEX)
-            {
-                if (lshpack_dec_copy_value(output, name,
-                                  static_table[index - 1].val,
-                                  static_table[index - 1].val_len) == 0)
-                {
-                    output->flags |= LSXPACK_NAMEVAL_HASH;
-                    output->nameval_hash = static_table_nameval_hash[index - 1];
-                    goto decode_end;
-                }
-                else
+            /* All cookie headers go out with the first one */
+            if (cookie)
+                continue;
+            cookie = hdr;
+            H1_ADD(lsxpack_header_get_name(hdr), hdr->name_len);
+            H1_ADD_STR(": ");
+            H1_ADD_VAL(hdr);
+            for (i = n + 1; i < n_headers; ++i)
+                if (H1_NAME_IS(&headers[i], "cookie"))
                 {
-                    extra_buf = static_table[index - 1].val_len
-                                + LSHPACK_DEC_HTTP1X_EXTRA;
-                    goto need_more_buf;
+                    H1_ADD_STR("; ");
+                    H1_ADD_VAL(&headers[i]);
                 }
-            }
+            H1_ADD_STR("\r\n");
         }
-        else
+        else if (hdr->dec_overhead == 4
+                                && !(hdr->flags & LSXPACK_VAL_HUFFMAN))
         {
-            entry = hdec_get_table_entry(dec, index);
-            if (entry == NULL)
+            /* Decoded in HTTP/1.x format: name, ": ", value and "\r\n"
+             * are contiguous.
+             */
+            if (h1_head_bad(lsxpack_header_get_value(hdr), hdr->val_len,
+                                                            HDEC_SCAN_CHECK))
                 return LSHPACK_ERR_BAD_DATA;
-            if (lshpack_dec_copy_name(output, &name, DTE_NAME(entry),
-                    entry->dte_name_len) == LSHPACK_ERR_MORE_BUF)
-            {
-                extra_buf = entry->dte_name_len + LSHPACK_DEC_HTTP1X_EXTRA;
-                goto need_more_buf;
-            }
-
-            if (entry->dte_name_idx)
-                output->hpack_index = entry->dte_name_idx;
-            else
-                output->hpack_index = LSHPACK_HDR_UNKNOWN;
-#if LSHPACK_DEC_CALC_HASH
-            output->flags |= entry->dte_flags & DTEF_NAME_HASH;
-            output->name_hash = entry->dte_name_hash;
-#endif
-            if (indexed_type == LSHPACK_VAL_INDEX)
-            {
-                if (lshpack_dec_copy_value(output, name, DTE_VALUE(entry),
-                                           entry->dte_val_len) == 0)
-                {
-#if LSHPACK_DEC_CALC_HASH
-                    output->flags |= entry->dte_flags & DTEF_NAMEVAL_HASH;
-                    output->nameval_hash = entry->dte_nameval_hash;
-#endif
-                    goto decode_end;
-                }
-                else
-                {
-                    extra_buf = entry->dte_val_len + LSHPACK_DEC_HTTP1X_EXTRA;
-                    goto need_more_buf;
-                }
-            }
-        }
-    }
-    else
-    {
-        len = hdec_dec_str((unsigned char *)name, output->val_len,
-                           &s, src_end);
-        if (len < 0)
-        {
-            if (len <= LSHPACK_ERR_MORE_BUF)
-            {
-                extra_buf = -len;
-                goto need_more_buf;
-            }
-            return len; //error
-        }
-        if (len > UINT16_MAX)
-            return LSHPACK_ERR_TOO_LARGE;
-#if LSHPACK_DEC_CALC_HASH
-        output->flags |= LSXPACK_NAME_HASH;
-        output->name_hash = XXH32(name, (size_t) len, LSHPACK_XXH_SEED);
-#endif
-        output->name_len = len;
-        name += output->name_len;
-#if LSHPACK_DEC_HTTP1X_OUTPUT
-        if (output->name_len + 2 <= output->val_len)
-        {
-            *name++ = ':';
-            *name++ = ' ';
+            H1_ADD(lsxpack_header_get_name(hdr),
+                                        lsxpack_header_get_dec_size(hdr));
         }
         else
         {
-            extra_buf = 2;
-            goto need_more_buf;
+            H1_ADD(lsxpack_header_get_name(hdr), hdr->name_len);
+            H1_ADD_STR(": ");
+            H1_ADD_VAL(hdr);
+            H1_ADD_STR("\r\n");
         }
-#endif
-        output->val_len -= len + LSHPACK_DEC_HTTP1X_EXTRA;
     }
+    H1_ADD_STR("\r\n");
 
-    len = hdec_dec_str((unsigned char *)name, output->val_len, &s, src_end);
-    if (len < 0)
+    head->n_iov = iov - head->iov;
+    return 0;
+}
+
+
+int
+lshpack_dec_decode_value (const struct lsxpack_header *hdr, char *dst,
+                                                            size_t dst_len)
+{
+    int len;
+
+    if (hdr->flags & LSXPACK_VAL_HUFFMAN)
     {
-        if (len <= LSHPACK_ERR_MORE_BUF)
-        {
-            extra_buf = -len;
-            goto need_more_buf;
-        }
-        return len; //error
+        if (dst_len > INT_MAX)
+            dst_len = INT_MAX;
+        len = lshpack_dec_huff_decode(
+                    (const unsigned char *) lsxpack_header_get_value(hdr),
+                    hdr->val_len, (unsigned char *) dst, (int) dst_len);
+        if (len >= 0)
+            return len;
+        else if (len == -1)
+            return LSHPACK_ERR_BAD_DATA;
+        else
+            return LSHPACK_ERR_MORE_BUF;
     }
-    if (len > UINT16_MAX)
-        return LSHPACK_ERR_TOO_LARGE;
-#if LSHPACK_DEC_CALC_HASH
-    assert(output->flags & LSXPACK_NAME_HASH);
-    output->flags |= LSXPACK_NAMEVAL_HASH;
-    output->nameval_hash = XXH32(name, (size_t) len, output->name_hash);
-#endif
-#if LSHPACK_DEC_HTTP1X_OUTPUT
-    if ((unsigned) len + 2 <= output->val_len)
-        memcpy(name + len, "\r\n", 2);
+
+    if (dst_len < hdr->val_len)
+        return LSHPACK_ERR_MORE_BUF;
+    memcpy(dst, lsxpack_header_get_value(hdr), hdr->val_len);
+    return hdr->val_len;
+}
+
+
+void
+lshpack_dec_use_views (struct lshpack_dec *dec, int on)
+{
+    if (on)
+        dec->hpd_flags |= LSHPACK_DEC_VIEWS;
     else
-    {
-        extra_buf = 2;
-        goto need_more_buf;
-    }
-#endif
-    output->val_offset = output->name_offset + output->name_len
-                        + LSHPACK_DEC_HTTP1X_EXTRA;
-    output->val_len = len;
+        dec->hpd_flags &= ~LSHPACK_DEC_VIEWS;
+}
 
-    if (indexed_type == LSHPACK_ADD_INDEX &&
-                                0 != lshpack_dec_push_entry(dec, output))
-        return LSHPACK_ERR_BAD_DATA;  //error
-decode_end:
-    *src = s;
-#if LSHPACK_DEC_HTTP1X_OUTPUT
-    output->dec_overhead = 4;
-#endif
-    return 0;
-need_more_buf:
-    buf_len += extra_buf;
-    output->val_len = buf_len;
-    return LSHPACK_ERR_MORE_BUF;
+
+void
+lshpack_dec_set_evict_cb (struct lshpack_dec *dec, lshpack_dec_evict_f cb,
+                                                                    void *ctx)
+{
+    dec->hpd_evict_cb = cb;
+    dec->hpd_evict_ctx = ctx;
+}
+
+
+void
+lshpack_dec_use_lazy_huff (struct lshpack_dec *dec, int on)
+{
+    if (on)
+        dec->hpd_flags |= LSHPACK_DEC_LAZY_HUFF;
+    else
+        dec->hpd_flags &= ~LSHPACK_DEC_LAZY_HUFF;
+}
+
+
+void
+lshpack_dec_use_http1x (struct lshpack_dec *dec, int on)
+{
+    if (on)
+        dec->hpd_flags |= LSHPACK_DEC_HTTP1X;
+    else
+        dec->hpd_flags &= ~LSHPACK_DEC_HTTP1X;
+}
+
+
+void
+lshpack_dec_set_app_reg (struct lshpack_dec *dec,
+                                        const struct lshpack_app_reg *reg)
+{
+    dec->hpd_app_reg = reg;
+}
+
+
+void
+lshpack_enc_set_app_reg (struct lshpack_enc *enc,
+                                        const struct lshpack_app_reg *reg)
+{
+    enc->hpe_app_reg = reg;
+}
+
+
+void
+lshpack_dec_use_hash (struct lshpack_dec *dec, int on)
+{
+    if (on)
+        dec->hpd_flags |= LSHPACK_DEC_HASH;
+    else
+        dec->hpd_flags &= ~LSHPACK_DEC_HASH;
+}
+
+
+void
+lshpack_dec_use_validation (struct lshpack_dec *dec, int on)
+{
+    if (on)
+        dec->hpd_flags |= LSHPACK_DEC_VALIDATE;
+    else
+        dec->hpd_flags &= ~LSHPACK_DEC_VALIDATE;
+}
+
+
+void
+lshpack_dec_set_limits (struct lshpack_dec *dec, unsigned max_list_size,
+                                    unsigned max_headers, unsigned max_ratio)
+{
+    dec->hpd_limits.max_list_size = max_list_size;
+    dec->hpd_limits.max_headers = max_headers;
+    dec->hpd_limits.max_ratio = max_ratio;
+    if (max_list_size || max_headers || max_ratio)
+        dec->hpd_flags |= LSHPACK_DEC_LIMITS;
+    else
+        dec->hpd_flags &= ~LSHPACK_DEC_LIMITS;
+}
+
+
+void
+lshpack_dec_start_block (struct lshpack_dec *dec)
+{
+    dec->hpd_limits.n_headers = 0;
+    dec->hpd_limits.list_size = 0;
+    dec->hpd_limits.in_bytes = 0;
+    dec->hpd_limits.exceeded = 0;
 }
 
 
 #if LS_HPACK_USE_LARGE_TABLES
 #define SHORTEST_CODE 5
+#define LONGEST_CODE 30
+#define LONG_CODE_PREFIX 15
 
 
 /* The decoder is optimized for the common case.  Most of the time, we decode
  * data whose encoding is 16 bits or shorter.  This lets us use a 64 KB table
  * indexed by two bytes of input and outputs 1, 2, or 3 bytes at a time.
  *
- * In the case a longer code is encoutered, we fall back to the original
- * Huffman decoder that supports all code lengths.
+ * Codes longer than 16 bits all begin with fifteen ones.  When one of them
+ * is encountered, the fifteen bits that follow the prefix are looked up in
+ * the second-level `hdecs_long' table, so that any code is resolved in at
+ * most two lookups.  We only fall back to the original Huffman decoder that
+ * processes four bits at a time if the bit buffer is too narrow to hold a
+ * complete long code, which can happen on 32-bit platforms.
  */
 int
 lshpack_dec_huff_decode (const unsigned char *src, int src_len,
@@ -1854,8 +4303,10 @@ lshpack_dec_huff_decode (const unsigned char *src, int src_len,
     uintptr_t buf;      /* OK not to initialize the buffer */
     unsigned avail_bits, len;
     struct hdec hdec;
+    struct hdec_long hdec_long;
     uint16_t idx;
     int r;
+    HPROF(LSHPACK_PROF_HUFF_DECODE);
 
 #if __GNUC__
 #pragma GCC diagnostic push
@@ -1917,6 +4368,7 @@ lshpack_dec_huff_decode (const unsigned char *src, int src_len,
         else
             break;  /* Normal case terminating condition: out of input */
 
+  decode_more:
         if (dst_end - dst >= (ptrdiff_t) (8 * sizeof(buf) / SHORTEST_CODE)
                                                             && avail_bits >= 16)
         {
@@ -1934,7 +4386,7 @@ lshpack_dec_huff_decode (const unsigned char *src, int src_len,
             while (avail_bits >= 16 && hdec.lens);
             if (avail_bits < 16)
                 continue;
-            goto slow_path;
+            goto long_code;
         }
         else
             while (avail_bits >= 16)
@@ -1969,8 +4421,38 @@ lshpack_dec_huff_decode (const unsigned char *src, int src_len,
                     return r;
                 }
                 else
-                    goto slow_path;
+                    goto long_code;
             }
+        continue;
+
+  long_code:
+        /* The top LONG_CODE_PREFIX bits are all ones.  Make sure we have
+         * enough bits for the longest code, if there is more input:
+         */
+        while (avail_bits <= sizeof(buf) * 8 - 8 && src < src_end)
+        {
+            buf <<= 8;
+            buf |= (uintptr_t) *src++;
+            avail_bits += 8;
+        }
+        if (avail_bits >= LONGEST_CODE)
+            idx = buf >> (avail_bits - LONGEST_CODE);
+        else if (src == src_end)
+        {
+            idx = buf << (LONGEST_CODE - avail_bits);
+            idx |= (1 << (LONGEST_CODE - avail_bits)) - 1;  /* EOF */
+        }
+        else
+            goto slow_path;
+        hdec_long = hdecs_long[idx & ((1 << (LONGEST_CODE - LONG_CODE_PREFIX)) - 1)];
+        if (hdec_long.lens == 0 || hdec_long.lens > avail_bits)
+            return -1;
+        if (dst == dst_end)
+            return LSHPACK_ERR_MORE_BUF;
+        *dst++ = hdec_long.out;
+        avail_bits -= hdec_long.lens;
+        if (avail_bits >= 16)
+            goto decode_more;
     }
 
     if (avail_bits >= SHORTEST_CODE)
@@ -2019,7 +4501,9 @@ lshpack_dec_huff_decode (const unsigned char *src, int src_len,
 
     if (avail_bits > 0)
     {
-        if (((1u << avail_bits) - 1) != (buf & ((1u << avail_bits) - 1)))
+        /* RFC 7541, Section 5.2: padding longer than 7 bits is an error */
+        if (avail_bits > 7
+                || ((1u << avail_bits) - 1) != (buf & ((1u << avail_bits) - 1)))
             return -1;  /* Not EOF as expected */
     }
 #if __GNUC__
@@ -2042,6 +4526,110 @@ lshpack_dec_huff_decode (const unsigned char *src, int src_len,
         return r;
 }
 #endif
+
+
+/* Walk the decoding tables the same way lshpack_dec_huff_decode() does, but
+ * only count the symbols.  The input is validated along the way.
+ */
+int
+lshpack_dec_huff_length (const unsigned char *src, int src_len)
+{
+    const unsigned char *const src_end = src + src_len;
+    int count = 0;
+#if LS_HPACK_USE_LARGE_TABLES
+    uint64_t buf = 0;
+    unsigned avail_bits = 0;
+    struct hdec hdec;
+    struct hdec_long hdec_long;
+    uint16_t idx;
+
+    while (1)
+    {
+        while (avail_bits <= sizeof(buf) * 8 - 8 && src < src_end)
+        {
+            buf <<= 8;
+            buf |= *src++;
+            avail_bits += 8;
+        }
+        if (avail_bits < 16)
+            break;
+        idx = buf >> (avail_bits - 16);
+        hdec = hdecs[idx];
+        if (hdec.lens)
+        {
+            count += hdec.lens & 3;
+            avail_bits -= hdec.lens >> 2;
+            continue;
+        }
+        if (avail_bits >= LONGEST_CODE)
+            idx = buf >> (avail_bits - LONGEST_CODE);
+        else
+        {
+            idx = buf << (LONGEST_CODE - avail_bits);
+            idx |= (1 << (LONGEST_CODE - avail_bits)) - 1;  /* EOF */
+        }
+        hdec_long = hdecs_long[idx & ((1 << (LONGEST_CODE - LONG_CODE_PREFIX)) - 1)];
+        if (hdec_long.lens == 0 || hdec_long.lens > avail_bits)
+            return -1;
+        ++count;
+        avail_bits -= hdec_long.lens;
+    }
+
+    if (avail_bits >= SHORTEST_CODE)
+    {
+        idx = buf << (16 - avail_bits);
+        idx |= (1 << (16 - avail_bits)) - 1;    /* EOF */
+        if (idx == 0xFFFF && avail_bits < 8)
+            return count;
+        hdec = hdecs[idx];
+        if (hdec.lens == 0 || ((unsigned) hdec.lens >> 2) > avail_bits)
+            return -1;
+        count += hdec.lens & 3;
+        avail_bits -= hdec.lens >> 2;
+    }
+
+    if (avail_bits > 0)
+    {
+        if (avail_bits > 7
+                || ((1u << avail_bits) - 1) != (buf & ((1u << avail_bits) - 1)))
+            return -1;  /* Not EOF as expected */
+    }
+
+    return count;
+#else
+    struct decode_status status = { 0, 1 };
+    struct decode_el el;
+
+    for ( ; src < src_end; ++src)
+    {
+        el = decode_tables[status.state][*src >> 4];
+        if (el.flags & HPACK_HUFFMAN_FLAG_FAIL)
+            return -1;
+        count += (el.flags & HPACK_HUFFMAN_FLAG_SYM) != 0;
+        el = decode_tables[el.state][*src & 0xF];
+        if (el.flags & HPACK_HUFFMAN_FLAG_FAIL)
+            return -1;
+        count += (el.flags & HPACK_HUFFMAN_FLAG_SYM) != 0;
+        status.state = el.state;
+        status.eos = (el.flags & HPACK_HUFFMAN_FLAG_ACCEPTED) != 0;
+    }
+
+    if (!status.eos)
+        return -1;
+
+    return count;
+#endif
+}
+
+
+int
+lshpack_dec_huff_validate (const unsigned char *src, int src_len)
+{
+    if (lshpack_dec_huff_length(src, src_len) >= 0)
+        return LSHPACK_OK;
+    else
+        return LSHPACK_ERR_BAD_DATA;
+}
 #if __GNUC__
 #pragma GCC diagnostic pop  /* -Wunknown-pragmas */
 #endif
@@ -31,6 +31,7 @@ extern "C" {
 
 #include <limits.h>
 #include <stdint.h>
+#include <sys/uio.h>
 #include "lsxpack_header.h"
 
 #define LSHPACK_MAJOR_VERSION 2
@@ -40,6 +41,9 @@ extern "C" {
 #define lshpack_strlen_t lsxpack_strlen_t
 #define LSHPACK_MAX_STRLEN LSXPACK_MAX_STRLEN
 
+/* Defaults for new decoders; see lshpack_dec_use_http1x() and
+ * lshpack_dec_use_hash().
+ */
 #ifndef LSHPACK_DEC_HTTP1X_OUTPUT
 #define LSHPACK_DEC_HTTP1X_OUTPUT 1
 #endif
@@ -49,6 +53,7 @@ extern "C" {
 
 struct lshpack_enc;
 struct lshpack_dec;
+struct lshpack_app_reg;
 
 enum lshpack_static_hdr_idx
 {
@@ -119,6 +124,9 @@ enum lshpack_static_hdr_idx
 
 #define LSHPACK_MAX_INDEX           61
 
+#define LSHPACK_ERR_LIMIT           (-6)
+#define LSHPACK_ERR_MALFORMED       (-5)
+#define LSHPACK_ERR_MORE_DATA       (-4)
 #define LSHPACK_ERR_MORE_BUF        (-3)
 #define LSHPACK_ERR_TOO_LARGE       (-2)
 #define LSHPACK_ERR_BAD_DATA        (-1)
@@ -137,6 +145,30 @@ lshpack_enc_init (struct lshpack_enc *);
 void
 lshpack_enc_cleanup (struct lshpack_enc *);
 
+/**
+ * Return the encoder to the state it is in after lshpack_enc_init(), so
+ * that it can be used for a new connection: the dynamic table is emptied,
+ * history is cleared, and the maximum table size goes back to 4096.
+ * Whether history is used and the application registry are kept.
+ *
+ * The bucket array and the history buffer are kept for reuse, unless they
+ * are larger than `max_keep' bytes, in which case they are shrunk back to
+ * their initial size.  Pass SIZE_MAX to keep everything, 0 to keep only
+ * what lshpack_enc_init() allocates.
+ */
+void
+lshpack_enc_reset (struct lshpack_enc *, size_t max_keep);
+
+/**
+ * Return the number of bytes the encoder has allocated: the dynamic table
+ * slots and names and values, the hash buckets, the history buffer and
+ * the buffer lazily decoded values are decoded into.
+ * The encoder structure itself and the allocator's own overhead are not
+ * included.
+ */
+size_t
+lshpack_enc_mem_used (const struct lshpack_enc *);
+
 /**
  * @brief Encode one name/value pair
  *
@@ -145,6 +177,9 @@ lshpack_enc_cleanup (struct lshpack_enc *);
  * @param[out] dst_end - A pointer to end of destination buffer
  * @param[in] input - Header to encode
  *
+ * A value left Huffman-encoded by lazy Huffman decoding is decoded first,
+ * so decoded headers can be passed to the encoder as they are.
+ *
  * @return The (possibly advanced) dst pointer.  If the destination
  * pointer was not advanced, an error must have occurred.
  */
@@ -181,32 +216,418 @@ lshpack_dec_init (struct lshpack_dec *);
 void
 lshpack_dec_cleanup (struct lshpack_dec *);
 
+/**
+ * Return the decoder to the state it is in after lshpack_dec_init(), so
+ * that it can be used for a new connection: the dynamic table is emptied
+ * and the maximum table size goes back to 4096.  The evict callback is not
+ * called for the entries dropped.  Options, limits, the evict callback and
+ * the application registry are kept.
+ *
+ * The dynamic table array and the resume buffer are kept for reuse unless
+ * they are larger than `max_keep' bytes.  Pass SIZE_MAX to keep both.
+ */
+void
+lshpack_dec_reset (struct lshpack_dec *, size_t max_keep);
+
+/**
+ * Return the number of bytes the decoder has allocated: the dynamic table
+ * entries, the array that points to them and the resume buffer.  The
+ * decoder structure itself and the allocator's own overhead are not
+ * included.
+ */
+size_t
+lshpack_dec_mem_used (const struct lshpack_dec *);
+
 /*
  * Returns 0 on success, a negative value on failure.
  *
  * If 0 is returned, `src' is advanced.  Calling with a zero-length input
- * buffer results in an error.
+ * buffer results in an error.  LSHPACK_ERR_MALFORMED means the header is
+ * decoded and `src' is advanced, but the header is invalid (see
+ * lshpack_dec_use_validation()).  LSHPACK_ERR_LIMIT means the header block
+ * is over the limits (see lshpack_dec_set_limits()): `src' is advanced,
+ * but the header may not be decoded.
  *
  * To calculate number of bytes written to the output buffer:
  *  output->name_len + output->val_len + lshpack_dec_extra_bytes(dec)
+ *
+ * If LSHPACK_ERR_MORE_BUF is returned, `src' is not advanced and
+ * output->val_len is set to the exact number of bytes the output buffer
+ * must have to decode this header.  Huffman-encoded strings decoded while
+ * working this out are kept in the decoder, so that calling again with the
+ * same `src' and a larger buffer does not decode them a second time.
  */
 int
 lshpack_dec_decode (struct lshpack_dec *dec,
     const unsigned char **src, const unsigned char *src_end,
     struct lsxpack_header *output);
 
+/**
+ * Decoded header block.  Headers point into the arena, which is shared by
+ * all of them, or elsewhere if they are views (see lshpack_dec_use_views()).
+ * The structure can be reused for many blocks to avoid allocations.
+ */
+struct lshpack_dec_block
+{
+    struct lsxpack_header  *headers;
+    unsigned                n_headers;
+    unsigned                n_alloc;
+    char                   *arena;
+    size_t                  arena_used;
+    size_t                  arena_size;
+};
+
+void
+lshpack_dec_block_init (struct lshpack_dec_block *);
+
+/**
+ * Free memory allocated by lshpack_dec_decode_block().
+ */
+void
+lshpack_dec_block_cleanup (struct lshpack_dec_block *);
+
+/**
+ * Decode complete header block [src, src_end) into `block', replacing its
+ * previous contents.  Returns 0 on success or a negative value on failure.
+ *
+ * If the total length of names and values exceeds `max_size', the rest of
+ * the block is still decoded to keep the dynamic table in sync, but the
+ * headers are discarded: `block' is left empty and LSHPACK_ERR_TOO_LARGE
+ * is returned.  Zero `max_size' means no limit.  The same happens if the
+ * block is over the decoder limits (see lshpack_dec_set_limits()).  If any
+ * header is malformed, the whole block is decoded and
+ * LSHPACK_ERR_MALFORMED is returned.
+ */
+int
+lshpack_dec_decode_block (struct lshpack_dec *dec,
+    const unsigned char *src, const unsigned char *src_end,
+    struct lshpack_dec_block *block, size_t max_size);
+
+/**
+ * State of a header block that is fed to the decoder in fragments, as it
+ * arrives in HEADERS and CONTINUATION frames.  Only a representation that
+ * is split between two fragments is copied; the rest are decoded in place.
+ */
+struct lshpack_dec_stream
+{
+    unsigned char          *hds_buf;        /* Split representation */
+    size_t                  hds_buf_len;
+    size_t                  hds_buf_alloc;
+    size_t                  hds_rep_len;    /* Bytes scanned so far */
+    size_t                  hds_min_size;   /* Smallest header list size */
+    uint64_t                hds_int;        /* Partially read integer */
+    uint32_t                hds_str_left;   /* Unread string bytes */
+    unsigned char           hds_state;
+    unsigned char           hds_n_str;      /* Strings left to read */
+    unsigned char           hds_n_cont;     /* Integer continuation bytes */
+    unsigned char           hds_flags;
+};
+
+void
+lshpack_dec_stream_init (struct lshpack_dec_stream *);
+
+void
+lshpack_dec_stream_cleanup (struct lshpack_dec_stream *);
+
+/**
+ * Decode the next header from fragment [*src, src_end) of a header block.
+ * Returns 0 if a header is decoded into `output' and LSHPACK_ERR_MORE_DATA
+ * if the fragment is used up before the header is complete: call again
+ * with the next fragment.  Other return values are as for
+ * lshpack_dec_decode(); after LSHPACK_ERR_MORE_BUF, call again with the
+ * same `src' and a larger buffer.  `src' is advanced past the bytes used.
+ *
+ * String lengths are checked as soon as they are read: a string too long
+ * to decode yields LSHPACK_ERR_TOO_LARGE, and a header over the decoder
+ * limits is skipped without being copied, as lshpack_dec_decode() would.
+ * Headers split between fragments are never decoded as views.
+ */
+int
+lshpack_dec_stream_decode (struct lshpack_dec *dec,
+    struct lshpack_dec_stream *stream,
+    const unsigned char **src, const unsigned char *src_end,
+    struct lsxpack_header *output);
+
+/**
+ * Call at the end of the header block.  Returns 0, or LSHPACK_ERR_BAD_DATA
+ * if the last representation is incomplete.  The stream is reset either
+ * way and can be used for the next block.
+ */
+int
+lshpack_dec_stream_end (struct lshpack_dec_stream *);
+
+/**
+ * HTTP/1.1 request or response head made from decoded headers.  The iovec
+ * array points to static strings, dynamic table entries and the decoded
+ * headers' buffers; nothing is copied, except that values left encoded by
+ * lazy Huffman decoding are decoded into `buf'.  It is valid for as long
+ * as the headers are: in particular, until the next header block is
+ * decoded.
+ */
+struct lshpack_h1_head
+{
+    struct iovec           *iov;
+    unsigned                n_iov;
+    unsigned                n_alloc;
+    size_t                  size;       /* Sum of iov_len */
+    char                   *buf;        /* Lazily decoded values */
+    size_t                  buf_size;
+};
+
+void
+lshpack_h1_head_init (struct lshpack_h1_head *);
+
+void
+lshpack_h1_head_cleanup (struct lshpack_h1_head *);
+
+/**
+ * Make HTTP/1.1 head from decoded headers, replacing previous contents of
+ * `head'.  Request line is made from :method, :path and :authority, which
+ * also becomes the Host header; status line is made from :status.  Other
+ * pseudo-headers are dropped and cookie headers are joined into one, as
+ * RFC 9113, Section 8.2.3 requires.  Values marked LSXPACK_VAL_HUFFMAN
+ * are decoded.  Only CONNECT requests may omit :path.  Returns 0 on success
+ * or LSHPACK_ERR_BAD_DATA if the pseudo-headers do not make a valid request
+ * or response, if a value cannot be decoded, or if a name or value is not
+ * valid as RFC 9113, Section 8.2.1 defines it (even if the decoder does
+ * not validate), as it could otherwise inject headers into HTTP/1.
+ */
+int
+lshpack_h1_head_build (struct lshpack_h1_head *,
+            const struct lsxpack_header *headers, unsigned n_headers);
+
+/**
+ * Return the length of the Huffman-encoded string once decoded, or a
+ * negative value if the string is invalid.  Nothing is written.
+ */
+int
+lshpack_dec_huff_length (const unsigned char *src, int src_len);
+
+/**
+ * Check whether the string is valid Huffman-encoded data without decoding
+ * it.  Returns LSHPACK_OK or LSHPACK_ERR_BAD_DATA.
+ */
+int
+lshpack_dec_huff_validate (const unsigned char *src, int src_len);
+
 /* Return number of extra bytes per header */
+#define lshpack_dec_extra_bytes(dec_) \
+                        ((dec_)->hpd_flags & LSHPACK_DEC_HTTP1X ? 4 : 0)
+
+/* Extra bytes after name and after value for the default output format */
 #if LSHPACK_DEC_HTTP1X_OUTPUT
 #define LSHPACK_DEC_HTTP1X_EXTRA  (2)
-#define lshpack_dec_extra_bytes(dec_) (4)
 #else
 #define LSHPACK_DEC_HTTP1X_EXTRA  (0)
-#define lshpack_dec_extra_bytes(dec_) (0)
 #endif
 
 void
 lshpack_dec_set_max_capacity (struct lshpack_dec *, unsigned);
 
+/**
+ * Turn lazy Huffman decoding of header values on or off.  When it is on,
+ * Huffman-encoded literal values that are not added to the dynamic table
+ * are copied to the output buffer as is and the header is marked with
+ * LSXPACK_VAL_HUFFMAN.  Its hash is not calculated; use
+ * lshpack_dec_decode_value() to get the actual value.  While validation or
+ * HTTP/1.x output is on (see lshpack_dec_use_validation() and
+ * lshpack_dec_use_http1x()), values are decoded right away.  Off by default.
+ */
+void
+lshpack_dec_use_lazy_huff (struct lshpack_dec *, int on);
+
+/**
+ * Turn HTTP/1.x output on or off.  When it is on, the name is followed by
+ * ": " and the value by "\r\n" in the output buffer.  The default is set
+ * by LSHPACK_DEC_HTTP1X_OUTPUT.
+ */
+void
+lshpack_dec_use_http1x (struct lshpack_dec *, int on);
+
+/**
+ * Turn calculation of name and nameval hashes of literal headers on or
+ * off.  The default is set by LSHPACK_DEC_CALC_HASH.  With hashing off,
+ * hashes are only copied from the static table and from dynamic table
+ * entries that have them; use lshpack_dec_calc_hash() to get the rest.
+ */
+void
+lshpack_dec_use_hash (struct lshpack_dec *, int on);
+
+/**
+ * Turn validation of header names and values on or off.  When it is on,
+ * literals are checked against RFC 9113, Section 8.2.1 while they are
+ * decoded: names may not contain uppercase letters, controls, SP, DEL,
+ * non-ASCII bytes or a colon other than the leading one; values may not
+ * contain NUL, CR or LF or start or end with SP or HTAB.  A malformed
+ * header is decoded as usual, but LSHPACK_ERR_MALFORMED is returned instead
+ * of 0.  The verdict is kept in dynamic table entries, so headers that
+ * refer to a malformed entry are malformed, too.  Lazy Huffman decoding
+ * is suspended while validation is on.  Entries added while validation was
+ * off are not checked.  Off by default.
+ */
+void
+lshpack_dec_use_validation (struct lshpack_dec *, int on);
+
+/**
+ * Limit header blocks.  `max_list_size' is the maximum header list size
+ * as defined by SETTINGS_MAX_HEADER_LIST_SIZE: the sum of name and value
+ * lengths plus 32 bytes per header.  `max_headers' is the maximum number
+ * of headers.  `max_ratio' is the maximum header list size per byte of
+ * input; it is only enforced once the list grows past 4 KB, as a few
+ * indexed headers expand a lot.  Zero means no limit.
+ *
+ * Limits are checked as soon as the string lengths are known, before the
+ * strings are decoded.  Once a block is over a limit, lshpack_dec_decode()
+ * returns LSHPACK_ERR_LIMIT for each of its remaining headers: strings are
+ * skipped, except those that must be added to the dynamic table.  Keep
+ * calling it until the end of the block to keep the table in sync, then
+ * reject the block.
+ *
+ * Call lshpack_dec_start_block() before each block, unless you use
+ * lshpack_dec_decode_block(), which does it for you.
+ */
+void
+lshpack_dec_set_limits (struct lshpack_dec *, unsigned max_list_size,
+                                    unsigned max_headers, unsigned max_ratio);
+
+/**
+ * Reset usage counted against the limits at the start of a header block.
+ */
+void
+lshpack_dec_start_block (struct lshpack_dec *);
+
+/**
+ * Calculate name and nameval hashes of a decoded header if they are not
+ * set yet.  If the header comes from a dynamic table entry, the hashes are
+ * cached in the entry, so later headers decoded from it have them already.
+ * The nameval hash of a value marked LSXPACK_VAL_HUFFMAN is not calculated.
+ *
+ * Until LSXPACK_NAMEVAL_HASH is set, the decoder uses `nameval_hash' to
+ * find the entry: do not modify it.
+ */
+void
+lshpack_dec_calc_hash (struct lshpack_dec *, struct lsxpack_header *);
+
+/**
+ * Build registry of header names known to the application.  The name at
+ * names[i] gets app_index i + 1; at most 255 names may be registered.
+ * Names are copied.  Returns 0 on success or -1 if names are duplicated
+ * or memory could not be allocated.
+ */
+int
+lshpack_app_reg_init (struct lshpack_app_reg *, const char *const *names,
+                                                            unsigned n_names);
+
+void
+lshpack_app_reg_cleanup (struct lshpack_app_reg *);
+
+/**
+ * Return app_index of the name or 0 if the name is not registered.
+ */
+unsigned
+lshpack_app_reg_lookup (const struct lshpack_app_reg *, const char *name,
+                                                            unsigned name_len);
+
+/**
+ * Have the decoder set app_index and LSXPACK_APP_IDX in each decoded header
+ * whose name is in the registry.  The registry must outlive the decoder.
+ * Pass NULL to turn this off.
+ */
+void
+lshpack_dec_set_app_reg (struct lshpack_dec *, const struct lshpack_app_reg *);
+
+/**
+ * When a header has LSXPACK_APP_IDX set, have the encoder take the name
+ * hash and static table index from the registry instead of calculating
+ * them.  The registry must outlive the encoder.  Pass NULL to turn this
+ * off.
+ */
+void
+lshpack_enc_set_app_reg (struct lshpack_enc *, const struct lshpack_app_reg *);
+
+/**
+ * Turn view mode on or off.  In view mode, the decoder does not copy the
+ * name and value to the output buffer if they can be found next to each
+ * other in the static table, in a dynamic table entry, or in the input
+ * (when neither is Huffman-encoded).  Instead, output->buf is changed to
+ * point to them and output->dec_overhead is zero: nothing is written to the
+ * output buffer, not even the HTTP/1.x separators.  Other headers are
+ * decoded as usual.
+ *
+ * Views into the input are valid as long as the input is.  Views into a
+ * dynamic table entry are valid until the entry is evicted; the eviction
+ * callback below is called right before that happens.  Off by default.
+ *
+ * To save memory, entries added while view mode is off may not store the
+ * name next to the value; headers that refer to them are copied.
+ */
+void
+lshpack_dec_use_views (struct lshpack_dec *, int on);
+
+/**
+ * The eviction callback is passed the value that output->buf has in views
+ * into the entry being evicted.  The memory is still valid when the
+ * callback is called.
+ */
+typedef void (*lshpack_dec_evict_f)(void *ctx, const char *buf);
+
+void
+lshpack_dec_set_evict_cb (struct lshpack_dec *, lshpack_dec_evict_f,
+                                                                void *ctx);
+
+/**
+ * Write the header value, decoding it if necessary, to `dst'.  Returns the
+ * number of bytes written or a negative value on error:
+ * LSHPACK_ERR_MORE_BUF if `dst' is too small -- use lshpack_dec_huff_length()
+ * to find out how much room is needed -- or LSHPACK_ERR_BAD_DATA if the
+ * value could not be decoded.
+ */
+int
+lshpack_dec_decode_value (const struct lsxpack_header *, char *dst,
+                                                            size_t dst_len);
+
+#if LSHPACK_PROFILE
+/**
+ * Cycle accounting, compiled in when LSHPACK_PROFILE is set.  Time stamp
+ * counter cycles spent in each phase of encoding and decoding are added
+ * up; time spent in a nested phase counts only toward it.  ENCODE and
+ * DECODE get what is left over: parsing and glue code.  The decoder hashes
+ * and checks strings in the same pass that copies them, so that time is
+ * part of DECODE.  Counters are per thread.
+ */
+enum lshpack_prof_phase
+{
+    LSHPACK_PROF_ENCODE,
+    LSHPACK_PROF_DECODE,
+    LSHPACK_PROF_HASH,              /* Encoder only, see below */
+    LSHPACK_PROF_STATIC_LOOKUP,
+    LSHPACK_PROF_DYNAMIC_LOOKUP,
+    LSHPACK_PROF_HUFF_ENCODE,       /* String literals */
+    LSHPACK_PROF_HUFF_DECODE,
+    LSHPACK_PROF_PUSH,              /* Adding dynamic table entries */
+    LSHPACK_PROF_EVICT,
+    LSHPACK_PROF_INT,               /* Integer encoding and decoding */
+    LSHPACK_PROF_N_PHASES
+};
+
+struct lshpack_prof
+{
+    uint64_t    cycles[LSHPACK_PROF_N_PHASES];
+    uint64_t    calls[LSHPACK_PROF_N_PHASES];
+};
+
+/* Copy current thread's counters */
+void
+lshpack_prof_get (struct lshpack_prof *);
+
+/* Zero current thread's counters */
+void
+lshpack_prof_reset (void);
+
+const char *
+lshpack_prof_phase_name (enum lshpack_prof_phase);
+#endif
+
 /* Some internals follow.  Struct definitions are exposed to save a malloc.
  * These structures are not very complicated.
  */
@@ -225,10 +646,8 @@ lshpack_dec_set_max_capacity (struct lshpack_dec *, unsigned);
 #define STAILQ_FOREACH          SIMPLEQ_FOREACH
 #endif
 
-struct lshpack_enc_table_entry;
-
-STAILQ_HEAD(lshpack_enc_head, lshpack_enc_table_entry);
-struct lshpack_double_enc_head;
+struct lshpack_enc_slot;
+struct lshpack_enc_bucket;
 
 struct lshpack_enc
 {
@@ -241,16 +660,22 @@ struct lshpack_enc
      */
     unsigned            hpe_next_id;
 
-    /* Dynamic table entries (struct enc_table_entry) live in two hash
-     * tables: name/value hash table and name hash table.  These tables
-     * are the same size.
+    /* Dynamic table entries are kept in a ring of slots indexed by entry
+     * ID.  A slot holds the hashes and the lengths; names and values are
+     * stored in the payload buffer, oldest first.  Each entry is on two
+     * hash chains, by name/value and by name, linked by entry ID.  There
+     * are N_BUCKETS(hpe_nbits) buckets and half as many slots.
      */
     unsigned            hpe_nelem;
     unsigned            hpe_nbits;
-    struct lshpack_enc_head
-                        hpe_all_entries;
-    struct lshpack_double_enc_head
+    struct lshpack_enc_slot
+                       *hpe_slots;
+    struct lshpack_enc_bucket
                        *hpe_buckets;
+    char               *hpe_payload;
+    unsigned            hpe_pl_nalloc,
+                        hpe_pl_off,     /* Oldest entry */
+                        hpe_pl_end;     /* Past the newest entry */
 
     uint32_t           *hpe_hist_buf;
     unsigned            hpe_hist_size, hpe_hist_idx;
@@ -258,6 +683,11 @@ struct lshpack_enc
     enum {
         LSHPACK_ENC_USE_HIST    = 1 << 0,
     }                   hpe_flags;
+    const struct lshpack_app_reg
+                       *hpe_app_reg;
+    /* Lazily decoded values are decoded here before they are encoded */
+    char               *hpe_huff_buf;
+    unsigned            hpe_huff_nalloc;
 };
 
 struct lshpack_arr
@@ -275,6 +705,66 @@ struct lshpack_dec
     unsigned           hpd_cur_max_capacity;   /* Adjusted at runtime */
     unsigned           hpd_cur_capacity;
     unsigned           hpd_state;
+    uint32_t           hpd_ins_count;          /* Entries ever added */
+    size_t             hpd_entries_size;       /* Allocated for entries */
+    enum {
+        LSHPACK_DEC_LAZY_HUFF   = 1 << 0,
+        LSHPACK_DEC_VIEWS       = 1 << 1,
+        LSHPACK_DEC_HTTP1X      = 1 << 2,
+        LSHPACK_DEC_HASH        = 1 << 3,
+        LSHPACK_DEC_VALIDATE    = 1 << 4,
+        LSHPACK_DEC_LIMITS      = 1 << 5,
+    }                  hpd_flags;
+    lshpack_dec_evict_f
+                       hpd_evict_cb;
+    void              *hpd_evict_ctx;
+    const struct lshpack_app_reg
+                      *hpd_app_reg;
+    /* Huffman-encoded literals of the header that did not fit into the
+     * output buffer.  `buf' holds a copy of the encoded literals followed
+     * by the decoded name and value; a length of -1 means not saved.
+     */
+    struct {
+        const unsigned char *src;
+        unsigned char       *buf;
+        unsigned             nalloc;
+        unsigned             enc_len;
+        unsigned             lit_len;
+        int                  name_len;
+        int                  val_len;
+    }                  hpd_resume;
+    /* Limits set by lshpack_dec_set_limits() and what the current header
+     * block has used up so far.
+     */
+    struct {
+        unsigned             max_list_size;
+        unsigned             max_headers;
+        unsigned             max_ratio;
+        unsigned             n_headers;
+        size_t               list_size;
+        size_t               in_bytes;
+        int                  exceeded;
+    }                  hpd_limits;
+};
+
+/* Names are found using a perfect hash of their XXH32 name hash: */
+struct lshpack_app_reg
+{
+    struct lshpack_app_name
+    {
+        const char     *an_name;
+        unsigned        an_name_len;
+        uint32_t        an_name_hash;
+        uint8_t         an_hpack_index;     /* Set if name is unique in
+                                             * the static table.
+                                             */
+    }                  *ar_names;           /* Indexed by app_index - 1 */
+    unsigned            ar_count;
+    unsigned            ar_nbits;
+    uint32_t            ar_mult;
+    uint8_t            *ar_slots;           /* app_index or 0 */
+    uint8_t             ar_static[LSHPACK_HDR_WWW_AUTHENTICATE];
+                                            /* app_index by static index */
 };
 
 /* This function may update hash values and flags */
@@ -32,6 +32,7 @@ enum lsxpack_flag
     LSXPACK_NAMEVAL_HASH = 16,
     LSXPACK_VAL_MATCHED = 32,
     LSXPACK_NEVER_INDEX = 64,
+    LSXPACK_VAL_HUFFMAN = 128,  /* value is still Huffman-encoded */
 };
 
 /**
@@ -159,7 +160,8 @@ static inline void
 lsxpack_header_mark_val_changed(lsxpack_header_t *hdr)
 {
     hdr->flags = (enum lsxpack_flag)(hdr->flags &
-       ~(LSXPACK_HPACK_VAL_MATCHED|LSXPACK_VAL_MATCHED|LSXPACK_NAMEVAL_HASH));
+       ~(LSXPACK_HPACK_VAL_MATCHED|LSXPACK_VAL_MATCHED|LSXPACK_NAMEVAL_HASH
+         |LSXPACK_VAL_HUFFMAN));
 }
 #ifdef __cplusplus
 }
@@ -993,6 +993,42 @@ test_hdec_table_size_updates (void)
 }
 
 
+/* Entries are evicted as soon as an insertion puts the table over its
+ * capacity.
+ */
+static void
+test_hdec_evict_on_insert (void)
+{
+    struct lshpack_dec hdec;
+    struct lsxpack_header xhdr;
+    const unsigned char *src;
+    unsigned char buf[0x40];
+    char outbuf[0x100];
+    unsigned i;
+    int s;
+
+    lshpack_dec_init(&hdec);
+    lshpack_dec_set_max_capacity(&hdec, 256);
+    for (i = 0; i < 100; ++i)
+    {
+        /* Literal with incremental indexing, new name: 32 + 4 + 20 bytes */
+        buf[0] = 0x40;
+        buf[1] = 4;
+        snprintf((char *) buf + 2, 5, "x-%02u", i);
+        buf[6] = 20;
+        memset(buf + 7, 'a' + i % 26, 20);
+        src = buf;
+        lsxpack_header_prepare_decode(&xhdr, outbuf, 0, sizeof(outbuf));
+        s = decode_and_check_hashes(&hdec, &src, buf + 27, &xhdr);
+        assert(s == 0);
+        assert(src == buf + 27);
+        assert(hdec.hpd_cur_capacity <= 256);
+        assert(hdec.hpd_dyn_table.nelem == (i < 4 ? i + 1 : 4));
+    }
+    lshpack_dec_cleanup(&hdec);
+}
+
+
 /* Test that if empty buffer is given writing is not done */
 static void
 test_henc_boundary1 (void)
@@ -1488,6 +1524,54 @@ test_huff_dec_fallback (void)
 }
 
 
+/* Exercise every symbol, including the ones with codes longer than 16 bits,
+ * at different bit offsets and with different amounts of output space.
+ */
+static void
+test_huff_dec_all_symbols (void)
+{
+    const unsigned char *src;
+    unsigned char input[0x40];
+    unsigned sym, len, i;
+    int comp_sz, dec_sz;
+    unsigned char comp[0x100];
+    unsigned char out[0x100];
+
+    for (sym = 0; sym < 256; ++sym)
+        for (len = 1; len < sizeof(input); len += 7)
+        {
+            for (i = 0; i < len; ++i)
+                input[i] = (i % 3 == 0) ? sym : (unsigned char) "abc-/ "[i % 6];
+            src = input;
+            comp_sz = lshpack_enc_huff_encode(src, src + len, comp,
+                                                                sizeof(comp));
+            assert(comp_sz > 0);
+            dec_sz = lshpack_dec_huff_decode(comp, comp_sz, out, sizeof(out));
+            assert(dec_sz == (int) len);
+            assert(0 == memcmp(out, input, len));
+            assert(lshpack_dec_huff_length(comp, comp_sz) == (int) len);
+            assert(lshpack_dec_huff_validate(comp, comp_sz) == LSHPACK_OK);
+            dec_sz = lshpack_dec_huff_decode(comp, comp_sz, out, len - 1);
+            assert(dec_sz < 0);
+            /* Truncated input must not decode to the same string */
+            dec_sz = lshpack_dec_huff_decode(comp, comp_sz - 1, out,
+                                                                sizeof(out));
+            assert(dec_sz != (int) len);
+            assert(lshpack_dec_huff_length(comp, comp_sz - 1) == dec_sz);
+            comp[comp_sz] = 0xFF;   /* Too much padding */
+            assert(lshpack_dec_huff_length(comp, comp_sz + 1) < 0);
+            assert(lshpack_dec_huff_validate(comp, comp_sz + 1)
+                                                    == LSHPACK_ERR_BAD_DATA);
+#if LS_HPACK_USE_LARGE_TABLES
+            dec_sz = lshpack_dec_huff_decode_full(comp, comp_sz, out,
+                                                                sizeof(out));
+            assert(dec_sz == (int) len);
+            assert(0 == memcmp(out, input, len));
+#endif
+        }
+}
+
+
 #if LS_HPACK_USE_LARGE_TABLES
 static void
 test_huff_dec_bad_eos (void)
@@ -1547,6 +1631,7 @@ test_hdec_boundary (void)
         { .name = IOV(":path"), .value = IOV("FINDER!"), },
         { .name = IOV("cheese"), .value = IOV("puffs"), },
         { .name = IOV(":status"), .value = IOV("200"), },
+        { .name = IOV("x-binary"), .value = IOV("\x01\x7F\\ caf\xC3\xA9"), },
     }, *header;
     size_t enc_sz, sz, out_sz;
     unsigned n;
@@ -1575,7 +1660,7 @@ test_hdec_boundary (void)
     for (n = 0; n < sizeof(headers) / sizeof(headers[0]); ++n)
     {
         out_sz = headers[n].name.iov_len + headers[n].value.iov_len
-            + lshpack_dec_extra_bytes(headers[n]);
+            + lshpack_dec_extra_bytes(&hdec);
         /* Inside this loop, there is not enough room for output, should
          * return an error:
          */
@@ -1584,7 +1669,9 @@ test_hdec_boundary (void)
             lsxpack_header_prepare_decode(&xhdr, out, 0, sz);
             orig_p = p;
             rc = decode_and_check_hashes(&hdec, &p, encbuf + enc_sz, &xhdr);
-            assert(rc < 0);
+            assert(rc == LSHPACK_ERR_MORE_BUF);
+            /* The exact size required is reported back: */
+            assert(xhdr.val_len == out_sz);
             p = orig_p;
         }
         lsxpack_header_prepare_decode(&xhdr, out, 0, sz);
@@ -1601,41 +1688,1769 @@ test_hdec_boundary (void)
 }
 
 
-int
-main (int argc, char **argv)
+static void
+test_hdec_lazy_huff (void)
 {
-    test_header_arr();
+    struct lshpack_enc henc;
+    struct lshpack_dec hdec;
+    struct lsxpack_header xhdr;
+    static const char value[] = "Mozilla/5.0 (X11; Linux x86_64; rv:82.0)";
+    const unsigned idx_types[] = { 1, 2, 0, };
+    unsigned n;
+    int rc;
+    const unsigned char *p, *end;
+    unsigned char encbuf[0x200];
+    char out[0x100], val_out[0x100];
 
-    /* Now do the same thing, but with longer codes to exercise the fallback
-     * mechanism.
+    lshpack_enc_init(&henc);
+    end = encbuf;
+    for (n = 0; n < sizeof(idx_types) / sizeof(idx_types[0]); ++n)
+    {
+        lsxpack_header_set_ptr(&xhdr, "x-lazy", 6, value, sizeof(value) - 1);
+        xhdr.indexed_type = idx_types[n];
+        p = lshpack_enc_encode(&henc, (unsigned char *) end,
+                                        encbuf + sizeof(encbuf), &xhdr);
+        assert(p > end);
+        end = p;
+    }
+    lshpack_enc_cleanup(&henc);
+
+    lshpack_dec_init(&hdec);
+    lshpack_dec_use_lazy_huff(&hdec, 1);
+    lshpack_dec_use_http1x(&hdec, 0);
+    p = encbuf;
+    for (n = 0; n < sizeof(idx_types) / sizeof(idx_types[0]); ++n)
+    {
+        lsxpack_header_prepare_decode(&xhdr, out, 0, 0);
+        rc = lshpack_dec_decode(&hdec, &p, end, &xhdr);
+        assert(rc == LSHPACK_ERR_MORE_BUF);
+        lsxpack_header_prepare_decode(&xhdr, out, 0, xhdr.val_len);
+        rc = lshpack_dec_decode(&hdec, &p, end, &xhdr);
+        assert(rc == 0);
+        assert(xhdr.name_len == 6);
+        assert(0 == memcmp(lsxpack_header_get_name(&xhdr), "x-lazy", 6));
+        if (idx_types[n] == 0)
+        {
+            /* Added to the dynamic table: must be decoded */
+            assert(!(xhdr.flags & LSXPACK_VAL_HUFFMAN));
+            assert(xhdr.val_len == sizeof(value) - 1);
+        }
+        else
+        {
+            assert(xhdr.flags & LSXPACK_VAL_HUFFMAN);
+            assert(!(xhdr.flags & LSXPACK_NAMEVAL_HASH));
+            assert(xhdr.val_len < sizeof(value) - 1);
+            assert(lshpack_dec_huff_length(
+                    (unsigned char *) lsxpack_header_get_value(&xhdr),
+                    xhdr.val_len) == sizeof(value) - 1);
+        }
+        rc = lshpack_dec_decode_value(&xhdr, val_out, sizeof(value) - 2);
+        assert(rc == LSHPACK_ERR_MORE_BUF);
+        rc = lshpack_dec_decode_value(&xhdr, val_out, sizeof(val_out));
+        assert(rc == sizeof(value) - 1);
+        assert(0 == memcmp(val_out, value, sizeof(value) - 1));
+    }
+    assert(p == end);
+    lshpack_dec_cleanup(&hdec);
+}
+
+
+/* A proxy re-encodes headers decoded in lazy mode: the values are decoded
+ * by the encoder, so the next hop sees the actual values.  With validation
+ * on, values are not left encoded.
+ */
+static void
+test_lazy_reencode (void)
+{
+    struct lshpack_enc henc[2];
+    struct lshpack_dec hdec[2];
+    struct lsxpack_header xhdr;
+    static const char value[] = "Mozilla/5.0 (X11; Linux x86_64; rv:82.0)";
+    static const char bad_value[] =
+        "some-ordinary-looking-text-that-hides\r\nx-injected: 1";
+    const unsigned char *p;
+    unsigned char *end, *end2;
+    unsigned char encbuf[0x100], encbuf2[0x100];
+    char out[0x100];
+    unsigned n;
+    int rc;
+
+    for (n = 0; n < 2; ++n)
+    {
+        rc = lshpack_enc_init(&henc[n]);
+        assert(rc == 0);
+        lshpack_dec_init(&hdec[n]);
+    }
+    lshpack_dec_use_lazy_huff(&hdec[0], 1);
+    lshpack_dec_use_http1x(&hdec[0], 0);
+
+    lsxpack_header_set_ptr(&xhdr, "x-lazy", 6, value, sizeof(value) - 1);
+    xhdr.indexed_type = 1;
+    end = lshpack_enc_encode(&henc[0], encbuf, encbuf + sizeof(encbuf), &xhdr);
+    assert(end > encbuf);
+
+    /* The same lazy header is re-encoded twice: the second time, it is
+     * found in the dynamic table.
      */
-    insert_long_codes_into_header_arr();
-    test_header_arr();
+    p = encbuf;
+    lsxpack_header_prepare_decode(&xhdr, out, 0, sizeof(out));
+    rc = lshpack_dec_decode(&hdec[0], &p, end, &xhdr);
+    assert(rc == 0 && p == end);
+    assert(xhdr.flags & LSXPACK_VAL_HUFFMAN);
+    end2 = encbuf2;
+    for (n = 0; n < 2; ++n)
+    {
+        p = lshpack_enc_encode(&henc[1], end2, encbuf2 + sizeof(encbuf2),
+                                                                    &xhdr);
+        assert(p > end2);
+        if (n == 1)
+            assert(p - end2 == 1);
+        end2 = (unsigned char *) p;
+    }
+    assert(lshpack_enc_mem_used(&henc[1]) > lshpack_enc_mem_used(&henc[0]));
 
-    test_decode_limits();
-    test_static_table_search_simple();
-    test_static_table_search_exhaustive();
-    test_hpack_test_RFC_Example();
-    test_hpack_self_enc_dec_test();
-    test_hpack_encode_and_decode();
-    test_hpack_self_enc_dec_test_firefox_error();
-    test_hdec_table_size_updates();
-    test_henc_boundary1();
-    test_henc_boundary2();
-    test_henc_nonascii();
-    test_henc_long_compressable();
-    test_henc_long_uncompressable();
-    test_huffman_encoding_corner_cases();
+    for (p = encbuf2, n = 0; p < end2; ++n)
+    {
+        lsxpack_header_prepare_decode(&xhdr, out, 0, sizeof(out));
+        rc = lshpack_dec_decode(&hdec[1], &p, end2, &xhdr);
+        assert(rc == 0);
+        assert(!(xhdr.flags & LSXPACK_VAL_HUFFMAN));
+        assert(xhdr.name_len == 6);
+        assert(0 == memcmp(lsxpack_header_get_name(&xhdr), "x-lazy", 6));
+        assert(xhdr.val_len == sizeof(value) - 1);
+        assert(0 == memcmp(lsxpack_header_get_value(&xhdr), value,
+                                                            xhdr.val_len));
+    }
+    assert(n == 2);
+
+    /* Validation suspends lazy decoding */
+    lsxpack_header_set_ptr(&xhdr, "x-lazy", 6, bad_value,
+                                                    sizeof(bad_value) - 1);
+    xhdr.indexed_type = 1;
+    end = lshpack_enc_encode(&henc[0], encbuf, encbuf + sizeof(encbuf), &xhdr);
+    assert(end > encbuf);
+    p = encbuf;
+    lsxpack_header_prepare_decode(&xhdr, out, 0, sizeof(out));
+    rc = lshpack_dec_decode(&hdec[0], &p, end, &xhdr);
+    assert(rc == 0 && p == end);
+    assert(xhdr.flags & LSXPACK_VAL_HUFFMAN);
+    lshpack_dec_use_validation(&hdec[0], 1);
+    p = encbuf;
+    lsxpack_header_prepare_decode(&xhdr, out, 0, sizeof(out));
+    rc = lshpack_dec_decode(&hdec[0], &p, end, &xhdr);
+    assert(rc == LSHPACK_ERR_MALFORMED && p == end);
+    assert(!(xhdr.flags & LSXPACK_VAL_HUFFMAN));
+    assert(xhdr.val_len == sizeof(bad_value) - 1);
 
-    test_huff_dec_empty_string();
-    test_huff_dec_trailing_garbage(1);
-    test_huff_dec_trailing_garbage(0);
-    test_huff_dec_fallback();
-#if LS_HPACK_USE_LARGE_TABLES
-    test_huff_dec_bad_eos();
-#endif
-    test_hdec_static_idx_0();
-    test_hdec_boundary();
+    for (n = 0; n < 2; ++n)
+    {
+        lshpack_dec_cleanup(&hdec[n]);
+        lshpack_enc_cleanup(&henc[n]);
+    }
+}
+
+
+static void
+test_hdec_resume (void)
+{
+    struct lshpack_enc henc;
+    struct lshpack_dec hdec;
+    struct lsxpack_header xhdr;
+    static const char *const values[] = {
+        "session=0123456789abcdef0123456789abcdef; theme=dark; lang=en-US",
+        "session=fedcba9876543210fedcba9876543210; theme=lite; lang=de-DE",
+    };
+    unsigned char enc[2][0x100];
+    unsigned enc_len[2], n;
+    size_t size;
+    int rc;
+    const unsigned char *p;
+    unsigned char in[0x100];
+    char out[0x100];
+
+    lshpack_enc_init(&henc);
+    for (n = 0; n < 2; ++n)
+    {
+        lsxpack_header_set_ptr(&xhdr, "x-cookie", 8, values[n],
+                                                        strlen(values[n]));
+        xhdr.indexed_type = 1;
+        p = lshpack_enc_encode(&henc, enc[n], enc[n] + sizeof(enc[n]), &xhdr);
+        assert(p > enc[n]);
+        enc_len[n] = p - enc[n];
+    }
+    lshpack_enc_cleanup(&henc);
+    assert(enc_len[0] == enc_len[1]);
+
+    lshpack_dec_init(&hdec);
+
+    /* Strings saved for one header are not used for another one that ends
+     * up at the same address.
+     */
+    memcpy(in, enc[0], enc_len[0]);
+    p = in;
+    lsxpack_header_prepare_decode(&xhdr, out, 0, 0);
+    rc = lshpack_dec_decode(&hdec, &p, in + enc_len[0], &xhdr);
+    assert(rc == LSHPACK_ERR_MORE_BUF);
+    assert(p == in);
+    size = xhdr.val_len;
+    memcpy(in, enc[1], enc_len[1]);
+    lsxpack_header_prepare_decode(&xhdr, out, 0, size);
+    rc = lshpack_dec_decode(&hdec, &p, in + enc_len[1], &xhdr);
+    assert(rc == 0);
+    assert(p == in + enc_len[1]);
+    assert(xhdr.val_len == strlen(values[1]));
+    assert(0 == memcmp(lsxpack_header_get_value(&xhdr), values[1],
+                                                                xhdr.val_len));
+
+    /* Retrying with too small a buffer reports the same size again */
+    memcpy(in, enc[0], enc_len[0]);
+    p = in;
+    lsxpack_header_prepare_decode(&xhdr, out, 0, 10);
+    rc = lshpack_dec_decode(&hdec, &p, in + enc_len[0], &xhdr);
+    assert(rc == LSHPACK_ERR_MORE_BUF);
+    assert(xhdr.val_len == size);
+    assert(hdec.hpd_resume.src == in + 1);  /* Past the 0x00 prefix */
+    assert(hdec.hpd_resume.name_len == 8);
+    assert(hdec.hpd_resume.val_len == (int) strlen(values[0]));
+    lsxpack_header_prepare_decode(&xhdr, out, 0, size - 1);
+    rc = lshpack_dec_decode(&hdec, &p, in + enc_len[0], &xhdr);
+    assert(rc == LSHPACK_ERR_MORE_BUF);
+    assert(xhdr.val_len == size);
+    lsxpack_header_prepare_decode(&xhdr, out, 0, size);
+    rc = lshpack_dec_decode(&hdec, &p, in + enc_len[0], &xhdr);
+    assert(rc == 0);
+    assert(p == in + enc_len[0]);
+    assert(hdec.hpd_resume.src == NULL);
+    assert(xhdr.name_len == 8);
+    assert(0 == memcmp(lsxpack_header_get_name(&xhdr), "x-cookie", 8));
+    assert(xhdr.val_len == strlen(values[0]));
+    assert(0 == memcmp(lsxpack_header_get_value(&xhdr), values[0],
+                                                                xhdr.val_len));
+
+    lshpack_dec_cleanup(&hdec);
+}
+
+
+static void
+evict_cb (void *ctx, const char *buf)
+{
+    const char **evicted = ctx;
+    *evicted = buf;
+}
+
+
+static void
+test_hdec_views (void)
+{
+    struct lshpack_enc henc;
+    struct lshpack_dec hdec;
+    struct lsxpack_header xhdr;
+    const struct {
+        struct iovec name;
+        struct iovec value;
+        unsigned     indexed_type;
+        int          is_view;
+    } headers[] = {
+        { IOV(":method"), IOV("GET"), 0, 1, },
+        { IOV("x-some-header"), IOV("some value"), 0, 0, },
+        { IOV("x-some-header"), IOV("some value"), 0, 1, },
+        { IOV("{|}~"), IOV("~~~~~~"), 1, 1, },
+        { IOV("{|}~"), IOV("~~~~~~"), 0, 1, },
+        { IOV("user-agent"), IOV("~~~~~~"), 1, 0, },
+    };
+    const char *evicted, *dyn_buf;
+    unsigned n;
+    int rc;
+    const unsigned char *p, *end;
+    unsigned char encbuf[0x200];
+    char out[0x100];
+
+    lshpack_enc_init(&henc);
+    end = encbuf;
+    for (n = 0; n < sizeof(headers) / sizeof(headers[0]); ++n)
+    {
+        lsxpack_header_set_ptr(&xhdr,
+                        headers[n].name.iov_base, headers[n].name.iov_len,
+                        headers[n].value.iov_base, headers[n].value.iov_len);
+        xhdr.indexed_type = headers[n].indexed_type;
+        p = lshpack_enc_encode(&henc, (unsigned char *) end,
+                                        encbuf + sizeof(encbuf), &xhdr);
+        assert(p > end);
+        end = p;
+    }
+    lshpack_enc_cleanup(&henc);
+
+    lshpack_dec_init(&hdec);
+    lshpack_dec_use_views(&hdec, 1);
+    evicted = NULL;
+    dyn_buf = NULL;
+    lshpack_dec_set_evict_cb(&hdec, evict_cb, &evicted);
+    p = encbuf;
+    for (n = 0; n < sizeof(headers) / sizeof(headers[0]); ++n)
+    {
+        lsxpack_header_prepare_decode(&xhdr, out, 0, sizeof(out));
+        rc = decode_and_check_hashes(&hdec, &p, end, &xhdr);
+        assert(rc == 0);
+        assert(headers[n].is_view == (xhdr.buf != out));
+        if (headers[n].is_view)
+            assert(xhdr.dec_overhead == 0);
+        assert(xhdr.name_len == headers[n].name.iov_len);
+        assert(xhdr.val_len == headers[n].value.iov_len);
+        assert(0 == memcmp(headers[n].name.iov_base,
+                            lsxpack_header_get_name(&xhdr), xhdr.name_len));
+        assert(0 == memcmp(headers[n].value.iov_base,
+                            lsxpack_header_get_value(&xhdr), xhdr.val_len));
+        if (n == 2)
+            dyn_buf = xhdr.buf;
+    }
+    assert(p == end);
+
+    /* The callback is called for the entry the view points to */
+    assert(dyn_buf);
+    lshpack_dec_set_max_capacity(&hdec, 80);
+    assert(evicted == dyn_buf);
+    lshpack_dec_cleanup(&hdec);
+}
+
+
+static void
+test_hdec_block (void)
+{
+    struct lshpack_enc henc;
+    struct lshpack_dec hdec;
+    struct lshpack_dec_block block;
+    struct lsxpack_header xhdr;
+    const unsigned n_headers = 500;
+    unsigned i, round;
+    int rc;
+    unsigned char *p, *end, *encbuf;
+    const size_t encbuf_sz = 0x10000;
+
+    encbuf = malloc(encbuf_sz);
+    assert(encbuf);
+    lshpack_enc_init(&henc);
+    lshpack_dec_init(&hdec);
+    lshpack_dec_block_init(&block);
+
+    /* The second round checks that decoder remained in sync after the
+     * first one failed.
+     */
+    for (round = 0; round < 2; ++round)
+    {
+        end = encbuf;
+        for (i = 0; i < n_headers; ++i)
+        {
+            lsxpack_header_set_ptr(&xhdr, header_arr[i].name.iov_base,
+                    (unsigned) header_arr[i].name.iov_len,
+                    header_arr[i].value.iov_base,
+                    (unsigned) header_arr[i].value.iov_len);
+            p = lshpack_enc_encode(&henc, end, encbuf + encbuf_sz, &xhdr);
+            assert(p > end);
+            end = p;
+        }
+
+        if (round == 0)
+        {
+            rc = lshpack_dec_decode_block(&hdec, encbuf, end, &block, 1000);
+            assert(rc == LSHPACK_ERR_TOO_LARGE);
+            assert(block.n_headers == 0);
+            continue;
+        }
+
+        rc = lshpack_dec_decode_block(&hdec, encbuf, end, &block, 0);
+        assert(rc == 0);
+        assert(block.n_headers == n_headers);
+        for (i = 0; i < n_headers; ++i)
+        {
+            assert(block.headers[i].name_len == header_arr[i].name.iov_len);
+            assert(0 == memcmp(header_arr[i].name.iov_base,
+                        lsxpack_header_get_name(&block.headers[i]),
+                        block.headers[i].name_len));
+            assert(block.headers[i].val_len == header_arr[i].value.iov_len);
+            assert(0 == memcmp(header_arr[i].value.iov_base,
+                        lsxpack_header_get_value(&block.headers[i]),
+                        block.headers[i].val_len));
+        }
+    }
+
+    lshpack_dec_block_cleanup(&block);
+    lshpack_dec_cleanup(&hdec);
+    lshpack_enc_cleanup(&henc);
+    free(encbuf);
+}
+
+
+static void
+test_hdec_stream (void)
+{
+    struct lshpack_enc henc;
+    struct lshpack_dec hdec;
+    struct lshpack_dec_stream stream;
+    struct lsxpack_header xhdr;
+    const unsigned n_headers = 200;
+    static const size_t frag_sizes[] = { 1, 2, 3, 17, 0x10000, };
+    unsigned i, n;
+    int rc;
+    const unsigned char *p, *frag_end;
+    unsigned char *end, *encbuf;
+    const size_t encbuf_sz = 0x10000;
+    char out[0x1000];
+
+    encbuf = malloc(encbuf_sz);
+    assert(encbuf);
+    lshpack_enc_init(&henc);
+    /* Table size update of 4096 */
+    memcpy(encbuf, "\x3f\xe1\x1f", 3);
+    end = encbuf + 3;
+    for (i = 0; i < n_headers; ++i)
+    {
+        lsxpack_header_set_ptr(&xhdr, header_arr[i].name.iov_base,
+                (unsigned) header_arr[i].name.iov_len,
+                header_arr[i].value.iov_base,
+                (unsigned) header_arr[i].value.iov_len);
+        p = lshpack_enc_encode(&henc, end, encbuf + encbuf_sz, &xhdr);
+        assert(p > end);
+        end = (unsigned char *) p;
+    }
+    lshpack_enc_cleanup(&henc);
+
+    lshpack_dec_stream_init(&stream);
+    for (n = 0; n < sizeof(frag_sizes) / sizeof(frag_sizes[0]); ++n)
+    {
+        lshpack_dec_init(&hdec);
+        p = encbuf;
+        frag_end = p;
+        for (i = 0; i < n_headers; ++i)
+        {
+            /* Start with a small buffer to exercise retries */
+            lsxpack_header_prepare_decode(&xhdr, out, 0, 20);
+            while (1)
+            {
+                rc = lshpack_dec_stream_decode(&hdec, &stream, &p, frag_end,
+                                                                    &xhdr);
+                if (rc == LSHPACK_ERR_MORE_DATA)
+                {
+                    assert(p == frag_end);
+                    assert(frag_end < end);
+                    if ((size_t) (end - frag_end) > frag_sizes[n])
+                        frag_end += frag_sizes[n];
+                    else
+                        frag_end = end;
+                }
+                else if (rc == LSHPACK_ERR_MORE_BUF)
+                    lsxpack_header_prepare_decode(&xhdr, out, 0, sizeof(out));
+                else
+                    break;
+            }
+            assert(rc == 0);
+            assert(xhdr.name_len == header_arr[i].name.iov_len);
+            assert(0 == memcmp(header_arr[i].name.iov_base,
+                        lsxpack_header_get_name(&xhdr), xhdr.name_len));
+            assert(xhdr.val_len == header_arr[i].value.iov_len);
+            assert(0 == memcmp(header_arr[i].value.iov_base,
+                        lsxpack_header_get_value(&xhdr), xhdr.val_len));
+        }
+        assert(p == end);
+        assert(0 == lshpack_dec_stream_end(&stream));
+        lshpack_dec_cleanup(&hdec);
+    }
+
+    /* Block ends in the middle of a header */
+    lshpack_dec_init(&hdec);
+    p = encbuf;
+    lsxpack_header_prepare_decode(&xhdr, out, 0, sizeof(out));
+    rc = lshpack_dec_stream_decode(&hdec, &stream, &p, encbuf + 5, &xhdr);
+    assert(rc == LSHPACK_ERR_MORE_DATA);
+    assert(LSHPACK_ERR_BAD_DATA == lshpack_dec_stream_end(&stream));
+    lshpack_dec_cleanup(&hdec);
+
+    lshpack_dec_stream_cleanup(&stream);
+    free(encbuf);
+}
+
+/* String lengths are checked as soon as they are read: long strings are
+ * neither copied nor allowed to grow the stream buffer.
+ */
+static void
+test_hdec_stream_limits (void)
+{
+    struct lshpack_dec hdec;
+    struct lshpack_dec_stream stream;
+    struct lsxpack_header xhdr;
+    const size_t val_len = 60000, frag_sz = 1000;
+    unsigned char *encbuf, *end;
+    const unsigned char *p, *frag_end;
+    char out[0x100];
+    uint32_t len;
+    int rc;
+
+    encbuf = malloc(val_len + 0x100);
+    assert(encbuf);
+    lshpack_dec_stream_init(&stream);
+
+    /* Value too long to decode: 8 MB */
+    end = encbuf;
+    memcpy(end, "\x00\x03x-a", 5);
+    end += 5;
+    *end = 0;
+    end = lshpack_enc_enc_int(end, encbuf + 0x100, 8 << 20, 7);
+    lshpack_dec_init(&hdec);
+    p = encbuf;
+    lsxpack_header_prepare_decode(&xhdr, out, 0, sizeof(out));
+    rc = lshpack_dec_stream_decode(&hdec, &stream, &p, end, &xhdr);
+    assert(rc == LSHPACK_ERR_TOO_LARGE);
+    assert(stream.hds_buf_alloc == 0);
+    lshpack_dec_cleanup(&hdec);
+
+    /* Literals over the limits are skipped, including one that is too
+     * large for the dynamic table, which empties it.
+     */
+    for (len = 0; len < 2; ++len)
+    {
+        end = encbuf;
+        *end = len ? 0x40 : 0x00;
+        memcpy(end + 1, "\x03x-a", 4);
+        end += 5;
+        *end = 0;
+        end = lshpack_enc_enc_int(end, encbuf + 0x100, val_len, 7);
+        memset(end, 'a', val_len);
+        end += val_len;
+        *end++ = 0x82;          /* :method: GET */
+
+        lshpack_dec_init(&hdec);
+        lshpack_dec_set_limits(&hdec, 1000, 10, 0);
+        if (len)
+        {
+            lsxpack_header_set_ptr(&xhdr, "x-b", 3, "b", 1);
+            rc = lshpack_dec_push_entry(&hdec, &xhdr);
+            assert(rc == 0);
+            assert(hdec.hpd_dyn_table.nelem == 1);
+        }
+        lshpack_dec_start_block(&hdec);
+        p = encbuf;
+        frag_end = encbuf + 3;
+        lsxpack_header_prepare_decode(&xhdr, out, 0, sizeof(out));
+        while (LSHPACK_ERR_MORE_DATA == (rc = lshpack_dec_stream_decode(
+                                    &hdec, &stream, &p, frag_end, &xhdr)))
+        {
+            assert(p == frag_end);
+            /* Only the split length prefix is kept */
+            assert(stream.hds_buf_len <= 3);
+            frag_end = (size_t) (end - frag_end) > frag_sz
+                                            ? frag_end + frag_sz : end;
+        }
+        assert(rc == LSHPACK_ERR_LIMIT);
+        assert(p == end - 1);
+        assert(stream.hds_buf_alloc <= 0x100);
+        assert(hdec.hpd_dyn_table.nelem == 0);
+        rc = lshpack_dec_stream_decode(&hdec, &stream, &p, end, &xhdr);
+        assert(rc == LSHPACK_ERR_LIMIT);
+        assert(p == end);
+        assert(0 == lshpack_dec_stream_end(&stream));
+
+        /* A new block starts afresh */
+        lshpack_dec_start_block(&hdec);
+        p = end - 1;
+        rc = lshpack_dec_stream_decode(&hdec, &stream, &p, end, &xhdr);
+        assert(rc == 0);
+        lshpack_dec_cleanup(&hdec);
+    }
+
+    lshpack_dec_stream_cleanup(&stream);
+    free(encbuf);
+}
+
+
+static void
+test_hdec_runtime_flags (void)
+{
+    struct lshpack_enc henc;
+    struct lshpack_dec hdec;
+    struct lsxpack_header xhdr;
+    unsigned flags, n;
+    int rc;
+    const unsigned char *p;
+    unsigned char *end;
+    unsigned char encbuf[0x100];
+    char out[0x100];
+    static const char *const values[] = { "one", "two", };
+
+    /* Name is added to the dynamic table by the first header and used
+     * by the second one.
+     */
+    lshpack_enc_init(&henc);
+    end = encbuf;
+    for (n = 0; n < 2; ++n)
+    {
+        lsxpack_header_set_ptr(&xhdr, "x-flags", 7, values[n], 3);
+        p = lshpack_enc_encode(&henc, end, encbuf + sizeof(encbuf), &xhdr);
+        assert(p > end);
+        end = (unsigned char *) p;
+    }
+    lshpack_enc_cleanup(&henc);
+
+    for (flags = 0; flags < 4; ++flags)
+    {
+        lshpack_dec_init(&hdec);
+        lshpack_dec_use_http1x(&hdec, flags & 1);
+        lshpack_dec_use_hash(&hdec, 0);
+        p = encbuf;
+        for (n = 0; n < 2; ++n)
+        {
+            /* Entry added without hashes must still work with hashing on */
+            if (n == 1)
+                lshpack_dec_use_hash(&hdec, flags & 2);
+            lsxpack_header_prepare_decode(&xhdr, out, 0, sizeof(out));
+            rc = lshpack_dec_decode(&hdec, &p, end, &xhdr);
+            assert(rc == 0);
+            assert(xhdr.name_len == 7);
+            assert(0 == memcmp(lsxpack_header_get_name(&xhdr), "x-flags", 7));
+            assert(xhdr.val_len == 3);
+            assert(0 == memcmp(lsxpack_header_get_value(&xhdr), values[n], 3));
+            assert(lsxpack_header_get_dec_size(&xhdr)
+                            == 10u + lshpack_dec_extra_bytes(&hdec));
+            if (flags & 1)
+                assert(0 == memcmp(out, "x-flags: ", 9)
+                                    && 0 == memcmp(out + 12, "\r\n", 2));
+            if (n == 1 && (flags & 2))
+            {
+                assert(xhdr.flags & LSXPACK_NAME_HASH);
+                assert(xhdr.flags & LSXPACK_NAMEVAL_HASH);
+                assert(xhdr.name_hash == XXH32("x-flags", 7,
+                                                        LSHPACK_XXH_SEED));
+                assert(xhdr.nameval_hash == XXH32(values[n], 3,
+                                                        xhdr.name_hash));
+            }
+            else
+                assert(!(xhdr.flags & LSXPACK_NAMEVAL_HASH));
+        }
+        assert(p == end);
+        lshpack_dec_cleanup(&hdec);
+    }
+}
+
+
+static void
+test_hdec_lazy_hash (void)
+{
+    struct lshpack_enc henc;
+    struct lshpack_dec hdec;
+    struct lsxpack_header xhdr;
+    static const struct {
+        const char *val;
+        unsigned    indexed_type;
+    } headers[] = {
+        { "aaa", 0, },  /* Literal, added to the dynamic table */
+        { "aaa", 0, },  /* Fully indexed */
+        { "bbb", 1, },  /* Name indexed, literal value */
+    };
+    unsigned n;
+    int rc;
+    const unsigned char *p;
+    unsigned char *end;
+    unsigned char encbuf[0x100];
+    char out[0x100];
+    uint32_t name_hash;
+
+    lshpack_enc_init(&henc);
+    end = encbuf;
+    for (n = 0; n < sizeof(headers) / sizeof(headers[0]); ++n)
+    {
+        lsxpack_header_set_ptr(&xhdr, "x-lazy", 6, headers[n].val, 3);
+        xhdr.indexed_type = headers[n].indexed_type;
+        p = lshpack_enc_encode(&henc, end, encbuf + sizeof(encbuf), &xhdr);
+        assert(p > end);
+        end = (unsigned char *) p;
+    }
+    lshpack_enc_cleanup(&henc);
+
+    name_hash = XXH32("x-lazy", 6, LSHPACK_XXH_SEED);
+    lshpack_dec_init(&hdec);
+    lshpack_dec_use_hash(&hdec, 0);
+    p = encbuf;
+    for (n = 0; n < sizeof(headers) / sizeof(headers[0]); ++n)
+    {
+        lsxpack_header_prepare_decode(&xhdr, out, 0, sizeof(out));
+        rc = lshpack_dec_decode(&hdec, &p, end, &xhdr);
+        assert(rc == 0);
+        switch (n)
+        {
+        case 0:
+            assert(!(xhdr.flags & (LSXPACK_NAME_HASH|LSXPACK_NAMEVAL_HASH)));
+            break;
+        case 1:
+            /* Cached in the entry by the previous call */
+            assert(xhdr.flags & LSXPACK_NAME_HASH);
+            assert(xhdr.flags & LSXPACK_NAMEVAL_HASH);
+            break;
+        default:
+            assert(xhdr.flags & LSXPACK_NAME_HASH);
+            assert(!(xhdr.flags & LSXPACK_NAMEVAL_HASH));
+            break;
+        }
+        lshpack_dec_calc_hash(&hdec, &xhdr);
+        assert(xhdr.flags & LSXPACK_NAME_HASH);
+        assert(xhdr.flags & LSXPACK_NAMEVAL_HASH);
+        assert(xhdr.name_hash == name_hash);
+        assert(xhdr.nameval_hash == XXH32(headers[n].val, 3, name_hash));
+    }
+    assert(p == end);
+    lshpack_dec_cleanup(&hdec);
+}
+
+
+static void
+test_app_reg (void)
+{
+    struct lshpack_app_reg reg;
+    struct lshpack_enc henc, henc_plain;
+    struct lshpack_dec hdec;
+    struct lsxpack_header xhdr;
+    static const char *const names[] = {
+        ":path", "user-agent", "x-route", "cookie",
+    };
+    static const char *const dups[] = { "x-a", "x-b", "x-a", };
+    static const struct {
+        const char *name, *val;
+        unsigned    app_index;
+    } headers[] = {
+        { ":path",      "/",        1, },   /* Static, fully indexed */
+        { ":path",      "/x",       1, },   /* Static name */
+        { "x-route",    "blue",     3, },   /* Literal, added */
+        { "x-route",    "blue",     3, },   /* Dynamic, fully indexed */
+        { "x-route",    "green",    3, },   /* Dynamic name */
+        { "user-agent", "test",     2, },
+        { "x-other",    "1",        0, },
+    };
+    char name_buf[0x40];
+    unsigned n, view;
+    int rc;
+    const unsigned char *p;
+    unsigned char *end, *end_plain;
+    unsigned char encbuf[0x200], encbuf_plain[0x200];
+    char out[0x100];
+
+    assert(-1 == lshpack_app_reg_init(&reg, dups, 3));
+    rc = lshpack_app_reg_init(&reg, names, sizeof(names) / sizeof(names[0]));
+    assert(rc == 0);
+    for (n = 0; n < sizeof(names) / sizeof(names[0]); ++n)
+        assert(lshpack_app_reg_lookup(&reg, names[n], strlen(names[n]))
+                                                                    == n + 1);
+    assert(0 == lshpack_app_reg_lookup(&reg, "x-routf", 7));
+
+    /* Encoding with the registry produces the same output */
+    lshpack_enc_init(&henc);
+    lshpack_enc_set_app_reg(&henc, &reg);
+    lshpack_enc_init(&henc_plain);
+    end = encbuf;
+    end_plain = encbuf_plain;
+    for (n = 0; n < sizeof(headers) / sizeof(headers[0]); ++n)
+    {
+        lsxpack_header_set_ptr(&xhdr, headers[n].name,
+                strlen(headers[n].name), headers[n].val, strlen(headers[n].val));
+        p = lshpack_enc_encode(&henc_plain, end_plain,
+                            encbuf_plain + sizeof(encbuf_plain), &xhdr);
+        assert(p > end_plain);
+        end_plain = (unsigned char *) p;
+        lsxpack_header_set_ptr(&xhdr, headers[n].name,
+                strlen(headers[n].name), headers[n].val, strlen(headers[n].val));
+        if (headers[n].app_index)
+        {
+            xhdr.app_index = headers[n].app_index;
+            xhdr.flags |= LSXPACK_APP_IDX;
+        }
+        p = lshpack_enc_encode(&henc, end, encbuf + sizeof(encbuf), &xhdr);
+        assert(p > end);
+        end = (unsigned char *) p;
+    }
+    lshpack_enc_cleanup(&henc);
+    lshpack_enc_cleanup(&henc_plain);
+    assert(end - encbuf == end_plain - encbuf_plain);
+    assert(0 == memcmp(encbuf, encbuf_plain, end - encbuf));
+
+    for (view = 0; view < 2; ++view)
+    {
+        lshpack_dec_init(&hdec);
+        lshpack_dec_use_hash(&hdec, 0);
+        lshpack_dec_use_views(&hdec, view);
+        lshpack_dec_set_app_reg(&hdec, &reg);
+        p = encbuf;
+        for (n = 0; n < sizeof(headers) / sizeof(headers[0]); ++n)
+        {
+            lsxpack_header_prepare_decode(&xhdr, out, 0, sizeof(out));
+            rc = lshpack_dec_decode(&hdec, &p, end, &xhdr);
+            assert(rc == 0);
+            memcpy(name_buf, lsxpack_header_get_name(&xhdr), xhdr.name_len);
+            name_buf[xhdr.name_len] = '\0';
+            assert(0 == strcmp(name_buf, headers[n].name));
+            assert(xhdr.app_index == headers[n].app_index);
+            assert(!(xhdr.flags & LSXPACK_APP_IDX) == !headers[n].app_index);
+        }
+        assert(p == end);
+        lshpack_dec_cleanup(&hdec);
+    }
+
+    lshpack_app_reg_cleanup(&reg);
+}
+
+
+/* Write HPACK string literal, Huffman-encoded if `huff' is set */
+static unsigned
+put_str (unsigned char *dst, const char *str, unsigned len, int huff)
+{
+    int rc;
+
+    if (huff)
+    {
+        rc = lshpack_enc_huff_encode((const unsigned char *) str,
+                    (const unsigned char *) str + len, dst + 1, 0x7F);
+        assert(rc >= 0 && rc < 0x7F);
+        dst[0] = 0x80 | rc;
+        return 1 + rc;
+    }
+    assert(len < 0x7F);
+    dst[0] = len;
+    memcpy(dst + 1, str, len);
+    return 1 + len;
+}
+
+
+static void
+test_hdec_validate (void)
+{
+    struct lshpack_dec hdec;
+    struct lsxpack_header xhdr;
+    static const struct {
+        const char *name, *val;
+        int         bad_name, bad_val;
+    } headers[] = {
+        { "x-ok",           "value",        0, 0, },
+        { ":path",          "/index.html",  0, 0, },
+        { "x-tab",          "a\tb c",       0, 0, },
+        { "x-high",         "caf\xc3\xa9",  0, 0, },
+        { "x-a-rather-long-header-name",
+                            "and a rather long value, too", 0, 0, },
+        { "X-Upper",        "value",        1, 0, },
+        { "x-lower-then-Z", "value",        1, 0, },
+        { "x:colon",        "value",        1, 0, },
+        { "::",             "value",        1, 0, },
+        { "x space",        "value",        1, 0, },
+        { "x-del\x7f",      "value",        1, 0, },
+        { "x-h\xc3\xa9",    "value",        1, 0, },
+        { "x-ok",           "new\nline",    0, 1, },
+        { "x-ok",           "carriage-return-\r-in-long-value", 0, 1, },
+        { "x-ok",           " leading",     0, 1, },
+        { "x-ok",           "trailing\t",   0, 1, },
+    };
+    static const char chars[] = "abcdefghijklmnopqrstuvwxyz0123456789-";
+    unsigned n, len, huff, views;
+    int rc, bad;
+    const unsigned char *p;
+    unsigned char *end;
+    unsigned char encbuf[0x200];
+    char out[0x200], name[0x40], val[0x40];
+    uint32_t name_hash;
+
+    /* Hashes match XXH32() at all lengths, including the tails */
+    for (huff = 0; huff < 2; ++huff)
+        for (len = 1; len < sizeof(name); ++len)
+        {
+            for (n = 0; n < len; ++n)
+            {
+                name[n] = chars[(n * 7 + len) % (sizeof(chars) - 1)];
+                val[n] = chars[(n * 5 + len) % (sizeof(chars) - 1)];
+            }
+            end = encbuf;
+            *end++ = 0x00;
+            end += put_str(end, name, len, huff);
+            end += put_str(end, val, len - 1, huff);
+            lshpack_dec_init(&hdec);
+            lshpack_dec_use_hash(&hdec, 1);
+            lshpack_dec_use_validation(&hdec, 1);
+            p = encbuf;
+            lsxpack_header_prepare_decode(&xhdr, out, 0, sizeof(out));
+            rc = lshpack_dec_decode(&hdec, &p, end, &xhdr);
+            assert(rc == 0);
+            assert(p == end);
+            name_hash = XXH32(name, len, LSHPACK_XXH_SEED);
+            assert(xhdr.name_hash == name_hash);
+            assert(xhdr.nameval_hash == XXH32(val, len - 1, name_hash));
+            lshpack_dec_cleanup(&hdec);
+        }
+
+    for (views = 0; views < 2; ++views)
+        for (huff = 0; huff < 2; ++huff)
+            for (n = 0; n < sizeof(headers) / sizeof(headers[0]); ++n)
+            {
+                /* Add to the dynamic table, then refer to it twice */
+                end = encbuf;
+                *end++ = 0x40;
+                end += put_str(end, headers[n].name, strlen(headers[n].name),
+                                                                        huff);
+                end += put_str(end, headers[n].val, strlen(headers[n].val),
+                                                                        huff);
+                *end++ = 0x80 | 62;
+                *end++ = 0x40 | 62;
+                end += put_str(end, "v", 1, huff);
+
+                lshpack_dec_init(&hdec);
+                lshpack_dec_use_views(&hdec, views);
+                lshpack_dec_use_validation(&hdec, 1);
+                p = encbuf;
+                lsxpack_header_prepare_decode(&xhdr, out, 0, sizeof(out));
+                rc = lshpack_dec_decode(&hdec, &p, end, &xhdr);
+                bad = headers[n].bad_name || headers[n].bad_val;
+                assert(rc == (bad ? LSHPACK_ERR_MALFORMED : 0));
+                /* The header is decoded all the same */
+                assert(xhdr.name_len == strlen(headers[n].name));
+                assert(0 == memcmp(lsxpack_header_get_name(&xhdr),
+                                        headers[n].name, xhdr.name_len));
+                assert(xhdr.val_len == strlen(headers[n].val));
+                assert(0 == memcmp(lsxpack_header_get_value(&xhdr),
+                                        headers[n].val, xhdr.val_len));
+                lsxpack_header_prepare_decode(&xhdr, out, 0, sizeof(out));
+                rc = lshpack_dec_decode(&hdec, &p, end, &xhdr);
+                assert(rc == (bad ? LSHPACK_ERR_MALFORMED : 0));
+                /* Only a bad name carries over to a new value */
+                lsxpack_header_prepare_decode(&xhdr, out, 0, sizeof(out));
+                rc = lshpack_dec_decode(&hdec, &p, end, &xhdr);
+                assert(rc == (headers[n].bad_name
+                                            ? LSHPACK_ERR_MALFORMED : 0));
+                assert(p == end);
+
+                /* Nothing is checked with validation off */
+                lshpack_dec_use_validation(&hdec, 0);
+                p = encbuf;
+                lsxpack_header_prepare_decode(&xhdr, out, 0, sizeof(out));
+                rc = lshpack_dec_decode(&hdec, &p, end, &xhdr);
+                assert(rc == 0);
+                lshpack_dec_cleanup(&hdec);
+            }
+}
+
+
+static void
+test_hdec_limits (void)
+{
+    struct lshpack_enc henc;
+    struct lshpack_dec hdec, href;
+    struct lshpack_dec_block block, ref_block;
+    struct lsxpack_header xhdr;
+    unsigned n, i;
+    int rc;
+    const unsigned char *p;
+    unsigned char *end, *block_end[2];
+    unsigned char encbuf[0x2000];
+    char out[0x40], name[0x20], val[0x40], big[0x200];
+
+    /* Two blocks of headers, each added to the dynamic table.  The second
+     * block refers to entries added by the first.
+     */
+    lshpack_enc_init(&henc);
+    end = encbuf;
+    for (n = 0; n < 2; ++n)
+    {
+        for (i = 0; i < 60; ++i)
+        {
+            sprintf(name, "x-limit-%u", i);
+            sprintf(val, "value-%u", i + n * (i & 1));
+            lsxpack_header_set_ptr(&xhdr, name, strlen(name), val,
+                                                                strlen(val));
+            p = lshpack_enc_encode(&henc, end, encbuf + sizeof(encbuf),
+                                                                    &xhdr);
+            assert(p > end);
+            end = (unsigned char *) p;
+        }
+        block_end[n] = end;
+    }
+    lshpack_enc_cleanup(&henc);
+
+    lshpack_dec_init(&href);
+    lshpack_dec_block_init(&ref_block);
+    lshpack_dec_init(&hdec);
+    lshpack_dec_block_init(&block);
+    /* Too many headers: the first block is rejected... */
+    lshpack_dec_set_limits(&hdec, 0, 10, 0);
+    rc = lshpack_dec_decode_block(&hdec, encbuf, block_end[0], &block, 0);
+    assert(rc == LSHPACK_ERR_TOO_LARGE);
+    assert(block.n_headers == 0);
+    rc = lshpack_dec_decode_block(&href, encbuf, block_end[0], &ref_block, 0);
+    assert(rc == 0);
+    /* ...but the second one is decoded correctly */
+    lshpack_dec_set_limits(&hdec, 0, 0, 0);
+    rc = lshpack_dec_decode_block(&hdec, block_end[0], block_end[1], &block,
+                                                                        0);
+    assert(rc == 0);
+    rc = lshpack_dec_decode_block(&href, block_end[0], block_end[1],
+                                                            &ref_block, 0);
+    assert(rc == 0);
+    assert(block.n_headers == 60);
+    assert(ref_block.n_headers == 60);
+    for (n = 0; n < block.n_headers; ++n)
+    {
+        assert(block.headers[n].name_len == ref_block.headers[n].name_len);
+        assert(0 == memcmp(lsxpack_header_get_name(&block.headers[n]),
+                            lsxpack_header_get_name(&ref_block.headers[n]),
+                            block.headers[n].name_len));
+        assert(block.headers[n].val_len == ref_block.headers[n].val_len);
+        assert(0 == memcmp(lsxpack_header_get_value(&block.headers[n]),
+                            lsxpack_header_get_value(&ref_block.headers[n]),
+                            block.headers[n].val_len));
+    }
+    /* The dynamic table is kept within its capacity */
+    assert(hdec.hpd_cur_capacity <= hdec.hpd_cur_max_capacity);
+    assert(hdec.hpd_cur_capacity == href.hpd_cur_capacity);
+    lshpack_dec_block_cleanup(&block);
+    lshpack_dec_block_cleanup(&ref_block);
+    lshpack_dec_cleanup(&href);
+
+    /* Header list size: the long value is rejected before it is decoded,
+     * so the small output buffer does not matter.
+     */
+    end = encbuf;
+    *end++ = 0x00;
+    *end++ = 5;
+    memcpy(end, "x-big", 5);
+    end += 5;
+    *end++ = 0x7F;          /* Length 1000 */
+    *end++ = 0x80 | ((1000 - 0x7F) & 0x7F);
+    *end++ = (1000 - 0x7F) >> 7;
+    memset(end, 'a', 1000);
+    end += 1000;
+    *end++ = 0x82;          /* :method: GET */
+    lshpack_dec_set_limits(&hdec, 512, 0, 0);
+    lshpack_dec_start_block(&hdec);
+    p = encbuf;
+    lsxpack_header_prepare_decode(&xhdr, out, 0, sizeof(out));
+    rc = lshpack_dec_decode(&hdec, &p, end, &xhdr);
+    assert(rc == LSHPACK_ERR_LIMIT);
+    assert(p == end - 1);
+    /* The rest of the block is over the limit, too */
+    rc = lshpack_dec_decode(&hdec, &p, end, &xhdr);
+    assert(rc == LSHPACK_ERR_LIMIT);
+    assert(p == end);
+    /* A new block starts afresh */
+    lshpack_dec_start_block(&hdec);
+    p = end - 1;
+    lsxpack_header_prepare_decode(&xhdr, out, 0, sizeof(out));
+    rc = lshpack_dec_decode(&hdec, &p, end, &xhdr);
+    assert(rc == 0);
+    assert(p == end);
+
+    /* A value that is empty because the block ends is skipped the same way
+     * it is decoded: when the output buffer is short and when over limits.
+     */
+    end = encbuf + 2 + 5 + 3 + 1000;
+    *end++ = 0x00;
+    *end++ = 3;
+    memcpy(end, "x-e", 3);
+    end += 3;
+    lshpack_dec_start_block(&hdec);
+    p = encbuf + 2 + 5 + 3 + 1000;
+    lsxpack_header_prepare_decode(&xhdr, out, 0, 2);
+    rc = lshpack_dec_decode(&hdec, &p, end, &xhdr);
+    assert(rc == LSHPACK_ERR_MORE_BUF);
+    lsxpack_header_prepare_decode(&xhdr, out, 0, sizeof(out));
+    rc = lshpack_dec_decode(&hdec, &p, end, &xhdr);
+    assert(rc == 0);
+    assert(p == end);
+    assert(xhdr.name_len == 3 && xhdr.val_len == 0);
+    lshpack_dec_start_block(&hdec);
+    p = encbuf;
+    lsxpack_header_prepare_decode(&xhdr, out, 0, sizeof(out));
+    rc = lshpack_dec_decode(&hdec, &p, end, &xhdr);
+    assert(rc == LSHPACK_ERR_LIMIT);
+    rc = lshpack_dec_decode(&hdec, &p, end, &xhdr);
+    assert(rc == LSHPACK_ERR_LIMIT);
+    assert(p == end);
+
+    /* Amplification: each byte expands to 42 bytes of header list */
+    memset(encbuf, 0x82, 200);
+    lshpack_dec_set_limits(&hdec, 0, 0, 20);
+    lshpack_dec_start_block(&hdec);
+    p = encbuf;
+    for (n = 0; n < 200; ++n)
+    {
+        lsxpack_header_prepare_decode(&xhdr, out, 0, sizeof(out));
+        rc = lshpack_dec_decode(&hdec, &p, encbuf + 200, &xhdr);
+        if (rc != 0)
+            break;
+    }
+    assert(rc == LSHPACK_ERR_LIMIT);
+    assert(n == 4096 / 42);
+    lshpack_dec_cleanup(&hdec);
+
+    /* A lazily decoded value counts at its decoded length: 32 + 6 + 400 */
+    memset(big, 'a', 400);
+    lshpack_enc_init(&henc);
+    lsxpack_header_set_ptr(&xhdr, "x-lazy", 6, big, 400);
+    xhdr.indexed_type = 1;
+    end = lshpack_enc_encode(&henc, encbuf, encbuf + sizeof(encbuf), &xhdr);
+    assert(end > encbuf && end - encbuf < 300);
+    lshpack_enc_cleanup(&henc);
+    for (n = 0; n < 2; ++n)
+    {
+        lshpack_dec_init(&hdec);
+        lshpack_dec_use_lazy_huff(&hdec, 1);
+        lshpack_dec_use_http1x(&hdec, 0);
+        lshpack_dec_set_limits(&hdec, n ? 438 : 437, 0, 0);
+        lshpack_dec_start_block(&hdec);
+        p = encbuf;
+        lsxpack_header_prepare_decode(&xhdr, big, 0, sizeof(big));
+        rc = lshpack_dec_decode(&hdec, &p, end, &xhdr);
+        assert(rc == (n ? 0 : LSHPACK_ERR_LIMIT));
+        assert(p == end);
+        assert(xhdr.flags & LSXPACK_VAL_HUFFMAN);
+        lshpack_dec_cleanup(&hdec);
+    }
+
+    /* Invalid lazy value cannot be counted: EOS in the string */
+    memcpy(encbuf, "\x00\x03x-e\x84\xFF\xFF\xFF\xFF", 10);
+    lshpack_dec_init(&hdec);
+    lshpack_dec_use_lazy_huff(&hdec, 1);
+    lshpack_dec_use_http1x(&hdec, 0);
+    lshpack_dec_set_limits(&hdec, 1000, 0, 0);
+    lshpack_dec_start_block(&hdec);
+    p = encbuf;
+    lsxpack_header_prepare_decode(&xhdr, big, 0, sizeof(big));
+    rc = lshpack_dec_decode(&hdec, &p, encbuf + 10, &xhdr);
+    assert(rc == LSHPACK_ERR_BAD_DATA);
+    assert(hdec.hpd_limits.list_size == 0);
+    lshpack_dec_cleanup(&hdec);
+}
+
+
+static void
+test_h1_head (void)
+{
+    struct lshpack_enc henc;
+    struct lshpack_dec hdec;
+    struct lshpack_dec_block block;
+    struct lshpack_h1_head head;
+    struct lsxpack_header xhdr, nul_hdrs[3];
+    static const struct {
+        const char *name, *val;
+    } request[] = {
+        { ":method",    "GET", },
+        { ":scheme",    "https", },
+        { ":path",      "/index.html", },
+        { ":authority", "example.com", },
+        { "cookie",     "a=1", },
+        { "user-agent", "test", },
+        { "host",       "example.org", },
+        { "cookie",     "b=2", },
+    }, response[] = {
+        { ":status",        "404", },
+        { "content-type",   "text/plain", },
+    }, connect[] = {
+        { ":method",    "CONNECT", },
+        { ":authority", "example.com:443", },
+    }, bad[] = {
+        { ":path",      "/", },
+    }, no_path[] = {
+        { ":method",    "GET", },
+        { ":authority", "example.com", },
+    }, bad_method[] = {
+        { ":method",    "GET / HTTP/1.1\r\nhost: evil\r\n\r\nGET", },
+        { ":path",      "/", },
+    }, bad_value[] = {
+        { ":method",    "GET", },
+        { ":path",      "/", },
+        { "x-a",        "1\r\nx-b: 2", },
+    }, bad_cookie[] = {
+        { ":method",    "GET", },
+        { ":path",      "/", },
+        { "cookie",     "a=1", },
+        { "cookie",     "b=2\nx-b: 2", },
+    }, bad_space[] = {
+        { ":status",    "200", },
+        { "x-a",        "1 ", },
+    }, bad_name[] = {
+        { ":method",    "GET", },
+        { ":path",      "/", },
+        { "x-a: 1\r\nx-b", "2", },
+    };
+    static const struct {
+        const void *headers;
+        unsigned    n_headers;
+        const char *head;
+    } blocks[] = {
+        { request, sizeof(request) / sizeof(request[0]),
+          "GET /index.html HTTP/1.1\r\n"
+          "host: example.com\r\n"
+          "cookie: a=1; b=2\r\n"
+          "user-agent: test\r\n"
+          "\r\n", },
+        { response, sizeof(response) / sizeof(response[0]),
+          "HTTP/1.1 404 \r\n"
+          "content-type: text/plain\r\n"
+          "\r\n", },
+        { connect, sizeof(connect) / sizeof(connect[0]),
+          "CONNECT example.com:443 HTTP/1.1\r\n"
+          "host: example.com:443\r\n"
+          "\r\n", },
+        { bad, sizeof(bad) / sizeof(bad[0]), NULL, },
+        { no_path, sizeof(no_path) / sizeof(no_path[0]), NULL, },
+        { bad_method, sizeof(bad_method) / sizeof(bad_method[0]), NULL, },
+        { bad_value, sizeof(bad_value) / sizeof(bad_value[0]), NULL, },
+        { bad_cookie, sizeof(bad_cookie) / sizeof(bad_cookie[0]), NULL, },
+        { bad_space, sizeof(bad_space) / sizeof(bad_space[0]), NULL, },
+        { bad_name, sizeof(bad_name) / sizeof(bad_name[0]), NULL, },
+    };
+    const struct { const char *name, *val; } *headers;
+    unsigned n, i, mode, n_lazy;
+    int rc;
+    const unsigned char *p;
+    unsigned char *end;
+    unsigned char encbuf[0x200];
+    char out[0x200];
+    size_t off;
+
+    /* Modes: plain, views, lazy Huffman decoding */
+    lshpack_h1_head_init(&head);
+    for (mode = 0; mode < 3; ++mode)
+    {
+        lshpack_enc_init(&henc);
+        lshpack_dec_init(&hdec);
+        lshpack_dec_use_views(&hdec, mode == 1);
+        if (mode == 2)
+        {
+            lshpack_dec_use_lazy_huff(&hdec, 1);
+            lshpack_dec_use_http1x(&hdec, 0);
+        }
+        lshpack_dec_block_init(&block);
+        n_lazy = 0;
+        for (n = 0; n < sizeof(blocks) / sizeof(blocks[0]); ++n)
+        {
+            headers = blocks[n].headers;
+            end = encbuf;
+            for (i = 0; i < blocks[n].n_headers; ++i)
+            {
+                lsxpack_header_set_ptr(&xhdr, headers[i].name,
+                        strlen(headers[i].name), headers[i].val,
+                        strlen(headers[i].val));
+                /* Values added to the dynamic table are never lazy */
+                xhdr.indexed_type = mode == 2;
+                p = lshpack_enc_encode(&henc, end, encbuf + sizeof(encbuf),
+                                                                    &xhdr);
+                assert(p > end);
+                end = (unsigned char *) p;
+            }
+            rc = lshpack_dec_decode_block(&hdec, encbuf, end, &block, 0);
+            assert(rc == 0);
+            for (i = 0; i < block.n_headers; ++i)
+                n_lazy += !!(block.headers[i].flags & LSXPACK_VAL_HUFFMAN);
+            rc = lshpack_h1_head_build(&head, block.headers,
+                                                        block.n_headers);
+            if (!blocks[n].head)
+            {
+                assert(rc == LSHPACK_ERR_BAD_DATA);
+                continue;
+            }
+            assert(rc == 0);
+            assert(head.size == strlen(blocks[n].head));
+            for (off = 0, i = 0; i < head.n_iov; ++i)
+            {
+                memcpy(out + off, head.iov[i].iov_base, head.iov[i].iov_len);
+                off += head.iov[i].iov_len;
+            }
+            assert(off == head.size);
+            assert(0 == memcmp(out, blocks[n].head, off));
+        }
+        assert((mode == 2) == (n_lazy > 0));
+        lshpack_dec_block_cleanup(&block);
+        lshpack_dec_cleanup(&hdec);
+        lshpack_enc_cleanup(&henc);
+    }
+
+    /* NUL in a value */
+    memcpy(out, ":methodGET:path/x-a1\0002", 22);
+    lsxpack_header_set_offset2(&nul_hdrs[0], out, 0, 7, 7, 3);
+    lsxpack_header_set_offset2(&nul_hdrs[1], out, 10, 5, 15, 1);
+    lsxpack_header_set_offset2(&nul_hdrs[2], out, 16, 3, 19, 3);
+    rc = lshpack_h1_head_build(&head, nul_hdrs, 3);
+    assert(rc == LSHPACK_ERR_BAD_DATA);
+    rc = lshpack_h1_head_build(&head, nul_hdrs, 2);
+    assert(rc == 0);
+    lshpack_h1_head_cleanup(&head);
+}
+
+
+/* Empty names are stored in the dynamic table like any other name; they
+ * are not mistaken for names shared with the static table.
+ */
+static void
+test_henc_empty_name (void)
+{
+    struct lshpack_enc henc;
+    struct lshpack_dec hdec;
+    struct lsxpack_header xhdr;
+    struct enc_dyn_table_entry entry;
+    void *iter;
+    const unsigned char *p;
+    unsigned char *end;
+    unsigned char encbuf[0x40];
+    char out[0x40];
+    unsigned i;
+    int rc;
+
+    rc = lshpack_enc_init(&henc);
+    assert(rc == 0);
+    lshpack_dec_init(&hdec);
+    for (i = 0; i < 4; ++i)
+    {
+        if (i & 1)
+            lsxpack_header_set_ptr(&xhdr, "content-type", 12, "x/y", 3);
+        else
+            lsxpack_header_set_ptr(&xhdr, "", 0, "value", 5);
+        end = lshpack_enc_encode(&henc, encbuf, encbuf + sizeof(encbuf),
+                                                                    &xhdr);
+        assert(end > encbuf);
+        /* The second time, both are found in the dynamic table */
+        if (i >= 2)
+            assert(end - encbuf == 1);
+        p = encbuf;
+        lsxpack_header_prepare_decode(&xhdr, out, 0, sizeof(out));
+        rc = lshpack_dec_decode(&hdec, &p, end, &xhdr);
+        assert(rc == 0 && p == end);
+        if (i & 1)
+            assert(xhdr.name_len == 12 && xhdr.val_len == 3);
+        else
+        {
+            assert(xhdr.name_len == 0);
+            assert(xhdr.val_len == 5);
+            assert(0 == memcmp(lsxpack_header_get_value(&xhdr), "value", 5));
+        }
+    }
+
+    assert(henc.hpe_nelem == 2);
+    lshpack_enc_iter_init(&henc, &iter);
+    rc = lshpack_enc_iter_next(&henc, &iter, &entry);
+    assert(rc == 0);
+    assert(entry.name_len == 0 && entry.value_len == 5);
+    rc = lshpack_enc_iter_next(&henc, &iter, &entry);
+    assert(rc == 0);
+    assert(entry.name_len == 12 && entry.value_len == 3);
+    assert(0 == memcmp(entry.name, "content-type", 12));
+
+    /* Eviction */
+    lshpack_enc_set_max_capacity(&henc, 0);
+    assert(henc.hpe_nelem == 0);
+    assert(henc.hpe_cur_capacity == 0);
+
+    lshpack_dec_cleanup(&hdec);
+    lshpack_enc_cleanup(&henc);
+}
+
+
+/* Many entries go through a small table: payload buffer is compacted and
+ * hash chains run into evicted entries.
+ */
+static void
+test_henc_table_churn (void)
+{
+    struct lshpack_enc henc;
+    struct lshpack_dec hdec;
+    struct lsxpack_header xhdr;
+    const unsigned char *p;
+    unsigned char *end;
+    unsigned char encbuf[0x100];
+    char name[0x20], val[0x80], out[0x100];
+    unsigned i, j, n_indexed;
+    int rc;
+
+    rc = lshpack_enc_init(&henc);
+    assert(rc == 0);
+    lshpack_dec_init(&hdec);
+    lshpack_enc_set_max_capacity(&henc, 1024);
+    lshpack_dec_set_max_capacity(&hdec, 1024);
+
+    n_indexed = 0;
+    for (i = 0; i < 5000; ++i)
+    {
+        /* Every fourth header is repeated from two headers back */
+        j = i % 4 == 3 ? i - 2 : i;
+        snprintf(name, sizeof(name), "x-churn-%u", j % 13);
+        snprintf(val, sizeof(val), "%.*s%u", (int) (j * 7 % 60),
+            "-----------------------------------------------------------",
+            j % 17);
+        lsxpack_header_set_ptr(&xhdr, name, strlen(name), val, strlen(val));
+        end = lshpack_enc_encode(&henc, encbuf, encbuf + sizeof(encbuf),
+                                                                    &xhdr);
+        assert(end > encbuf);
+        if (end - encbuf == 1)
+            ++n_indexed;
+        assert(henc.hpe_cur_capacity <= 1024);
+
+        p = encbuf;
+        lsxpack_header_prepare_decode(&xhdr, out, 0, sizeof(out));
+        rc = lshpack_dec_decode(&hdec, &p, end, &xhdr);
+        assert(rc == 0 && p == end);
+        assert(xhdr.name_len == strlen(name));
+        assert(0 == memcmp(lsxpack_header_get_name(&xhdr), name,
+                                                            xhdr.name_len));
+        assert(xhdr.val_len == strlen(val));
+        assert(0 == memcmp(lsxpack_header_get_value(&xhdr), val,
+                                                            xhdr.val_len));
+        assert(hdec.hpd_cur_capacity == henc.hpe_cur_capacity);
+    }
+    assert(n_indexed == 5000 / 4);
+
+    lshpack_dec_cleanup(&hdec);
+    lshpack_enc_cleanup(&henc);
+}
+
+
+/* Encoder and decoder that are reset behave like new ones */
+static void
+test_enc_dec_reset (void)
+{
+    static const size_t max_keep[] = { SIZE_MAX, 0, };
+    struct lshpack_enc henc, fresh;
+    struct lshpack_dec hdec;
+    struct lsxpack_header xhdr;
+    const unsigned char *p;
+    unsigned char *end[2];
+    unsigned char encbuf[2][0x2000];
+    char name[0x20], val[0x20], out[0x100];
+    size_t enc_mem, dec_mem;
+    unsigned k, i, n;
+    int rc;
+
+    for (k = 0; k < sizeof(max_keep) / sizeof(max_keep[0]); ++k)
+    {
+        rc = lshpack_enc_init(&henc);
+        assert(rc == 0);
+        lshpack_dec_init(&hdec);
+        lshpack_enc_set_max_capacity(&henc, 0x10000);
+        lshpack_dec_set_max_capacity(&hdec, 0x10000);
+
+        /* Grow the tables */
+        for (n = 0; n < 4; ++n)
+        {
+            end[0] = encbuf[0];
+            for (i = 0; i < 50; ++i)
+            {
+                snprintf(name, sizeof(name), "x-name-%u", n * 50 + i);
+                snprintf(val, sizeof(val), "value-%u", i);
+                lsxpack_header_set_ptr(&xhdr, name, strlen(name), val,
+                                                                strlen(val));
+                p = lshpack_enc_encode(&henc, end[0],
+                                    encbuf[0] + sizeof(encbuf[0]), &xhdr);
+                assert(p > end[0]);
+                end[0] = (unsigned char *) p;
+            }
+            for (p = encbuf[0]; p < end[0]; )
+            {
+                lsxpack_header_prepare_decode(&xhdr, out, 0, sizeof(out));
+                rc = lshpack_dec_decode(&hdec, &p, end[0], &xhdr);
+                assert(rc == 0);
+            }
+        }
+        assert(henc.hpe_nbits > 2);
+        assert(hdec.hpd_dyn_table.nelem == 200);
+        /* With history on, headers seen once are not indexed */
+        rc = lshpack_enc_use_hist(&henc, 1);
+        assert(rc == 0);
+
+        enc_mem = lshpack_enc_mem_used(&henc);
+        dec_mem = lshpack_dec_mem_used(&hdec);
+        assert(enc_mem > 200 * strlen("x-name-NNvalue-NN"));
+        assert(dec_mem > 200 * strlen("x-name-NNvalue-NN"));
+        lshpack_enc_reset(&henc, max_keep[k]);
+        lshpack_dec_reset(&hdec, max_keep[k]);
+        /* Decoder entries are freed, encoder keeps its payload buffer */
+        assert(lshpack_enc_mem_used(&henc) <= enc_mem);
+        assert(lshpack_dec_mem_used(&hdec) < dec_mem);
+        assert(henc.hpe_nelem == 0 && henc.hpe_cur_capacity == 0);
+        assert(henc.hpe_max_capacity == 4096);
+        assert(lshpack_enc_hist_used(&henc));
+        assert(hdec.hpd_cur_capacity == 0 && hdec.hpd_max_capacity == 4096);
+        assert(hdec.hpd_dyn_table.nelem == 0);
+        if (max_keep[k] == 0)
+        {
+            assert(henc.hpe_nbits == 2);
+            assert(hdec.hpd_dyn_table.nalloc == 0);
+            lshpack_enc_init(&fresh);
+            lshpack_enc_use_hist(&fresh, 1);
+            assert(lshpack_enc_mem_used(&henc)
+                                        == lshpack_enc_mem_used(&fresh));
+            lshpack_enc_cleanup(&fresh);
+            assert(lshpack_dec_mem_used(&hdec) == 0);
+        }
+        else
+        {
+            assert(henc.hpe_nbits > 2);
+            assert(hdec.hpd_dyn_table.nalloc > 0);
+        }
+
+        /* Reset encoder produces the same output as a new one */
+        rc = lshpack_enc_init(&fresh);
+        assert(rc == 0);
+        rc = lshpack_enc_use_hist(&fresh, 1);
+        assert(rc == 0);
+        end[0] = encbuf[0];
+        end[1] = encbuf[1];
+        for (i = 0; i < 30; ++i)
+        {
+            snprintf(name, sizeof(name), "x-name-%u", i % 7);
+            snprintf(val, sizeof(val), "value-%u", i % 5);
+            lsxpack_header_set_ptr(&xhdr, name, strlen(name), val,
+                                                                strlen(val));
+            p = lshpack_enc_encode(&henc, end[0],
+                                    encbuf[0] + sizeof(encbuf[0]), &xhdr);
+            assert(p > end[0]);
+            end[0] = (unsigned char *) p;
+            lsxpack_header_set_ptr(&xhdr, name, strlen(name), val,
+                                                                strlen(val));
+            p = lshpack_enc_encode(&fresh, end[1],
+                                    encbuf[1] + sizeof(encbuf[1]), &xhdr);
+            assert(p > end[1]);
+            end[1] = (unsigned char *) p;
+        }
+        assert(end[0] - encbuf[0] == end[1] - encbuf[1]);
+        assert(0 == memcmp(encbuf[0], encbuf[1], end[0] - encbuf[0]));
+
+        /* Reset decoder can decode it */
+        for (p = encbuf[0], i = 0; p < end[0]; ++i)
+        {
+            lsxpack_header_prepare_decode(&xhdr, out, 0, sizeof(out));
+            rc = lshpack_dec_decode(&hdec, &p, end[0], &xhdr);
+            assert(rc == 0);
+            snprintf(name, sizeof(name), "x-name-%u", i % 7);
+            snprintf(val, sizeof(val), "value-%u", i % 5);
+            assert(xhdr.name_len == strlen(name));
+            assert(0 == memcmp(lsxpack_header_get_name(&xhdr), name,
+                                                            xhdr.name_len));
+            assert(xhdr.val_len == strlen(val));
+            assert(0 == memcmp(lsxpack_header_get_value(&xhdr), val,
+                                                            xhdr.val_len));
+        }
+        assert(i == 30);
+
+        lshpack_enc_cleanup(&fresh);
+        lshpack_dec_cleanup(&hdec);
+        lshpack_enc_cleanup(&henc);
+    }
+}
+
+
+/* Dynamic table entries do not copy names from the static table, and the
+ * decoder's point at long names of other entries.  Capacities must not
+ * change.  The decoder with views on copies every name: compare the two.
+ */
+static void
+test_shared_names (void)
+{
+    static const char *const names[] =
+    {
+        "content-type", "x-long-custom-header-name", "x-request-id",
+    };
+    struct lshpack_enc henc;
+    struct lshpack_dec hdec[2];
+    struct lsxpack_header xhdr;
+    struct enc_dyn_table_entry entry;
+    const unsigned char *p;
+    unsigned char *end;
+    unsigned char encbuf[0x100];
+    char val[0x20], out[0x100];
+    unsigned i, k, capacity, stored;
+    void *iter;
+    int rc;
+
+    rc = lshpack_enc_init(&henc);
+    assert(rc == 0);
+    lshpack_enc_set_max_capacity(&henc, 1024);
+    for (k = 0; k < 2; ++k)
+    {
+        lshpack_dec_init(&hdec[k]);
+        lshpack_dec_set_max_capacity(&hdec[k], 1024);
+    }
+    lshpack_dec_use_views(&hdec[1], 1);
+
+    for (i = 0; i < 3000; ++i)
+    {
+        /* Entries made before views are turned on are copied from */
+        if (i == 2000)
+            lshpack_dec_use_views(&hdec[0], 1);
+        snprintf(val, sizeof(val), "value-%u", i % 37);
+        lsxpack_header_set_ptr(&xhdr, names[i % 3], strlen(names[i % 3]),
+                                                        val, strlen(val));
+        end = lshpack_enc_encode(&henc, encbuf, encbuf + sizeof(encbuf),
+                                                                    &xhdr);
+        assert(end > encbuf);
+        for (k = 0; k < 2; ++k)
+        {
+            p = encbuf;
+            lsxpack_header_prepare_decode(&xhdr, out, 0, sizeof(out));
+            rc = lshpack_dec_decode(&hdec[k], &p, end, &xhdr);
+            assert(rc == 0 && p == end);
+            assert(xhdr.name_len == strlen(names[i % 3]));
+            assert(0 == memcmp(lsxpack_header_get_name(&xhdr), names[i % 3],
+                                                            xhdr.name_len));
+            assert(xhdr.val_len == strlen(val));
+            assert(0 == memcmp(lsxpack_header_get_value(&xhdr), val,
+                                                            xhdr.val_len));
+            assert(hdec[k].hpd_cur_capacity == henc.hpe_cur_capacity);
+        }
+        if (i == 1999)
+            assert(lshpack_dec_mem_used(&hdec[0])
+                                        < lshpack_dec_mem_used(&hdec[1]));
+    }
+
+    capacity = 0;
+    stored = 0;
+    lshpack_enc_iter_init(&henc, &iter);
+    while (0 == lshpack_enc_iter_next(&henc, &iter, &entry))
+    {
+        assert((entry.name_len == strlen(names[0])
+                    && 0 == memcmp(entry.name, names[0], entry.name_len))
+            || (entry.name_len == strlen(names[1])
+                    && 0 == memcmp(entry.name, names[1], entry.name_len))
+            || (entry.name_len == strlen(names[2])
+                    && 0 == memcmp(entry.name, names[2], entry.name_len)));
+        capacity += 32 + entry.name_len + entry.value_len;
+        /* Only names not in the static table are stored */
+        if (!(entry.name_len == strlen(names[0])
+                    && 0 == memcmp(entry.name, names[0], entry.name_len)))
+            stored += entry.name_len;
+        stored += entry.value_len;
+    }
+    assert(capacity == henc.hpe_cur_capacity);
+    assert(henc.hpe_pl_end - henc.hpe_pl_off == stored);
+
+    for (k = 0; k < 2; ++k)
+        lshpack_dec_cleanup(&hdec[k]);
+    lshpack_enc_cleanup(&henc);
+}
+
+
+#if LSHPACK_PROFILE
+static void
+test_prof (void)
+{
+    struct lshpack_enc henc;
+    struct lshpack_dec hdec;
+    struct lsxpack_header xhdr;
+    struct lshpack_prof prof;
+    enum lshpack_prof_phase phase;
+    const unsigned char *p;
+    unsigned char *end;
+    unsigned char encbuf[0x1000];
+    char name[0x20], val[0x40], out[0x100];
+    unsigned i;
+    int rc;
+
+    lshpack_prof_reset();
+    lshpack_enc_init(&henc);
+    lshpack_dec_init(&hdec);
+    /* Small table, so that entries are evicted */
+    lshpack_enc_set_max_capacity(&henc, 256);
+    lshpack_dec_set_max_capacity(&hdec, 256);
+
+    end = encbuf;
+    for (i = 0; i < 20; ++i)
+    {
+        snprintf(name, sizeof(name), "x-header-%u", i % 5);
+        snprintf(val, sizeof(val), "value-value-value-%u", i % 7);
+        lsxpack_header_set_ptr(&xhdr, name, strlen(name), val, strlen(val));
+        p = lshpack_enc_encode(&henc, end, encbuf + sizeof(encbuf), &xhdr);
+        assert(p > end);
+        end = (unsigned char *) p;
+        lsxpack_header_set_ptr(&xhdr, ":method", 7, "GET", 3);
+        p = lshpack_enc_encode(&henc, end, encbuf + sizeof(encbuf), &xhdr);
+        assert(p > end);
+        end = (unsigned char *) p;
+    }
+
+    p = encbuf;
+    while (p < end)
+    {
+        lsxpack_header_prepare_decode(&xhdr, out, 0, sizeof(out));
+        rc = lshpack_dec_decode(&hdec, &p, end, &xhdr);
+        assert(rc == 0);
+    }
+
+    lshpack_prof_get(&prof);
+    for (phase = 0; phase < LSHPACK_PROF_N_PHASES; ++phase)
+    {
+        assert(lshpack_prof_phase_name(phase));
+        assert(prof.calls[phase] > 0);
+    }
+    assert(prof.calls[LSHPACK_PROF_ENCODE] == 40);
+    assert(prof.calls[LSHPACK_PROF_DECODE] == 40);
+    assert(prof.cycles[LSHPACK_PROF_ENCODE] > 0);
+    assert(prof.cycles[LSHPACK_PROF_DECODE] > 0);
+    assert(!lshpack_prof_phase_name(LSHPACK_PROF_N_PHASES));
+
+    lshpack_prof_reset();
+    lshpack_prof_get(&prof);
+    for (phase = 0; phase < LSHPACK_PROF_N_PHASES; ++phase)
+        assert(prof.calls[phase] == 0 && prof.cycles[phase] == 0);
+
+    lshpack_dec_cleanup(&hdec);
+    lshpack_enc_cleanup(&henc);
+}
+#endif
+
+
+int
+main (int argc, char **argv)
+{
+    test_header_arr();
+
+    /* Now do the same thing, but with longer codes to exercise the fallback
+     * mechanism.
+     */
+    insert_long_codes_into_header_arr();
+    test_header_arr();
+
+    test_decode_limits();
+    test_static_table_search_simple();
+    test_static_table_search_exhaustive();
+    test_hpack_test_RFC_Example();
+    test_hpack_self_enc_dec_test();
+    test_hpack_encode_and_decode();
+    test_hpack_self_enc_dec_test_firefox_error();
+    test_hdec_table_size_updates();
+    test_hdec_evict_on_insert();
+    test_henc_boundary1();
+    test_henc_boundary2();
+    test_henc_nonascii();
+    test_henc_long_compressable();
+    test_henc_long_uncompressable();
+    test_huffman_encoding_corner_cases();
+
+    test_huff_dec_empty_string();
+    test_huff_dec_trailing_garbage(1);
+    test_huff_dec_trailing_garbage(0);
+    test_huff_dec_fallback();
+    test_huff_dec_all_symbols();
+#if LS_HPACK_USE_LARGE_TABLES
+    test_huff_dec_bad_eos();
+#endif
+    test_hdec_static_idx_0();
+    test_hdec_boundary();
+    test_hdec_resume();
+    test_hdec_lazy_huff();
+    test_lazy_reencode();
+    test_hdec_views();
+    test_hdec_block();
+    test_hdec_stream();
+    test_hdec_stream_limits();
+    test_hdec_runtime_flags();
+    test_hdec_lazy_hash();
+    test_app_reg();
+    test_h1_head();
+    test_hdec_validate();
+    test_hdec_limits();
+    test_henc_table_churn();
+    test_henc_empty_name();
+    test_enc_dec_reset();
+    test_shared_names();
+#if LSHPACK_PROFILE
+    test_prof();
+#endif
 
     return 0;
 }
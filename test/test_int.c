@@ -165,7 +165,8 @@ main (void)
     const unsigned char *src;
     unsigned char *dst;
     unsigned char buf[ sizeof(((struct int_test *) NULL)->it_encoded) ];
-    uint32_t val;
+    uint32_t val, orig_val;
+    unsigned prefix_bits, shift;
     size_t sz;
     int rv;
 
@@ -187,6 +188,18 @@ main (void)
         assert(rv == test->it_dec_retval);
         if (0 == rv)
             assert(val == test->it_decoded);
+        /* Again, with enough trailing bytes for the 64-bit load */
+        if (test->it_dec_retval == -1)
+            continue;
+        src = test->it_encoded;
+        rv = lshpack_dec_dec_int(&src, src + sizeof(test->it_encoded),
+                                                    test->it_prefix_bits, &val);
+        assert(rv == test->it_dec_retval);
+        if (0 == rv)
+        {
+            assert(val == test->it_decoded);
+            assert(src == test->it_encoded + test->it_enc_sz);
+        }
     }
 
     /* Test the encoder */
@@ -214,5 +227,25 @@ main (void)
         }
     }
 
+    /* Round trip values around powers of two, with and without trailing
+     * bytes
+     */
+    for (prefix_bits = 1; prefix_bits <= 8; ++prefix_bits)
+        for (shift = 0; shift < 32 * 3; ++shift)
+        {
+            orig_val = ((uint32_t) 1 << shift / 3) + shift % 3 - 1;
+            memset(buf, 0xFF, sizeof(buf));
+            buf[0] = 0;
+            dst = lshpack_enc_enc_int(buf, buf + sizeof(buf), orig_val,
+                                                                prefix_bits);
+            assert(dst > buf);
+            src = buf;
+            rv = lshpack_dec_dec_int(&src, dst, prefix_bits, &val);
+            assert(0 == rv && val == orig_val && src == dst);
+            src = buf;
+            rv = lshpack_dec_dec_int(&src, buf + sizeof(buf), prefix_bits, &val);
+            assert(0 == rv && val == orig_val && src == dst);
+        }
+
     return 0;
 }